@@ -0,0 +1,716 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Host-side storage path benchmark for the CFS Data Storage (DS) application
+ *
+ * @note
+ *   The benchmark builds a packet filter table and a destination file
+ *   table in the same form as the sample tables, initializes DS, then
+ *   pushes synthetic telemetry packets through DS_AppStorePacket as the
+ *   software bus would.  Packets are prebuilt in a pool with the chosen
+ *   message ID mix and sizes; only the sequence count and time stamp
+ *   are updated before each packet is stored.
+ *
+ *   The report shows packets per second, file system calls per packet
+ *   and the distribution of per-packet storage latency.  Per-packet
+ *   timing adds two clock reads to every packet, use -L to measure
+ *   throughput without it.
+ */
+
+/* POSIX.1-2008 for getopt and clock_gettime, also when built with -std=c99 */
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "ds_bench.h"
+
+#include "ds_app.h"
+#include "ds_file.h"
+#include "ds_table.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Benchmark definitions                                           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#define DS_BENCH_POOL_SIZE        4096   /**< \brief Count of prebuilt packets cycled through the storage path */
+#define DS_BENCH_BASE_MID         0x0A00 /**< \brief First telemetry message ID used by the benchmark */
+#define DS_BENCH_MAX_PACKET       4096   /**< \brief Largest synthetic packet size */
+#define DS_BENCH_START_SECS       1000000000
+#define DS_BENCH_MAX_WILDCARD     8      /**< \brief Largest wildcard size (log2 of MIDs per entry) */
+#define DS_BENCH_PREDICATE_PASSES 256    /**< \brief Passes over the pool when timing predicate evaluation */
+
+/**
+ * \brief Benchmark run options
+ */
+typedef struct
+{
+    uint32 PacketCount;   /**< \brief Count of packets pushed through DS */
+    uint32 MidCount;      /**< \brief Count of message IDs in the filter table */
+    double MidSkew;       /**< \brief MID selection skew (1.0 = uniform, larger favors low MIDs) */
+    uint32 UnknownPct;    /**< \brief Percent of packets with no filter table entry */
+    uint32 MinSize;       /**< \brief Smallest packet size (bytes) */
+    uint32 MaxSize;       /**< \brief Largest packet size (bytes) */
+    uint32 FileCount;     /**< \brief Count of enabled destination files */
+    uint32 FiltersPerMid; /**< \brief Destinations per message ID */
+    uint16 Algorithm_N;   /**< \brief Filter pass count (N of X) */
+    uint16 Algorithm_X;   /**< \brief Filter group size (N of X) */
+    uint32 MaxFileSize;   /**< \brief Destination file size limit (bytes) */
+    uint32 Predicates;    /**< \brief Payload predicate terms per filter entry (always true, all evaluated) */
+    uint32 WildcardBits;  /**< \brief Log2 of MIDs per filter entry (0 = one exact MID per entry) */
+    uint32 StoreLength;   /**< \brief Max store length of each filter (0 = whole packet) */
+    uint32 PacketRate;    /**< \brief Simulated packets per second (drives packet time stamps) */
+    uint32 Seed;          /**< \brief Random number seed */
+    bool   TimeEach;      /**< \brief Collect per-packet latency samples */
+    char   Directory[DS_PATHNAME_BUFSIZE]; /**< \brief Destination file directory */
+} DS_BenchOptions_t;
+
+static DS_BenchOptions_t DS_BenchOptions = {
+    .PacketCount   = 1000000,
+    .MidCount      = 16,
+    .MidSkew       = 1.0,
+    .UnknownPct    = 0,
+    .MinSize       = 64,
+    .MaxSize       = 512,
+    .FileCount     = 4,
+    .FiltersPerMid = 1,
+    .Algorithm_N   = 1,
+    .Algorithm_X   = 1,
+    .MaxFileSize   = 64 * 1024 * 1024,
+    .Predicates    = 0,
+    .WildcardBits  = 0,
+    .StoreLength   = 0,
+    .PacketRate    = 10000,
+    .Seed          = 1,
+    .TimeEach      = true,
+    .Directory     = "/tmp/ds_bench",
+};
+
+static DS_FilterTable_t   DS_BenchFilterTable;
+static DS_DestFileTable_t DS_BenchDestFileTable;
+
+static CFE_SB_Buffer_t *DS_BenchPool[DS_BENCH_POOL_SIZE];
+
+static uint32 DS_BenchRandomState;
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Random numbers (xorshift, so runs repeat for a given seed)      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static uint32 DS_BenchRandom(void)
+{
+    DS_BenchRandomState ^= DS_BenchRandomState << 13;
+    DS_BenchRandomState ^= DS_BenchRandomState >> 17;
+    DS_BenchRandomState ^= DS_BenchRandomState << 5;
+
+    return DS_BenchRandomState;
+}
+
+static double DS_BenchUniform(void)
+{
+    return (double)DS_BenchRandom() / 4294967296.0;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Command line options                                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static void DS_BenchUsage(const char *Name)
+{
+    fprintf(stderr,
+            "Usage: %s [options]\n"
+            "  -n count   packets to store (default %lu)\n"
+            "  -m count   message IDs in the filter table (default %lu, max %d)\n"
+            "  -z skew    MID skew, 1.0 = uniform, larger favors fewer MIDs (default %.1f)\n"
+            "  -u pct     percent of packets with no filter entry (default %lu)\n"
+            "  -s bytes   smallest packet size (default %lu)\n"
+            "  -S bytes   largest packet size (default %lu, max %d)\n"
+            "  -f count   destination files (default %lu, max %d)\n"
+            "  -g count   destinations per MID (default %lu, max %d)\n"
+            "  -p N/X     store N of every X packets (default %u/%u)\n"
+            "  -F bytes   max destination file size (default %lu)\n"
+            "  -P terms   payload predicate terms per filter entry, always true (default %lu, max %d)\n"
+            "  -w bits    filter entries are wildcards for 2^bits MIDs each (default %lu, max %d)\n"
+            "  -t bytes   store only the first bytes of each packet, 0 = all (default %lu, max %d)\n"
+            "  -r rate    simulated packets per second for time stamps (default %lu)\n"
+            "  -d dir     destination file directory (default %s)\n"
+            "  -x seed    random number seed (default %lu)\n"
+            "  -L         skip per-packet latency timing\n"
+            "  -v         print events sent by DS\n",
+            Name, (unsigned long)DS_BenchOptions.PacketCount, (unsigned long)DS_BenchOptions.MidCount,
+            DS_PACKETS_IN_FILTER_TABLE, DS_BenchOptions.MidSkew, (unsigned long)DS_BenchOptions.UnknownPct,
+            (unsigned long)DS_BenchOptions.MinSize, (unsigned long)DS_BenchOptions.MaxSize, DS_BENCH_MAX_PACKET,
+            (unsigned long)DS_BenchOptions.FileCount, DS_DEST_FILE_CNT, (unsigned long)DS_BenchOptions.FiltersPerMid,
+            DS_FILTERS_PER_PACKET, DS_BenchOptions.Algorithm_N, DS_BenchOptions.Algorithm_X,
+            (unsigned long)DS_BenchOptions.MaxFileSize, (unsigned long)DS_BenchOptions.Predicates,
+            DS_PREDICATE_TERMS, (unsigned long)DS_BenchOptions.WildcardBits, DS_BENCH_MAX_WILDCARD,
+            (unsigned long)DS_BenchOptions.StoreLength, DS_TRUNCATE_MAX_LENGTH,
+            (unsigned long)DS_BenchOptions.PacketRate,
+            DS_BenchOptions.Directory, (unsigned long)DS_BenchOptions.Seed);
+}
+
+static bool DS_BenchParseOptions(int argc, char *argv[])
+{
+    DS_BenchOptions_t *Opt = &DS_BenchOptions;
+    unsigned int       N;
+    unsigned int       X;
+    int                c;
+
+    while ((c = getopt(argc, argv, "n:m:z:u:s:S:f:g:p:F:P:w:t:r:d:x:Lvh")) != -1)
+    {
+        switch (c)
+        {
+            case 'n':
+                Opt->PacketCount = strtoul(optarg, NULL, 0);
+                break;
+            case 'm':
+                Opt->MidCount = strtoul(optarg, NULL, 0);
+                break;
+            case 'z':
+                Opt->MidSkew = strtod(optarg, NULL);
+                break;
+            case 'u':
+                Opt->UnknownPct = strtoul(optarg, NULL, 0);
+                break;
+            case 's':
+                Opt->MinSize = strtoul(optarg, NULL, 0);
+                break;
+            case 'S':
+                Opt->MaxSize = strtoul(optarg, NULL, 0);
+                break;
+            case 'f':
+                Opt->FileCount = strtoul(optarg, NULL, 0);
+                break;
+            case 'g':
+                Opt->FiltersPerMid = strtoul(optarg, NULL, 0);
+                break;
+            case 'p':
+                if (sscanf(optarg, "%u/%u", &N, &X) != 2)
+                {
+                    return false;
+                }
+                Opt->Algorithm_N = (uint16)N;
+                Opt->Algorithm_X = (uint16)X;
+                break;
+            case 'F':
+                Opt->MaxFileSize = strtoul(optarg, NULL, 0);
+                break;
+            case 'P':
+                Opt->Predicates = strtoul(optarg, NULL, 0);
+                break;
+            case 'w':
+                Opt->WildcardBits = strtoul(optarg, NULL, 0);
+                break;
+            case 't':
+                Opt->StoreLength = strtoul(optarg, NULL, 0);
+                break;
+            case 'r':
+                Opt->PacketRate = strtoul(optarg, NULL, 0);
+                break;
+            case 'd':
+                snprintf(Opt->Directory, sizeof(Opt->Directory), "%s", optarg);
+                break;
+            case 'x':
+                Opt->Seed = strtoul(optarg, NULL, 0);
+                break;
+            case 'L':
+                Opt->TimeEach = false;
+                break;
+            case 'v':
+                DS_BenchData.ShowEvents = true;
+                break;
+            default:
+                return false;
+        }
+    }
+
+    if ((Opt->PacketCount == 0) || (Opt->MidCount == 0) || (Opt->MidCount > DS_PACKETS_IN_FILTER_TABLE) ||
+        (Opt->MidSkew <= 0.0) || (Opt->UnknownPct > 100) || (Opt->MinSize < sizeof(CFE_MSG_TelemetryHeader_t)) ||
+        (Opt->MaxSize < Opt->MinSize) || (Opt->MaxSize > DS_BENCH_MAX_PACKET) || (Opt->FileCount == 0) ||
+        (Opt->FileCount > DS_DEST_FILE_CNT) || (Opt->FiltersPerMid == 0) ||
+        (Opt->FiltersPerMid > DS_FILTERS_PER_PACKET) || (Opt->FiltersPerMid > Opt->FileCount) ||
+        (Opt->Algorithm_X == 0) || (Opt->Algorithm_N > Opt->Algorithm_X) || (Opt->PacketRate == 0) || (Opt->Seed == 0))
+    {
+        fprintf(stderr, "Invalid option value\n");
+        return false;
+    }
+
+    /*
+    ** Predicate fields must lie within the smallest packet, wildcard entries
+    ** must cover the MIDs exactly, and stored lengths must pass table verification...
+    */
+    if ((Opt->Predicates > DS_PREDICATE_TERMS) ||
+        (Opt->MinSize < (sizeof(CFE_MSG_TelemetryHeader_t) + (Opt->Predicates * sizeof(uint32)))) ||
+        (Opt->WildcardBits > DS_BENCH_MAX_WILDCARD) || ((Opt->MidCount % (1 << Opt->WildcardBits)) != 0) ||
+        ((Opt->WildcardBits != 0) && (Opt->MidCount > DS_WILDCARD_MIDS)) ||
+        ((Opt->StoreLength != 0) &&
+         ((Opt->StoreLength < sizeof(CFE_MSG_TelemetryHeader_t)) || (Opt->StoreLength > DS_TRUNCATE_MAX_LENGTH))))
+    {
+        fprintf(stderr, "Invalid filter table option value\n");
+        return false;
+    }
+
+    return true;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Table and packet setup                                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static void DS_BenchBuildTables(void)
+{
+    DS_BenchOptions_t * Opt = &DS_BenchOptions;
+    DS_DestFileEntry_t *DestFile;
+    DS_PacketEntry_t *  PacketEntry;
+    DS_FilterParms_t *  FilterParms;
+    DS_PredicateTerm_t *Term;
+    uint32              i;
+    uint32              j;
+
+    memset(&DS_BenchDestFileTable, 0, sizeof(DS_BenchDestFileTable));
+    memset(&DS_BenchFilterTable, 0, sizeof(DS_BenchFilterTable));
+
+    snprintf(DS_BenchDestFileTable.Descriptor, sizeof(DS_BenchDestFileTable.Descriptor), "Benchmark files");
+    snprintf(DS_BenchFilterTable.Descriptor, sizeof(DS_BenchFilterTable.Descriptor), "Benchmark filters");
+
+    for (i = 0; i < Opt->FileCount; i++)
+    {
+        DestFile = &DS_BenchDestFileTable.File[i];
+
+        snprintf(DestFile->Pathname, sizeof(DestFile->Pathname), "%.*s/", (int)sizeof(DestFile->Pathname) - 2,
+                 Opt->Directory);
+        snprintf(DestFile->Basename, sizeof(DestFile->Basename), "bench%02lu_", (unsigned long)i);
+        snprintf(DestFile->Extension, sizeof(DestFile->Extension), ".dat");
+
+        DestFile->FileNameType = DS_BY_COUNT;
+        DestFile->EnableState  = DS_ENABLED;
+        DestFile->MaxFileSize  = Opt->MaxFileSize;
+        DestFile->MaxFileAge   = 0xFFFFFFFF;
+    }
+
+    /*
+    ** Destinations for each entry rotate through the enabled files...
+    */
+    for (i = 0; i < (Opt->MidCount >> Opt->WildcardBits); i++)
+    {
+        PacketEntry = &DS_BenchFilterTable.Packet[i];
+
+        PacketEntry->MessageID = CFE_SB_ValueToMsgId(DS_BENCH_BASE_MID + (i << Opt->WildcardBits));
+
+        if (Opt->WildcardBits != 0)
+        {
+            PacketEntry->MessageMask = 0xFFFFFFFF << Opt->WildcardBits;
+        }
+
+        for (j = 0; j < Opt->FiltersPerMid; j++)
+        {
+            FilterParms = &PacketEntry->Filter[j];
+
+            FilterParms->FileTableIndex = (uint8)((i + j) % Opt->FileCount);
+            FilterParms->FilterType     = DS_BY_COUNT;
+            FilterParms->Algorithm_N    = Opt->Algorithm_N;
+            FilterParms->Algorithm_X    = Opt->Algorithm_X;
+            FilterParms->MaxStoreLength = (uint16)Opt->StoreLength;
+        }
+
+        /*
+        ** Terms test consecutive payload words and always match (AND), so each one is evaluated...
+        */
+        PacketEntry->PredicateLogic = DS_PREDICATE_AND;
+
+        for (j = 0; j < Opt->Predicates; j++)
+        {
+            Term = &PacketEntry->Predicate[j];
+
+            Term->Offset   = (uint16)(sizeof(CFE_MSG_TelemetryHeader_t) + (j * sizeof(uint32)));
+            Term->Width    = sizeof(uint32);
+            Term->Operator = DS_PREDICATE_GE;
+            Term->Mask     = 0xFFFFFFFF;
+            Term->Value    = 0;
+        }
+    }
+
+    DS_BenchSetTableImage(DS_DESTINATION_TBL_NAME, &DS_BenchDestFileTable);
+    DS_BenchSetTableImage(DS_FILTER_TBL_NAME, &DS_BenchFilterTable);
+}
+
+static bool DS_BenchBuildPool(void)
+{
+    DS_BenchOptions_t *Opt = &DS_BenchOptions;
+    CFE_SB_MsgId_t     MessageID;
+    uint32             MidIndex;
+    uint32             Size;
+    uint32             i;
+    uint32             j;
+
+    for (i = 0; i < DS_BENCH_POOL_SIZE; i++)
+    {
+        if ((DS_BenchRandom() % 100) < Opt->UnknownPct)
+        {
+            /*
+            ** Message IDs past the table entries take the "no filter" path...
+            */
+            MidIndex = Opt->MidCount + (DS_BenchRandom() % DS_PACKETS_IN_FILTER_TABLE);
+        }
+        else
+        {
+            MidIndex = (uint32)((double)Opt->MidCount * pow(DS_BenchUniform(), Opt->MidSkew));
+        }
+
+        MessageID = CFE_SB_ValueToMsgId(DS_BENCH_BASE_MID + MidIndex);
+        Size      = Opt->MinSize + (DS_BenchRandom() % (Opt->MaxSize - Opt->MinSize + 1));
+
+        DS_BenchPool[i] = malloc(DS_BENCH_MAX_PACKET);
+
+        if (DS_BenchPool[i] == NULL)
+        {
+            return false;
+        }
+
+        CFE_MSG_Init(&DS_BenchPool[i]->Msg, MessageID, Size);
+
+        for (j = sizeof(CFE_MSG_TelemetryHeader_t); j < Size; j++)
+        {
+            ((uint8 *)DS_BenchPool[i])[j] = (uint8)DS_BenchRandom();
+        }
+    }
+
+    return true;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Results                                                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static int DS_BenchCompare(const void *A, const void *B)
+{
+    uint32 ValueA = *(const uint32 *)A;
+    uint32 ValueB = *(const uint32 *)B;
+
+    return (ValueA > ValueB) - (ValueA < ValueB);
+}
+
+static uint32 DS_BenchPercentile(const uint32 *Sorted, uint32 Count, double Fraction)
+{
+    return Sorted[(uint32)(Fraction * (double)(Count - 1))];
+}
+
+static uint64 DS_BenchNanoseconds(void)
+{
+    struct timespec Now;
+
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+
+    return ((uint64)Now.tv_sec * 1000000000) + (uint64)Now.tv_nsec;
+}
+
+static uint64 DS_BenchTimePredicates(const DS_PacketPredicate_t *const *Predicates, uint32 *MatchCount)
+{
+    uint64 StartNs;
+    uint32 Pass;
+    uint32 i;
+
+    *MatchCount = 0;
+    StartNs     = DS_BenchNanoseconds();
+
+    for (Pass = 0; Pass < DS_BENCH_PREDICATE_PASSES; Pass++)
+    {
+        for (i = 0; i < DS_BENCH_POOL_SIZE; i++)
+        {
+            *MatchCount += DS_IsPacketMatched(&DS_BenchPool[i]->Msg, Predicates[i]);
+        }
+    }
+
+    return DS_BenchNanoseconds() - StartNs;
+}
+
+static void DS_BenchReportPredicates(void)
+{
+    static const DS_PacketPredicate_t *TablePredicates[DS_BENCH_POOL_SIZE];
+    static const DS_PacketPredicate_t *EmptyPredicates[DS_BENCH_POOL_SIZE];
+    static DS_PacketPredicate_t        EmptyPredicate;
+    CFE_SB_MsgId_t                     MessageID;
+    double                             Evaluations = (double)DS_BENCH_POOL_SIZE * DS_BENCH_PREDICATE_PASSES;
+    uint64                             TableNs;
+    uint64                             EmptyNs;
+    uint32                             TableMatches;
+    uint32                             EmptyMatches;
+    int32                              FilterIndex;
+    uint32                             i;
+
+    /*
+    ** Evaluate the compiled predicates of the loaded table, then the empty
+    ** predicate that every entry of a table without predicates compiles to...
+    */
+    for (i = 0; i < DS_BENCH_POOL_SIZE; i++)
+    {
+        CFE_MSG_GetMsgId(&DS_BenchPool[i]->Msg, &MessageID);
+        FilterIndex = DS_TableFindMsgID(MessageID);
+
+        TablePredicates[i] = &EmptyPredicate;
+        EmptyPredicates[i] = &EmptyPredicate;
+
+        if (FilterIndex != DS_INDEX_NONE)
+        {
+            TablePredicates[i] = &DS_AppData.FilterPredicate[FilterIndex];
+        }
+    }
+
+    TableNs = DS_BenchTimePredicates(TablePredicates, &TableMatches);
+    EmptyNs = DS_BenchTimePredicates(EmptyPredicates, &EmptyMatches);
+
+    printf("  predicates (ns) : %.1f per packet with %lu terms (%.0f%% match), %.1f with none, cost %.1f\n",
+           (double)TableNs / Evaluations, (unsigned long)DS_BenchOptions.Predicates,
+           100.0 * (double)TableMatches / Evaluations, (double)EmptyNs / Evaluations,
+           ((double)TableNs - (double)EmptyNs) / Evaluations);
+}
+
+static void DS_BenchReportStage(const char *Name, const DS_StageStats_t *StagePtr)
+{
+    uint32 Bin;
+    uint32 Peak = 0;
+
+    if (StagePtr->Count == 0)
+    {
+        return;
+    }
+
+    /*
+    ** Most populated log2 bin (bin N holds 2^(N-1) up to 2^N microseconds)...
+    */
+    for (Bin = 1; Bin < DS_STATS_HISTOGRAM_BINS; Bin++)
+    {
+        if (StagePtr->Histogram[Bin] > StagePtr->Histogram[Peak])
+        {
+            Peak = Bin;
+        }
+    }
+
+    printf("  DS %-6s (us)  : count %lu, mean %.2f, max %lu, mode bin %lu\n", Name, (unsigned long)StagePtr->Count,
+           (double)StagePtr->TotalTime / StagePtr->Count, (unsigned long)StagePtr->MaxTime, (unsigned long)Peak);
+}
+
+static void DS_BenchReport(const DS_BenchSyscalls_t *Calls, uint64 ElapsedNs, uint32 *Samples)
+{
+    DS_BenchOptions_t *Opt     = &DS_BenchOptions;
+    double             Packets = (double)Opt->PacketCount;
+    double             Seconds = (double)ElapsedNs / 1e9;
+    uint64             Total;
+
+    Total = Calls->Open + Calls->Close + Calls->Write + Calls->Read + Calls->Seek + Calls->Rename + Calls->Remove +
+            Calls->Stat + Calls->Mkdir;
+
+    printf("DS storage path benchmark\n");
+    printf("  packets         : %lu (MIDs %lu, skew %.2f, unknown %lu%%, sizes %lu-%lu bytes)\n",
+           (unsigned long)Opt->PacketCount, (unsigned long)Opt->MidCount, Opt->MidSkew,
+           (unsigned long)Opt->UnknownPct, (unsigned long)Opt->MinSize, (unsigned long)Opt->MaxSize);
+    printf("  destinations    : %lu files, %lu per MID, store %u of %u\n", (unsigned long)Opt->FileCount,
+           (unsigned long)Opt->FiltersPerMid, Opt->Algorithm_N, Opt->Algorithm_X);
+    printf("  filter table    : %lu entries of %lu MIDs, %lu predicate terms, ",
+           (unsigned long)(Opt->MidCount >> Opt->WildcardBits), (unsigned long)(1 << Opt->WildcardBits),
+           (unsigned long)Opt->Predicates);
+
+    if (Opt->StoreLength == 0)
+    {
+        printf("whole packets stored\n");
+    }
+    else
+    {
+        printf("first %lu bytes stored\n", (unsigned long)Opt->StoreLength);
+    }
+
+    printf("  elapsed         : %.3f s\n", Seconds);
+    printf("  throughput      : %.0f packets/s, %.1f MB/s written\n", Packets / Seconds,
+           (double)Calls->BytesWritten / Seconds / 1e6);
+    printf("  syscalls/packet : %.3f (write %.3f, lseek %.3f, read %.3f, open %.3f, close %.3f, rename %.3f, "
+           "unlink %.3f)\n",
+           (double)Total / Packets, (double)Calls->Write / Packets, (double)Calls->Seek / Packets,
+           (double)Calls->Read / Packets, (double)Calls->Open / Packets, (double)Calls->Close / Packets,
+           (double)Calls->Rename / Packets, (double)Calls->Remove / Packets);
+
+    if (Samples != NULL)
+    {
+        qsort(Samples, Opt->PacketCount, sizeof(uint32), DS_BenchCompare);
+
+        printf("  latency (ns)    : p50 %lu, p90 %lu, p99 %lu, p99.9 %lu, max %lu\n",
+               (unsigned long)DS_BenchPercentile(Samples, Opt->PacketCount, 0.50),
+               (unsigned long)DS_BenchPercentile(Samples, Opt->PacketCount, 0.90),
+               (unsigned long)DS_BenchPercentile(Samples, Opt->PacketCount, 0.99),
+               (unsigned long)DS_BenchPercentile(Samples, Opt->PacketCount, 0.999),
+               (unsigned long)Samples[Opt->PacketCount - 1]);
+    }
+
+    if (Opt->Predicates != 0)
+    {
+        DS_BenchReportPredicates();
+    }
+
+    DS_BenchReportStage("filter", &DS_AppData.Stats.Filter);
+    DS_BenchReportStage("write", &DS_AppData.Stats.Write);
+    DS_BenchReportStage("create", &DS_AppData.Stats.Create);
+    DS_BenchReportStage("close", &DS_AppData.Stats.Close);
+
+    printf("  DS counters     : passed %lu, filtered %lu, ignored %lu, write errors %lu, events %lu\n",
+           (unsigned long)DS_AppData.PassedPktCounter, (unsigned long)DS_AppData.FilteredPktCounter,
+           (unsigned long)DS_AppData.IgnoredPktCounter, (unsigned long)DS_AppData.FileWriteErrCounter,
+           (unsigned long)DS_BenchData.EventCount);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Benchmark entry point                                           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int main(int argc, char *argv[])
+{
+    DS_BenchOptions_t *     Opt = &DS_BenchOptions;
+    DS_BenchSyscalls_t      Calls;
+    CFE_MSG_SequenceCount_t SeqCount[DS_PACKETS_IN_FILTER_TABLE * 2];
+    CFE_SB_Buffer_t *       BufPtr;
+    CFE_SB_MsgId_t          MessageID;
+    uint32 *                Samples = NULL;
+    uint64                  SimTicks;
+    uint64                  TickStep;
+    uint64                  StartNs;
+    uint64                  ElapsedNs;
+    uint64                  PacketNs;
+    uint32                  MidIndex;
+    uint32                  i;
+
+    if (DS_BenchParseOptions(argc, argv) == false)
+    {
+        DS_BenchUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if ((mkdir(Opt->Directory, 0755) != 0) && (errno != EEXIST))
+    {
+        fprintf(stderr, "Unable to create directory %s\n", Opt->Directory);
+        return EXIT_FAILURE;
+    }
+
+    DS_BenchRandomState = Opt->Seed;
+
+    if (Opt->TimeEach)
+    {
+        Samples = malloc((size_t)Opt->PacketCount * sizeof(uint32));
+    }
+
+    if ((DS_BenchBuildPool() == false) || (Opt->TimeEach && (Samples == NULL)))
+    {
+        fprintf(stderr, "Unable to allocate packet memory\n");
+        return EXIT_FAILURE;
+    }
+
+    DS_BenchBuildTables();
+
+    /*
+    ** Time stamps step at the simulated packet rate (2^-32 second ticks)...
+    */
+    SimTicks = (uint64)DS_BENCH_START_SECS << 32;
+    TickStep = ((uint64)1 << 32) / Opt->PacketRate;
+
+    DS_BenchData.SimTime.Seconds    = (uint32)(SimTicks >> 32);
+    DS_BenchData.SimTime.Subseconds = 0;
+
+    if ((DS_AppInitialize() != CFE_SUCCESS) || (DS_AppData.FilterTblPtr == NULL) ||
+        (DS_AppData.DestFileTblPtr == NULL))
+    {
+        fprintf(stderr, "DS initialization failed (use -v to show events)\n");
+        return EXIT_FAILURE;
+    }
+
+    DS_AppData.AppEnableState = DS_ENABLED;
+
+    memset(SeqCount, 0, sizeof(SeqCount));
+    memset(&DS_BenchData.Syscalls, 0, sizeof(DS_BenchData.Syscalls));
+
+    StartNs = DS_BenchNanoseconds();
+
+    for (i = 0; i < Opt->PacketCount; i++)
+    {
+        BufPtr = DS_BenchPool[i % DS_BENCH_POOL_SIZE];
+
+        SimTicks += TickStep;
+        DS_BenchData.SimTime.Seconds    = (uint32)(SimTicks >> 32);
+        DS_BenchData.SimTime.Subseconds = (uint32)SimTicks;
+
+        CFE_MSG_GetMsgId(&BufPtr->Msg, &MessageID);
+        MidIndex = CFE_SB_MsgIdToValue(MessageID) - DS_BENCH_BASE_MID;
+
+        CFE_MSG_SetSequenceCount(&BufPtr->Msg, SeqCount[MidIndex]);
+        CFE_MSG_SetMsgTime(&BufPtr->Msg, DS_BenchData.SimTime);
+        SeqCount[MidIndex] = CFE_MSG_GetNextSequenceCount(SeqCount[MidIndex]);
+
+        if (Opt->TimeEach)
+        {
+            PacketNs = DS_BenchNanoseconds();
+            DS_AppStorePacket(MessageID, BufPtr);
+            PacketNs = DS_BenchNanoseconds() - PacketNs;
+
+            Samples[i] = (PacketNs > 0xFFFFFFFF) ? 0xFFFFFFFF : (uint32)PacketNs;
+        }
+        else
+        {
+            DS_AppStorePacket(MessageID, BufPtr);
+        }
+    }
+
+    ElapsedNs = DS_BenchNanoseconds() - StartNs;
+    Calls     = DS_BenchData.Syscalls;
+
+    /*
+    ** Close (and finish) the open destination files outside the measurement...
+    */
+    for (i = 0; i < DS_DEST_FILE_CNT; i++)
+    {
+        if (OS_ObjectIdDefined(DS_AppData.FileStatus[i].FileHandle))
+        {
+            DS_FileCloseDest(i);
+        }
+    }
+
+    DS_BenchReport(&Calls, ElapsedNs, Samples);
+
+    for (i = 0; i < DS_BENCH_POOL_SIZE; i++)
+    {
+        free(DS_BenchPool[i]);
+    }
+
+    free(Samples);
+
+    return EXIT_SUCCESS;
+}
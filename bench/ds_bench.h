@@ -0,0 +1,95 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Host-side storage path benchmark for the CFS Data Storage (DS) application
+ *
+ * @note
+ *   The benchmark links the DS application sources against minimal
+ *   stand-ins for the cFE and OSAL services they call.  OSAL file
+ *   calls are backed directly by POSIX and counted, so the report
+ *   can show how many system calls each stored packet costs.
+ */
+#ifndef DS_BENCH_H
+#define DS_BENCH_H
+
+#include "cfe.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Benchmark data structures                                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**
+ * \brief Count of OSAL stand-in calls that reached the file system
+ */
+typedef struct
+{
+    uint64 Open;   /**< \brief Count of open calls */
+    uint64 Close;  /**< \brief Count of close calls */
+    uint64 Write;  /**< \brief Count of write calls */
+    uint64 Read;   /**< \brief Count of read calls */
+    uint64 Seek;   /**< \brief Count of lseek calls */
+    uint64 Rename; /**< \brief Count of rename calls */
+    uint64 Remove; /**< \brief Count of unlink calls */
+    uint64 Stat;   /**< \brief Count of stat calls */
+    uint64 Mkdir;  /**< \brief Count of mkdir calls */
+
+    uint64 BytesWritten; /**< \brief Total bytes passed to write calls */
+} DS_BenchSyscalls_t;
+
+/**
+ * \brief Benchmark global data
+ */
+typedef struct
+{
+    DS_BenchSyscalls_t Syscalls; /**< \brief File system call counters */
+
+    uint32 EventCount;  /**< \brief Count of events sent by DS */
+    uint32 Subscribed;  /**< \brief Count of message IDs subscribed by DS */
+    uint32 Transmitted; /**< \brief Count of messages sent by DS */
+    bool   ShowEvents;  /**< \brief Print events sent by DS to stderr */
+
+    CFE_TIME_SysTime_t SimTime; /**< \brief Simulated spacecraft time returned by CFE_TIME_GetTime */
+} DS_BenchData_t;
+
+extern DS_BenchData_t DS_BenchData;
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Benchmark function prototypes                                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**
+ * \brief Provide the data for a table load
+ *
+ *  \par Description
+ *       The table services stand-in has no table files.  Loads from
+ *       file for the named table copy this image instead.  The
+ *       table image must remain valid until DS initialization is
+ *       complete.
+ *
+ *  \param[in] TableName Table name passed to CFE_TBL_Register
+ *  \param[in] ImagePtr  Pointer to table data
+ */
+void DS_BenchSetTableImage(const char *TableName, const void *ImagePtr);
+
+#endif
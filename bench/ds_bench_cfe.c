@@ -0,0 +1,786 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Minimal cFE stand-ins for the DS storage path benchmark
+ *
+ * @note
+ *   Only the services called by the DS application are provided and
+ *   only to the depth the storage path needs.  Message headers use
+ *   the CCSDS version 1 layout with the default cFE time format
+ *   (32 bit seconds, 16 bit subseconds) in the telemetry secondary
+ *   header.  Child tasks are accepted but never started.
+ */
+
+/* POSIX.1-2008 for clock_gettime, also when built with -std=c99 */
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "ds_bench.h"
+
+/*
+** Benchmark global data...
+*/
+DS_BenchData_t DS_BenchData;
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Stand-in local data                                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#define DS_BENCH_TABLE_CNT 2
+
+typedef struct
+{
+    char                      Name[CFE_MISSION_TBL_MAX_NAME_LENGTH];
+    size_t                    Size;
+    void *                    Buffer;
+    const void *              Image;
+    CFE_TBL_CallbackFuncPtr_t ValidationFuncPtr;
+    bool                      Loaded;
+    bool                      Updated;
+    char                      LastFileLoaded[OS_MAX_PATH_LEN];
+} DS_BenchTable_t;
+
+static DS_BenchTable_t DS_BenchTables[DS_BENCH_TABLE_CNT];
+
+static union
+{
+    CFE_SB_Buffer_t Buffer;
+    uint8           Bytes[CFE_MISSION_SB_MAX_SB_MSG_SIZE];
+} DS_BenchSendBuffer;
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Benchmark table image setup                                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static DS_BenchTable_t *DS_BenchFindTable(const char *TableName)
+{
+    int32 i;
+
+    for (i = 0; i < DS_BENCH_TABLE_CNT; i++)
+    {
+        if (strncmp(DS_BenchTables[i].Name, TableName, sizeof(DS_BenchTables[i].Name)) == 0)
+        {
+            return &DS_BenchTables[i];
+        }
+    }
+
+    return NULL;
+}
+
+void DS_BenchSetTableImage(const char *TableName, const void *ImagePtr)
+{
+    DS_BenchTable_t *Table = DS_BenchFindTable(TableName);
+
+    if (Table == NULL)
+    {
+        /*
+        ** Images may be provided before the table is registered...
+        */
+        Table = DS_BenchFindTable("");
+    }
+
+    if (Table != NULL)
+    {
+        strncpy(Table->Name, TableName, sizeof(Table->Name) - 1);
+        Table->Image = ImagePtr;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Executive services stand-ins                                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
+{
+    (void)Marker;
+    (void)EntryExit;
+}
+
+CFE_Status_t CFE_ES_WriteToSysLog(const char *SpecStringPtr, ...)
+{
+    va_list ArgPtr;
+
+    va_start(ArgPtr, SpecStringPtr);
+    vfprintf(stderr, SpecStringPtr, ArgPtr);
+    va_end(ArgPtr);
+
+    return CFE_SUCCESS;
+}
+
+bool CFE_ES_RunLoop(uint32 *RunStatus)
+{
+    return (*RunStatus == CFE_ES_RunStatus_APP_RUN);
+}
+
+void CFE_ES_ExitApp(uint32 ExitStatus)
+{
+    (void)ExitStatus;
+}
+
+CFE_Status_t CFE_ES_CreateChildTask(CFE_ES_TaskId_t *TaskIdPtr, const char *TaskName,
+                                    CFE_ES_ChildTaskMainFuncPtr_t FunctionPtr, CFE_ES_StackPointer_t StackPtr,
+                                    size_t StackSize, CFE_ES_TaskPriority_Atom_t Priority, uint32 Flags)
+{
+    (void)TaskIdPtr;
+    (void)TaskName;
+    (void)FunctionPtr;
+    (void)StackPtr;
+    (void)StackSize;
+    (void)Priority;
+    (void)Flags;
+
+    return CFE_SUCCESS;
+}
+
+void CFE_ES_ExitChildTask(void) {}
+
+CFE_Status_t CFE_ES_RegisterCDS(CFE_ES_CDSHandle_t *CDSHandlePtr, size_t BlockSize, const char *Name)
+{
+    (void)CDSHandlePtr;
+    (void)BlockSize;
+    (void)Name;
+
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_ES_CopyToCDS(CFE_ES_CDSHandle_t Handle, const void *DataToCopy)
+{
+    (void)Handle;
+    (void)DataToCopy;
+
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_ES_RestoreFromCDS(void *RestoreToMemory, CFE_ES_CDSHandle_t Handle)
+{
+    (void)RestoreToMemory;
+    (void)Handle;
+
+    return CFE_SUCCESS;
+}
+
+uint32 CFE_ES_CalculateCRC(const void *DataPtr, size_t DataLength, uint32 InputCRC, CFE_ES_CrcType_Enum_t TypeCRC)
+{
+    const uint8 *BufPtr = DataPtr;
+    uint32       Crc    = InputCRC & 0xFFFF;
+    size_t       i;
+    int32        Bit;
+
+    (void)TypeCRC;
+
+    /*
+    ** CRC-16/ARC, the only type cFE implements...
+    */
+    for (i = 0; i < DataLength; i++)
+    {
+        Crc ^= BufPtr[i];
+
+        for (Bit = 0; Bit < 8; Bit++)
+        {
+            Crc = ((Crc & 1) != 0) ? ((Crc >> 1) ^ 0xA001) : (Crc >> 1);
+        }
+    }
+
+    return Crc;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Event services stand-ins                                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+CFE_Status_t CFE_EVS_Register(const void *Filters, uint16 NumEventFilters, uint16 FilterScheme)
+{
+    (void)Filters;
+    (void)NumEventFilters;
+    (void)FilterScheme;
+
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_EVS_SendEvent(uint16 EventID, uint16 EventType, const char *Spec, ...)
+{
+    va_list ArgPtr;
+
+    DS_BenchData.EventCount++;
+
+    if (DS_BenchData.ShowEvents)
+    {
+        fprintf(stderr, "DS event %u, type %u: ", (unsigned int)EventID, (unsigned int)EventType);
+        va_start(ArgPtr, Spec);
+        vfprintf(stderr, Spec, ArgPtr);
+        va_end(ArgPtr);
+        fputc('\n', stderr);
+    }
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* File services stand-ins                                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void CFE_FS_InitHeader(CFE_FS_Header_t *Hdr, const char *Description, uint32 SubType)
+{
+    memset(Hdr, 0, sizeof(CFE_FS_Header_t));
+
+    Hdr->ContentType = CFE_FS_FILE_CONTENT_ID;
+    Hdr->SubType     = SubType;
+    strncpy(Hdr->Description, Description, sizeof(Hdr->Description) - 1);
+}
+
+CFE_Status_t CFE_FS_WriteHeader(osal_id_t FileDes, CFE_FS_Header_t *Hdr)
+{
+    /*
+    ** Header byte order is not converted - only the write matters here...
+    */
+    return OS_write(FileDes, Hdr, sizeof(CFE_FS_Header_t));
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Message services stand-ins (CCSDS version 1 headers)            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+CFE_Status_t CFE_MSG_Init(CFE_MSG_Message_t *MsgPtr, CFE_SB_MsgId_t MsgId, CFE_MSG_Size_t Size)
+{
+    uint32 MsgIdValue = CFE_SB_MsgIdToValue(MsgId);
+
+    memset(MsgPtr, 0, Size);
+
+    /*
+    ** Telemetry message IDs get a secondary header, as with the cFE defaults...
+    */
+    MsgPtr->Byte[0] = (uint8)((MsgIdValue >> 8) & 0x1F) | 0x08;
+    MsgPtr->Byte[1] = (uint8)(MsgIdValue & 0xFF);
+    MsgPtr->Byte[2] = 0xC0;
+
+    return CFE_MSG_SetSize(MsgPtr, Size);
+}
+
+CFE_Status_t CFE_MSG_GetMsgId(const CFE_MSG_Message_t *MsgPtr, CFE_SB_MsgId_t *MsgId)
+{
+    *MsgId = CFE_SB_ValueToMsgId(((MsgPtr->Byte[0] << 8) | MsgPtr->Byte[1]) & 0x1FFF);
+
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_MSG_GetSize(const CFE_MSG_Message_t *MsgPtr, CFE_MSG_Size_t *Size)
+{
+    *Size = (CFE_MSG_Size_t)((MsgPtr->Byte[4] << 8) | MsgPtr->Byte[5]) + 7;
+
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_MSG_SetSize(CFE_MSG_Message_t *MsgPtr, CFE_MSG_Size_t Size)
+{
+    if ((Size < 7) || (Size > 0x10006))
+    {
+        return CFE_MSG_BAD_ARGUMENT;
+    }
+
+    MsgPtr->Byte[4] = (uint8)(((Size - 7) >> 8) & 0xFF);
+    MsgPtr->Byte[5] = (uint8)((Size - 7) & 0xFF);
+
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_MSG_GetType(const CFE_MSG_Message_t *MsgPtr, CFE_MSG_Type_t *Type)
+{
+    *Type = ((MsgPtr->Byte[0] & 0x10) != 0) ? CFE_MSG_Type_Cmd : CFE_MSG_Type_Tlm;
+
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_MSG_GetHasSecondaryHeader(const CFE_MSG_Message_t *MsgPtr, bool *HasSecondary)
+{
+    *HasSecondary = ((MsgPtr->Byte[0] & 0x08) != 0);
+
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_MSG_GetSequenceCount(const CFE_MSG_Message_t *MsgPtr, CFE_MSG_SequenceCount_t *SeqCnt)
+{
+    *SeqCnt = (CFE_MSG_SequenceCount_t)(((MsgPtr->Byte[2] & 0x3F) << 8) | MsgPtr->Byte[3]);
+
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_MSG_SetSequenceCount(CFE_MSG_Message_t *MsgPtr, CFE_MSG_SequenceCount_t SeqCnt)
+{
+    MsgPtr->Byte[2] = (uint8)((MsgPtr->Byte[2] & 0xC0) | ((SeqCnt >> 8) & 0x3F));
+    MsgPtr->Byte[3] = (uint8)(SeqCnt & 0xFF);
+
+    return CFE_SUCCESS;
+}
+
+CFE_MSG_SequenceCount_t CFE_MSG_GetNextSequenceCount(CFE_MSG_SequenceCount_t SeqCnt)
+{
+    return (CFE_MSG_SequenceCount_t)((SeqCnt + 1) & 0x3FFF);
+}
+
+CFE_Status_t CFE_MSG_SetSegmentationFlag(CFE_MSG_Message_t *MsgPtr, CFE_MSG_SegmentationFlag_t SegFlag)
+{
+    uint8 FlagBits;
+
+    if (SegFlag == CFE_MSG_SegFlag_Continue)
+    {
+        FlagBits = 0x00;
+    }
+    else if (SegFlag == CFE_MSG_SegFlag_First)
+    {
+        FlagBits = 0x40;
+    }
+    else if (SegFlag == CFE_MSG_SegFlag_Last)
+    {
+        FlagBits = 0x80;
+    }
+    else
+    {
+        FlagBits = 0xC0;
+    }
+
+    MsgPtr->Byte[2] = (uint8)((MsgPtr->Byte[2] & 0x3F) | FlagBits);
+
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_MSG_GetFcnCode(const CFE_MSG_Message_t *MsgPtr, CFE_MSG_FcnCode_t *FcnCode)
+{
+    const uint8 *Bytes = (const uint8 *)MsgPtr;
+
+    *FcnCode = (CFE_MSG_FcnCode_t)(Bytes[6] & 0x7F);
+
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_MSG_GetMsgTime(const CFE_MSG_Message_t *MsgPtr, CFE_TIME_SysTime_t *Time)
+{
+    const uint8 *TimePtr = (const uint8 *)MsgPtr + 6;
+
+    if ((MsgPtr->Byte[0] & 0x18) != 0x08)
+    {
+        memset(Time, 0, sizeof(CFE_TIME_SysTime_t));
+        return CFE_MSG_WRONG_MSG_TYPE;
+    }
+
+    Time->Seconds    = ((uint32)TimePtr[0] << 24) | ((uint32)TimePtr[1] << 16) | ((uint32)TimePtr[2] << 8) | TimePtr[3];
+    Time->Subseconds = ((uint32)TimePtr[4] << 24) | ((uint32)TimePtr[5] << 16);
+
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_MSG_SetMsgTime(CFE_MSG_Message_t *MsgPtr, CFE_TIME_SysTime_t NewTime)
+{
+    uint8 *TimePtr = (uint8 *)MsgPtr + 6;
+
+    if ((MsgPtr->Byte[0] & 0x18) != 0x08)
+    {
+        return CFE_MSG_WRONG_MSG_TYPE;
+    }
+
+    TimePtr[0] = (uint8)(NewTime.Seconds >> 24);
+    TimePtr[1] = (uint8)(NewTime.Seconds >> 16);
+    TimePtr[2] = (uint8)(NewTime.Seconds >> 8);
+    TimePtr[3] = (uint8)NewTime.Seconds;
+    TimePtr[4] = (uint8)(NewTime.Subseconds >> 24);
+    TimePtr[5] = (uint8)(NewTime.Subseconds >> 16);
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Software bus stand-ins                                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+CFE_Status_t CFE_SB_CreatePipe(CFE_SB_PipeId_t *PipeIdPtr, uint16 Depth, const char *PipeName)
+{
+    (void)PipeIdPtr;
+    (void)Depth;
+    (void)PipeName;
+
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_SB_Subscribe(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId)
+{
+    (void)MsgId;
+    (void)PipeId;
+
+    DS_BenchData.Subscribed++;
+
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_SB_SubscribeEx(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, CFE_SB_Qos_t Quality, uint16 MsgLim)
+{
+    (void)Quality;
+    (void)MsgLim;
+
+    return CFE_SB_Subscribe(MsgId, PipeId);
+}
+
+CFE_Status_t CFE_SB_Unsubscribe(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId)
+{
+    (void)MsgId;
+    (void)PipeId;
+
+    DS_BenchData.Subscribed--;
+
+    return CFE_SUCCESS;
+}
+
+bool CFE_SB_IsValidMsgId(CFE_SB_MsgId_t MsgId)
+{
+    return ((CFE_SB_MsgIdToValue(MsgId) != 0) && (CFE_SB_MsgIdToValue(MsgId) <= CFE_PLATFORM_SB_HIGHEST_VALID_MSGID));
+}
+
+CFE_Status_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t PipeId, int32 TimeOut)
+{
+    (void)PipeId;
+    (void)TimeOut;
+
+    /*
+    ** Packets are handed to DS directly, never through the command pipe...
+    */
+    *BufPtr = NULL;
+
+    return CFE_SB_NO_MESSAGE;
+}
+
+CFE_SB_Buffer_t *CFE_SB_AllocateMessageBuffer(size_t MsgSize)
+{
+    return (MsgSize <= sizeof(DS_BenchSendBuffer)) ? &DS_BenchSendBuffer.Buffer : NULL;
+}
+
+CFE_Status_t CFE_SB_TransmitBuffer(CFE_SB_Buffer_t *BufPtr, bool IsOrigination)
+{
+    (void)BufPtr;
+    (void)IsOrigination;
+
+    DS_BenchData.Transmitted++;
+
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_SB_TransmitMsg(const CFE_MSG_Message_t *MsgPtr, bool IsOrigination)
+{
+    (void)MsgPtr;
+    (void)IsOrigination;
+
+    DS_BenchData.Transmitted++;
+
+    return CFE_SUCCESS;
+}
+
+void CFE_SB_TimeStampMsg(CFE_MSG_Message_t *MsgPtr)
+{
+    CFE_MSG_SetMsgTime(MsgPtr, CFE_TIME_GetTime());
+}
+
+int32 CFE_SB_MessageStringGet(char *DestStringPtr, const char *SourceStringPtr, const char *DefaultString,
+                              size_t DestMaxSize, size_t SourceMaxSize)
+{
+    size_t Length = 0;
+
+    if (DestMaxSize == 0)
+    {
+        return CFE_SB_BAD_ARGUMENT;
+    }
+
+    if ((SourceMaxSize == 0) || (SourceStringPtr == NULL) || (*SourceStringPtr == 0))
+    {
+        SourceStringPtr = DefaultString;
+        SourceMaxSize   = DestMaxSize;
+    }
+
+    if (SourceStringPtr != NULL)
+    {
+        while ((Length < (DestMaxSize - 1)) && (Length < SourceMaxSize) && (SourceStringPtr[Length] != 0))
+        {
+            DestStringPtr[Length] = SourceStringPtr[Length];
+            Length++;
+        }
+    }
+
+    DestStringPtr[Length] = 0;
+
+    return (int32)Length;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Table services stand-ins                                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static DS_BenchTable_t *DS_BenchGetTable(CFE_TBL_Handle_t TblHandle)
+{
+    return ((TblHandle >= 0) && (TblHandle < DS_BENCH_TABLE_CNT)) ? &DS_BenchTables[TblHandle] : NULL;
+}
+
+CFE_Status_t CFE_TBL_Register(CFE_TBL_Handle_t *TblHandlePtr, const char *Name, size_t Size, uint16 TblOptionFlags,
+                              CFE_TBL_CallbackFuncPtr_t TblValidationFuncPtr)
+{
+    DS_BenchTable_t *Table = DS_BenchFindTable(Name);
+
+    (void)TblOptionFlags;
+
+    if (Table == NULL)
+    {
+        Table = DS_BenchFindTable("");
+    }
+
+    if (Table == NULL)
+    {
+        return CFE_TBL_ERR_INVALID_NAME;
+    }
+
+    strncpy(Table->Name, Name, sizeof(Table->Name) - 1);
+    Table->Size              = Size;
+    Table->Buffer            = calloc(1, Size);
+    Table->ValidationFuncPtr = TblValidationFuncPtr;
+
+    *TblHandlePtr = (CFE_TBL_Handle_t)(Table - DS_BenchTables);
+
+    return (Table->Buffer != NULL) ? CFE_SUCCESS : CFE_TBL_ERR_INVALID_HANDLE;
+}
+
+CFE_Status_t CFE_TBL_Load(CFE_TBL_Handle_t TblHandle, CFE_TBL_SrcEnum_t SrcType, const void *SrcDataPtr)
+{
+    DS_BenchTable_t *Table = DS_BenchGetTable(TblHandle);
+    const void *     Image;
+
+    if (Table == NULL)
+    {
+        return CFE_TBL_ERR_INVALID_HANDLE;
+    }
+
+    /*
+    ** There are no table files - a file load copies the benchmark image...
+    */
+    Image = (SrcType == CFE_TBL_SRC_FILE) ? Table->Image : SrcDataPtr;
+
+    if (Image == NULL)
+    {
+        return CFE_TBL_ERR_NO_ACCESS;
+    }
+
+    if ((Table->ValidationFuncPtr != NULL) && (Table->ValidationFuncPtr((void *)Image) != CFE_SUCCESS))
+    {
+        return CFE_TBL_ERR_NO_ACCESS;
+    }
+
+    memcpy(Table->Buffer, Image, Table->Size);
+
+    if (SrcType == CFE_TBL_SRC_FILE)
+    {
+        snprintf(Table->LastFileLoaded, sizeof(Table->LastFileLoaded), "%s", (const char *)SrcDataPtr);
+    }
+
+    Table->Loaded  = true;
+    Table->Updated = true;
+
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_TBL_GetAddress(void **TblPtr, CFE_TBL_Handle_t TblHandle)
+{
+    DS_BenchTable_t *Table = DS_BenchGetTable(TblHandle);
+
+    if (Table == NULL)
+    {
+        return CFE_TBL_ERR_INVALID_HANDLE;
+    }
+
+    if (Table->Loaded == false)
+    {
+        *TblPtr = NULL;
+        return CFE_TBL_ERR_NEVER_LOADED;
+    }
+
+    *TblPtr = Table->Buffer;
+
+    if (Table->Updated)
+    {
+        Table->Updated = false;
+        return CFE_TBL_INFO_UPDATED;
+    }
+
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_TBL_GetInfo(CFE_TBL_Info_t *TblInfoPtr, const char *TblName)
+{
+    const char *     NamePtr = strrchr(TblName, '.');
+    DS_BenchTable_t *Table   = DS_BenchFindTable((NamePtr != NULL) ? (NamePtr + 1) : TblName);
+
+    if ((Table == NULL) || (Table->Buffer == NULL))
+    {
+        return CFE_TBL_ERR_INVALID_NAME;
+    }
+
+    memset(TblInfoPtr, 0, sizeof(CFE_TBL_Info_t));
+
+    TblInfoPtr->Size            = Table->Size;
+    TblInfoPtr->TableLoadedOnce = Table->Loaded;
+    snprintf(TblInfoPtr->LastFileLoaded, sizeof(TblInfoPtr->LastFileLoaded), "%s", Table->LastFileLoaded);
+
+    return CFE_SUCCESS;
+}
+
+/*
+** Table contents never change after the initial load...
+*/
+CFE_Status_t CFE_TBL_ReleaseAddress(CFE_TBL_Handle_t TblHandle)
+{
+    (void)TblHandle;
+
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_TBL_Manage(CFE_TBL_Handle_t TblHandle)
+{
+    (void)TblHandle;
+
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_TBL_GetStatus(CFE_TBL_Handle_t TblHandle)
+{
+    (void)TblHandle;
+
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_TBL_DumpToBuffer(CFE_TBL_Handle_t TblHandle)
+{
+    (void)TblHandle;
+
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_TBL_Validate(CFE_TBL_Handle_t TblHandle)
+{
+    (void)TblHandle;
+
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_TBL_Update(CFE_TBL_Handle_t TblHandle)
+{
+    (void)TblHandle;
+
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_TBL_Modified(CFE_TBL_Handle_t TblHandle)
+{
+    (void)TblHandle;
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Time services stand-ins                                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+CFE_TIME_SysTime_t CFE_TIME_GetTime(void)
+{
+    /*
+    ** Simulated time advances with the synthetic packet stream...
+    */
+    return DS_BenchData.SimTime;
+}
+
+CFE_TIME_SysTime_t CFE_TIME_GetMET(void)
+{
+    CFE_TIME_SysTime_t Met;
+    struct timespec    Now;
+
+    /*
+    ** MET is host monotonic time so flight recorder windows are real...
+    */
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+
+    Met.Seconds    = (uint32)Now.tv_sec;
+    Met.Subseconds = (uint32)(((uint64)Now.tv_nsec << 32) / 1000000000);
+
+    return Met;
+}
+
+uint32 CFE_TIME_Sub2MicroSecs(uint32 SubSeconds)
+{
+    return (uint32)(((uint64)SubSeconds * 1000000) >> 32);
+}
+
+CFE_TIME_SysTime_t CFE_TIME_Subtract(CFE_TIME_SysTime_t Time1, CFE_TIME_SysTime_t Time2)
+{
+    CFE_TIME_SysTime_t Result;
+
+    Result.Subseconds = Time1.Subseconds - Time2.Subseconds;
+    Result.Seconds    = Time1.Seconds - Time2.Seconds;
+
+    if (Result.Subseconds > Time1.Subseconds)
+    {
+        Result.Seconds--;
+    }
+
+    return Result;
+}
+
+CFE_TIME_Compare_t CFE_TIME_Compare(CFE_TIME_SysTime_t TimeA, CFE_TIME_SysTime_t TimeB)
+{
+    if (TimeA.Seconds != TimeB.Seconds)
+    {
+        return (TimeA.Seconds > TimeB.Seconds) ? CFE_TIME_A_GT_B : CFE_TIME_A_LT_B;
+    }
+
+    if (TimeA.Subseconds != TimeB.Subseconds)
+    {
+        return (TimeA.Subseconds > TimeB.Subseconds) ? CFE_TIME_A_GT_B : CFE_TIME_A_LT_B;
+    }
+
+    return CFE_TIME_EQUAL;
+}
+
+void CFE_TIME_Print(char *PrintBuffer, CFE_TIME_SysTime_t TimeToPrint)
+{
+    snprintf(PrintBuffer, CFE_TIME_PRINTED_STRING_SIZE, "%010lu.%06lu", (unsigned long)TimeToPrint.Seconds,
+             (unsigned long)CFE_TIME_Sub2MicroSecs(TimeToPrint.Subseconds));
+}
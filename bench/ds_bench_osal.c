@@ -0,0 +1,278 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   POSIX-backed OSAL stand-ins for the DS storage path benchmark
+ *
+ * @note
+ *   Each stand-in makes exactly one system call so that the call
+ *   counters in DS_BenchData match what a POSIX OSAL would issue.
+ *   Object IDs are the POSIX file descriptor plus one, which keeps
+ *   descriptor zero distinct from OS_OBJECT_ID_UNDEFINED.
+ */
+
+/* POSIX.1-2008 for nanosleep, also when built with -std=c99 */
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "ds_bench.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Object ID to file descriptor conversion                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static int DS_BenchFileDes(osal_id_t FileId)
+{
+    return (int)OS_ObjectIdToInteger(FileId) - 1;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* File stand-ins                                                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 OS_OpenCreate(osal_id_t *filedes, const char *path, int32 flags, int32 access_mode)
+{
+    int OpenFlags;
+    int FileDes;
+
+    if (access_mode == OS_READ_ONLY)
+    {
+        OpenFlags = O_RDONLY;
+    }
+    else if (access_mode == OS_WRITE_ONLY)
+    {
+        OpenFlags = O_WRONLY;
+    }
+    else
+    {
+        OpenFlags = O_RDWR;
+    }
+
+    if ((flags & OS_FILE_FLAG_CREATE) != 0)
+    {
+        OpenFlags |= O_CREAT;
+    }
+
+    if ((flags & OS_FILE_FLAG_TRUNCATE) != 0)
+    {
+        OpenFlags |= O_TRUNC;
+    }
+
+    DS_BenchData.Syscalls.Open++;
+    FileDes = open(path, OpenFlags, 0644);
+
+    if (FileDes < 0)
+    {
+        *filedes = OS_OBJECT_ID_UNDEFINED;
+        return OS_ERROR;
+    }
+
+    *filedes = OS_ObjectIdFromInteger((unsigned long)FileDes + 1);
+
+    return OS_SUCCESS;
+}
+
+int32 OS_close(osal_id_t filedes)
+{
+    DS_BenchData.Syscalls.Close++;
+
+    return (close(DS_BenchFileDes(filedes)) == 0) ? OS_SUCCESS : OS_ERROR;
+}
+
+int32 OS_write(osal_id_t filedes, const void *buffer, size_t nbytes)
+{
+    ssize_t Result;
+
+    DS_BenchData.Syscalls.Write++;
+    Result = write(DS_BenchFileDes(filedes), buffer, nbytes);
+
+    if (Result < 0)
+    {
+        return OS_ERROR;
+    }
+
+    DS_BenchData.Syscalls.BytesWritten += (uint64)Result;
+
+    return (int32)Result;
+}
+
+int32 OS_read(osal_id_t filedes, void *buffer, size_t nbytes)
+{
+    ssize_t Result;
+
+    DS_BenchData.Syscalls.Read++;
+    Result = read(DS_BenchFileDes(filedes), buffer, nbytes);
+
+    return (Result < 0) ? OS_ERROR : (int32)Result;
+}
+
+int32 OS_lseek(osal_id_t filedes, int32 offset, uint32 whence)
+{
+    off_t Result;
+    int   Where;
+
+    if (whence == OS_SEEK_CUR)
+    {
+        Where = SEEK_CUR;
+    }
+    else if (whence == OS_SEEK_END)
+    {
+        Where = SEEK_END;
+    }
+    else
+    {
+        Where = SEEK_SET;
+    }
+
+    DS_BenchData.Syscalls.Seek++;
+    Result = lseek(DS_BenchFileDes(filedes), (off_t)offset, Where);
+
+    return (Result < 0) ? OS_ERROR : (int32)Result;
+}
+
+int32 OS_mv(const char *src, const char *dest)
+{
+    DS_BenchData.Syscalls.Rename++;
+
+    return (rename(src, dest) == 0) ? OS_SUCCESS : OS_ERROR;
+}
+
+int32 OS_remove(const char *path)
+{
+    DS_BenchData.Syscalls.Remove++;
+
+    return (unlink(path) == 0) ? OS_SUCCESS : OS_ERROR;
+}
+
+int32 OS_stat(const char *path, os_fstat_t *filestats)
+{
+    struct stat StatBuf;
+
+    DS_BenchData.Syscalls.Stat++;
+
+    if (stat(path, &StatBuf) != 0)
+    {
+        return OS_ERROR;
+    }
+
+    memset(filestats, 0, sizeof(*filestats));
+    filestats->FileSize = StatBuf.st_size;
+
+    if (S_ISDIR(StatBuf.st_mode))
+    {
+        filestats->FileModeBits = OS_FILESTAT_MODE_DIR;
+    }
+
+    return OS_SUCCESS;
+}
+
+int32 OS_mkdir(const char *path, uint32 access)
+{
+    DS_BenchData.Syscalls.Mkdir++;
+
+    /* OSAL reports an existing directory as success */
+    return (mkdir(path, 0755) == 0 || errno == EEXIST) ? OS_SUCCESS : OS_ERROR;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Task and semaphore stand-ins                                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 OS_TaskDelay(uint32 millisecond)
+{
+    struct timespec Delay;
+
+    Delay.tv_sec  = millisecond / 1000;
+    Delay.tv_nsec = (long)(millisecond % 1000) * 1000000L;
+
+    while ((nanosleep(&Delay, &Delay) != 0) && (errno == EINTR))
+    {
+    }
+
+    return OS_SUCCESS;
+}
+
+/*
+** Child tasks are never started by the benchmark, so the
+**   semaphores they would wait on need no state...
+*/
+int32 OS_CountSemCreate(osal_id_t *sem_id, const char *sem_name, uint32 sem_initial_value, uint32 options)
+{
+    (void)sem_name;
+    (void)sem_initial_value;
+    (void)options;
+
+    *sem_id = OS_ObjectIdFromInteger(1);
+
+    return OS_SUCCESS;
+}
+
+int32 OS_CountSemGive(osal_id_t sem_id)
+{
+    (void)sem_id;
+
+    return OS_SUCCESS;
+}
+
+int32 OS_CountSemTake(osal_id_t sem_id)
+{
+    (void)sem_id;
+
+    return OS_SUCCESS;
+}
+
+/*
+** The benchmark runs in one thread, a mutex only costs the call...
+*/
+int32 OS_MutSemCreate(osal_id_t *sem_id, const char *sem_name, uint32 options)
+{
+    (void)sem_name;
+    (void)options;
+
+    *sem_id = OS_ObjectIdFromInteger(1);
+
+    return OS_SUCCESS;
+}
+
+int32 OS_MutSemGive(osal_id_t sem_id)
+{
+    (void)sem_id;
+
+    return OS_SUCCESS;
+}
+
+int32 OS_MutSemTake(osal_id_t sem_id)
+{
+    (void)sem_id;
+
+    return OS_SUCCESS;
+}
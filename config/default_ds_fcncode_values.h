@@ -46,6 +46,20 @@ enum DS_FunctionCode
     DS_FunctionCode_ADD_MID          = 16,
     DS_FunctionCode_REMOVE_MID       = 17,
     DS_FunctionCode_CLOSE_ALL        = 18,
+    DS_FunctionCode_EXTRACT_FILE     = 19,
+    DS_FunctionCode_REPLAY_START     = 20,
+    DS_FunctionCode_REPLAY_STOP      = 21,
+    DS_FunctionCode_REPLAY_PAUSE     = 22,
+    DS_FunctionCode_REPLAY_RESUME    = 23,
+    DS_FunctionCode_REPLAY_SEEK      = 24,
+    DS_FunctionCode_SET_FILTER_RATE  = 25,
+    DS_FunctionCode_SET_DEST_RATE    = 26,
+    DS_FunctionCode_GET_DEST_STATS   = 27,
+    DS_FunctionCode_SET_RECORDER     = 28,
+    DS_FunctionCode_TRIGGER_RECORDER = 29,
+    DS_FunctionCode_SEND_CACHE       = 30,
+    DS_FunctionCode_WRITE_CACHE      = 31,
+    DS_FunctionCode_GET_MANIFEST     = 32,
 };
 
 #endif
@@ -208,6 +208,127 @@ typedef struct
     CFE_SB_MsgId_t MessageID; /**< \brief Message ID to add to Packet Filter Table */
 } DS_AddRemoveMid_Payload_t;
 
+/**
+ *  \brief Extract Packets From Data Storage File Payload
+ *
+ *  Used with #DS_ExtractFileCmd_t
+ */
+typedef struct
+{
+    char   SourceName[DS_TOTAL_FNAME_BUFSIZE]; /**< \brief Data storage file to extract packets from */
+    char   TargetName[DS_TOTAL_FNAME_BUFSIZE]; /**< \brief File to create with the extracted packets */
+    uint32 StartSeconds;                       /**< \brief Packet time window start (seconds, inclusive) */
+    uint32 StopSeconds;                        /**< \brief Packet time window stop (seconds, inclusive) */
+
+    CFE_SB_MsgId_t MessageID[DS_EXTRACT_MID_CNT]; /**< \brief Message IDs to extract
+                                                       \details Unused entries are zero, all unused = any MID */
+} DS_ExtractFile_Payload_t;
+
+/**
+ *  \brief Start Packet Replay Payload
+ *
+ *  Used with #DS_ReplayStartCmd_t
+ */
+typedef struct
+{
+    char   Filename[DS_TOTAL_FNAME_BUFSIZE]; /**< \brief Data storage file to replay */
+    uint16 RateMultiplier;                   /**< \brief Replay speed (1 = original packet timing) */
+    uint16 Spare;                            /**< \brief Structure alignment padding */
+} DS_ReplayStart_Payload_t;
+
+/**
+ *  \brief Seek Packet Replay Payload
+ *
+ *  Used with #DS_ReplaySeekCmd_t
+ */
+typedef struct
+{
+    uint32 Seconds; /**< \brief Replay resumes at first packet with this time (seconds) or later */
+} DS_ReplaySeek_Payload_t;
+
+/**
+ *  \brief Set Filter Rate Limit Payload
+ *
+ *  Used with #DS_SetFilterRateCmd_t
+ */
+typedef struct
+{
+    CFE_SB_MsgId_t MessageID; /**< \brief Message ID of existing entry in Packet Filter Table
+                                   \details DS defines Message ID zero to be unused */
+    uint16 RatePackets;       /**< \brief Max packets per second (0 = no limit) */
+    uint16 Padding;           /**< \brief Structure Padding on 32-bit boundaries */
+    uint32 RateBytes;         /**< \brief Max packet bytes per second (0 = no limit) */
+} DS_FilterRate_Payload_t;
+
+/**
+ *  \brief Set Destination Rate Limit Payload
+ *
+ *  Used with #DS_SetDestRateCmd_t
+ */
+typedef struct
+{
+    uint16 FileTableIndex; /**< \brief Index into Destination File Table */
+    uint16 RatePackets;    /**< \brief Max packets per second (0 = no limit) */
+    uint32 RateBytes;      /**< \brief Max packet bytes per second (0 = no limit) */
+} DS_DestRate_Payload_t;
+
+/**
+ *  \brief Set Flight Recorder Payload
+ *
+ *  Used with #DS_SetRecorderCmd_t
+ */
+typedef struct
+{
+    uint16         RecorderIndex;      /**< \brief Flight recorder index */
+    uint16         RecorderState;      /**< \brief Flight recorder enable/disable state */
+    uint16         FileTableIndex;     /**< \brief Index into Destination File Table (dump destination) */
+    uint16         PostTriggerSeconds; /**< \brief Seconds of packets to keep dumping after a trigger */
+    CFE_SB_MsgId_t TriggerMsgID;       /**< \brief Arrival of this Message ID triggers a dump
+                                            \details DS defines Message ID zero to be unused */
+} DS_SetRecorder_Payload_t;
+
+/**
+ *  \brief Trigger Flight Recorder Payload
+ *
+ *  Used with #DS_TriggerRecorderCmd_t
+ */
+typedef struct
+{
+    uint16 RecorderIndex; /**< \brief Flight recorder index */
+    uint16 Padding;       /**< \brief Structure Padding on 32-bit boundaries */
+} DS_TriggerRecorder_Payload_t;
+
+/**
+ *  \brief Send Latest-Value Cache Packet Payload
+ *
+ *  Used with #DS_SendCacheCmd_t
+ */
+typedef struct
+{
+    CFE_SB_MsgId_t MessageID; /**< \brief Message ID of the cached packet to send */
+} DS_SendCache_Payload_t;
+
+/**
+ *  \brief Write Latest-Value Cache Snapshot File Payload
+ *
+ *  Used with #DS_WriteCacheCmd_t
+ */
+typedef struct
+{
+    char Filename[DS_TOTAL_FNAME_BUFSIZE]; /**< \brief Snapshot file to create */
+} DS_WriteCache_Payload_t;
+
+/**
+ *  \brief Get Closed File Manifest Payload
+ *
+ *  Used with #DS_GetManifestCmd_t
+ */
+typedef struct
+{
+    uint16 FileTableIndex; /**< \brief Index into Destination File Table */
+    uint16 Padding;        /**< \brief Structure Padding on 32-bit boundaries */
+} DS_GetManifest_Payload_t;
+
 /**\}*/
 
 /**
@@ -224,7 +345,7 @@ typedef struct
     uint8  FilterTblLoadCounter; /**< \brief Count of packet filter table loads */
     uint8  FilterTblErrCounter;  /**< \brief Count of failed attempts to get table data pointer */
     uint8  AppEnableState;       /**< \brief Application enable/disable state */
-    uint8  Spare8;               /**< \brief Structure alignment padding */
+    uint8  DecimationLevel;      /**< \brief Backpressure decimation level (0 = nominal) */
     uint16 FileWriteCounter;     /**< \brief Count of good destination file writes */
     uint16 FileWriteErrCounter;  /**< \brief Count of bad destination file writes */
     uint16 FileUpdateCounter;    /**< \brief Count of good updates to secondary header */
@@ -239,6 +360,31 @@ typedef struct
                                   */
     uint32 FilteredPktCounter;   /**< \brief Count of packets discarded (failed filter test) */
     uint32 PassedPktCounter;     /**< \brief Count of packets that passed filter test */
+    uint32 RateDropPktCounter;   /**< \brief Count of packets discarded (over rate limit)
+                                  *
+                                  * Counted once for a packet over its Message ID rate limit, and
+                                  * once per destination file for a packet over that file's rate limit
+                                  */
+    uint32 EvictedFileCounter;   /**< \brief Count of closed files deleted to stay within storage budget */
+    uint32 StorageUsed;          /**< \brief Kilobytes of destination files tracked against storage budget */
+    uint16 ExtractState;         /**< \brief File extraction state (idle or active) */
+    uint16 ExtractErrCounter;    /**< \brief Count of file extractions that failed after being started */
+    uint32 ExtractBytesScanned;  /**< \brief Source file bytes scanned by current (or last) extraction */
+    uint32 ExtractPacketCount;   /**< \brief Packets written by current (or last) extraction */
+    uint16 ReplayState;          /**< \brief Packet replay state (idle, active or paused) */
+    uint16 ReplayErrCounter;     /**< \brief Count of packet replays that failed after being started */
+    uint32 ReplayPacketCount;    /**< \brief Packets sent by current (or last) replay */
+    uint32 ReplayOffset;         /**< \brief File offset of next packet of current (or last) replay */
+    uint32 CompressRawBytes;     /**< \brief Packet bytes written to compressed files (before compression) */
+    uint32 CompressFileBytes;    /**< \brief Block bytes written to compressed files (after compression) */
+    uint16 RecorderTrigCounter;  /**< \brief Count of flight recorder dumps triggered (command or Message ID) */
+    uint16 RecorderDropCounter;  /**< \brief Count of packets lost by flight recorders
+                                  *
+                                  * Packets are lost when a dumping recorder buffer is full, or when
+                                  * the dump destination file is disabled
+                                  */
+    uint16 CacheUsed;            /**< \brief Number of used latest-value cache entries */
+    uint16 CacheOverflowCounter; /**< \brief Count of packets not cached because every cache entry is used */
     char   FilterTblFilename[CFE_MISSION_MAX_PATH_LEN]; /**< \brief Name of filter table file */
 } DS_HkTlm_Payload_t;
 
@@ -251,11 +397,75 @@ typedef struct
     uint32 FileSize;                         /**< \brief Current file size in bytes */
     uint32 FileRate;                         /**< \brief Current file data rate (avg since HK) */
     uint32 SequenceCount;                    /**< \brief Sequence count portion of filename */
+    uint32 LogicalSize;                      /**< \brief Current file size in bytes before compression */
     uint16 EnableState;                      /**< \brief Current file enable/disable state */
     uint16 OpenState;                        /**< \brief Current file open/close state */
     char   FileName[DS_TOTAL_FNAME_BUFSIZE]; /**< \brief Current filename (path+base+seq+ext) */
 } DS_FileInfo_t;
 
+/**
+ * \brief Latency statistics for one stage of the packet storage path
+ *
+ * Times are in microseconds.  Histogram bin 0 counts samples under
+ * one microsecond, bin N counts samples from 2^(N-1) up to 2^N
+ * microseconds, and the last bin also counts every longer sample.
+ */
+typedef struct
+{
+    uint32 Count;                              /**< \brief Count of samples */
+    uint32 MaxTime;                            /**< \brief Longest sample */
+    uint32 TotalTime;                          /**< \brief Sum of all samples (wraps) */
+    uint32 Histogram[DS_STATS_HISTOGRAM_BINS]; /**< \brief Count of samples in each log2 bin */
+} DS_StageStats_t;
+
+/**
+ * \brief Packet storage path latency statistics
+ */
+typedef struct
+{
+    DS_StageStats_t Receive; /**< \brief Pipe receive to start of filtering */
+    DS_StageStats_t Filter;  /**< \brief Filter table evaluation (excluding file writes) */
+    DS_StageStats_t Write;   /**< \brief Write of one packet to one destination file (and any file rotation) */
+    DS_StageStats_t Create;  /**< \brief Destination file create */
+    DS_StageStats_t Close;   /**< \brief Destination file close */
+} DS_StatsTlm_Payload_t;
+
+/**
+ * \brief Input/output statistics for one destination file
+ *
+ * Counts cover packet data written to every file of the destination
+ * since DS started or counters were reset.  File headers, ring file
+ * updates, index files and summary trailers are not included.
+ */
+typedef struct
+{
+    uint64 PacketCount;   /**< \brief Count of packets written */
+    uint64 ByteCount;     /**< \brief Count of bytes written (after encoding and compression) */
+    uint64 WriteCalls;    /**< \brief Count of file write calls */
+    uint32 MaxWriteTime;  /**< \brief Longest time to store one packet in microseconds */
+    uint32 RolloverCount; /**< \brief Count of files closed for size or age limits */
+    uint32 ErrorCount;    /**< \brief Count of file create and write errors */
+    uint32 Spare;         /**< \brief Structure Padding on 64-bit boundaries */
+} DS_DestStats_t;
+
+/**
+ * \brief Closed file manifest of one destination file
+ *
+ * RecordCount is the number of complete records in the manifest when
+ * the packet was sent.  A consumer that has processed N records can read
+ * the records from byte offset N * RecordSize up to RecordCount.
+ */
+typedef struct
+{
+    uint16 FileTableIndex;                       /**< \brief Destination file table index */
+    uint16 Padding;                              /**< \brief Structure Padding on 32-bit boundaries */
+    uint32 RecordCount;                          /**< \brief Complete records in the manifest */
+    uint32 RecordSize;                           /**< \brief Size of each manifest record in bytes */
+    uint32 AppendCount;                          /**< \brief Records appended by DS to any manifest */
+    uint32 AppendErrCount;                       /**< \brief Manifest create and write errors */
+    char   ManifestName[DS_TOTAL_FNAME_BUFSIZE]; /**< \brief Manifest path and filename */
+} DS_ManifestTlm_Payload_t;
+
 /**\}*/
 
 #endif
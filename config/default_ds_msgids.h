@@ -30,8 +30,9 @@
  * \{
  */
 
-#define DS_CMD_MID     CFE_PLATFORM_DS_CMD_MIDVAL(CMD)
-#define DS_SEND_HK_MID CFE_PLATFORM_DS_CMD_MIDVAL(SEND_HK)
+#define DS_CMD_MID           CFE_PLATFORM_DS_CMD_MIDVAL(CMD)
+#define DS_SEND_HK_MID       CFE_PLATFORM_DS_CMD_MIDVAL(SEND_HK)
+#define DS_BACKLOG_PROBE_MID CFE_PLATFORM_DS_CMD_MIDVAL(BACKLOG_PROBE) /**< \brief DS Pipe Backlog Probe Message ID */
 
 /**\}*/
 
@@ -44,6 +45,12 @@
 #define DS_DIAG_TLM_MID CFE_PLATFORM_DS_TLM_MIDVAL(DIAG_TLM) /**< \brief DS File Info Telemetry Message ID ****/
 #define DS_COMP_TLM_MID \
     CFE_PLATFORM_DS_TLM_MIDVAL(COMP_TLM) /**< \brief DS Completed File Info Telemetry Message ID ****/
+#define DS_STATS_TLM_MID \
+    CFE_PLATFORM_DS_TLM_MIDVAL(STATS_TLM) /**< \brief DS Latency Statistics Telemetry Message ID ****/
+#define DS_DEST_STATS_TLM_MID \
+    CFE_PLATFORM_DS_TLM_MIDVAL(DEST_STATS_TLM) /**< \brief DS Destination Statistics Telemetry Message ID ****/
+#define DS_MANIFEST_TLM_MID \
+    CFE_PLATFORM_DS_TLM_MIDVAL(MANIFEST_TLM) /**< \brief DS Closed File Manifest Telemetry Message ID ****/
 
 /**\}*/
 
@@ -41,6 +41,16 @@ typedef struct
     CFE_MSG_CommandHeader_t CommandHeader; /**< \brief cFE Software Bus command message header */
 } DS_SendHkCmd_t;
 
+/**
+ *  \brief Pipe Backlog Probe
+ *
+ *  Sent by DS to its own pipe to measure the pipe backlog, see #DS_DECIMATION_THRESHOLD
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief cFE Software Bus command message header */
+} DS_BacklogProbeCmd_t;
+
 /**
  *  \brief No-Operation Command
  *
@@ -237,6 +247,16 @@ typedef struct
     CFE_MSG_CommandHeader_t CommandHeader; /**< \brief cFE Software Bus command message header */
 } DS_GetFileInfoCmd_t;
 
+/**
+ *  \brief Get Destination Statistics Command
+ *
+ *  For command details see #DS_GET_DEST_STATS_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief cFE Software Bus command message header */
+} DS_GetDestStatsCmd_t;
+
 /**
  *  \brief Add Message ID To Packet Filter Table
  *
@@ -261,6 +281,156 @@ typedef struct
     DS_AddRemoveMid_Payload_t Payload;
 } DS_RemoveMidCmd_t;
 
+/**
+ *  \brief Extract Packets From Data Storage File
+ *
+ *  For command details see #DS_EXTRACT_FILE_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief cFE Software Bus command message header */
+
+    DS_ExtractFile_Payload_t Payload;
+} DS_ExtractFileCmd_t;
+
+/**
+ *  \brief Start Packet Replay Command
+ *
+ *  For command details see #DS_REPLAY_START_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief cFE Software Bus command message header */
+
+    DS_ReplayStart_Payload_t Payload;
+} DS_ReplayStartCmd_t;
+
+/**
+ *  \brief Stop Packet Replay Command
+ *
+ *  For command details see #DS_REPLAY_STOP_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief cFE Software Bus command message header */
+} DS_ReplayStopCmd_t;
+
+/**
+ *  \brief Pause Packet Replay Command
+ *
+ *  For command details see #DS_REPLAY_PAUSE_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief cFE Software Bus command message header */
+} DS_ReplayPauseCmd_t;
+
+/**
+ *  \brief Resume Packet Replay Command
+ *
+ *  For command details see #DS_REPLAY_RESUME_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief cFE Software Bus command message header */
+} DS_ReplayResumeCmd_t;
+
+/**
+ *  \brief Seek Packet Replay Command
+ *
+ *  For command details see #DS_REPLAY_SEEK_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief cFE Software Bus command message header */
+
+    DS_ReplaySeek_Payload_t Payload;
+} DS_ReplaySeekCmd_t;
+
+/**
+ *  \brief Set Rate Limit For Packet Filter Table Entry
+ *
+ *  For command details see #DS_SET_FILTER_RATE_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief cFE Software Bus command message header */
+
+    DS_FilterRate_Payload_t Payload;
+} DS_SetFilterRateCmd_t;
+
+/**
+ *  \brief Set Rate Limit For Destination File Table Entry
+ *
+ *  For command details see #DS_SET_DEST_RATE_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief cFE Software Bus command message header */
+
+    DS_DestRate_Payload_t Payload;
+} DS_SetDestRateCmd_t;
+
+/**
+ *  \brief Set Flight Recorder
+ *
+ *  For command details see #DS_SET_RECORDER_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief cFE Software Bus command message header */
+
+    DS_SetRecorder_Payload_t Payload;
+} DS_SetRecorderCmd_t;
+
+/**
+ *  \brief Trigger Flight Recorder Dump
+ *
+ *  For command details see #DS_TRIGGER_RECORDER_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief cFE Software Bus command message header */
+
+    DS_TriggerRecorder_Payload_t Payload;
+} DS_TriggerRecorderCmd_t;
+
+/**
+ *  \brief Send Latest-Value Cache Packet
+ *
+ *  For command details see #DS_SEND_CACHE_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief cFE Software Bus command message header */
+
+    DS_SendCache_Payload_t Payload;
+} DS_SendCacheCmd_t;
+
+/**
+ *  \brief Write Latest-Value Cache Snapshot File
+ *
+ *  For command details see #DS_WRITE_CACHE_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief cFE Software Bus command message header */
+
+    DS_WriteCache_Payload_t Payload;
+} DS_WriteCacheCmd_t;
+
+/**
+ *  \brief Get Closed File Manifest
+ *
+ *  For command details see #DS_GET_MANIFEST_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief cFE Software Bus command message header */
+
+    DS_GetManifest_Payload_t Payload;
+} DS_GetManifestCmd_t;
+
 /**\}*/
 
 /**
@@ -298,6 +468,36 @@ typedef struct
     DS_FileInfo_t Payload; /**< \brief Current state of destination file */
 } DS_FileCompletePkt_t;
 
+/**
+ * \brief Application latency statistics packet
+ */
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t TelemetryHeader; /**< \brief cFE Software Bus telemetry message header */
+
+    DS_StatsTlm_Payload_t Payload;
+} DS_StatsPacket_t;
+
+/**
+ * \brief Application destination statistics packet
+ */
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t TelemetryHeader; /**< \brief cFE Software Bus telemetry message header */
+
+    DS_DestStats_t Payload[DS_DEST_FILE_CNT]; /**< \brief Input/output statistics of destination files */
+} DS_DestStatsPkt_t;
+
+/**
+ * \brief Application closed file manifest packet
+ */
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t TelemetryHeader; /**< \brief cFE Software Bus telemetry message header */
+
+    DS_ManifestTlm_Payload_t Payload;
+} DS_ManifestPkt_t;
+
 /**\}*/
 
 #endif
@@ -44,8 +44,39 @@
 #define DS_DISABLED 0 /**< \brief Enable/disable state selection */
 #define DS_ENABLED  1 /**< \brief Enable/disable state selection */
 
-#define DS_BY_TIME  2 /**< \brief Action is based on packet timestamp */
-#define DS_BY_COUNT 1 /**< \brief Action is based on packet sequence count */
+#define DS_BY_TIME   2 /**< \brief Action is based on packet timestamp */
+#define DS_BY_COUNT  1 /**< \brief Action is based on packet sequence count */
+#define DS_BY_CHANGE 3 /**< \brief Action is based on packet content changes (filters only) */
+#define DS_BY_WINDOW 4 /**< \brief Action is based on time since last stored packet */
+
+#define DS_FILE_MODE_LINEAR 0 /**< \brief Close full destination files and open a new one */
+#define DS_FILE_MODE_RING   1 /**< \brief Preallocate one destination file and overwrite it circularly */
+
+#define DS_COMPRESS_NONE 0 /**< \brief Write packets to destination files uncompressed */
+#define DS_COMPRESS_LZ   1 /**< \brief Write packets to destination files in LZ compressed blocks */
+
+#define DS_SIZE_LIMIT_PHYSICAL 0 /**< \brief Max file size limits bytes written to the file */
+#define DS_SIZE_LIMIT_LOGICAL  1 /**< \brief Max file size limits bytes stored before compression */
+
+#define DS_RECORD_FULL  0 /**< \brief Write every packet to destination files in full */
+#define DS_RECORD_DELTA 1 /**< \brief Replace repeated packet headers with delta records */
+
+#define DS_SHARD_NONE     0 /**< \brief Create destination files directly in the path directory */
+#define DS_SHARD_BY_TIME  1 /**< \brief Create destination files in YYYY/DDD/HH subdirectories */
+#define DS_SHARD_BY_COUNT 2 /**< \brief Create destination files in sequence count block subdirectories */
+
+#define DS_PRIORITY_HIGH 0 /**< \brief Filter is never decimated under backpressure */
+#define DS_PRIORITY_LOW  1 /**< \brief Filter is decimated under backpressure */
+
+#define DS_PREDICATE_AND 0 /**< \brief Packet must match every predicate term */
+#define DS_PREDICATE_OR  1 /**< \brief Packet must match at least one predicate term */
+
+#define DS_PREDICATE_EQ 1 /**< \brief Masked field is equal to value */
+#define DS_PREDICATE_NE 2 /**< \brief Masked field is not equal to value */
+#define DS_PREDICATE_LT 3 /**< \brief Masked field is less than value */
+#define DS_PREDICATE_LE 4 /**< \brief Masked field is less than or equal to value */
+#define DS_PREDICATE_GT 5 /**< \brief Masked field is greater than value */
+#define DS_PREDICATE_GE 6 /**< \brief Masked field is greater than or equal to value */
 
 /**************************************************************************
  **
@@ -62,14 +93,34 @@ typedef struct
     uint16 Algorithm_N; /**< \brief Algorithm value N (pass this many) */
     uint16 Algorithm_X; /**< \brief Algorithm value X (out of this many) */
     uint16 Algorithm_O; /**< \brief Algorithm value O (at this offset) */
+    uint16 Priority;    /**< \brief Decimation priority under backpressure (high or low) */
+
+    uint16 MaxStoreLength; /**< \brief Store only this many leading packet bytes (0 = whole packet) */
 } DS_FilterParms_t;
 
+/** \brief DS Packet Predicate Term */
+typedef struct
+{
+    uint16 Offset;   /**< \brief Byte offset of field from start of packet */
+    uint8  Width;    /**< \brief Field width in bytes, big endian (1, 2 or 4, 0 = unused term) */
+    uint8  Operator; /**< \brief Comparison of masked field with value (DS_PREDICATE_EQ ...) */
+    uint32 Mask;     /**< \brief Field bits to compare */
+    uint32 Value;    /**< \brief Value compared with masked field */
+} DS_PredicateTerm_t;
+
 /** \brief DS Filter Table Packet Entry */
 typedef struct
 {
     CFE_SB_MsgId_t MessageID; /**< \brief Packet MessageID (may be cmd or tlm) */
 
     DS_FilterParms_t Filter[DS_FILTERS_PER_PACKET]; /**< \brief One entry for each packet destination */
+
+    uint16 RatePackets;    /**< \brief Max packets per second stored for this MessageID (0 = no limit) */
+    uint16 PredicateLogic; /**< \brief Combine predicate terms with AND or OR */
+    uint32 RateBytes;      /**< \brief Max packet bytes per second stored for this MessageID (0 = no limit) */
+    uint32 MessageMask;    /**< \brief MessageID bits that must match (0 = exact entry) */
+
+    DS_PredicateTerm_t Predicate[DS_PREDICATE_TERMS]; /**< \brief Packet content test (no used terms = store all) */
 } DS_PacketEntry_t;
 
 /**
@@ -93,6 +144,28 @@ typedef struct
     uint32 MaxFileAge;  /**< \brief Max file age (seconds) */
 
     uint32 SequenceCount; /**< \brief Sequence count portion of filename */
+
+    uint16 FileMode;        /**< \brief File mode - linear vs ring */
+    uint16 StoragePriority; /**< \brief Storage priority (lower values are evicted first) */
+
+    uint32 MaxStorageSize; /**< \brief Max bytes kept in closed files (0 = no limit) */
+
+    uint16 IndexPackets; /**< \brief Packets between sidecar index records (0 = not by count) */
+    uint16 IndexSeconds; /**< \brief Seconds between sidecar index records (0 = not by time) */
+
+    uint16 TrailerState; /**< \brief Summary trailer enable/disable state */
+    uint16 CompressMode; /**< \brief Compression mode - none vs LZ blocks */
+
+    uint16 SizeLimitMode; /**< \brief Max file size applies to physical vs logical size */
+    uint16 RecordMode;    /**< \brief Record mode - full packets vs header deltas */
+
+    uint16 KeyframeInterval; /**< \brief Records per stream between full packets (delta mode) */
+    uint16 RatePackets;      /**< \brief Max packets per second written to this file (0 = no limit) */
+
+    uint32 RateBytes; /**< \brief Max packet bytes per second written to this file (0 = no limit) */
+
+    uint16 ShardMode;  /**< \brief Subdirectory shards - none vs by time vs by count */
+    uint16 ShardFiles; /**< \brief Sequence counts per subdirectory shard (by count) */
 } DS_DestFileEntry_t;
 
 #endif
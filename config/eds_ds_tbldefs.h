@@ -31,8 +31,39 @@
 #define DS_DISABLED DS_EnableState_DISABLED /**< \brief Enable/disable state selection */
 #define DS_ENABLED  DS_EnableState_ENABLED  /**< \brief Enable/disable state selection */
 
-#define DS_BY_TIME  DS_FilterType_BY_TIME  /**< \brief Action is based on packet timestamp */
-#define DS_BY_COUNT DS_FilterType_BY_COUNT /**< \brief Action is based on packet sequence count */
+#define DS_BY_TIME   DS_FilterType_BY_TIME   /**< \brief Action is based on packet timestamp */
+#define DS_BY_COUNT  DS_FilterType_BY_COUNT  /**< \brief Action is based on packet sequence count */
+#define DS_BY_CHANGE DS_FilterType_BY_CHANGE /**< \brief Action is based on packet content changes (filters only) */
+#define DS_BY_WINDOW DS_FilterType_BY_WINDOW /**< \brief Action is based on time since last stored packet */
+
+#define DS_FILE_MODE_LINEAR 0 /**< \brief Close full destination files and open a new one */
+#define DS_FILE_MODE_RING   1 /**< \brief Preallocate one destination file and overwrite it circularly */
+
+#define DS_COMPRESS_NONE 0 /**< \brief Write packets to destination files uncompressed */
+#define DS_COMPRESS_LZ   1 /**< \brief Write packets to destination files in LZ compressed blocks */
+
+#define DS_SIZE_LIMIT_PHYSICAL 0 /**< \brief Max file size limits bytes written to the file */
+#define DS_SIZE_LIMIT_LOGICAL  1 /**< \brief Max file size limits bytes stored before compression */
+
+#define DS_RECORD_FULL  0 /**< \brief Write every packet to destination files in full */
+#define DS_RECORD_DELTA 1 /**< \brief Replace repeated packet headers with delta records */
+
+#define DS_SHARD_NONE     0 /**< \brief Create destination files directly in the path directory */
+#define DS_SHARD_BY_TIME  1 /**< \brief Create destination files in YYYY/DDD/HH subdirectories */
+#define DS_SHARD_BY_COUNT 2 /**< \brief Create destination files in sequence count block subdirectories */
+
+#define DS_PRIORITY_HIGH 0 /**< \brief Filter is never decimated under backpressure */
+#define DS_PRIORITY_LOW  1 /**< \brief Filter is decimated under backpressure */
+
+#define DS_PREDICATE_AND 0 /**< \brief Packet must match every predicate term */
+#define DS_PREDICATE_OR  1 /**< \brief Packet must match at least one predicate term */
+
+#define DS_PREDICATE_EQ 1 /**< \brief Masked field is equal to value */
+#define DS_PREDICATE_NE 2 /**< \brief Masked field is not equal to value */
+#define DS_PREDICATE_LT 3 /**< \brief Masked field is less than value */
+#define DS_PREDICATE_LE 4 /**< \brief Masked field is less than or equal to value */
+#define DS_PREDICATE_GT 5 /**< \brief Masked field is greater than value */
+#define DS_PREDICATE_GE 6 /**< \brief Masked field is greater than or equal to value */
 
 
 #endif
@@ -895,6 +895,507 @@
  */
 #define DS_MID_ERR_EID 73
 
+/**
+ *  \brief DS Closed File Evicted Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  This event signals that DS deleted the oldest remembered closed file
+ *  of a destination to keep the destination or the global storage
+ *  budget from being exceeded by a new destination file.
+ */
+#define DS_EVICT_FILE_INF_EID 74
+
+/**
+ *  \brief DS Closed File Eviction Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event signals that DS was unable to delete a remembered closed
+ *  file selected for eviction.  The file may have already been removed
+ *  or moved by another application.  The file is forgotten regardless
+ *  and no longer counts against the storage budget.
+ */
+#define DS_EVICT_FILE_ERR_EID 75
+
+/**
+ *  \brief DS Storage Budget Exceeded Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event signals that a new destination file will exceed the global
+ *  storage budget because no remembered closed file of equal or lower
+ *  storage priority is left to evict.  The file is created anyway.
+ */
+#define DS_STORAGE_FULL_ERR_EID 76
+
+/**
+ *  \brief DS Sidecar Index File Error Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event signals an error creating, writing, finalizing or moving
+ *  the optional sidecar index file of a destination file.  The index
+ *  file is closed and no further index records are written for the
+ *  current destination file.  The destination file is not affected.
+ */
+#define DS_INDEX_FILE_ERR_EID 77
+
+/**
+ *  \brief DS Extract File Command Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  This event signals the successful execution of a command to extract
+ *  packets from a data storage file.  The extraction has been handed to
+ *  the file extraction child task and is now in progress.
+ */
+#define DS_EXTRACT_CMD_EID 78
+
+/**
+ *  \brief DS Extract File Command Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event signals the failed execution of a command to extract
+ *  packets from a data storage file.  The cause of the failure may be
+ *  an invalid command packet length, an empty source or target filename,
+ *  the same source and target filename or a time window that stops
+ *  before it starts.
+ *
+ *  The failure may also result from another extraction already being
+ *  in progress at the time the command was invoked, or from the file
+ *  extraction child task no longer running.
+ */
+#define DS_EXTRACT_CMD_ERR_EID 79
+
+/**
+ *  \brief DS Extract File Complete Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  This event signals that the file extraction child task has finished
+ *  an extraction.  The event reports the number of source file bytes
+ *  scanned and the number of packets written to the target file.
+ */
+#define DS_EXTRACT_DONE_EID 80
+
+/**
+ *  \brief DS Extract File Error Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event signals that the file extraction child task was unable to
+ *  complete an extraction.  The cause may be an error opening, reading
+ *  or seeking the source file, an error creating or writing the target
+ *  file, or a packet in the source file that is invalid or too large for
+ *  the extraction buffer.  The target file is closed with the packets
+ *  written before the error.
+ */
+#define DS_EXTRACT_ERR_EID 81
+
+/**
+ *  \brief DS Replay Start Command Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  This event signals the successful execution of a command to start
+ *  replaying the packets in a data storage file onto the Software Bus.
+ */
+#define DS_REPLAY_START_CMD_EID 82
+
+/**
+ *  \brief DS Replay Start Command Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event signals the failed execution of a command to start a
+ *  packet replay.  The cause of the failure may be an invalid command
+ *  packet length, an empty filename or a rate multiplier that is zero
+ *  or greater than #DS_REPLAY_MAX_RATE.
+ *
+ *  The failure may also result from another replay already being in
+ *  progress, or from the packet replay child task no longer running.
+ */
+#define DS_REPLAY_START_CMD_ERR_EID 83
+
+/**
+ *  \brief DS Replay Control Command Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  This event signals the successful execution of a command to stop,
+ *  pause or resume a packet replay.
+ */
+#define DS_REPLAY_CTRL_CMD_EID 84
+
+/**
+ *  \brief DS Replay Control Command Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event signals the failed execution of a command to stop, pause
+ *  or resume a packet replay.  The cause of the failure may be an
+ *  invalid command packet length or a replay state that does not allow
+ *  the command, such as resuming a replay that is not paused.
+ */
+#define DS_REPLAY_CTRL_CMD_ERR_EID 85
+
+/**
+ *  \brief DS Replay Seek Command Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  This event signals the successful execution of a command to move a
+ *  packet replay to a new packet time.
+ */
+#define DS_REPLAY_SEEK_CMD_EID 86
+
+/**
+ *  \brief DS Replay Seek Command Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event signals the failed execution of a command to move a
+ *  packet replay.  The cause of the failure may be an invalid command
+ *  packet length or no replay being active or paused.
+ */
+#define DS_REPLAY_SEEK_CMD_ERR_EID 87
+
+/**
+ *  \brief DS Replay Complete Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  This event signals that the packet replay child task has finished a
+ *  replay, either at the end of the file or because of a stop command.
+ *  The event reports the number of packets sent.
+ */
+#define DS_REPLAY_DONE_EID 88
+
+/**
+ *  \brief DS Replay Error Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event signals that the packet replay child task was unable to
+ *  complete a replay.  The cause may be an error opening, reading or
+ *  seeking the file, or a packet in the file that is invalid or too
+ *  large for the replay buffer.
+ */
+#define DS_REPLAY_ERR_EID 89
+
+/**
+ *  \brief DS Set Filter Rate Limit Command Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  This event signals the successful execution of a command to set the
+ *  packet and byte rate limits of a Message ID in the Packet Filter Table.
+ */
+#define DS_FILTER_RATE_CMD_EID 90
+
+/**
+ *  \brief DS Set Filter Rate Limit Command Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event signals the failed execution of a command to set the rate
+ *  limits of a Message ID in the Packet Filter Table.  The cause of the
+ *  failure may be an invalid command packet length, an invalid Message ID,
+ *  a Message ID that is not in the table or the table not being loaded.
+ */
+#define DS_FILTER_RATE_CMD_ERR_EID 91
+
+/**
+ *  \brief DS Set Destination Rate Limit Command Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  This event signals the successful execution of a command to set the
+ *  packet and byte rate limits of a Destination File Table entry.
+ */
+#define DS_DEST_RATE_CMD_EID 92
+
+/**
+ *  \brief DS Set Destination Rate Limit Command Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event signals the failed execution of a command to set the rate
+ *  limits of a Destination File Table entry.  The cause of the failure
+ *  may be an invalid command packet length, an invalid file table index
+ *  or the table not being loaded.
+ */
+#define DS_DEST_RATE_CMD_ERR_EID 93
+
+/**
+ *  \brief DS Backpressure Decimation Raised Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  This event signals that DS has measured a backlog on its pipe large
+ *  enough to enter a higher decimation level.  Packets that pass
+ *  low priority filters are stored at a reduced rate until the level is
+ *  lowered again.
+ */
+#define DS_DECIMATION_RAISED_EID 94
+
+/**
+ *  \brief DS Backpressure Decimation Lowered Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  This event signals that the backlog on the DS pipe has cleared enough
+ *  for DS to step down one decimation level.  Level 0 restores nominal
+ *  filtering for low priority filters.
+ */
+#define DS_DECIMATION_LOWERED_EID 95
+
+/**
+ *  \brief DS Get Destination Statistics Command Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  This event signals the successful execution of a command to get
+ *  the destination statistics packet.
+ */
+#define DS_GET_DEST_STATS_CMD_EID 96
+
+/**
+ *  \brief DS Get Destination Statistics Command Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event signals the failed execution of a command to get the
+ *  destination statistics packet.  The cause of the failure is an
+ *  invalid command packet length.
+ */
+#define DS_GET_DEST_STATS_CMD_ERR_EID 97
+
+/**
+ *  \brief DS Set Flight Recorder Command Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  This event signals the successful execution of a command to enable
+ *  or disable a flight recorder.  An enabled recorder holds the packets
+ *  for its destination file in memory instead of writing them.
+ */
+#define DS_SET_RECORDER_CMD_EID 98
+
+/**
+ *  \brief DS Set Flight Recorder Command Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event signals the failed execution of a command to enable or
+ *  disable a flight recorder.  The cause of the failure may be an invalid
+ *  command packet length, recorder index, enable/disable state or file
+ *  table index, a destination already held by another recorder, or a
+ *  recorder that is dumping.
+ */
+#define DS_SET_RECORDER_CMD_ERR_EID 99
+
+/**
+ *  \brief DS Trigger Flight Recorder Command Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event signals the failed execution of a command to trigger a
+ *  flight recorder dump.  The cause of the failure may be an invalid
+ *  command packet length, an invalid recorder index, or a recorder that
+ *  is disabled or already dumping.
+ */
+#define DS_TRIGGER_RECORDER_CMD_ERR_EID 100
+
+/**
+ *  \brief DS Flight Recorder Triggered Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  This event signals that a flight recorder dump was started by command
+ *  or by arrival of the recorder trigger Message ID.  The packets held in
+ *  memory, followed by the packets received during the post-trigger
+ *  window, are written to the recorder destination file.
+ */
+#define DS_RECORDER_TRIGGER_EID 101
+
+/**
+ *  \brief DS Flight Recorder Dump Complete Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  This event signals that a flight recorder dump has finished and the
+ *  destination file has been closed.  The recorder resumes holding
+ *  packets in memory.
+ */
+#define DS_RECORDER_DUMP_EID 102
+
+/**
+ *  \brief DS Send Latest-Value Cache Packet Command Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  This event signals the successful execution of a command to send the
+ *  cached last packet of a Message ID on the Software Bus.
+ */
+#define DS_SEND_CACHE_CMD_EID 103
+
+/**
+ *  \brief DS Send Latest-Value Cache Packet Command Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event signals the failed execution of a command to send a cached
+ *  packet.  The cause of the failure may be an invalid command packet
+ *  length or Message ID, or no packet with the Message ID has been
+ *  received since the Message ID was added to the packet filter table.
+ */
+#define DS_SEND_CACHE_CMD_ERR_EID 104
+
+/**
+ *  \brief DS Write Latest-Value Cache Snapshot Command Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  This event signals the successful execution of a command to write
+ *  every cached packet to a snapshot file.
+ */
+#define DS_WRITE_CACHE_CMD_EID 105
+
+/**
+ *  \brief DS Write Latest-Value Cache Snapshot Command Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event signals the failed execution of a command to write a
+ *  snapshot file of the cached packets.  The cause of the failure may be
+ *  an invalid command packet length, an empty filename, or an error
+ *  creating or writing the file.
+ */
+#define DS_WRITE_CACHE_CMD_ERR_EID 106
+
+/**
+ *  \brief DS Get Closed File Manifest Command Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  This event signals the successful execution of a command to get the
+ *  closed file manifest packet for a destination file.
+ */
+#define DS_GET_MANIFEST_CMD_EID 107
+
+/**
+ *  \brief DS Get Closed File Manifest Command Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event signals the failed execution of a command to get the
+ *  closed file manifest packet.  The cause of the failure may be an
+ *  invalid command packet length or file table index, a destination
+ *  file table that is not loaded, or a destination without a manifest.
+ */
+#define DS_GET_MANIFEST_CMD_ERR_EID 108
+
+/**
+ *  \brief DS Closed File Manifest Write Error Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event signals an error appending the record of a closed file to
+ *  the manifest in its move directory.  The closed file itself is not
+ *  affected, but consumers of the manifest will not see it.
+ */
+#define DS_MANIFEST_FILE_ERR_EID 109
+
+/**
+ *  \brief DS Subdirectory Shard Create Error Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event signals an error creating the subdirectory shard of a
+ *  destination file, either under the destination path when the file is
+ *  created or under the move directory when the file is moved.  When the
+ *  file is created the destination is disabled.  When the file is moved
+ *  the file is left in the path directory.
+ */
+#define DS_SHARD_DIR_ERR_EID 110
+
 /**@}*/
 
 #endif
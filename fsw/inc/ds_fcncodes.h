@@ -612,6 +612,509 @@
  */
 #define DS_REMOVE_MID_CC DS_CCVAL(REMOVE_MID)
 
+/**
+ * \brief Extract Packets From Data Storage File
+ *
+ *  \par Description
+ *       This command will start a background extraction of the packets
+ *       in a data storage file that match a set of Message IDs and a
+ *       packet time window.  The matching packets are written to a new
+ *       file that starts with a copy of the source file headers.
+ *
+ *       The extraction runs in a low priority child task and reads the
+ *       source file in #DS_EXTRACT_BUFFER_SIZE chunks.  When the source
+ *       file has a finalized sidecar index, only the part of the file
+ *       covered by the time window is read.  Otherwise the whole file
+ *       is scanned.  A summary trailer at the end of the source file is
+ *       never mistaken for packet data.
+ *
+ *       Extraction progress is reported in housekeeping telemetry.
+ *
+ *  \par Command Structure
+ *       #DS_ExtractFileCmd_t
+ *
+ *  \par Command Verification
+ *       Evidence of success may be found in the following telemetry:
+ *       - #DS_HkTlm_Payload_t.CmdAcceptedCounter will increment
+ *       - The #DS_EXTRACT_CMD_EID informational event message will be sent
+ *       - #DS_HkTlm_Payload_t.ExtractState will show the extraction is active
+ *       - The #DS_EXTRACT_DONE_EID informational event message will be sent
+ *         when the extraction is complete
+ *
+ *  \par Error Conditions
+ *       This command can fail for the following reasons:
+ *       - Invalid command packet length
+ *       - Source or target filename is empty or the same
+ *       - Time window stop is before time window start
+ *       - Another extraction is already active
+ *       - File extraction child task is not running
+ *
+ *       Evidence of failure may be found in the following telemetry:
+ *       - #DS_HkTlm_Payload_t.CmdRejectedCounter will increment
+ *       - The #DS_EXTRACT_CMD_ERR_EID error event message will be sent
+ *
+ *       An accepted extraction may still fail to complete due to file
+ *       I/O errors, which are reported by the #DS_EXTRACT_ERR_EID error
+ *       event message and #DS_HkTlm_Payload_t.ExtractErrCounter.
+ *
+ *  \par Criticality
+ *       None
+ */
+#define DS_EXTRACT_FILE_CC DS_CCVAL(EXTRACT_FILE)
+
+/**
+ * \brief Start Packet Replay
+ *
+ *  \par Description
+ *       This command will start replaying the packets stored in a data
+ *       storage file onto the Software Bus.  The cFE and DS file headers
+ *       are skipped and each packet is sent with its original header,
+ *       so onboard consumers see the same packets that were stored.
+ *
+ *       Packets are paced by the difference between their stored
+ *       packet times divided by the rate multiplier.  A multiplier of
+ *       one replays the packets with their original inter-packet timing.
+ *
+ *       The replay runs in a low priority child task that reads ahead
+ *       of the packets being sent, so replay never delays the storage
+ *       of live packets.  Replayed packets are also received by DS and
+ *       are stored again when their message IDs are in the packet
+ *       filter table.
+ *
+ *  \par Command Structure
+ *       #DS_ReplayStartCmd_t
+ *
+ *  \par Command Verification
+ *       Evidence of success may be found in the following telemetry:
+ *       - #DS_HkTlm_Payload_t.CmdAcceptedCounter will increment
+ *       - The #DS_REPLAY_START_CMD_EID informational event message will be sent
+ *       - #DS_HkTlm_Payload_t.ReplayState will show the replay is active
+ *       - The #DS_REPLAY_DONE_EID informational event message will be sent
+ *         when the replay reaches the end of the file or is stopped
+ *
+ *  \par Error Conditions
+ *       This command can fail for the following reasons:
+ *       - Invalid command packet length
+ *       - Filename is empty
+ *       - Rate multiplier is zero or greater than #DS_REPLAY_MAX_RATE
+ *       - Another replay is already active
+ *       - Packet replay child task is not running
+ *
+ *       Evidence of failure may be found in the following telemetry:
+ *       - #DS_HkTlm_Payload_t.CmdRejectedCounter will increment
+ *       - The #DS_REPLAY_START_CMD_ERR_EID error event message will be sent
+ *
+ *       An accepted replay may still end early due to file I/O errors,
+ *       which are reported by the #DS_REPLAY_ERR_EID error event message
+ *       and #DS_HkTlm_Payload_t.ReplayErrCounter.
+ *
+ *  \par Criticality
+ *       None
+ */
+#define DS_REPLAY_START_CC DS_CCVAL(REPLAY_START)
+
+/**
+ * \brief Stop Packet Replay
+ *
+ *  \par Description
+ *       This command will stop an active or paused packet replay.
+ *
+ *  \par Command Structure
+ *       #DS_ReplayStopCmd_t
+ *
+ *  \par Command Verification
+ *       Evidence of success may be found in the following telemetry:
+ *       - #DS_HkTlm_Payload_t.CmdAcceptedCounter will increment
+ *       - The #DS_REPLAY_CTRL_CMD_EID informational event message will be sent
+ *       - The #DS_REPLAY_DONE_EID informational event message will be sent
+ *         when the replay task has stopped
+ *
+ *  \par Error Conditions
+ *       This command can fail for the following reasons:
+ *       - Invalid command packet length
+ *       - No replay is active or paused
+ *
+ *       Evidence of failure may be found in the following telemetry:
+ *       - #DS_HkTlm_Payload_t.CmdRejectedCounter will increment
+ *       - The #DS_REPLAY_CTRL_CMD_ERR_EID error event message will be sent
+ *
+ *  \par Criticality
+ *       None
+ */
+#define DS_REPLAY_STOP_CC DS_CCVAL(REPLAY_STOP)
+
+/**
+ * \brief Pause Packet Replay
+ *
+ *  \par Description
+ *       This command will pause an active packet replay.  The replay
+ *       keeps its place in the file and can be resumed.
+ *
+ *  \par Command Structure
+ *       #DS_ReplayPauseCmd_t
+ *
+ *  \par Command Verification
+ *       Evidence of success may be found in the following telemetry:
+ *       - #DS_HkTlm_Payload_t.CmdAcceptedCounter will increment
+ *       - The #DS_REPLAY_CTRL_CMD_EID informational event message will be sent
+ *       - #DS_HkTlm_Payload_t.ReplayState will show the replay is paused
+ *
+ *  \par Error Conditions
+ *       This command can fail for the following reasons:
+ *       - Invalid command packet length
+ *       - No replay is active
+ *
+ *       Evidence of failure may be found in the following telemetry:
+ *       - #DS_HkTlm_Payload_t.CmdRejectedCounter will increment
+ *       - The #DS_REPLAY_CTRL_CMD_ERR_EID error event message will be sent
+ *
+ *  \par Criticality
+ *       None
+ */
+#define DS_REPLAY_PAUSE_CC DS_CCVAL(REPLAY_PAUSE)
+
+/**
+ * \brief Resume Packet Replay
+ *
+ *  \par Description
+ *       This command will resume a paused packet replay.  Pacing starts
+ *       over with the next packet, so the pause is not made up for by
+ *       sending packets faster.
+ *
+ *  \par Command Structure
+ *       #DS_ReplayResumeCmd_t
+ *
+ *  \par Command Verification
+ *       Evidence of success may be found in the following telemetry:
+ *       - #DS_HkTlm_Payload_t.CmdAcceptedCounter will increment
+ *       - The #DS_REPLAY_CTRL_CMD_EID informational event message will be sent
+ *       - #DS_HkTlm_Payload_t.ReplayState will show the replay is active
+ *
+ *  \par Error Conditions
+ *       This command can fail for the following reasons:
+ *       - Invalid command packet length
+ *       - No replay is paused
+ *
+ *       Evidence of failure may be found in the following telemetry:
+ *       - #DS_HkTlm_Payload_t.CmdRejectedCounter will increment
+ *       - The #DS_REPLAY_CTRL_CMD_ERR_EID error event message will be sent
+ *
+ *  \par Criticality
+ *       None
+ */
+#define DS_REPLAY_RESUME_CC DS_CCVAL(REPLAY_RESUME)
+
+/**
+ * \brief Seek Packet Replay
+ *
+ *  \par Description
+ *       This command will move an active or paused packet replay to the
+ *       first packet with a packet time (seconds) not earlier than the
+ *       commanded time.  The seek may move forward or backward in the
+ *       file.  When the file has a finalized sidecar index, the index
+ *       is used to avoid reading the skipped part of the file.
+ *
+ *  \par Command Structure
+ *       #DS_ReplaySeekCmd_t
+ *
+ *  \par Command Verification
+ *       Evidence of success may be found in the following telemetry:
+ *       - #DS_HkTlm_Payload_t.CmdAcceptedCounter will increment
+ *       - The #DS_REPLAY_SEEK_CMD_EID informational event message will be sent
+ *
+ *  \par Error Conditions
+ *       This command can fail for the following reasons:
+ *       - Invalid command packet length
+ *       - No replay is active or paused
+ *
+ *       Evidence of failure may be found in the following telemetry:
+ *       - #DS_HkTlm_Payload_t.CmdRejectedCounter will increment
+ *       - The #DS_REPLAY_SEEK_CMD_ERR_EID error event message will be sent
+ *
+ *  \par Criticality
+ *       None
+ */
+#define DS_REPLAY_SEEK_CC DS_CCVAL(REPLAY_SEEK)
+
+/**
+ * \brief Set Rate Limit For Packet Filter Table Entry
+ *
+ *  \par Description
+ *       This command will modify the packet and byte rate limits of the
+ *       indicated Message ID in the Packet Filter Table.  Packets of that
+ *       Message ID in excess of either limit are discarded before any of
+ *       the filters are applied, and are counted in
+ *       #DS_HkTlm_Payload_t.RateDropPktCounter.  A limit of zero means
+ *       no limit.  The new limits take effect with the next packet.
+ *
+ *  \par Command Structure
+ *       #DS_SetFilterRateCmd_t
+ *
+ *  \par Command Verification
+ *       Evidence of success may be found in the following telemetry:
+ *       - #DS_HkTlm_Payload_t.CmdAcceptedCounter will increment
+ *       - The #DS_FILTER_RATE_CMD_EID informational event message will be sent
+ *
+ *  \par Error Conditions
+ *       This command can fail for the following reasons:
+ *       - Invalid command packet length
+ *       - Invalid message ID
+ *       - Filter table is not currently loaded
+ *       - Message ID is not in filter table
+ *
+ *       Evidence of failure may be found in the following telemetry:
+ *       - #DS_HkTlm_Payload_t.CmdRejectedCounter will increment
+ *       - The #DS_FILTER_RATE_CMD_ERR_EID error event message will be sent
+ *
+ *  \par Criticality
+ *       None
+ */
+#define DS_SET_FILTER_RATE_CC DS_CCVAL(SET_FILTER_RATE)
+
+/**
+ * \brief Set Rate Limit For Destination File Table Entry
+ *
+ *  \par Description
+ *       This command will modify the packet and byte rate limits of the
+ *       indicated entry in the Destination File Table.  Packets that pass
+ *       a filter for the destination but are in excess of either limit
+ *       are not written to the file, and are counted in
+ *       #DS_HkTlm_Payload_t.RateDropPktCounter.  A limit of zero means
+ *       no limit.  The new limits take effect with the next packet.
+ *
+ *  \par Command Structure
+ *       #DS_SetDestRateCmd_t
+ *
+ *  \par Command Verification
+ *       Evidence of success may be found in the following telemetry:
+ *       - #DS_HkTlm_Payload_t.CmdAcceptedCounter will increment
+ *       - The #DS_DEST_RATE_CMD_EID informational event message will be sent
+ *
+ *  \par Error Conditions
+ *       This command can fail for the following reasons:
+ *       - Invalid command packet length
+ *       - Invalid destination file table index
+ *       - Destination file table is not currently loaded
+ *
+ *       Evidence of failure may be found in the following telemetry:
+ *       - #DS_HkTlm_Payload_t.CmdRejectedCounter will increment
+ *       - The #DS_DEST_RATE_CMD_ERR_EID error event message will be sent
+ *
+ *  \par Criticality
+ *       None
+ */
+#define DS_SET_DEST_RATE_CC DS_CCVAL(SET_DEST_RATE)
+
+/**
+ * \brief Get Destination Statistics Packet
+ *
+ *  \par Description
+ *       This command will send the DS Destination Statistics Packet,
+ *       which holds 64-bit packet, byte and write call counts and the
+ *       longest write time, file rollovers and write errors for each
+ *       destination file.  The packet may also be sent periodically,
+ *       see #DS_DEST_STATS_HK_CYCLES.
+ *
+ *  \par Command Structure
+ *       #DS_GetDestStatsCmd_t
+ *
+ *  \par Command Verification
+ *       Evidence of success may be found in the following telemetry:
+ *       - #DS_HkTlm_Payload_t.CmdAcceptedCounter will increment
+ *       - The #DS_DestStatsPkt_t packet will be sent
+ *
+ *  \par Error Conditions
+ *       This command can fail for the following reasons:
+ *       - Invalid command packet length
+ *
+ *       Evidence of failure may be found in the following telemetry:
+ *       - #DS_HkTlm_Payload_t.CmdRejectedCounter will increment
+ *       - The #DS_GET_DEST_STATS_CMD_ERR_EID error event message will be sent
+ *
+ *  \par Criticality
+ *       None
+ */
+#define DS_GET_DEST_STATS_CC DS_CCVAL(GET_DEST_STATS)
+
+/**
+ * \brief Set Flight Recorder
+ *
+ *  \par Description
+ *       This command will enable or disable a flight recorder.  While
+ *       enabled, the packets that pass the filters for the recorder
+ *       destination file are held in a fixed memory buffer instead of
+ *       being written, with the oldest packets overwritten as new ones
+ *       arrive.  A dump is started by #DS_TRIGGER_RECORDER_CC or by the
+ *       arrival of TriggerMsgID.  The held packets, followed by the
+ *       packets received in the next PostTriggerSeconds, are written to
+ *       the destination file, and the file is closed.  Enabling a
+ *       recorder discards any packets it held.  Disabling a recorder
+ *       discards its packets and abandons any dump in progress.
+ *
+ *  \par Command Structure
+ *       #DS_SetRecorderCmd_t
+ *
+ *  \par Command Verification
+ *       Evidence of success may be found in the following telemetry:
+ *       - #DS_HkTlm_Payload_t.CmdAcceptedCounter will increment
+ *       - The #DS_SET_RECORDER_CMD_EID informational event message will be sent
+ *
+ *  \par Error Conditions
+ *       This command can fail for the following reasons:
+ *       - Invalid command packet length
+ *       - Invalid recorder index
+ *       - Invalid recorder enable/disable state
+ *       - Invalid destination file table index
+ *       - Destination file is held by another recorder
+ *       - Recorder is dumping (enable only)
+ *
+ *       Evidence of failure may be found in the following telemetry:
+ *       - #DS_HkTlm_Payload_t.CmdRejectedCounter will increment
+ *       - The #DS_SET_RECORDER_CMD_ERR_EID error event message will be sent
+ *
+ *  \par Criticality
+ *       None
+ */
+#define DS_SET_RECORDER_CC DS_CCVAL(SET_RECORDER)
+
+/**
+ * \brief Trigger Flight Recorder Dump
+ *
+ *  \par Description
+ *       This command will start a dump of the indicated flight recorder,
+ *       the same as the arrival of its trigger Message ID.
+ *
+ *  \par Command Structure
+ *       #DS_TriggerRecorderCmd_t
+ *
+ *  \par Command Verification
+ *       Evidence of success may be found in the following telemetry:
+ *       - #DS_HkTlm_Payload_t.CmdAcceptedCounter will increment
+ *       - #DS_HkTlm_Payload_t.RecorderTrigCounter will increment
+ *       - The #DS_RECORDER_TRIGGER_EID informational event message will be sent
+ *
+ *  \par Error Conditions
+ *       This command can fail for the following reasons:
+ *       - Invalid command packet length
+ *       - Invalid recorder index
+ *       - Recorder is disabled or already dumping
+ *
+ *       Evidence of failure may be found in the following telemetry:
+ *       - #DS_HkTlm_Payload_t.CmdRejectedCounter will increment
+ *       - The #DS_TRIGGER_RECORDER_CMD_ERR_EID error event message will be sent
+ *
+ *  \par Criticality
+ *       None
+ */
+#define DS_TRIGGER_RECORDER_CC DS_CCVAL(TRIGGER_RECORDER)
+
+/**
+ * \brief Send Latest-Value Cache Packet
+ *
+ *  \par Description
+ *       When the latest-value cache is enabled (see #DS_CACHE_ENTRIES),
+ *       DS keeps the last packet received for each Message ID listed in
+ *       the packet filter table, whether or not the packet was stored.
+ *       This command will send the cached packet of the indicated Message
+ *       ID on the Software Bus, unchanged (packets longer than
+ *       #DS_CACHE_ENTRY_SIZE are sent truncated).
+ *
+ *  \par Command Structure
+ *       #DS_SendCacheCmd_t
+ *
+ *  \par Command Verification
+ *       Evidence of success may be found in the following telemetry:
+ *       - #DS_HkTlm_Payload_t.CmdAcceptedCounter will increment
+ *       - The #DS_SEND_CACHE_CMD_EID debug event message will be sent
+ *       - The cached packet will be sent
+ *
+ *  \par Error Conditions
+ *       This command can fail for the following reasons:
+ *       - Invalid command packet length
+ *       - Invalid Message ID
+ *       - The latest-value cache is disabled
+ *       - No packet with the Message ID has been cached
+ *
+ *       Evidence of failure may be found in the following telemetry:
+ *       - #DS_HkTlm_Payload_t.CmdRejectedCounter will increment
+ *       - The #DS_SEND_CACHE_CMD_ERR_EID error event message will be sent
+ *
+ *  \par Criticality
+ *       None
+ */
+#define DS_SEND_CACHE_CC DS_CCVAL(SEND_CACHE)
+
+/**
+ * \brief Write Latest-Value Cache Snapshot File
+ *
+ *  \par Description
+ *       This command will write every cached packet (see #DS_SEND_CACHE_CC)
+ *       to the indicated file, in the order the Message IDs were first
+ *       cached.  The file has the same headers as a destination file, so
+ *       it may be read with the same ground tools.  An existing file is
+ *       overwritten.
+ *
+ *  \par Command Structure
+ *       #DS_WriteCacheCmd_t
+ *
+ *  \par Command Verification
+ *       Evidence of success may be found in the following telemetry:
+ *       - #DS_HkTlm_Payload_t.CmdAcceptedCounter will increment
+ *       - The #DS_WRITE_CACHE_CMD_EID informational event message will be sent
+ *
+ *  \par Error Conditions
+ *       This command can fail for the following reasons:
+ *       - Invalid command packet length
+ *       - The latest-value cache is disabled
+ *       - Filename is empty
+ *       - File create or write error
+ *
+ *       Evidence of failure may be found in the following telemetry:
+ *       - #DS_HkTlm_Payload_t.CmdRejectedCounter will increment
+ *       - The #DS_WRITE_CACHE_CMD_ERR_EID error event message will be sent
+ *
+ *  \par Criticality
+ *       None
+ */
+#define DS_WRITE_CACHE_CC DS_CCVAL(WRITE_CACHE)
+
+/**
+ * \brief Get Closed File Manifest Packet
+ *
+ *  \par Description
+ *       This command will send the DS Closed File Manifest Packet for the
+ *       indicated destination file.  The packet gives the name of the
+ *       manifest in the destination move directory and the number of
+ *       complete records it holds, so that a consumer can read just the
+ *       records appended since its last query (moved files and files
+ *       since deleted by the storage budget).  Manifests are written
+ *       only when #DS_MANIFEST_FILE_NAME is not empty.
+ *
+ *  \par Command Structure
+ *       #DS_GetManifestCmd_t
+ *
+ *  \par Command Verification
+ *       Evidence of success may be found in the following telemetry:
+ *       - #DS_HkTlm_Payload_t.CmdAcceptedCounter will increment
+ *       - The #DS_ManifestPkt_t packet will be sent
+ *
+ *  \par Error Conditions
+ *       This command can fail for the following reasons:
+ *       - Invalid command packet length
+ *       - Invalid destination file table index
+ *       - Destination file table is not loaded
+ *       - Destination file has no manifest (manifests not configured,
+ *         file moves disabled or no move directory)
+ *
+ *       Evidence of failure may be found in the following telemetry:
+ *       - #DS_HkTlm_Payload_t.CmdRejectedCounter will increment
+ *       - The #DS_GET_MANIFEST_CMD_ERR_EID error event message will be sent
+ *
+ *  \par Criticality
+ *       None
+ */
+#define DS_GET_MANIFEST_CC DS_CCVAL(GET_MANIFEST)
+
 /**\}*/
 
 #endif
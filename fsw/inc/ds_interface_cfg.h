@@ -41,6 +41,15 @@
  *       be simplified if file index 'n' always describes the same
  *       file - even if that file is not in use at the present time.
  *
+ *       Each destination may hold up to three OSAL file handles open
+ *       at once: the destination file, its sidecar index file and (when
+ *       #DS_MANIFEST_FILE_NAME is not empty) the closed file manifest of
+ *       its move directory, which stays open between appends.  File
+ *       extraction, packet replay and cache snapshots open up to five
+ *       more handles while they run.  The OSAL OS_MAX_NUM_OPEN_FILES
+ *       limit must allow for (3 * DS_DEST_FILE_CNT) + 5 handles in
+ *       addition to those used by other applications.
+ *
  *  \par Limits:
  *       The number must be greater than zero but there is no upper
  *       enforced limit for this parameter.
@@ -153,6 +162,22 @@
 #define DS_FILTERS_PER_PACKET                   DS_INTERFACE_CFGVAL(FILTERS_PER_PACKET)
 #define DEFAULT_DS_INTERFACE_FILTERS_PER_PACKET 4
 
+/**
+ *  \brief Packet Filter Table -- predicate terms per packet
+ *
+ *  \par Description:
+ *       This parameter defines the number of payload predicate terms
+ *       in each packet entry of the DS Packet Filter Table.  Each
+ *       term compares one masked packet field with a value, and the
+ *       terms are combined with AND or OR to decide whether the
+ *       packet is offered to its filters at all.
+ *
+ *  \par Limits:
+ *       The number must be greater than zero and not greater than 255.
+ */
+#define DS_PREDICATE_TERMS                   DS_INTERFACE_CFGVAL(PREDICATE_TERMS)
+#define DEFAULT_DS_INTERFACE_PREDICATE_TERMS 2
+
 /**
  *  \brief Common Table File -- descriptor text buffer size
  *
@@ -168,6 +193,36 @@
 #define DS_DESCRIPTOR_BUFSIZE                   DS_INTERFACE_CFGVAL(DESCRIPTOR_BUFSIZE)
 #define DEFAULT_DS_INTERFACE_DESCRIPTOR_BUFSIZE 32
 
+/**
+ *  \brief Extract File Command -- number of message IDs
+ *
+ *  \par Description:
+ *       This parameter defines the number of Message IDs that may be
+ *       selected by a single extract file command.  Unused selections
+ *       are set to zero.
+ *
+ *  \par Limits:
+ *       The number must be greater than zero.
+ */
+#define DS_EXTRACT_MID_CNT                   DS_INTERFACE_CFGVAL(EXTRACT_MID_CNT)
+#define DEFAULT_DS_INTERFACE_EXTRACT_MID_CNT 8
+
+/**
+ *  \brief Statistics Telemetry -- number of latency histogram bins
+ *
+ *  \par Description:
+ *       This parameter defines the number of log2 latency bins kept
+ *       for each stage of the packet storage path.  Bin 0 counts
+ *       samples under one microsecond, bin N counts samples from
+ *       2^(N-1) up to 2^N microseconds, and the last bin also counts
+ *       every longer sample.
+ *
+ *  \par Limits:
+ *       The number must be at least 2 and no more than 32.
+ */
+#define DS_STATS_HISTOGRAM_BINS                   DS_INTERFACE_CFGVAL(STATS_HISTOGRAM_BINS)
+#define DEFAULT_DS_INTERFACE_STATS_HISTOGRAM_BINS 20
+
 /**\}*/
 
 #endif
@@ -353,6 +353,642 @@
 #define DS_PER_PACKET_PIPE_LIMIT                  DS_INTERNAL_CFGVAL(PER_PACKET_PIPE_LIMIT)
 #define DEFAULT_DS_INTERNAL_PER_PACKET_PIPE_LIMIT 45
 
+/**
+ *  \brief Ring Files -- read and fill buffer size
+ *
+ *  \par Description:
+ *       This parameter defines the size in bytes of the buffer used to
+ *       read the oldest packet headers of a ring destination file ahead
+ *       of the writer, and to fill a new ring file with zeros.  Each
+ *       read finds the boundaries of as many packets as fit in the
+ *       buffer (up to #DS_RING_WALK_RECORDS), so that overwriting them
+ *       needs no further file access.
+ *
+ *  \par Limits:
+ *       The value must be a multiple of 4 between 64 and 65536.
+ */
+#define DS_RING_BUFFER_SIZE                  DS_INTERNAL_CFGVAL(RING_BUFFER_SIZE)
+#define DEFAULT_DS_INTERNAL_RING_BUFFER_SIZE 4096
+
+/**
+ *  \brief Ring Files -- packet boundaries remembered per read
+ *
+ *  \par Description:
+ *       This parameter defines how many upcoming packet boundaries are
+ *       remembered for each ring destination file after each read of
+ *       the oldest packet headers.
+ *
+ *  \par Limits:
+ *       The value must be between 1 and 65535.
+ */
+#define DS_RING_WALK_RECORDS                  DS_INTERNAL_CFGVAL(RING_WALK_RECORDS)
+#define DEFAULT_DS_INTERNAL_RING_WALK_RECORDS 64
+
+/**
+ *  \brief Storage Budget -- global limit
+ *
+ *  \par Description:
+ *       This parameter defines the total number of bytes that DS
+ *       may keep in destination files, counting every closed file
+ *       that DS is still tracking plus a full #DS_DestFileEntry_t
+ *       MaxFileSize reservation for each open file.  Before a new
+ *       destination file is created, DS deletes the oldest tracked
+ *       closed files of equal or lower storage priority until the
+ *       new file fits within the budget.
+ *
+ *  \par Limits:
+ *       Set to zero to disable the global storage budget.  Values
+ *       larger than 4 GB must be written as 64-bit constants.
+ */
+#define DS_STORAGE_BUDGET                  DS_INTERNAL_CFGVAL(STORAGE_BUDGET)
+#define DEFAULT_DS_INTERNAL_STORAGE_BUDGET 0
+
+/**
+ *  \brief Storage Budget -- closed file history depth
+ *
+ *  \par Description:
+ *       This parameter defines the number of closed files that DS
+ *       remembers for each destination.  Only remembered files count
+ *       against the storage budgets and only remembered files may be
+ *       deleted to make room for new data.  When the history is full
+ *       the oldest entry is forgotten (but not deleted).
+ *
+ *  \par Limits:
+ *       The value must be greater than zero.  To keep a destination
+ *       within budget the depth should be at least the destination
+ *       MaxStorageSize divided by its MaxFileSize.
+ */
+#define DS_CLOSED_FILE_HISTORY                  DS_INTERNAL_CFGVAL(CLOSED_FILE_HISTORY)
+#define DEFAULT_DS_INTERNAL_CLOSED_FILE_HISTORY 16
+
+/**
+ *  \brief Sidecar Index File -- filename extension
+ *
+ *  \par Description:
+ *       This parameter defines the extension appended to the full
+ *       destination filename to create the name of the optional
+ *       sidecar index file written alongside the destination file.
+ *
+ *  \par Limits:
+ *       The string length (including string terminator) plus the
+ *       length of the destination filename cannot exceed
+ *       #DS_TOTAL_FNAME_BUFSIZE.  Longer names are reported when the
+ *       index file is created and no index is written.
+ */
+#define DS_INDEX_FILE_EXTENSION                  DS_INTERNAL_CFGVAL(INDEX_FILE_EXTENSION)
+#define DEFAULT_DS_INTERNAL_INDEX_FILE_EXTENSION ".idx"
+
+/**
+ *  \brief Sidecar Index File -- records buffered per destination
+ *
+ *  \par Description:
+ *       This parameter defines the number of index records that are
+ *       buffered in memory for each destination before they are
+ *       written to the sidecar index file in a single write.
+ *
+ *  \par Limits:
+ *       The value must be greater than zero.
+ */
+#define DS_INDEX_BUFFER_RECORDS                  DS_INTERNAL_CFGVAL(INDEX_BUFFER_RECORDS)
+#define DEFAULT_DS_INTERNAL_INDEX_BUFFER_RECORDS 32
+
+/**
+ *  \brief Summary Trailer -- message IDs summarized per file
+ *
+ *  \par Description:
+ *       This parameter defines the number of distinct message IDs that
+ *       are summarized in the close-time trailer of a destination file.
+ *       Packets with message IDs beyond this limit are counted in the
+ *       trailer footer but are not summarized individually.
+ *
+ *  \par Limits:
+ *       The value must be greater than zero.
+ */
+#define DS_FILE_TRAILER_ENTRIES                  DS_INTERNAL_CFGVAL(FILE_TRAILER_ENTRIES)
+#define DEFAULT_DS_INTERNAL_FILE_TRAILER_ENTRIES 16
+
+/**
+ *  \brief File Extraction -- child task name
+ *
+ *  \par Description:
+ *       This parameter defines the name of the child task that extracts
+ *       packets from data storage files.
+ *
+ *  \par Limits:
+ *       The string length (including string terminator) cannot
+ *       exceed #OS_MAX_API_NAME.  (limit is not verified)
+ */
+#define DS_EXTRACT_TASK_NAME                  DS_INTERNAL_CFGVAL(EXTRACT_TASK_NAME)
+#define DEFAULT_DS_INTERNAL_EXTRACT_TASK_NAME "DS_EXTRACT"
+
+/**
+ *  \brief File Extraction -- child task stack size
+ *
+ *  \par Description:
+ *       This parameter defines the stack size of the file extraction
+ *       child task.  The extraction buffer is not on the stack.
+ *
+ *  \par Limits:
+ *       The value must be greater than zero.
+ */
+#define DS_EXTRACT_TASK_STACK_SIZE                  DS_INTERNAL_CFGVAL(EXTRACT_TASK_STACK_SIZE)
+#define DEFAULT_DS_INTERNAL_EXTRACT_TASK_STACK_SIZE 8192
+
+/**
+ *  \brief File Extraction -- child task priority
+ *
+ *  \par Description:
+ *       This parameter defines the priority of the file extraction
+ *       child task.  It should be a lower priority (larger number)
+ *       than the DS application so that extraction only uses time
+ *       left over after packet storage.
+ *
+ *  \par Limits:
+ *       The value must be between 1 and 255.
+ */
+#define DS_EXTRACT_TASK_PRIORITY                  DS_INTERNAL_CFGVAL(EXTRACT_TASK_PRIORITY)
+#define DEFAULT_DS_INTERNAL_EXTRACT_TASK_PRIORITY 200
+
+/**
+ *  \brief File Extraction -- read buffer size
+ *
+ *  \par Description:
+ *       This parameter defines the size of the buffer used to read the
+ *       source file during extraction.  The file is read in chunks of
+ *       this size.  Packets larger than the buffer cannot be extracted.
+ *
+ *  \par Limits:
+ *       The value must be a multiple of four and not less than 1024.
+ *       It should be large enough to hold the largest stored packet.
+ */
+#define DS_EXTRACT_BUFFER_SIZE                  DS_INTERNAL_CFGVAL(EXTRACT_BUFFER_SIZE)
+#define DEFAULT_DS_INTERNAL_EXTRACT_BUFFER_SIZE 16384
+
+/**
+ *  \brief Packet Replay -- child task name
+ *
+ *  \par Description:
+ *       This parameter defines the name of the child task that replays
+ *       packets from data storage files onto the Software Bus.
+ *
+ *  \par Limits:
+ *       The string length (including string terminator) cannot
+ *       exceed #OS_MAX_API_NAME.  (limit is not verified)
+ */
+#define DS_REPLAY_TASK_NAME                  DS_INTERNAL_CFGVAL(REPLAY_TASK_NAME)
+#define DEFAULT_DS_INTERNAL_REPLAY_TASK_NAME "DS_REPLAY"
+
+/**
+ *  \brief Packet Replay -- child task stack size
+ *
+ *  \par Description:
+ *       This parameter defines the stack size of the packet replay
+ *       child task.  The replay buffer is not on the stack.
+ *
+ *  \par Limits:
+ *       The value must be greater than zero.
+ */
+#define DS_REPLAY_TASK_STACK_SIZE                  DS_INTERNAL_CFGVAL(REPLAY_TASK_STACK_SIZE)
+#define DEFAULT_DS_INTERNAL_REPLAY_TASK_STACK_SIZE 8192
+
+/**
+ *  \brief Packet Replay -- child task priority
+ *
+ *  \par Description:
+ *       This parameter defines the priority of the packet replay child
+ *       task.  It should be a lower priority (larger number) than the
+ *       DS application so that replay file reads never delay the
+ *       storage of live packets.
+ *
+ *  \par Limits:
+ *       The value must be between 1 and 255.
+ */
+#define DS_REPLAY_TASK_PRIORITY                  DS_INTERNAL_CFGVAL(REPLAY_TASK_PRIORITY)
+#define DEFAULT_DS_INTERNAL_REPLAY_TASK_PRIORITY 200
+
+/**
+ *  \brief Packet Replay -- read buffer size
+ *
+ *  \par Description:
+ *       This parameter defines the size of the buffer used to read ahead
+ *       of the packets being replayed.  Packets larger than the buffer
+ *       cannot be replayed.
+ *
+ *  \par Limits:
+ *       The value must be a multiple of four and not less than 1024.
+ *       It should be large enough to hold the largest stored packet.
+ */
+#define DS_REPLAY_BUFFER_SIZE                  DS_INTERNAL_CFGVAL(REPLAY_BUFFER_SIZE)
+#define DEFAULT_DS_INTERNAL_REPLAY_BUFFER_SIZE 16384
+
+/**
+ *  \brief Packet Replay -- maximum rate multiplier
+ *
+ *  \par Description:
+ *       This parameter defines the largest rate multiplier accepted by
+ *       the replay start command.  A multiplier of one replays packets
+ *       with their original inter-packet timing.
+ *
+ *  \par Limits:
+ *       The value must be greater than zero.
+ */
+#define DS_REPLAY_MAX_RATE                  DS_INTERNAL_CFGVAL(REPLAY_MAX_RATE)
+#define DEFAULT_DS_INTERNAL_REPLAY_MAX_RATE 100
+
+/**
+ *  \brief Packet Replay -- maximum inter-packet delay
+ *
+ *  \par Description:
+ *       This parameter defines the longest delay (in milliseconds) the
+ *       replay task will wait between two packets.  Larger gaps in the
+ *       stored packet times are shortened to this delay.
+ *
+ *  \par Limits:
+ *       The value must be greater than zero.
+ */
+#define DS_REPLAY_MAX_DELAY                  DS_INTERNAL_CFGVAL(REPLAY_MAX_DELAY)
+#define DEFAULT_DS_INTERNAL_REPLAY_MAX_DELAY 10000
+
+/**
+ *  \brief Packet Replay -- burst limit
+ *
+ *  \par Description:
+ *       This parameter defines the number of packets the replay task
+ *       will send without any delay between them (packets with the same
+ *       time or a high rate multiplier) before it yields for
+ *       #DS_REPLAY_POLL_DELAY milliseconds.
+ *
+ *  \par Limits:
+ *       The value must be greater than zero.
+ */
+#define DS_REPLAY_BURST_LIMIT                  DS_INTERNAL_CFGVAL(REPLAY_BURST_LIMIT)
+#define DEFAULT_DS_INTERNAL_REPLAY_BURST_LIMIT 32
+
+/**
+ *  \brief Packet Replay -- poll delay
+ *
+ *  \par Description:
+ *       This parameter defines the delay (in milliseconds) used by the
+ *       replay task while replay is paused and after a burst of packets.
+ *
+ *  \par Limits:
+ *       The value must be greater than zero.
+ */
+#define DS_REPLAY_POLL_DELAY                  DS_INTERNAL_CFGVAL(REPLAY_POLL_DELAY)
+#define DEFAULT_DS_INTERNAL_REPLAY_POLL_DELAY 100
+
+/**
+ *  \brief Packet Replay -- echo table depth
+ *
+ *  \par Description:
+ *       This parameter defines the number of packets sent by the replay
+ *       task that DS remembers so they are not stored again when they
+ *       come back through the DS pipe.  Entries are reused round robin,
+ *       so the value should not be less than #DS_APP_PIPE_DEPTH.
+ *
+ *  \par Limits:
+ *       The value must be greater than zero and not greater than 1024.
+ */
+#define DS_ECHO_DEPTH                  DS_INTERNAL_CFGVAL(ECHO_DEPTH)
+#define DEFAULT_DS_INTERNAL_ECHO_DEPTH 64
+
+/**
+ *  \brief Packet Replay -- echo timeout
+ *
+ *  \par Description:
+ *       This parameter defines the number of seconds (of mission elapsed
+ *       time) that DS waits for a sent packet to come back through the
+ *       DS pipe.  Packets that never come back (rejected by the software
+ *       bus or dropped from a full pipe) are forgotten after this time so
+ *       live packets stop paying for the echo table search.
+ *
+ *  \par Limits:
+ *       The value must be greater than zero and not greater than 3600.
+ */
+#define DS_ECHO_TIMEOUT                  DS_INTERNAL_CFGVAL(ECHO_TIMEOUT)
+#define DEFAULT_DS_INTERNAL_ECHO_TIMEOUT 4
+
+/**
+ *  \brief Compression -- block size
+ *
+ *  \par Description:
+ *       This parameter defines the number of packet bytes buffered for
+ *       a compressed destination file before the buffered block is
+ *       compressed and written.  Each block is compressed independently
+ *       so larger blocks compress better but more data is held in memory
+ *       (one block per destination) until the block is written.
+ *
+ *  \par Limits:
+ *       The value must be a multiple of four, not less than 256 and
+ *       not greater than 65532.
+ */
+#define DS_COMPRESS_BLOCK_SIZE                  DS_INTERNAL_CFGVAL(COMPRESS_BLOCK_SIZE)
+#define DEFAULT_DS_INTERNAL_COMPRESS_BLOCK_SIZE 4096
+
+/**
+ *  \brief Compression -- match finder hash bits
+ *
+ *  \par Description:
+ *       This parameter defines the number of bits in the hash used by
+ *       the compressor to find repeated data.  The hash table has one
+ *       16-bit entry per hash value and is cleared for each block, so
+ *       more bits find more matches at the cost of memory and time.
+ *
+ *  \par Limits:
+ *       The value must be between 8 and 16.
+ */
+#define DS_COMPRESS_HASH_BITS                  DS_INTERNAL_CFGVAL(COMPRESS_HASH_BITS)
+#define DEFAULT_DS_INTERNAL_COMPRESS_HASH_BITS 12
+
+/**
+ *  \brief Delta Records -- message IDs tracked per destination
+ *
+ *  \par Description:
+ *       This parameter defines the number of packet streams for which
+ *       a delta encoded destination file remembers the last packet
+ *       header.  A packet from a stream that is not remembered is
+ *       written in full and replaces the oldest remembered stream.
+ *
+ *  \par Limits:
+ *       The value must be between 1 and 255.
+ */
+#define DS_RECORD_REFERENCES                  DS_INTERNAL_CFGVAL(RECORD_REFERENCES)
+#define DEFAULT_DS_INTERNAL_RECORD_REFERENCES 16
+
+/**
+ *  \brief Delta Records -- record buffer size
+ *
+ *  \par Description:
+ *       This parameter defines the size of the buffer used to build a
+ *       delta record.  Packets whose record would not fit the buffer
+ *       are written in full.
+ *
+ *  \par Limits:
+ *       The value must be a multiple of four and not less than 64.
+ */
+#define DS_RECORD_BUFFER_SIZE                  DS_INTERNAL_CFGVAL(RECORD_BUFFER_SIZE)
+#define DEFAULT_DS_INTERNAL_RECORD_BUFFER_SIZE 1024
+
+/**
+ *  \brief Backpressure Decimation -- number of levels
+ *
+ *  \par Description:
+ *       This parameter defines the number of decimation levels DS may
+ *       enter when it falls behind the packets arriving on its pipe.
+ *       At level L the X value of every low priority filter is
+ *       multiplied by 2 to the power of L, so each level halves the
+ *       rate at which those packets are stored.  A value of zero
+ *       disables backpressure decimation.
+ *
+ *  \par Limits:
+ *       The value must be between 0 and 8.
+ */
+#define DS_DECIMATION_LEVELS                  DS_INTERNAL_CFGVAL(DECIMATION_LEVELS)
+#define DEFAULT_DS_INTERNAL_DECIMATION_LEVELS 3
+
+/**
+ *  \brief Backpressure Decimation -- first level threshold
+ *
+ *  \par Description:
+ *       This parameter defines, as a percentage of #DS_APP_PIPE_DEPTH,
+ *       the number of messages waiting in the DS pipe at which
+ *       decimation level 1 is entered.  The further levels are spaced
+ *       evenly between this threshold and a full pipe.  DS measures
+ *       the backlog by sending a #DS_BACKLOG_PROBE_MID message to its
+ *       own pipe after receiving this many messages and counting the
+ *       messages received ahead of it.  The level is lowered one step
+ *       per housekeeping request once the largest backlog measured
+ *       since the previous request falls below the threshold of the
+ *       current level.
+ *
+ *  \par Limits:
+ *       The value must be between 1 and 100.  Lower values measure
+ *       the backlog more often, at the cost of one probe message
+ *       per threshold of messages received.
+ */
+#define DS_DECIMATION_THRESHOLD                  DS_INTERNAL_CFGVAL(DECIMATION_THRESHOLD)
+#define DEFAULT_DS_INTERNAL_DECIMATION_THRESHOLD 50
+
+/**
+ *  \brief Wildcard Filter Entries -- message IDs
+ *
+ *  \par Description:
+ *       This parameter defines the total number of message IDs that
+ *       the wildcard entries (non-zero MessageMask) of the packet
+ *       filter table may cover.  Wildcard entries are expanded into
+ *       the message ID lookup table when the filter table is loaded,
+ *       so this is also the number of extra lookup table links.
+ *
+ *  \par Limits:
+ *       The value must be between 1 and 65535.
+ */
+#define DS_WILDCARD_MIDS                  DS_INTERNAL_CFGVAL(WILDCARD_MIDS)
+#define DEFAULT_DS_INTERNAL_WILDCARD_MIDS 256
+
+/**
+ *  \brief Wildcard Filter Entries -- message ID bits
+ *
+ *  \par Description:
+ *       This parameter defines the message ID bits that may differ
+ *       between the message IDs covered by a wildcard entry.  Bits
+ *       outside this mask are always taken from the entry MessageID.
+ *       The default spans the 2048 identifiers within a packet type,
+ *       which also keeps lookup table lists short.
+ *
+ *  \par Limits:
+ *       The value must be non-zero.
+ */
+#define DS_WILDCARD_MID_MASK                  DS_INTERNAL_CFGVAL(WILDCARD_MID_MASK)
+#define DEFAULT_DS_INTERNAL_WILDCARD_MID_MASK 0x07FF
+
+/**
+ *  \brief Packet Truncation -- largest store length
+ *
+ *  \par Description:
+ *       This parameter defines the largest non-zero MaxStoreLength
+ *       allowed in the packet filter table, which is also the size of
+ *       the buffer holding a truncated packet while it is written.
+ *
+ *  \par Limits:
+ *       The value must be a multiple of 4 and between 64 and 65532.
+ */
+#define DS_TRUNCATE_MAX_LENGTH                  DS_INTERNAL_CFGVAL(TRUNCATE_MAX_LENGTH)
+#define DEFAULT_DS_INTERNAL_TRUNCATE_MAX_LENGTH 512
+
+/**
+ *  \brief Packet Truncation -- patch packet length
+ *
+ *  \par Description:
+ *       This parameter selects how truncated packets are stored.  When
+ *       set to 0 the packet header is left intact and the stored bytes
+ *       follow a truncated record prefix (#DS_FILE_RECORD_TRUNC_TAG).
+ *       When set to 1 the CCSDS length field is patched to the stored
+ *       length and the segmentation flags are set to "first segment",
+ *       so the file remains a plain sequence of packets.  Extract and
+ *       replay reject files holding truncated record prefixes, and
+ *       table validation rejects truncating filters for ring
+ *       destinations while this is 0.
+ *
+ *  \par Limits:
+ *       The value must be 0 or 1.
+ */
+#define DS_TRUNCATE_PATCH_LENGTH                  DS_INTERNAL_CFGVAL(TRUNCATE_PATCH_LENGTH)
+#define DEFAULT_DS_INTERNAL_TRUNCATE_PATCH_LENGTH 0
+
+/**
+ *  \brief Destination Statistics -- housekeeping cycles between packets
+ *
+ *  \par Description:
+ *       This parameter defines how often the destination statistics
+ *       packet (#DS_DestStatsPkt_t) is sent without being requested.
+ *       The packet is sent with every Nth housekeeping request.  When
+ *       set to 0 the packet is only sent in response to the
+ *       #DS_GET_DEST_STATS_CC command.
+ *
+ *  \par Limits:
+ *       The value must be between 0 and 65535.
+ */
+#define DS_DEST_STATS_HK_CYCLES                  DS_INTERNAL_CFGVAL(DEST_STATS_HK_CYCLES)
+#define DEFAULT_DS_INTERNAL_DEST_STATS_HK_CYCLES 0
+
+/**
+ *  \brief Detailed Performance Log -- enable storage path markers
+ *
+ *  \par Description:
+ *       This parameter enables performance log entry and exit markers
+ *       around the packet filter table lookup, the packet filter loop
+ *       and destination file write, create and close.  The markers use
+ *       the performance ID's defined in ds_perfids.h.  When set to 0
+ *       the markers are not compiled in and cost nothing.
+ *
+ *  \par Limits:
+ *       The value must be 0 or 1.
+ */
+#define DS_DETAIL_PERF_LOG                  DS_INTERNAL_CFGVAL(DETAIL_PERF_LOG)
+#define DEFAULT_DS_INTERNAL_DETAIL_PERF_LOG 0
+
+/**
+ *  \brief Latency Statistics -- enable storage path timing
+ *
+ *  \par Description:
+ *       This parameter enables the storage path latency statistics
+ *       (#DS_StatsTlm_Payload_t), the destination max write time and
+ *       the latency statistics packet sent after each housekeeping
+ *       packet.  Timing reads the mission elapsed time at least four
+ *       times for every stored packet.  When set to 0 the timing code
+ *       is removed at compile time and the statistics stay zero.
+ *
+ *  \par Limits:
+ *       The value must be 0 or 1.
+ */
+#define DS_STATS_TIMING                  DS_INTERNAL_CFGVAL(STATS_TIMING)
+#define DEFAULT_DS_INTERNAL_STATS_TIMING 0
+
+/**
+ *  \brief Flight Recorders -- number of recorders
+ *
+ *  \par Description:
+ *       This parameter defines the number of flight recorders.  Each
+ *       recorder reserves #DS_RECORDER_BUFFER_SIZE bytes of memory at
+ *       startup, whether or not it is enabled.
+ *
+ *  \par Limits:
+ *       The value must be between 1 and #DS_DEST_FILE_CNT.
+ */
+#define DS_RECORDER_CNT                  DS_INTERNAL_CFGVAL(RECORDER_CNT)
+#define DEFAULT_DS_INTERNAL_RECORDER_CNT 2
+
+/**
+ *  \brief Flight Recorders -- buffer size
+ *
+ *  \par Description:
+ *       This parameter defines the size in bytes of the memory buffer of
+ *       each flight recorder.  Each held packet uses its length plus a
+ *       4 byte record header, rounded up to a multiple of 4.  Packets
+ *       larger than half the buffer are not held.
+ *
+ *  \par Limits:
+ *       The value must be a multiple of 4 between 1024 and 16777216.
+ */
+#define DS_RECORDER_BUFFER_SIZE                  DS_INTERNAL_CFGVAL(RECORDER_BUFFER_SIZE)
+#define DEFAULT_DS_INTERNAL_RECORDER_BUFFER_SIZE 65536
+
+/**
+ *  \brief Flight Recorders -- packets written per message
+ *
+ *  \par Description:
+ *       This parameter defines how many held packets a dumping flight
+ *       recorder writes to its destination file after each message DS
+ *       takes from its pipe.  Whenever the pipe is empty, all held
+ *       packets are written.  Smaller values spread a dump over more
+ *       messages so that it delays other storage less.
+ *
+ *  \par Limits:
+ *       The value must be between 1 and 65535.
+ */
+#define DS_RECORDER_DRAIN_PACKETS                  DS_INTERNAL_CFGVAL(RECORDER_DRAIN_PACKETS)
+#define DEFAULT_DS_INTERNAL_RECORDER_DRAIN_PACKETS 16
+
+/**
+ *  \brief Latest-Value Cache -- entries
+ *
+ *  \par Description:
+ *       This parameter defines the number of Message IDs whose last
+ *       packet is kept in the latest-value cache, or 0 to disable the
+ *       cache.  Each entry is reserved at startup and given to a Message
+ *       ID listed in the packet filter table when its first packet
+ *       arrives (an expanded wildcard entry uses one entry per Message
+ *       ID).  Entries are kept for the life of the application, so
+ *       filter table changes need not clear the cache.  Packets of
+ *       further Message IDs are not cached and are counted in
+ *       housekeeping.  While the cache is enabled, every packet listed
+ *       in the packet filter table is copied into it.
+ *
+ *  \par Limits:
+ *       The value must be between 0 and 65535.
+ */
+#define DS_CACHE_ENTRIES                  DS_INTERNAL_CFGVAL(CACHE_ENTRIES)
+#define DEFAULT_DS_INTERNAL_CACHE_ENTRIES 0
+
+/**
+ *  \brief Latest-Value Cache -- entry size
+ *
+ *  \par Description:
+ *       This parameter defines the size in bytes of each latest-value
+ *       cache entry (see #DS_CACHE_ENTRIES).  Longer packets are cached
+ *       truncated to this size, with the packet length in the cached
+ *       header set to match.
+ *
+ *  \par Limits:
+ *       The value must be a multiple of 4 between 64 and 65536.
+ */
+#define DS_CACHE_ENTRY_SIZE                  DS_INTERNAL_CFGVAL(CACHE_ENTRY_SIZE)
+#define DEFAULT_DS_INTERNAL_CACHE_ENTRY_SIZE 256
+
+/**
+ *  \brief Closed File Manifest -- manifest filename
+ *
+ *  \par Description:
+ *       This parameter defines the name of the closed file manifest kept
+ *       in each destination move directory.  When a destination file is
+ *       moved after it is closed, a #DS_FileManifestRecord_t is appended
+ *       to the manifest in that directory, so that file transfer apps can
+ *       find new files without listing the directory.  Another record is
+ *       appended when the storage budget deletes a listed file.  An empty
+ *       string disables manifests (and the payload CRC they require).
+ *
+ *       Each manifest is opened once and stays open between appends,
+ *       using one OSAL file handle per distinct move directory (at most
+ *       #DS_DEST_FILE_CNT handles, see that parameter for the total).
+ *
+ *  \par Limits:
+ *       The string length (including string terminator) plus the length
+ *       of the move directory name cannot exceed #DS_TOTAL_FNAME_BUFSIZE.
+ *       Longer names are reported when the manifest is written.
+ */
+#define DS_MANIFEST_FILE_NAME                  DS_INTERNAL_CFGVAL(MANIFEST_FILE_NAME)
+#define DEFAULT_DS_INTERNAL_MANIFEST_FILE_NAME ""
+
 /**\}*/
 
 #endif
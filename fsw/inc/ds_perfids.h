@@ -29,6 +29,17 @@
  */
 
 #define DS_APPMAIN_PERF_ID 38 /**< \brief Main application performance ID */
+#define DS_EXTRACT_PERF_ID 39 /**< \brief File extraction child task performance ID */
+#define DS_REPLAY_PERF_ID  40 /**< \brief Packet replay child task performance ID */
+
+/*
+** Storage path performance ID's are only logged when DS_DETAIL_PERF_LOG is enabled...
+*/
+#define DS_FIND_MSGID_PERF_ID  41 /**< \brief Packet filter table lookup performance ID */
+#define DS_FILTER_PERF_ID      42 /**< \brief Packet filter loop performance ID */
+#define DS_WRITE_DATA_PERF_ID  43 /**< \brief Destination file write performance ID */
+#define DS_CREATE_DEST_PERF_ID 44 /**< \brief Destination file create performance ID */
+#define DS_CLOSE_DEST_PERF_ID  45 /**< \brief Destination file close performance ID */
 
 /**\}*/
 
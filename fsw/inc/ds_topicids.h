@@ -30,10 +30,12 @@
  * \{
  */
 
-#define CFE_MISSION_DS_CMD_TOPICID             CFE_MISSION_DS_TIDVAL(CMD)
-#define DEFAULT_CFE_MISSION_DS_CMD_TOPICID     0xBB
-#define CFE_MISSION_DS_SEND_HK_TOPICID         CFE_MISSION_DS_TIDVAL(SEND_HK)
-#define DEFAULT_CFE_MISSION_DS_SEND_HK_TOPICID 0xBC
+#define CFE_MISSION_DS_CMD_TOPICID                   CFE_MISSION_DS_TIDVAL(CMD)
+#define DEFAULT_CFE_MISSION_DS_CMD_TOPICID           0xBB
+#define CFE_MISSION_DS_SEND_HK_TOPICID               CFE_MISSION_DS_TIDVAL(SEND_HK)
+#define DEFAULT_CFE_MISSION_DS_SEND_HK_TOPICID       0xBC
+#define CFE_MISSION_DS_BACKLOG_PROBE_TOPICID         CFE_MISSION_DS_TIDVAL(BACKLOG_PROBE)
+#define DEFAULT_CFE_MISSION_DS_BACKLOG_PROBE_TOPICID 0xC0
 
 /**\}*/
 
@@ -42,12 +44,18 @@
  * \{
  */
 
-#define CFE_MISSION_DS_HK_TLM_TOPICID           CFE_MISSION_DS_TIDVAL(HK_TLM)
-#define DEFAULT_CFE_MISSION_DS_HK_TLM_TOPICID   0xB8
-#define CFE_MISSION_DS_DIAG_TLM_TOPICID         CFE_MISSION_DS_TIDVAL(DIAG_TLM)
-#define DEFAULT_CFE_MISSION_DS_DIAG_TLM_TOPICID 0xB9
-#define CFE_MISSION_DS_COMP_TLM_TOPICID         CFE_MISSION_DS_TIDVAL(COMP_TLM)
-#define DEFAULT_CFE_MISSION_DS_COMP_TLM_TOPICID 0xBA
+#define CFE_MISSION_DS_HK_TLM_TOPICID                 CFE_MISSION_DS_TIDVAL(HK_TLM)
+#define DEFAULT_CFE_MISSION_DS_HK_TLM_TOPICID         0xB8
+#define CFE_MISSION_DS_DIAG_TLM_TOPICID               CFE_MISSION_DS_TIDVAL(DIAG_TLM)
+#define DEFAULT_CFE_MISSION_DS_DIAG_TLM_TOPICID       0xB9
+#define CFE_MISSION_DS_COMP_TLM_TOPICID               CFE_MISSION_DS_TIDVAL(COMP_TLM)
+#define DEFAULT_CFE_MISSION_DS_COMP_TLM_TOPICID       0xBA
+#define CFE_MISSION_DS_STATS_TLM_TOPICID              CFE_MISSION_DS_TIDVAL(STATS_TLM)
+#define DEFAULT_CFE_MISSION_DS_STATS_TLM_TOPICID      0xBD
+#define CFE_MISSION_DS_DEST_STATS_TLM_TOPICID         CFE_MISSION_DS_TIDVAL(DEST_STATS_TLM)
+#define DEFAULT_CFE_MISSION_DS_DEST_STATS_TLM_TOPICID 0xBE
+#define CFE_MISSION_DS_MANIFEST_TLM_TOPICID           CFE_MISSION_DS_TIDVAL(MANIFEST_TLM)
+#define DEFAULT_CFE_MISSION_DS_MANIFEST_TLM_TOPICID   0xBF
 
 /**\}*/
 
@@ -37,6 +37,8 @@
 #include "ds_dispatch.h"
 #include "ds_cmds.h"
 #include "ds_file.h"
+#include "ds_extract.h"
+#include "ds_replay.h"
 #include "ds_table.h"
 #include "ds_eventids.h"
 #include "ds_msgdefs.h"
@@ -96,9 +98,22 @@ void DS_AppMain(void)
         CFE_ES_PerfLogExit(DS_APPMAIN_PERF_ID);
 
         /*
-        ** Wait for next Software Bus message...
+        ** Take the next Software Bus message without waiting...
         */
-        Result = CFE_SB_ReceiveBuffer(&BufPtr, DS_AppData.CmdPipe, DS_SB_TIMEOUT);
+        Result = CFE_SB_ReceiveBuffer(&BufPtr, DS_AppData.CmdPipe, CFE_SB_POLL);
+
+        if (Result == CFE_SB_NO_MESSAGE)
+        {
+            /*
+            ** Idle time - finish any flight recorder dumps...
+            */
+            DS_FileRecorderDrain(DS_RECORDER_DRAIN_ALL);
+
+            /*
+            ** Wait for next Software Bus message...
+            */
+            Result = CFE_SB_ReceiveBuffer(&BufPtr, DS_AppData.CmdPipe, DS_SB_TIMEOUT);
+        }
 
         /*
         ** Performance Log (start time counter)...
@@ -110,7 +125,18 @@ void DS_AppMain(void)
         */
         if (Result == CFE_SUCCESS)
         {
+            if (DS_STATS_TIMING == 1)
+            {
+                DS_AppData.ReceiveTime = DS_AppStatsTime();
+            }
+
+            DS_AppProbeBacklog();
             DS_AppPipe(BufPtr);
+
+            /*
+            ** Spread flight recorder dumps over the messages received...
+            */
+            DS_FileRecorderDrain(DS_RECORDER_DRAIN_PACKETS);
         }
         else if (Result == CFE_SB_TIME_OUT)
         {
@@ -122,6 +148,11 @@ void DS_AppMain(void)
              */
             DS_TableManageDestFile();
             DS_TableManageFilter();
+
+            /*
+            ** Post-trigger windows also end while no packets arrive...
+            */
+            DS_FileRecorderDrain(DS_RECORDER_DRAIN_ALL);
         }
         else
         {
@@ -184,15 +215,28 @@ CFE_Status_t DS_AppInitialize(void)
 
     DS_AppData.AppEnableState  = DS_DEF_ENABLE_STATE;
     DS_AppData.EnableMoveFiles = DS_MOVE_FILES;
+    DS_AppData.StorageBudget   = DS_STORAGE_BUDGET;
 
     /*
     ** Mark files as closed
     */
     for (i = 0; i < DS_DEST_FILE_CNT; i++)
     {
-        DS_AppData.FileStatus[i].FileHandle = OS_OBJECT_ID_UNDEFINED;
+        DS_AppData.FileStatus[i].FileHandle   = OS_OBJECT_ID_UNDEFINED;
+        DS_AppData.IndexStatus[i].IndexHandle = OS_OBJECT_ID_UNDEFINED;
+        DS_AppData.Manifest[i].Handle         = OS_OBJECT_ID_UNDEFINED;
     }
 
+    /*
+    ** Replay echo table has no mutex until packet replay is initialized...
+    */
+    DS_AppData.ReplayEcho.MutexId = OS_OBJECT_ID_UNDEFINED;
+
+    /*
+    ** Cache echo table is only used by the main task (no mutex)...
+    */
+    DS_AppData.CacheEcho.MutexId = OS_OBJECT_ID_UNDEFINED;
+
     /*
     ** Initialize interface to cFE Event Services...
     */
@@ -240,6 +284,20 @@ CFE_Status_t DS_AppInitialize(void)
         }
     }
 
+    /*
+    ** Subscribe to pipe backlog probes sent by DS to itself...
+    */
+    if (Result == CFE_SUCCESS)
+    {
+        Result = CFE_SB_Subscribe(CFE_SB_ValueToMsgId(DS_BACKLOG_PROBE_MID), DS_AppData.CmdPipe);
+
+        if (Result != CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(DS_INIT_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Unable to subscribe to backlog probes, err = 0x%08X", (unsigned int)Result);
+        }
+    }
+
     /*
     ** Initialize application tables...
     */
@@ -256,6 +314,22 @@ CFE_Status_t DS_AppInitialize(void)
         Result = DS_TableCreateCDS();
     }
 
+    /*
+    ** Start the file extraction child task...
+    */
+    if (Result == CFE_SUCCESS)
+    {
+        Result = DS_ExtractInit();
+    }
+
+    /*
+    ** Start the packet replay child task...
+    */
+    if (Result == CFE_SUCCESS)
+    {
+        Result = DS_ReplayInit();
+    }
+
     /*
     ** Generate application startup event message...
     */
@@ -292,6 +366,20 @@ void DS_AppStorePacket(CFE_SB_MsgId_t MessageID, const CFE_SB_Buffer_t *BufPtr)
         */
         DS_AppData.IgnoredPktCounter++;
     }
+    else if (DS_IsPacketEcho(&DS_AppData.ReplayEcho, MessageID, &BufPtr->Msg))
+    {
+        /*
+        ** Packets sent by the replay task are not stored again...
+        */
+        DS_AppData.IgnoredPktCounter++;
+    }
+    else if (DS_IsPacketEcho(&DS_AppData.CacheEcho, MessageID, &BufPtr->Msg))
+    {
+        /*
+        ** Packets sent from the latest-value cache are not stored again...
+        */
+        DS_AppData.IgnoredPktCounter++;
+    }
     else
     {
         /*
@@ -300,3 +388,197 @@ void DS_AppStorePacket(CFE_SB_MsgId_t MessageID, const CFE_SB_Buffer_t *BufPtr)
         DS_FileStorePacket(MessageID, BufPtr);
     }
 }
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Backpressure decimation level for a pipe backlog                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint8 DS_AppDecimationLevel(uint32 Backlog)
+{
+    uint32 Scaled    = Backlog * 100 * DS_DECIMATION_LEVELS;
+    uint32 Threshold = DS_APP_PIPE_DEPTH * DS_DECIMATION_THRESHOLD * DS_DECIMATION_LEVELS;
+    uint32 Step      = DS_APP_PIPE_DEPTH * (100 - DS_DECIMATION_THRESHOLD);
+    uint8  Level     = 0;
+
+    /*
+    ** Level 1 starts at the threshold percentage of the pipe depth and the
+    ** further levels are spaced evenly up to a full pipe (all values are
+    ** scaled by 100 * levels to stay in integers)...
+    */
+    while ((Level < DS_DECIMATION_LEVELS) && (Scaled >= Threshold))
+    {
+        Level++;
+        Threshold += Step;
+    }
+
+    return Level;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Count a received message and probe the pipe backlog if needed   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_AppProbeBacklog(void)
+{
+    DS_BacklogProbeCmd_t Probe;
+    CFE_Status_t         Status;
+
+    if (DS_AppData.BacklogProbePending)
+    {
+        DS_AppData.BacklogProbeCount++;
+
+        /*
+        ** The pipe never holds more than its depth ahead of the probe, so
+        ** a probe still missing now was dropped because the pipe was full...
+        */
+        if (DS_AppData.BacklogProbeCount > DS_APP_PIPE_DEPTH)
+        {
+            DS_AppData.BacklogProbePending = false;
+            DS_AppData.BacklogProbeCount   = 0;
+
+            DS_AppRaiseDecimation(DS_APP_PIPE_DEPTH);
+        }
+    }
+    else if (DS_DECIMATION_LEVELS > 0)
+    {
+        DS_AppData.BacklogProbeCount++;
+
+        /*
+        ** Probe once enough messages have arrived to fill the pipe to the
+        ** level 1 threshold -- the messages received ahead of the probe
+        ** are the backlog waiting in the pipe when it was sent...
+        */
+        if (DS_AppDecimationLevel(DS_AppData.BacklogProbeCount) > 0)
+        {
+            memset(&Probe, 0, sizeof(Probe));
+            CFE_MSG_Init(CFE_MSG_PTR(Probe.CommandHeader), CFE_SB_ValueToMsgId(DS_BACKLOG_PROBE_MID),
+                         sizeof(DS_BacklogProbeCmd_t));
+
+            Status = CFE_SB_TransmitMsg(CFE_MSG_PTR(Probe.CommandHeader), true);
+
+            DS_AppData.BacklogProbePending = (Status == CFE_SUCCESS);
+            DS_AppData.BacklogProbeCount   = 0;
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Record a pipe backlog and raise decimation level if needed      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_AppRaiseDecimation(uint32 Backlog)
+{
+    uint8 Level = DS_AppDecimationLevel(Backlog);
+
+    if (Backlog > DS_AppData.BacklogPeak)
+    {
+        DS_AppData.BacklogPeak = Backlog;
+    }
+
+    if (Level > DS_AppData.DecimationLevel)
+    {
+        CFE_EVS_SendEvent(DS_DECIMATION_RAISED_EID, CFE_EVS_EventType_INFORMATION,
+                          "Decimation level raised: level = %d -> %d, pipe backlog = %d of %d",
+                          (int)DS_AppData.DecimationLevel, (int)Level, (int)Backlog, (int)DS_APP_PIPE_DEPTH);
+
+        DS_AppData.DecimationLevel = Level;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Step decimation level down once the pipe backlog has cleared    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_AppLowerDecimation(void)
+{
+    uint8 Level = DS_AppDecimationLevel(DS_AppData.BacklogPeak);
+
+    /*
+    ** Lower one level per housekeeping cycle to avoid oscillating...
+    */
+    if (Level < DS_AppData.DecimationLevel)
+    {
+        CFE_EVS_SendEvent(DS_DECIMATION_LOWERED_EID, CFE_EVS_EventType_INFORMATION,
+                          "Decimation level lowered: level = %d -> %d, pipe backlog peak = %d of %d",
+                          (int)DS_AppData.DecimationLevel, (int)(DS_AppData.DecimationLevel - 1),
+                          (int)DS_AppData.BacklogPeak, (int)DS_APP_PIPE_DEPTH);
+
+        DS_AppData.DecimationLevel--;
+    }
+
+    /*
+    ** Start the next cycle with no backlog measured yet...
+    */
+    DS_AppData.BacklogPeak = 0;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Latency statistics timestamp                                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int64 DS_AppStatsTime(void)
+{
+    CFE_TIME_SysTime_t Met = CFE_TIME_GetMET();
+
+    /*
+    ** Mission elapsed time is not stepped by time corrections (wall clock is)...
+    */
+    return ((int64)Met.Seconds * 1000000) + CFE_TIME_Sub2MicroSecs(Met.Subseconds);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Record one latency statistics sample                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 DS_AppStatsRecord(DS_StageStats_t *StagePtr, int64 Elapsed)
+{
+    uint32 MicroSecs;
+    uint32 Bin = 0;
+
+    /*
+    ** MET may be set backwards between samples, cap at one hour...
+    */
+    if (Elapsed < 0)
+    {
+        MicroSecs = 0;
+    }
+    else if (Elapsed >= 3600000000)
+    {
+        MicroSecs = 3600000000U;
+    }
+    else
+    {
+        MicroSecs = (uint32)Elapsed;
+    }
+
+    /*
+    ** Bin number is the bit length of the sample in microseconds...
+    */
+    while ((Bin < (DS_STATS_HISTOGRAM_BINS - 1)) && ((MicroSecs >> Bin) != 0))
+    {
+        Bin++;
+    }
+
+    StagePtr->Count++;
+    StagePtr->TotalTime += MicroSecs;
+    StagePtr->Histogram[Bin]++;
+
+    if (MicroSecs > StagePtr->MaxTime)
+    {
+        StagePtr->MaxTime = MicroSecs;
+    }
+
+    return MicroSecs;
+}
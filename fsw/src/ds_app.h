@@ -32,6 +32,7 @@
 #include "ds_table.h"
 
 #include "ds_extern_typedefs.h"
+#include "ds_msgdefs.h"
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
@@ -49,22 +50,367 @@
 #define DS_SB_TIMEOUT       1000
 #define DS_SECS_PER_TIMEOUT (DS_SB_TIMEOUT / 1000)
 
+/**
+ * \brief Storage path performance log markers
+ *
+ * \par Description
+ *      Performance log entry and exit markers for the storage path.
+ *      The markers compile to nothing unless DS_DETAIL_PERF_LOG is
+ *      enabled, so they cost nothing in the default configuration.
+ */
+#if (DS_DETAIL_PERF_LOG == 1)
+#define DS_DETAIL_PERF_ENTRY(PerfId) CFE_ES_PerfLogEntry(PerfId)
+#define DS_DETAIL_PERF_EXIT(PerfId)  CFE_ES_PerfLogExit(PerfId)
+#else
+#define DS_DETAIL_PERF_ENTRY(PerfId) ((void)0)
+#define DS_DETAIL_PERF_EXIT(PerfId)  ((void)0)
+#endif
+
 /**
  * \brief Current state of destination files
  */
 typedef struct
 {
-    osal_id_t FileHandle;                       /**< \brief Current file handle */
-    uint32    FileAge;                          /**< \brief Current file age in seconds */
-    uint32    FileSize;                         /**< \brief Current file size in bytes */
-    uint32    FileGrowth;                       /**< \brief Current file growth in bytes (since HK) */
-    uint32    FileRate;                         /**< \brief File growth rate in bytes (at last HK) */
-    uint32    FileCount;                        /**< \brief Current file sequence count */
-    uint16    FileState;                        /**< \brief Current file enable/disable state */
-    uint16    Unused;                           /**< \brief Unused - structure padding */
-    char      FileName[DS_TOTAL_FNAME_BUFSIZE]; /**< \brief Current filename (path+base+seq+ext) */
+    osal_id_t          FileHandle;                       /**< \brief Current file handle */
+    uint32             FileAge;                          /**< \brief Current file age in seconds */
+    uint32             FileSize;                         /**< \brief Current file size in bytes */
+    uint32             FileGrowth;                       /**< \brief Current file growth in bytes (since HK) */
+    uint32             FileRate;                         /**< \brief File growth rate in bytes (at last HK) */
+    uint32             FileCount;                        /**< \brief Current file sequence count */
+    uint32             RingDataStart;                    /**< \brief Ring file offset of first packet byte */
+    uint32             RingTail;                         /**< \brief Ring file offset of oldest packet */
+    uint32             RingWrapOffset;                   /**< \brief Ring file end of data before last wrap */
+    uint32             RingWrapCount;                    /**< \brief Ring file count of wraps to data start */
+    uint16             FileState;                        /**< \brief Current file enable/disable state */
+    uint16             FileMode;                         /**< \brief File mode (linear vs ring) of open file */
+    uint16             CompressMode;                     /**< \brief Compression mode (none vs LZ) of open file */
+    uint16             RecordMode;                       /**< \brief Record mode (full vs delta) of open file */
+    uint32             LogicalSize;                      /**< \brief Current file size before compression (LZ only) */
+    bool               PayloadCrcActive;                 /**< \brief Payload CRC is accumulated for the manifest */
+    bool               ManifestListed;                   /**< \brief Closed file was appended to its manifest */
+    uint32             PayloadCrc;                       /**< \brief CRC of records written to the open file */
+    CFE_TIME_SysTime_t OpenTime;                         /**< \brief Open file creation time (manifest only) */
+    char               FileName[DS_TOTAL_FNAME_BUFSIZE]; /**< \brief Current filename (path+base+seq+ext) */
 } DS_AppFileStatus_t;
 
+/**
+ * \brief Packet boundaries read ahead of the writer in a ring file
+ *
+ * Bound holds the file offsets that follow each of the oldest packets,
+ * in file order, so the tail can be advanced without reading the file.
+ */
+typedef struct
+{
+    uint32 Count;                       /**< \brief Number of boundaries read */
+    uint32 Next;                        /**< \brief Index of next boundary not yet passed by the tail */
+    uint32 Bound[DS_RING_WALK_RECORDS]; /**< \brief File offsets that follow the oldest packets */
+} DS_FileRingWalk_t;
+
+/**
+ * \brief Sidecar index file record (follows #DS_FileIndexHeader_t)
+ */
+typedef struct
+{
+    uint32 FileOffset; /**< \brief Destination file offset of the indexed packet */
+    uint32 Seconds;    /**< \brief Packet time (seconds) */
+    uint32 Subseconds; /**< \brief Packet time (subseconds) */
+    uint32 MessageID;  /**< \brief Packet message ID value */
+} DS_FileIndexRecord_t;
+
+/**
+ * \brief Current state of sidecar index files
+ */
+typedef struct
+{
+    osal_id_t            IndexHandle;                      /**< \brief Current index file handle */
+    uint32               PktCount;                         /**< \brief Packets since last index record */
+    uint32               LastSeconds;                      /**< \brief Packet time of last index record */
+    uint32               RecordCount;                      /**< \brief Index records in current file */
+    uint32               BufferCount;                      /**< \brief Index records waiting to be written */
+    char                 FileName[DS_TOTAL_FNAME_BUFSIZE]; /**< \brief Current index filename */
+    DS_FileIndexRecord_t Buffer[DS_INDEX_BUFFER_RECORDS];  /**< \brief Index records waiting to be written */
+} DS_FileIndexStatus_t;
+
+/**
+ * \brief Summary trailer entry (one per message ID in the file)
+ */
+typedef struct
+{
+    uint32 MessageID;       /**< \brief Packet message ID value */
+    uint32 PacketCount;     /**< \brief Packets written with this message ID */
+    uint32 ByteCount;       /**< \brief Bytes written with this message ID */
+    uint32 SeqGapCount;     /**< \brief Sequence count discontinuities */
+    uint32 FirstSeconds;    /**< \brief Packet time of first packet (seconds) */
+    uint32 FirstSubseconds; /**< \brief Packet time of first packet (subseconds) */
+    uint32 LastSeconds;     /**< \brief Packet time of last packet (seconds) */
+    uint32 LastSubseconds;  /**< \brief Packet time of last packet (subseconds) */
+} DS_FileTrailerEntry_t;
+
+/**
+ * \brief Current state of summary trailers
+ */
+typedef struct
+{
+    bool                    Active;       /**< \brief Trailer is accumulated for the open file */
+    uint32                  EntryCount;   /**< \brief Message IDs summarized */
+    uint32                  OtherPackets; /**< \brief Packets not summarized (entries full) */
+    uint32                  OtherBytes;   /**< \brief Bytes not summarized (entries full) */
+    CFE_MSG_SequenceCount_t LastSeqCount[DS_FILE_TRAILER_ENTRIES]; /**< \brief Last sequence count per entry */
+    DS_FileTrailerEntry_t   Entry[DS_FILE_TRAILER_ENTRIES];        /**< \brief Per message ID statistics */
+} DS_FileTrailerStatus_t;
+
+/**
+ * \brief Compressed block header (precedes each block in a compressed file)
+ */
+typedef struct
+{
+    uint32 Magic;      /**< \brief Always #DS_FILE_BLOCK_MAGIC */
+    uint32 RawSize;    /**< \brief Packet bytes in the block before compression */
+    uint32 StoredSize; /**< \brief Block bytes that follow (equals RawSize if stored uncompressed) */
+    uint32 Crc;        /**< \brief CRC of the packet bytes before compression */
+} DS_FileBlockHeader_t;
+
+/**
+ * \brief Current state of compressed destination files
+ */
+typedef struct
+{
+    uint32 BlockCount;                        /**< \brief Packet bytes buffered for the next block */
+    uint32 Block[DS_COMPRESS_BLOCK_SIZE / 4]; /**< \brief Packet bytes buffered (32-bit aligned) */
+} DS_FileCompressStatus_t;
+
+/**
+ * \brief Delta record reference (last full header of one packet stream)
+ */
+typedef struct
+{
+    uint16                    StreamId;   /**< \brief First two packet bytes (CCSDS stream ID) */
+    uint16                    DeltaCount; /**< \brief Delta records since the last full packet */
+    uint32                    PacketSize; /**< \brief Packet length in bytes (0 = not remembered) */
+    CFE_MSG_TelemetryHeader_t Header;     /**< \brief Header of the last packet of the stream */
+} DS_FileRecordRef_t;
+
+/**
+ * \brief Current state of delta encoded destination files
+ */
+typedef struct
+{
+    uint32             NextRef;                   /**< \brief Reference replaced by the next new stream */
+    DS_FileRecordRef_t Ref[DS_RECORD_REFERENCES]; /**< \brief Remembered packet streams */
+} DS_FileRecordStatus_t;
+
+/**
+ * \brief Current state of destination subdirectory shards
+ *
+ * The known directories remember the last shard directory created (or
+ * found) so that the directories are only created when the shard changes.
+ */
+typedef struct
+{
+    char ShardName[DS_TOTAL_FNAME_BUFSIZE];  /**< \brief Shard of the current file (relative, empty = none) */
+    char CreatedDir[DS_TOTAL_FNAME_BUFSIZE]; /**< \brief Last shard directory known to exist under the path */
+    char MovedDir[DS_TOTAL_FNAME_BUFSIZE];   /**< \brief Last shard directory known to exist under the move dir */
+} DS_FileShardStatus_t;
+
+/**
+ * \brief Current state of change-only packet filters
+ */
+typedef struct
+{
+    uint32 Hash;      /**< \brief Content hash of the last stored packet */
+    uint16 Unchanged; /**< \brief Unchanged packets filtered since the last stored packet */
+    bool   Stored;    /**< \brief A packet has been stored since the filter was reset */
+} DS_FilterChangeStatus_t;
+
+/**
+ * \brief Current state of time-window packet filters
+ */
+typedef struct
+{
+    uint64 LastStored; /**< \brief Timestamp of the last stored packet (microseconds) */
+    bool   Stored;     /**< \brief A packet has been stored since the filter was reset */
+} DS_FilterWindowStatus_t;
+
+/**
+ * \brief Packet predicate term compiled into a range test
+ *
+ * Every comparison operator is reduced to "(field & Mask) - Low <= Span",
+ * optionally inverted, so evaluation needs no operator dispatch.
+ */
+typedef struct
+{
+    uint16 Offset; /**< \brief Byte offset of field from start of packet */
+    uint16 End;    /**< \brief Packet length needed to read the field */
+    uint8  Width;  /**< \brief Field width in bytes */
+    bool   Invert; /**< \brief Term matches when the field is outside the range */
+    uint32 Mask;   /**< \brief Field bits to compare */
+    uint32 Low;    /**< \brief Lowest masked field value in range */
+    uint32 Span;   /**< \brief Highest minus lowest masked field value in range */
+} DS_PredicateCode_t;
+
+/**
+ * \brief Packet predicate compiled from a filter table entry
+ */
+typedef struct
+{
+    uint16             TermCount;                /**< \brief Number of used terms (0 = match all) */
+    bool               MatchAny;                 /**< \brief Terms are combined with OR (else AND) */
+    DS_PredicateCode_t Term[DS_PREDICATE_TERMS]; /**< \brief Used terms in table order */
+} DS_PacketPredicate_t;
+
+/**
+ * \brief Current state of packet and byte rate limits
+ *
+ * Token counts are in units of 1/65536 packet (or byte), so that each
+ * 1/65536 second tick adds exactly the configured rate.
+ */
+typedef struct
+{
+    uint64 LastTicks;    /**< \brief Time of last refill (1/65536 seconds) */
+    uint64 PacketTokens; /**< \brief Packets that may pass now (1/65536 packets) */
+    uint64 ByteTokens;   /**< \brief Bytes that may pass now (1/65536 bytes) */
+} DS_RateLimitStatus_t;
+
+/**
+ * \brief Current state of packet replay
+ */
+typedef struct
+{
+    osal_id_t          FileHandle;     /**< \brief Handle of file being replayed */
+    uint32             FileSize;       /**< \brief Size of file being replayed */
+    uint32             DataStart;      /**< \brief File offset of first packet */
+    uint32             DataEnd;        /**< \brief File offset following last packet */
+    uint32             Offset;         /**< \brief File offset of next packet (first unsent buffer byte) */
+    uint32             BufferCount;    /**< \brief Bytes read into the buffer */
+    uint32             BufferPosition; /**< \brief Buffer offset of next packet */
+    uint32             SkipSeconds;    /**< \brief Packets before this time are skipped (after a seek) */
+    uint32             BurstCount;     /**< \brief Packets sent without a delay */
+    bool               LastTimeValid;  /**< \brief Pacing has a previous packet time */
+    CFE_TIME_SysTime_t LastTime;       /**< \brief Packet time of previous packet sent */
+
+    uint32 Buffer[DS_REPLAY_BUFFER_SIZE / 4]; /**< \brief Read ahead buffer (32-bit aligned) */
+} DS_ReplayStatus_t;
+
+/**
+ * \brief Packet sent by DS that will come back through the DS pipe
+ */
+typedef struct
+{
+    CFE_SB_MsgId_t          MessageID;     /**< \brief Message ID of sent packet */
+    CFE_MSG_SequenceCount_t SequenceCount; /**< \brief Sequence count of sent packet */
+    CFE_MSG_Size_t          PacketLength;  /**< \brief Length of sent packet */
+    uint32                  PacketCrc;     /**< \brief CRC of sent packet (headers included) */
+    uint32                  SentSeconds;   /**< \brief Mission elapsed time packet was sent */
+    bool                    Pending;       /**< \brief Packet has not come back yet */
+} DS_EchoEntry_t;
+
+/**
+ * \brief Packets sent by DS that must not be stored again (echoes)
+ *
+ * Entries are written round robin by the task that sends the packets and
+ * matched, expired (and cleared) by the DS main task before packets are
+ * stored.  A table shared by two tasks is only accessed with its mutex held.
+ */
+typedef struct
+{
+    osal_id_t      MutexId;              /**< \brief Table mutex (undefined when used by one task) */
+    uint32         SentCount;            /**< \brief Packets recorded */
+    uint32         MatchCount;           /**< \brief Packets matched, expired or overwritten */
+    DS_EchoEntry_t Entry[DS_ECHO_DEPTH]; /**< \brief Recently sent packets */
+} DS_EchoTable_t;
+
+/**
+ * \brief Closed destination file remembered for storage budget eviction
+ */
+typedef struct
+{
+    uint32 FileSize;                             /**< \brief File size in bytes when closed */
+    uint32 IndexSize;                            /**< \brief Sidecar index file size in bytes (0 = no index) */
+    uint32 CloseSequence;                        /**< \brief Global close order (smaller is older) */
+    char   FileName[DS_TOTAL_FNAME_BUFSIZE];     /**< \brief Filename after close (and move) */
+    char   ManifestName[DS_TOTAL_FNAME_BUFSIZE]; /**< \brief Manifest listing the file (empty = none) */
+} DS_ClosedFile_t;
+
+/**
+ * \brief Closed files remembered for one destination (oldest first)
+ */
+typedef struct
+{
+    uint32          Oldest;                       /**< \brief Index of oldest remembered file */
+    uint32          Count;                        /**< \brief Number of remembered files */
+    uint64          TotalSize;                    /**< \brief Sum of remembered file (and index) sizes in bytes */
+    DS_ClosedFile_t File[DS_CLOSED_FILE_HISTORY]; /**< \brief Remembered files (circular) */
+} DS_ClosedFileList_t;
+
+/**
+ * \brief Closed file manifest kept open for appends
+ */
+typedef struct
+{
+    osal_id_t Handle;                       /**< \brief Open manifest handle (undefined = closed) */
+    char      Name[DS_TOTAL_FNAME_BUFSIZE]; /**< \brief Manifest filename */
+} DS_ManifestStatus_t;
+
+/**
+ * \brief Flight recorder record header (precedes each held packet)
+ *
+ * A header with a zero PacketLength marks the unused end of the buffer,
+ * the next record starts at the beginning of the buffer.
+ */
+typedef struct
+{
+    uint16 PacketLength;   /**< \brief Held packet length in bytes (0 = wrap to buffer start) */
+    uint16 MaxStoreLength; /**< \brief Filter store length limit applied when the packet is written */
+} DS_RecorderRecord_t;
+
+/**
+ * \brief Current state of a flight recorder
+ *
+ * The buffer is a single producer, single consumer ring.  Head is only
+ * moved by the store path.  Tail is moved by the store path while the
+ * recorder is holding (to overwrite the oldest packets) and only by the
+ * dump path while it is dumping, so neither side waits for the other.
+ * The ring is empty when Head equals Tail.
+ */
+typedef struct
+{
+    uint16         State;          /**< \brief Recorder state (off, holding or dumping) */
+    uint16         FileTableIndex; /**< \brief Destination file the recorder holds packets for */
+    uint16         PostSeconds;    /**< \brief Seconds of packets to keep dumping after a trigger */
+    bool           PostDone;       /**< \brief Post-trigger window has ended, DumpEnd is valid */
+    CFE_SB_MsgId_t TriggerMsgID;   /**< \brief Message ID that triggers a dump (invalid = none) */
+    uint32         TriggerSeconds; /**< \brief Spacecraft time (MET seconds) of the current trigger */
+    uint32         Head;           /**< \brief Buffer offset of the next record to store */
+    uint32         Tail;           /**< \brief Buffer offset of the oldest held record */
+    uint32         DumpEnd;        /**< \brief Buffer offset following the last record to dump */
+    uint32         DumpCount;      /**< \brief Packets written by the current (or last) dump */
+
+    uint32 Buffer[DS_RECORDER_BUFFER_SIZE / 4]; /**< \brief Held packet records (32-bit aligned) */
+} DS_RecorderStatus_t;
+
+/**
+ * \brief Latest-value cache entries reserved in DS_AppData
+ *
+ * One unused entry is reserved when the cache is disabled.
+ */
+#define DS_CACHE_RESERVED_ENTRIES ((DS_CACHE_ENTRIES == 0) ? 1 : DS_CACHE_ENTRIES)
+
+/**
+ * \brief Latest-value cache entry (last packet of one Message ID)
+ *
+ * Entries of Message IDs removed from the packet filter table are freed
+ * when the filter hash table is rebuilt.
+ */
+typedef struct
+{
+    CFE_SB_MsgId_t MessageID;    /**< \brief Message ID of the cached packet */
+    uint32         PacketLength; /**< \brief Cached packet length in bytes (0 = empty) */
+    uint16         Next;         /**< \brief Next entry with the same hash table index (index + 1, 0 = none) */
+    uint16         Spare;        /**< \brief Structure padding */
+
+    uint32 Packet[DS_CACHE_ENTRY_SIZE / 4]; /**< \brief Cached packet (32-bit aligned) */
+} DS_CacheEntry_t;
+
 /**
  *  \brief DS global data structure definition
  */
@@ -87,7 +433,7 @@ typedef struct
     uint8 FilterTblLoadCounter; /**< \brief Count of packet filter table loads */
     uint8 FilterTblErrCounter;  /**< \brief Count of failed attempts to get table data pointer */
     uint8 AppEnableState;       /**< \brief Application enable/disable state */
-    uint8 Spare8;               /**< \brief Structure alignment padding */
+    uint8 DecimationLevel;      /**< \brief Backpressure decimation level (0 = nominal) */
 
     uint16 FileWriteCounter;     /**< \brief Count of good destination file writes */
     uint16 FileWriteErrCounter;  /**< \brief Count of bad destination file writes */
@@ -98,13 +444,104 @@ typedef struct
     uint32 IgnoredPktCounter;  /**< \brief Count of packets discarded (pkt has no filter) */
     uint32 FilteredPktCounter; /**< \brief Count of packets discarded (failed filter test) */
     uint32 PassedPktCounter;   /**< \brief Count of packets that passed filter test */
+    uint32 RateDropPktCounter; /**< \brief Count of packets discarded (over rate limit) */
+
+    bool   BacklogProbePending; /**< \brief Backlog probe sent to the DS pipe and not yet received */
+    uint32 BacklogProbeCount;   /**< \brief Messages received since the last backlog probe was sent or received */
+    uint32 BacklogPeak;         /**< \brief Largest pipe backlog measured since the last housekeeping request */
+
+    DS_AppFileStatus_t     FileStatus[DS_DEST_FILE_CNT];    /**< \brief Current state of destination files */
+    DS_FileRingWalk_t      RingWalk[DS_DEST_FILE_CNT];      /**< \brief Ring file packet boundaries read ahead */
+    DS_FileIndexStatus_t   IndexStatus[DS_DEST_FILE_CNT];   /**< \brief Current state of sidecar index files */
+    DS_FileTrailerStatus_t TrailerStatus[DS_DEST_FILE_CNT]; /**< \brief Current state of summary trailers */
+
+    uint32 RingBuffer[DS_RING_BUFFER_SIZE / 4]; /**< \brief Ring file header read and fill buffer (32-bit aligned) */
+
+    DS_FileCompressStatus_t CompressStatus[DS_DEST_FILE_CNT]; /**< \brief Current state of compressed files */
+
+    uint32 CompressRawBytes;  /**< \brief Packet bytes written to compressed files */
+    uint32 CompressFileBytes; /**< \brief Block bytes written to compressed files */
+
+    uint16 CompressHash[1 << DS_COMPRESS_HASH_BITS]; /**< \brief Compressor match finder (block offset + 1) */
+
+    uint32 CompressBuffer[(sizeof(DS_FileBlockHeader_t) + DS_COMPRESS_BLOCK_SIZE) / 4]; /**< \brief Block to write */
+
+    DS_FileRecordStatus_t RecordStatus[DS_DEST_FILE_CNT]; /**< \brief Current state of delta encoded files */
+
+    DS_FileShardStatus_t ShardStatus[DS_DEST_FILE_CNT]; /**< \brief Current state of subdirectory shards */
+
+    uint32 RecordBuffer[DS_RECORD_BUFFER_SIZE / 4]; /**< \brief Delta record to write (32-bit aligned) */
 
-    DS_AppFileStatus_t FileStatus[DS_DEST_FILE_CNT]; /**< \brief Current state of destination files */
+    uint32 TruncateBuffer[(DS_TRUNCATE_MAX_LENGTH / 4) + 1]; /**< \brief Truncated record (prefix and packet bytes) */
+
+    DS_FilterChangeStatus_t FilterChange[DS_PACKETS_IN_FILTER_TABLE][DS_FILTERS_PER_PACKET]; /**< \brief Change state */
+    DS_FilterWindowStatus_t FilterWindow[DS_PACKETS_IN_FILTER_TABLE][DS_FILTERS_PER_PACKET]; /**< \brief Window state */
+
+    DS_PacketPredicate_t FilterPredicate[DS_PACKETS_IN_FILTER_TABLE]; /**< \brief Compiled payload predicates */
+
+    DS_RateLimitStatus_t FilterRate[DS_PACKETS_IN_FILTER_TABLE]; /**< \brief Rate limit state for each message ID */
+    DS_RateLimitStatus_t DestRate[DS_DEST_FILE_CNT];             /**< \brief Rate limit state for each destination */
 
     DS_HashLink_t  HashLinks[DS_PACKETS_IN_FILTER_TABLE]; /**< \brief Hash table linked list elements */
     DS_HashLink_t *HashTable[DS_HASH_TABLE_ENTRIES];      /**< \brief Each hash table entry is a linked list */
 
+    DS_HashLink_t  WildcardLinks[DS_WILDCARD_MIDS];      /**< \brief Expanded wildcard entry linked list elements */
+    DS_HashLink_t *WildcardTable[DS_HASH_TABLE_ENTRIES]; /**< \brief Wildcard hash table (searched after exact) */
+    uint16         WildcardCount;                        /**< \brief Number of used wildcard linked list elements */
+
     uint8 EnableMoveFiles; /**< \brief Whether to move files to downlink directory after close */
+
+    DS_ClosedFileList_t ClosedFiles[DS_DEST_FILE_CNT]; /**< \brief Closed files tracked for storage budget */
+
+    uint64 StorageBudget;      /**< \brief Global storage budget in bytes (0 = no limit) */
+    uint64 ClosedFileBytes;    /**< \brief Sum of closed file sizes tracked for all destinations */
+    uint32 CloseSequence;      /**< \brief Count of closed files (orders evictions across destinations) */
+    uint32 EvictedFileCounter; /**< \brief Count of closed files deleted to stay within storage budget */
+
+    CFE_ES_TaskId_t          ExtractTaskId;       /**< \brief File extraction child task ID */
+    osal_id_t                ExtractSemaphore;    /**< \brief Signals the child task to start an extraction */
+    DS_ExtractFile_Payload_t ExtractRequest;      /**< \brief Arguments of the current (or last) extraction */
+    uint16                   ExtractState;        /**< \brief File extraction state (idle or active) */
+    uint16                   ExtractErrCounter;   /**< \brief Count of extractions that failed after being started */
+    uint32                   ExtractBytesScanned; /**< \brief Source bytes scanned by current (or last) extraction */
+    uint32                   ExtractPacketCount;  /**< \brief Packets written by current (or last) extraction */
+
+    uint32 ExtractBuffer[DS_EXTRACT_BUFFER_SIZE / 4]; /**< \brief Source file read buffer (32-bit aligned) */
+
+    CFE_ES_TaskId_t   ReplayTaskId;                           /**< \brief Packet replay child task ID */
+    osal_id_t         ReplaySemaphore;                        /**< \brief Signals the child task to start a replay */
+    char              ReplayFilename[DS_TOTAL_FNAME_BUFSIZE]; /**< \brief File of current (or last) replay */
+    uint16            ReplayRate;                             /**< \brief Rate multiplier of current replay */
+    uint16            ReplayState;                            /**< \brief Packet replay state (idle, active, paused) */
+    uint16            ReplayErrCounter;                       /**< \brief Count of replays that failed after start */
+    bool              ReplayStopPending;                      /**< \brief Stop command not yet seen by child task */
+    bool              ReplaySeekPending;                      /**< \brief Seek command not yet seen by child task */
+    bool              ReplayPauseRequested;                   /**< \brief Pause or resume for child task to apply */
+    uint32            ReplaySeekSeconds;                      /**< \brief Packet time of pending seek */
+    uint32            ReplayPacketCount;                      /**< \brief Packets sent by current (or last) replay */
+    DS_ReplayStatus_t ReplayStatus;                           /**< \brief Replay child task working state */
+    DS_EchoTable_t    ReplayEcho;                             /**< \brief Replayed packets not yet back in the pipe */
+
+    DS_StatsTlm_Payload_t Stats;       /**< \brief Packet storage path latency statistics */
+    int64                 ReceiveTime; /**< \brief Time last packet was taken from the pipe (0 = unknown) */
+
+    DS_DestStats_t DestStats[DS_DEST_FILE_CNT]; /**< \brief Input/output statistics of destination files */
+    uint16         DestStatsHkCount;            /**< \brief Housekeeping cycles since destination statistics sent */
+
+    DS_RecorderStatus_t Recorder[DS_RECORDER_CNT];      /**< \brief Flight recorders (buffers reserved at startup) */
+    uint16              DestRecorder[DS_DEST_FILE_CNT]; /**< \brief Recorder of each destination (index + 1) */
+    uint16              RecorderTrigCounter;            /**< \brief Count of flight recorder dumps triggered */
+    uint16              RecorderDropCounter;            /**< \brief Count of packets lost by flight recorders */
+
+    DS_CacheEntry_t Cache[DS_CACHE_RESERVED_ENTRIES]; /**< \brief Latest-value cache (reserved at startup) */
+    uint16          CacheHash[DS_HASH_TABLE_ENTRIES]; /**< \brief First cache entry of each hash index (index + 1) */
+    uint16          CacheCount;                       /**< \brief Number of used latest-value cache entries */
+    uint16          CacheOverflowCounter;             /**< \brief Count of packets not cached (no free entry) */
+    DS_EchoTable_t  CacheEcho;                        /**< \brief Cached packets sent, not yet back in the pipe */
+
+    DS_ManifestStatus_t Manifest[DS_DEST_FILE_CNT]; /**< \brief Open manifests (at most one handle per file) */
+    uint32              ManifestCounter;            /**< \brief Count of records appended to closed file manifests */
+    uint32              ManifestErrCounter;         /**< \brief Count of closed file manifest create and write errors */
 } DS_AppData_t;
 
 /** \brief DS global data structure reference */
@@ -152,9 +589,11 @@ CFE_Status_t DS_AppInitialize(void);
  *  \brief Application packet storage pre-processor
  *
  *  \par Description
- *       This function verifies that DS storage is enabled and that
- *       both DS tables (filter and file) are loaded before calling
- *       the file storage function (#DS_FileStorePacket).
+ *       This function verifies that DS storage is enabled, that
+ *       both DS tables (filter and file) are loaded and that the
+ *       packet was not sent by DS itself (replayed or from the
+ *       latest-value cache) before calling the file storage
+ *       function (#DS_FileStorePacket).
  *
  *  \par Assumptions, External Events, and Notes:
  *       (none)
@@ -166,4 +605,111 @@ CFE_Status_t DS_AppInitialize(void);
  */
 void DS_AppStorePacket(CFE_SB_MsgId_t MessageID, const CFE_SB_Buffer_t *BufPtr);
 
+/**
+ *  \brief Backpressure decimation level for a pipe backlog
+ *
+ *  \par Description
+ *       Returns the decimation level that corresponds to a number of
+ *       messages waiting in the DS pipe.  Level 1 starts at
+ *       #DS_DECIMATION_THRESHOLD percent of #DS_APP_PIPE_DEPTH and the
+ *       further levels, up to #DS_DECIMATION_LEVELS, are spaced evenly
+ *       between that threshold and a full pipe.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The backlog is never more than #DS_APP_PIPE_DEPTH.
+ *
+ *  \param[in] Backlog Messages waiting in the DS pipe
+ *
+ *  \return Decimation level (0 = nominal)
+ */
+uint8 DS_AppDecimationLevel(uint32 Backlog);
+
+/**
+ *  \brief Probe the DS pipe backlog
+ *
+ *  \par Description
+ *       Called for each message received from the DS pipe.  Once enough
+ *       messages have been received to fill the pipe to the level 1
+ *       threshold, DS sends a #DS_BACKLOG_PROBE_MID message to its own
+ *       pipe.  The messages received ahead of the probe are the backlog
+ *       that was waiting when it was sent (see #DS_BacklogProbeCmd).  A
+ *       probe that is still missing after a full pipe of messages was
+ *       dropped by a full pipe and counts as a backlog of
+ *       #DS_APP_PIPE_DEPTH.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only one probe is sent at a time, so probes add at most one
+ *       message per level 1 threshold of messages to the pipe.
+ */
+void DS_AppProbeBacklog(void);
+
+/**
+ *  \brief Raise backpressure decimation level
+ *
+ *  \par Description
+ *       Called for each pipe backlog measured by a probe.  Records the
+ *       peak backlog and immediately raises the decimation level if the
+ *       backlog calls for a higher level than the current one.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] Backlog Messages waiting in the DS pipe
+ *
+ *  \sa #DS_AppProbeBacklog
+ */
+void DS_AppRaiseDecimation(uint32 Backlog);
+
+/**
+ *  \brief Latency statistics timestamp
+ *
+ *  \par Description
+ *       Returns the current mission elapsed time (MET) in microseconds.
+ *       MET counts from the PSP timebase and, unlike the OS local time,
+ *       is not stepped when the spacecraft or host clock is corrected,
+ *       so intervals between two readings are monotonic.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only called when #DS_STATS_TIMING is enabled.  Only a ground
+ *       command setting the MET may make an interval negative.
+ *
+ *  \return Current time in microseconds
+ *
+ *  \sa #DS_AppStatsRecord
+ */
+int64 DS_AppStatsTime(void);
+
+/**
+ *  \brief Record one latency statistics sample
+ *
+ *  \par Description
+ *       Adds an elapsed time to the sample count, maximum, total and
+ *       log2 histogram of one stage of the packet storage path.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Negative elapsed times (MET was set backwards) are
+ *       recorded as zero and times of an hour or more as an hour.
+ *
+ *  \param[in] StagePtr Pointer to statistics of the stage
+ *  \param[in] Elapsed  Elapsed time in microseconds
+ *
+ *  \return Sample in microseconds
+ *
+ *  \sa #DS_AppStatsTime, #DS_StageStats_t
+ */
+uint32 DS_AppStatsRecord(DS_StageStats_t *StagePtr, int64 Elapsed);
+
+/**
+ *  \brief Lower backpressure decimation level
+ *
+ *  \par Description
+ *       Called once per housekeeping cycle.  Steps the decimation
+ *       level down by one if the largest pipe backlog measured since
+ *       the previous call no longer calls for the current level.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ */
+void DS_AppLowerDecimation(void);
+
 #endif
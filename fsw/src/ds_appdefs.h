@@ -47,4 +47,17 @@
 #define DS_FILE_HEADER_NONE 0 /**< \brief File header type is NONE */
 #define DS_FILE_HEADER_CFE  1 /**< \brief File header type is CFE */
 
+#define DS_EXTRACT_IDLE   0 /**< \brief No file extraction in progress */
+#define DS_EXTRACT_ACTIVE 1 /**< \brief File extraction in progress */
+
+#define DS_REPLAY_IDLE   0 /**< \brief No packet replay in progress */
+#define DS_REPLAY_ACTIVE 1 /**< \brief Packet replay in progress */
+#define DS_REPLAY_PAUSED 2 /**< \brief Packet replay paused */
+
+#define DS_RECORDER_OFF     0 /**< \brief Flight recorder disabled */
+#define DS_RECORDER_HOLDING 1 /**< \brief Flight recorder holding packets in memory */
+#define DS_RECORDER_DUMPING 2 /**< \brief Flight recorder writing held packets to its destination */
+
+#define DS_RECORDER_DRAIN_ALL 0xFFFFFFFF /**< \brief Write every held packet that is due */
+
 #endif
@@ -38,6 +38,7 @@
 #include "ds_version.h"
 
 #include <stdio.h>
+#include <string.h>
 
 /**
  * \brief Internal Macro to access the internal payload structure of a message
@@ -87,6 +88,7 @@ CFE_Status_t DS_ResetCountersCmd(const DS_ResetCountersCmd_t *BufPtr)
     DS_AppData.IgnoredPktCounter  = 0;
     DS_AppData.FilteredPktCounter = 0;
     DS_AppData.PassedPktCounter   = 0;
+    DS_AppData.RateDropPktCounter = 0;
 
     /*
     ** Reset file I/O counters...
@@ -95,6 +97,16 @@ CFE_Status_t DS_ResetCountersCmd(const DS_ResetCountersCmd_t *BufPtr)
     DS_AppData.FileWriteErrCounter  = 0;
     DS_AppData.FileUpdateCounter    = 0;
     DS_AppData.FileUpdateErrCounter = 0;
+    DS_AppData.EvictedFileCounter   = 0;
+    DS_AppData.ExtractErrCounter    = 0;
+    DS_AppData.ReplayErrCounter     = 0;
+    DS_AppData.CompressRawBytes     = 0;
+    DS_AppData.CompressFileBytes    = 0;
+    DS_AppData.RecorderTrigCounter  = 0;
+    DS_AppData.RecorderDropCounter  = 0;
+    DS_AppData.CacheOverflowCounter = 0;
+    DS_AppData.ManifestCounter      = 0;
+    DS_AppData.ManifestErrCounter   = 0;
 
     /*
     ** Reset configuration table counters...
@@ -104,6 +116,12 @@ CFE_Status_t DS_ResetCountersCmd(const DS_ResetCountersCmd_t *BufPtr)
     DS_AppData.FilterTblLoadCounter = 0;
     DS_AppData.FilterTblErrCounter  = 0;
 
+    /*
+    ** Reset latency and destination statistics...
+    */
+    memset(&DS_AppData.Stats, 0, sizeof(DS_AppData.Stats));
+    memset(DS_AppData.DestStats, 0, sizeof(DS_AppData.DestStats));
+
     CFE_EVS_SendEvent(DS_RESET_INF_EID, CFE_EVS_EventType_INFORMATION, "Reset counters command");
 
     return CFE_SUCCESS;
@@ -232,6 +250,14 @@ CFE_Status_t DS_SetFilterFileCmd(const DS_SetFilterFileCmd_t *BufPtr)
 
             pFilterParms->FileTableIndex = DS_FilterFileCmd->FileTableIndex;
 
+            /*
+            ** Change-only and time-window filters start over with the new setting...
+            */
+            memset(&DS_AppData.FilterChange[FilterTableIndex][DS_FilterFileCmd->FilterParmsIndex], 0,
+                   sizeof(DS_FilterChangeStatus_t));
+            memset(&DS_AppData.FilterWindow[FilterTableIndex][DS_FilterFileCmd->FilterParmsIndex], 0,
+                   sizeof(DS_FilterWindowStatus_t));
+
             /*
             ** Notify cFE that we have modified the table data...
             */
@@ -287,7 +313,7 @@ CFE_Status_t DS_SetFilterTypeCmd(const DS_SetFilterTypeCmd_t *BufPtr)
                           "Invalid FILTER TYPE command arg: filter parameters index = %d",
                           DS_FilterTypeCmd->FilterParmsIndex);
     }
-    else if (DS_TableVerifyType(DS_FilterTypeCmd->FilterType) == false)
+    else if (DS_TableVerifyFilterType(DS_FilterTypeCmd->FilterType) == false)
     {
         /*
         ** Invalid packet filter filename type...
@@ -335,6 +361,14 @@ CFE_Status_t DS_SetFilterTypeCmd(const DS_SetFilterTypeCmd_t *BufPtr)
 
             pFilterParms->FilterType = DS_FilterTypeCmd->FilterType;
 
+            /*
+            ** Change-only and time-window filters start over with the new setting...
+            */
+            memset(&DS_AppData.FilterChange[FilterTableIndex][DS_FilterTypeCmd->FilterParmsIndex], 0,
+                   sizeof(DS_FilterChangeStatus_t));
+            memset(&DS_AppData.FilterWindow[FilterTableIndex][DS_FilterTypeCmd->FilterParmsIndex], 0,
+                   sizeof(DS_FilterWindowStatus_t));
+
             /*
             ** Notify cFE that we have modified the table data...
             */
@@ -442,6 +476,14 @@ CFE_Status_t DS_SetFilterParmsCmd(const DS_SetFilterParmsCmd_t *BufPtr)
             pFilterParms->Algorithm_X = DS_FilterParmsCmd->Algorithm_X;
             pFilterParms->Algorithm_O = DS_FilterParmsCmd->Algorithm_O;
 
+            /*
+            ** Change-only and time-window filters start over with the new setting...
+            */
+            memset(&DS_AppData.FilterChange[FilterTableIndex][DS_FilterParmsCmd->FilterParmsIndex], 0,
+                   sizeof(DS_FilterChangeStatus_t));
+            memset(&DS_AppData.FilterWindow[FilterTableIndex][DS_FilterParmsCmd->FilterParmsIndex], 0,
+                   sizeof(DS_FilterWindowStatus_t));
+
             /*
             ** Notify cFE that we have modified the table data...
             */
@@ -1094,6 +1136,11 @@ CFE_Status_t DS_GetFileInfoCmd(const DS_GetFileInfoCmd_t *BufPtr)
         */
         FileInfoPtr->SequenceCount = DS_AppData.FileStatus[i].FileCount;
 
+        /*
+        ** Set file size before compression...
+        */
+        FileInfoPtr->LogicalSize = DS_FileLogicalSize(&DS_AppData.FileStatus[i]);
+
         /*
         ** Set file enable/disable state...
         */
@@ -1133,6 +1180,26 @@ CFE_Status_t DS_GetFileInfoCmd(const DS_GetFileInfoCmd_t *BufPtr)
     return CFE_SUCCESS;
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Get destination statistics packet                               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+CFE_Status_t DS_GetDestStatsCmd(const DS_GetDestStatsCmd_t *BufPtr)
+{
+    /*
+    ** Create and send a destination statistics packet...
+    */
+    DS_AppData.CmdAcceptedCounter++;
+
+    CFE_EVS_SendEvent(DS_GET_DEST_STATS_CMD_EID, CFE_EVS_EventType_DEBUG, "GET DEST STATS command");
+
+    DS_FileTransmitDestStats();
+
+    return CFE_SUCCESS;
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Add message ID to packet filter table                           */
@@ -1199,7 +1266,8 @@ CFE_Status_t DS_AddMidCmd(const DS_AddMidCmd_t *BufPtr)
         */
         pPacketEntry = &DS_AppData.FilterTblPtr->Packet[FilterTableIndex];
 
-        pPacketEntry->MessageID = PayloadPtr->MessageID;
+        pPacketEntry->MessageID   = PayloadPtr->MessageID;
+        pPacketEntry->MessageMask = 0;
 
         /* Add the message ID to the hash table as well */
         HashTableIndex = DS_TableAddMsgID(PayloadPtr->MessageID, FilterTableIndex);
@@ -1211,11 +1279,21 @@ CFE_Status_t DS_AddMidCmd(const DS_AddMidCmd_t *BufPtr)
             pFilterParms->FileTableIndex = 0;
             pFilterParms->FilterType     = DS_BY_COUNT;
 
-            pFilterParms->Algorithm_N = 0;
-            pFilterParms->Algorithm_X = 0;
-            pFilterParms->Algorithm_O = 0;
+            pFilterParms->Algorithm_N    = 0;
+            pFilterParms->Algorithm_X    = 0;
+            pFilterParms->Algorithm_O    = 0;
+            pFilterParms->Priority       = DS_PRIORITY_HIGH;
+            pFilterParms->MaxStoreLength = 0;
         }
 
+        pPacketEntry->RatePackets = 0;
+        pPacketEntry->RateBytes   = 0;
+        memset(&DS_AppData.FilterRate[FilterTableIndex], 0, sizeof(DS_RateLimitStatus_t));
+
+        pPacketEntry->PredicateLogic = DS_PREDICATE_AND;
+        memset(pPacketEntry->Predicate, 0, sizeof(pPacketEntry->Predicate));
+        DS_TableCompilePredicate(FilterTableIndex);
+
         CFE_SB_SubscribeEx(PayloadPtr->MessageID, DS_AppData.CmdPipe, CFE_SB_DEFAULT_QOS, DS_PER_PACKET_PIPE_LIMIT);
         /*
         ** Notify cFE that we have modified the table data...
@@ -1284,6 +1362,17 @@ CFE_Status_t DS_RemoveMidCmd(const DS_RemoveMidCmd_t *BufPtr)
                           "Invalid REMOVE MID command: MID = 0x%08lX is not in filter table",
                           (unsigned long)CFE_SB_MsgIdToValue(PayloadPtr->MessageID));
     }
+    else if (DS_AppData.FilterTblPtr->Packet[FilterTableIndex].MessageMask != 0)
+    {
+        /*
+        ** Wildcard entries cover more than this message ID - change them by table load...
+        */
+        DS_AppData.CmdRejectedCounter++;
+
+        CFE_EVS_SendEvent(DS_REMOVE_MID_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Invalid REMOVE MID command: MID = 0x%08lX is in wildcard entry at index = %d",
+                          (unsigned long)CFE_SB_MsgIdToValue(PayloadPtr->MessageID), (int)FilterTableIndex);
+    }
     else
     {
         /* Convert MID into hash table index */
@@ -1306,12 +1395,24 @@ CFE_Status_t DS_RemoveMidCmd(const DS_RemoveMidCmd_t *BufPtr)
             pFilterParms->FileTableIndex = 0;
             pFilterParms->FilterType     = DS_BY_COUNT;
 
-            pFilterParms->Algorithm_N = 0;
-            pFilterParms->Algorithm_X = 0;
-            pFilterParms->Algorithm_O = 0;
+            pFilterParms->Algorithm_N    = 0;
+            pFilterParms->Algorithm_X    = 0;
+            pFilterParms->Algorithm_O    = 0;
+            pFilterParms->Priority       = DS_PRIORITY_HIGH;
+            pFilterParms->MaxStoreLength = 0;
         }
 
-        CFE_SB_Unsubscribe(PayloadPtr->MessageID, DS_AppData.CmdPipe);
+        pPacketEntry->PredicateLogic = DS_PREDICATE_AND;
+        memset(pPacketEntry->Predicate, 0, sizeof(pPacketEntry->Predicate));
+        DS_TableCompilePredicate(FilterTableIndex);
+
+        /*
+        ** Keep the subscription when a wildcard entry now matches this message ID...
+        */
+        if (DS_TableFindMsgID(PayloadPtr->MessageID) == DS_INDEX_NONE)
+        {
+            CFE_SB_Unsubscribe(PayloadPtr->MessageID, DS_AppData.CmdPipe);
+        }
 
         /*
         ** Notify cFE that we have modified the table data...
@@ -1337,11 +1438,13 @@ CFE_Status_t DS_RemoveMidCmd(const DS_RemoveMidCmd_t *BufPtr)
 
 CFE_Status_t DS_SendHkCmd(const DS_SendHkCmd_t *BufPtr)
 {
-    DS_HkPacket_t  HkPacket;
-    int32          i                                              = 0;
-    CFE_Status_t   Status                                         = 0;
-    char           FilterTblName[CFE_MISSION_TBL_MAX_NAME_LENGTH] = {0};
-    CFE_TBL_Info_t FilterTblInfo;
+    DS_HkPacket_t    HkPacket;
+    DS_StatsPacket_t StatsPacket;
+    int32            i                                              = 0;
+    CFE_Status_t     Status                                         = 0;
+    char             FilterTblName[CFE_MISSION_TBL_MAX_NAME_LENGTH] = {0};
+    CFE_TBL_Info_t   FilterTblInfo;
+    uint64           StorageUsed = 0;
 
     DS_HkTlm_Payload_t *PayloadPtr;
 
@@ -1363,6 +1466,11 @@ CFE_Status_t DS_SendHkCmd(const DS_SendHkCmd_t *BufPtr)
     DS_TableManageDestFile();
     DS_TableManageFilter();
 
+    /*
+    ** Return toward nominal filtering if the pipe backlog has cleared...
+    */
+    DS_AppLowerDecimation();
+
     /* Get internal payload substructure */
     PayloadPtr = &HkPacket.Payload;
 
@@ -1379,6 +1487,7 @@ CFE_Status_t DS_SendHkCmd(const DS_SendHkCmd_t *BufPtr)
     PayloadPtr->IgnoredPktCounter  = DS_AppData.IgnoredPktCounter;
     PayloadPtr->FilteredPktCounter = DS_AppData.FilteredPktCounter;
     PayloadPtr->PassedPktCounter   = DS_AppData.PassedPktCounter;
+    PayloadPtr->RateDropPktCounter = DS_AppData.RateDropPktCounter;
 
     /*
     ** Copy file I/O counters to housekeeping telemetry packet...
@@ -1387,6 +1496,7 @@ CFE_Status_t DS_SendHkCmd(const DS_SendHkCmd_t *BufPtr)
     PayloadPtr->FileWriteErrCounter  = DS_AppData.FileWriteErrCounter;
     PayloadPtr->FileUpdateCounter    = DS_AppData.FileUpdateCounter;
     PayloadPtr->FileUpdateErrCounter = DS_AppData.FileUpdateErrCounter;
+    PayloadPtr->EvictedFileCounter   = DS_AppData.EvictedFileCounter;
 
     /*
     ** Copy configuration table counters to housekeeping telemetry packet...
@@ -1401,15 +1511,60 @@ CFE_Status_t DS_SendHkCmd(const DS_SendHkCmd_t *BufPtr)
     */
     PayloadPtr->AppEnableState = DS_AppData.AppEnableState;
 
+    /*
+    ** Copy backpressure decimation level to housekeeping telemetry packet...
+    */
+    PayloadPtr->DecimationLevel = DS_AppData.DecimationLevel;
+
     /*
     ** Compute file growth rate from the number of bytes since the last HK request...
     */
+    StorageUsed = DS_AppData.ClosedFileBytes;
+
     for (i = 0; i < DS_DEST_FILE_CNT; i++)
     {
         DS_AppData.FileStatus[i].FileRate   = DS_AppData.FileStatus[i].FileGrowth / DS_SECS_PER_HK_CYCLE;
         DS_AppData.FileStatus[i].FileGrowth = 0;
+
+        StorageUsed += DS_AppData.FileStatus[i].FileSize;
     }
 
+    PayloadPtr->StorageUsed = (uint32)(StorageUsed / 1024);
+
+    /*
+    ** Copy file extraction state and progress to housekeeping telemetry packet...
+    */
+    PayloadPtr->ExtractState        = DS_AppData.ExtractState;
+    PayloadPtr->ExtractErrCounter   = DS_AppData.ExtractErrCounter;
+    PayloadPtr->ExtractBytesScanned = DS_AppData.ExtractBytesScanned;
+    PayloadPtr->ExtractPacketCount  = DS_AppData.ExtractPacketCount;
+
+    /*
+    ** Copy packet replay state and progress to housekeeping telemetry packet...
+    */
+    PayloadPtr->ReplayState       = DS_AppData.ReplayState;
+    PayloadPtr->ReplayErrCounter  = DS_AppData.ReplayErrCounter;
+    PayloadPtr->ReplayPacketCount = DS_AppData.ReplayPacketCount;
+    PayloadPtr->ReplayOffset      = DS_AppData.ReplayStatus.Offset;
+
+    /*
+    ** Copy compression byte counts to housekeeping telemetry packet...
+    */
+    PayloadPtr->CompressRawBytes  = DS_AppData.CompressRawBytes;
+    PayloadPtr->CompressFileBytes = DS_AppData.CompressFileBytes;
+
+    /*
+    ** Copy flight recorder counters to housekeeping telemetry packet...
+    */
+    PayloadPtr->RecorderTrigCounter = DS_AppData.RecorderTrigCounter;
+    PayloadPtr->RecorderDropCounter = DS_AppData.RecorderDropCounter;
+
+    /*
+    ** Copy latest-value cache usage to housekeeping telemetry packet...
+    */
+    PayloadPtr->CacheUsed            = DS_AppData.CacheCount;
+    PayloadPtr->CacheOverflowCounter = DS_AppData.CacheOverflowCounter;
+
     /* Get the filter table info, put the file name in the HK pkt. */
     Status = snprintf(FilterTblName, CFE_MISSION_TBL_MAX_NAME_LENGTH, "DS.%s", DS_FILTER_TBL_NAME);
     if (Status >= 0)
@@ -1446,6 +1601,839 @@ CFE_Status_t DS_SendHkCmd(const DS_SendHkCmd_t *BufPtr)
     CFE_SB_TimeStampMsg(CFE_MSG_PTR(HkPacket.TelemetryHeader));
     CFE_SB_TransmitMsg(CFE_MSG_PTR(HkPacket.TelemetryHeader), true);
 
+    /*
+    ** Timestamp and send latency statistics telemetry packet (if timed)...
+    */
+    if (DS_STATS_TIMING == 1)
+    {
+        memset(&StatsPacket, 0, sizeof(StatsPacket));
+        CFE_MSG_Init(CFE_MSG_PTR(StatsPacket.TelemetryHeader), CFE_SB_ValueToMsgId(DS_STATS_TLM_MID),
+                     sizeof(DS_StatsPacket_t));
+
+        StatsPacket.Payload = DS_AppData.Stats;
+
+        CFE_SB_TimeStampMsg(CFE_MSG_PTR(StatsPacket.TelemetryHeader));
+        CFE_SB_TransmitMsg(CFE_MSG_PTR(StatsPacket.TelemetryHeader), true);
+    }
+
+    /*
+    ** Send destination statistics every Nth housekeeping cycle (if enabled)...
+    */
+    if (DS_DEST_STATS_HK_CYCLES != 0)
+    {
+        DS_AppData.DestStatsHkCount++;
+
+        if (DS_AppData.DestStatsHkCount == DS_DEST_STATS_HK_CYCLES)
+        {
+            DS_AppData.DestStatsHkCount = 0;
+
+            DS_FileTransmitDestStats();
+        }
+    }
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Process pipe backlog probe                                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+CFE_Status_t DS_BacklogProbeCmd(const DS_BacklogProbeCmd_t *BufPtr)
+{
+    /*
+    ** Ignore probes not sent by DS or already counted as dropped...
+    */
+    if (DS_AppData.BacklogProbePending && (DS_AppData.BacklogProbeCount > 0))
+    {
+        /*
+        ** Messages received ahead of the probe were waiting when it was sent...
+        */
+        DS_AppRaiseDecimation(DS_AppData.BacklogProbeCount - 1);
+
+        DS_AppData.BacklogProbePending = false;
+        DS_AppData.BacklogProbeCount   = 0;
+    }
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* DS_ExtractFileCmd() - extract packets from data storage file    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+CFE_Status_t DS_ExtractFileCmd(const DS_ExtractFileCmd_t *BufPtr)
+{
+    const DS_ExtractFile_Payload_t *PayloadPtr;
+
+    char SourceName[DS_TOTAL_FNAME_BUFSIZE];
+    char TargetName[DS_TOTAL_FNAME_BUFSIZE];
+
+    PayloadPtr = DS_GET_CMD_PAYLOAD(BufPtr, DS_ExtractFileCmd_t);
+
+    CFE_SB_MessageStringGet(SourceName, PayloadPtr->SourceName, NULL, sizeof(SourceName),
+                            sizeof(PayloadPtr->SourceName));
+    CFE_SB_MessageStringGet(TargetName, PayloadPtr->TargetName, NULL, sizeof(TargetName),
+                            sizeof(PayloadPtr->TargetName));
+
+    if ((SourceName[0] == '\0') || (TargetName[0] == '\0'))
+    {
+        /*
+        ** Must have both a source and a target filename...
+        */
+        DS_AppData.CmdRejectedCounter++;
+
+        CFE_EVS_SendEvent(DS_EXTRACT_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Invalid EXTRACT FILE command arg: source or target filename is empty");
+    }
+    else if (strcmp(SourceName, TargetName) == 0)
+    {
+        /*
+        ** Target file is created (truncated) before the source is read...
+        */
+        DS_AppData.CmdRejectedCounter++;
+
+        CFE_EVS_SendEvent(DS_EXTRACT_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Invalid EXTRACT FILE command arg: source and target filename = '%s'", SourceName);
+    }
+    else if (PayloadPtr->StopSeconds < PayloadPtr->StartSeconds)
+    {
+        DS_AppData.CmdRejectedCounter++;
+
+        CFE_EVS_SendEvent(DS_EXTRACT_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Invalid EXTRACT FILE command arg: start = %u, stop = %u",
+                          (unsigned int)PayloadPtr->StartSeconds, (unsigned int)PayloadPtr->StopSeconds);
+    }
+    else if (!OS_ObjectIdDefined(DS_AppData.ExtractSemaphore))
+    {
+        DS_AppData.CmdRejectedCounter++;
+
+        CFE_EVS_SendEvent(DS_EXTRACT_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Invalid EXTRACT FILE command: extraction task is not running");
+    }
+    else if (DS_AppData.ExtractState != DS_EXTRACT_IDLE)
+    {
+        /*
+        ** Only one extraction at a time...
+        */
+        DS_AppData.CmdRejectedCounter++;
+
+        CFE_EVS_SendEvent(DS_EXTRACT_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Invalid EXTRACT FILE command: extraction already in progress");
+    }
+    else
+    {
+        /*
+        ** Hand the request to the extraction child task...
+        */
+        DS_AppData.ExtractRequest = *PayloadPtr;
+        snprintf(DS_AppData.ExtractRequest.SourceName, sizeof(DS_AppData.ExtractRequest.SourceName), "%s",
+                 SourceName);
+        snprintf(DS_AppData.ExtractRequest.TargetName, sizeof(DS_AppData.ExtractRequest.TargetName), "%s",
+                 TargetName);
+
+        DS_AppData.ExtractBytesScanned = 0;
+        DS_AppData.ExtractPacketCount  = 0;
+        DS_AppData.ExtractState        = DS_EXTRACT_ACTIVE;
+
+        OS_CountSemGive(DS_AppData.ExtractSemaphore);
+
+        DS_AppData.CmdAcceptedCounter++;
+
+        CFE_EVS_SendEvent(DS_EXTRACT_CMD_EID, CFE_EVS_EventType_INFORMATION,
+                          "EXTRACT FILE command: source = '%s', target = '%s', start = %u, stop = %u", SourceName,
+                          TargetName, (unsigned int)PayloadPtr->StartSeconds, (unsigned int)PayloadPtr->StopSeconds);
+    }
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* DS_ReplayStartCmd() - start replay of data storage file         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+CFE_Status_t DS_ReplayStartCmd(const DS_ReplayStartCmd_t *BufPtr)
+{
+    const DS_ReplayStart_Payload_t *PayloadPtr;
+
+    char Filename[DS_TOTAL_FNAME_BUFSIZE];
+
+    PayloadPtr = DS_GET_CMD_PAYLOAD(BufPtr, DS_ReplayStartCmd_t);
+
+    CFE_SB_MessageStringGet(Filename, PayloadPtr->Filename, NULL, sizeof(Filename), sizeof(PayloadPtr->Filename));
+
+    if (Filename[0] == '\0')
+    {
+        DS_AppData.CmdRejectedCounter++;
+
+        CFE_EVS_SendEvent(DS_REPLAY_START_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Invalid REPLAY START command arg: filename is empty");
+    }
+    else if ((PayloadPtr->RateMultiplier == 0) || (PayloadPtr->RateMultiplier > DS_REPLAY_MAX_RATE))
+    {
+        DS_AppData.CmdRejectedCounter++;
+
+        CFE_EVS_SendEvent(DS_REPLAY_START_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Invalid REPLAY START command arg: rate multiplier = %d",
+                          (int)PayloadPtr->RateMultiplier);
+    }
+    else if (!OS_ObjectIdDefined(DS_AppData.ReplaySemaphore))
+    {
+        DS_AppData.CmdRejectedCounter++;
+
+        CFE_EVS_SendEvent(DS_REPLAY_START_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Invalid REPLAY START command: replay task is not running");
+    }
+    else if (DS_AppData.ReplayState != DS_REPLAY_IDLE)
+    {
+        /*
+        ** Only one replay at a time...
+        */
+        DS_AppData.CmdRejectedCounter++;
+
+        CFE_EVS_SendEvent(DS_REPLAY_START_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Invalid REPLAY START command: replay already in progress");
+    }
+    else
+    {
+        /*
+        ** Hand the request to the replay child task...
+        */
+        snprintf(DS_AppData.ReplayFilename, sizeof(DS_AppData.ReplayFilename), "%s", Filename);
+
+        DS_AppData.ReplayRate           = PayloadPtr->RateMultiplier;
+        DS_AppData.ReplayStopPending    = false;
+        DS_AppData.ReplaySeekPending    = false;
+        DS_AppData.ReplayPauseRequested = false;
+        DS_AppData.ReplayPacketCount    = 0;
+
+        /*
+        ** The child task is waiting while idle - it owns the state from here on...
+        */
+        DS_AppData.ReplayState = DS_REPLAY_ACTIVE;
+
+        OS_CountSemGive(DS_AppData.ReplaySemaphore);
+
+        DS_AppData.CmdAcceptedCounter++;
+
+        CFE_EVS_SendEvent(DS_REPLAY_START_CMD_EID, CFE_EVS_EventType_INFORMATION,
+                          "REPLAY START command: file = '%s', rate multiplier = %d", Filename,
+                          (int)PayloadPtr->RateMultiplier);
+    }
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* DS_ReplayStopCmd() - stop replay of data storage file           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+CFE_Status_t DS_ReplayStopCmd(const DS_ReplayStopCmd_t *BufPtr)
+{
+    if (DS_AppData.ReplayState == DS_REPLAY_IDLE)
+    {
+        DS_AppData.CmdRejectedCounter++;
+
+        CFE_EVS_SendEvent(DS_REPLAY_CTRL_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Invalid REPLAY STOP command: no replay in progress");
+    }
+    else
+    {
+        /*
+        ** Child task stops before sending the next packet...
+        */
+        DS_AppData.ReplayStopPending = true;
+
+        DS_AppData.CmdAcceptedCounter++;
+
+        CFE_EVS_SendEvent(DS_REPLAY_CTRL_CMD_EID, CFE_EVS_EventType_INFORMATION, "REPLAY STOP command: file = '%s'",
+                          DS_AppData.ReplayFilename);
+    }
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* DS_ReplayPauseCmd() - pause replay of data storage file         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+CFE_Status_t DS_ReplayPauseCmd(const DS_ReplayPauseCmd_t *BufPtr)
+{
+    if ((DS_AppData.ReplayState == DS_REPLAY_IDLE) || DS_AppData.ReplayPauseRequested)
+    {
+        DS_AppData.CmdRejectedCounter++;
+
+        CFE_EVS_SendEvent(DS_REPLAY_CTRL_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Invalid REPLAY PAUSE command: replay is not active, state = %d",
+                          (int)DS_AppData.ReplayState);
+    }
+    else
+    {
+        /*
+        ** Child task changes the state when it sees the request...
+        */
+        DS_AppData.ReplayPauseRequested = true;
+
+        DS_AppData.CmdAcceptedCounter++;
+
+        CFE_EVS_SendEvent(DS_REPLAY_CTRL_CMD_EID, CFE_EVS_EventType_INFORMATION,
+                          "REPLAY PAUSE command: file = '%s', packets = %u", DS_AppData.ReplayFilename,
+                          (unsigned int)DS_AppData.ReplayPacketCount);
+    }
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* DS_ReplayResumeCmd() - resume replay of data storage file       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+CFE_Status_t DS_ReplayResumeCmd(const DS_ReplayResumeCmd_t *BufPtr)
+{
+    if ((DS_AppData.ReplayState == DS_REPLAY_IDLE) || !DS_AppData.ReplayPauseRequested)
+    {
+        DS_AppData.CmdRejectedCounter++;
+
+        CFE_EVS_SendEvent(DS_REPLAY_CTRL_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Invalid REPLAY RESUME command: replay is not paused, state = %d",
+                          (int)DS_AppData.ReplayState);
+    }
+    else
+    {
+        DS_AppData.ReplayPauseRequested = false;
+
+        DS_AppData.CmdAcceptedCounter++;
+
+        CFE_EVS_SendEvent(DS_REPLAY_CTRL_CMD_EID, CFE_EVS_EventType_INFORMATION,
+                          "REPLAY RESUME command: file = '%s', packets = %u", DS_AppData.ReplayFilename,
+                          (unsigned int)DS_AppData.ReplayPacketCount);
+    }
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* DS_ReplaySeekCmd() - move replay of data storage file           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+CFE_Status_t DS_ReplaySeekCmd(const DS_ReplaySeekCmd_t *BufPtr)
+{
+    const DS_ReplaySeek_Payload_t *PayloadPtr;
+
+    PayloadPtr = DS_GET_CMD_PAYLOAD(BufPtr, DS_ReplaySeekCmd_t);
+
+    if (DS_AppData.ReplayState == DS_REPLAY_IDLE)
+    {
+        DS_AppData.CmdRejectedCounter++;
+
+        CFE_EVS_SendEvent(DS_REPLAY_SEEK_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Invalid REPLAY SEEK command: no replay in progress");
+    }
+    else
+    {
+        /*
+        ** Child task moves the file position before the next packet...
+        */
+        DS_AppData.ReplaySeekSeconds = PayloadPtr->Seconds;
+        DS_AppData.ReplaySeekPending = true;
+
+        DS_AppData.CmdAcceptedCounter++;
+
+        CFE_EVS_SendEvent(DS_REPLAY_SEEK_CMD_EID, CFE_EVS_EventType_INFORMATION,
+                          "REPLAY SEEK command: file = '%s', seconds = %u", DS_AppData.ReplayFilename,
+                          (unsigned int)PayloadPtr->Seconds);
+    }
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Set packet filter table entry rate limits                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+CFE_Status_t DS_SetFilterRateCmd(const DS_SetFilterRateCmd_t *BufPtr)
+{
+    const DS_FilterRate_Payload_t *DS_FilterRateCmd;
+
+    DS_PacketEntry_t *pPacketEntry     = NULL;
+    int32             FilterTableIndex = 0;
+
+    DS_FilterRateCmd = DS_GET_CMD_PAYLOAD(BufPtr, DS_SetFilterRateCmd_t);
+
+    if (!CFE_SB_IsValidMsgId(DS_FilterRateCmd->MessageID))
+    {
+        /*
+        ** Invalid packet messageID...
+        */
+        DS_AppData.CmdRejectedCounter++;
+
+        CFE_EVS_SendEvent(DS_FILTER_RATE_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Invalid FILTER RATE command arg: invalid messageID = 0x%08lX",
+                          (unsigned long)CFE_SB_MsgIdToValue(DS_FilterRateCmd->MessageID));
+    }
+    else if (DS_AppData.FilterTblPtr == (DS_FilterTable_t *)NULL)
+    {
+        /*
+        ** Must have a valid packet filter table loaded...
+        */
+        DS_AppData.CmdRejectedCounter++;
+
+        CFE_EVS_SendEvent(DS_FILTER_RATE_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Invalid FILTER RATE command: packet filter table is not loaded");
+    }
+    else
+    {
+        /*
+        ** Get the index of the filter table entry for this message ID...
+        */
+        FilterTableIndex = DS_TableFindMsgID(DS_FilterRateCmd->MessageID);
+
+        if (FilterTableIndex == DS_INDEX_NONE)
+        {
+            /*
+            ** Must not create - may only modify existing packet filter...
+            */
+            DS_AppData.CmdRejectedCounter++;
+
+            CFE_EVS_SendEvent(DS_FILTER_RATE_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Invalid FILTER RATE command: Message ID 0x%08lX is not in filter table",
+                              (unsigned long)CFE_SB_MsgIdToValue(DS_FilterRateCmd->MessageID));
+        }
+        else
+        {
+            /*
+            ** Set new rate limits (the token bucket adjusts with the next packet)...
+            */
+            pPacketEntry = &DS_AppData.FilterTblPtr->Packet[FilterTableIndex];
+
+            pPacketEntry->RatePackets = DS_FilterRateCmd->RatePackets;
+            pPacketEntry->RateBytes   = DS_FilterRateCmd->RateBytes;
+
+            /*
+            ** Notify cFE that we have modified the table data...
+            */
+            CFE_TBL_Modified(DS_AppData.FilterTblHandle);
+
+            DS_AppData.CmdAcceptedCounter++;
+
+            CFE_EVS_SendEvent(DS_FILTER_RATE_CMD_EID, CFE_EVS_EventType_INFORMATION,
+                              "FILTER RATE command: MID = 0x%08lX, index = %d, packets/sec = %d, bytes/sec = %u",
+                              (unsigned long)CFE_SB_MsgIdToValue(DS_FilterRateCmd->MessageID), (int)FilterTableIndex,
+                              pPacketEntry->RatePackets, (unsigned int)pPacketEntry->RateBytes);
+        }
+    }
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Set destination file rate limits                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+CFE_Status_t DS_SetDestRateCmd(const DS_SetDestRateCmd_t *BufPtr)
+{
+    const DS_DestRate_Payload_t *DS_DestRateCmd;
+    DS_DestFileEntry_t *         pDest = NULL;
+
+    DS_DestRateCmd = DS_GET_CMD_PAYLOAD(BufPtr, DS_SetDestRateCmd_t);
+
+    if (DS_TableVerifyFileIndex(DS_DestRateCmd->FileTableIndex) == false)
+    {
+        /*
+        ** Invalid destination file table index...
+        */
+        DS_AppData.CmdRejectedCounter++;
+
+        CFE_EVS_SendEvent(DS_DEST_RATE_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Invalid DEST RATE command arg: file table index = %d", (int)DS_DestRateCmd->FileTableIndex);
+    }
+    else if (DS_AppData.DestFileTblPtr == (DS_DestFileTable_t *)NULL)
+    {
+        /*
+        ** Must have a valid destination file table loaded...
+        */
+        DS_AppData.CmdRejectedCounter++;
+
+        CFE_EVS_SendEvent(DS_DEST_RATE_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Invalid DEST RATE command: destination file table is not loaded");
+    }
+    else
+    {
+        /*
+        ** Set rate limits for destination file (the token bucket adjusts with the next packet)...
+        */
+        pDest              = &DS_AppData.DestFileTblPtr->File[DS_DestRateCmd->FileTableIndex];
+        pDest->RatePackets = DS_DestRateCmd->RatePackets;
+        pDest->RateBytes   = DS_DestRateCmd->RateBytes;
+
+        /*
+        ** Notify cFE that we have modified the table data...
+        */
+        CFE_TBL_Modified(DS_AppData.DestFileTblHandle);
+
+        DS_AppData.CmdAcceptedCounter++;
+
+        CFE_EVS_SendEvent(DS_DEST_RATE_CMD_EID, CFE_EVS_EventType_INFORMATION,
+                          "DEST RATE command: file table index = %d, packets/sec = %d, bytes/sec = %u",
+                          (int)DS_DestRateCmd->FileTableIndex, (int)DS_DestRateCmd->RatePackets,
+                          (unsigned int)DS_DestRateCmd->RateBytes);
+    }
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Set flight recorder                                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+CFE_Status_t DS_SetRecorderCmd(const DS_SetRecorderCmd_t *BufPtr)
+{
+    const DS_SetRecorder_Payload_t *DS_RecorderCmd;
+    DS_RecorderStatus_t *           Recorder = NULL;
+    uint16                          Holder   = 0;
+
+    DS_RecorderCmd = DS_GET_CMD_PAYLOAD(BufPtr, DS_SetRecorderCmd_t);
+
+    if (DS_RecorderCmd->RecorderIndex < DS_RECORDER_CNT)
+    {
+        Recorder = &DS_AppData.Recorder[DS_RecorderCmd->RecorderIndex];
+    }
+
+    if (Recorder == NULL)
+    {
+        /*
+        ** Invalid flight recorder index...
+        */
+        DS_AppData.CmdRejectedCounter++;
+
+        CFE_EVS_SendEvent(DS_SET_RECORDER_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Invalid RECORDER command arg: recorder index = %d", (int)DS_RecorderCmd->RecorderIndex);
+    }
+    else if (DS_TableVerifyState(DS_RecorderCmd->RecorderState) == false)
+    {
+        /*
+        ** Invalid flight recorder state...
+        */
+        DS_AppData.CmdRejectedCounter++;
+
+        CFE_EVS_SendEvent(DS_SET_RECORDER_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Invalid RECORDER command arg: recorder state = %d", (int)DS_RecorderCmd->RecorderState);
+    }
+    else if (DS_RecorderCmd->RecorderState == DS_DISABLED)
+    {
+        /*
+        ** Release the destination - held packets (and any dump in progress) are discarded...
+        */
+        if (Recorder->State != DS_RECORDER_OFF)
+        {
+            DS_AppData.DestRecorder[Recorder->FileTableIndex] = 0;
+        }
+
+        Recorder->State = DS_RECORDER_OFF;
+
+        DS_AppData.CmdAcceptedCounter++;
+
+        CFE_EVS_SendEvent(DS_SET_RECORDER_CMD_EID, CFE_EVS_EventType_INFORMATION,
+                          "RECORDER command: recorder index = %d, state = disabled",
+                          (int)DS_RecorderCmd->RecorderIndex);
+    }
+    else if (DS_TableVerifyFileIndex(DS_RecorderCmd->FileTableIndex) == false)
+    {
+        /*
+        ** Invalid destination file table index...
+        */
+        DS_AppData.CmdRejectedCounter++;
+
+        CFE_EVS_SendEvent(DS_SET_RECORDER_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Invalid RECORDER command arg: file table index = %d", (int)DS_RecorderCmd->FileTableIndex);
+    }
+    else if (((Holder = DS_AppData.DestRecorder[DS_RecorderCmd->FileTableIndex]) != 0) &&
+             (Holder != (DS_RecorderCmd->RecorderIndex + 1)))
+    {
+        /*
+        ** Each destination has at most one recorder...
+        */
+        DS_AppData.CmdRejectedCounter++;
+
+        CFE_EVS_SendEvent(DS_SET_RECORDER_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Invalid RECORDER command: file table index = %d is held by recorder %d",
+                          (int)DS_RecorderCmd->FileTableIndex, (int)(Holder - 1));
+    }
+    else if (Recorder->State == DS_RECORDER_DUMPING)
+    {
+        /*
+        ** Let the dump finish (or disable the recorder) first...
+        */
+        DS_AppData.CmdRejectedCounter++;
+
+        CFE_EVS_SendEvent(DS_SET_RECORDER_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Invalid RECORDER command: recorder index = %d is dumping",
+                          (int)DS_RecorderCmd->RecorderIndex);
+    }
+    else
+    {
+        if (Recorder->State != DS_RECORDER_OFF)
+        {
+            DS_AppData.DestRecorder[Recorder->FileTableIndex] = 0;
+        }
+
+        /*
+        ** Start holding packets in an empty buffer...
+        */
+        Recorder->State          = DS_RECORDER_HOLDING;
+        Recorder->FileTableIndex = DS_RecorderCmd->FileTableIndex;
+        Recorder->PostSeconds    = DS_RecorderCmd->PostTriggerSeconds;
+        Recorder->TriggerMsgID   = DS_RecorderCmd->TriggerMsgID;
+        Recorder->PostDone       = false;
+        Recorder->Head           = 0;
+        Recorder->Tail           = 0;
+        Recorder->DumpEnd        = 0;
+        Recorder->DumpCount      = 0;
+
+        DS_AppData.DestRecorder[DS_RecorderCmd->FileTableIndex] = DS_RecorderCmd->RecorderIndex + 1;
+
+        DS_AppData.CmdAcceptedCounter++;
+
+        CFE_EVS_SendEvent(DS_SET_RECORDER_CMD_EID, CFE_EVS_EventType_INFORMATION,
+                          "RECORDER command: recorder index = %d, file table index = %d, trigger MID = 0x%08lX, "
+                          "post-trigger seconds = %d",
+                          (int)DS_RecorderCmd->RecorderIndex, (int)DS_RecorderCmd->FileTableIndex,
+                          (unsigned long)CFE_SB_MsgIdToValue(DS_RecorderCmd->TriggerMsgID),
+                          (int)DS_RecorderCmd->PostTriggerSeconds);
+    }
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Trigger flight recorder dump                                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+CFE_Status_t DS_TriggerRecorderCmd(const DS_TriggerRecorderCmd_t *BufPtr)
+{
+    const DS_TriggerRecorder_Payload_t *DS_TriggerCmd;
+
+    DS_TriggerCmd = DS_GET_CMD_PAYLOAD(BufPtr, DS_TriggerRecorderCmd_t);
+
+    if (DS_TriggerCmd->RecorderIndex >= DS_RECORDER_CNT)
+    {
+        /*
+        ** Invalid flight recorder index...
+        */
+        DS_AppData.CmdRejectedCounter++;
+
+        CFE_EVS_SendEvent(DS_TRIGGER_RECORDER_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Invalid TRIGGER command arg: recorder index = %d", (int)DS_TriggerCmd->RecorderIndex);
+    }
+    else if (DS_AppData.Recorder[DS_TriggerCmd->RecorderIndex].State != DS_RECORDER_HOLDING)
+    {
+        /*
+        ** Recorder is disabled or already dumping...
+        */
+        DS_AppData.CmdRejectedCounter++;
+
+        CFE_EVS_SendEvent(DS_TRIGGER_RECORDER_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Invalid TRIGGER command: recorder index = %d is not holding packets",
+                          (int)DS_TriggerCmd->RecorderIndex);
+    }
+    else
+    {
+        DS_AppData.CmdAcceptedCounter++;
+
+        DS_FileRecorderTrigger(DS_TriggerCmd->RecorderIndex, "command");
+    }
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Send latest-value cache packet                                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+CFE_Status_t DS_SendCacheCmd(const DS_SendCacheCmd_t *BufPtr)
+{
+    const DS_SendCache_Payload_t *PayloadPtr;
+    const DS_CacheEntry_t *       Entry = NULL;
+
+    PayloadPtr = DS_GET_CMD_PAYLOAD(BufPtr, DS_SendCacheCmd_t);
+
+    if (!CFE_SB_IsValidMsgId(PayloadPtr->MessageID))
+    {
+        /*
+        ** Invalid packet messageID...
+        */
+        DS_AppData.CmdRejectedCounter++;
+
+        CFE_EVS_SendEvent(DS_SEND_CACHE_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Invalid SEND CACHE command arg: invalid MID = 0x%08lX",
+                          (unsigned long)CFE_SB_MsgIdToValue(PayloadPtr->MessageID));
+    }
+    else if (DS_CACHE_ENTRIES == 0)
+    {
+        DS_AppData.CmdRejectedCounter++;
+
+        CFE_EVS_SendEvent(DS_SEND_CACHE_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Invalid SEND CACHE command: latest-value cache is disabled");
+    }
+    else if ((Entry = DS_FileCacheFind(PayloadPtr->MessageID)) == NULL)
+    {
+        /*
+        ** Message ID not in packet filter table or no packet received yet...
+        */
+        DS_AppData.CmdRejectedCounter++;
+
+        CFE_EVS_SendEvent(DS_SEND_CACHE_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Invalid SEND CACHE command: no packet cached for MID = 0x%08lX",
+                          (unsigned long)CFE_SB_MsgIdToValue(PayloadPtr->MessageID));
+    }
+    else
+    {
+        /*
+        ** Send the packet as received (sequence count unchanged), it is not stored
+        **   again when it comes back through the DS pipe...
+        */
+        DS_FileEchoRecord(&DS_AppData.CacheEcho, (const CFE_MSG_Message_t *)Entry->Packet);
+        CFE_SB_TransmitMsg((const CFE_MSG_Message_t *)Entry->Packet, false);
+
+        DS_AppData.CmdAcceptedCounter++;
+
+        CFE_EVS_SendEvent(DS_SEND_CACHE_CMD_EID, CFE_EVS_EventType_DEBUG,
+                          "SEND CACHE command: MID = 0x%08lX, length = %u",
+                          (unsigned long)CFE_SB_MsgIdToValue(PayloadPtr->MessageID),
+                          (unsigned int)Entry->PacketLength);
+    }
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Write latest-value cache snapshot file                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+CFE_Status_t DS_WriteCacheCmd(const DS_WriteCacheCmd_t *BufPtr)
+{
+    const DS_WriteCache_Payload_t *PayloadPtr;
+    char                           Filename[DS_TOTAL_FNAME_BUFSIZE];
+    uint32                         PacketCount = 0;
+    int32                          Result      = OS_SUCCESS;
+
+    PayloadPtr = DS_GET_CMD_PAYLOAD(BufPtr, DS_WriteCacheCmd_t);
+
+    CFE_SB_MessageStringGet(Filename, PayloadPtr->Filename, NULL, sizeof(Filename), sizeof(PayloadPtr->Filename));
+
+    if (DS_CACHE_ENTRIES == 0)
+    {
+        DS_AppData.CmdRejectedCounter++;
+
+        CFE_EVS_SendEvent(DS_WRITE_CACHE_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Invalid WRITE CACHE command: latest-value cache is disabled");
+    }
+    else if (Filename[0] == '\0')
+    {
+        DS_AppData.CmdRejectedCounter++;
+
+        CFE_EVS_SendEvent(DS_WRITE_CACHE_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Invalid WRITE CACHE command arg: filename is empty");
+    }
+    else if ((Result = DS_FileCacheWrite(Filename, &PacketCount)) != OS_SUCCESS)
+    {
+        DS_AppData.CmdRejectedCounter++;
+
+        CFE_EVS_SendEvent(DS_WRITE_CACHE_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "WRITE CACHE command error: file = '%s', result = %d, packets written = %u", Filename,
+                          (int)Result, (unsigned int)PacketCount);
+    }
+    else
+    {
+        DS_AppData.CmdAcceptedCounter++;
+
+        CFE_EVS_SendEvent(DS_WRITE_CACHE_CMD_EID, CFE_EVS_EventType_INFORMATION,
+                          "WRITE CACHE command: file = '%s', packets = %u", Filename, (unsigned int)PacketCount);
+    }
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Get closed file manifest                                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+CFE_Status_t DS_GetManifestCmd(const DS_GetManifestCmd_t *BufPtr)
+{
+    const DS_GetManifest_Payload_t *PayloadPtr;
+    char                            ManifestName[DS_TOTAL_FNAME_BUFSIZE];
+
+    PayloadPtr = DS_GET_CMD_PAYLOAD(BufPtr, DS_GetManifestCmd_t);
+
+    if (DS_TableVerifyFileIndex(PayloadPtr->FileTableIndex) == false)
+    {
+        /*
+        ** Invalid destination file table index...
+        */
+        DS_AppData.CmdRejectedCounter++;
+
+        CFE_EVS_SendEvent(DS_GET_MANIFEST_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Invalid GET MANIFEST command arg: file table index = %d", (int)PayloadPtr->FileTableIndex);
+    }
+    else if (DS_AppData.DestFileTblPtr == (DS_DestFileTable_t *)NULL)
+    {
+        /*
+        ** Must have a valid destination file table loaded...
+        */
+        DS_AppData.CmdRejectedCounter++;
+
+        CFE_EVS_SendEvent(DS_GET_MANIFEST_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Invalid GET MANIFEST command: destination file table is not loaded");
+    }
+    else if (DS_FileManifestName(PayloadPtr->FileTableIndex, ManifestName, sizeof(ManifestName)) == false)
+    {
+        /*
+        ** Manifests not configured, moves disabled or no move directory...
+        */
+        DS_AppData.CmdRejectedCounter++;
+
+        CFE_EVS_SendEvent(DS_GET_MANIFEST_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Invalid GET MANIFEST command: no manifest for file table index = %d",
+                          (int)PayloadPtr->FileTableIndex);
+    }
+    else
+    {
+        DS_AppData.CmdAcceptedCounter++;
+
+        CFE_EVS_SendEvent(DS_GET_MANIFEST_CMD_EID, CFE_EVS_EventType_DEBUG,
+                          "GET MANIFEST command: file table index = %d, manifest = '%s'",
+                          (int)PayloadPtr->FileTableIndex, ManifestName);
+
+        DS_FileTransmitManifest(PayloadPtr->FileTableIndex, ManifestName);
+    }
+
     return CFE_SUCCESS;
 }
 
@@ -421,6 +421,141 @@ CFE_Status_t DS_CloseAllCmd(const DS_CloseAllCmd_t *BufPtr);
  */
 CFE_Status_t DS_GetFileInfoCmd(const DS_GetFileInfoCmd_t *BufPtr);
 
+/**
+ *  \brief Get destination statistics telemetry packet command handler
+ *
+ *  \par Description
+ *       Create and send a telemetry packet containing the input/output
+ *       statistics for all destination files.
+ *       Reject invalid command packets
+ *       - generate error event if invalid command packet length
+ *       Accept valid command packets
+ *       - generate destination statistics telemetry packet
+ *       - generate success event (event type = debug)
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] BufPtr Software Bus message pointer
+ *
+ *  \sa #DS_GET_DEST_STATS_CC, #DS_GetDestStatsCmd_t, #DS_DestStatsPkt_t
+ */
+CFE_Status_t DS_GetDestStatsCmd(const DS_GetDestStatsCmd_t *BufPtr);
+
+/**
+ *  \brief Set flight recorder command handler
+ *
+ *  \par Description
+ *       Enable or disable a flight recorder.
+ *       Reject invalid command packets
+ *       - generate error event if invalid command packet length
+ *       - generate error event if invalid recorder index
+ *       - generate error event if invalid recorder state
+ *       - generate error event if invalid file table index
+ *       - generate error event if destination is held by another recorder
+ *       - generate error event if recorder is dumping (enable only)
+ *       Accept valid command packets
+ *       - enable (with an empty buffer) or disable the recorder
+ *       - generate success event
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] BufPtr Software Bus message pointer
+ *
+ *  \sa #DS_SET_RECORDER_CC, #DS_SetRecorderCmd_t
+ */
+CFE_Status_t DS_SetRecorderCmd(const DS_SetRecorderCmd_t *BufPtr);
+
+/**
+ *  \brief Trigger flight recorder dump command handler
+ *
+ *  \par Description
+ *       Start a flight recorder dump.
+ *       Reject invalid command packets
+ *       - generate error event if invalid command packet length
+ *       - generate error event if invalid recorder index
+ *       - generate error event if recorder is not holding packets
+ *       Accept valid command packets
+ *       - start the dump
+ *       - generate success event
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] BufPtr Software Bus message pointer
+ *
+ *  \sa #DS_TRIGGER_RECORDER_CC, #DS_TriggerRecorderCmd_t
+ */
+CFE_Status_t DS_TriggerRecorderCmd(const DS_TriggerRecorderCmd_t *BufPtr);
+
+/**
+ *  \brief Send latest-value cache packet command handler
+ *
+ *  \par Description
+ *       Send the cached last packet of a Message ID.
+ *       Reject invalid command packets
+ *       - generate error event if invalid command packet length
+ *       - generate error event if invalid Message ID
+ *       - generate error event if no packet is cached for the Message ID
+ *       Accept valid command packets
+ *       - send the cached packet on the Software Bus
+ *       - generate success event
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] BufPtr Software Bus message pointer
+ *
+ *  \sa #DS_SEND_CACHE_CC, #DS_SendCacheCmd_t
+ */
+CFE_Status_t DS_SendCacheCmd(const DS_SendCacheCmd_t *BufPtr);
+
+/**
+ *  \brief Write latest-value cache snapshot file command handler
+ *
+ *  \par Description
+ *       Write every cached packet to a snapshot file.
+ *       Reject invalid command packets
+ *       - generate error event if invalid command packet length
+ *       - generate error event if filename is empty
+ *       - generate error event if the file cannot be created or written
+ *       Accept valid command packets
+ *       - write the snapshot file
+ *       - generate success event
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The file is written before the command completes.
+ *
+ *  \param[in] BufPtr Software Bus message pointer
+ *
+ *  \sa #DS_WRITE_CACHE_CC, #DS_WriteCacheCmd_t
+ */
+CFE_Status_t DS_WriteCacheCmd(const DS_WriteCacheCmd_t *BufPtr);
+
+/**
+ *  \brief Get closed file manifest command handler
+ *
+ *  \par Description
+ *       Send the closed file manifest packet of a destination file.
+ *       Reject invalid command packets
+ *       - generate error event if invalid command packet length
+ *       - generate error event if invalid file table index
+ *       - generate error event if destination file table is not loaded
+ *       - generate error event if the destination has no manifest
+ *       Accept valid command packets
+ *       - send the manifest packet
+ *       - generate success event
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A manifest that has not been created yet has no records.
+ *
+ *  \param[in] BufPtr Software Bus message pointer
+ *
+ *  \sa #DS_GET_MANIFEST_CC, #DS_GetManifestCmd_t, #DS_ManifestPkt_t
+ */
+CFE_Status_t DS_GetManifestCmd(const DS_GetManifestCmd_t *BufPtr);
+
 /**
  *  \brief Add Message ID to Packet Filter Table
  *
@@ -480,4 +615,199 @@ CFE_Status_t DS_RemoveMidCmd(const DS_RemoveMidCmd_t *BufPtr);
  */
 CFE_Status_t DS_SendHkCmd(const DS_SendHkCmd_t *BufPtr);
 
+/**
+ *  \brief Pipe backlog probe handler
+ *
+ *  \par Description
+ *       Takes the messages received ahead of a probe sent by
+ *       #DS_AppProbeBacklog as the backlog of the DS pipe and
+ *       raises the backpressure decimation level if needed.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Probes that DS is not waiting for are ignored.
+ *
+ *  \sa #DS_BacklogProbeCmd_t, #DS_AppRaiseDecimation
+ */
+CFE_Status_t DS_BacklogProbeCmd(const DS_BacklogProbeCmd_t *BufPtr);
+
+/**
+ *  \brief Extract Packets from Data Storage File
+ *
+ *  \par Description
+ *       Start a background extraction of packets from a data storage file
+ *       Reject invalid commands
+ *       - generate error event if invalid command packet length
+ *       - generate error event if source or target filename is empty
+ *       - generate error event if source and target filename are the same
+ *       - generate error event if time window stop is before start
+ *       - generate error event if extraction task is not running
+ *       - generate error event if an extraction is already in progress
+ *       Accept valid commands
+ *       - store the extraction request and wake the extraction task
+ *       - generate success event (event type = info)
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The extraction completes asynchronously in the child task.
+ *
+ *  \param[in] BufPtr Software Bus message pointer
+ *
+ *  \sa #DS_EXTRACT_FILE_CC, #DS_ExtractFileCmd_t
+ */
+CFE_Status_t DS_ExtractFileCmd(const DS_ExtractFileCmd_t *BufPtr);
+
+/**
+ *  \brief Start Replay of Data Storage File
+ *
+ *  \par Description
+ *       Start a background replay of the packets in a data storage file
+ *       Reject invalid commands
+ *       - generate error event if invalid command packet length
+ *       - generate error event if filename is empty
+ *       - generate error event if rate multiplier is zero or too large
+ *       - generate error event if replay task is not running
+ *       - generate error event if a replay is already in progress
+ *       Accept valid commands
+ *       - store the replay request and wake the replay task
+ *       - generate success event (event type = info)
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The replay completes asynchronously in the child task.
+ *
+ *  \param[in] BufPtr Software Bus message pointer
+ *
+ *  \sa #DS_REPLAY_START_CC, #DS_ReplayStartCmd_t
+ */
+CFE_Status_t DS_ReplayStartCmd(const DS_ReplayStartCmd_t *BufPtr);
+
+/**
+ *  \brief Stop Replay of Data Storage File
+ *
+ *  \par Description
+ *       Stop the replay in progress
+ *       Reject invalid commands
+ *       - generate error event if invalid command packet length
+ *       - generate error event if no replay is in progress
+ *       Accept valid commands
+ *       - signal the replay task to stop before the next packet
+ *       - generate success event (event type = info)
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] BufPtr Software Bus message pointer
+ *
+ *  \sa #DS_REPLAY_STOP_CC, #DS_ReplayStopCmd_t
+ */
+CFE_Status_t DS_ReplayStopCmd(const DS_ReplayStopCmd_t *BufPtr);
+
+/**
+ *  \brief Pause Replay of Data Storage File
+ *
+ *  \par Description
+ *       Pause the active replay
+ *       Reject invalid commands
+ *       - generate error event if invalid command packet length
+ *       - generate error event if replay is not active
+ *       Accept valid commands
+ *       - request pause from replay child task
+ *       - generate success event (event type = info)
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The child task sets the replay state to paused between packets.
+ *
+ *  \param[in] BufPtr Software Bus message pointer
+ *
+ *  \sa #DS_REPLAY_PAUSE_CC, #DS_ReplayPauseCmd_t
+ */
+CFE_Status_t DS_ReplayPauseCmd(const DS_ReplayPauseCmd_t *BufPtr);
+
+/**
+ *  \brief Resume Replay of Data Storage File
+ *
+ *  \par Description
+ *       Resume the paused replay
+ *       Reject invalid commands
+ *       - generate error event if invalid command packet length
+ *       - generate error event if replay is not paused
+ *       Accept valid commands
+ *       - withdraw pause request from replay child task
+ *       - generate success event (event type = info)
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The child task sets the replay state to active between packets.
+ *
+ *  \param[in] BufPtr Software Bus message pointer
+ *
+ *  \sa #DS_REPLAY_RESUME_CC, #DS_ReplayResumeCmd_t
+ */
+CFE_Status_t DS_ReplayResumeCmd(const DS_ReplayResumeCmd_t *BufPtr);
+
+/**
+ *  \brief Move Replay of Data Storage File
+ *
+ *  \par Description
+ *       Move the replay in progress to a packet time
+ *       Reject invalid commands
+ *       - generate error event if invalid command packet length
+ *       - generate error event if no replay is in progress
+ *       Accept valid commands
+ *       - signal the replay task to seek before the next packet
+ *       - generate success event (event type = info)
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] BufPtr Software Bus message pointer
+ *
+ *  \sa #DS_REPLAY_SEEK_CC, #DS_ReplaySeekCmd_t
+ */
+CFE_Status_t DS_ReplaySeekCmd(const DS_ReplaySeekCmd_t *BufPtr);
+
+/**
+ *  \brief Set packet filter table entry rate limits command handler
+ *
+ *  \par Description
+ *       Modify the packet and byte rate limits for the selected
+ *       message ID in the packet filter table.
+ *       Reject invalid command packets
+ *       - generate error event if invalid command packet length
+ *       - generate error event if invalid message ID
+ *       - generate error event if filter table is not loaded
+ *       - generate error event if message ID is not in filter table
+ *       Accept valid command packets
+ *       - update rate limits for selected filter table entry
+ *       - generate success event (event type = info)
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] BufPtr Software Bus message pointer
+ *
+ *  \sa #DS_SET_FILTER_RATE_CC, #DS_SetFilterRateCmd_t
+ */
+CFE_Status_t DS_SetFilterRateCmd(const DS_SetFilterRateCmd_t *BufPtr);
+
+/**
+ *  \brief Set destination file rate limits command handler
+ *
+ *  \par Description
+ *       Modify the packet and byte rate limits for the selected
+ *       entry in the destination file definitions table.
+ *       Reject invalid command packets
+ *       - generate error event if invalid command packet length
+ *       - generate error event if invalid file table index
+ *       - generate error event if file table is not loaded
+ *       Accept valid command packets
+ *       - update rate limits for selected file table entry
+ *       - generate success event (event type = info)
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] BufPtr Software Bus message pointer
+ *
+ *  \sa #DS_SET_DEST_RATE_CC, #DS_SetDestRateCmd_t
+ */
+CFE_Status_t DS_SetDestRateCmd(const DS_SetDestRateCmd_t *BufPtr);
+
 #endif
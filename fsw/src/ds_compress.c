@@ -0,0 +1,327 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+/**
+ * @file
+ *  CFS Data Storage (DS) block compression functions
+ */
+
+#include "cfe.h"
+
+#include "ds_platform_cfg.h"
+#include "ds_verify.h"
+
+#include "ds_app.h"
+#include "ds_compress.h"
+
+#include <string.h>
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Compress a block                                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 DS_CompressBlock(const uint8 *Src, uint32 SrcSize, uint8 *Dst, uint32 DstSize)
+{
+    uint32 Pos         = 0;
+    uint32 Anchor      = 0;
+    uint32 DstPos      = 0;
+    uint32 Value       = 0;
+    uint32 Hash        = 0;
+    uint32 Candidate   = 0;
+    uint32 MatchLength = 0;
+    bool   Fits        = true;
+
+    /*
+    ** Zero means no earlier position (positions are stored plus one)...
+    */
+    memset(DS_AppData.CompressHash, 0, sizeof(DS_AppData.CompressHash));
+
+    /*
+    ** Search for matches - the format requires literals at the end of the block...
+    */
+    while (Fits && ((Pos + DS_COMPRESS_MATCH_LIMIT) <= SrcSize))
+    {
+        Value = (uint32)Src[Pos] | ((uint32)Src[Pos + 1] << 8) | ((uint32)Src[Pos + 2] << 16) |
+                ((uint32)Src[Pos + 3] << 24);
+        Hash = (Value * 2654435761U) >> (32 - DS_COMPRESS_HASH_BITS);
+
+        Candidate                     = DS_AppData.CompressHash[Hash];
+        DS_AppData.CompressHash[Hash] = (uint16)(Pos + 1);
+
+        if ((Candidate != 0) && (memcmp(&Src[Candidate - 1], &Src[Pos], DS_COMPRESS_MIN_MATCH) == 0))
+        {
+            /*
+            ** Extend the match as far as possible...
+            */
+            Candidate--;
+            MatchLength = DS_COMPRESS_MIN_MATCH;
+
+            while (((Pos + MatchLength) < (SrcSize - DS_COMPRESS_LAST_LITERALS)) &&
+                   (Src[Candidate + MatchLength] == Src[Pos + MatchLength]))
+            {
+                MatchLength++;
+            }
+
+            Fits = DS_CompressSequence(Dst, DstSize, &DstPos, &Src[Anchor], Pos - Anchor, Pos - Candidate,
+                                       MatchLength);
+
+            Pos += MatchLength;
+            Anchor = Pos;
+        }
+        else
+        {
+            Pos++;
+        }
+    }
+
+    /*
+    ** Remaining bytes are written as the final literals only sequence...
+    */
+    if (Fits)
+    {
+        Fits = DS_CompressSequence(Dst, DstSize, &DstPos, &Src[Anchor], SrcSize - Anchor, 0, 0);
+    }
+
+    if (!Fits)
+    {
+        DstPos = 0;
+    }
+
+    return DstPos;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Write a compressed sequence                                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_CompressSequence(uint8 *Dst, uint32 DstSize, uint32 *DstPos, const uint8 *Literals, uint32 LiteralLength,
+                         uint32 Offset, uint32 MatchLength)
+{
+    uint32 WorstSize = 1 + LiteralLength;
+    uint32 Token     = 0;
+    uint32 Position  = *DstPos;
+    bool   Fits      = true;
+
+    /*
+    ** Verify the sequence fits with the longest length encoding...
+    */
+    if (LiteralLength >= DS_COMPRESS_TOKEN_MAX)
+    {
+        WorstSize += ((LiteralLength - DS_COMPRESS_TOKEN_MAX) / 255) + 1;
+    }
+
+    if (MatchLength != 0)
+    {
+        WorstSize += 2;
+
+        if ((MatchLength - DS_COMPRESS_MIN_MATCH) >= DS_COMPRESS_TOKEN_MAX)
+        {
+            WorstSize += ((MatchLength - DS_COMPRESS_MIN_MATCH - DS_COMPRESS_TOKEN_MAX) / 255) + 1;
+        }
+    }
+
+    if ((Position > DstSize) || (WorstSize > (DstSize - Position)))
+    {
+        Fits = false;
+    }
+    else
+    {
+        /*
+        ** Token, literal length, literals...
+        */
+        Token = (LiteralLength < DS_COMPRESS_TOKEN_MAX) ? LiteralLength : DS_COMPRESS_TOKEN_MAX;
+        Token <<= 4;
+
+        if (MatchLength != 0)
+        {
+            Token |= ((MatchLength - DS_COMPRESS_MIN_MATCH) < DS_COMPRESS_TOKEN_MAX)
+                         ? (MatchLength - DS_COMPRESS_MIN_MATCH)
+                         : DS_COMPRESS_TOKEN_MAX;
+        }
+
+        Dst[Position++] = (uint8)Token;
+
+        if (LiteralLength >= DS_COMPRESS_TOKEN_MAX)
+        {
+            Position = DS_CompressLength(Dst, Position, LiteralLength - DS_COMPRESS_TOKEN_MAX);
+        }
+
+        memcpy(&Dst[Position], Literals, LiteralLength);
+        Position += LiteralLength;
+
+        /*
+        ** Match offset and match length...
+        */
+        if (MatchLength != 0)
+        {
+            Dst[Position++] = (uint8)(Offset & 0xFF);
+            Dst[Position++] = (uint8)(Offset >> 8);
+
+            if ((MatchLength - DS_COMPRESS_MIN_MATCH) >= DS_COMPRESS_TOKEN_MAX)
+            {
+                Position =
+                    DS_CompressLength(Dst, Position, MatchLength - DS_COMPRESS_MIN_MATCH - DS_COMPRESS_TOKEN_MAX);
+            }
+        }
+
+        *DstPos = Position;
+    }
+
+    return Fits;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Write an extended sequence length                               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 DS_CompressLength(uint8 *Dst, uint32 DstPos, uint32 Length)
+{
+    while (Length >= 255)
+    {
+        Dst[DstPos++] = 255;
+        Length -= 255;
+    }
+
+    Dst[DstPos++] = (uint8)Length;
+
+    return DstPos;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Decompress a block                                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 DS_DecompressBlock(const uint8 *Src, uint32 SrcSize, uint8 *Dst, uint32 DstSize)
+{
+    uint32 SrcPos = 0;
+    uint32 DstPos = 0;
+    uint32 Token  = 0;
+    uint32 Length = 0;
+    uint32 Offset = 0;
+    bool   Valid  = true;
+    bool   Done   = false;
+
+    while (Valid && !Done)
+    {
+        /*
+        ** Token, literal length, literals...
+        */
+        Valid = (SrcPos < SrcSize);
+
+        if (Valid)
+        {
+            Token  = Src[SrcPos++];
+            Length = Token >> 4;
+            Valid  = DS_DecompressLength(Src, SrcSize, &SrcPos, &Length);
+        }
+
+        if (Valid)
+        {
+            Valid = ((Length <= (SrcSize - SrcPos)) && (Length <= (DstSize - DstPos)));
+        }
+
+        if (Valid)
+        {
+            memcpy(&Dst[DstPos], &Src[SrcPos], Length);
+            SrcPos += Length;
+            DstPos += Length;
+
+            /*
+            ** The last sequence has no match...
+            */
+            Done = (SrcPos == SrcSize);
+        }
+
+        /*
+        ** Match offset, match length, match (may overlap itself)...
+        */
+        if (Valid && !Done)
+        {
+            Valid = ((SrcSize - SrcPos) >= 2);
+
+            if (Valid)
+            {
+                Offset = (uint32)Src[SrcPos] | ((uint32)Src[SrcPos + 1] << 8);
+                SrcPos += 2;
+                Length = Token & 0x0F;
+                Valid  = DS_DecompressLength(Src, SrcSize, &SrcPos, &Length);
+            }
+
+            if (Valid)
+            {
+                Length += DS_COMPRESS_MIN_MATCH;
+                Valid = ((Offset != 0) && (Offset <= DstPos) && (Length <= (DstSize - DstPos)));
+            }
+
+            if (Valid)
+            {
+                while (Length > 0)
+                {
+                    Dst[DstPos] = Dst[DstPos - Offset];
+                    DstPos++;
+                    Length--;
+                }
+            }
+        }
+    }
+
+    if (!Valid)
+    {
+        DstPos = 0;
+    }
+
+    return DstPos;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Read an extended sequence length                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_DecompressLength(const uint8 *Src, uint32 SrcSize, uint32 *SrcPos, uint32 *Length)
+{
+    uint32 Position = *SrcPos;
+    uint32 Value    = 255;
+    bool   Valid    = true;
+
+    if (*Length == DS_COMPRESS_TOKEN_MAX)
+    {
+        while (Valid && (Value == 255))
+        {
+            Valid = (Position < SrcSize);
+
+            if (Valid)
+            {
+                Value = Src[Position++];
+                *Length += Value;
+            }
+        }
+
+        *SrcPos = Position;
+    }
+
+    return Valid;
+}
@@ -0,0 +1,168 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+/**
+ * @file
+ *   CFS Data Storage (DS) block compression header file
+ */
+#ifndef DS_COMPRESS_H
+#define DS_COMPRESS_H
+
+#include "cfe.h"
+
+#include "ds_platform_cfg.h"
+#include "ds_app.h"
+
+/**
+ * \brief Smallest match the compressor will encode (bytes)
+ */
+#define DS_COMPRESS_MIN_MATCH 4
+
+/**
+ * \brief Bytes at the end of a block that are always literals
+ */
+#define DS_COMPRESS_LAST_LITERALS 5
+
+/**
+ * \brief Last match must start at least this many bytes before the end of a block
+ */
+#define DS_COMPRESS_MATCH_LIMIT 12
+
+/**
+ * \brief Largest length that fits in a sequence token nibble
+ */
+#define DS_COMPRESS_TOKEN_MAX 15
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* DS block compression function prototypes                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**
+ *  \brief Compress a block
+ *
+ *  \par Description
+ *       This function compresses one block of packet data into the LZ4
+ *       block format: a series of sequences, each a token byte (literal
+ *       length in the high nibble, match length minus 4 in the low
+ *       nibble, 15 meaning more length bytes follow), the literal bytes,
+ *       and a 2 byte little endian match offset.  The last sequence has
+ *       literals only.  Matches are found with a single entry hash table
+ *       of 4 byte values, which is fast and needs no other memory.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Each block is compressed without reference to earlier blocks.
+ *       The source block must not be larger than #DS_COMPRESS_BLOCK_SIZE.
+ *
+ *  \param[in]  Src     Pointer to data to compress
+ *  \param[in]  SrcSize Number of bytes to compress
+ *  \param[out] Dst     Pointer to compressed data buffer
+ *  \param[in]  DstSize Size of compressed data buffer
+ *
+ *  \return Compressed size in bytes, zero if the result does not fit in DstSize
+ */
+uint32 DS_CompressBlock(const uint8 *Src, uint32 SrcSize, uint8 *Dst, uint32 DstSize);
+
+/**
+ *  \brief Write a compressed sequence
+ *
+ *  \par Description
+ *       This function appends one sequence (token, literals and match)
+ *       to the compressed data buffer.  A match length of zero writes
+ *       the final literals only sequence.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Nothing is written unless the worst case sequence size fits.
+ *
+ *  \param[out]    Dst           Pointer to compressed data buffer
+ *  \param[in]     DstSize       Size of compressed data buffer
+ *  \param[in,out] DstPos        Offset of next compressed byte
+ *  \param[in]     Literals      Pointer to literal bytes
+ *  \param[in]     LiteralLength Number of literal bytes
+ *  \param[in]     Offset        Distance back to the match
+ *  \param[in]     MatchLength   Number of matching bytes (zero = none)
+ *
+ *  \return Boolean sequence fits response
+ *  \retval true  Sequence written
+ *  \retval false Compressed data buffer is full
+ */
+bool DS_CompressSequence(uint8 *Dst, uint32 DstSize, uint32 *DstPos, const uint8 *Literals, uint32 LiteralLength,
+                         uint32 Offset, uint32 MatchLength);
+
+/**
+ *  \brief Write an extended sequence length
+ *
+ *  \par Description
+ *       This function writes the length bytes that follow a token nibble
+ *       of 15: runs of 255 and then the remainder.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The caller has verified that the length bytes fit.
+ *
+ *  \param[out] Dst    Pointer to compressed data buffer
+ *  \param[in]  DstPos Offset of next compressed byte
+ *  \param[in]  Length Length that was too large for the token nibble
+ *
+ *  \return Offset of next compressed byte
+ */
+uint32 DS_CompressLength(uint8 *Dst, uint32 DstPos, uint32 Length);
+
+/**
+ *  \brief Decompress a block
+ *
+ *  \par Description
+ *       This function decodes one block written by #DS_CompressBlock (or
+ *       any LZ4 block format encoder).  Every length and offset is checked
+ *       against the buffers so that damaged data cannot cause a read or
+ *       write outside of them.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Flight software does not read compressed files, this function
+ *       defines the format for ground tools and is used to verify it.
+ *
+ *  \param[in]  Src     Pointer to compressed data
+ *  \param[in]  SrcSize Number of compressed bytes
+ *  \param[out] Dst     Pointer to decompressed data buffer
+ *  \param[in]  DstSize Size of decompressed data buffer
+ *
+ *  \return Decompressed size in bytes, zero if the compressed data is invalid
+ */
+uint32 DS_DecompressBlock(const uint8 *Src, uint32 SrcSize, uint8 *Dst, uint32 DstSize);
+
+/**
+ *  \brief Read an extended sequence length
+ *
+ *  \par Description
+ *       This function adds the length bytes that follow a token nibble
+ *       of 15 to the length.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in]     Src     Pointer to compressed data
+ *  \param[in]     SrcSize Number of compressed bytes
+ *  \param[in,out] SrcPos  Offset of next compressed byte
+ *  \param[in,out] Length  Length from the token nibble
+ *
+ *  \return Boolean valid length response
+ *  \retval true  Length read
+ *  \retval false Compressed data ends within the length bytes
+ */
+bool DS_DecompressLength(const uint8 *Src, uint32 SrcSize, uint32 *SrcPos, uint32 *Length);
+
+#endif
@@ -357,6 +357,202 @@ void DS_RemoveMIDVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
     }
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Extract packets from data storage file                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_ExtractFileVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+{
+    if (DS_VerifyLength(BufPtr, sizeof(DS_ExtractFileCmd_t), DS_EXTRACT_CMD_ERR_EID, "EXTRACT FILE"))
+    {
+        DS_ExtractFileCmd((const DS_ExtractFileCmd_t *)BufPtr);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Start replay of data storage file                               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_ReplayStartVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+{
+    if (DS_VerifyLength(BufPtr, sizeof(DS_ReplayStartCmd_t), DS_REPLAY_START_CMD_ERR_EID, "REPLAY START"))
+    {
+        DS_ReplayStartCmd((const DS_ReplayStartCmd_t *)BufPtr);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Stop replay of data storage file                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_ReplayStopVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+{
+    if (DS_VerifyLength(BufPtr, sizeof(DS_ReplayStopCmd_t), DS_REPLAY_CTRL_CMD_ERR_EID, "REPLAY STOP"))
+    {
+        DS_ReplayStopCmd((const DS_ReplayStopCmd_t *)BufPtr);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Pause replay of data storage file                               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_ReplayPauseVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+{
+    if (DS_VerifyLength(BufPtr, sizeof(DS_ReplayPauseCmd_t), DS_REPLAY_CTRL_CMD_ERR_EID, "REPLAY PAUSE"))
+    {
+        DS_ReplayPauseCmd((const DS_ReplayPauseCmd_t *)BufPtr);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Resume replay of data storage file                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_ReplayResumeVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+{
+    if (DS_VerifyLength(BufPtr, sizeof(DS_ReplayResumeCmd_t), DS_REPLAY_CTRL_CMD_ERR_EID, "REPLAY RESUME"))
+    {
+        DS_ReplayResumeCmd((const DS_ReplayResumeCmd_t *)BufPtr);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Move replay of data storage file                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_ReplaySeekVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+{
+    if (DS_VerifyLength(BufPtr, sizeof(DS_ReplaySeekCmd_t), DS_REPLAY_SEEK_CMD_ERR_EID, "REPLAY SEEK"))
+    {
+        DS_ReplaySeekCmd((const DS_ReplaySeekCmd_t *)BufPtr);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Set packet filter table entry rate limits                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_SetFilterRateVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+{
+    if (DS_VerifyLength(BufPtr, sizeof(DS_SetFilterRateCmd_t), DS_FILTER_RATE_CMD_ERR_EID, "FILTER RATE"))
+    {
+        DS_SetFilterRateCmd((const DS_SetFilterRateCmd_t *)BufPtr);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Set destination file rate limits                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_SetDestRateVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+{
+    if (DS_VerifyLength(BufPtr, sizeof(DS_SetDestRateCmd_t), DS_DEST_RATE_CMD_ERR_EID, "DEST RATE"))
+    {
+        DS_SetDestRateCmd((const DS_SetDestRateCmd_t *)BufPtr);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Get destination statistics packet                               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_GetDestStatsVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+{
+    if (DS_VerifyLength(BufPtr, sizeof(DS_GetDestStatsCmd_t), DS_GET_DEST_STATS_CMD_ERR_EID, "GET DEST STATS"))
+    {
+        DS_GetDestStatsCmd((const DS_GetDestStatsCmd_t *)BufPtr);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Set flight recorder                                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_SetRecorderVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+{
+    if (DS_VerifyLength(BufPtr, sizeof(DS_SetRecorderCmd_t), DS_SET_RECORDER_CMD_ERR_EID, "RECORDER"))
+    {
+        DS_SetRecorderCmd((const DS_SetRecorderCmd_t *)BufPtr);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Trigger flight recorder dump                                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_TriggerRecorderVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+{
+    if (DS_VerifyLength(BufPtr, sizeof(DS_TriggerRecorderCmd_t), DS_TRIGGER_RECORDER_CMD_ERR_EID, "TRIGGER"))
+    {
+        DS_TriggerRecorderCmd((const DS_TriggerRecorderCmd_t *)BufPtr);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Send latest-value cache packet                                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_SendCacheVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+{
+    if (DS_VerifyLength(BufPtr, sizeof(DS_SendCacheCmd_t), DS_SEND_CACHE_CMD_ERR_EID, "SEND CACHE"))
+    {
+        DS_SendCacheCmd((const DS_SendCacheCmd_t *)BufPtr);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Write latest-value cache snapshot file                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_WriteCacheVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+{
+    if (DS_VerifyLength(BufPtr, sizeof(DS_WriteCacheCmd_t), DS_WRITE_CACHE_CMD_ERR_EID, "WRITE CACHE"))
+    {
+        DS_WriteCacheCmd((const DS_WriteCacheCmd_t *)BufPtr);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Get closed file manifest                                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_GetManifestVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+{
+    if (DS_VerifyLength(BufPtr, sizeof(DS_GetManifestCmd_t), DS_GET_MANIFEST_CMD_ERR_EID, "GET MANIFEST"))
+    {
+        DS_GetManifestCmd((const DS_GetManifestCmd_t *)BufPtr);
+    }
+}
+
 void DS_SendHkVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
 {
     if (DS_VerifyLength(BufPtr, sizeof(DS_SendHkCmd_t), DS_HKREQ_LEN_ERR_EID, "SEND HK"))
@@ -365,6 +561,14 @@ void DS_SendHkVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
     }
 }
 
+void DS_BacklogProbeVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+{
+    if (DS_VerifyLength(BufPtr, sizeof(DS_BacklogProbeCmd_t), DS_HKREQ_LEN_ERR_EID, "BACKLOG PROBE"))
+    {
+        DS_BacklogProbeCmd((const DS_BacklogProbeCmd_t *)BufPtr);
+    }
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Process Software Bus messages                                   */
@@ -373,16 +577,18 @@ void DS_SendHkVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
 
 void DS_AppPipe(const CFE_SB_Buffer_t *BufPtr)
 {
-    static CFE_SB_MsgId_t CMD_MID     = CFE_SB_MSGID_RESERVED;
-    static CFE_SB_MsgId_t SEND_HK_MID = CFE_SB_MSGID_RESERVED;
+    static CFE_SB_MsgId_t CMD_MID           = CFE_SB_MSGID_RESERVED;
+    static CFE_SB_MsgId_t SEND_HK_MID       = CFE_SB_MSGID_RESERVED;
+    static CFE_SB_MsgId_t BACKLOG_PROBE_MID = CFE_SB_MSGID_RESERVED;
 
     CFE_SB_MsgId_t MessageID = CFE_SB_INVALID_MSG_ID;
 
     /* cache the local MID Values here, this avoids repeat lookups */
     if (!CFE_SB_IsValidMsgId(CMD_MID))
     {
-        CMD_MID     = CFE_SB_ValueToMsgId(DS_CMD_MID);
-        SEND_HK_MID = CFE_SB_ValueToMsgId(DS_SEND_HK_MID);
+        CMD_MID           = CFE_SB_ValueToMsgId(DS_CMD_MID);
+        SEND_HK_MID       = CFE_SB_ValueToMsgId(DS_SEND_HK_MID);
+        BACKLOG_PROBE_MID = CFE_SB_ValueToMsgId(DS_BACKLOG_PROBE_MID);
     }
 
     CFE_MSG_GetMsgId(&BufPtr->Msg, &MessageID);
@@ -409,6 +615,13 @@ void DS_AppPipe(const CFE_SB_Buffer_t *BufPtr)
             DS_AppStorePacket(MessageID, BufPtr);
         }
     }
+    else if (CFE_SB_MsgId_Equal(MessageID, BACKLOG_PROBE_MID))
+    {
+        /*
+        ** DS pipe backlog probe (never stored)...
+        */
+        DS_BacklogProbeVerifyDispatch(BufPtr);
+    }
     else
     {
         /*
@@ -565,6 +778,95 @@ void DS_AppProcessCmd(const CFE_SB_Buffer_t *BufPtr)
             DS_CloseAllVerifyDispatch(BufPtr);
             break;
 
+        /*
+        ** Extract packets from data storage file (child task)...
+        */
+        case DS_EXTRACT_FILE_CC:
+            DS_ExtractFileVerifyDispatch(BufPtr);
+            break;
+
+        /*
+        ** Start replay of data storage file (child task)...
+        */
+        case DS_REPLAY_START_CC:
+            DS_ReplayStartVerifyDispatch(BufPtr);
+            break;
+
+        /*
+        ** Stop, pause or resume replay in progress...
+        */
+        case DS_REPLAY_STOP_CC:
+            DS_ReplayStopVerifyDispatch(BufPtr);
+            break;
+
+        case DS_REPLAY_PAUSE_CC:
+            DS_ReplayPauseVerifyDispatch(BufPtr);
+            break;
+
+        case DS_REPLAY_RESUME_CC:
+            DS_ReplayResumeVerifyDispatch(BufPtr);
+            break;
+
+        /*
+        ** Move replay in progress to a packet time...
+        */
+        case DS_REPLAY_SEEK_CC:
+            DS_ReplaySeekVerifyDispatch(BufPtr);
+            break;
+
+        /*
+        ** Set packet and byte rate limits...
+        */
+        case DS_SET_FILTER_RATE_CC:
+            DS_SetFilterRateVerifyDispatch(BufPtr);
+            break;
+
+        case DS_SET_DEST_RATE_CC:
+            DS_SetDestRateVerifyDispatch(BufPtr);
+            break;
+
+        /*
+        ** Get destination statistics packet...
+        */
+        case DS_GET_DEST_STATS_CC:
+            DS_GetDestStatsVerifyDispatch(BufPtr);
+            break;
+
+        /*
+        ** Set flight recorder...
+        */
+        case DS_SET_RECORDER_CC:
+            DS_SetRecorderVerifyDispatch(BufPtr);
+            break;
+
+        /*
+        ** Trigger flight recorder dump...
+        */
+        case DS_TRIGGER_RECORDER_CC:
+            DS_TriggerRecorderVerifyDispatch(BufPtr);
+            break;
+
+        /*
+        ** Send latest-value cache packet...
+        */
+        case DS_SEND_CACHE_CC:
+            DS_SendCacheVerifyDispatch(BufPtr);
+            break;
+
+        /*
+        ** Write latest-value cache snapshot file...
+        */
+        case DS_WRITE_CACHE_CC:
+            DS_WriteCacheVerifyDispatch(BufPtr);
+            break;
+
+        /*
+        ** Get closed file manifest command...
+        */
+        case DS_GET_MANIFEST_CC:
+            DS_GetManifestVerifyDispatch(BufPtr);
+            break;
+
         /*
         ** DS application command with unknown command code...
         */
@@ -61,10 +61,28 @@ static const EdsDispatchTable_EdsComponent_DS_Application_CFE_SB_Telecommand_t D
         .NoopCmd_indication = DS_NoopCmd,
         .RemoveMidCmd_indication = DS_RemoveMidCmd,
         .ResetCountersCmd_indication = DS_ResetCountersCmd,
+        .ExtractFileCmd_indication = DS_ExtractFileCmd,
+        .ReplayStartCmd_indication = DS_ReplayStartCmd,
+        .ReplayStopCmd_indication = DS_ReplayStopCmd,
+        .ReplayPauseCmd_indication = DS_ReplayPauseCmd,
+        .ReplayResumeCmd_indication = DS_ReplayResumeCmd,
+        .ReplaySeekCmd_indication = DS_ReplaySeekCmd,
+        .SetFilterRateCmd_indication = DS_SetFilterRateCmd,
+        .SetDestRateCmd_indication = DS_SetDestRateCmd,
+        .GetDestStatsCmd_indication = DS_GetDestStatsCmd,
+        .SetRecorderCmd_indication = DS_SetRecorderCmd,
+        .TriggerRecorderCmd_indication = DS_TriggerRecorderCmd,
+        .SendCacheCmd_indication = DS_SendCacheCmd,
+        .WriteCacheCmd_indication = DS_WriteCacheCmd,
+        .GetManifestCmd_indication = DS_GetManifestCmd,
     },
     .SEND_HK          =
     {
         .indication = DS_SendHkCmd
+    },
+    .BACKLOG_PROBE    =
+    {
+        .indication = DS_BacklogProbeCmd
     }
 };
 /* clang-format on */
@@ -89,6 +107,20 @@ const uint16 DS_EVENTID_CC_LOOKUP[] = {
     [DS_GET_FILE_INFO_CC]    = DS_GET_FILE_INFO_CMD_ERR_EID,
     [DS_ADD_MID_CC]          = DS_ADD_MID_CMD_ERR_EID,
     [DS_REMOVE_MID_CC]       = DS_REMOVE_MID_CMD_ERR_EID,
+    [DS_EXTRACT_FILE_CC]     = DS_EXTRACT_CMD_ERR_EID,
+    [DS_REPLAY_START_CC]     = DS_REPLAY_START_CMD_ERR_EID,
+    [DS_REPLAY_STOP_CC]      = DS_REPLAY_CTRL_CMD_ERR_EID,
+    [DS_REPLAY_PAUSE_CC]     = DS_REPLAY_CTRL_CMD_ERR_EID,
+    [DS_REPLAY_RESUME_CC]    = DS_REPLAY_CTRL_CMD_ERR_EID,
+    [DS_REPLAY_SEEK_CC]      = DS_REPLAY_SEEK_CMD_ERR_EID,
+    [DS_SET_FILTER_RATE_CC]  = DS_FILTER_RATE_CMD_ERR_EID,
+    [DS_SET_DEST_RATE_CC]    = DS_DEST_RATE_CMD_ERR_EID,
+    [DS_GET_DEST_STATS_CC]   = DS_GET_DEST_STATS_CMD_ERR_EID,
+    [DS_SET_RECORDER_CC]     = DS_SET_RECORDER_CMD_ERR_EID,
+    [DS_TRIGGER_RECORDER_CC] = DS_TRIGGER_RECORDER_CMD_ERR_EID,
+    [DS_SEND_CACHE_CC]       = DS_SEND_CACHE_CMD_ERR_EID,
+    [DS_WRITE_CACHE_CC]      = DS_WRITE_CACHE_CMD_ERR_EID,
+    [DS_GET_MANIFEST_CC]     = DS_GET_MANIFEST_CMD_ERR_EID,
 };
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -0,0 +1,639 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  CFS Data Storage (DS) file extraction functions
+ */
+
+#include "cfe.h"
+#include "cfe_fs.h"
+
+#include "ds_platform_cfg.h"
+#include "ds_verify.h"
+
+#include "ds_appdefs.h"
+#include "ds_perfids.h"
+
+#include "ds_msg.h"
+#include "ds_app.h"
+#include "ds_file.h"
+#include "ds_extract.h"
+#include "ds_eventids.h"
+
+#include <stdio.h>
+#include <string.h>
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Initialize file extraction                                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+CFE_Status_t DS_ExtractInit(void)
+{
+    CFE_Status_t Result;
+
+    DS_AppData.ExtractState = DS_EXTRACT_IDLE;
+
+    /*
+    ** Extract command gives the semaphore to start an extraction...
+    */
+    Result = OS_CountSemCreate(&DS_AppData.ExtractSemaphore, DS_EXTRACT_TASK_NAME, 0, 0);
+
+    if (Result != OS_SUCCESS)
+    {
+        CFE_EVS_SendEvent(DS_INIT_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Unable to create extraction semaphore, err = 0x%08X", (unsigned int)Result);
+    }
+    else
+    {
+        /*
+        ** Child task runs below DS so extraction never delays storage...
+        */
+        Result = CFE_ES_CreateChildTask(&DS_AppData.ExtractTaskId, DS_EXTRACT_TASK_NAME, DS_ExtractTask,
+                                        CFE_ES_TASK_STACK_ALLOCATE, DS_EXTRACT_TASK_STACK_SIZE,
+                                        DS_EXTRACT_TASK_PRIORITY, 0);
+
+        if (Result != CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(DS_INIT_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Unable to create extraction child task, err = 0x%08X", (unsigned int)Result);
+        }
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* File extraction child task entry point                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_ExtractTask(void)
+{
+    int32 Result;
+
+    do
+    {
+        Result = OS_CountSemTake(DS_AppData.ExtractSemaphore);
+
+        if (Result == OS_SUCCESS)
+        {
+            CFE_ES_PerfLogEntry(DS_EXTRACT_PERF_ID);
+
+            DS_ExtractFile();
+
+            CFE_ES_PerfLogExit(DS_EXTRACT_PERF_ID);
+
+            DS_AppData.ExtractState = DS_EXTRACT_IDLE;
+        }
+    } while (Result == OS_SUCCESS);
+
+    /*
+    ** Extract command rejects requests once the task has stopped...
+    */
+    DS_AppData.ExtractSemaphore = OS_OBJECT_ID_UNDEFINED;
+    DS_AppData.ExtractState     = DS_EXTRACT_IDLE;
+
+    CFE_EVS_SendEvent(DS_EXTRACT_ERR_EID, CFE_EVS_EventType_ERROR,
+                      "File extraction task terminating, semaphore err = %d", (int)Result);
+
+    CFE_ES_ExitChildTask();
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Perform a file extraction                                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_ExtractFile(void)
+{
+    DS_ExtractFile_Payload_t *Request      = &DS_AppData.ExtractRequest;
+    osal_id_t                 SourceHandle = OS_OBJECT_ID_UNDEFINED;
+    osal_id_t                 TargetHandle = OS_OBJECT_ID_UNDEFINED;
+    const char *              FailedStep   = NULL;
+    uint32                    HeaderSize   = 0;
+    uint32                    FileSize     = 0;
+    uint32                    DataStart    = 0;
+    uint32                    DataEnd      = 0;
+    int32                     Result;
+
+    DS_AppData.ExtractBytesScanned = 0;
+    DS_AppData.ExtractPacketCount  = 0;
+
+    /*
+    ** Packet data follows the same headers written by DS_FileCreateDest...
+    */
+    if (DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE)
+    {
+        HeaderSize = sizeof(CFE_FS_Header_t) + sizeof(DS_FileHeader_t);
+    }
+
+    Result = OS_OpenCreate(&SourceHandle, Request->SourceName, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+
+    if (Result != OS_SUCCESS)
+    {
+        SourceHandle = OS_OBJECT_ID_UNDEFINED;
+        FailedStep   = "open source";
+    }
+    else
+    {
+        Result = OS_OpenCreate(&TargetHandle, Request->TargetName, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE,
+                               OS_WRITE_ONLY);
+
+        if (Result != OS_SUCCESS)
+        {
+            TargetHandle = OS_OBJECT_ID_UNDEFINED;
+            FailedStep   = "create target";
+        }
+    }
+
+    if (Result == OS_SUCCESS)
+    {
+        Result = DS_ExtractDataRange(SourceHandle, HeaderSize, &FileSize, &DataEnd);
+
+        if (Result != OS_SUCCESS)
+        {
+            FailedStep = "size source";
+        }
+    }
+
+    if (Result == OS_SUCCESS)
+    {
+        Result = DS_ExtractCheckFormat(SourceHandle, HeaderSize, DataEnd);
+
+        if (Result != OS_SUCCESS)
+        {
+            FailedStep = "check format";
+        }
+    }
+
+    if (Result == OS_SUCCESS)
+    {
+        /*
+        ** Sidecar index (when usable) avoids reading the whole file...
+        */
+        DataStart = HeaderSize;
+        DS_ExtractIndexRange(Request->SourceName, Request->StartSeconds, Request->StopSeconds, FileSize, &DataStart,
+                             &DataEnd);
+
+        Result = DS_ExtractCopyHeader(SourceHandle, TargetHandle, HeaderSize);
+
+        if (Result != OS_SUCCESS)
+        {
+            FailedStep = "copy header";
+        }
+    }
+
+    if (Result == OS_SUCCESS)
+    {
+        Result = DS_ExtractScan(SourceHandle, TargetHandle, DataStart, DataEnd);
+
+        if (Result == OS_ERR_NOT_IMPLEMENTED)
+        {
+            FailedStep = "unsupported record";
+        }
+        else if (Result != OS_SUCCESS)
+        {
+            FailedStep = "scan source";
+        }
+    }
+
+    if (OS_ObjectIdDefined(TargetHandle))
+    {
+        OS_close(TargetHandle);
+    }
+
+    if (OS_ObjectIdDefined(SourceHandle))
+    {
+        OS_close(SourceHandle);
+    }
+
+    if (Result == OS_SUCCESS)
+    {
+        CFE_EVS_SendEvent(DS_EXTRACT_DONE_EID, CFE_EVS_EventType_INFORMATION,
+                          "File extraction complete: target = '%s', bytes scanned = %u, packets = %u",
+                          Request->TargetName, (unsigned int)DS_AppData.ExtractBytesScanned,
+                          (unsigned int)DS_AppData.ExtractPacketCount);
+    }
+    else
+    {
+        DS_AppData.ExtractErrCounter++;
+
+        CFE_EVS_SendEvent(DS_EXTRACT_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "File extraction error: %s, result = %d, source = '%s', target = '%s'", FailedStep,
+                          (int)Result, Request->SourceName, Request->TargetName);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Reject source files that do not hold plain packets              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 DS_ExtractCheckFormat(osal_id_t SourceHandle, uint32 DataStart, uint32 DataEnd)
+{
+    uint32 FirstWord = 0;
+    int32  Result    = OS_SUCCESS;
+
+    if (DataEnd >= (DataStart + sizeof(FirstWord)))
+    {
+        Result = OS_lseek(SourceHandle, DataStart, OS_SEEK_SET);
+
+        if (Result == DataStart)
+        {
+            Result = OS_read(SourceHandle, &FirstWord, sizeof(FirstWord));
+        }
+        else if (Result >= 0)
+        {
+            Result = OS_ERR_INVALID_SIZE;
+        }
+
+        if (Result == sizeof(FirstWord))
+        {
+            Result = OS_SUCCESS;
+
+            /*
+            ** Compressed files start with a block header and ring files with a
+            ** ring header (whose first field is the offset following itself)...
+            */
+            if ((FirstWord == DS_FILE_BLOCK_MAGIC) || (FirstWord == (DataStart + sizeof(DS_FileRingHeader_t))))
+            {
+                Result = OS_ERR_NOT_IMPLEMENTED;
+            }
+        }
+        else if (Result >= 0)
+        {
+            Result = OS_ERR_INVALID_SIZE;
+        }
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Get source file packet data range                               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 DS_ExtractDataRange(osal_id_t SourceHandle, uint32 DataStart, uint32 *FileSize, uint32 *DataEnd)
+{
+    DS_FileTrailerFooter_t Footer;
+    int32                  Result;
+
+    Result = OS_lseek(SourceHandle, 0, OS_SEEK_END);
+
+    if (Result >= 0)
+    {
+        *FileSize = Result;
+        *DataEnd  = Result;
+        Result    = OS_SUCCESS;
+
+        /*
+        ** Summary trailer (if any) is not packet data...
+        */
+        if (*FileSize >= (DataStart + sizeof(DS_FileTrailerFooter_t)))
+        {
+            Result = OS_lseek(SourceHandle, *FileSize - sizeof(DS_FileTrailerFooter_t), OS_SEEK_SET);
+
+            if (Result >= 0)
+            {
+                Result = OS_read(SourceHandle, &Footer, sizeof(DS_FileTrailerFooter_t));
+            }
+
+            if (Result == sizeof(DS_FileTrailerFooter_t))
+            {
+                Result = OS_SUCCESS;
+
+                if ((Footer.Magic == DS_FILE_TRAILER_MAGIC) && (Footer.TrailerSize >= sizeof(DS_FileTrailerFooter_t)) &&
+                    (Footer.TrailerSize <= (*FileSize - DataStart)))
+                {
+                    *DataEnd = *FileSize - Footer.TrailerSize;
+                }
+            }
+            else if (Result >= 0)
+            {
+                Result = OS_ERR_INVALID_SIZE;
+            }
+        }
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Narrow packet data range using the sidecar index file           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_ExtractIndexRange(const char *SourceName, uint32 StartSeconds, uint32 StopSeconds, uint32 FileSize,
+                          uint32 *DataStart, uint32 *DataEnd)
+{
+    osal_id_t            IndexHandle = OS_OBJECT_ID_UNDEFINED;
+    DS_FileIndexHeader_t IndexHeader;
+    DS_FileIndexRecord_t Records[DS_INDEX_BUFFER_RECORDS];
+    char                 IndexName[DS_TOTAL_FNAME_BUFSIZE];
+    uint32               RangeStart = *DataStart;
+    uint32               RangeEnd   = *DataEnd;
+    uint32               Remaining  = 0;
+    uint32               Count;
+    uint32               i;
+    bool                 Done = false;
+    int32                Result;
+
+    Result = snprintf(IndexName, sizeof(IndexName), "%s%s", SourceName, DS_INDEX_FILE_EXTENSION);
+
+    if ((Result > 0) && (Result < sizeof(IndexName)))
+    {
+        Result = OS_OpenCreate(&IndexHandle, IndexName, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+
+        if (Result == OS_SUCCESS)
+        {
+            Result = OS_read(IndexHandle, &IndexHeader, sizeof(DS_FileIndexHeader_t));
+
+            /*
+            ** Only a finalized index for this exact file can be trusted...
+            */
+            if ((Result == sizeof(DS_FileIndexHeader_t)) && (IndexHeader.DataFileSize == FileSize))
+            {
+                Remaining = IndexHeader.RecordCount;
+            }
+
+            while ((Remaining > 0) && !Done)
+            {
+                Count = Remaining;
+                if (Count > DS_INDEX_BUFFER_RECORDS)
+                {
+                    Count = DS_INDEX_BUFFER_RECORDS;
+                }
+
+                Result = OS_read(IndexHandle, Records, Count * sizeof(DS_FileIndexRecord_t));
+
+                if (Result != (Count * sizeof(DS_FileIndexRecord_t)))
+                {
+                    Done = true;
+                }
+
+                for (i = 0; (i < Count) && !Done; i++)
+                {
+                    if ((Records[i].FileOffset < *DataStart) || (Records[i].FileOffset > *DataEnd))
+                    {
+                        /*
+                        ** Record does not describe this data range...
+                        */
+                        RangeStart = *DataStart;
+                        RangeEnd   = *DataEnd;
+                        Done       = true;
+                    }
+                    else if (Records[i].Seconds < StartSeconds)
+                    {
+                        /*
+                        ** Packets before this record are all too early...
+                        */
+                        RangeStart = Records[i].FileOffset;
+                    }
+                    else if (Records[i].Seconds > StopSeconds)
+                    {
+                        /*
+                        ** Packets from this record on are all too late...
+                        */
+                        RangeEnd = Records[i].FileOffset;
+                        Done     = true;
+                    }
+                }
+
+                Remaining -= Count;
+            }
+
+            OS_close(IndexHandle);
+        }
+    }
+
+    *DataStart = RangeStart;
+    *DataEnd   = RangeEnd;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Copy source file headers to target file                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 DS_ExtractCopyHeader(osal_id_t SourceHandle, osal_id_t TargetHandle, uint32 HeaderSize)
+{
+    int32 Result = OS_SUCCESS;
+
+    if (HeaderSize > 0)
+    {
+        Result = OS_lseek(SourceHandle, 0, OS_SEEK_SET);
+
+        if (Result == 0)
+        {
+            Result = OS_read(SourceHandle, DS_AppData.ExtractBuffer, HeaderSize);
+        }
+
+        if (Result == HeaderSize)
+        {
+            Result = OS_write(TargetHandle, DS_AppData.ExtractBuffer, HeaderSize);
+        }
+
+        if (Result == HeaderSize)
+        {
+            Result = OS_SUCCESS;
+        }
+        else if (Result >= 0)
+        {
+            Result = OS_ERR_INVALID_SIZE;
+        }
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Scan source file packets                                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 DS_ExtractScan(osal_id_t SourceHandle, osal_id_t TargetHandle, uint32 DataStart, uint32 DataEnd)
+{
+    uint8 *                  Buffer      = (uint8 *)DS_AppData.ExtractBuffer;
+    const CFE_MSG_Message_t *MsgPtr      = NULL;
+    CFE_MSG_Size_t           PacketSize  = 0;
+    uint32                   Offset      = DataStart;
+    uint32                   BufferCount = 0;
+    uint32                   Position;
+    uint32                   ReadSize;
+    bool                     NeedData;
+    int32                    Result;
+
+    Result = OS_lseek(SourceHandle, DataStart, OS_SEEK_SET);
+
+    if (Result == DataStart)
+    {
+        Result = OS_SUCCESS;
+    }
+    else if (Result >= 0)
+    {
+        Result = OS_ERR_INVALID_SIZE;
+    }
+
+    while ((Result == OS_SUCCESS) && (Offset < DataEnd))
+    {
+        /*
+        ** Fill the buffer behind any partial packet left from the last pass...
+        */
+        ReadSize = DataEnd - (Offset + BufferCount);
+        if (ReadSize > (DS_EXTRACT_BUFFER_SIZE - BufferCount))
+        {
+            ReadSize = DS_EXTRACT_BUFFER_SIZE - BufferCount;
+        }
+
+        if (ReadSize > 0)
+        {
+            Result = OS_read(SourceHandle, &Buffer[BufferCount], ReadSize);
+
+            if (Result == ReadSize)
+            {
+                BufferCount += ReadSize;
+                Result = OS_SUCCESS;
+            }
+            else if (Result >= 0)
+            {
+                Result = OS_ERR_INVALID_SIZE;
+            }
+        }
+
+        Position = 0;
+        NeedData = false;
+
+        while ((Result == OS_SUCCESS) && !NeedData && ((BufferCount - Position) >= sizeof(CFE_MSG_Message_t)))
+        {
+            MsgPtr = (const CFE_MSG_Message_t *)&Buffer[Position];
+            CFE_MSG_GetSize(MsgPtr, &PacketSize);
+
+            if ((Buffer[Position] & DS_FILE_RECORD_TAG_BIT) != 0)
+            {
+                /*
+                ** Delta and truncated records are not complete packets...
+                */
+                Result = OS_ERR_NOT_IMPLEMENTED;
+            }
+            else if ((PacketSize < sizeof(CFE_MSG_Message_t)) || (PacketSize > DS_EXTRACT_BUFFER_SIZE))
+            {
+                Result = OS_ERR_INVALID_SIZE;
+            }
+            else if (PacketSize > (BufferCount - Position))
+            {
+                NeedData = true;
+            }
+            else
+            {
+                if (DS_ExtractPacketMatch(MsgPtr))
+                {
+                    Result = OS_write(TargetHandle, MsgPtr, PacketSize);
+
+                    if (Result == PacketSize)
+                    {
+                        DS_AppData.ExtractPacketCount++;
+                        Result = OS_SUCCESS;
+                    }
+                    else if (Result >= 0)
+                    {
+                        Result = OS_ERR_INVALID_SIZE;
+                    }
+                }
+
+                Position += PacketSize;
+            }
+        }
+
+        if ((Result == OS_SUCCESS) && (Position == 0) && (ReadSize == 0))
+        {
+            /*
+            ** Data range ends in the middle of a packet...
+            */
+            Result = OS_ERR_INVALID_SIZE;
+        }
+
+        /*
+        ** Keep the partial packet (if any) for the next pass...
+        */
+        BufferCount -= Position;
+        memmove(Buffer, &Buffer[Position], BufferCount);
+
+        Offset += Position;
+        DS_AppData.ExtractBytesScanned += Position;
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Test packet against extraction request                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_ExtractPacketMatch(const CFE_MSG_Message_t *MsgPtr)
+{
+    DS_ExtractFile_Payload_t *Request     = &DS_AppData.ExtractRequest;
+    CFE_SB_MsgId_t            MessageID   = CFE_SB_INVALID_MSG_ID;
+    CFE_TIME_SysTime_t        PacketTime  = {0};
+    bool                      MidSelected = false;
+    bool                      MidMatch    = false;
+    bool                      Match       = false;
+    int32                     i;
+
+    CFE_MSG_GetMsgId(MsgPtr, &MessageID);
+
+    /*
+    ** No requested message IDs selects all message IDs...
+    */
+    for (i = 0; i < DS_EXTRACT_MID_CNT; i++)
+    {
+        if (CFE_SB_IsValidMsgId(Request->MessageID[i]))
+        {
+            MidSelected = true;
+
+            if (CFE_SB_MsgId_Equal(Request->MessageID[i], MessageID))
+            {
+                MidMatch = true;
+            }
+        }
+    }
+
+    if (!MidSelected || MidMatch)
+    {
+        CFE_MSG_GetMsgTime(MsgPtr, &PacketTime);
+
+        if ((PacketTime.Seconds >= Request->StartSeconds) && (PacketTime.Seconds <= Request->StopSeconds))
+        {
+            Match = true;
+        }
+    }
+
+    return Match;
+}
@@ -0,0 +1,205 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   CFS Data Storage (DS) file extraction header file
+ */
+#ifndef DS_EXTRACT_H
+#define DS_EXTRACT_H
+
+#include "cfe.h"
+
+#include "ds_platform_cfg.h"
+#include "ds_app.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* DS file extraction function prototypes                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**
+ *  \brief Initialize file extraction
+ *
+ *  \par Description
+ *       This function creates the semaphore used to start an extraction
+ *       and the low priority child task that performs the extraction.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called during application initialization.
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+CFE_Status_t DS_ExtractInit(void);
+
+/**
+ *  \brief File extraction child task entry point
+ *
+ *  \par Description
+ *       The child task waits on the extraction semaphore and performs
+ *       the extraction described by the last accepted extract command
+ *       each time the semaphore is given.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The task runs at a lower priority than DS so that extraction
+ *       does not delay the storage of packets.
+ */
+void DS_ExtractTask(void);
+
+/**
+ *  \brief Perform a file extraction
+ *
+ *  \par Description
+ *       This function copies the packets in the source file that match
+ *       the requested message IDs and time window to the target file.
+ *       The target file begins with a copy of the source file headers.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The arguments are taken from the extraction request stored in
+ *       the application data by the extract command.
+ */
+void DS_ExtractFile(void);
+
+/**
+ *  \brief Reject source files that do not hold plain packets
+ *
+ *  \par Description
+ *       This function reads the first four bytes of the packet data and
+ *       rejects compressed files (which start with a block header) and
+ *       ring files (which start with a ring header).
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Files with delta or truncated records start with a complete
+ *       packet, so they are rejected by the readers at the first such
+ *       record instead.
+ *
+ *  \param[in] SourceHandle Source file handle
+ *  \param[in] DataStart    File offset of the first packet
+ *  \param[in] DataEnd      File offset following the last packet
+ *
+ *  \return OSAL execution status
+ *  \retval #OS_ERR_NOT_IMPLEMENTED The file is compressed or a ring file
+ */
+int32 DS_ExtractCheckFormat(osal_id_t SourceHandle, uint32 DataStart, uint32 DataEnd);
+
+/**
+ *  \brief Get source file packet data range
+ *
+ *  \par Description
+ *       This function gets the source file size and the end of the
+ *       packet data, which excludes the summary trailer when the
+ *       source file has one.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in]  SourceHandle Source file handle
+ *  \param[in]  DataStart    File offset of the first packet
+ *  \param[out] FileSize     Source file size
+ *  \param[out] DataEnd      File offset following the last packet
+ *
+ *  \return OSAL execution status
+ */
+int32 DS_ExtractDataRange(osal_id_t SourceHandle, uint32 DataStart, uint32 *FileSize, uint32 *DataEnd);
+
+/**
+ *  \brief Narrow packet data range using the sidecar index file
+ *
+ *  \par Description
+ *       When the source file has a finalized sidecar index file that
+ *       matches the source file size, the index records are used to
+ *       skip the packets that precede the start of the time window and
+ *       the packets that follow the end of the time window.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Packet times are assumed to increase through the file.  The
+ *       data range is left unchanged if the index cannot be used.
+ *       Packet replay also uses this function to seek.
+ *
+ *  \param[in]     SourceName   Source filename (index filename adds extension)
+ *  \param[in]     StartSeconds Time window start (seconds)
+ *  \param[in]     StopSeconds  Time window stop (seconds)
+ *  \param[in]     FileSize     Source file size
+ *  \param[in,out] DataStart    File offset of the first packet to scan
+ *  \param[in,out] DataEnd      File offset following the last packet to scan
+ */
+void DS_ExtractIndexRange(const char *SourceName, uint32 StartSeconds, uint32 StopSeconds, uint32 FileSize,
+                          uint32 *DataStart, uint32 *DataEnd);
+
+/**
+ *  \brief Copy source file headers to target file
+ *
+ *  \par Description
+ *       This function copies the first HeaderSize bytes of the source
+ *       file to the target file.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] SourceHandle Source file handle
+ *  \param[in] TargetHandle Target file handle
+ *  \param[in] HeaderSize   Size of source file headers
+ *
+ *  \return OSAL execution status
+ */
+int32 DS_ExtractCopyHeader(osal_id_t SourceHandle, osal_id_t TargetHandle, uint32 HeaderSize);
+
+/**
+ *  \brief Scan source file packets
+ *
+ *  \par Description
+ *       This function reads the source file packet data in buffer sized
+ *       chunks and writes each packet that matches the extraction
+ *       request to the target file.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A packet with an invalid length ends the scan with an error.
+ *       A delta or truncated record ends the scan with
+ *       #OS_ERR_NOT_IMPLEMENTED.
+ *
+ *  \param[in] SourceHandle Source file handle
+ *  \param[in] TargetHandle Target file handle
+ *  \param[in] DataStart    File offset of the first packet to scan
+ *  \param[in] DataEnd      File offset following the last packet to scan
+ *
+ *  \return OSAL execution status
+ */
+int32 DS_ExtractScan(osal_id_t SourceHandle, osal_id_t TargetHandle, uint32 DataStart, uint32 DataEnd);
+
+/**
+ *  \brief Test packet against extraction request
+ *
+ *  \par Description
+ *       This function returns true when the packet message ID is one of
+ *       the requested message IDs (or no message IDs were requested)
+ *       and the packet time is within the requested time window.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] MsgPtr Pointer to packet
+ *
+ *  \return Packet match
+ *  \retval true  Packet should be extracted
+ *  \retval false Packet should be skipped
+ */
+bool DS_ExtractPacketMatch(const CFE_MSG_Message_t *MsgPtr);
+
+#endif
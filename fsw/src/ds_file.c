@@ -29,10 +29,12 @@
 
 #include "ds_appdefs.h"
 #include "ds_msgids.h"
+#include "ds_perfids.h"
 
 #include "ds_msg.h"
 #include "ds_app.h"
 #include "ds_file.h"
+#include "ds_compress.h"
 #include "ds_table.h"
 #include "ds_eventids.h"
 
@@ -179,824 +181,3996 @@ bool DS_IsPacketFiltered(CFE_MSG_Message_t *MessagePtr, uint16 FilterType, uint1
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* Store packet in file(s)                                         */
+/* Scale filter algorithm X for backpressure decimation            */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-void DS_FileStorePacket(CFE_SB_MsgId_t MessageID, const CFE_SB_Buffer_t *BufPtr)
+uint16 DS_DecimateAlgorithmX(uint16 Algorithm_X, uint16 Priority, uint8 DecimationLevel)
 {
-    DS_PacketEntry_t *PacketEntry  = NULL;
-    DS_FilterParms_t *FilterParms  = NULL;
-    bool              PassedFilter = false;
-    bool              FilterResult = false;
-    int32             FilterIndex  = 0;
-    int32             FileIndex    = 0;
-    int32             i            = 0;
-
-    /*
-    ** Convert packet MessageID to packet filter table index...
-    */
-    FilterIndex = DS_TableFindMsgID(MessageID);
+    uint32 Result = Algorithm_X;
 
     /*
-    ** Ignore packets not listed in the packet filter table...
+    ** Only low priority filters are decimated, and X = 0 already filters all...
     */
-    if (FilterIndex == DS_INDEX_NONE)
+    if ((Priority == DS_PRIORITY_LOW) && (Algorithm_X != 0))
     {
-        DS_AppData.IgnoredPktCounter++;
-    }
-    else
-    {
-        PacketEntry  = &DS_AppData.FilterTblPtr->Packet[FilterIndex];
-        PassedFilter = false;
-
-        /*
-        ** Each packet has multiple filters for multiple files...
-        */
-        for (i = 0; i < DS_FILTERS_PER_PACKET; i++)
-        {
-            FilterParms = &PacketEntry->Filter[i];
-
-            /*
-            ** Ignore unused and invalid filters...
-            */
-            if ((FilterParms->Algorithm_N != DS_UNUSED) && (FilterParms->FileTableIndex < DS_DEST_FILE_CNT))
-            {
-                FileIndex = FilterParms->FileTableIndex;
-                /*
-                ** Ignore disabled destination files...
-                */
-                if (DS_AppData.FileStatus[FileIndex].FileState == DS_ENABLED)
-                {
-                    /*
-                    ** Apply filter algorithm to the packet...
-                    */
-                    FilterResult = DS_IsPacketFiltered((CFE_MSG_Message_t *)BufPtr, FilterParms->FilterType,
-                                                       FilterParms->Algorithm_N, FilterParms->Algorithm_X,
-                                                       FilterParms->Algorithm_O);
-                    if (FilterResult == false)
-                    {
-                        /*
-                        ** Write unfiltered packets to destination file...
-                        */
-                        DS_FileSetupWrite(FileIndex, BufPtr);
-                        PassedFilter = true;
-                    }
-                }
-            }
-        }
+        Result = (uint32)Algorithm_X << DecimationLevel;
 
-        /*
-        ** Count packet as passed if any filters passed...
-        */
-        if (PassedFilter)
-        {
-            DS_AppData.PassedPktCounter++;
-        }
-        else
+        if (Result > 0xFFFF)
         {
-            DS_AppData.FilteredPktCounter++;
+            Result = 0xFFFF;
         }
     }
+
+    return (uint16)Result;
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* Prepare to write packet data to file                            */
+/* Apply change-only filter to Software Bus packet                 */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-void DS_FileSetupWrite(int32 FileIndex, const CFE_SB_Buffer_t *BufPtr)
+bool DS_IsPacketUnchanged(const CFE_MSG_Message_t *MessagePtr, DS_FilterChangeStatus_t *ChangeStatus,
+                          uint16 Algorithm_X)
 {
-    DS_DestFileEntry_t *DestFile     = &DS_AppData.DestFileTblPtr->File[FileIndex];
-    DS_AppFileStatus_t *FileStatus   = &DS_AppData.FileStatus[FileIndex];
-    bool                OpenNewFile  = false;
-    size_t              PacketLength = 0;
+    /*
+    ** Algorithm_X = store at least one of every this many packets
+    */
+    bool           PacketIsFiltered = false;
+    CFE_MSG_Size_t PacketSize       = 0;
+    CFE_MSG_Type_t MessageType      = CFE_MSG_Type_Invalid;
+    size_t         HeaderSize       = sizeof(CFE_MSG_TelemetryHeader_t);
+    uint32         Hash             = 0;
+
+    CFE_MSG_GetSize(MessagePtr, &PacketSize);
+    CFE_MSG_GetType(MessagePtr, &MessageType);
 
     /*
-    ** Create local pointers for array indexed data...
+    ** Compare the packet data after the header (time and sequence count vary)...
     */
-    CFE_MSG_GetSize(&BufPtr->Msg, &PacketLength);
+    if (MessageType == CFE_MSG_Type_Cmd)
+    {
+        HeaderSize = sizeof(CFE_MSG_CommandHeader_t);
+    }
 
-    if (!OS_ObjectIdDefined(FileStatus->FileHandle))
+    if (PacketSize > HeaderSize)
     {
-        /*
-        ** 1st packet since destination enabled or file closed...
-        */
-        OpenNewFile = true;
+        Hash = DS_PacketHash((const uint8 *)MessagePtr + HeaderSize, PacketSize - HeaderSize,
+                             DS_PACKET_HASH_SEED ^ (uint32)PacketSize);
     }
     else
+    {
+        Hash = DS_PACKET_HASH_SEED ^ (uint32)PacketSize;
+    }
+
+    if (ChangeStatus->Stored && (Hash == ChangeStatus->Hash) && ((ChangeStatus->Unchanged + 1) < Algorithm_X))
     {
         /*
-        ** Test size of existing destination file...
+        ** Same content as the last stored packet and no heartbeat due...
         */
-        if ((FileStatus->FileSize + PacketLength) > DestFile->MaxFileSize)
-        {
-            /*
-            ** This packet would cause file to exceed max size limit...
-            */
-            DS_FileUpdateHeader(FileIndex);
-            DS_FileCloseDest(FileIndex);
-            OpenNewFile = true;
-        }
-        else
-        {
-            /*
-            ** File size is OK - write packet data to file...
-            */
-            DS_FileWriteData(FileIndex, BufPtr, PacketLength);
-        }
+        ChangeStatus->Unchanged++;
+        PacketIsFiltered = true;
     }
-
-    if (OpenNewFile)
+    else
     {
         /*
-        ** Either the file did not exist or we closed it because
-        **   of the size limit test above...
+        ** Changed content (or heartbeat) - this is the new stored packet...
         */
-        DS_FileCreateDest(FileIndex);
-
-        if (OS_ObjectIdDefined(FileStatus->FileHandle))
-        {
-            /*
-            ** By writing the first packet without first performing a size
-            **   limit test, we avoid issues resulting from having the max
-            **   file size set less than the size of one packet...
-            */
-            DS_FileWriteData(FileIndex, BufPtr, PacketLength);
-        }
+        ChangeStatus->Hash      = Hash;
+        ChangeStatus->Stored    = true;
+        ChangeStatus->Unchanged = 0;
     }
 
+    return PacketIsFiltered;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Compute packet content hash                                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 DS_PacketHash(const uint8 *Data, uint32 Length, uint32 Hash)
+{
+    uint32 Word;
+    uint32 i;
+
     /*
-    ** If the write did not occur due to I/O error (create or write)
-    **   then current state = file closed and destination disabled...
+    ** FNV-1a over whole 32-bit words, then the remaining bytes...
     */
+    for (i = 0; (i + sizeof(Word)) <= Length; i += sizeof(Word))
+    {
+        memcpy(&Word, &Data[i], sizeof(Word));
+        Hash = (Hash ^ Word) * DS_PACKET_HASH_PRIME;
+    }
+
+    for (; i < Length; i++)
+    {
+        Hash = (Hash ^ Data[i]) * DS_PACKET_HASH_PRIME;
+    }
+
+    return Hash;
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* Write data to destination file                                  */
+/* Apply time-window filter to Software Bus packet                 */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-void DS_FileWriteData(int32 FileIndex, const void *FileData, uint32 DataLength)
+bool DS_IsPacketInWindow(const CFE_MSG_Message_t *MessagePtr, DS_FilterWindowStatus_t *WindowStatus,
+                         uint16 Algorithm_X, uint16 Algorithm_O)
 {
-    DS_AppFileStatus_t *FileStatus = &DS_AppData.FileStatus[FileIndex];
-    int32               Result;
+    /*
+    ** Algorithm_X = store at most one packet per this many time units
+    ** Algorithm_O = time unit is 10 to the power of this many microseconds
+    */
+    bool               PacketIsFiltered = false;
+    CFE_TIME_SysTime_t PacketTime;
+    uint64             PacketMicrosecs;
+    uint64             Interval = Algorithm_X;
+    uint16             i;
+
+    memset(&PacketTime, 0, sizeof(PacketTime));
 
     /*
-    ** Let cFE manage the file I/O...
+    ** Full packet timestamp, so the window never wraps...
     */
-    Result = OS_write(FileStatus->FileHandle, FileData, DataLength);
-    if (Result == DataLength)
+    CFE_MSG_GetMsgTime(MessagePtr, &PacketTime);
+
+    PacketMicrosecs = ((uint64)PacketTime.Seconds * DS_WINDOW_MICROSECS_PER_SEC) +
+                      CFE_TIME_Sub2MicroSecs(PacketTime.Subseconds);
+
+    for (i = 0; (i < Algorithm_O) && (i < DS_WINDOW_MAX_EXPONENT); i++)
+    {
+        Interval *= 10;
+    }
+
+    if (WindowStatus->Stored && (PacketMicrosecs >= WindowStatus->LastStored) &&
+        ((PacketMicrosecs - WindowStatus->LastStored) < Interval))
     {
         /*
-        ** Success - update file size and data rate counters...
+        ** Too soon after the last stored packet...
         */
-        DS_AppData.FileWriteCounter++;
-
-        FileStatus->FileSize += DataLength;
-        FileStatus->FileGrowth += DataLength;
+        PacketIsFiltered = true;
     }
     else
     {
         /*
-        ** Error - send event, close file and disable destination...
+        ** Store this packet and start a new window...
         */
-        DS_FileWriteError(FileIndex, DataLength, Result);
+        WindowStatus->LastStored = PacketMicrosecs;
+        WindowStatus->Stored     = true;
     }
+
+    return PacketIsFiltered;
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* Write header to destination file                                */
+/* Apply payload predicate to Software Bus packet                  */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-void DS_FileWriteHeader(int32 FileIndex)
+bool DS_IsPacketMatched(const CFE_MSG_Message_t *MessagePtr, const DS_PacketPredicate_t *Predicate)
 {
-    if (DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE)
-    {
-        DS_DestFileEntry_t *DestFile   = &DS_AppData.DestFileTblPtr->File[FileIndex];
-        DS_AppFileStatus_t *FileStatus = &DS_AppData.FileStatus[FileIndex];
-        CFE_FS_Header_t     CFE_FS_Header;
-        DS_FileHeader_t     DS_FileHeader;
-        int32               Result;
+    const DS_PredicateCode_t *Code;
+    const uint8 *             Data       = (const uint8 *)MessagePtr;
+    CFE_MSG_Size_t            PacketSize = 0;
+    bool                      Matched    = true;
+    bool                      TermResult = false;
+    uint32                    Field      = 0;
+    uint16                    i          = 0;
+    uint16                    j          = 0;
 
-        /*
-        ** Initialize selected parts of the cFE file header...
-        */
-        CFE_FS_InitHeader(&CFE_FS_Header, DS_FILE_HDR_DESCRIPTION, DS_FILE_HDR_SUBTYPE);
+    if (Predicate->TermCount != 0)
+    {
+        CFE_MSG_GetSize(MessagePtr, &PacketSize);
 
         /*
-        ** Let cFE finish the init and write the primary header...
+        ** Stop as soon as the result is known (first false for AND, first true for OR)...
         */
-        Result = CFE_FS_WriteHeader(FileStatus->FileHandle, &CFE_FS_Header);
+        Matched = !Predicate->MatchAny;
 
-        if (Result == sizeof(CFE_FS_Header_t))
+        for (i = 0; (i < Predicate->TermCount) && (Matched != Predicate->MatchAny); i++)
         {
-            /*
-            ** Success - update file size and data rate counters...
-            */
-            DS_AppData.FileWriteCounter++;
-
-            FileStatus->FileSize += sizeof(CFE_FS_Header_t);
-            FileStatus->FileGrowth += sizeof(CFE_FS_Header_t);
-
-            /*
-            ** Initialize the DS file header...
-            */
-            memset(&DS_FileHeader, 0, sizeof(DS_FileHeader));
-            DS_FileHeader.FileTableIndex = FileIndex;
-            DS_FileHeader.FileNameType   = DestFile->FileNameType;
-            strncpy(DS_FileHeader.FileName, FileStatus->FileName, sizeof(DS_FileHeader.FileName));
+            Code = &Predicate->Term[i];
 
             /*
-            ** Manually write the secondary header...
+            ** Fields beyond the end of a short packet never match...
             */
-            Result = OS_write(FileStatus->FileHandle, &DS_FileHeader, sizeof(DS_FileHeader_t));
-
-            if (Result == sizeof(DS_FileHeader_t))
+            if (PacketSize < Code->End)
             {
-                /*
-                ** Success - update file size and data rate counters...
-                */
-                DS_AppData.FileWriteCounter++;
-
-                FileStatus->FileSize += sizeof(DS_FileHeader_t);
-                FileStatus->FileGrowth += sizeof(DS_FileHeader_t);
+                TermResult = false;
             }
             else
             {
                 /*
-                ** Error - send event, close file and disable destination...
+                ** Packet fields are big endian...
                 */
-                DS_FileWriteError(FileIndex, sizeof(DS_FileHeader_t), Result);
+                Field = 0;
+                for (j = Code->Offset; j < Code->End; j++)
+                {
+                    Field = (Field << 8) | Data[j];
+                }
+
+                TermResult = (((Field & Code->Mask) - Code->Low) <= Code->Span) != Code->Invert;
             }
-        }
-        else
-        {
-            /*
-            ** Error - send event, close file and disable destination...
-            */
-            DS_FileWriteError(FileIndex, sizeof(CFE_FS_Header_t), Result);
+
+            Matched = TermResult;
         }
     }
+
+    return Matched;
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* File write error handler                                        */
+/* Apply token bucket rate limit to Software Bus packet            */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void DS_FileWriteError(uint32 FileIndex, uint32 DataLength, int32 WriteResult)
+bool DS_IsPacketOverRate(const CFE_MSG_Message_t *MessagePtr, DS_RateLimitStatus_t *RateStatus, uint16 RatePackets,
+                         uint32 RateBytes)
 {
-    DS_AppFileStatus_t *FileStatus = &DS_AppData.FileStatus[FileIndex];
+    bool               PacketIsDropped = false;
+    CFE_TIME_SysTime_t CurrentTime;
+    CFE_MSG_Size_t     PacketSize   = 0;
+    uint64             NowTicks     = 0;
+    uint64             Elapsed      = 0;
+    uint64             PacketTokens = 0;
+    uint64             ByteTokens   = 0;
+    uint64             PacketCost   = 0;
+    uint64             ByteCost     = 0;
 
-    /*
-    ** Send event, close file and disable destination...
-    */
-    DS_AppData.FileWriteErrCounter++;
+    if ((RatePackets != 0) || (RateBytes != 0))
+    {
+        CurrentTime = CFE_TIME_GetTime();
+        NowTicks    = ((uint64)CurrentTime.Seconds << 16) | (CurrentTime.Subseconds >> 16);
 
-    CFE_EVS_SendEvent(DS_WRITE_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
-                      "FILE WRITE error: result = %d, length = %d, dest = %d, name = '%s'", (int)WriteResult,
-                      (int)DataLength, (int)FileIndex, FileStatus->FileName);
+        /*
+        ** Refill for the time since the last packet (buckets hold one second)...
+        */
+        if (NowTicks > RateStatus->LastTicks)
+        {
+            Elapsed = NowTicks - RateStatus->LastTicks;
 
-    DS_FileCloseDest(FileIndex);
+            if (Elapsed > DS_RATE_TICKS_PER_SEC)
+            {
+                Elapsed = DS_RATE_TICKS_PER_SEC;
+            }
+        }
+        RateStatus->LastTicks = NowTicks;
 
-    FileStatus->FileState = DS_DISABLED;
+        PacketTokens = RateStatus->PacketTokens + ((uint64)RatePackets * Elapsed);
+        ByteTokens   = RateStatus->ByteTokens + ((uint64)RateBytes * Elapsed);
+
+        /*
+        ** Limits may have been lowered by command or table load...
+        */
+        if (PacketTokens > ((uint64)RatePackets * DS_RATE_TICKS_PER_SEC))
+        {
+            PacketTokens = (uint64)RatePackets * DS_RATE_TICKS_PER_SEC;
+        }
+        if (ByteTokens > ((uint64)RateBytes * DS_RATE_TICKS_PER_SEC))
+        {
+            ByteTokens = (uint64)RateBytes * DS_RATE_TICKS_PER_SEC;
+        }
+
+        if (RatePackets != 0)
+        {
+            PacketCost = DS_RATE_TICKS_PER_SEC;
+        }
+        if (RateBytes != 0)
+        {
+            CFE_MSG_GetSize(MessagePtr, &PacketSize);
+            ByteCost = (uint64)PacketSize * DS_RATE_TICKS_PER_SEC;
+        }
+
+        if ((PacketTokens < PacketCost) || (ByteTokens < ByteCost))
+        {
+            PacketIsDropped = true;
+        }
+        else
+        {
+            PacketTokens -= PacketCost;
+            ByteTokens -= ByteCost;
+        }
+
+        RateStatus->PacketTokens = PacketTokens;
+        RateStatus->ByteTokens   = ByteTokens;
+    }
+
+    return PacketIsDropped;
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* Create destination file                                         */
+/* Remember a packet sent by DS                                    */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void DS_FileCreateDest(uint32 FileIndex)
+
+void DS_FileEchoRecord(DS_EchoTable_t *EchoTable, const CFE_MSG_Message_t *MessagePtr)
 {
-    DS_DestFileEntry_t *DestFile   = &DS_AppData.DestFileTblPtr->File[FileIndex];
-    DS_AppFileStatus_t *FileStatus = &DS_AppData.FileStatus[FileIndex];
-    int32               Result;
-    osal_id_t           LocalFileHandle = OS_OBJECT_ID_UNDEFINED;
+    DS_EchoEntry_t *        Entry         = NULL;
+    CFE_SB_MsgId_t          MessageID     = CFE_SB_INVALID_MSG_ID;
+    CFE_MSG_SequenceCount_t SequenceCount = 0;
+    CFE_MSG_Size_t          PacketLength  = 0;
+    uint32                  PacketCrc     = 0;
 
-    /*
-    ** Create filename from "path + base + sequence count + extension"...
-    */
-    DS_FileCreateName(FileIndex);
+    CFE_MSG_GetMsgId(MessagePtr, &MessageID);
+    CFE_MSG_GetSequenceCount(MessagePtr, &SequenceCount);
+    CFE_MSG_GetSize(MessagePtr, &PacketLength);
 
-    if (FileStatus->FileName[0] != 0)
+    PacketCrc = CFE_ES_CalculateCRC(MessagePtr, PacketLength, 0, CFE_MISSION_ES_DEFAULT_CRC);
+
+    if (OS_ObjectIdDefined(EchoTable->MutexId))
+    {
+        OS_MutSemTake(EchoTable->MutexId);
+    }
+
+    Entry = &EchoTable->Entry[EchoTable->SentCount % DS_ECHO_DEPTH];
+
+    if (Entry->Pending)
     {
         /*
-        ** Success - create a new destination file...
+        ** Oldest packet never came back, forget it so the counts stay in step...
         */
-        Result = OS_OpenCreate(&LocalFileHandle, FileStatus->FileName, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE,
-                               OS_READ_WRITE);
+        EchoTable->MatchCount++;
+    }
 
-        if (Result != OS_SUCCESS)
+    Entry->MessageID     = MessageID;
+    Entry->SequenceCount = SequenceCount;
+    Entry->PacketLength  = PacketLength;
+    Entry->PacketCrc     = PacketCrc;
+    Entry->SentSeconds   = CFE_TIME_GetMET().Seconds;
+    Entry->Pending       = true;
+
+    EchoTable->SentCount++;
+
+    if (OS_ObjectIdDefined(EchoTable->MutexId))
+    {
+        OS_MutSemGive(EchoTable->MutexId);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Determine whether packet was sent by DS                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_IsPacketEcho(DS_EchoTable_t *EchoTable, CFE_SB_MsgId_t MessageID, const CFE_MSG_Message_t *MessagePtr)
+{
+    DS_EchoEntry_t *        Entry         = NULL;
+    CFE_MSG_SequenceCount_t SequenceCount = 0;
+    CFE_MSG_Size_t          PacketLength  = 0;
+    uint32                  PacketCrc     = 0;
+    bool                    CrcValid      = false;
+    uint32                  NowSeconds    = 0;
+    bool                    PacketIsEcho  = false;
+    int32                   i             = 0;
+
+    if (OS_ObjectIdDefined(EchoTable->MutexId))
+    {
+        OS_MutSemTake(EchoTable->MutexId);
+    }
+
+    /*
+    ** Live packets pay for the search only while sent packets are outstanding...
+    */
+    if (EchoTable->MatchCount != EchoTable->SentCount)
+    {
+        CFE_MSG_GetSequenceCount(MessagePtr, &SequenceCount);
+
+        NowSeconds = CFE_TIME_GetMET().Seconds;
+
+        for (i = 0; i < DS_ECHO_DEPTH; i++)
+        {
+            Entry = &EchoTable->Entry[i];
+
+            if (Entry->Pending && ((NowSeconds - Entry->SentSeconds) >= DS_ECHO_TIMEOUT))
+            {
+                /*
+                ** Packet was rejected by the software bus or dropped from the pipe...
+                */
+                Entry->Pending = false;
+                EchoTable->MatchCount++;
+            }
+            else if (Entry->Pending && (PacketIsEcho == false) && CFE_SB_MsgId_Equal(Entry->MessageID, MessageID) &&
+                     (Entry->SequenceCount == SequenceCount))
+            {
+                /*
+                ** Sequence counts wrap, so a live packet is only an echo if it is
+                **   byte for byte the packet that was sent...
+                */
+                if (CrcValid == false)
+                {
+                    CFE_MSG_GetSize(MessagePtr, &PacketLength);
+                    PacketCrc = CFE_ES_CalculateCRC(MessagePtr, PacketLength, 0, CFE_MISSION_ES_DEFAULT_CRC);
+                    CrcValid  = true;
+                }
+
+                if ((Entry->PacketLength == PacketLength) && (Entry->PacketCrc == PacketCrc))
+                {
+                    Entry->Pending = false;
+                    EchoTable->MatchCount++;
+
+                    PacketIsEcho = true;
+                }
+            }
+        }
+    }
+
+    if (OS_ObjectIdDefined(EchoTable->MutexId))
+    {
+        OS_MutSemGive(EchoTable->MutexId);
+    }
+
+    return PacketIsEcho;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Store packet in file(s)                                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FileStorePacket(CFE_SB_MsgId_t MessageID, const CFE_SB_Buffer_t *BufPtr)
+{
+    DS_PacketEntry_t *PacketEntry  = NULL;
+    DS_FilterParms_t *FilterParms  = NULL;
+    bool              PassedFilter = false;
+    bool              FilterResult = false;
+    bool              RateDropped  = false;
+    int32             FilterIndex  = 0;
+    int32             FileIndex    = 0;
+    int32             i            = 0;
+    uint16            Algorithm_X  = 0;
+    int64             StartTime    = 0;
+    int64             WriteStart   = 0;
+    int64             WriteTime    = 0;
+    int64             Elapsed      = 0;
+    uint32            MicroSecs    = 0;
+
+    if (DS_STATS_TIMING == 1)
+    {
+        StartTime = DS_AppStatsTime();
+
+        /*
+        ** Time spent in the pipe and in command dispatch (unknown if not from the pipe)...
+        */
+        if (DS_AppData.ReceiveTime != 0)
+        {
+            DS_AppStatsRecord(&DS_AppData.Stats.Receive, StartTime - DS_AppData.ReceiveTime);
+            DS_AppData.ReceiveTime = 0;
+        }
+    }
+
+    /*
+    ** Any packet may be the trigger of a flight recorder dump...
+    */
+    DS_FileRecorderCheck(MessageID);
+
+    /*
+    ** Convert packet MessageID to packet filter table index...
+    */
+    FilterIndex = DS_TableFindMsgID(MessageID);
+
+    /*
+    ** Every packet listed in the packet filter table updates the latest-value cache (if enabled)...
+    */
+    if ((DS_CACHE_ENTRIES != 0) && (FilterIndex != DS_INDEX_NONE))
+    {
+        DS_FileCacheStore(MessageID, BufPtr);
+    }
+
+    /*
+    ** Ignore packets not listed in the packet filter table...
+    */
+    if (FilterIndex == DS_INDEX_NONE)
+    {
+        DS_AppData.IgnoredPktCounter++;
+    }
+    else if (DS_IsPacketMatched(&BufPtr->Msg, &DS_AppData.FilterPredicate[FilterIndex]) == false)
+    {
+        /*
+        ** Filter packets whose contents do not match the payload predicate...
+        */
+        DS_AppData.FilteredPktCounter++;
+    }
+    else if (DS_IsPacketOverRate(&BufPtr->Msg, &DS_AppData.FilterRate[FilterIndex],
+                                 DS_AppData.FilterTblPtr->Packet[FilterIndex].RatePackets,
+                                 DS_AppData.FilterTblPtr->Packet[FilterIndex].RateBytes))
+    {
+        /*
+        ** Drop packets over the rate limit for this message ID...
+        */
+        DS_AppData.RateDropPktCounter++;
+    }
+    else
+    {
+        PacketEntry  = &DS_AppData.FilterTblPtr->Packet[FilterIndex];
+        PassedFilter = false;
+        RateDropped  = false;
+
+        DS_DETAIL_PERF_ENTRY(DS_FILTER_PERF_ID);
+
+        /*
+        ** Each packet has multiple filters for multiple files...
+        */
+        for (i = 0; i < DS_FILTERS_PER_PACKET; i++)
         {
+            FilterParms = &PacketEntry->Filter[i];
+
             /*
-            ** Error - send event, disable destination and reset filename...
+            ** Ignore unused and invalid filters...
             */
-            DS_AppData.FileWriteErrCounter++;
+            if ((FilterParms->Algorithm_N != DS_UNUSED) && (FilterParms->FileTableIndex < DS_DEST_FILE_CNT))
+            {
+                FileIndex = FilterParms->FileTableIndex;
+                /*
+                ** Ignore disabled destination files...
+                */
+                if (DS_AppData.FileStatus[FileIndex].FileState == DS_ENABLED)
+                {
+                    /*
+                    ** Thin out low priority packets while DS is falling behind...
+                    */
+                    Algorithm_X = DS_DecimateAlgorithmX(FilterParms->Algorithm_X, FilterParms->Priority,
+                                                        DS_AppData.DecimationLevel);
 
-            CFE_EVS_SendEvent(DS_CREATE_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "FILE CREATE error: result = %d, dest = %d, name = '%s'", (int)Result, (int)FileIndex,
-                              FileStatus->FileName);
+                    /*
+                    ** Apply filter algorithm to the packet...
+                    */
+                    if (FilterParms->FilterType == DS_BY_CHANGE)
+                    {
+                        FilterResult = DS_IsPacketUnchanged(&BufPtr->Msg, &DS_AppData.FilterChange[FilterIndex][i],
+                                                            Algorithm_X);
+                    }
+                    else if (FilterParms->FilterType == DS_BY_WINDOW)
+                    {
+                        FilterResult = DS_IsPacketInWindow(&BufPtr->Msg, &DS_AppData.FilterWindow[FilterIndex][i],
+                                                           Algorithm_X, FilterParms->Algorithm_O);
+                    }
+                    else
+                    {
+                        FilterResult =
+                            DS_IsPacketFiltered((CFE_MSG_Message_t *)BufPtr, FilterParms->FilterType,
+                                                FilterParms->Algorithm_N, Algorithm_X, FilterParms->Algorithm_O);
+                    }
+                    if (FilterResult == false)
+                    {
+                        if (DS_IsPacketOverRate(&BufPtr->Msg, &DS_AppData.DestRate[FileIndex],
+                                                DS_AppData.DestFileTblPtr->File[FileIndex].RatePackets,
+                                                DS_AppData.DestFileTblPtr->File[FileIndex].RateBytes))
+                        {
+                            /*
+                            ** Drop packets over the rate limit for this destination file...
+                            */
+                            DS_AppData.RateDropPktCounter++;
+                            RateDropped = true;
+                        }
+                        else
+                        {
+                            /*
+                            ** Write unfiltered packets to destination file...
+                            */
+                            if (DS_STATS_TIMING == 1)
+                            {
+                                WriteStart = DS_AppStatsTime();
+                            }
 
-            memset(FileStatus->FileName, 0, sizeof(FileStatus->FileName));
+                            if (DS_AppData.DestRecorder[FileIndex] != 0)
+                            {
+                                /*
+                                ** Hold packets for flight recorder destinations in memory...
+                                */
+                                DS_FileRecorderStore(DS_AppData.DestRecorder[FileIndex] - 1, BufPtr,
+                                                     FilterParms->MaxStoreLength);
+                            }
+                            else
+                            {
+                                DS_FileSetupWrite(FileIndex, BufPtr, FilterParms->MaxStoreLength);
+                            }
+
+                            if (DS_STATS_TIMING == 1)
+                            {
+                                Elapsed = DS_AppStatsTime() - WriteStart;
+                                WriteTime += Elapsed;
+                                MicroSecs = DS_AppStatsRecord(&DS_AppData.Stats.Write, Elapsed);
+
+                                if (MicroSecs > DS_AppData.DestStats[FileIndex].MaxWriteTime)
+                                {
+                                    DS_AppData.DestStats[FileIndex].MaxWriteTime = MicroSecs;
+                                }
+                            }
+
+                            PassedFilter = true;
+                        }
+                    }
+                }
+            }
+        }
+
+        DS_DETAIL_PERF_EXIT(DS_FILTER_PERF_ID);
+
+        /*
+        ** Count packet as passed if any filters passed (rate drops are already counted)...
+        */
+        if (PassedFilter)
+        {
+            DS_AppData.PassedPktCounter++;
+        }
+        else if (RateDropped == false)
+        {
+            DS_AppData.FilteredPktCounter++;
+        }
+    }
+
+    if (DS_STATS_TIMING == 1)
+    {
+        /*
+        ** Filter evaluation is whatever time was not spent writing...
+        */
+        DS_AppStatsRecord(&DS_AppData.Stats.Filter, DS_AppStatsTime() - StartTime - WriteTime);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Prepare to write packet data to file                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FileSetupWrite(int32 FileIndex, const CFE_SB_Buffer_t *BufPtr, uint16 MaxStoreLength)
+{
+    DS_DestFileEntry_t *DestFile     = &DS_AppData.DestFileTblPtr->File[FileIndex];
+    DS_AppFileStatus_t *FileStatus   = &DS_AppData.FileStatus[FileIndex];
+    bool                OpenNewFile  = false;
+    size_t              PacketLength = 0;
+    const void *        WriteData    = BufPtr;
+
+    /*
+    ** Create local pointers for array indexed data...
+    */
+    CFE_MSG_GetSize(&BufPtr->Msg, &PacketLength);
+
+    /*
+    ** Store only the leading bytes of wide packets when the filter asks for it...
+    */
+    if ((MaxStoreLength != 0) && (PacketLength > MaxStoreLength))
+    {
+        PacketLength = DS_FileTruncatePacket(&BufPtr->Msg, MaxStoreLength);
+        WriteData    = DS_AppData.TruncateBuffer;
+    }
 
+    if (!OS_ObjectIdDefined(FileStatus->FileHandle))
+    {
+        /*
+        ** 1st packet since destination enabled or file closed...
+        */
+        OpenNewFile = true;
+    }
+    else if (FileStatus->FileMode == DS_FILE_MODE_RING)
+    {
+        /*
+        ** Ring files are never closed for size - overwrite oldest data...
+        */
+        if (DS_FileRingPrepare(FileIndex, PacketLength) && OS_ObjectIdDefined(FileStatus->FileHandle))
+        {
+            DS_FileWriteData(FileIndex, WriteData, PacketLength);
+        }
+    }
+    else
+    {
+        /*
+        ** Test size of existing destination file...
+        */
+        if (DS_FileLimitSize(FileIndex, PacketLength) > DestFile->MaxFileSize)
+        {
             /*
-            ** Something needs to get fixed before we try again...
+            ** This packet would cause file to exceed max size limit...
             */
-            FileStatus->FileState = DS_DISABLED;
+            DS_AppData.DestStats[FileIndex].RolloverCount++;
+
+            DS_FileUpdateHeader(FileIndex);
+            DS_FileCloseDest(FileIndex);
+            OpenNewFile = true;
         }
         else
         {
             /*
-            ** Success - store the file handle...
+            ** File size is OK - write packet data to file...
             */
-            DS_AppData.FileWriteCounter++;
-
-            FileStatus->FileHandle = LocalFileHandle;
+            DS_FileWriteData(FileIndex, WriteData, PacketLength);
+        }
+    }
 
-            /*
-            ** Initialize and write config specific file header...
-            */
-            DS_FileWriteHeader(FileIndex);
+    if (OpenNewFile)
+    {
+        /*
+        ** Either the file did not exist or we closed it because
+        **   of the size limit test above...
+        */
+        DS_FileCreateDest(FileIndex);
 
+        if (OS_ObjectIdDefined(FileStatus->FileHandle) &&
+            ((FileStatus->FileMode != DS_FILE_MODE_RING) || DS_FileRingPrepare(FileIndex, PacketLength)))
+        {
             /*
-            ** Update sequence count if have one and write successful...
+            ** By writing the first packet without first performing a size
+            **   limit test, we avoid issues resulting from having the max
+            **   file size set less than the size of one packet (ring files
+            **   are preallocated and cannot hold a packet that large)...
             */
-            if (OS_ObjectIdDefined(FileStatus->FileHandle) && (DestFile->FileNameType == DS_BY_COUNT))
-            {
-                FileStatus->FileCount++;
-                if (FileStatus->FileCount > DS_MAX_SEQUENCE_COUNT)
-                {
-                    FileStatus->FileCount = DestFile->SequenceCount;
-                }
-
-                /*
-                ** Update Critical Data Store (CDS)...
-                */
-                DS_TableUpdateCDS();
-            }
+            DS_FileWriteData(FileIndex, WriteData, PacketLength);
         }
     }
+
+    /*
+    ** If the write did not occur due to I/O error (create or write)
+    **   then current state = file closed and destination disabled...
+    */
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Truncate packet for a partial store                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 DS_FileTruncatePacket(const CFE_MSG_Message_t *MsgPtr, uint32 StoreLength)
+{
+    uint8 *Record       = (uint8 *)DS_AppData.TruncateBuffer;
+    uint32 RecordLength = StoreLength;
+
+    if (DS_TRUNCATE_PATCH_LENGTH == 1)
+    {
+        /*
+        ** Copy is a complete (shorter) packet marked as the first segment...
+        */
+        memcpy(Record, MsgPtr, StoreLength);
+        CFE_MSG_SetSize((CFE_MSG_Message_t *)Record, StoreLength);
+        CFE_MSG_SetSegmentationFlag((CFE_MSG_Message_t *)Record, CFE_MSG_SegFlag_First);
+    }
+    else
+    {
+        /*
+        ** Header keeps the full packet length, prefix gives the stored length...
+        */
+        Record[0] = DS_FILE_RECORD_TRUNC_TAG;
+        Record[1] = 0;
+        Record[2] = (uint8)(StoreLength >> 8);
+        Record[3] = (uint8)StoreLength;
+
+        memcpy(&Record[DS_FILE_RECORD_TRUNC_SIZE], MsgPtr, StoreLength);
+        RecordLength += DS_FILE_RECORD_TRUNC_SIZE;
+    }
+
+    return RecordLength;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Write data to destination file                                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FileWriteData(int32 FileIndex, const void *FileData, uint32 DataLength)
+{
+    DS_AppFileStatus_t *FileStatus   = &DS_AppData.FileStatus[FileIndex];
+    const uint8 *       RecordBytes  = (const uint8 *)FileData;
+    const void *        PacketData   = FileData;
+    uint32              PacketLength = DataLength;
+    const void *        WriteData    = FileData;
+    uint32              WriteLength  = DataLength;
+    int32               Result;
+
+    DS_DETAIL_PERF_ENTRY(DS_WRITE_DATA_PERF_ID);
+
+    if (RecordBytes[0] == DS_FILE_RECORD_TRUNC_TAG)
+    {
+        /*
+        ** Truncated records carry the packet bytes after a short prefix...
+        */
+        PacketData   = &RecordBytes[DS_FILE_RECORD_TRUNC_SIZE];
+        PacketLength = DataLength - DS_FILE_RECORD_TRUNC_SIZE;
+    }
+    else if ((FileStatus->RecordMode == DS_RECORD_DELTA) &&
+             DS_FileRecordEncode(FileIndex, FileData, DataLength, &WriteLength))
+    {
+        /*
+        ** Delta encoded files replace repeated packet headers with a short record...
+        */
+        WriteData = DS_AppData.RecordBuffer;
+    }
+
+    /*
+    ** Let cFE manage the file I/O (compressed files write whole blocks)...
+    */
+    if (FileStatus->CompressMode == DS_COMPRESS_LZ)
+    {
+        Result = DS_FileCompressData(FileIndex, WriteData, WriteLength);
+    }
+    else
+    {
+        DS_AppData.DestStats[FileIndex].WriteCalls++;
+
+        Result = OS_write(FileStatus->FileHandle, WriteData, WriteLength);
+    }
+
+    if (Result == WriteLength)
+    {
+        /*
+        ** Success - update file size and data rate counters...
+        */
+        DS_AppData.FileWriteCounter++;
+        DS_AppData.DestStats[FileIndex].PacketCount++;
+
+        /*
+        ** Accumulate the payload CRC (records only, before compression) for the closed file manifest...
+        */
+        if (FileStatus->PayloadCrcActive)
+        {
+            FileStatus->PayloadCrc =
+                CFE_ES_CalculateCRC(WriteData, WriteLength, FileStatus->PayloadCrc, CFE_MISSION_ES_DEFAULT_CRC);
+        }
+
+        /*
+        ** Add sparse index record (if due) at the start of this packet...
+        */
+        if (OS_ObjectIdDefined(DS_AppData.IndexStatus[FileIndex].IndexHandle))
+        {
+            DS_FileIndexPacket(FileIndex, PacketData, FileStatus->FileSize);
+        }
+
+        /*
+        ** Add packet to summary trailer statistics...
+        */
+        if (DS_AppData.TrailerStatus[FileIndex].Active)
+        {
+            DS_FileTrailerPacket(FileIndex, PacketData, PacketLength);
+        }
+
+        if (FileStatus->CompressMode == DS_COMPRESS_LZ)
+        {
+            /*
+            ** File size and growth are updated as blocks are written...
+            */
+            FileStatus->LogicalSize += WriteLength;
+        }
+        else
+        {
+            FileStatus->FileSize += WriteLength;
+            FileStatus->FileGrowth += WriteLength;
+
+            DS_AppData.DestStats[FileIndex].ByteCount += WriteLength;
+        }
+    }
+    else
+    {
+        /*
+        ** Error - send event, close file and disable destination...
+        */
+        DS_FileWriteError(FileIndex, WriteLength, Result);
+    }
+
+    DS_DETAIL_PERF_EXIT(DS_WRITE_DATA_PERF_ID);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Make room for next packet in ring destination file              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_FileRingPrepare(int32 FileIndex, uint32 DataLength)
+{
+    DS_DestFileEntry_t *DestFile   = &DS_AppData.DestFileTblPtr->File[FileIndex];
+    DS_AppFileStatus_t *FileStatus = &DS_AppData.FileStatus[FileIndex];
+    DS_FileRingWalk_t * RingWalk   = &DS_AppData.RingWalk[FileIndex];
+    bool                SeekToHead = false;
+    bool                Result     = true;
+    int32               SeekResult;
+
+    if (DataLength > (DestFile->MaxFileSize - FileStatus->RingDataStart))
+    {
+        /*
+        ** Packet is larger than the ring data area - it can never be stored...
+        */
+        DS_AppData.FileWriteErrCounter++;
+        DS_AppData.DestStats[FileIndex].ErrorCount++;
+
+        Result = false;
+    }
+    else
+    {
+        /*
+        ** Wrap to the start of the data area if the packet will not fit...
+        */
+        if ((FileStatus->FileSize + DataLength) > DestFile->MaxFileSize)
+        {
+            /*
+            ** Any older data left between the head and the previous wrap
+            **   offset is less than one packet and is discarded...
+            */
+            FileStatus->RingWrapOffset = FileStatus->FileSize;
+            FileStatus->RingTail       = FileStatus->RingDataStart;
+            FileStatus->FileSize       = FileStatus->RingDataStart;
+            FileStatus->RingWrapCount++;
+
+            RingWalk->Count = 0;
+            RingWalk->Next  = 0;
+
+            SeekToHead = true;
+        }
+
+        /*
+        ** Advance the tail past each older packet this write will overwrite...
+        */
+        while ((FileStatus->RingWrapOffset != 0) && (FileStatus->RingTail < (FileStatus->FileSize + DataLength)))
+        {
+            if (RingWalk->Next >= RingWalk->Count)
+            {
+                /*
+                ** Read the next group of packet boundaries (moves the file position)...
+                */
+                DS_FileRingWalk(FileIndex);
+
+                SeekToHead = true;
+            }
+
+            if (RingWalk->Next < RingWalk->Count)
+            {
+                FileStatus->RingTail = RingWalk->Bound[RingWalk->Next];
+                RingWalk->Next++;
+            }
+            else
+            {
+                /*
+                ** Cannot walk the older data - treat it as overwritten...
+                */
+                FileStatus->RingTail = FileStatus->RingWrapOffset;
+            }
+
+            if (FileStatus->RingTail >= FileStatus->RingWrapOffset)
+            {
+                /*
+                ** All data written before the last wrap has been overwritten...
+                */
+                FileStatus->RingTail       = FileStatus->RingDataStart;
+                FileStatus->RingWrapOffset = 0;
+
+                RingWalk->Count = 0;
+                RingWalk->Next  = 0;
+            }
+        }
+
+        if (SeekToHead)
+        {
+            /*
+            ** Return the file position to the ring head...
+            */
+            SeekResult = OS_lseek(FileStatus->FileHandle, FileStatus->FileSize, OS_SEEK_SET);
+
+            if (SeekResult != FileStatus->FileSize)
+            {
+                /*
+                ** Error - send event, close file and disable destination...
+                */
+                DS_FileWriteError(FileIndex, DataLength, SeekResult);
+            }
+        }
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Read packet boundaries ahead of the ring file writer            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FileRingWalk(int32 FileIndex)
+{
+    DS_AppFileStatus_t *FileStatus  = &DS_AppData.FileStatus[FileIndex];
+    DS_FileRingWalk_t * RingWalk    = &DS_AppData.RingWalk[FileIndex];
+    const uint8 *       Buffer      = (const uint8 *)DS_AppData.RingBuffer;
+    uint32              ReadLength  = FileStatus->RingWrapOffset - FileStatus->RingTail;
+    uint32              BufferCount = 0;
+    uint32              Position    = 0;
+    CFE_MSG_Message_t   RecordHeader;
+    size_t              RecordLength;
+    int32               Result;
+
+    RingWalk->Count = 0;
+    RingWalk->Next  = 0;
+
+    if (ReadLength > sizeof(DS_AppData.RingBuffer))
+    {
+        ReadLength = sizeof(DS_AppData.RingBuffer);
+    }
+
+    /*
+    ** One read gets the headers of every older packet that starts in the buffer...
+    */
+    Result = OS_lseek(FileStatus->FileHandle, FileStatus->RingTail, OS_SEEK_SET);
+
+    if (Result == FileStatus->RingTail)
+    {
+        Result = OS_read(FileStatus->FileHandle, DS_AppData.RingBuffer, ReadLength);
+
+        if (Result > 0)
+        {
+            BufferCount = Result;
+        }
+    }
+
+    while (((Position + sizeof(RecordHeader)) <= BufferCount) && (RingWalk->Count < DS_RING_WALK_RECORDS))
+    {
+        memcpy(&RecordHeader, &Buffer[Position], sizeof(RecordHeader));
+
+        RecordLength = 0;
+        CFE_MSG_GetSize(&RecordHeader, &RecordLength);
+
+        if (RecordLength < sizeof(RecordHeader))
+        {
+            /*
+            ** Not a packet - stop at the last good boundary...
+            */
+            BufferCount = 0;
+        }
+        else
+        {
+            Position += RecordLength;
+
+            RingWalk->Bound[RingWalk->Count] = FileStatus->RingTail + Position;
+            RingWalk->Count++;
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Write header to destination file                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FileWriteHeader(int32 FileIndex)
+{
+    if (DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE)
+    {
+        DS_DestFileEntry_t *DestFile   = &DS_AppData.DestFileTblPtr->File[FileIndex];
+        DS_AppFileStatus_t *FileStatus = &DS_AppData.FileStatus[FileIndex];
+        CFE_FS_Header_t     CFE_FS_Header;
+        DS_FileHeader_t     DS_FileHeader;
+        int32               Result;
+
+        /*
+        ** Initialize selected parts of the cFE file header...
+        */
+        CFE_FS_InitHeader(&CFE_FS_Header, DS_FILE_HDR_DESCRIPTION, DS_FILE_HDR_SUBTYPE);
+
+        /*
+        ** Let cFE finish the init and write the primary header...
+        */
+        Result = CFE_FS_WriteHeader(FileStatus->FileHandle, &CFE_FS_Header);
+
+        if (Result == sizeof(CFE_FS_Header_t))
+        {
+            /*
+            ** Success - update file size and data rate counters...
+            */
+            DS_AppData.FileWriteCounter++;
+
+            FileStatus->FileSize += sizeof(CFE_FS_Header_t);
+            FileStatus->FileGrowth += sizeof(CFE_FS_Header_t);
+
+            /*
+            ** Initialize the DS file header...
+            */
+            memset(&DS_FileHeader, 0, sizeof(DS_FileHeader));
+            DS_FileHeader.FileTableIndex = FileIndex;
+            DS_FileHeader.FileNameType   = DestFile->FileNameType;
+            strncpy(DS_FileHeader.FileName, FileStatus->FileName, sizeof(DS_FileHeader.FileName));
+
+            /*
+            ** Manually write the secondary header...
+            */
+            Result = OS_write(FileStatus->FileHandle, &DS_FileHeader, sizeof(DS_FileHeader_t));
+
+            if (Result == sizeof(DS_FileHeader_t))
+            {
+                /*
+                ** Success - update file size and data rate counters...
+                */
+                DS_AppData.FileWriteCounter++;
+
+                FileStatus->FileSize += sizeof(DS_FileHeader_t);
+                FileStatus->FileGrowth += sizeof(DS_FileHeader_t);
+            }
+            else
+            {
+                /*
+                ** Error - send event, close file and disable destination...
+                */
+                DS_FileWriteError(FileIndex, sizeof(DS_FileHeader_t), Result);
+            }
+        }
+        else
+        {
+            /*
+            ** Error - send event, close file and disable destination...
+            */
+            DS_FileWriteError(FileIndex, sizeof(CFE_FS_Header_t), Result);
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* File write error handler                                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void DS_FileWriteError(uint32 FileIndex, uint32 DataLength, int32 WriteResult)
+{
+    DS_AppFileStatus_t *FileStatus = &DS_AppData.FileStatus[FileIndex];
+
+    /*
+    ** Send event, close file and disable destination...
+    */
+    DS_AppData.FileWriteErrCounter++;
+    DS_AppData.DestStats[FileIndex].ErrorCount++;
+
+    CFE_EVS_SendEvent(DS_WRITE_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                      "FILE WRITE error: result = %d, length = %d, dest = %d, name = '%s'", (int)WriteResult,
+                      (int)DataLength, (int)FileIndex, FileStatus->FileName);
+
+    /*
+    ** Do not try to append a summary trailer after a write error...
+    */
+    DS_AppData.TrailerStatus[FileIndex].Active = false;
+
+    DS_FileCloseDest(FileIndex);
+
+    FileStatus->FileState = DS_DISABLED;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Create destination file                                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void DS_FileCreateDest(uint32 FileIndex)
+{
+    DS_DestFileEntry_t *DestFile   = &DS_AppData.DestFileTblPtr->File[FileIndex];
+    DS_AppFileStatus_t *FileStatus = &DS_AppData.FileStatus[FileIndex];
+    int32               Result;
+    osal_id_t           LocalFileHandle = OS_OBJECT_ID_UNDEFINED;
+    int64               StartTime       = 0;
+    char                ManifestName[DS_TOTAL_FNAME_BUFSIZE];
+
+    DS_DETAIL_PERF_ENTRY(DS_CREATE_DEST_PERF_ID);
+
+    if (DS_STATS_TIMING == 1)
+    {
+        StartTime = DS_AppStatsTime();
+    }
+
+    /*
+    ** Create filename from "path + base + sequence count + extension"...
+    */
+    DS_FileCreateName(FileIndex);
+
+    if (FileStatus->FileName[0] != 0)
+    {
+        /*
+        ** Make room for the new file within the storage budgets...
+        */
+        DS_FileStorageCheck(FileIndex);
+
+        /*
+        ** Success - create a new destination file...
+        */
+        Result = OS_OpenCreate(&LocalFileHandle, FileStatus->FileName, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE,
+                               OS_READ_WRITE);
+
+        if (Result != OS_SUCCESS)
+        {
+            /*
+            ** Error - send event, disable destination and reset filename...
+            */
+            DS_AppData.FileWriteErrCounter++;
+            DS_AppData.DestStats[FileIndex].ErrorCount++;
+
+            CFE_EVS_SendEvent(DS_CREATE_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "FILE CREATE error: result = %d, dest = %d, name = '%s'", (int)Result, (int)FileIndex,
+                              FileStatus->FileName);
+
+            memset(FileStatus->FileName, 0, sizeof(FileStatus->FileName));
+
+            /*
+            ** Shard directory may have been removed, create it again next time...
+            */
+            memset(DS_AppData.ShardStatus[FileIndex].CreatedDir, 0,
+                   sizeof(DS_AppData.ShardStatus[FileIndex].CreatedDir));
+
+            /*
+            ** Something needs to get fixed before we try again...
+            */
+            FileStatus->FileState = DS_DISABLED;
+        }
+        else
+        {
+            /*
+            ** Success - store the file handle...
+            */
+            DS_AppData.FileWriteCounter++;
+
+            FileStatus->FileHandle   = LocalFileHandle;
+            FileStatus->FileMode     = DestFile->FileMode;
+            FileStatus->CompressMode = DS_COMPRESS_NONE;
+            FileStatus->RecordMode   = DS_RECORD_FULL;
+
+            /*
+            ** Initialize and write config specific file header...
+            */
+            DS_FileWriteHeader(FileIndex);
+
+            /*
+            ** Ring files also need a ring header and preallocated space...
+            */
+            if (OS_ObjectIdDefined(FileStatus->FileHandle) && (FileStatus->FileMode == DS_FILE_MODE_RING))
+            {
+                DS_FileRingInit(FileIndex);
+            }
+
+            /*
+            ** Linear files may have a sidecar index...
+            */
+            if (OS_ObjectIdDefined(FileStatus->FileHandle) && (FileStatus->FileMode == DS_FILE_MODE_LINEAR) &&
+                ((DestFile->IndexPackets != 0) || (DestFile->IndexSeconds != 0)))
+            {
+                DS_FileIndexCreate(FileIndex);
+            }
+
+            /*
+            ** Linear files may have a summary trailer...
+            */
+            if (OS_ObjectIdDefined(FileStatus->FileHandle) && (FileStatus->FileMode == DS_FILE_MODE_LINEAR) &&
+                (DestFile->TrailerState == DS_ENABLED))
+            {
+                memset(&DS_AppData.TrailerStatus[FileIndex], 0, sizeof(DS_FileTrailerStatus_t));
+                DS_AppData.TrailerStatus[FileIndex].Active = true;
+            }
+
+            /*
+            ** Linear files may be compressed (after the headers)...
+            */
+            if (OS_ObjectIdDefined(FileStatus->FileHandle) && (FileStatus->FileMode == DS_FILE_MODE_LINEAR) &&
+                (DestFile->CompressMode == DS_COMPRESS_LZ))
+            {
+                DS_AppData.CompressStatus[FileIndex].BlockCount = 0;
+
+                FileStatus->CompressMode = DS_COMPRESS_LZ;
+                FileStatus->LogicalSize  = FileStatus->FileSize;
+            }
+
+            /*
+            ** Linear files may replace repeated packet headers with deltas...
+            */
+            if (OS_ObjectIdDefined(FileStatus->FileHandle) && (FileStatus->FileMode == DS_FILE_MODE_LINEAR) &&
+                (DestFile->RecordMode == DS_RECORD_DELTA))
+            {
+                memset(&DS_AppData.RecordStatus[FileIndex], 0, sizeof(DS_FileRecordStatus_t));
+
+                FileStatus->RecordMode = DS_RECORD_DELTA;
+            }
+
+            /*
+            ** Files that will be listed in a manifest remember when they were opened...
+            */
+            FileStatus->PayloadCrcActive = false;
+            FileStatus->PayloadCrc       = 0;
+
+            if (OS_ObjectIdDefined(FileStatus->FileHandle) &&
+                DS_FileManifestName(FileIndex, ManifestName, sizeof(ManifestName)))
+            {
+                FileStatus->OpenTime         = CFE_TIME_GetTime();
+                FileStatus->PayloadCrcActive = (FileStatus->FileMode == DS_FILE_MODE_LINEAR);
+            }
+
+            /*
+            ** Update sequence count if have one and write successful...
+            */
+            if (OS_ObjectIdDefined(FileStatus->FileHandle) && (DestFile->FileNameType == DS_BY_COUNT))
+            {
+                FileStatus->FileCount++;
+                if (FileStatus->FileCount > DS_MAX_SEQUENCE_COUNT)
+                {
+                    FileStatus->FileCount = DestFile->SequenceCount;
+                }
+
+                /*
+                ** Update Critical Data Store (CDS)...
+                */
+                DS_TableUpdateCDS();
+            }
+        }
+    }
+
+    if (DS_STATS_TIMING == 1)
+    {
+        DS_AppStatsRecord(&DS_AppData.Stats.Create, DS_AppStatsTime() - StartTime);
+    }
+
+    DS_DETAIL_PERF_EXIT(DS_CREATE_DEST_PERF_ID);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Initialize ring destination file                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FileRingInit(int32 FileIndex)
+{
+    DS_DestFileEntry_t *DestFile   = &DS_AppData.DestFileTblPtr->File[FileIndex];
+    DS_AppFileStatus_t *FileStatus = &DS_AppData.FileStatus[FileIndex];
+    DS_FileRingHeader_t RingHeader;
+    uint32              FillOffset;
+    uint32              FillLength;
+    int32               Result;
+
+    /*
+    ** Ring data area begins just after the ring header...
+    */
+    FileStatus->RingDataStart  = FileStatus->FileSize + sizeof(DS_FileRingHeader_t);
+    FileStatus->RingTail       = FileStatus->RingDataStart;
+    FileStatus->RingWrapOffset = 0;
+    FileStatus->RingWrapCount  = 0;
+
+    DS_AppData.RingWalk[FileIndex].Count = 0;
+    DS_AppData.RingWalk[FileIndex].Next  = 0;
+
+    memset(&RingHeader, 0, sizeof(RingHeader));
+    RingHeader.DataStart = FileStatus->RingDataStart;
+    RingHeader.Head      = FileStatus->RingDataStart;
+    RingHeader.Tail      = FileStatus->RingDataStart;
+
+    Result = OS_write(FileStatus->FileHandle, &RingHeader, sizeof(DS_FileRingHeader_t));
+
+    if (Result == sizeof(DS_FileRingHeader_t))
+    {
+        /*
+        ** Success - update file size and data rate counters...
+        */
+        DS_AppData.FileWriteCounter++;
+
+        FileStatus->FileSize += sizeof(DS_FileRingHeader_t);
+        FileStatus->FileGrowth += sizeof(DS_FileRingHeader_t);
+
+        /*
+        ** Preallocate by filling the ring with zeros (seeking past the end
+        **   would leave a sparse file that reserves no storage)...
+        */
+        if (DestFile->MaxFileSize > FileStatus->FileSize)
+        {
+            memset(DS_AppData.RingBuffer, 0, sizeof(DS_AppData.RingBuffer));
+
+            FillOffset = FileStatus->FileSize;
+            FillLength = 0;
+            Result     = 0;
+
+            while ((FillOffset < DestFile->MaxFileSize) && (Result == FillLength))
+            {
+                FillLength = DestFile->MaxFileSize - FillOffset;
+                if (FillLength > sizeof(DS_AppData.RingBuffer))
+                {
+                    FillLength = sizeof(DS_AppData.RingBuffer);
+                }
+
+                Result = OS_write(FileStatus->FileHandle, DS_AppData.RingBuffer, FillLength);
+                FillOffset += FillLength;
+            }
+
+            if (Result == FillLength)
+            {
+                Result = OS_lseek(FileStatus->FileHandle, FileStatus->FileSize, OS_SEEK_SET);
+            }
+
+            if (Result != FileStatus->FileSize)
+            {
+                /*
+                ** Error - send event, close file and disable destination...
+                */
+                DS_FileWriteError(FileIndex, DestFile->MaxFileSize, Result);
+            }
+        }
+    }
+    else
+    {
+        /*
+        ** Error - send event, close file and disable destination...
+        */
+        DS_FileWriteError(FileIndex, sizeof(DS_FileRingHeader_t), Result);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Create destination filename                                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void DS_FileCreateName(uint32 FileIndex)
+{
+    DS_DestFileEntry_t *  DestFile    = &DS_AppData.DestFileTblPtr->File[FileIndex];
+    DS_AppFileStatus_t *  FileStatus  = &DS_AppData.FileStatus[FileIndex];
+    DS_FileShardStatus_t *ShardStatus = &DS_AppData.ShardStatus[FileIndex];
+    int32                 TotalLength = 0;
+    int32                 ShardResult = OS_SUCCESS;
+
+    char Workname[2 * DS_TOTAL_FNAME_BUFSIZE];
+    char Sequence[DS_TOTAL_FNAME_BUFSIZE];
+
+    /* Copy in path */
+    CFE_SB_MessageStringGet(Workname, DestFile->Pathname, NULL, sizeof(Workname) / 2, sizeof(DestFile->Pathname));
+    TotalLength = strlen(Workname);
+
+    if (TotalLength > 0)
+    {
+        /* Add separator if needed */
+        if (Workname[TotalLength - 1] != DS_PATH_SEPARATOR)
+        {
+            /* There's always space since Workname is twice the size of Pathname */
+            Workname[TotalLength++] = DS_PATH_SEPARATOR;
+        }
+
+        /* Create the sequence portion of the filename (time shards use the same time) */
+        DS_FileCreateSequence(Sequence, DestFile->FileNameType, FileStatus->FileCount);
+
+        /* Add subdirectory shard (if any), creating it only when the shard changes */
+        DS_FileShardName(FileIndex, (DestFile->FileNameType == DS_BY_TIME) ? Sequence : NULL, ShardStatus->ShardName);
+
+        if (ShardStatus->ShardName[0] != '\0')
+        {
+            snprintf(&Workname[TotalLength], sizeof(Workname) - TotalLength, "%s", ShardStatus->ShardName);
+            ShardResult = DS_FileShardCreate(Workname, TotalLength - 1, ShardStatus->CreatedDir);
+
+            TotalLength             = strlen(Workname);
+            Workname[TotalLength++] = DS_PATH_SEPARATOR;
+        }
+
+        /* Add base name */
+        CFE_SB_MessageStringGet(&Workname[TotalLength], DestFile->Basename, NULL, sizeof(Workname) - TotalLength,
+                                sizeof(DestFile->Basename));
+        TotalLength = strlen(Workname);
+
+        /* Sequence is always null terminated so can use strncat */
+        strncat(&Workname[TotalLength], Sequence, sizeof(Workname) - TotalLength - 1);
+        TotalLength = strlen(Workname);
+
+        /* Only add extension if not empty */
+        if (DestFile->Extension[0] != '\0')
+        {
+            /* Add a "." character (if needed) before appending the extension */
+            if (DestFile->Extension[0] != '.')
+            {
+                strncat(Workname, ".", sizeof(Workname) - strlen(Workname) - 1);
+                TotalLength++;
+            }
+
+            /* Append the extension portion to the path/base+sequence portion */
+            CFE_SB_MessageStringGet(&Workname[TotalLength], DestFile->Extension, NULL, sizeof(Workname) - TotalLength,
+                                    sizeof(DestFile->Extension));
+        }
+
+        /* Confirm working name fits */
+        if (ShardResult != OS_SUCCESS)
+        {
+            /* Error - event already sent, disable destination */
+            DS_AppData.FileStatus[FileIndex].FileState = DS_DISABLED;
+        }
+        else if (strlen(Workname) < DS_TOTAL_FNAME_BUFSIZE)
+        {
+            /* Success - copy workname to filename buffer */
+            strcpy(FileStatus->FileName, Workname);
+        }
+        else
+        {
+            /* Error - send event and disable destination */
+            CFE_EVS_SendEvent(DS_FILE_NAME_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "FILE NAME error: dest = %d, path = '%s', base = '%s', seq = '%s', ext = '%s'",
+                              (int)FileIndex, DestFile->Pathname, DestFile->Basename, Sequence, DestFile->Extension);
+            DS_AppData.FileStatus[FileIndex].FileState = DS_DISABLED;
+        }
+    }
+    else
+    {
+        /* Send event and disable for invalid path */
+        CFE_EVS_SendEvent(DS_FILE_CREATE_EMPTY_PATH_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "FILE NAME error: Path empty. dest = %d, path = '%s'", (int)FileIndex, DestFile->Pathname);
+        DS_AppData.FileStatus[FileIndex].FileState = DS_DISABLED;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Set text from count or time                                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void DS_FileCreateSequence(char *Buffer, uint32 Type, uint32 Count)
+{
+    CFE_TIME_SysTime_t TimeToPrint;
+
+    uint32 SequenceCount = 0;
+    uint32 NumericDigit  = 0;
+
+    int32 BufferIndex = 0;
+
+    /*
+    ** Build the sequence portion of the filename (time or count)...
+    */
+    if (Type == DS_BY_COUNT)
+    {
+        /*
+        ** Get copy of sequence count that can be modified...
+        */
+        SequenceCount = Count;
+
+        /*
+        ** Extract each digit (least significant digit first)...
+        */
+        for (BufferIndex = DS_SEQUENCE_DIGITS - 1; BufferIndex >= 0; BufferIndex--)
+        {
+            /*
+            ** Extract this digit and prepare for next digit...
+            */
+            NumericDigit  = SequenceCount % 10;
+            SequenceCount = SequenceCount / 10;
+
+            /*
+            ** Store this digit as ASCII in sequence string buffer...
+            */
+            Buffer[BufferIndex] = '0' + NumericDigit;
+        }
+
+        /*
+        ** Add string terminator...
+        */
+        Buffer[DS_SEQUENCE_DIGITS] = '\0';
+    }
+    else if (Type == DS_BY_TIME)
+    {
+        /*
+        ** Filename is based on seconds from current time...
+        */
+        TimeToPrint = CFE_TIME_GetTime();
+
+        /*
+        ** Convert time value to cFE format text string...
+        */
+        CFE_TIME_Print(Buffer, TimeToPrint);
+
+/*
+** cFE time string has format: "YYYY-DDD-HH:MM:SS.sssss"...
+*/
+#define CFE_YYYY_INDEX 0
+#define CFE_DDD_INDEX  5
+#define CFE_HH_INDEX   9
+#define CFE_MM_INDEX   12
+#define CFE_SS_INDEX   15
+#define CFE_ssss_INDEX 18
+
+/*
+** DS time string has format: "YYYYDDDHHMMSS"...
+*/
+#define DS_YYYY_INDEX 0
+#define DS_DDD_INDEX  4
+#define DS_HH_INDEX   7
+#define DS_MM_INDEX   9
+#define DS_SS_INDEX   11
+#define DS_TERM_INDEX 13
+
+        /*
+        ** Convert cFE time string to DS time string by moving
+        **  the cFE chars to the left to remove extra stuff...
+        */
+
+        /*
+        ** Step 1: Leave "year" (YYYY) alone - it is already OK...
+        */
+
+        /*
+        ** Step 2: Move "day of year" (DDD) next to (YYYY)...
+        */
+        Buffer[DS_DDD_INDEX + 0] = Buffer[CFE_DDD_INDEX + 0];
+        Buffer[DS_DDD_INDEX + 1] = Buffer[CFE_DDD_INDEX + 1];
+        Buffer[DS_DDD_INDEX + 2] = Buffer[CFE_DDD_INDEX + 2];
+
+        /*
+        ** Step 3: Move "hour of day" (HH) next to (DDD)...
+        */
+        Buffer[DS_HH_INDEX + 0] = Buffer[CFE_HH_INDEX + 0];
+        Buffer[DS_HH_INDEX + 1] = Buffer[CFE_HH_INDEX + 1];
+
+        /*
+        ** Step 4: Move "minutes" (MM) next to (HH)...
+        */
+        Buffer[DS_MM_INDEX + 0] = Buffer[CFE_MM_INDEX + 0];
+        Buffer[DS_MM_INDEX + 1] = Buffer[CFE_MM_INDEX + 1];
+
+        /*
+        ** Step 5: Move "seconds" (SS) next to (MM)...
+        */
+        Buffer[DS_SS_INDEX + 0] = Buffer[CFE_SS_INDEX + 0];
+        Buffer[DS_SS_INDEX + 1] = Buffer[CFE_SS_INDEX + 1];
+
+        /*
+        ** Step 6: Skip "subsecs" (ssss) - not in DS format...
+        */
+
+        /*
+        ** Step 7: Add string terminator...
+        */
+        Buffer[DS_TERM_INDEX] = '\0';
+    }
+    else
+    {
+        /*
+        ** Bad filename type, init buffer as empty...
+        */
+        Buffer[0] = '\0';
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Set subdirectory shard text from time or count                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FileShardName(uint32 FileIndex, const char *TimeSequence, char *Buffer)
+{
+    DS_DestFileEntry_t *DestFile   = &DS_AppData.DestFileTblPtr->File[FileIndex];
+    DS_AppFileStatus_t *FileStatus = &DS_AppData.FileStatus[FileIndex];
+    char                Sequence[DS_TOTAL_FNAME_BUFSIZE];
+
+    if (DestFile->ShardMode == DS_SHARD_BY_TIME)
+    {
+        /*
+        ** Use the filename time (if any) so the file cannot land in the next hour...
+        */
+        if (TimeSequence != NULL)
+        {
+            snprintf(Sequence, sizeof(Sequence), "%s", TimeSequence);
+        }
+        else
+        {
+            DS_FileCreateSequence(Sequence, DS_BY_TIME, 0);
+        }
+
+        /*
+        ** Split the DS time string "YYYYDDDHHMMSS" into "YYYY/DDD/HH"...
+        */
+
+        snprintf(Buffer, DS_TOTAL_FNAME_BUFSIZE, "%.4s%c%.3s%c%.2s", &Sequence[DS_YYYY_INDEX], DS_PATH_SEPARATOR,
+                 &Sequence[DS_DDD_INDEX], DS_PATH_SEPARATOR, &Sequence[DS_HH_INDEX]);
+    }
+    else if ((DestFile->ShardMode == DS_SHARD_BY_COUNT) && (DestFile->ShardFiles != 0))
+    {
+        /*
+        ** Name the block of sequence counts after its first count...
+        */
+        DS_FileCreateSequence(Buffer, DS_BY_COUNT,
+                              FileStatus->FileCount - (FileStatus->FileCount % DestFile->ShardFiles));
+    }
+    else
+    {
+        /*
+        ** Not sharded, files go directly in the path directory...
+        */
+        Buffer[0] = '\0';
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Create subdirectory shard directories (when shard changes)      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 DS_FileShardCreate(const char *DirName, size_t BaseLength, char *KnownDir)
+{
+    char       Workname[DS_TOTAL_FNAME_BUFSIZE];
+    os_fstat_t FileStats;
+    size_t     DirLength = strlen(DirName);
+    size_t     i;
+    int32      Result = OS_SUCCESS;
+
+    /*
+    ** Nothing to create when the shard is the same as for the previous file...
+    */
+    if (strcmp(DirName, KnownDir) != 0)
+    {
+        if (DirLength < sizeof(Workname))
+        {
+            strcpy(Workname, DirName);
+
+            /*
+            ** Create each level below the base directory (some OSAL backends
+            **   report an error for a level that already exists)...
+            */
+            for (i = BaseLength + 1; (i <= DirLength) && (Result == OS_SUCCESS); i++)
+            {
+                if ((Workname[i] == DS_PATH_SEPARATOR) || (Workname[i] == '\0'))
+                {
+                    Workname[i] = '\0';
+                    Result      = OS_mkdir(Workname, OS_READ_WRITE);
+
+                    if (Result != OS_SUCCESS)
+                    {
+                        memset(&FileStats, 0, sizeof(FileStats));
+                        if ((OS_stat(Workname, &FileStats) == OS_SUCCESS) && OS_FILESTAT_ISDIR(FileStats))
+                        {
+                            Result = OS_SUCCESS;
+                        }
+                    }
+
+                    Workname[i] = DirName[i];
+                }
+            }
+        }
+        else
+        {
+            Result = OS_FS_ERR_PATH_TOO_LONG;
+        }
+
+        if (Result == OS_SUCCESS)
+        {
+            strcpy(KnownDir, Workname);
+        }
+        else
+        {
+            memset(KnownDir, 0, DS_TOTAL_FNAME_BUFSIZE);
+
+            CFE_EVS_SendEvent(DS_SHARD_DIR_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "SHARD DIR error: result = %d, dir = '%s'", (int)Result, DirName);
+        }
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Update destination file header                                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FileUpdateHeader(int32 FileIndex)
+{
+    if (DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE)
+    {
+        /*
+        ** Update CFE specific header fields...
+        */
+        DS_AppFileStatus_t *FileStatus  = &DS_AppData.FileStatus[FileIndex];
+        CFE_TIME_SysTime_t  CurrentTime = CFE_TIME_GetTime();
+        int32               Result;
+
+        Result = OS_lseek(FileStatus->FileHandle, sizeof(CFE_FS_Header_t), OS_SEEK_SET);
+
+        if (Result == sizeof(CFE_FS_Header_t))
+        {
+            /* update file close time */
+            Result = OS_write(FileStatus->FileHandle, &CurrentTime, sizeof(CFE_TIME_SysTime_t));
+
+            if (Result == sizeof(CFE_TIME_SysTime_t))
+            {
+                DS_AppData.FileUpdateCounter++;
+            }
+            else
+            {
+                DS_AppData.FileUpdateErrCounter++;
+            }
+        }
+        else
+        {
+            DS_AppData.FileUpdateErrCounter++;
+        }
+    }
+
+    if (DS_AppData.FileStatus[FileIndex].FileMode == DS_FILE_MODE_RING)
+    {
+        /*
+        ** Ring files also need the current head and tail offsets...
+        */
+        DS_FileRingUpdateHeader(FileIndex);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Update ring destination file header                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FileRingUpdateHeader(int32 FileIndex)
+{
+    DS_AppFileStatus_t *FileStatus = &DS_AppData.FileStatus[FileIndex];
+    DS_FileRingHeader_t RingHeader;
+    int32               HeaderOffset;
+    int32               Result;
+
+    memset(&RingHeader, 0, sizeof(RingHeader));
+    RingHeader.DataStart  = FileStatus->RingDataStart;
+    RingHeader.Head       = FileStatus->FileSize;
+    RingHeader.Tail       = FileStatus->RingTail;
+    RingHeader.WrapOffset = FileStatus->RingWrapOffset;
+    RingHeader.WrapCount  = FileStatus->RingWrapCount;
+
+    HeaderOffset = FileStatus->RingDataStart - sizeof(DS_FileRingHeader_t);
+
+    Result = OS_lseek(FileStatus->FileHandle, HeaderOffset, OS_SEEK_SET);
+
+    if (Result == HeaderOffset)
+    {
+        Result = OS_write(FileStatus->FileHandle, &RingHeader, sizeof(DS_FileRingHeader_t));
+    }
+
+    if (Result == sizeof(DS_FileRingHeader_t))
+    {
+        DS_AppData.FileUpdateCounter++;
+    }
+    else
+    {
+        DS_AppData.FileUpdateErrCounter++;
+    }
+
+    /*
+    ** Ring files may stay open - return the file position to the head...
+    */
+    OS_lseek(FileStatus->FileHandle, FileStatus->FileSize, OS_SEEK_SET);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Create sidecar index file                                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FileIndexCreate(int32 FileIndex)
+{
+    DS_DestFileEntry_t *  DestFile    = &DS_AppData.DestFileTblPtr->File[FileIndex];
+    DS_AppFileStatus_t *  FileStatus  = &DS_AppData.FileStatus[FileIndex];
+    DS_FileIndexStatus_t *IndexStatus = &DS_AppData.IndexStatus[FileIndex];
+    DS_FileIndexHeader_t  IndexHeader;
+    int32                 Result;
+    char                  IndexName[DS_TOTAL_FNAME_BUFSIZE];
+
+    IndexStatus->PktCount    = 0;
+    IndexStatus->LastSeconds = 0;
+    IndexStatus->RecordCount = 0;
+    IndexStatus->BufferCount = 0;
+
+    /*
+    ** Index filename is the destination filename plus index extension (built in
+    **   a local buffer, both names are in DS_AppData)...
+    */
+    Result = snprintf(IndexName, sizeof(IndexName), "%s%s", FileStatus->FileName, DS_INDEX_FILE_EXTENSION);
+
+    if ((Result < 0) || (Result >= sizeof(IndexName)))
+    {
+        CFE_EVS_SendEvent(DS_INDEX_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "INDEX FILE name error: dest = %d, name = '%s'", (int)FileIndex, FileStatus->FileName);
+
+        memset(IndexStatus->FileName, 0, sizeof(IndexStatus->FileName));
+    }
+    else
+    {
+        memcpy(IndexStatus->FileName, IndexName, sizeof(IndexStatus->FileName));
+
+        Result = OS_OpenCreate(&IndexStatus->IndexHandle, IndexStatus->FileName,
+                               OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE);
+
+        if (Result == OS_SUCCESS)
+        {
+            /*
+            ** Placeholder header - counts are filled in when finalized...
+            */
+            memset(&IndexHeader, 0, sizeof(IndexHeader));
+            IndexHeader.FileTableIndex = FileIndex;
+            IndexHeader.IndexPackets   = DestFile->IndexPackets;
+            IndexHeader.IndexSeconds   = DestFile->IndexSeconds;
+
+            Result = OS_write(IndexStatus->IndexHandle, &IndexHeader, sizeof(DS_FileIndexHeader_t));
+
+            if (Result != sizeof(DS_FileIndexHeader_t))
+            {
+                DS_FileIndexError(FileIndex, Result);
+            }
+        }
+        else
+        {
+            IndexStatus->IndexHandle = OS_OBJECT_ID_UNDEFINED;
+
+            CFE_EVS_SendEvent(DS_INDEX_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "INDEX FILE create error: result = %d, dest = %d, name = '%s'", (int)Result,
+                              (int)FileIndex, IndexStatus->FileName);
+
+            memset(IndexStatus->FileName, 0, sizeof(IndexStatus->FileName));
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Add sparse index record for a packet                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FileIndexPacket(int32 FileIndex, const CFE_MSG_Message_t *MsgPtr, uint32 FileOffset)
+{
+    DS_DestFileEntry_t *  DestFile    = &DS_AppData.DestFileTblPtr->File[FileIndex];
+    DS_FileIndexStatus_t *IndexStatus = &DS_AppData.IndexStatus[FileIndex];
+    DS_FileIndexRecord_t *Record      = NULL;
+    CFE_TIME_SysTime_t    PktTime     = {0};
+    CFE_SB_MsgId_t        MessageID   = CFE_SB_INVALID_MSG_ID;
+    bool                  IndexDue    = false;
+
+    /*
+    ** First packet in the file is always indexed...
+    */
+    IndexStatus->PktCount++;
+
+    if ((IndexStatus->RecordCount == 0) ||
+        ((DestFile->IndexPackets != 0) && (IndexStatus->PktCount >= DestFile->IndexPackets)))
+    {
+        IndexDue = true;
+    }
+
+    /*
+    ** Packet time is only needed for a time based index or a due record...
+    */
+    if (IndexDue || (DestFile->IndexSeconds != 0))
+    {
+        CFE_MSG_GetMsgTime(MsgPtr, &PktTime);
+
+        if ((DestFile->IndexSeconds != 0) && ((PktTime.Seconds - IndexStatus->LastSeconds) >= DestFile->IndexSeconds))
+        {
+            IndexDue = true;
+        }
+    }
+
+    if (IndexDue)
+    {
+        CFE_MSG_GetMsgId(MsgPtr, &MessageID);
+
+        Record             = &IndexStatus->Buffer[IndexStatus->BufferCount];
+        Record->FileOffset = FileOffset;
+        Record->Seconds    = PktTime.Seconds;
+        Record->Subseconds = PktTime.Subseconds;
+        Record->MessageID  = CFE_SB_MsgIdToValue(MessageID);
+
+        IndexStatus->BufferCount++;
+        IndexStatus->RecordCount++;
+        IndexStatus->PktCount    = 0;
+        IndexStatus->LastSeconds = PktTime.Seconds;
+
+        if (IndexStatus->BufferCount >= DS_INDEX_BUFFER_RECORDS)
+        {
+            DS_FileIndexFlush(FileIndex);
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Write buffered index records                                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FileIndexFlush(int32 FileIndex)
+{
+    DS_FileIndexStatus_t *IndexStatus = &DS_AppData.IndexStatus[FileIndex];
+    uint32                DataLength  = IndexStatus->BufferCount * sizeof(DS_FileIndexRecord_t);
+    int32                 Result;
+
+    if (IndexStatus->BufferCount > 0)
+    {
+        Result = OS_write(IndexStatus->IndexHandle, IndexStatus->Buffer, DataLength);
+
+        IndexStatus->BufferCount = 0;
+
+        if (Result != DataLength)
+        {
+            DS_FileIndexError(FileIndex, Result);
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Finalize and close sidecar index file                           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FileIndexClose(int32 FileIndex)
+{
+    DS_DestFileEntry_t *  DestFile    = &DS_AppData.DestFileTblPtr->File[FileIndex];
+    DS_FileIndexStatus_t *IndexStatus = &DS_AppData.IndexStatus[FileIndex];
+    DS_FileIndexHeader_t  IndexHeader;
+    int32                 Result;
+
+    if (OS_ObjectIdDefined(IndexStatus->IndexHandle))
+    {
+        DS_FileIndexFlush(FileIndex);
+    }
+
+    if (OS_ObjectIdDefined(IndexStatus->IndexHandle))
+    {
+        /*
+        ** Rewrite the header with the final counts...
+        */
+        memset(&IndexHeader, 0, sizeof(IndexHeader));
+        IndexHeader.RecordCount    = IndexStatus->RecordCount;
+        IndexHeader.DataFileSize   = DS_AppData.FileStatus[FileIndex].FileSize;
+        IndexHeader.FileTableIndex = FileIndex;
+        IndexHeader.IndexPackets   = DestFile->IndexPackets;
+        IndexHeader.IndexSeconds   = DestFile->IndexSeconds;
+
+        Result = OS_lseek(IndexStatus->IndexHandle, 0, OS_SEEK_SET);
+
+        if (Result == 0)
+        {
+            Result = OS_write(IndexStatus->IndexHandle, &IndexHeader, sizeof(DS_FileIndexHeader_t));
+        }
+
+        if (Result == sizeof(DS_FileIndexHeader_t))
+        {
+            OS_close(IndexStatus->IndexHandle);
+
+            IndexStatus->IndexHandle = OS_OBJECT_ID_UNDEFINED;
+        }
+        else
+        {
+            DS_FileIndexError(FileIndex, Result);
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Move sidecar index file with its destination file               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FileIndexMove(int32 FileIndex, const char *DataName)
+{
+    DS_FileIndexStatus_t *IndexStatus = &DS_AppData.IndexStatus[FileIndex];
+    char                  PathName[DS_TOTAL_FNAME_BUFSIZE];
+    int32                 Result;
+
+    if (IndexStatus->FileName[0] != '\0')
+    {
+        Result = snprintf(PathName, sizeof(PathName), "%s%s", DataName, DS_INDEX_FILE_EXTENSION);
+
+        if ((Result >= 0) && (Result < sizeof(PathName)))
+        {
+            Result = OS_mv(IndexStatus->FileName, PathName);
+        }
+        else
+        {
+            Result = OS_FS_ERR_PATH_TOO_LONG;
+        }
+
+        if (Result != OS_SUCCESS)
+        {
+            CFE_EVS_SendEvent(DS_INDEX_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "INDEX FILE move error: result = %d, dest = %d, name = '%s'", (int)Result,
+                              (int)FileIndex, IndexStatus->FileName);
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Sidecar index file error handler                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FileIndexError(int32 FileIndex, int32 Result)
+{
+    DS_FileIndexStatus_t *IndexStatus = &DS_AppData.IndexStatus[FileIndex];
+
+    /*
+    ** Send event and stop indexing - the data file is not affected...
+    */
+    CFE_EVS_SendEvent(DS_INDEX_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                      "INDEX FILE write error: result = %d, dest = %d, name = '%s'", (int)Result, (int)FileIndex,
+                      IndexStatus->FileName);
+
+    OS_close(IndexStatus->IndexHandle);
+
+    IndexStatus->IndexHandle = OS_OBJECT_ID_UNDEFINED;
+    IndexStatus->BufferCount = 0;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Accumulate summary trailer statistics for a packet              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FileTrailerPacket(int32 FileIndex, const CFE_MSG_Message_t *MsgPtr, uint32 DataLength)
+{
+    DS_FileTrailerStatus_t *TrailerStatus = &DS_AppData.TrailerStatus[FileIndex];
+    DS_FileTrailerEntry_t * Entry         = NULL;
+    CFE_SB_MsgId_t          MessageID     = CFE_SB_INVALID_MSG_ID;
+    CFE_MSG_SequenceCount_t SeqCount      = 0;
+    CFE_TIME_SysTime_t      PktTime       = {0};
+    uint32                  MsgIdValue;
+    uint32                  i;
+
+    CFE_MSG_GetMsgId(MsgPtr, &MessageID);
+    MsgIdValue = CFE_SB_MsgIdToValue(MessageID);
+
+    /*
+    ** Find the entry for this message ID (or add a new one)...
+    */
+    for (i = 0; i < TrailerStatus->EntryCount; i++)
+    {
+        if (TrailerStatus->Entry[i].MessageID == MsgIdValue)
+        {
+            Entry = &TrailerStatus->Entry[i];
+            break;
+        }
+    }
+
+    if ((Entry == NULL) && (TrailerStatus->EntryCount < DS_FILE_TRAILER_ENTRIES))
+    {
+        Entry            = &TrailerStatus->Entry[TrailerStatus->EntryCount];
+        Entry->MessageID = MsgIdValue;
+
+        TrailerStatus->EntryCount++;
+    }
+
+    if (Entry == NULL)
+    {
+        /*
+        ** Entries are full - count the packet in the footer only...
+        */
+        TrailerStatus->OtherPackets++;
+        TrailerStatus->OtherBytes += DataLength;
+    }
+    else
+    {
+        CFE_MSG_GetMsgTime(MsgPtr, &PktTime);
+        CFE_MSG_GetSequenceCount(MsgPtr, &SeqCount);
+
+        if (Entry->PacketCount == 0)
+        {
+            Entry->FirstSeconds    = PktTime.Seconds;
+            Entry->FirstSubseconds = PktTime.Subseconds;
+        }
+        else if (SeqCount != CFE_MSG_GetNextSequenceCount(TrailerStatus->LastSeqCount[i]))
+        {
+            Entry->SeqGapCount++;
+        }
+
+        Entry->PacketCount++;
+        Entry->ByteCount += DataLength;
+
+        Entry->LastSeconds    = PktTime.Seconds;
+        Entry->LastSubseconds = PktTime.Subseconds;
+
+        TrailerStatus->LastSeqCount[i] = SeqCount;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Append summary trailer to destination file                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FileTrailerWrite(int32 FileIndex)
+{
+    DS_AppFileStatus_t *    FileStatus    = &DS_AppData.FileStatus[FileIndex];
+    DS_FileTrailerStatus_t *TrailerStatus = &DS_AppData.TrailerStatus[FileIndex];
+    DS_FileTrailerFooter_t  Footer;
+    uint32                  EntryLength = TrailerStatus->EntryCount * sizeof(DS_FileTrailerEntry_t);
+    int32                   Result;
+
+    memset(&Footer, 0, sizeof(Footer));
+    Footer.EntryCount   = TrailerStatus->EntryCount;
+    Footer.OtherPackets = TrailerStatus->OtherPackets;
+    Footer.OtherBytes   = TrailerStatus->OtherBytes;
+    Footer.TrailerSize  = EntryLength + sizeof(DS_FileTrailerFooter_t);
+    Footer.Magic        = DS_FILE_TRAILER_MAGIC;
+
+    /*
+    ** Header updates move the file position - trailer goes at the end...
+    */
+    Result = OS_lseek(FileStatus->FileHandle, FileStatus->FileSize, OS_SEEK_SET);
+
+    if (Result == FileStatus->FileSize)
+    {
+        Result = EntryLength;
+
+        if (EntryLength > 0)
+        {
+            Result = OS_write(FileStatus->FileHandle, TrailerStatus->Entry, EntryLength);
+        }
+
+        if (Result == EntryLength)
+        {
+            Result = OS_write(FileStatus->FileHandle, &Footer, sizeof(DS_FileTrailerFooter_t));
+        }
+    }
+
+    if (Result == sizeof(DS_FileTrailerFooter_t))
+    {
+        DS_AppData.FileUpdateCounter++;
+
+        FileStatus->FileSize += Footer.TrailerSize;
+    }
+    else
+    {
+        DS_AppData.FileUpdateErrCounter++;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Buffer packet data for a compressed destination file            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 DS_FileCompressData(int32 FileIndex, const void *FileData, uint32 DataLength)
+{
+    DS_FileCompressStatus_t *CompressStatus = &DS_AppData.CompressStatus[FileIndex];
+    uint8 *                  Block          = (uint8 *)CompressStatus->Block;
+    const uint8 *            Data           = FileData;
+    uint32                   Copied         = 0;
+    uint32                   Chunk          = 0;
+    int32                    Result         = CFE_SUCCESS;
+
+    /*
+    ** Start a new block rather than split a packet that fits in one...
+    */
+    if ((CompressStatus->BlockCount != 0) && ((CompressStatus->BlockCount + DataLength) > DS_COMPRESS_BLOCK_SIZE))
+    {
+        Result = DS_FileCompressFlush(FileIndex);
+    }
+
+    /*
+    ** Packets larger than a block fill as many blocks as needed...
+    */
+    while ((Result == CFE_SUCCESS) && (Copied < DataLength))
+    {
+        Chunk = DataLength - Copied;
+
+        if (Chunk > (DS_COMPRESS_BLOCK_SIZE - CompressStatus->BlockCount))
+        {
+            Chunk = DS_COMPRESS_BLOCK_SIZE - CompressStatus->BlockCount;
+        }
+
+        memcpy(&Block[CompressStatus->BlockCount], &Data[Copied], Chunk);
+        CompressStatus->BlockCount += Chunk;
+        Copied += Chunk;
+
+        if (CompressStatus->BlockCount == DS_COMPRESS_BLOCK_SIZE)
+        {
+            Result = DS_FileCompressFlush(FileIndex);
+        }
+    }
+
+    if (Result == CFE_SUCCESS)
+    {
+        Result = DataLength;
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Compress and write buffered block                               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 DS_FileCompressFlush(int32 FileIndex)
+{
+    DS_AppFileStatus_t *     FileStatus     = &DS_AppData.FileStatus[FileIndex];
+    DS_FileCompressStatus_t *CompressStatus = &DS_AppData.CompressStatus[FileIndex];
+    DS_FileBlockHeader_t *   BlockHeader    = (DS_FileBlockHeader_t *)DS_AppData.CompressBuffer;
+    uint8 *                  BlockData      = (uint8 *)&BlockHeader[1];
+    uint32                   RawSize        = CompressStatus->BlockCount;
+    uint32                   StoredSize     = 0;
+    uint32                   WriteLength    = 0;
+    int32                    Result;
+
+    /*
+    ** Store the block uncompressed unless compression makes it smaller...
+    */
+    StoredSize = DS_CompressBlock((uint8 *)CompressStatus->Block, RawSize, BlockData, RawSize - 1);
+
+    if (StoredSize == 0)
+    {
+        StoredSize = RawSize;
+        memcpy(BlockData, CompressStatus->Block, RawSize);
+    }
+
+    BlockHeader->Magic      = DS_FILE_BLOCK_MAGIC;
+    BlockHeader->RawSize    = RawSize;
+    BlockHeader->StoredSize = StoredSize;
+    BlockHeader->Crc        = CFE_ES_CalculateCRC(CompressStatus->Block, RawSize, 0, CFE_MISSION_ES_DEFAULT_CRC);
+
+    /*
+    ** Write block header and block data together...
+    */
+    WriteLength = sizeof(DS_FileBlockHeader_t) + StoredSize;
+
+    DS_AppData.DestStats[FileIndex].WriteCalls++;
+
+    Result = OS_write(FileStatus->FileHandle, DS_AppData.CompressBuffer, WriteLength);
+    if (Result == WriteLength)
+    {
+        FileStatus->FileSize += WriteLength;
+        FileStatus->FileGrowth += WriteLength;
+
+        DS_AppData.DestStats[FileIndex].ByteCount += WriteLength;
+
+        DS_AppData.CompressRawBytes += RawSize;
+        DS_AppData.CompressFileBytes += WriteLength;
+
+        Result = CFE_SUCCESS;
+    }
+    else if (Result >= 0)
+    {
+        /*
+        ** Partial write - do not mistake the count for success...
+        */
+        Result = OS_ERROR;
+    }
+
+    /*
+    ** The buffered data is gone either way...
+    */
+    CompressStatus->BlockCount = 0;
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Write last compressed block before closing file                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FileCompressClose(int32 FileIndex)
+{
+    DS_AppFileStatus_t *FileStatus = &DS_AppData.FileStatus[FileIndex];
+    uint32              RawSize    = DS_AppData.CompressStatus[FileIndex].BlockCount;
+    int32               Result;
+
+    /*
+    ** Header updates move the file position - block goes at the end...
+    */
+    Result = OS_lseek(FileStatus->FileHandle, FileStatus->FileSize, OS_SEEK_SET);
+
+    if (Result == FileStatus->FileSize)
+    {
+        Result = DS_FileCompressFlush(FileIndex);
+    }
+    else
+    {
+        DS_AppData.CompressStatus[FileIndex].BlockCount = 0;
+    }
+
+    if (Result != CFE_SUCCESS)
+    {
+        /*
+        ** File is being closed - report the lost data without closing it again...
+        */
+        DS_AppData.FileWriteErrCounter++;
+        DS_AppData.DestStats[FileIndex].ErrorCount++;
+
+        CFE_EVS_SendEvent(DS_WRITE_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "FILE WRITE error: result = %d, length = %d, dest = %d, name = '%s'", (int)Result,
+                          (int)RawSize, (int)FileIndex, FileStatus->FileName);
+
+        /*
+        ** Trailer statistics would include the lost packets...
+        */
+        DS_AppData.TrailerStatus[FileIndex].Active = false;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Get destination file size tested against max file size          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 DS_FileLimitSize(int32 FileIndex, uint32 DataLength)
+{
+    DS_AppFileStatus_t *FileStatus = &DS_AppData.FileStatus[FileIndex];
+    uint32              BlockCount = DS_AppData.CompressStatus[FileIndex].BlockCount;
+    uint32              Blocks     = 0;
+    uint32              Result     = 0;
+
+    if (FileStatus->CompressMode != DS_COMPRESS_LZ)
+    {
+        Result = FileStatus->FileSize + DataLength;
+    }
+    else if (DS_AppData.DestFileTblPtr->File[FileIndex].SizeLimitMode == DS_SIZE_LIMIT_LOGICAL)
+    {
+        Result = FileStatus->LogicalSize + DataLength;
+    }
+    else
+    {
+        /*
+        ** Physical size if buffered and new data are stored uncompressed...
+        */
+        Blocks = (DataLength + DS_COMPRESS_BLOCK_SIZE - 1) / DS_COMPRESS_BLOCK_SIZE;
+
+        if ((BlockCount != 0) && ((BlockCount + DataLength) > DS_COMPRESS_BLOCK_SIZE))
+        {
+            Blocks++;
+        }
+
+        Result = FileStatus->FileSize + BlockCount + DataLength + (Blocks * sizeof(DS_FileBlockHeader_t));
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Get destination file size before compression                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 DS_FileLogicalSize(const DS_AppFileStatus_t *FileStatus)
+{
+    uint32 Result = FileStatus->FileSize;
+
+    if (FileStatus->CompressMode == DS_COMPRESS_LZ)
+    {
+        Result = FileStatus->LogicalSize;
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Encode packet as a delta record                                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_FileRecordEncode(int32 FileIndex, const CFE_MSG_Message_t *MsgPtr, uint32 DataLength, uint32 *RecordLength)
+{
+    DS_DestFileEntry_t *      DestFile     = &DS_AppData.DestFileTblPtr->File[FileIndex];
+    const uint8 *             PacketBytes  = (const uint8 *)MsgPtr;
+    uint8 *                   Record       = (uint8 *)DS_AppData.RecordBuffer;
+    uint32                    HeaderSize   = sizeof(CFE_MSG_TelemetryHeader_t);
+    CFE_MSG_Type_t            MessageType  = CFE_MSG_Type_Invalid;
+    bool                      HasSecondary = false;
+    bool                      IsDelta      = false;
+    CFE_MSG_SequenceCount_t   SeqCount     = 0;
+    CFE_MSG_SequenceCount_t   RefSeqCount  = 0;
+    CFE_TIME_SysTime_t        PacketTime;
+    CFE_TIME_SysTime_t        RefTime;
+    uint64                    PacketTicks;
+    uint64                    RefTicks;
+    uint32                    SeqDelta;
+    uint32                    TimeDelta = 0;
+    DS_FileRecordRef_t *      RecordRef;
+    CFE_MSG_TelemetryHeader_t Rebuilt;
+
+    CFE_MSG_GetType(MsgPtr, &MessageType);
+    CFE_MSG_GetHasSecondaryHeader(MsgPtr, &HasSecondary);
+
+    /*
+    ** Only telemetry packets have a time stamp to take a delta of...
+    */
+    if ((MessageType == CFE_MSG_Type_Tlm) && HasSecondary && (DataLength > HeaderSize))
+    {
+        RecordRef = DS_FileRecordFind(FileIndex, (uint16)((PacketBytes[0] << 8) | PacketBytes[1]));
+
+        if ((RecordRef->PacketSize == DataLength) && (RecordRef->DeltaCount < (DestFile->KeyframeInterval - 1)) &&
+            ((DataLength - HeaderSize + DS_FILE_RECORD_DELTA_SIZE) <= sizeof(DS_AppData.RecordBuffer)))
+        {
+            CFE_MSG_GetSequenceCount(MsgPtr, &SeqCount);
+            CFE_MSG_GetSequenceCount(&RecordRef->Header.Msg, &RefSeqCount);
+            CFE_MSG_GetMsgTime(MsgPtr, &PacketTime);
+            CFE_MSG_GetMsgTime(&RecordRef->Header.Msg, &RefTime);
+
+            SeqDelta    = ((uint32)SeqCount + DS_FILE_RECORD_SEQ_MODULUS - RefSeqCount) % DS_FILE_RECORD_SEQ_MODULUS;
+            PacketTicks = ((uint64)PacketTime.Seconds << 16) | (PacketTime.Subseconds >> 16);
+            RefTicks    = ((uint64)RefTime.Seconds << 16) | (RefTime.Subseconds >> 16);
+
+            if ((SeqDelta <= DS_FILE_RECORD_MAX_SEQ_DELTA) && (PacketTicks >= RefTicks) &&
+                ((PacketTicks - RefTicks) <= DS_FILE_RECORD_MAX_TIME_DELTA))
+            {
+                TimeDelta = (uint32)(PacketTicks - RefTicks);
+
+                /*
+                ** Only use the delta if a reader gets back the same header bytes...
+                */
+                DS_FileRecordApply(&RecordRef->Header, SeqDelta, TimeDelta, &Rebuilt);
+
+                if (memcmp(&Rebuilt, MsgPtr, HeaderSize) == 0)
+                {
+                    Record[0] = DS_FILE_RECORD_DELTA_TAG;
+                    Record[1] = PacketBytes[0];
+                    Record[2] = PacketBytes[1];
+                    Record[3] = (uint8)SeqDelta;
+                    Record[4] = (uint8)(TimeDelta >> 16);
+                    Record[5] = (uint8)(TimeDelta >> 8);
+                    Record[6] = (uint8)TimeDelta;
+
+                    memcpy(&Record[DS_FILE_RECORD_DELTA_SIZE], &PacketBytes[HeaderSize], DataLength - HeaderSize);
+
+                    *RecordLength = DS_FILE_RECORD_DELTA_SIZE + DataLength - HeaderSize;
+                    IsDelta       = true;
+                }
+            }
+        }
+
+        if (IsDelta)
+        {
+            RecordRef->DeltaCount++;
+        }
+        else
+        {
+            RecordRef->DeltaCount = 0;
+        }
+
+        /*
+        ** This packet is the reference for the next one in its stream...
+        */
+        memcpy(&RecordRef->Header, MsgPtr, HeaderSize);
+        RecordRef->PacketSize = DataLength;
+    }
+
+    return IsDelta;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Find delta record reference for a packet stream                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+DS_FileRecordRef_t *DS_FileRecordFind(int32 FileIndex, uint16 StreamId)
+{
+    DS_FileRecordStatus_t *RecordStatus = &DS_AppData.RecordStatus[FileIndex];
+    DS_FileRecordRef_t *   RecordRef    = NULL;
+    uint32                 i;
+
+    for (i = 0; (i < DS_RECORD_REFERENCES) && (RecordRef == NULL); i++)
+    {
+        if ((RecordStatus->Ref[i].PacketSize != 0) && (RecordStatus->Ref[i].StreamId == StreamId))
+        {
+            RecordRef = &RecordStatus->Ref[i];
+        }
+    }
+
+    if (RecordRef == NULL)
+    {
+        /*
+        ** Replace streams in the order they were first remembered...
+        */
+        RecordRef             = &RecordStatus->Ref[RecordStatus->NextRef];
+        RecordStatus->NextRef = (RecordStatus->NextRef + 1) % DS_RECORD_REFERENCES;
+
+        RecordRef->StreamId   = StreamId;
+        RecordRef->DeltaCount = 0;
+        RecordRef->PacketSize = 0;
+    }
+
+    return RecordRef;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Rebuild packet header from a delta record                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FileRecordApply(const CFE_MSG_TelemetryHeader_t *RefHeader, uint32 SeqDelta, uint32 TimeDelta,
+                        CFE_MSG_TelemetryHeader_t *Header)
+{
+    CFE_MSG_SequenceCount_t SeqCount = 0;
+    CFE_TIME_SysTime_t      MsgTime;
+    uint64                  Ticks;
+
+    memcpy(Header, RefHeader, sizeof(CFE_MSG_TelemetryHeader_t));
+
+    CFE_MSG_GetSequenceCount(&Header->Msg, &SeqCount);
+    SeqCount = (CFE_MSG_SequenceCount_t)((SeqCount + SeqDelta) % DS_FILE_RECORD_SEQ_MODULUS);
+    CFE_MSG_SetSequenceCount(&Header->Msg, SeqCount);
+
+    CFE_MSG_GetMsgTime(&Header->Msg, &MsgTime);
+    Ticks = (((uint64)MsgTime.Seconds << 16) | (MsgTime.Subseconds >> 16)) + TimeDelta;
+
+    MsgTime.Seconds    = (uint32)(Ticks >> 16);
+    MsgTime.Subseconds = (uint32)(Ticks & 0xFFFF) << 16;
+    CFE_MSG_SetMsgTime(&Header->Msg, MsgTime);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Close destination file                                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void DS_FileCloseDest(int32 FileIndex)
+{
+    DS_AppFileStatus_t *  FileStatus  = &DS_AppData.FileStatus[FileIndex];
+    DS_FileShardStatus_t *ShardStatus = &DS_AppData.ShardStatus[FileIndex];
+    int32                 OS_result;
+    int32                 PathLength;
+    int32                 BaseLength;
+    char *                FileName;
+    char                  PathName[DS_TOTAL_FNAME_BUFSIZE];
+    int64                 StartTime  = 0;
+    bool                  MoveFailed = false;
+
+    DS_DETAIL_PERF_ENTRY(DS_CLOSE_DEST_PERF_ID);
+
+    if (DS_STATS_TIMING == 1)
+    {
+        StartTime = DS_AppStatsTime();
+    }
+
+    /*
+    ** Write the last compressed block (if any) before the trailer...
+    */
+    if (DS_AppData.CompressStatus[FileIndex].BlockCount != 0)
+    {
+        DS_FileCompressClose(FileIndex);
+    }
+
+    /*
+    ** Append the summary trailer (if any) before closing the file...
+    */
+    if (DS_AppData.TrailerStatus[FileIndex].Active)
+    {
+        DS_FileTrailerWrite(FileIndex);
+
+        DS_AppData.TrailerStatus[FileIndex].Active = false;
+    }
+
+    /*
+    ** Close the file (and finalize its index)...
+    */
+    OS_close(FileStatus->FileHandle);
+
+    DS_FileIndexClose(FileIndex);
+
+    if (DS_AppData.EnableMoveFiles == DS_ENABLED)
+    {
+        /*
+        ** Move file only if table has a downlink directory name...
+        */
+        if (DS_AppData.DestFileTblPtr->File[FileIndex].Movename[0] != '\0')
+        {
+            /*
+            ** Make sure directory name does not end with slash character...
+            */
+            CFE_SB_MessageStringGet(PathName, DS_AppData.DestFileTblPtr->File[FileIndex].Movename, NULL,
+                                    sizeof(PathName), sizeof(DS_AppData.DestFileTblPtr->File[FileIndex].Movename));
+            PathLength = strlen(PathName);
+            if (PathName[PathLength - 1] == '/')
+            {
+                PathName[PathLength - 1] = '\0';
+                PathLength--;
+            }
+
+            /*
+            ** Files from a sharded destination move to the same shard...
+            */
+            BaseLength = PathLength;
+            if (ShardStatus->ShardName[0] != '\0')
+            {
+                snprintf(&PathName[PathLength], sizeof(PathName) - PathLength, "/%s", ShardStatus->ShardName);
+                PathLength = strlen(PathName);
+            }
+
+            /*
+            ** Get a pointer to slash character before the filename...
+            */
+            FileName = strrchr(FileStatus->FileName, '/');
+
+            if (FileName != NULL)
+            {
+                /*
+                ** Verify that directory name plus filename is not too large...
+                */
+                if ((PathLength + strlen(FileName)) < DS_TOTAL_FNAME_BUFSIZE)
+                {
+                    /*
+                    ** Create the shard directory (unless known to exist)...
+                    */
+                    OS_result = OS_SUCCESS;
+                    if (PathLength > BaseLength)
+                    {
+                        OS_result = DS_FileShardCreate(PathName, BaseLength, ShardStatus->MovedDir);
+                    }
+
+                    if (OS_result == OS_SUCCESS)
+                    {
+                        /*
+                        ** Append the filename (with slash) to the directory name...
+                        */
+                        strcat(PathName, FileName);
+
+                        /*
+                        ** Use OS function to move/rename the file...
+                        */
+                        OS_result = OS_mv(FileStatus->FileName, PathName);
+                    }
+
+                    if (OS_result != OS_SUCCESS)
+                    {
+                        /*
+                        ** Error - send event but leave destination enabled, the shard
+                        **   directory may have been removed so create it again next time...
+                        */
+                        memset(ShardStatus->MovedDir, 0, sizeof(ShardStatus->MovedDir));
+                        MoveFailed = true;
+
+                        CFE_EVS_SendEvent(DS_MOVE_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                                          "FILE MOVE error: src = '%s', tgt = '%s', result = %d", FileStatus->FileName,
+                                          PathName, (int)OS_result);
+                    }
+                    else
+                    {
+                        /*
+                        ** Success - the index file follows the data file...
+                        */
+                        DS_FileIndexMove(FileIndex, PathName);
+
+                        /*
+                        ** Tell downstream consumers about the new file...
+                        */
+                        DS_FileManifestAppend(FileIndex, PathName);
+                    }
+                }
+                else
+                {
+                    /*
+                    ** Error - send event but leave destination enabled...
+                    */
+                    MoveFailed = true;
+
+                    CFE_EVS_SendEvent(DS_MOVE_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                                      "FILE MOVE error: dir name = '%s', filename = '%s'", PathName, FileName);
+                }
+            }
+            else
+            {
+                /*
+                ** Error - send event but leave destination enabled...
+                */
+                MoveFailed = true;
+
+                CFE_EVS_SendEvent(DS_MOVE_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "FILE MOVE error: dir name = '%s', filename = 'NULL'", PathName);
+            }
+
+            /* Update the path name for reporting */
+            snprintf(FileStatus->FileName, sizeof(FileStatus->FileName), "%s", PathName);
+        }
+    }
+
+    /*
+    ** Transmit file information telemetry...
+    */
+    DS_FileTransmit(FileStatus);
+
+    /*
+    ** Remember closed file for storage budget eviction (after a failed move the
+    **   reported name is the move target, which eviction must never remove)...
+    */
+    if (!MoveFailed)
+    {
+        DS_FileStorageRemember(FileIndex);
+    }
+
+    /*
+    ** Reset status for this destination file...
+    */
+    FileStatus->FileHandle     = OS_OBJECT_ID_UNDEFINED;
+    FileStatus->FileAge        = 0;
+    FileStatus->FileSize       = 0;
+    FileStatus->LogicalSize    = 0;
+    FileStatus->ManifestListed = false;
+
+    /*
+    ** Remove previous filenames from status data...
+    */
+    memset(FileStatus->FileName, 0, sizeof(FileStatus->FileName));
+    memset(DS_AppData.IndexStatus[FileIndex].FileName, 0, sizeof(DS_AppData.IndexStatus[FileIndex].FileName));
+
+    if (DS_STATS_TIMING == 1)
+    {
+        DS_AppStatsRecord(&DS_AppData.Stats.Close, DS_AppStatsTime() - StartTime);
+    }
+
+    DS_DETAIL_PERF_EXIT(DS_CLOSE_DEST_PERF_ID);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Remember closed destination file for storage budget             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FileStorageRemember(int32 FileIndex)
+{
+    DS_AppFileStatus_t *  FileStatus  = &DS_AppData.FileStatus[FileIndex];
+    DS_FileIndexStatus_t *IndexStatus = &DS_AppData.IndexStatus[FileIndex];
+    DS_ClosedFileList_t * ClosedList  = &DS_AppData.ClosedFiles[FileIndex];
+    DS_ClosedFile_t *     ClosedFile  = NULL;
+    uint32                FileSize    = FileStatus->FileSize;
+    uint32                IndexSize   = 0;
+    char                  FileName[DS_TOTAL_FNAME_BUFSIZE];
+
+    /*
+    ** Ring files occupy their preallocated size regardless of the head...
+    */
+    if ((FileStatus->FileMode == DS_FILE_MODE_RING) && (DS_AppData.DestFileTblPtr != NULL) &&
+        (DS_AppData.DestFileTblPtr->File[FileIndex].MaxFileSize > FileSize))
+    {
+        FileSize = DS_AppData.DestFileTblPtr->File[FileIndex].MaxFileSize;
+    }
+
+    /*
+    ** A sidecar index counts against the budgets and is deleted with its file...
+    */
+    if (IndexStatus->FileName[0] != '\0')
+    {
+        IndexSize = sizeof(DS_FileIndexHeader_t) + (IndexStatus->RecordCount * sizeof(DS_FileIndexRecord_t));
+    }
+
+    /*
+    ** History is full - forget (but do not delete) the oldest file...
+    */
+    if (ClosedList->Count >= DS_CLOSED_FILE_HISTORY)
+    {
+        DS_FileStorageForget(FileIndex);
+    }
+
+    ClosedFile = &ClosedList->File[(ClosedList->Oldest + ClosedList->Count) % DS_CLOSED_FILE_HISTORY];
+
+    ClosedFile->FileSize      = FileSize;
+    ClosedFile->IndexSize     = IndexSize;
+    ClosedFile->CloseSequence = DS_AppData.CloseSequence++;
+
+    /*
+    ** Copy the name through a local buffer (both names are in DS_AppData)...
+    */
+    snprintf(FileName, sizeof(FileName), "%s", FileStatus->FileName);
+    memcpy(ClosedFile->FileName, FileName, sizeof(ClosedFile->FileName));
+
+    /*
+    ** Manifest the file was just listed in, for the eviction record...
+    */
+    if (!FileStatus->ManifestListed ||
+        !DS_FileManifestName(FileIndex, ClosedFile->ManifestName, sizeof(ClosedFile->ManifestName)))
+    {
+        ClosedFile->ManifestName[0] = '\0';
+    }
+
+    ClosedList->Count++;
+    ClosedList->TotalSize += FileSize + IndexSize;
+    DS_AppData.ClosedFileBytes += FileSize + IndexSize;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Forget oldest remembered closed file (file is not deleted)      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FileStorageForget(int32 FileIndex)
+{
+    DS_ClosedFileList_t *ClosedList = &DS_AppData.ClosedFiles[FileIndex];
+    DS_ClosedFile_t *    ClosedFile = &ClosedList->File[ClosedList->Oldest];
+
+    if (ClosedList->Count > 0)
+    {
+        ClosedList->TotalSize -= ClosedFile->FileSize + ClosedFile->IndexSize;
+        DS_AppData.ClosedFileBytes -= ClosedFile->FileSize + ClosedFile->IndexSize;
+
+        memset(ClosedFile, 0, sizeof(DS_ClosedFile_t));
+
+        ClosedList->Oldest = (ClosedList->Oldest + 1) % DS_CLOSED_FILE_HISTORY;
+        ClosedList->Count--;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Delete oldest remembered closed file                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FileStorageEvict(int32 FileIndex)
+{
+    DS_ClosedFileList_t *ClosedList = &DS_AppData.ClosedFiles[FileIndex];
+    DS_ClosedFile_t *    ClosedFile = &ClosedList->File[ClosedList->Oldest];
+    char                 IndexName[DS_TOTAL_FNAME_BUFSIZE];
+    int32                Result;
+
+    if (ClosedList->Count > 0)
+    {
+        Result = OS_remove(ClosedFile->FileName);
+
+        if (Result == OS_SUCCESS)
+        {
+            DS_AppData.EvictedFileCounter++;
+
+            /*
+            ** Tell downstream consumers the listed file is gone...
+            */
+            if (ClosedFile->ManifestName[0] != '\0')
+            {
+                DS_FileManifestEvict(FileIndex, ClosedFile);
+            }
+
+            CFE_EVS_SendEvent(DS_EVICT_FILE_INF_EID, CFE_EVS_EventType_INFORMATION,
+                              "FILE EVICT: dest = %d, size = %d, name = '%s'", (int)FileIndex,
+                              (int)(ClosedFile->FileSize + ClosedFile->IndexSize), ClosedFile->FileName);
+        }
+        else
+        {
+            /*
+            ** Error - send event, file is forgotten regardless...
+            */
+            CFE_EVS_SendEvent(DS_EVICT_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "FILE EVICT error: result = %d, dest = %d, name = '%s'", (int)Result, (int)FileIndex,
+                              ClosedFile->FileName);
+        }
+
+        /*
+        ** The sidecar index (named and moved with the data file) goes too...
+        */
+        if (ClosedFile->IndexSize != 0)
+        {
+            Result = snprintf(IndexName, sizeof(IndexName), "%s%s", ClosedFile->FileName, DS_INDEX_FILE_EXTENSION);
+
+            if ((Result >= 0) && (Result < sizeof(IndexName)))
+            {
+                Result = OS_remove(IndexName);
+            }
+            else
+            {
+                Result = OS_FS_ERR_PATH_TOO_LONG;
+            }
+
+            if (Result != OS_SUCCESS)
+            {
+                CFE_EVS_SendEvent(DS_EVICT_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "FILE EVICT error: result = %d, dest = %d, name = '%s%s'", (int)Result,
+                                  (int)FileIndex, ClosedFile->FileName, DS_INDEX_FILE_EXTENSION);
+            }
+        }
+
+        DS_FileStorageForget(FileIndex);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Select destination to evict from for the global budget          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 DS_FileStorageVictim(uint16 StoragePriority)
+{
+    DS_DestFileEntry_t * DestFile       = NULL;
+    DS_ClosedFileList_t *ClosedList     = NULL;
+    uint16               VictimPriority = 0;
+    uint32               VictimSequence = 0;
+    int32                Victim         = DS_INDEX_NONE;
+    int32                i;
+
+    /*
+    ** Lowest storage priority first, then oldest close across destinations...
+    */
+    for (i = 0; i < DS_DEST_FILE_CNT; i++)
+    {
+        DestFile   = &DS_AppData.DestFileTblPtr->File[i];
+        ClosedList = &DS_AppData.ClosedFiles[i];
+
+        if ((ClosedList->Count > 0) && (DestFile->StoragePriority <= StoragePriority))
+        {
+            if ((Victim == DS_INDEX_NONE) || (DestFile->StoragePriority < VictimPriority) ||
+                ((DestFile->StoragePriority == VictimPriority) &&
+                 ((int32)(ClosedList->File[ClosedList->Oldest].CloseSequence - VictimSequence) < 0)))
+            {
+                Victim         = i;
+                VictimPriority = DestFile->StoragePriority;
+                VictimSequence = ClosedList->File[ClosedList->Oldest].CloseSequence;
+            }
+        }
+    }
+
+    return Victim;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Make room for a new destination file within storage budgets     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FileStorageCheck(int32 FileIndex)
+{
+    DS_DestFileEntry_t * DestFile   = &DS_AppData.DestFileTblPtr->File[FileIndex];
+    DS_ClosedFileList_t *ClosedList = &DS_AppData.ClosedFiles[FileIndex];
+    uint64               Reserved   = DestFile->MaxFileSize;
+    int32                Victim     = 0;
+    int32                i;
+
+    /*
+    ** Destination budget - evict this destination's own oldest files...
+    */
+    if (DestFile->MaxStorageSize != 0)
+    {
+        while ((ClosedList->Count > 0) && ((ClosedList->TotalSize + Reserved) > DestFile->MaxStorageSize))
+        {
+            DS_FileStorageEvict(FileIndex);
+        }
+    }
+
+    /*
+    ** Global budget - each open file reserves its max file size...
+    */
+    if (DS_AppData.StorageBudget != 0)
+    {
+        for (i = 0; i < DS_DEST_FILE_CNT; i++)
+        {
+            if ((i != FileIndex) && OS_ObjectIdDefined(DS_AppData.FileStatus[i].FileHandle))
+            {
+                Reserved += DS_AppData.DestFileTblPtr->File[i].MaxFileSize;
+            }
+        }
+
+        while (((DS_AppData.ClosedFileBytes + Reserved) > DS_AppData.StorageBudget) && (Victim != DS_INDEX_NONE))
+        {
+            Victim = DS_FileStorageVictim(DestFile->StoragePriority);
+
+            if (Victim != DS_INDEX_NONE)
+            {
+                DS_FileStorageEvict(Victim);
+            }
+            else
+            {
+                /*
+                ** Nothing left that may be evicted - create the file anyway...
+                */
+                CFE_EVS_SendEvent(DS_STORAGE_FULL_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "STORAGE BUDGET exceeded: dest = %d, used = %u KB, budget = %u KB", (int)FileIndex,
+                                  (unsigned int)((DS_AppData.ClosedFileBytes + Reserved) / 1024),
+                                  (unsigned int)(DS_AppData.StorageBudget / 1024));
+            }
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* File age processor                                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void DS_FileTestAge(uint32 ElapsedSeconds)
+{
+    uint32 FileIndex = 0;
+
+    /*
+    ** Called from HK request command handler (elapsed = platform config)
+    */
+    if (DS_AppData.DestFileTblPtr != (DS_DestFileTable_t *)NULL)
+    {
+        /*
+        ** Cannot test file age without destination file table...
+        */
+        for (FileIndex = 0; FileIndex < DS_DEST_FILE_CNT; FileIndex++)
+        {
+            /*
+            ** Update age of open files...
+            */
+            if (OS_ObjectIdDefined(DS_AppData.FileStatus[FileIndex].FileHandle))
+            {
+                DS_AppData.FileStatus[FileIndex].FileAge += ElapsedSeconds;
+
+                if (DS_AppData.FileStatus[FileIndex].FileAge >= DS_AppData.DestFileTblPtr->File[FileIndex].MaxFileAge)
+                {
+                    if (DS_AppData.FileStatus[FileIndex].FileMode == DS_FILE_MODE_RING)
+                    {
+                        /*
+                        ** Ring files stay open - checkpoint the header instead...
+                        */
+                        DS_FileUpdateHeader(FileIndex);
+                        DS_AppData.FileStatus[FileIndex].FileAge = 0;
+                    }
+                    else
+                    {
+                        /*
+                        ** Close files that exceed maximum file age...
+                        */
+                        DS_AppData.DestStats[FileIndex].RolloverCount++;
+
+                        DS_FileUpdateHeader(FileIndex);
+                        DS_FileCloseDest(FileIndex);
+                    }
+                }
+            }
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Transmit file info                                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FileTransmit(DS_AppFileStatus_t *FileStatus)
+{
+    CFE_SB_Buffer_t *PktBuf;
+    DS_FileInfo_t *  FileInfo;
+
+    /*
+    ** Get a Message block of memory and initialize it
+    */
+    PktBuf = CFE_SB_AllocateMessageBuffer(sizeof(DS_FileCompletePkt_t));
+
+    /*
+    ** Process destination file info data...
+    */
+    if (PktBuf != NULL)
+    {
+        CFE_MSG_Init(&PktBuf->Msg, CFE_SB_ValueToMsgId(DS_COMP_TLM_MID), sizeof(DS_FileCompletePkt_t));
+
+        FileInfo = &((DS_FileCompletePkt_t *)PktBuf)->Payload;
+
+        /*
+        ** Set file age and size...
+        */
+        FileInfo->FileAge  = FileStatus->FileAge;
+        FileInfo->FileSize = FileStatus->FileSize;
+        /*
+        ** Set file growth rate (computed when process last HK request)...
+        */
+        FileInfo->FileRate = FileStatus->FileRate;
+        /*
+        ** Set current filename sequence count...
+        */
+        FileInfo->SequenceCount = FileStatus->FileCount;
+        /*
+        ** Set file size before compression...
+        */
+        FileInfo->LogicalSize = DS_FileLogicalSize(FileStatus);
+        /*
+        ** Set file enable/disable state...
+        */
+        FileInfo->EnableState = FileStatus->FileState;
+        /*
+        ** Set file closed state...
+        */
+        FileInfo->OpenState = DS_CLOSED;
+        /*
+        ** Set current open filename...
+        */
+        snprintf(FileInfo->FileName, sizeof(FileInfo->FileName), "%s", FileStatus->FileName);
+
+        /*
+        ** send file info telemetry...
+        ** NOTE: Timestamping is automatically handled by SB/Msg modules
+        ** when "IsOrigination" is set to true.
+        */
+        CFE_SB_TransmitBuffer(PktBuf, true);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Transmit destination statistics                                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FileTransmitDestStats(void)
+{
+    CFE_SB_Buffer_t *PktBuf;
+
+    /*
+    ** Get a Message block of memory and initialize it
+    */
+    PktBuf = CFE_SB_AllocateMessageBuffer(sizeof(DS_DestStatsPkt_t));
+
+    if (PktBuf != NULL)
+    {
+        CFE_MSG_Init(&PktBuf->Msg, CFE_SB_ValueToMsgId(DS_DEST_STATS_TLM_MID), sizeof(DS_DestStatsPkt_t));
+
+        memcpy(((DS_DestStatsPkt_t *)PktBuf)->Payload, DS_AppData.DestStats, sizeof(DS_AppData.DestStats));
+
+        /*
+        ** send destination statistics telemetry...
+        ** NOTE: Timestamping is automatically handled by SB/Msg modules
+        ** when "IsOrigination" is set to true.
+        */
+        CFE_SB_TransmitBuffer(PktBuf, true);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Get closed file manifest name                                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_FileManifestName(int32 FileIndex, char *ManifestName, size_t BufSize)
+{
+    DS_DestFileEntry_t *DestFile = &DS_AppData.DestFileTblPtr->File[FileIndex];
+    char                PathName[DS_TOTAL_FNAME_BUFSIZE];
+    size_t              PathLength;
+    int                 NameLength;
+    bool                Result = false;
+
+    if ((DS_MANIFEST_FILE_NAME[0] != '\0') && (DS_AppData.EnableMoveFiles == DS_ENABLED) &&
+        (DestFile->Movename[0] != '\0'))
+    {
+        /*
+        ** Make sure directory name does not end with slash character...
+        */
+        CFE_SB_MessageStringGet(PathName, DestFile->Movename, NULL, sizeof(PathName), sizeof(DestFile->Movename));
+        PathLength = strlen(PathName);
+        if (PathName[PathLength - 1] == '/')
+        {
+            PathName[PathLength - 1] = '\0';
+        }
+
+        NameLength = snprintf(ManifestName, BufSize, "%s/%s", PathName, DS_MANIFEST_FILE_NAME);
+
+        Result = (NameLength > 0) && ((size_t)NameLength < BufSize);
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Append closed file manifest record                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FileManifestAppend(int32 FileIndex, const char *FileName)
+{
+    DS_AppFileStatus_t *    FileStatus = &DS_AppData.FileStatus[FileIndex];
+    DS_DestFileEntry_t *    DestFile   = &DS_AppData.DestFileTblPtr->File[FileIndex];
+    DS_FileManifestRecord_t Record;
+    CFE_TIME_SysTime_t      CloseTime;
+    char                    ManifestName[DS_TOTAL_FNAME_BUFSIZE];
+
+    if (DS_FileManifestName(FileIndex, ManifestName, sizeof(ManifestName)))
+    {
+        memset(&Record, 0, sizeof(Record));
+
+        CloseTime = CFE_TIME_GetTime();
+
+        /*
+        ** Ring files occupy their preallocated size regardless of the head...
+        */
+        Record.FileSize = FileStatus->FileSize;
+        if ((FileStatus->FileMode == DS_FILE_MODE_RING) && (DestFile->MaxFileSize > Record.FileSize))
+        {
+            Record.FileSize = DestFile->MaxFileSize;
+        }
+
+        Record.OpenSeconds     = FileStatus->OpenTime.Seconds;
+        Record.OpenSubsecs     = FileStatus->OpenTime.Subseconds;
+        Record.CloseSeconds    = CloseTime.Seconds;
+        Record.CloseSubsecs    = CloseTime.Subseconds;
+        Record.FileTableIndex  = FileIndex;
+        Record.StoragePriority = DestFile->StoragePriority;
+        Record.PayloadCrcValid = FileStatus->PayloadCrcActive;
+        Record.RecordType      = DS_MANIFEST_RECORD_MOVED;
+        Record.PayloadCrc      = FileStatus->PayloadCrc;
+        snprintf(Record.FileName, sizeof(Record.FileName), "%s", FileName);
+
+        FileStatus->ManifestListed = DS_FileManifestWrite(FileIndex, ManifestName, &Record);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Append closed file manifest eviction record                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FileManifestEvict(int32 FileIndex, const DS_ClosedFile_t *ClosedFile)
+{
+    DS_FileManifestRecord_t Record;
+    CFE_TIME_SysTime_t      EvictTime;
+
+    memset(&Record, 0, sizeof(Record));
+
+    EvictTime = CFE_TIME_GetTime();
+
+    Record.FileSize       = ClosedFile->FileSize;
+    Record.CloseSeconds   = EvictTime.Seconds;
+    Record.CloseSubsecs   = EvictTime.Subseconds;
+    Record.FileTableIndex = FileIndex;
+    Record.RecordType     = DS_MANIFEST_RECORD_EVICTED;
+    snprintf(Record.FileName, sizeof(Record.FileName), "%s", ClosedFile->FileName);
+
+    DS_FileManifestWrite(FileIndex, ClosedFile->ManifestName, &Record);
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* Create destination filename                                     */
+/* Write closed file manifest record                               */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void DS_FileCreateName(uint32 FileIndex)
-{
-    DS_DestFileEntry_t *DestFile    = &DS_AppData.DestFileTblPtr->File[FileIndex];
-    DS_AppFileStatus_t *FileStatus  = &DS_AppData.FileStatus[FileIndex];
-    int32               TotalLength = 0;
-
-    char Workname[2 * DS_TOTAL_FNAME_BUFSIZE];
-    char Sequence[DS_TOTAL_FNAME_BUFSIZE];
 
-    /* Copy in path */
-    CFE_SB_MessageStringGet(Workname, DestFile->Pathname, NULL, sizeof(Workname) / 2, sizeof(DestFile->Pathname));
-    TotalLength = strlen(Workname);
+bool DS_FileManifestWrite(int32 FileIndex, const char *ManifestName, const DS_FileManifestRecord_t *Record)
+{
+    DS_ManifestStatus_t *Manifest = NULL;
+    int32                Offset;
+    int32                Result = OS_SUCCESS;
+    int32                i;
 
-    if (TotalLength > 0)
+    /*
+    ** Destinations sharing a Movename directory share the open manifest...
+    */
+    for (i = 0; (i < DS_DEST_FILE_CNT) && (Manifest == NULL); i++)
     {
-        /* Add separator if needed */
-        if (Workname[TotalLength - 1] != DS_PATH_SEPARATOR)
+        if (OS_ObjectIdDefined(DS_AppData.Manifest[i].Handle) &&
+            (strcmp(DS_AppData.Manifest[i].Name, ManifestName) == 0))
         {
-            /* There's always space since Workname is twice the size of Pathname */
-            Workname[TotalLength++] = DS_PATH_SEPARATOR;
+            Manifest = &DS_AppData.Manifest[i];
         }
+    }
 
-        /* Add base name */
-        CFE_SB_MessageStringGet(&Workname[TotalLength], DestFile->Basename, NULL, sizeof(Workname) - TotalLength,
-                                sizeof(DestFile->Basename));
-        TotalLength = strlen(Workname);
+    if (Manifest == NULL)
+    {
+        /*
+        ** Replace the manifest this destination opened before (Movename changed)...
+        */
+        Manifest = &DS_AppData.Manifest[FileIndex];
 
-        /* Create the sequence portion of the filename */
-        DS_FileCreateSequence(Sequence, DestFile->FileNameType, FileStatus->FileCount);
+        if (OS_ObjectIdDefined(Manifest->Handle))
+        {
+            OS_close(Manifest->Handle);
+            Manifest->Handle = OS_OBJECT_ID_UNDEFINED;
+        }
 
-        /* Sequence is always null terminated so can use strncat */
-        strncat(&Workname[TotalLength], Sequence, sizeof(Workname) - TotalLength - 1);
-        TotalLength = strlen(Workname);
+        Result = OS_OpenCreate(&Manifest->Handle, ManifestName, OS_FILE_FLAG_CREATE, OS_WRITE_ONLY);
 
-        /* Only add extension if not empty */
-        if (DestFile->Extension[0] != '\0')
+        if (Result == OS_SUCCESS)
         {
-            /* Add a "." character (if needed) before appending the extension */
-            if (DestFile->Extension[0] != '.')
-            {
-                strncat(Workname, ".", sizeof(Workname) - strlen(Workname) - 1);
-                TotalLength++;
-            }
+            snprintf(Manifest->Name, sizeof(Manifest->Name), "%s", ManifestName);
 
-            /* Append the extension portion to the path/base+sequence portion */
-            CFE_SB_MessageStringGet(&Workname[TotalLength], DestFile->Extension, NULL, sizeof(Workname) - TotalLength,
-                                    sizeof(DestFile->Extension));
-        }
+            Offset = OS_lseek(Manifest->Handle, 0, OS_SEEK_END);
+            Result = Offset;
 
-        /* Confirm working name fits */
-        if (strlen(Workname) < DS_TOTAL_FNAME_BUFSIZE)
-        {
-            /* Success - copy workname to filename buffer */
-            strcpy(FileStatus->FileName, Workname);
+            if (Offset >= 0)
+            {
+                /*
+                ** Overwrite a partial record left by an interrupted append...
+                */
+                Result = Offset - (Offset % sizeof(DS_FileManifestRecord_t));
+
+                if (Result != Offset)
+                {
+                    Result = OS_lseek(Manifest->Handle, Result, OS_SEEK_SET);
+                }
+            }
         }
         else
         {
-            /* Error - send event and disable destination */
-            CFE_EVS_SendEvent(DS_FILE_NAME_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "FILE NAME error: dest = %d, path = '%s', base = '%s', seq = '%s', ext = '%s'",
-                              (int)FileIndex, DestFile->Pathname, DestFile->Basename, Sequence, DestFile->Extension);
-            DS_AppData.FileStatus[FileIndex].FileState = DS_DISABLED;
+            Manifest->Handle = OS_OBJECT_ID_UNDEFINED;
         }
     }
+
+    if (Result >= 0)
+    {
+        Result = OS_write(Manifest->Handle, Record, sizeof(DS_FileManifestRecord_t));
+    }
+
+    if (Result == sizeof(DS_FileManifestRecord_t))
+    {
+        DS_AppData.ManifestCounter++;
+    }
     else
     {
-        /* Send event and disable for invalid path */
-        CFE_EVS_SendEvent(DS_FILE_CREATE_EMPTY_PATH_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "FILE NAME error: Path empty. dest = %d, path = '%s'", (int)FileIndex, DestFile->Pathname);
-        DS_AppData.FileStatus[FileIndex].FileState = DS_DISABLED;
+        /*
+        ** Open again (trimming any partial record) on the next append...
+        */
+        if (OS_ObjectIdDefined(Manifest->Handle))
+        {
+            OS_close(Manifest->Handle);
+            Manifest->Handle = OS_OBJECT_ID_UNDEFINED;
+        }
+
+        DS_AppData.ManifestErrCounter++;
+
+        CFE_EVS_SendEvent(DS_MANIFEST_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "MANIFEST write error: result = %d, dest = %d, manifest = '%s'", (int)Result,
+                          (int)FileIndex, ManifestName);
     }
+
+    return (Result == sizeof(DS_FileManifestRecord_t));
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* Set text from count or time                                     */
+/* Transmit closed file manifest position                          */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void DS_FileCreateSequence(char *Buffer, uint32 Type, uint32 Count)
-{
-    CFE_TIME_SysTime_t TimeToPrint;
 
-    uint32 SequenceCount = 0;
-    uint32 NumericDigit  = 0;
-
-    int32 BufferIndex = 0;
+void DS_FileTransmitManifest(int32 FileIndex, const char *ManifestName)
+{
+    CFE_SB_Buffer_t *         PktBuf;
+    DS_ManifestTlm_Payload_t *PayloadPtr;
+    os_fstat_t                FileStats;
 
     /*
-    ** Build the sequence portion of the filename (time or count)...
+    ** Get a Message block of memory and initialize it
     */
-    if (Type == DS_BY_COUNT)
+    PktBuf = CFE_SB_AllocateMessageBuffer(sizeof(DS_ManifestPkt_t));
+
+    if (PktBuf != NULL)
     {
+        CFE_MSG_Init(&PktBuf->Msg, CFE_SB_ValueToMsgId(DS_MANIFEST_TLM_MID), sizeof(DS_ManifestPkt_t));
+
+        PayloadPtr = &((DS_ManifestPkt_t *)PktBuf)->Payload;
+
+        PayloadPtr->FileTableIndex = FileIndex;
+        PayloadPtr->RecordSize     = sizeof(DS_FileManifestRecord_t);
+        PayloadPtr->AppendCount    = DS_AppData.ManifestCounter;
+        PayloadPtr->AppendErrCount = DS_AppData.ManifestErrCounter;
+
         /*
-        ** Get copy of sequence count that can be modified...
+        ** Only complete records count, a partial tail is overwritten by the next append...
         */
-        SequenceCount = Count;
+        memset(&FileStats, 0, sizeof(FileStats));
+        if (OS_stat(ManifestName, &FileStats) == OS_SUCCESS)
+        {
+            PayloadPtr->RecordCount = OS_FILESTAT_SIZE(FileStats) / sizeof(DS_FileManifestRecord_t);
+        }
+
+        snprintf(PayloadPtr->ManifestName, sizeof(PayloadPtr->ManifestName), "%s", ManifestName);
 
         /*
-        ** Extract each digit (least significant digit first)...
+        ** send manifest position telemetry...
+        ** NOTE: Timestamping is automatically handled by SB/Msg modules
+        ** when "IsOrigination" is set to true.
         */
-        for (BufferIndex = DS_SEQUENCE_DIGITS - 1; BufferIndex >= 0; BufferIndex--)
-        {
-            /*
-            ** Extract this digit and prepare for next digit...
-            */
-            NumericDigit  = SequenceCount % 10;
-            SequenceCount = SequenceCount / 10;
+        CFE_SB_TransmitBuffer(PktBuf, true);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Find room for a flight recorder record                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
+bool DS_FileRecorderRoom(const DS_RecorderStatus_t *Recorder, uint32 RecordSize, uint32 *Offset)
+{
+    uint32 Head = Recorder->Head;
+    uint32 Tail = Recorder->Tail;
+    bool   Room = false;
+
+    /*
+    ** Head may never catch up with Tail, that would make the ring look empty...
+    */
+    if (Head >= Tail)
+    {
+        if (((Head + RecordSize) < DS_RECORDER_BUFFER_SIZE) ||
+            (((Head + RecordSize) == DS_RECORDER_BUFFER_SIZE) && (Tail != 0)))
+        {
+            *Offset = Head;
+            Room    = true;
+        }
+        else if (RecordSize < Tail)
+        {
             /*
-            ** Store this digit as ASCII in sequence string buffer...
+            ** Record does not fit at the end - wrap to the buffer start...
             */
-            Buffer[BufferIndex] = '0' + NumericDigit;
+            *Offset = 0;
+            Room    = true;
         }
-
-        /*
-        ** Add string terminator...
-        */
-        Buffer[DS_SEQUENCE_DIGITS] = '\0';
     }
-    else if (Type == DS_BY_TIME)
+    else if ((Head + RecordSize) < Tail)
     {
-        /*
-        ** Filename is based on seconds from current time...
-        */
-        TimeToPrint = CFE_TIME_GetTime();
+        *Offset = Head;
+        Room    = true;
+    }
 
-        /*
-        ** Convert time value to cFE format text string...
-        */
-        CFE_TIME_Print(Buffer, TimeToPrint);
+    return Room;
+}
 
-/*
-** cFE time string has format: "YYYY-DDD-HH:MM:SS.sssss"...
-*/
-#define CFE_YYYY_INDEX 0
-#define CFE_DDD_INDEX  5
-#define CFE_HH_INDEX   9
-#define CFE_MM_INDEX   12
-#define CFE_SS_INDEX   15
-#define CFE_ssss_INDEX 18
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Discard the oldest flight recorder record                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-/*
-** DS time string has format: "YYYYDDDHHMMSS"...
-*/
-#define DS_YYYY_INDEX 0
-#define DS_DDD_INDEX  4
-#define DS_HH_INDEX   7
-#define DS_MM_INDEX   9
-#define DS_SS_INDEX   11
-#define DS_TERM_INDEX 13
+void DS_FileRecorderDiscard(DS_RecorderStatus_t *Recorder)
+{
+    const DS_RecorderRecord_t *Record = (const DS_RecorderRecord_t *)&((uint8 *)Recorder->Buffer)[Recorder->Tail];
 
-        /*
-        ** Convert cFE time string to DS time string by moving
-        **  the cFE chars to the left to remove extra stuff...
-        */
+    /*
+    ** Nothing to discard when no packets are held...
+    */
+    if (Recorder->Tail != Recorder->Head)
+    {
+        if (Record->PacketLength == 0)
+        {
+            /*
+            ** Unused end of buffer - next record is at the buffer start...
+            */
+            Recorder->Tail = 0;
+        }
+        else
+        {
+            Recorder->Tail += DS_RECORDER_RECORD_SIZE(Record->PacketLength);
 
-        /*
-        ** Step 1: Leave "year" (YYYY) alone - it is already OK...
-        */
+            if (Recorder->Tail == DS_RECORDER_BUFFER_SIZE)
+            {
+                Recorder->Tail = 0;
+            }
+        }
+    }
+}
 
-        /*
-        ** Step 2: Move "day of year" (DDD) next to (YYYY)...
-        */
-        Buffer[DS_DDD_INDEX + 0] = Buffer[CFE_DDD_INDEX + 0];
-        Buffer[DS_DDD_INDEX + 1] = Buffer[CFE_DDD_INDEX + 1];
-        Buffer[DS_DDD_INDEX + 2] = Buffer[CFE_DDD_INDEX + 2];
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Hold packet in flight recorder buffer                           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-        /*
-        ** Step 3: Move "hour of day" (HH) next to (DDD)...
-        */
-        Buffer[DS_HH_INDEX + 0] = Buffer[CFE_HH_INDEX + 0];
-        Buffer[DS_HH_INDEX + 1] = Buffer[CFE_HH_INDEX + 1];
+void DS_FileRecorderStore(uint16 RecorderIndex, const CFE_SB_Buffer_t *BufPtr, uint16 MaxStoreLength)
+{
+    DS_RecorderStatus_t *Recorder     = &DS_AppData.Recorder[RecorderIndex];
+    uint8 *              Bytes        = (uint8 *)Recorder->Buffer;
+    DS_RecorderRecord_t *Record       = NULL;
+    size_t               PacketLength = 0;
+    uint32               RecordSize   = 0;
+    uint32               Offset       = 0;
+    bool                 Room         = false;
 
-        /*
-        ** Step 4: Move "minutes" (MM) next to (HH)...
-        */
-        Buffer[DS_MM_INDEX + 0] = Buffer[CFE_MM_INDEX + 0];
-        Buffer[DS_MM_INDEX + 1] = Buffer[CFE_MM_INDEX + 1];
+    CFE_MSG_GetSize(&BufPtr->Msg, &PacketLength);
 
-        /*
-        ** Step 5: Move "seconds" (SS) next to (MM)...
-        */
-        Buffer[DS_SS_INDEX + 0] = Buffer[CFE_SS_INDEX + 0];
-        Buffer[DS_SS_INDEX + 1] = Buffer[CFE_SS_INDEX + 1];
+    RecordSize = DS_RECORDER_RECORD_SIZE(PacketLength);
 
-        /*
-        ** Step 6: Skip "subsecs" (ssss) - not in DS format...
-        */
+    if ((PacketLength != 0) && (PacketLength <= 0xFFFF) && (RecordSize <= (DS_RECORDER_BUFFER_SIZE / 2)))
+    {
+        Room = DS_FileRecorderRoom(Recorder, RecordSize, &Offset);
 
         /*
-        ** Step 7: Add string terminator...
+        ** While holding, the newest packets replace the oldest - while dumping,
+        **   Tail belongs to the dump and new packets are lost when the buffer is full...
         */
-        Buffer[DS_TERM_INDEX] = '\0';
+        while ((Room == false) && (Recorder->State == DS_RECORDER_HOLDING) && (Recorder->Tail != Recorder->Head))
+        {
+            DS_FileRecorderDiscard(Recorder);
+            Room = DS_FileRecorderRoom(Recorder, RecordSize, &Offset);
+        }
+    }
+
+    if (Room == false)
+    {
+        DS_AppData.RecorderDropCounter++;
     }
     else
     {
+        if (Offset != Recorder->Head)
+        {
+            /*
+            ** Mark the unused end of the buffer...
+            */
+            Record               = (DS_RecorderRecord_t *)&Bytes[Recorder->Head];
+            Record->PacketLength = 0;
+        }
+
+        Record                 = (DS_RecorderRecord_t *)&Bytes[Offset];
+        Record->PacketLength   = (uint16)PacketLength;
+        Record->MaxStoreLength = MaxStoreLength;
+        memcpy(&Record[1], BufPtr, PacketLength);
+
         /*
-        ** Bad filename type, init buffer as empty...
+        ** Publish the record only after it is complete...
         */
-        Buffer[0] = '\0';
+        Offset += RecordSize;
+        Recorder->Head = (Offset == DS_RECORDER_BUFFER_SIZE) ? 0 : Offset;
     }
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* Update destination file header                                  */
+/* Check packet for flight recorder trigger Message ID             */
 /*                                                                 */
-/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-
-void DS_FileUpdateHeader(int32 FileIndex)
-{
-    if (DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE)
-    {
-        /*
-        ** Update CFE specific header fields...
-        */
-        DS_AppFileStatus_t *FileStatus  = &DS_AppData.FileStatus[FileIndex];
-        CFE_TIME_SysTime_t  CurrentTime = CFE_TIME_GetTime();
-        int32               Result;
-
-        Result = OS_lseek(FileStatus->FileHandle, sizeof(CFE_FS_Header_t), OS_SEEK_SET);
-
-        if (Result == sizeof(CFE_FS_Header_t))
-        {
-            /* update file close time */
-            Result = OS_write(FileStatus->FileHandle, &CurrentTime, sizeof(CFE_TIME_SysTime_t));
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-            if (Result == sizeof(CFE_TIME_SysTime_t))
-            {
-                DS_AppData.FileUpdateCounter++;
-            }
-            else
-            {
-                DS_AppData.FileUpdateErrCounter++;
-            }
-        }
-        else
+void DS_FileRecorderCheck(CFE_SB_MsgId_t MessageID)
+{
+    uint16 i;
+
+    for (i = 0; i < DS_RECORDER_CNT; i++)
+    {
+        if ((DS_AppData.Recorder[i].State == DS_RECORDER_HOLDING) &&
+            CFE_SB_IsValidMsgId(DS_AppData.Recorder[i].TriggerMsgID) &&
+            CFE_SB_MsgId_Equal(DS_AppData.Recorder[i].TriggerMsgID, MessageID))
         {
-            DS_AppData.FileUpdateErrCounter++;
+            DS_FileRecorderTrigger(i, "message ID");
         }
     }
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* Close destination file                                          */
+/* Start a flight recorder dump                                    */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void DS_FileCloseDest(int32 FileIndex)
+
+void DS_FileRecorderTrigger(uint16 RecorderIndex, const char *Source)
 {
-    DS_AppFileStatus_t *FileStatus = &DS_AppData.FileStatus[FileIndex];
-    int32               OS_result;
-    int32               PathLength;
-    char *              FileName;
-    char                PathName[DS_TOTAL_FNAME_BUFSIZE];
+    DS_RecorderStatus_t *Recorder = &DS_AppData.Recorder[RecorderIndex];
+
+    Recorder->State          = DS_RECORDER_DUMPING;
+    Recorder->TriggerSeconds = CFE_TIME_GetMET().Seconds;
+    Recorder->DumpCount      = 0;
 
     /*
-    ** First, close the file...
+    ** Without a post-trigger window the dump ends with the packets held now...
     */
-    OS_close(FileStatus->FileHandle);
+    Recorder->PostDone = (Recorder->PostSeconds == 0);
+    Recorder->DumpEnd  = Recorder->Head;
 
-    if (DS_AppData.EnableMoveFiles == DS_ENABLED)
+    DS_AppData.RecorderTrigCounter++;
+
+    CFE_EVS_SendEvent(DS_RECORDER_TRIGGER_EID, CFE_EVS_EventType_INFORMATION,
+                      "Flight recorder %d triggered by %s: file table index = %d, post-trigger seconds = %d",
+                      (int)RecorderIndex, Source, (int)Recorder->FileTableIndex, (int)Recorder->PostSeconds);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Write held packets of dumping flight recorders                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FileRecorderDrain(uint32 MaxPackets)
+{
+    DS_RecorderStatus_t *      Recorder  = NULL;
+    const DS_RecorderRecord_t *Record    = NULL;
+    uint32                     Count     = 0;
+    uint16                     FileIndex = 0;
+    uint16                     i;
+
+    for (i = 0; i < DS_RECORDER_CNT; i++)
     {
+        Recorder = &DS_AppData.Recorder[i];
+
+        if (Recorder->State != DS_RECORDER_DUMPING)
+        {
+            continue;
+        }
+
+        FileIndex = Recorder->FileTableIndex;
+
         /*
-        ** Move file only if table has a downlink directory name...
+        ** Packets stored after the post-trigger window are held for the next trigger...
         */
-        if (DS_AppData.DestFileTblPtr->File[FileIndex].Movename[0] != '\0')
+        if ((Recorder->PostDone == false) &&
+            ((CFE_TIME_GetMET().Seconds - Recorder->TriggerSeconds) >= Recorder->PostSeconds))
         {
-            /*
-            ** Make sure directory name does not end with slash character...
-            */
-            CFE_SB_MessageStringGet(PathName, DS_AppData.DestFileTblPtr->File[FileIndex].Movename, NULL,
-                                    sizeof(PathName), sizeof(DS_AppData.DestFileTblPtr->File[FileIndex].Movename));
-            PathLength = strlen(PathName);
-            if (PathName[PathLength - 1] == '/')
+            Recorder->PostDone = true;
+            Recorder->DumpEnd  = Recorder->Head;
+        }
+
+        for (Count = 0; Count < MaxPackets; Count++)
+        {
+            if (Recorder->Tail == (Recorder->PostDone ? Recorder->DumpEnd : Recorder->Head))
             {
-                PathName[PathLength - 1] = '\0';
-                PathLength--;
+                break;
             }
 
-            /*
-            ** Get a pointer to slash character before the filename...
-            */
-            FileName = strrchr(FileStatus->FileName, '/');
+            Record = (const DS_RecorderRecord_t *)&((uint8 *)Recorder->Buffer)[Recorder->Tail];
 
-            if (FileName != NULL)
+            if (Record->PacketLength != 0)
             {
-                /*
-                ** Verify that directory name plus filename is not too large...
-                */
-                if ((PathLength + strlen(FileName)) < DS_TOTAL_FNAME_BUFSIZE)
+                if ((DS_AppData.DestFileTblPtr != (DS_DestFileTable_t *)NULL) &&
+                    (DS_AppData.FileStatus[FileIndex].FileState == DS_ENABLED))
                 {
-                    /*
-                    ** Append the filename (with slash) to the directory name...
-                    */
-                    strcat(PathName, FileName);
-
-                    /*
-                    ** Use OS function to move/rename the file...
-                    */
-                    OS_result = OS_mv(FileStatus->FileName, PathName);
-
-                    if (OS_result != OS_SUCCESS)
-                    {
-                        /*
-                        ** Error - send event but leave destination enabled...
-                        */
-                        CFE_EVS_SendEvent(DS_MOVE_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
-                                          "FILE MOVE error: src = '%s', tgt = '%s', result = %d", FileStatus->FileName,
-                                          PathName, (int)OS_result);
-                    }
+                    DS_FileSetupWrite(FileIndex, (const CFE_SB_Buffer_t *)&Record[1], Record->MaxStoreLength);
+                    Recorder->DumpCount++;
                 }
                 else
                 {
-                    /*
-                    ** Error - send event but leave destination enabled...
-                    */
-                    CFE_EVS_SendEvent(DS_MOVE_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
-                                      "FILE MOVE error: dir name = '%s', filename = '%s'", PathName, FileName);
+                    DS_AppData.RecorderDropCounter++;
                 }
             }
-            else
+
+            DS_FileRecorderDiscard(Recorder);
+        }
+
+        if (Recorder->PostDone && (Recorder->Tail == Recorder->DumpEnd))
+        {
+            /*
+            ** Each dump is a file of its own...
+            */
+            if (OS_ObjectIdDefined(DS_AppData.FileStatus[FileIndex].FileHandle))
             {
-                /*
-                ** Error - send event but leave destination enabled...
-                */
-                CFE_EVS_SendEvent(DS_MOVE_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
-                                  "FILE MOVE error: dir name = '%s', filename = 'NULL'", PathName);
+                DS_FileUpdateHeader(FileIndex);
+                DS_FileCloseDest(FileIndex);
             }
 
-            /* Update the path name for reporting */
-            snprintf(FileStatus->FileName, sizeof(FileStatus->FileName), "%s", PathName);
+            Recorder->State = DS_RECORDER_HOLDING;
+
+            CFE_EVS_SendEvent(DS_RECORDER_DUMP_EID, CFE_EVS_EventType_INFORMATION,
+                              "Flight recorder %d dump complete: file table index = %d, packets = %u", (int)i,
+                              (int)FileIndex, (unsigned int)Recorder->DumpCount);
         }
     }
+}
 
-    /*
-    ** Transmit file information telemetry...
-    */
-    DS_FileTransmit(FileStatus);
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Find latest-value cache entry index of a Message ID             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-    /*
-    ** Reset status for this destination file...
-    */
-    FileStatus->FileHandle = OS_OBJECT_ID_UNDEFINED;
-    FileStatus->FileAge    = 0;
-    FileStatus->FileSize   = 0;
+int32 DS_FileCacheIndex(CFE_SB_MsgId_t MessageID)
+{
+    uint16 Link       = DS_AppData.CacheHash[DS_TableHashFunction(MessageID)];
+    int32  CacheIndex = DS_INDEX_NONE;
 
     /*
-    ** Remove previous filename from status data...
+    ** Entries with the same hash table index are linked by index + 1...
     */
-    memset(FileStatus->FileName, 0, sizeof(FileStatus->FileName));
+    while ((Link != 0) && (CacheIndex == DS_INDEX_NONE))
+    {
+        if (CFE_SB_MsgId_Equal(DS_AppData.Cache[Link - 1].MessageID, MessageID))
+        {
+            CacheIndex = Link - 1;
+        }
+        else
+        {
+            Link = DS_AppData.Cache[Link - 1].Next;
+        }
+    }
+
+    return CacheIndex;
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* File age processor                                              */
+/* Update latest-value cache entry                                 */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void DS_FileTestAge(uint32 ElapsedSeconds)
+
+void DS_FileCacheStore(CFE_SB_MsgId_t MessageID, const CFE_SB_Buffer_t *BufPtr)
 {
-    uint32 FileIndex = 0;
+    DS_CacheEntry_t *Entry        = NULL;
+    int32            CacheIndex   = DS_FileCacheIndex(MessageID);
+    uint32           HashIndex    = 0;
+    size_t           PacketLength = 0;
 
-    /*
-    ** Called from HK request command handler (elapsed = platform config)
-    */
-    if (DS_AppData.DestFileTblPtr != (DS_DestFileTable_t *)NULL)
+    if ((CacheIndex == DS_INDEX_NONE) && (DS_AppData.CacheCount < DS_CACHE_RESERVED_ENTRIES))
     {
         /*
-        ** Cannot test file age without destination file table...
+        ** First packet of this Message ID - link the next free entry (only called
+        **   while the cache is enabled, so every reserved entry is usable)...
         */
-        for (FileIndex = 0; FileIndex < DS_DEST_FILE_CNT; FileIndex++)
+        CacheIndex = DS_AppData.CacheCount++;
+        HashIndex  = DS_TableHashFunction(MessageID);
+
+        Entry               = &DS_AppData.Cache[CacheIndex];
+        Entry->MessageID    = MessageID;
+        Entry->PacketLength = 0;
+        Entry->Next         = DS_AppData.CacheHash[HashIndex];
+
+        DS_AppData.CacheHash[HashIndex] = (uint16)(CacheIndex + 1);
+    }
+
+    if (CacheIndex == DS_INDEX_NONE)
+    {
+        /*
+        ** Every entry is used by another Message ID...
+        */
+        DS_AppData.CacheOverflowCounter++;
+    }
+    else
+    {
+        Entry = &DS_AppData.Cache[CacheIndex];
+
+        CFE_MSG_GetSize(&BufPtr->Msg, &PacketLength);
+
+        if (PacketLength > DS_CACHE_ENTRY_SIZE)
         {
             /*
-            ** Update age of open files...
+            ** Copy is a complete (shorter) packet marked as the first segment...
             */
-            if (OS_ObjectIdDefined(DS_AppData.FileStatus[FileIndex].FileHandle))
-            {
-                DS_AppData.FileStatus[FileIndex].FileAge += ElapsedSeconds;
+            memcpy(Entry->Packet, BufPtr, DS_CACHE_ENTRY_SIZE);
+            CFE_MSG_SetSize((CFE_MSG_Message_t *)Entry->Packet, DS_CACHE_ENTRY_SIZE);
+            CFE_MSG_SetSegmentationFlag((CFE_MSG_Message_t *)Entry->Packet, CFE_MSG_SegFlag_First);
 
-                if (DS_AppData.FileStatus[FileIndex].FileAge >= DS_AppData.DestFileTblPtr->File[FileIndex].MaxFileAge)
-                {
-                    /*
-                    ** Close files that exceed maximum file age...
-                    */
-                    DS_FileUpdateHeader(FileIndex);
-                    DS_FileCloseDest(FileIndex);
-                }
-            }
+            PacketLength = DS_CACHE_ENTRY_SIZE;
+        }
+        else
+        {
+            memcpy(Entry->Packet, BufPtr, PacketLength);
         }
+
+        Entry->PacketLength = PacketLength;
     }
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* Transmit file info                                              */
+/* Rebuild latest-value cache index after filter table changes     */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-void DS_FileTransmit(DS_AppFileStatus_t *FileStatus)
+void DS_FileCacheRebuild(void)
 {
-    CFE_SB_Buffer_t *PktBuf;
-    DS_FileInfo_t *  FileInfo;
+    DS_CacheEntry_t *Entry      = NULL;
+    uint32           HashIndex  = 0;
+    uint16           CacheCount = 0;
+    uint16           i          = 0;
+
+    memset(DS_AppData.CacheHash, 0, sizeof(DS_AppData.CacheHash));
 
     /*
-    ** Get a Message block of memory and initialize it
+    ** Entries of Message IDs still in the filter table move down over the freed entries...
     */
-    PktBuf = CFE_SB_AllocateMessageBuffer(sizeof(DS_FileCompletePkt_t));
+    for (i = 0; i < DS_AppData.CacheCount; i++)
+    {
+        if (DS_TableFindMsgID(DS_AppData.Cache[i].MessageID) != DS_INDEX_NONE)
+        {
+            Entry = &DS_AppData.Cache[CacheCount];
+
+            if (CacheCount != i)
+            {
+                memcpy(Entry, &DS_AppData.Cache[i], sizeof(*Entry));
+            }
+
+            HashIndex   = DS_TableHashFunction(Entry->MessageID);
+            Entry->Next = DS_AppData.CacheHash[HashIndex];
+
+            DS_AppData.CacheHash[HashIndex] = (uint16)(CacheCount + 1);
+
+            CacheCount++;
+        }
+    }
+
+    DS_AppData.CacheCount = CacheCount;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Find latest-value cache entry                                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+const DS_CacheEntry_t *DS_FileCacheFind(CFE_SB_MsgId_t MessageID)
+{
+    const DS_CacheEntry_t *Entry      = NULL;
+    int32                  CacheIndex = DS_FileCacheIndex(MessageID);
 
     /*
-    ** Process destination file info data...
+    ** Entry may be empty, or belong to a Message ID since removed from the filter table...
     */
-    if (PktBuf != NULL)
+    if ((CacheIndex != DS_INDEX_NONE) && (DS_AppData.Cache[CacheIndex].PacketLength != 0) &&
+        (DS_TableFindMsgID(MessageID) != DS_INDEX_NONE))
     {
-        CFE_MSG_Init(&PktBuf->Msg, CFE_SB_ValueToMsgId(DS_COMP_TLM_MID), sizeof(DS_FileCompletePkt_t));
+        Entry = &DS_AppData.Cache[CacheIndex];
+    }
 
-        FileInfo = &((DS_FileCompletePkt_t *)PktBuf)->Payload;
+    return Entry;
+}
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Write latest-value cache snapshot file                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 DS_FileCacheWrite(const char *FileName, uint32 *PacketCount)
+{
+    const DS_CacheEntry_t *Entry      = NULL;
+    osal_id_t              FileHandle = OS_OBJECT_ID_UNDEFINED;
+    CFE_FS_Header_t        CFE_FS_Header;
+    DS_FileHeader_t        DS_FileHeader;
+    CFE_TIME_SysTime_t     CurrentTime;
+    uint16                 CacheIndex;
+    int32                  Result;
+
+    *PacketCount = 0;
+
+    Result = OS_OpenCreate(&FileHandle, FileName, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_WRITE_ONLY);
+
+    if (Result != OS_SUCCESS)
+    {
+        FileHandle = OS_OBJECT_ID_UNDEFINED;
+    }
+    else if (DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE)
+    {
         /*
-        ** Set file age and size...
-        */
-        FileInfo->FileAge  = FileStatus->FileAge;
-        FileInfo->FileSize = FileStatus->FileSize;
-        /*
-        ** Set file growth rate (computed when process last HK request)...
-        */
-        FileInfo->FileRate = FileStatus->FileRate;
-        /*
-        ** Set current filename sequence count...
-        */
-        FileInfo->SequenceCount = FileStatus->FileCount;
-        /*
-        ** Set file enable/disable state...
-        */
-        FileInfo->EnableState = FileStatus->FileState;
-        /*
-        ** Set file closed state...
-        */
-        FileInfo->OpenState = DS_CLOSED;
-        /*
-        ** Set current open filename...
+        ** Same headers as a destination file, already closed...
         */
-        snprintf(FileInfo->FileName, sizeof(FileInfo->FileName), "%s", FileStatus->FileName);
+        CFE_FS_InitHeader(&CFE_FS_Header, DS_FILE_HDR_DESCRIPTION, DS_FILE_HDR_SUBTYPE);
+
+        Result = CFE_FS_WriteHeader(FileHandle, &CFE_FS_Header);
+
+        if (Result == sizeof(CFE_FS_Header_t))
+        {
+            CurrentTime = CFE_TIME_GetTime();
+
+            memset(&DS_FileHeader, 0, sizeof(DS_FileHeader));
+            DS_FileHeader.CloseSeconds = CurrentTime.Seconds;
+            DS_FileHeader.CloseSubsecs = CurrentTime.Subseconds;
+            snprintf(DS_FileHeader.FileName, sizeof(DS_FileHeader.FileName), "%s", FileName);
+
+            Result = OS_write(FileHandle, &DS_FileHeader, sizeof(DS_FileHeader_t));
+
+            if (Result == sizeof(DS_FileHeader_t))
+            {
+                Result = OS_SUCCESS;
+            }
+            else if (Result >= 0)
+            {
+                Result = OS_ERROR;
+            }
+        }
+        else if (Result >= 0)
+        {
+            Result = OS_ERROR;
+        }
+    }
+
+    for (CacheIndex = 0; (Result == OS_SUCCESS) && (CacheIndex < DS_AppData.CacheCount); CacheIndex++)
+    {
+        Entry = &DS_AppData.Cache[CacheIndex];
 
         /*
-        ** send file info telemetry...
-        ** NOTE: Timestamping is automatically handled by SB/Msg modules
-        ** when "IsOrigination" is set to true.
+        ** Skip empty entries and packets of Message IDs since removed from the filter table...
         */
-        CFE_SB_TransmitBuffer(PktBuf, true);
+        if ((Entry->PacketLength != 0) && (DS_TableFindMsgID(Entry->MessageID) != DS_INDEX_NONE))
+        {
+            Result = OS_write(FileHandle, Entry->Packet, Entry->PacketLength);
+
+            if (Result == Entry->PacketLength)
+            {
+                Result = OS_SUCCESS;
+                (*PacketCount)++;
+            }
+            else if (Result >= 0)
+            {
+                Result = OS_ERROR;
+            }
+        }
     }
+
+    if (OS_ObjectIdDefined(FileHandle))
+    {
+        OS_close(FileHandle);
+    }
+
+    return Result;
 }
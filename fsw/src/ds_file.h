@@ -48,6 +48,178 @@ typedef struct
     char FileName[DS_TOTAL_FNAME_BUFSIZE]; /**< \brief On-board filename */
 } DS_FileHeader_t;
 
+/**
+ * \brief DS Ring File Header (follows DS file header in ring mode files)
+ *
+ * Packets are stored between DataStart and the preallocated end of the
+ * file. When WrapOffset is non-zero the oldest packets are found from
+ * Tail up to WrapOffset, followed by the packets from DataStart up to
+ * Head. Otherwise the packets are found from DataStart up to Head.
+ */
+typedef struct
+{
+    uint32 DataStart;  /**< \brief File offset of the ring data area */
+    uint32 Head;       /**< \brief File offset where the next packet will be written */
+    uint32 Tail;       /**< \brief File offset of the oldest packet (when wrapped) */
+    uint32 WrapOffset; /**< \brief End of packet data before the last wrap (zero = none) */
+    uint32 WrapCount;  /**< \brief Number of times the writer has wrapped */
+} DS_FileRingHeader_t;
+
+/**
+ * \brief DS Sidecar Index File Header (start of index file)
+ *
+ * The index file is named after the destination file plus
+ * #DS_INDEX_FILE_EXTENSION and holds this header followed by
+ * #DS_FileIndexRecord_t entries, one for the first packet in the file
+ * and then one every IndexPackets packets or IndexSeconds seconds of
+ * packet time. The header is rewritten with the record count and the
+ * final destination file size when the destination file is closed, so
+ * a zero DataFileSize marks an index that was never finalized.
+ */
+typedef struct
+{
+    uint32 RecordCount;    /**< \brief Number of index records that follow */
+    uint32 DataFileSize;   /**< \brief Destination file size when finalized (zero = not finalized) */
+    uint16 FileTableIndex; /**< \brief Destination file table index */
+    uint16 IndexPackets;   /**< \brief Packets between index records (0 = not by count) */
+    uint16 IndexSeconds;   /**< \brief Seconds between index records (0 = not by time) */
+    uint16 Spare;          /**< \brief Structure alignment padding */
+} DS_FileIndexHeader_t;
+
+/**
+ * \brief DS Summary Trailer Footer identifier ("DSTR")
+ */
+#define DS_FILE_TRAILER_MAGIC 0x44535452
+
+/**
+ * \brief DS Summary Trailer Footer (last bytes of a destination file)
+ *
+ * When the destination has a summary trailer enabled, EntryCount
+ * #DS_FileTrailerEntry_t entries are appended to the file when it is
+ * closed, followed by this footer. A reader can check the footer at the
+ * end of the file and then read TrailerSize bytes from the end of the
+ * file to get the per message ID statistics without scanning the data.
+ */
+typedef struct
+{
+    uint32 EntryCount;   /**< \brief Number of trailer entries preceding this footer */
+    uint32 OtherPackets; /**< \brief Packets not summarized (trailer entries full) */
+    uint32 OtherBytes;   /**< \brief Bytes not summarized (trailer entries full) */
+    uint32 TrailerSize;  /**< \brief Size of trailer entries plus this footer */
+    uint32 Magic;        /**< \brief Always #DS_FILE_TRAILER_MAGIC */
+} DS_FileTrailerFooter_t;
+
+/**
+ * \brief DS Closed File Manifest Record Types
+ */
+#define DS_MANIFEST_RECORD_MOVED   0 /**< \brief File was moved to the Movename directory */
+#define DS_MANIFEST_RECORD_EVICTED 1 /**< \brief Listed file was deleted by the storage budget */
+
+/**
+ * \brief DS Closed File Manifest Record
+ *
+ * When #DS_MANIFEST_FILE_NAME is not empty, one record is appended to
+ * the manifest file in the Movename directory each time a destination
+ * file is moved there. Records are fixed size and never rewritten, so
+ * a consumer can remember how many records it has processed and read
+ * only the records after that position.
+ *
+ * For linear files the payload CRC covers the packet records in the
+ * order DS wrote them (after delta encoding and packet truncation, but
+ * before compression). It does not cover the cFE and DS file headers,
+ * the summary trailer or the sidecar index file, so it cannot be
+ * compared with a CRC of the whole file; a consumer checks it against
+ * the records it reads back from the file.
+ *
+ * When a listed file is deleted by the storage budget an eviction record
+ * is appended to the same manifest. It holds the filename, file size,
+ * destination and the eviction time (as the close time) only.
+ */
+typedef struct
+{
+    uint32 FileSize;        /**< \brief File size in bytes when closed */
+    uint32 OpenSeconds;     /**< \brief Time when file was created */
+    uint32 OpenSubsecs;
+    uint32 CloseSeconds;    /**< \brief Time when file was closed */
+    uint32 CloseSubsecs;
+    uint16 FileTableIndex;  /**< \brief Destination file table index */
+    uint16 StoragePriority; /**< \brief Destination storage priority */
+    uint16 PayloadCrcValid; /**< \brief PayloadCrc covers the packet records (zero for ring files) */
+    uint16 RecordType;      /**< \brief #DS_MANIFEST_RECORD_MOVED or #DS_MANIFEST_RECORD_EVICTED */
+    uint32 PayloadCrc;      /**< \brief CRC of the packet records only (#CFE_MISSION_ES_DEFAULT_CRC) */
+
+    char FileName[DS_TOTAL_FNAME_BUFSIZE]; /**< \brief Filename after the move */
+} DS_FileManifestRecord_t;
+
+/**
+ * \brief DS Compressed Block Header identifier ("DSBK")
+ *
+ * When the destination has LZ compression enabled, the cFE and DS file
+ * headers are followed by blocks, each a #DS_FileBlockHeader_t followed
+ * by StoredSize bytes. When StoredSize is less than RawSize the bytes
+ * are an LZ4 block format sequence stream that decodes to RawSize packet
+ * bytes, otherwise they are the packet bytes. Each block is compressed
+ * without reference to earlier blocks, so a reader can start at any block
+ * header and skip a damaged block by searching for the next identifier.
+ * Packets are not split across blocks unless larger than a block. The
+ * summary trailer (if any) follows the last block uncompressed.
+ */
+#define DS_FILE_BLOCK_MAGIC 0x4453424B
+
+/**
+ * \brief DS Delta Record identifier (first byte of a delta record)
+ *
+ * When the destination has delta records enabled, each packet is written
+ * either in full or as a delta record. A CCSDS packet always starts with
+ * a zero version number, so a first byte with the high bit set marks a
+ * delta record of #DS_FILE_RECORD_DELTA_SIZE bytes followed by the packet
+ * bytes after the telemetry header:
+ *   - byte 0:    #DS_FILE_RECORD_DELTA_TAG
+ *   - bytes 1-2: stream ID (the first two packet bytes)
+ *   - byte 3:    sequence count delta
+ *   - bytes 4-6: time delta in 1/65536 seconds (big endian)
+ *
+ * A reader remembers the last telemetry header and packet length of each
+ * stream ID, taken from every telemetry packet longer than the header.
+ * A delta record has the same length as the remembered packet, and its
+ * header is the remembered header with the deltas added by
+ * #DS_FileRecordApply.  Delta records are only written when that gives
+ * back the original header bytes.  The summary trailer (if any) follows
+ * the last record and the whole stream is compressed if LZ is enabled.
+ */
+#define DS_FILE_RECORD_DELTA_TAG 0x80
+
+/**
+ * \brief DS Truncated Record identifier (first byte of a truncated record)
+ *
+ * When a filter has a non-zero MaxStoreLength, only that many leading
+ * bytes of longer packets are stored.  Unless #DS_TRUNCATE_PATCH_LENGTH
+ * is set, the packet header is left intact (so it still gives the full
+ * packet length) and the stored bytes follow a record prefix of
+ * #DS_FILE_RECORD_TRUNC_SIZE bytes:
+ *   - byte 0:    #DS_FILE_RECORD_TRUNC_TAG
+ *   - byte 1:    zero (reserved)
+ *   - bytes 2-3: number of stored packet bytes (big endian)
+ *
+ * Truncated records are never delta encoded.
+ */
+#define DS_FILE_RECORD_TRUNC_TAG 0x81
+
+#define DS_FILE_RECORD_TAG_BIT        0x80     /**< \brief First byte bit set in every record that is not a packet */
+#define DS_FILE_RECORD_TRUNC_SIZE     4        /**< \brief Truncated record bytes before the packet data */
+#define DS_FILE_RECORD_DELTA_SIZE     7        /**< \brief Delta record bytes before the packet data */
+#define DS_FILE_RECORD_SEQ_MODULUS    0x4000   /**< \brief CCSDS sequence counts wrap at 14 bits */
+#define DS_FILE_RECORD_MAX_SEQ_DELTA  0xFF     /**< \brief Largest sequence count delta in a record */
+#define DS_FILE_RECORD_MAX_TIME_DELTA 0xFFFFFF /**< \brief Largest time delta in a record */
+
+#define DS_PACKET_HASH_SEED  2166136261U /**< \brief FNV-1a offset basis for change-only filters */
+#define DS_PACKET_HASH_PRIME 16777619U   /**< \brief FNV-1a prime for change-only filters */
+
+#define DS_RATE_TICKS_PER_SEC 0x10000 /**< \brief Rate limit token bucket resolution (1/65536 seconds) */
+
+#define DS_WINDOW_MICROSECS_PER_SEC 1000000 /**< \brief Time-window filter resolution (microseconds) */
+#define DS_WINDOW_MAX_EXPONENT      9       /**< \brief Largest time-window unit (10 to this power microseconds) */
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Prototypes for functions defined in ds_file.c                   */
@@ -91,17 +263,45 @@ void DS_FileStorePacket(CFE_SB_MsgId_t MessageID, const CFE_SB_Buffer_t *BufPtr)
  *       a new file needs to be opened and if so, creates the file.
  *       Files may be closed due to size or by command, and files may
  *       have not yet been created because this is the first packet
- *       destined for that file. Next step: write data to file.
+ *       destined for that file. Ring mode files are never closed
+ *       for size, instead the oldest data is overwritten. Next step:
+ *       write data to file.
  *
  *  \par Assumptions, External Events, and Notes:
- *       (none)
+ *       Packets longer than a non-zero MaxStoreLength are truncated
+ *       first and the size limits apply to the truncated record.
  *
- *  \param[in] FileIndex Destination file index
- *  \param[in] BufPtr    Software Bus message pointer
+ *  \param[in] FileIndex      Destination file index
+ *  \param[in] BufPtr         Software Bus message pointer
+ *  \param[in] MaxStoreLength Max packet bytes to store (0 = whole packet)
  *
- *  \sa #DS_AppFileStatus_t, #DS_DestFileEntry_t
+ *  \sa #DS_AppFileStatus_t, #DS_DestFileEntry_t, #DS_FileTruncatePacket
+ */
+void DS_FileSetupWrite(int32 FileIndex, const CFE_SB_Buffer_t *BufPtr, uint16 MaxStoreLength);
+
+/**
+ *  \brief Truncate packet for a partial store
+ *
+ *  \par Description
+ *       This function copies the leading bytes of a packet into the
+ *       truncated record buffer.  Unless #DS_TRUNCATE_PATCH_LENGTH is
+ *       set, the packet header is left intact and the bytes follow a
+ *       truncated record prefix.  Otherwise the CCSDS length field of
+ *       the copy is set to the stored length and its segmentation
+ *       flags to "first segment" to mark it as truncated.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The store length was validated with the filter table, so the
+ *       packet header is always stored and the buffer is big enough.
+ *
+ *  \param[in] MsgPtr      Software Bus message pointer
+ *  \param[in] StoreLength Number of packet bytes to store
+ *
+ *  \return Length of the truncated record in bytes
+ *
+ *  \sa #DS_FILE_RECORD_TRUNC_TAG
  */
-void DS_FileSetupWrite(int32 FileIndex, const CFE_SB_Buffer_t *BufPtr);
+uint32 DS_FileTruncatePacket(const CFE_MSG_Message_t *MsgPtr, uint32 StoreLength);
 
 /**
  *  \brief Write data (packet) to file
@@ -123,6 +323,55 @@ void DS_FileSetupWrite(int32 FileIndex, const CFE_SB_Buffer_t *BufPtr);
  */
 void DS_FileWriteData(int32 FileIndex, const void *FileData, uint32 DataLength);
 
+/**
+ *  \brief Make room for the next packet in a ring destination file
+ *
+ *  \par Description
+ *       This function is called before writing a packet to a ring mode
+ *       destination file. A packet larger than the ring data area is
+ *       rejected and counted as a write error. If the packet will not
+ *       fit before the end of the preallocated file, the writer wraps to
+ *       the start of the data area. After a wrap, the tail is advanced
+ *       past each of the oldest packets that the next write will
+ *       overwrite, using packet boundaries read ahead in groups by
+ *       #DS_FileRingWalk. Any seek error will result in the execution of
+ *       the common file write error handler.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The current file size is the ring head (next write offset).
+ *
+ *  \param[in] FileIndex  Destination file index
+ *  \param[in] DataLength Length of packet data about to be written
+ *
+ *  \return Packet fits in the ring
+ *  \retval true  The packet may be written at the ring head
+ *  \retval false The packet is larger than the ring data area
+ *
+ *  \sa #DS_FileRingHeader_t
+ */
+bool DS_FileRingPrepare(int32 FileIndex, uint32 DataLength);
+
+/**
+ *  \brief Read packet boundaries ahead of the ring file writer
+ *
+ *  \par Description
+ *       This function reads up to #DS_RING_BUFFER_SIZE bytes of a ring
+ *       destination file starting at the tail (the oldest packet) and
+ *       remembers the file offset following each complete packet header
+ *       found, so that the tail can be advanced past those packets
+ *       without further file access. No boundaries are remembered if
+ *       the read fails or the tail does not hold a packet header.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The file position is left after the data read, the caller must
+ *       return it to the ring head before writing.
+ *
+ *  \param[in] FileIndex Destination file index
+ *
+ *  \sa #DS_FileRingPrepare, #DS_FileRingWalk_t
+ */
+void DS_FileRingWalk(int32 FileIndex);
+
 /**
  *  \brief Write data storage file header
  *
@@ -183,6 +432,27 @@ void DS_FileWriteError(uint32 FileIndex, uint32 DataLength, int32 WriteResult);
  */
 void DS_FileCreateDest(uint32 FileIndex);
 
+/**
+ *  \brief Initialize a new ring destination file
+ *
+ *  \par Description
+ *       This function is called just after the file header has been
+ *       written to a new ring mode destination file. The function writes
+ *       the initial ring header and then fills the file with zeros up to
+ *       the max file size, so that the storage for the ring is allocated
+ *       when the file is created and the ring never needs to grow the
+ *       file. Any seek or write errors will result in the execution of
+ *       the common file write error handler.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] FileIndex Destination file index
+ *
+ *  \sa #DS_FileRingHeader_t, #DS_FileRingUpdateHeader
+ */
+void DS_FileRingInit(int32 FileIndex);
+
 /**
  *  \brief Construct the next filename for a destination file
  *
@@ -226,6 +496,52 @@ void DS_FileCreateName(uint32 FileIndex);
  */
 void DS_FileCreateSequence(char *Buffer, uint32 Type, uint32 Count);
 
+/**
+ *  \brief Construct the subdirectory shard of a filename
+ *
+ *  \par Description
+ *       The shard string is the subdirectory (relative to the path and
+ *       move directories) for the next destination file.  Time shards
+ *       have the format "YYYY/DDD/HH" from the filename time, or from
+ *       the current time when the filename is not named by time.  Count
+ *       shards are the first sequence count of the block of ShardFiles
+ *       counts holding the file sequence count, in the same format as
+ *       the filename sequence count.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The shard string is empty when the destination is not sharded.
+ *
+ *  \param[in]  FileIndex    Destination file table index
+ *  \param[in]  TimeSequence Time sequence portion of the filename (NULL = read the time)
+ *  \param[out] Buffer       Pointer to buffer for shard portion of filename
+ *
+ *  \sa #DS_FileCreateSequence, #DS_DestFileEntry_t
+ */
+void DS_FileShardName(uint32 FileIndex, const char *TimeSequence, char *Buffer);
+
+/**
+ *  \brief Create subdirectory shard directories
+ *
+ *  \par Description
+ *       Create each directory level of the shard below the base
+ *       directory, unless the shard directory is the one known to
+ *       exist from the previous call.  The known directory is updated
+ *       on success, so files in the same shard cost no system calls.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Levels that already exist are not an error, an #OS_mkdir error
+ *       is ignored when #OS_stat shows the level is a directory.  The
+ *       known directory is cleared on error so the next call tries again.
+ *
+ *  \param[in]     DirName    Shard directory (base directory plus shard)
+ *  \param[in]     BaseLength Length of the base directory portion of DirName
+ *  \param[in,out] KnownDir   Last shard directory known to exist
+ *
+ *  \return Execution status, see \ref OSReturnCodes
+ *  \retval #OS_SUCCESS \copybrief OS_SUCCESS
+ */
+int32 DS_FileShardCreate(const char *DirName, size_t BaseLength, char *KnownDir);
+
 /**
  *  \brief Update destination file header (prior to closing)
  *
@@ -247,81 +563,1028 @@ void DS_FileCreateSequence(char *Buffer, uint32 Type, uint32 Count);
 void DS_FileUpdateHeader(int32 FileIndex);
 
 /**
- *  \brief Close selected destination file
+ *  \brief Update ring destination file header
  *
  *  \par Description
- *       This function may be called from the DS Close File command
- *       handler, from the file age processor, from the file size
- *       processor and from the file write error handler.
- *       The function closes the selected destination file and updates
- *       the file status data to indicate that the file handle is not
- *       in use and that the file age, size and name fields are reset.
+ *       This function writes the current head, tail and wrap values
+ *       to the ring header of a ring mode destination file and then
+ *       returns the file position to the ring head. It is called when
+ *       the file header is updated, both before closing the file and
+ *       at each file age checkpoint. Seek and write errors are counted
+ *       but otherwise ignored.
  *
  *  \par Assumptions, External Events, and Notes:
  *       (none)
  *
  *  \param[in] FileIndex Destination file index
+ *
+ *  \sa #DS_FileRingHeader_t, #DS_FileUpdateHeader
  */
-void DS_FileCloseDest(int32 FileIndex);
+void DS_FileRingUpdateHeader(int32 FileIndex);
 
 /**
- *  \brief File age processor
+ *  \brief Create sidecar index file
  *
  *  \par Description
- *       This function is called upon receipt of the DS 1Hz command
- *       (if defined) or upon receipt of the DS housekeeping request
- *       command (if the 1Hz cmd is not defined).
- *       The function increments the elapsed file age for all open
- *       data storage files by the amount specified.
- *       Files that exceed the age limit set in the destination file
- *       definition table will be closed.
- *       If this destination remains enabled, another file will be
- *       opened when the next packet is written to this destination.
+ *       This function is called after a new linear destination file is
+ *       created when the destination has IndexPackets or IndexSeconds
+ *       set.  It opens the index file and writes a placeholder
+ *       #DS_FileIndexHeader_t.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Index errors are reported with an event and only stop the
+ *       index, the destination file is not affected.
+ *
+ *  \param[in] FileIndex Destination file index
+ *
+ *  \sa #DS_FileIndexPacket, #DS_FileIndexClose
+ */
+void DS_FileIndexCreate(int32 FileIndex);
+
+/**
+ *  \brief Add sparse index record for a packet
+ *
+ *  \par Description
+ *       This function is called for each packet written to a destination
+ *       file with an open index.  A record holding the packet file offset,
+ *       time and message ID is buffered for the first packet in the file
+ *       and then every IndexPackets packets or IndexSeconds seconds of
+ *       packet time.  Full buffers are written with a single write.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Packet time is only read when a record may be due.
+ *
+ *  \param[in] FileIndex  Destination file index
+ *  \param[in] MsgPtr     Pointer to the packet just written
+ *  \param[in] FileOffset Destination file offset where the packet starts
+ *
+ *  \sa #DS_FileIndexFlush
+ */
+void DS_FileIndexPacket(int32 FileIndex, const CFE_MSG_Message_t *MsgPtr, uint32 FileOffset);
+
+/**
+ *  \brief Write buffered index records
+ *
+ *  \par Description
+ *       This function writes any buffered index records to the sidecar
+ *       index file.
  *
  *  \par Assumptions, External Events, and Notes:
  *       (none)
  *
- *  \param[in] ElapsedSeconds Elapsed seconds since previous call
+ *  \param[in] FileIndex Destination file index
+ *
+ *  \sa #DS_FileIndexPacket, #DS_FileIndexClose
  */
-void DS_FileTestAge(uint32 ElapsedSeconds);
+void DS_FileIndexFlush(int32 FileIndex);
 
 /**
- *  \brief Transmit file information telemetry handler
+ *  \brief Finalize and close sidecar index file
  *
  *  \par Description
- *       Create and send a telemetry packet containing the current
- *       status for a closed destination file.
+ *       This function is called when the destination file is closed.
+ *       It writes any buffered records, rewrites the index header with
+ *       the record count and final destination file size, and closes
+ *       the index file.
  *
  *  \par Assumptions, External Events, and Notes:
  *       (none)
  *
- *  \param[in] FileStatus Current state of destination file
+ *  \param[in] FileIndex Destination file index
  *
- *  \sa #DS_FileCompletePkt_t
+ *  \sa #DS_FileIndexCreate, #DS_FileIndexMove
  */
-void DS_FileTransmit(DS_AppFileStatus_t *FileStatus);
+void DS_FileIndexClose(int32 FileIndex);
 
 /**
- * \brief Determine whether Software Bus message packet is filtered
+ *  \brief Move sidecar index file with its destination file
  *
  *  \par Description
- *       This routine will apply the DS filter algorithm to the packet
- *       to determine whether the packet should be filtered.
+ *       This function is called after a closed destination file has
+ *       been moved.  The index file is moved so that its name is the
+ *       new destination filename plus #DS_INDEX_FILE_EXTENSION.
  *
  *  \par Assumptions, External Events, and Notes:
- *       None
+ *       (none)
  *
- *  \param[in] MessagePtr  Pointer to a Software Bus message packet
- *  \param[in] FilterType  Packet sequence count (1) or timestamp (2)
- *  \param[in] Algorithm_N Algorithm parameter N "pass this many"
- *  \param[in] Algorithm_X Algorithm parameter X "out of this many"
- *  \param[in] Algorithm_O Algorithm parameter O "at this offset"
+ *  \param[in] FileIndex Destination file index
+ *  \param[in] DataName  New destination filename
  *
- *  \return Boolean packet filtered response
- *  \retval true  The packet should be filtered (not used)
- *  \retval false The packet should not be filtered (used)
+ *  \sa #DS_FileIndexClose
  */
-bool DS_IsPacketFiltered(CFE_MSG_Message_t *MessagePtr, uint16 FilterType, uint16 Algorithm_N, uint16 Algorithm_X,
-                         uint16 Algorithm_O);
+void DS_FileIndexMove(int32 FileIndex, const char *DataName);
+
+/**
+ *  \brief Sidecar index file error handler
+ *
+ *  \par Description
+ *       This function sends an error event and closes the index file.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] FileIndex Destination file index
+ *  \param[in] Result    Failing OSAL result
+ */
+void DS_FileIndexError(int32 FileIndex, int32 Result);
+
+/**
+ *  \brief Accumulate summary trailer statistics for a packet
+ *
+ *  \par Description
+ *       This function updates the packet count, byte count, first and
+ *       last packet times and sequence gap count for the message ID of
+ *       a packet that was just written to the destination file.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Packets with message IDs beyond #DS_FILE_TRAILER_ENTRIES are
+ *       only counted in the trailer footer.
+ *
+ *  \param[in] FileIndex  Destination file index
+ *  \param[in] MsgPtr     Pointer to packet just written
+ *  \param[in] DataLength Packet length in bytes
+ *
+ *  \sa #DS_FileTrailerWrite
+ */
+void DS_FileTrailerPacket(int32 FileIndex, const CFE_MSG_Message_t *MsgPtr, uint32 DataLength);
+
+/**
+ *  \brief Append summary trailer to destination file
+ *
+ *  \par Description
+ *       This function appends the accumulated trailer entries and the
+ *       trailer footer to the end of the destination file. It is called
+ *       just before the destination file is closed.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Trailer writes are counted as file updates, the same as updates
+ *       to the file header.
+ *
+ *  \param[in] FileIndex Destination file index
+ *
+ *  \sa #DS_FileTrailerFooter_t
+ */
+void DS_FileTrailerWrite(int32 FileIndex);
+
+/**
+ *  \brief Buffer packet data for a compressed destination file
+ *
+ *  \par Description
+ *       This function copies packet data into the destination block
+ *       buffer.  The buffered block is compressed and written when the
+ *       packet will not fit in it, and again each time it fills while
+ *       copying a packet larger than one block.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called in place of OS_write for compressed destination files.
+ *
+ *  \param[in] FileIndex  Destination file index
+ *  \param[in] FileData   Pointer to packet data
+ *  \param[in] DataLength Packet length in bytes
+ *
+ *  \return DataLength on success, otherwise the failing write result
+ *
+ *  \sa #DS_FileCompressFlush
+ */
+int32 DS_FileCompressData(int32 FileIndex, const void *FileData, uint32 DataLength);
+
+/**
+ *  \brief Compress and write buffered block
+ *
+ *  \par Description
+ *       This function compresses the buffered block and writes it with
+ *       its block header in a single write.  Blocks that do not get
+ *       smaller are written uncompressed.  The file size and the
+ *       compression byte counts are updated after a good write.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The block buffer must not be empty.  It is emptied whether or
+ *       not the write succeeds.
+ *
+ *  \param[in] FileIndex Destination file index
+ *
+ *  \return Execution status
+ *  \retval #CFE_SUCCESS Block written
+ *  \retval #OS_ERROR    Partial write (other failing write results are returned unchanged)
+ *
+ *  \sa #DS_FileBlockHeader_t, #DS_CompressBlock
+ */
+int32 DS_FileCompressFlush(int32 FileIndex);
+
+/**
+ *  \brief Write last compressed block before closing file
+ *
+ *  \par Description
+ *       This function seeks to the end of the destination file and writes
+ *       the partially filled block buffer.  It is called just before the
+ *       summary trailer is written and the destination file is closed.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A failure is counted and reported but does not disable the
+ *       destination, the file is being closed anyway.
+ *
+ *  \param[in] FileIndex Destination file index
+ */
+void DS_FileCompressClose(int32 FileIndex);
+
+/**
+ *  \brief Get destination file size tested against max file size
+ *
+ *  \par Description
+ *       This function returns what the destination file size will be
+ *       after the packet is written.  For compressed files the size
+ *       limit mode selects the size before compression, or the file
+ *       size if the buffered and new packet data do not compress.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The physical size is a worst case so that a compressed file
+ *       never exceeds the max file size (apart from the trailer).
+ *
+ *  \param[in] FileIndex  Destination file index
+ *  \param[in] DataLength Packet length in bytes
+ *
+ *  \return Projected file size in bytes
+ */
+uint32 DS_FileLimitSize(int32 FileIndex, uint32 DataLength);
+
+/**
+ *  \brief Get destination file size before compression
+ *
+ *  \par Description
+ *       This function returns the logical size of compressed files
+ *       and the file size of all other files.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] FileStatus Pointer to destination file status
+ *
+ *  \return File size in bytes before compression
+ */
+uint32 DS_FileLogicalSize(const DS_AppFileStatus_t *FileStatus);
+
+/**
+ *  \brief Encode packet as a delta record
+ *
+ *  \par Description
+ *       This function builds a delta record for the packet in the delta
+ *       record buffer when the packet header can be rebuilt from the
+ *       last packet of the same stream.  The packet then becomes the
+ *       reference for the next packet of its stream.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Every keyframe interval records of a stream are written in full
+ *       so that a damaged file can be decoded again from a later point.
+ *
+ *  \param[in]  FileIndex    Destination file index
+ *  \param[in]  MsgPtr       Pointer to packet
+ *  \param[in]  DataLength   Packet length in bytes
+ *  \param[out] RecordLength Delta record length in bytes (if encoded)
+ *
+ *  \return true if a delta record was built, false to write the packet in full
+ *
+ *  \sa #DS_FILE_RECORD_DELTA_TAG
+ */
+bool DS_FileRecordEncode(int32 FileIndex, const CFE_MSG_Message_t *MsgPtr, uint32 DataLength, uint32 *RecordLength);
+
+/**
+ *  \brief Find delta record reference for a packet stream
+ *
+ *  \par Description
+ *       This function returns the remembered reference for the stream
+ *       or, when the stream is not remembered, replaces the reference
+ *       of the stream that was remembered first.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A replaced reference has a packet size of zero, so the next
+ *       packet of the stream is written in full.
+ *
+ *  \param[in] FileIndex Destination file index
+ *  \param[in] StreamId  First two packet bytes
+ *
+ *  \return Pointer to delta record reference
+ */
+DS_FileRecordRef_t *DS_FileRecordFind(int32 FileIndex, uint16 StreamId);
+
+/**
+ *  \brief Rebuild packet header from a delta record
+ *
+ *  \par Description
+ *       This function adds the delta record sequence count and time
+ *       deltas to the remembered header of the stream.  It is the step
+ *       a reader uses to decode a delta record, and is used when writing
+ *       to check that a delta record decodes to the original header.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Packet time is kept to 1/65536 seconds.
+ *
+ *  \param[in]  RefHeader Remembered header of the stream
+ *  \param[in]  SeqDelta  Sequence count delta
+ *  \param[in]  TimeDelta Time delta in 1/65536 seconds
+ *  \param[out] Header    Rebuilt packet header
+ */
+void DS_FileRecordApply(const CFE_MSG_TelemetryHeader_t *RefHeader, uint32 SeqDelta, uint32 TimeDelta,
+                        CFE_MSG_TelemetryHeader_t *Header);
+
+/**
+ *  \brief Close selected destination file
+ *
+ *  \par Description
+ *       This function may be called from the DS Close File command
+ *       handler, from the file age processor, from the file size
+ *       processor and from the file write error handler.
+ *       The function closes the selected destination file and updates
+ *       the file status data to indicate that the file handle is not
+ *       in use and that the file age, size and name fields are reset.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] FileIndex Destination file index
+ */
+void DS_FileCloseDest(int32 FileIndex);
+
+/**
+ *  \brief Remember closed destination file for storage budget
+ *
+ *  \par Description
+ *       This function is called when a destination file is closed.
+ *       It records the final filename (after any move) and file size
+ *       in the per destination closed file history so that the file
+ *       counts against the storage budgets and may later be evicted.
+ *       Ring files are recorded at their preallocated size.  A sidecar
+ *       index file is counted with its data file.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       When the history is full the oldest entry is forgotten.
+ *       Files that existed before DS started, or that could not be
+ *       moved, are never remembered.
+ *
+ *  \param[in] FileIndex Destination file index
+ *
+ *  \sa #DS_FileStorageForget, #DS_FileStorageCheck
+ */
+void DS_FileStorageRemember(int32 FileIndex);
+
+/**
+ *  \brief Forget oldest remembered closed file
+ *
+ *  \par Description
+ *       This function removes the oldest entry from the destination
+ *       closed file history and subtracts its size from the storage
+ *       totals.  The file itself is not deleted.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] FileIndex Destination file index
+ *
+ *  \sa #DS_FileStorageRemember, #DS_FileStorageEvict
+ */
+void DS_FileStorageForget(int32 FileIndex);
+
+/**
+ *  \brief Delete oldest remembered closed file
+ *
+ *  \par Description
+ *       This function deletes the oldest closed file remembered for
+ *       the destination (and its sidecar index file, if any), reports
+ *       the eviction with an event and then forgets the file.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A file that cannot be deleted is forgotten anyway so that a
+ *       file removed by another application cannot stall eviction.
+ *
+ *  \param[in] FileIndex Destination file index
+ *
+ *  \sa #DS_FileStorageForget, #DS_FileStorageCheck
+ */
+void DS_FileStorageEvict(int32 FileIndex);
+
+/**
+ *  \brief Select destination to evict from for the global budget
+ *
+ *  \par Description
+ *       This function returns the destination with remembered closed
+ *       files that has the lowest storage priority not above the
+ *       indicated priority.  Ties go to the destination holding the
+ *       oldest closed file.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The cost depends on the number of destinations only.
+ *
+ *  \param[in] StoragePriority Storage priority of the destination needing space
+ *
+ *  \return Destination file index or #DS_INDEX_NONE
+ *
+ *  \sa #DS_FileStorageCheck
+ */
+int32 DS_FileStorageVictim(uint16 StoragePriority);
+
+/**
+ *  \brief Make room for a new destination file within storage budgets
+ *
+ *  \par Description
+ *       This function is called before a new destination file is
+ *       created.  The new file and every other open file reserve
+ *       their max file size.  The oldest closed files of the
+ *       destination are evicted until the destination budget is met,
+ *       and the oldest closed files of equal or lower priority
+ *       destinations are evicted until the global budget is met.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       If the global budget cannot be met an event is sent and the
+ *       file is created anyway.
+ *
+ *  \param[in] FileIndex Destination file index
+ *
+ *  \sa #DS_FileStorageEvict, #DS_FileStorageVictim, #DS_STORAGE_BUDGET
+ */
+void DS_FileStorageCheck(int32 FileIndex);
+
+/**
+ *  \brief File age processor
+ *
+ *  \par Description
+ *       This function is called upon receipt of the DS 1Hz command
+ *       (if defined) or upon receipt of the DS housekeeping request
+ *       command (if the 1Hz cmd is not defined).
+ *       The function increments the elapsed file age for all open
+ *       data storage files by the amount specified.
+ *       Files that exceed the age limit set in the destination file
+ *       definition table will be closed. Ring mode files are never
+ *       closed for age, instead the file header is updated and the
+ *       file age is restarted.
+ *       If this destination remains enabled, another file will be
+ *       opened when the next packet is written to this destination.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] ElapsedSeconds Elapsed seconds since previous call
+ */
+void DS_FileTestAge(uint32 ElapsedSeconds);
+
+/**
+ *  \brief Transmit file information telemetry handler
+ *
+ *  \par Description
+ *       Create and send a telemetry packet containing the current
+ *       status for a closed destination file.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] FileStatus Current state of destination file
+ *
+ *  \sa #DS_FileCompletePkt_t
+ */
+void DS_FileTransmit(DS_AppFileStatus_t *FileStatus);
+
+/**
+ *  \brief Transmit destination statistics telemetry handler
+ *
+ *  \par Description
+ *       Create and send a telemetry packet containing the input/output
+ *       statistics for all destination files.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \sa #DS_DestStatsPkt_t
+ */
+void DS_FileTransmitDestStats(void);
+
+/**
+ *  \brief Get closed file manifest name
+ *
+ *  \par Description
+ *       Build the name of the manifest file kept in the Movename
+ *       directory of the destination.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       There is no manifest when #DS_MANIFEST_FILE_NAME is empty, when
+ *       moving files is disabled or when the destination has no Movename.
+ *
+ *  \param[in]  FileIndex    Destination file table index
+ *  \param[out] ManifestName Manifest file name
+ *  \param[in]  BufSize      Size of ManifestName buffer
+ *
+ *  \return Boolean manifest result
+ *  \retval true  The destination has a manifest, ManifestName is set
+ *  \retval false The destination has no manifest (or the name is too long)
+ */
+bool DS_FileManifestName(int32 FileIndex, char *ManifestName, size_t BufSize);
+
+/**
+ *  \brief Append closed file manifest record
+ *
+ *  \par Description
+ *       Append a #DS_FileManifestRecord_t for a destination file that
+ *       has just been moved to the Movename directory.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Sets ManifestListed in the destination file status when the
+ *       record is written, so the file can be reported when evicted.
+ *
+ *  \param[in] FileIndex Destination file table index
+ *  \param[in] FileName  Filename after the move
+ *
+ *  \sa #DS_FileManifestWrite
+ */
+void DS_FileManifestAppend(int32 FileIndex, const char *FileName);
+
+/**
+ *  \brief Append closed file manifest eviction record
+ *
+ *  \par Description
+ *       Append a #DS_MANIFEST_RECORD_EVICTED record for a closed file
+ *       that has just been deleted by the storage budget.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The record goes to the manifest that listed the file, even if
+ *       the destination Movename has changed since.
+ *
+ *  \param[in] FileIndex  Destination file table index
+ *  \param[in] ClosedFile Deleted file (with a non-empty ManifestName)
+ *
+ *  \sa #DS_FileManifestWrite
+ */
+void DS_FileManifestEvict(int32 FileIndex, const DS_ClosedFile_t *ClosedFile);
+
+/**
+ *  \brief Write closed file manifest record
+ *
+ *  \par Description
+ *       Write a record at the end of a manifest and update the manifest
+ *       counters.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Manifests stay open between appends, with one handle per file
+ *       shared by all destinations using it. A destination opening a
+ *       new manifest first closes the one it opened before. A partial
+ *       record left at the end of the manifest (by a reset during a
+ *       previous append) is overwritten when the manifest is opened.
+ *       The manifest is closed after a write error, so the next append
+ *       opens it again.
+ *
+ *  \param[in] FileIndex    Destination file table index
+ *  \param[in] ManifestName Manifest file name
+ *  \param[in] Record       Record to append
+ *
+ *  \return Boolean write result
+ *  \retval true  The record was written
+ *  \retval false The manifest could not be opened or written
+ */
+bool DS_FileManifestWrite(int32 FileIndex, const char *ManifestName, const DS_FileManifestRecord_t *Record);
+
+/**
+ *  \brief Transmit closed file manifest telemetry
+ *
+ *  \par Description
+ *       Create and send a telemetry packet containing the number of
+ *       complete records in the manifest of a destination.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The record count is zero when the manifest does not exist yet.
+ *
+ *  \param[in] FileIndex    Destination file table index
+ *  \param[in] ManifestName Manifest file name
+ *
+ *  \sa #DS_ManifestPkt_t
+ */
+void DS_FileTransmitManifest(int32 FileIndex, const char *ManifestName);
+
+/**
+ *  \brief Flight recorder record size
+ *
+ *  \par Description
+ *       Buffer bytes used by a held packet: the record header plus the
+ *       packet, rounded up to keep records 32-bit aligned.
+ */
+#define DS_RECORDER_RECORD_SIZE(PacketLength) \
+    ((((uint32)sizeof(DS_RecorderRecord_t)) + ((uint32)(PacketLength)) + 3) & ~((uint32)3))
+
+/**
+ *  \brief Find room for a flight recorder record
+ *
+ *  \par Description
+ *       Find where a record of the given size can be stored without
+ *       overwriting held records.  The record goes at Head, or at the
+ *       buffer start when it does not fit in the rest of the buffer.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Head is never allowed to reach Tail, since that is an empty ring.
+ *
+ *  \param[in]  Recorder   Flight recorder state
+ *  \param[in]  RecordSize Record size in bytes (see #DS_RECORDER_RECORD_SIZE)
+ *  \param[out] Offset     Buffer offset for the record
+ *
+ *  \return Boolean room result
+ *  \retval true  The record fits at Offset
+ *  \retval false There is no room without discarding held records
+ */
+bool DS_FileRecorderRoom(const DS_RecorderStatus_t *Recorder, uint32 RecordSize, uint32 *Offset);
+
+/**
+ *  \brief Discard the oldest flight recorder record
+ *
+ *  \par Description
+ *       Move Tail past the oldest held record, or to the buffer start
+ *       if Tail is at the unused end of the buffer.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Does nothing when no records are held.
+ *
+ *  \param[in] Recorder Flight recorder state
+ */
+void DS_FileRecorderDiscard(DS_RecorderStatus_t *Recorder);
+
+/**
+ *  \brief Hold packet in flight recorder buffer
+ *
+ *  \par Description
+ *       Copy a packet that passed a filter for a flight recorder
+ *       destination into the recorder buffer.  While the recorder is
+ *       holding, the oldest records are discarded to make room.  While
+ *       it is dumping, a packet that does not fit is lost and counted
+ *       in the recorder drop counter.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Packets larger than half the buffer are never held.
+ *
+ *  \param[in] RecorderIndex  Flight recorder index
+ *  \param[in] BufPtr         Software Bus message pointer
+ *  \param[in] MaxStoreLength Filter store length limit (applied when the packet is written)
+ *
+ *  \sa #DS_FileRecorderDrain
+ */
+void DS_FileRecorderStore(uint16 RecorderIndex, const CFE_SB_Buffer_t *BufPtr, uint16 MaxStoreLength);
+
+/**
+ *  \brief Check packet for flight recorder trigger Message ID
+ *
+ *  \par Description
+ *       Start a dump of each holding flight recorder whose trigger
+ *       Message ID matches the packet.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called for every packet DS is asked to store.
+ *
+ *  \param[in] MessageID Packet Message ID
+ */
+void DS_FileRecorderCheck(CFE_SB_MsgId_t MessageID);
+
+/**
+ *  \brief Start a flight recorder dump
+ *
+ *  \par Description
+ *       Mark the recorder as dumping and note the trigger time.  The
+ *       held packets and the packets stored until the post-trigger
+ *       window ends are written by #DS_FileRecorderDrain.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The caller has verified that the recorder is holding.
+ *
+ *  \param[in] RecorderIndex Flight recorder index
+ *  \param[in] Source        Trigger description for the event message
+ */
+void DS_FileRecorderTrigger(uint16 RecorderIndex, const char *Source);
+
+/**
+ *  \brief Write held packets of dumping flight recorders
+ *
+ *  \par Description
+ *       Write up to MaxPackets held packets of each dumping flight
+ *       recorder to its destination file, through the same path as
+ *       packets that are not held.  When the post-trigger window has
+ *       ended and every packet up to it has been written, the file is
+ *       closed and the recorder resumes holding.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called from the main loop after each message and when the
+ *       pipe is empty, so the dump never blocks packet storage.
+ *
+ *  \param[in] MaxPackets Most packets to write per recorder
+ *
+ *  \sa #DS_RECORDER_DRAIN_PACKETS
+ */
+void DS_FileRecorderDrain(uint32 MaxPackets);
+
+/**
+ *  \brief Find latest-value cache entry index of a Message ID
+ *
+ *  \par Description
+ *       Search the latest-value cache entries linked from the hash
+ *       table index of the Message ID.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The entry may be empty, and its Message ID may no longer be
+ *       listed in the packet filter table.
+ *
+ *  \param[in] MessageID Message ID of the cached packet
+ *
+ *  \return Cache entry index, or #DS_INDEX_NONE if the Message ID has no entry
+ */
+int32 DS_FileCacheIndex(CFE_SB_MsgId_t MessageID);
+
+/**
+ *  \brief Update latest-value cache entry
+ *
+ *  \par Description
+ *       Copy the packet into the latest-value cache entry of its
+ *       Message ID, first giving the Message ID a free entry if it has
+ *       none.  Packets longer than #DS_CACHE_ENTRY_SIZE are cut to that
+ *       size, with the packet length and segmentation flag in the copy
+ *       adjusted to match.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called for every packet listed in the packet filter table while
+ *       the cache is enabled (#DS_CACHE_ENTRIES is not 0), so the update
+ *       is a short hash chain search and a single bounded copy.  When
+ *       every entry is used by other Message IDs the packet is not
+ *       cached and the overflow counter is incremented.
+ *
+ *  \param[in] MessageID Packet Message ID
+ *  \param[in] BufPtr    Software Bus message pointer
+ */
+void DS_FileCacheStore(CFE_SB_MsgId_t MessageID, const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ *  \brief Rebuild latest-value cache index
+ *
+ *  \par Description
+ *       Drop the cache entries of Message IDs no longer listed in the
+ *       packet filter table, move the remaining entries (and their
+ *       cached packets) down to the start of the cache and relink them,
+ *       so freed entries can be given to new Message IDs.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called whenever the packet filter hash table is rebuilt (filter
+ *       table load or remove Message ID command).  Adding a Message ID
+ *       does not free any entry.
+ */
+void DS_FileCacheRebuild(void);
+
+/**
+ *  \brief Find latest-value cache entry
+ *
+ *  \par Description
+ *       Find the cached last packet of a Message ID.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Packets of Message IDs no longer listed in the packet filter
+ *       table are not found.
+ *
+ *  \param[in] MessageID Message ID of the cached packet
+ *
+ *  \return Cache entry, or NULL if no packet is cached for the Message ID
+ */
+const DS_CacheEntry_t *DS_FileCacheFind(CFE_SB_MsgId_t MessageID);
+
+/**
+ *  \brief Write latest-value cache snapshot file
+ *
+ *  \par Description
+ *       Create the file, write the same headers as a destination file,
+ *       then write every cached packet in the order its Message ID was
+ *       first cached.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Cache entries of Message IDs no longer in the packet filter
+ *       table are skipped.
+ *
+ *  \param[in]  FileName    Snapshot file to create
+ *  \param[out] PacketCount Number of packets written
+ *
+ *  \return Execution status, see \ref OSReturnCodes
+ *  \retval #OS_SUCCESS \copybrief OS_SUCCESS
+ */
+int32 DS_FileCacheWrite(const char *FileName, uint32 *PacketCount);
+
+/**
+ * \brief Determine whether Software Bus message packet is filtered
+ *
+ *  \par Description
+ *       This routine will apply the DS filter algorithm to the packet
+ *       to determine whether the packet should be filtered.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param[in] MessagePtr  Pointer to a Software Bus message packet
+ *  \param[in] FilterType  Packet sequence count (1) or timestamp (2)
+ *  \param[in] Algorithm_N Algorithm parameter N "pass this many"
+ *  \param[in] Algorithm_X Algorithm parameter X "out of this many"
+ *  \param[in] Algorithm_O Algorithm parameter O "at this offset"
+ *
+ *  \return Boolean packet filtered response
+ *  \retval true  The packet should be filtered (not used)
+ *  \retval false The packet should not be filtered (used)
+ */
+bool DS_IsPacketFiltered(CFE_MSG_Message_t *MessagePtr, uint16 FilterType, uint16 Algorithm_N, uint16 Algorithm_X,
+                         uint16 Algorithm_O);
+
+/**
+ * \brief Scale filter algorithm X for backpressure decimation
+ *
+ *  \par Description
+ *       This routine returns the "out of this many" value to use for a
+ *       filter at the current decimation level.  For low priority
+ *       filters X is multiplied by 2 to the power of the level, which
+ *       divides the rate of packets passed by the same amount.  High
+ *       priority filters are returned unchanged.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The result is limited to 65535.  Since X only grows, N and O
+ *       remain valid for the scaled value.  X = 0 is left unchanged.
+ *
+ *  \param[in] Algorithm_X     Algorithm parameter X from the filter table
+ *  \param[in] Priority        Filter priority (#DS_PRIORITY_HIGH or #DS_PRIORITY_LOW)
+ *  \param[in] DecimationLevel Current backpressure decimation level
+ *
+ *  \return Algorithm parameter X to apply to the packet
+ */
+uint16 DS_DecimateAlgorithmX(uint16 Algorithm_X, uint16 Priority, uint8 DecimationLevel);
+
+/**
+ * \brief Determine whether Software Bus message packet is unchanged
+ *
+ *  \par Description
+ *       This routine will apply the DS change-only filter to the packet.
+ *       A packet is filtered when the data after its header matches the
+ *       last packet stored by the filter, unless that would filter
+ *       Algorithm_X packets in a row.  Packets that are not filtered
+ *       become the last stored packet.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Packets are compared by length and a 32-bit hash of the data
+ *       after the header.  A change to a single 32-bit word always
+ *       changes the hash.  Algorithm_N and Algorithm_O are not used.
+ *
+ *  \param[in] MessagePtr   Pointer to a Software Bus message packet
+ *  \param[in] ChangeStatus Current state of the change-only filter
+ *  \param[in] Algorithm_X  Algorithm parameter X "store one of this many"
+ *
+ *  \return Boolean packet filtered response
+ *  \retval true  The packet should be filtered (not used)
+ *  \retval false The packet should not be filtered (used)
+ */
+bool DS_IsPacketUnchanged(const CFE_MSG_Message_t *MessagePtr, DS_FilterChangeStatus_t *ChangeStatus,
+                          uint16 Algorithm_X);
+
+/**
+ * \brief Determine whether Software Bus message packet is within time window
+ *
+ *  \par Description
+ *       This routine will apply the DS time-window filter to the packet.
+ *       A packet is filtered when its timestamp is less than the window
+ *       interval after the last packet stored by the filter.  Packets
+ *       that are not filtered become the last stored packet.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The window interval is Algorithm_X times 10 to the power of
+ *       Algorithm_O microseconds, with Algorithm_O limited to
+ *       #DS_WINDOW_MAX_EXPONENT.  For example X = 250, O = 3 stores at
+ *       most one packet every 250 ms.  A packet timestamped earlier than
+ *       the last stored packet is stored and restarts the window.
+ *       Algorithm_N is not used.
+ *
+ *  \param[in] MessagePtr   Pointer to a Software Bus message packet
+ *  \param[in] WindowStatus Current state of the time-window filter
+ *  \param[in] Algorithm_X  Algorithm parameter X "window length"
+ *  \param[in] Algorithm_O  Algorithm parameter O "window unit exponent"
+ *
+ *  \return Boolean packet filtered response
+ *  \retval true  The packet should be filtered (not used)
+ *  \retval false The packet should not be filtered (used)
+ */
+bool DS_IsPacketInWindow(const CFE_MSG_Message_t *MessagePtr, DS_FilterWindowStatus_t *WindowStatus,
+                         uint16 Algorithm_X, uint16 Algorithm_O);
+
+/**
+ * \brief Compute packet content hash
+ *
+ *  \par Description
+ *       This routine continues an FNV-1a hash over the data, taking
+ *       whole 32-bit words at a time and then any remaining bytes.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The hash is only compared on board, so the host byte order
+ *       of the words does not matter.
+ *
+ *  \param[in] Data   Pointer to the data
+ *  \param[in] Length Data length in bytes
+ *  \param[in] Hash   Hash of any preceding data (or a seed)
+ *
+ *  \return Hash of the data
+ */
+uint32 DS_PacketHash(const uint8 *Data, uint32 Length, uint32 Hash);
+
+/**
+ * \brief Determine whether Software Bus message packet matches payload predicate
+ *
+ *  \par Description
+ *       This routine will evaluate the compiled payload predicate of a
+ *       packet filter table entry against the packet contents.  Each
+ *       term reads a 1, 2 or 4 byte big endian field at an offset from
+ *       the start of the packet, masks it and tests it against a range.
+ *       Terms are combined with AND or OR and evaluation stops as soon
+ *       as the result is known.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A predicate without terms matches every packet.  A term whose
+ *       field extends beyond the end of the packet is false.
+ *
+ *  \param[in] MessagePtr Pointer to a Software Bus message packet
+ *  \param[in] Predicate  Compiled payload predicate
+ *
+ *  \return Boolean packet matched response
+ *  \retval true  The packet matches the predicate (used)
+ *  \retval false The packet does not match the predicate (filtered)
+ *
+ *  \sa #DS_TableCompilePredicate
+ */
+bool DS_IsPacketMatched(const CFE_MSG_Message_t *MessagePtr, const DS_PacketPredicate_t *Predicate);
+
+/**
+ * \brief Determine whether Software Bus message packet is over rate limit
+ *
+ *  \par Description
+ *       This routine will apply a token bucket rate limit to the packet.
+ *       The packet and byte buckets are refilled at their rates from the
+ *       time since the last packet, and hold at most one second of
+ *       their rate.  A packet is dropped unless both buckets have room
+ *       for it, and only passed packets are taken from the buckets.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A rate of zero is no limit.  When both rates are zero the
+ *       packet is never dropped and the time is not read.  A packet
+ *       larger than the byte rate is always dropped.  The buckets are
+ *       full for the first packet after a reset, and are not refilled
+ *       when the time goes backwards.
+ *
+ *  \param[in] MessagePtr  Pointer to a Software Bus message packet
+ *  \param[in] RateStatus  Current state of the rate limit
+ *  \param[in] RatePackets Max packets per second (0 = no limit)
+ *  \param[in] RateBytes   Max packet bytes per second (0 = no limit)
+ *
+ *  \return Boolean packet dropped response
+ *  \retval true  The packet is over the rate limit (not used)
+ *  \retval false The packet is within the rate limit (used)
+ */
+bool DS_IsPacketOverRate(const CFE_MSG_Message_t *MessagePtr, DS_RateLimitStatus_t *RateStatus, uint16 RatePackets,
+                         uint32 RateBytes);
+
+/**
+ *  \brief Remember packet sent by DS
+ *
+ *  \par Description
+ *       This function records the message ID, sequence count, length,
+ *       CRC and send time of a packet that DS is about to send on the
+ *       software bus, so that the packet is recognized (and not stored
+ *       again) when it comes back through the DS pipe.  Overwriting an
+ *       entry that is still pending forgets that packet.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Must be called before the packet is sent.  Only one task may
+ *       record packets in a given echo table.  The table mutex (if
+ *       defined) is held while the table is updated.
+ *
+ *  \param[in] EchoTable  Echo table of the sending task
+ *  \param[in] MessagePtr Pointer to the packet about to be sent
+ *
+ *  \sa #DS_IsPacketEcho
+ */
+void DS_FileEchoRecord(DS_EchoTable_t *EchoTable, const CFE_MSG_Message_t *MessagePtr);
+
+/**
+ * \brief Determine whether Software Bus message packet was sent by DS
+ *
+ *  \par Description
+ *       This routine searches the echo table for a pending packet with
+ *       the same message ID, sequence count, length and CRC.  A matching
+ *       entry is cleared, so each sent packet is matched at most once.
+ *       Pending entries older than #DS_ECHO_TIMEOUT seconds are cleared
+ *       during the search.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The table is not searched while no recorded packet is pending.
+ *       A live packet is only matched when it is identical to a pending
+ *       sent packet, so a sequence count collision alone never drops a
+ *       live packet.  The table mutex (if defined) is held during the
+ *       search.
+ *
+ *  \param[in] EchoTable  Echo table of the sending task
+ *  \param[in] MessageID  Message ID of the received packet
+ *  \param[in] MessagePtr Pointer to a Software Bus message packet
+ *
+ *  \return Boolean packet echo response
+ *  \retval true  The packet was sent by DS (do not store)
+ *  \retval false The packet was not sent by DS
+ *
+ *  \sa #DS_FileEchoRecord
+ */
+bool DS_IsPacketEcho(DS_EchoTable_t *EchoTable, CFE_SB_MsgId_t MessageID, const CFE_MSG_Message_t *MessagePtr);
 
 #endif
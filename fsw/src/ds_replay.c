@@ -0,0 +1,484 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+/**
+ * @file
+ *  CFS Data Storage (DS) packet replay functions
+ */
+
+#include "cfe.h"
+#include "cfe_fs.h"
+
+#include "ds_platform_cfg.h"
+#include "ds_verify.h"
+
+#include "ds_appdefs.h"
+#include "ds_perfids.h"
+
+#include "ds_msg.h"
+#include "ds_app.h"
+#include "ds_file.h"
+#include "ds_extract.h"
+#include "ds_replay.h"
+#include "ds_eventids.h"
+
+#include <string.h>
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Initialize packet replay                                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+CFE_Status_t DS_ReplayInit(void)
+{
+    CFE_Status_t Result;
+
+    DS_AppData.ReplayState = DS_REPLAY_IDLE;
+
+    /*
+    ** Replay task records the packets it sends in the echo table read by the main task...
+    */
+    Result = OS_MutSemCreate(&DS_AppData.ReplayEcho.MutexId, DS_REPLAY_TASK_NAME, 0);
+
+    if (Result != OS_SUCCESS)
+    {
+        CFE_EVS_SendEvent(DS_INIT_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Unable to create replay echo mutex, err = 0x%08X", (unsigned int)Result);
+    }
+    else
+    {
+        /*
+        ** Replay start command gives the semaphore to start a replay...
+        */
+        Result = OS_CountSemCreate(&DS_AppData.ReplaySemaphore, DS_REPLAY_TASK_NAME, 0, 0);
+
+        if (Result != OS_SUCCESS)
+        {
+            CFE_EVS_SendEvent(DS_INIT_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Unable to create replay semaphore, err = 0x%08X", (unsigned int)Result);
+        }
+        else
+        {
+            /*
+            ** Child task runs below DS so replay never delays storage...
+            */
+            Result = CFE_ES_CreateChildTask(&DS_AppData.ReplayTaskId, DS_REPLAY_TASK_NAME, DS_ReplayTask,
+                                            CFE_ES_TASK_STACK_ALLOCATE, DS_REPLAY_TASK_STACK_SIZE,
+                                            DS_REPLAY_TASK_PRIORITY, 0);
+
+            if (Result != CFE_SUCCESS)
+            {
+                CFE_EVS_SendEvent(DS_INIT_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "Unable to create replay child task, err = 0x%08X", (unsigned int)Result);
+            }
+        }
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Packet replay child task entry point                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_ReplayTask(void)
+{
+    int32 Result;
+
+    do
+    {
+        Result = OS_CountSemTake(DS_AppData.ReplaySemaphore);
+
+        if (Result == OS_SUCCESS)
+        {
+            CFE_ES_PerfLogEntry(DS_REPLAY_PERF_ID);
+
+            DS_ReplayFile();
+
+            CFE_ES_PerfLogExit(DS_REPLAY_PERF_ID);
+
+            DS_AppData.ReplayStopPending = false;
+            DS_AppData.ReplaySeekPending = false;
+            DS_AppData.ReplayState       = DS_REPLAY_IDLE;
+        }
+    } while (Result == OS_SUCCESS);
+
+    /*
+    ** Replay start command rejects requests once the task has stopped...
+    */
+    DS_AppData.ReplaySemaphore = OS_OBJECT_ID_UNDEFINED;
+    DS_AppData.ReplayState     = DS_REPLAY_IDLE;
+
+    CFE_EVS_SendEvent(DS_REPLAY_ERR_EID, CFE_EVS_EventType_ERROR,
+                      "Packet replay task terminating, semaphore err = %d", (int)Result);
+
+    CFE_ES_ExitChildTask();
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Perform a packet replay                                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_ReplayFile(void)
+{
+    DS_ReplayStatus_t *Status     = &DS_AppData.ReplayStatus;
+    CFE_MSG_Message_t *MsgPtr     = NULL;
+    const char *       FailedStep = NULL;
+    int32              Result;
+
+    Status->FileHandle     = OS_OBJECT_ID_UNDEFINED;
+    Status->FileSize       = 0;
+    Status->DataStart      = 0;
+    Status->DataEnd        = 0;
+    Status->Offset         = 0;
+    Status->BufferCount    = 0;
+    Status->BufferPosition = 0;
+    Status->SkipSeconds    = 0;
+    Status->BurstCount     = 0;
+    Status->LastTimeValid  = false;
+
+    /*
+    ** Packet data follows the same headers written by DS_FileCreateDest...
+    */
+    if (DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE)
+    {
+        Status->DataStart = sizeof(CFE_FS_Header_t) + sizeof(DS_FileHeader_t);
+    }
+
+    Result = OS_OpenCreate(&Status->FileHandle, DS_AppData.ReplayFilename, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+
+    if (Result != OS_SUCCESS)
+    {
+        Status->FileHandle = OS_OBJECT_ID_UNDEFINED;
+        FailedStep         = "open file";
+    }
+    else
+    {
+        Result = DS_ExtractDataRange(Status->FileHandle, Status->DataStart, &Status->FileSize, &Status->DataEnd);
+
+        if (Result != OS_SUCCESS)
+        {
+            FailedStep = "size file";
+        }
+    }
+
+    if (Result == OS_SUCCESS)
+    {
+        Result = DS_ExtractCheckFormat(Status->FileHandle, Status->DataStart, Status->DataEnd);
+
+        if (Result != OS_SUCCESS)
+        {
+            FailedStep = "check format";
+        }
+    }
+
+    if (Result == OS_SUCCESS)
+    {
+        Result = OS_lseek(Status->FileHandle, Status->DataStart, OS_SEEK_SET);
+
+        if (Result == Status->DataStart)
+        {
+            Status->Offset = Status->DataStart;
+            Result         = OS_SUCCESS;
+        }
+        else
+        {
+            if (Result >= 0)
+            {
+                Result = OS_ERR_INVALID_SIZE;
+            }
+
+            FailedStep = "seek file";
+        }
+    }
+
+    /*
+    ** Commands from DS take effect between packets...
+    */
+    while ((Result == OS_SUCCESS) && !DS_AppData.ReplayStopPending && (Status->Offset < Status->DataEnd))
+    {
+        if (DS_AppData.ReplaySeekPending)
+        {
+            Result = DS_ReplaySeek();
+
+            if (Result != OS_SUCCESS)
+            {
+                FailedStep = "seek file";
+            }
+        }
+        else if (DS_AppData.ReplayPauseRequested)
+        {
+            DS_AppData.ReplayState = DS_REPLAY_PAUSED;
+
+            OS_TaskDelay(DS_REPLAY_POLL_DELAY);
+
+            /*
+            ** Pacing restarts with the first packet after resume...
+            */
+            Status->LastTimeValid = false;
+        }
+        else
+        {
+            DS_AppData.ReplayState = DS_REPLAY_ACTIVE;
+
+            Result = DS_ReplayNextPacket(&MsgPtr);
+
+            if (Result == OS_ERR_NOT_IMPLEMENTED)
+            {
+                FailedStep = "unsupported record";
+            }
+            else if (Result != OS_SUCCESS)
+            {
+                FailedStep = "read file";
+            }
+            else
+            {
+                Result = DS_ReplayPacket(MsgPtr);
+
+                if (Result != CFE_SUCCESS)
+                {
+                    FailedStep = "send packet";
+                }
+            }
+        }
+    }
+
+    if (OS_ObjectIdDefined(Status->FileHandle))
+    {
+        OS_close(Status->FileHandle);
+        Status->FileHandle = OS_OBJECT_ID_UNDEFINED;
+    }
+
+    if (Result == OS_SUCCESS)
+    {
+        CFE_EVS_SendEvent(DS_REPLAY_DONE_EID, CFE_EVS_EventType_INFORMATION,
+                          "Packet replay %s: file = '%s', packets = %u",
+                          DS_AppData.ReplayStopPending ? "stopped" : "complete", DS_AppData.ReplayFilename,
+                          (unsigned int)DS_AppData.ReplayPacketCount);
+    }
+    else
+    {
+        DS_AppData.ReplayErrCounter++;
+
+        CFE_EVS_SendEvent(DS_REPLAY_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Packet replay error: %s, result = %d, file = '%s', offset = %u", FailedStep, (int)Result,
+                          DS_AppData.ReplayFilename, (unsigned int)Status->Offset);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Get next packet from replay file                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 DS_ReplayNextPacket(CFE_MSG_Message_t **MsgPtrPtr)
+{
+    DS_ReplayStatus_t *Status     = &DS_AppData.ReplayStatus;
+    uint8 *            Buffer     = (uint8 *)Status->Buffer;
+    CFE_MSG_Size_t     PacketSize = 0;
+    uint32             Available  = Status->BufferCount - Status->BufferPosition;
+    uint32             ReadSize;
+    int32              Result = OS_SUCCESS;
+
+    if (Available >= sizeof(CFE_MSG_Message_t))
+    {
+        CFE_MSG_GetSize((const CFE_MSG_Message_t *)&Buffer[Status->BufferPosition], &PacketSize);
+    }
+
+    if ((Available < sizeof(CFE_MSG_Message_t)) || (PacketSize > Available))
+    {
+        /*
+        ** Move the partial packet (if any) to the front and read ahead behind it...
+        */
+        memmove(Buffer, &Buffer[Status->BufferPosition], Available);
+        Status->BufferCount    = Available;
+        Status->BufferPosition = 0;
+
+        ReadSize = Status->DataEnd - (Status->Offset + Available);
+        if (ReadSize > (DS_REPLAY_BUFFER_SIZE - Available))
+        {
+            ReadSize = DS_REPLAY_BUFFER_SIZE - Available;
+        }
+
+        if (ReadSize > 0)
+        {
+            Result = OS_read(Status->FileHandle, &Buffer[Available], ReadSize);
+
+            if (Result == ReadSize)
+            {
+                Status->BufferCount += ReadSize;
+                Available += ReadSize;
+                Result = OS_SUCCESS;
+            }
+            else if (Result >= 0)
+            {
+                Result = OS_ERR_INVALID_SIZE;
+            }
+        }
+
+        if ((Result == OS_SUCCESS) && (Available >= sizeof(CFE_MSG_Message_t)))
+        {
+            CFE_MSG_GetSize((const CFE_MSG_Message_t *)Buffer, &PacketSize);
+        }
+    }
+
+    if (Result == OS_SUCCESS)
+    {
+        if ((Available >= sizeof(CFE_MSG_Message_t)) &&
+            ((Buffer[Status->BufferPosition] & DS_FILE_RECORD_TAG_BIT) != 0))
+        {
+            /*
+            ** Delta and truncated records are not complete packets...
+            */
+            Result = OS_ERR_NOT_IMPLEMENTED;
+        }
+        else if ((Available < sizeof(CFE_MSG_Message_t)) || (PacketSize < sizeof(CFE_MSG_Message_t)) ||
+                 (PacketSize > Available))
+        {
+            /*
+            ** Invalid packet length or data range ends in the middle of a packet...
+            */
+            Result = OS_ERR_INVALID_SIZE;
+        }
+        else
+        {
+            *MsgPtrPtr = (CFE_MSG_Message_t *)&Buffer[Status->BufferPosition];
+
+            Status->BufferPosition += PacketSize;
+            Status->Offset += PacketSize;
+        }
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Send a replay packet                                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+CFE_Status_t DS_ReplayPacket(CFE_MSG_Message_t *MsgPtr)
+{
+    DS_ReplayStatus_t *Status     = &DS_AppData.ReplayStatus;
+    CFE_TIME_SysTime_t PacketTime = {0};
+    CFE_TIME_SysTime_t DeltaTime;
+    uint64             DelayMsec = 0;
+    CFE_Status_t       Result    = CFE_SUCCESS;
+
+    CFE_MSG_GetMsgTime(MsgPtr, &PacketTime);
+
+    if (PacketTime.Seconds >= Status->SkipSeconds)
+    {
+        /*
+        ** Packets after a seek are sent once the seek time is reached...
+        */
+        Status->SkipSeconds = 0;
+
+        if (Status->LastTimeValid && (CFE_TIME_Compare(PacketTime, Status->LastTime) == CFE_TIME_A_GT_B))
+        {
+            DeltaTime = CFE_TIME_Subtract(PacketTime, Status->LastTime);
+            DelayMsec = ((uint64)DeltaTime.Seconds * 1000) + (CFE_TIME_Sub2MicroSecs(DeltaTime.Subseconds) / 1000);
+            DelayMsec = DelayMsec / DS_AppData.ReplayRate;
+
+            if (DelayMsec > DS_REPLAY_MAX_DELAY)
+            {
+                DelayMsec = DS_REPLAY_MAX_DELAY;
+            }
+        }
+
+        Status->LastTime      = PacketTime;
+        Status->LastTimeValid = true;
+
+        if (DelayMsec > 0)
+        {
+            Status->BurstCount = 0;
+            OS_TaskDelay((uint32)DelayMsec);
+        }
+        else if (++Status->BurstCount >= DS_REPLAY_BURST_LIMIT)
+        {
+            /*
+            ** Let lower priority tasks run during a long burst...
+            */
+            Status->BurstCount = 0;
+            OS_TaskDelay(DS_REPLAY_POLL_DELAY);
+        }
+
+        /*
+        ** Replayed packets are sent unchanged, which lets DS recognize them
+        ** (and not store them again) when they come back through its pipe...
+        */
+        DS_FileEchoRecord(&DS_AppData.ReplayEcho, MsgPtr);
+
+        Result = CFE_SB_TransmitMsg(MsgPtr, false);
+
+        if (Result == CFE_SUCCESS)
+        {
+            DS_AppData.ReplayPacketCount++;
+        }
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Move packet replay to the seek time                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 DS_ReplaySeek(void)
+{
+    DS_ReplayStatus_t *Status    = &DS_AppData.ReplayStatus;
+    uint32             SeekStart = Status->DataStart;
+    uint32             SeekEnd   = Status->DataEnd;
+    int32              Result;
+
+    DS_AppData.ReplaySeekPending = false;
+
+    /*
+    ** Without a usable index the seek restarts from the first packet...
+    */
+    DS_ExtractIndexRange(DS_AppData.ReplayFilename, DS_AppData.ReplaySeekSeconds, 0xFFFFFFFF, Status->FileSize,
+                         &SeekStart, &SeekEnd);
+
+    Result = OS_lseek(Status->FileHandle, SeekStart, OS_SEEK_SET);
+
+    if (Result == SeekStart)
+    {
+        Status->Offset         = SeekStart;
+        Status->BufferCount    = 0;
+        Status->BufferPosition = 0;
+        Status->SkipSeconds    = DS_AppData.ReplaySeekSeconds;
+        Status->BurstCount     = 0;
+        Status->LastTimeValid  = false;
+
+        Result = OS_SUCCESS;
+    }
+    else if (Result >= 0)
+    {
+        Result = OS_ERR_INVALID_SIZE;
+    }
+
+    return Result;
+}
@@ -0,0 +1,140 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+/**
+ * @file
+ *   CFS Data Storage (DS) packet replay header file
+ */
+#ifndef DS_REPLAY_H
+#define DS_REPLAY_H
+
+#include "cfe.h"
+
+#include "ds_platform_cfg.h"
+#include "ds_app.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* DS packet replay function prototypes                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**
+ *  \brief Initialize packet replay
+ *
+ *  \par Description
+ *       This function creates the semaphore used to start a replay and
+ *       the low priority child task that performs the replay.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called during application initialization.
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+CFE_Status_t DS_ReplayInit(void);
+
+/**
+ *  \brief Packet replay child task entry point
+ *
+ *  \par Description
+ *       The child task waits on the replay semaphore and replays the
+ *       file named by the last accepted replay start command each time
+ *       the semaphore is given.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The task runs at a lower priority than DS so that reading the
+ *       replay file does not delay the storage of packets.
+ */
+void DS_ReplayTask(void);
+
+/**
+ *  \brief Perform a packet replay
+ *
+ *  \par Description
+ *       This function sends the packets in the replay file to the
+ *       software bus, paced by the packet times in the file, until the
+ *       end of the file or until a stop command is received.  Pause,
+ *       resume and seek commands take effect between packets.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The filename and rate are taken from the application data set
+ *       by the replay start command.  Once started, only this task
+ *       changes the replay state; commands post requests instead.
+ */
+void DS_ReplayFile(void);
+
+/**
+ *  \brief Get next packet from replay file
+ *
+ *  \par Description
+ *       This function returns a pointer to the next packet in the read
+ *       ahead buffer.  When the buffer does not hold a complete packet,
+ *       the partial packet is moved to the front of the buffer and the
+ *       rest of the buffer is filled from the file, so most packets are
+ *       sent without waiting on a file read.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A packet with an invalid length ends the replay with an error.
+ *       A delta or truncated record ends the replay with
+ *       #OS_ERR_NOT_IMPLEMENTED.
+ *
+ *  \param[out] MsgPtrPtr Pointer to next packet
+ *
+ *  \return OSAL execution status
+ */
+int32 DS_ReplayNextPacket(CFE_MSG_Message_t **MsgPtrPtr);
+
+/**
+ *  \brief Send a replay packet
+ *
+ *  \par Description
+ *       This function waits for the time between the previous packet
+ *       and this packet, divided by the rate multiplier, and then sends
+ *       the packet to the software bus.  Packets before the time of the
+ *       last seek command are skipped.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The wait is limited to #DS_REPLAY_MAX_DELAY and there is no
+ *       wait when packet time goes backwards.  Runs of packets with no
+ *       wait are broken up by #DS_REPLAY_POLL_DELAY every
+ *       #DS_REPLAY_BURST_LIMIT packets.
+ *
+ *  \param[in] MsgPtr Pointer to packet
+ *
+ *  \return Software bus execution status
+ */
+CFE_Status_t DS_ReplayPacket(CFE_MSG_Message_t *MsgPtr);
+
+/**
+ *  \brief Move packet replay to the seek time
+ *
+ *  \par Description
+ *       This function moves the replay file position to the first
+ *       sidecar index record at or before the seek time.  Without a
+ *       usable index the replay restarts from the first packet.  The
+ *       packets before the seek time are skipped as they are read.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The seek time is taken from the application data set by the
+ *       replay seek command.
+ *
+ *  \return OSAL execution status
+ */
+int32 DS_ReplaySeek(void);
+
+#endif
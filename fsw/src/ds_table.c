@@ -24,6 +24,7 @@
 #include "cfe.h"
 
 #include "ds_msgids.h"
+#include "ds_perfids.h"
 
 #include "ds_platform_cfg.h"
 #include "ds_verify.h"
@@ -32,6 +33,7 @@
 
 #include "ds_app.h"
 #include "ds_table.h"
+#include "ds_file.h"
 #include "ds_msg.h"
 #include "ds_eventids.h"
 
@@ -314,14 +316,14 @@ void DS_TableManageFilter(void)
             DS_AppData.FilterTblLoadCounter++;
 
             /*
-            ** Subscribe to the packets in the new filter table...
+            ** Create hash table for messageID's in new filter table...
             */
-            DS_TableSubscribe();
+            DS_TableCreateHash();
 
             /*
-            ** Create hash table for messageID's in new filter table...
+            ** Subscribe to the packets in the new filter table (and expanded wildcard entries)...
             */
-            DS_TableCreateHash();
+            DS_TableSubscribe();
         }
         else if (Result == CFE_TBL_ERR_NEVER_LOADED)
         {
@@ -376,14 +378,14 @@ void DS_TableManageFilter(void)
             CFE_TBL_Update(DS_AppData.FilterTblHandle);
             CFE_TBL_GetAddress((void *)&DS_AppData.FilterTblPtr, DS_AppData.FilterTblHandle);
             /*
-            ** Subscribe to the packets in the new filter table...
+            ** Create hash table for messageID's in new filter table...
             */
-            DS_TableSubscribe();
+            DS_TableCreateHash();
 
             /*
-            ** Create hash table for messageID's in new filter table...
+            ** Subscribe to the packets in the new filter table (and expanded wildcard entries)...
             */
-            DS_TableCreateHash();
+            DS_TableSubscribe();
         }
     }
 }
@@ -454,6 +456,15 @@ bool DS_TableVerifyDestFileEntry(DS_DestFileEntry_t *DestFileEntry, uint8 TableI
     **  MaxFileSize   = cannot be less than DS_FILE_MIN_SIZE_LIMIT
     **  MaxFileAge    = cannot be less than DS_FILE_MIN_AGE_LIMIT
     **  SequenceCount = may be zero, cannot exceed DS_MAX_SEQUENCE_COUNT
+    **
+    **  FileMode       = DS_FILE_MODE_LINEAR or DS_FILE_MODE_RING
+    **  MaxStorageSize = zero (no limit) or not less than MaxFileSize
+    **  TrailerState   = DS_ENABLED or DS_DISABLED
+    **  CompressMode   = DS_COMPRESS_NONE or DS_COMPRESS_LZ (LZ only for linear files without index)
+    **  SizeLimitMode  = DS_SIZE_LIMIT_PHYSICAL or DS_SIZE_LIMIT_LOGICAL
+    **  ShardMode      = DS_SHARD_NONE, DS_SHARD_BY_TIME or DS_SHARD_BY_COUNT (count only for count filenames)
+    **
+    **  Ring files cannot hold truncated records (see DS_TableVerifyStoreLength)
     */
     if (DS_TableVerifyType(DestFileEntry->FileNameType) == false)
     {
@@ -500,6 +511,82 @@ bool DS_TableVerifyDestFileEntry(DS_DestFileEntry_t *DestFileEntry, uint8 TableI
         }
         Result = false;
     }
+    else if (DS_TableVerifyMode(DestFileEntry->FileMode) == false)
+    {
+        if (ErrorCount == 0)
+        {
+            CFE_EVS_SendEvent(DS_FIL_TBL_ERR_EID, CFE_EVS_EventType_ERROR, "%s index = %d, file mode = %d",
+                              CommonErrorText, (int)TableIndex, (int)DestFileEntry->FileMode);
+        }
+        Result = false;
+    }
+    else if (DS_TableVerifyStorage(DestFileEntry->MaxStorageSize, DestFileEntry->MaxFileSize) == false)
+    {
+        if (ErrorCount == 0)
+        {
+            CFE_EVS_SendEvent(DS_FIL_TBL_ERR_EID, CFE_EVS_EventType_ERROR, "%s index = %d, max storage size = %d",
+                              CommonErrorText, (int)TableIndex, (int)DestFileEntry->MaxStorageSize);
+        }
+        Result = false;
+    }
+    else if (DS_TableVerifyState(DestFileEntry->TrailerState) == false)
+    {
+        if (ErrorCount == 0)
+        {
+            CFE_EVS_SendEvent(DS_FIL_TBL_ERR_EID, CFE_EVS_EventType_ERROR, "%s index = %d, trailer state = %d",
+                              CommonErrorText, (int)TableIndex, (int)DestFileEntry->TrailerState);
+        }
+        Result = false;
+    }
+    else if (DS_TableVerifyCompress(DestFileEntry->CompressMode, DestFileEntry->FileMode, DestFileEntry->IndexPackets,
+                                    DestFileEntry->IndexSeconds) == false)
+    {
+        if (ErrorCount == 0)
+        {
+            CFE_EVS_SendEvent(DS_FIL_TBL_ERR_EID, CFE_EVS_EventType_ERROR, "%s index = %d, compress mode = %d",
+                              CommonErrorText, (int)TableIndex, (int)DestFileEntry->CompressMode);
+        }
+        Result = false;
+    }
+    else if (DS_TableVerifySizeLimit(DestFileEntry->SizeLimitMode) == false)
+    {
+        if (ErrorCount == 0)
+        {
+            CFE_EVS_SendEvent(DS_FIL_TBL_ERR_EID, CFE_EVS_EventType_ERROR, "%s index = %d, size limit mode = %d",
+                              CommonErrorText, (int)TableIndex, (int)DestFileEntry->SizeLimitMode);
+        }
+        Result = false;
+    }
+    else if (DS_TableVerifyRecord(DestFileEntry->RecordMode, DestFileEntry->KeyframeInterval, DestFileEntry->FileMode,
+                                  DestFileEntry->IndexPackets, DestFileEntry->IndexSeconds) == false)
+    {
+        if (ErrorCount == 0)
+        {
+            CFE_EVS_SendEvent(DS_FIL_TBL_ERR_EID, CFE_EVS_EventType_ERROR, "%s index = %d, record mode = %d",
+                              CommonErrorText, (int)TableIndex, (int)DestFileEntry->RecordMode);
+        }
+        Result = false;
+    }
+    else if (DS_TableVerifyShard(DestFileEntry->ShardMode, DestFileEntry->ShardFiles, DestFileEntry->FileNameType) ==
+             false)
+    {
+        if (ErrorCount == 0)
+        {
+            CFE_EVS_SendEvent(DS_FIL_TBL_ERR_EID, CFE_EVS_EventType_ERROR, "%s index = %d, shard mode = %d",
+                              CommonErrorText, (int)TableIndex, (int)DestFileEntry->ShardMode);
+        }
+        Result = false;
+    }
+    else if (DS_TableVerifyDestStoreLength(TableIndex, DestFileEntry->FileMode) == false)
+    {
+        if (ErrorCount == 0)
+        {
+            CFE_EVS_SendEvent(DS_FIL_TBL_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "%s index = %d, file mode = %d (truncating filter)", CommonErrorText, (int)TableIndex,
+                              (int)DestFileEntry->FileMode);
+        }
+        Result = false;
+    }
 
     return Result;
 }
@@ -512,9 +599,11 @@ bool DS_TableVerifyDestFileEntry(DS_DestFileEntry_t *DestFileEntry, uint8 TableI
 
 CFE_Status_t DS_TableVerifyFilter(const void *TableData)
 {
-    DS_FilterTable_t *FilterTable = (DS_FilterTable_t *)TableData;
-    CFE_Status_t      Result      = CFE_SUCCESS;
-    int32             i           = 0;
+    DS_FilterTable_t *FilterTable   = (DS_FilterTable_t *)TableData;
+    CFE_Status_t      Result        = CFE_SUCCESS;
+    uint32            WildcardMids  = 0;
+    uint32            WildcardCount = 0;
+    int32             i             = 0;
 
     int32 CountGood   = 0;
     int32 CountBad    = 0;
@@ -524,6 +613,9 @@ CFE_Status_t DS_TableVerifyFilter(const void *TableData)
     ** Perform the following validation:
     **
     **   MessageID = unlimited, zero means unused
+    **
+    **   MessageMask = unlimited, but wildcard entries together cannot
+    **                 cover more than DS_WILDCARD_MIDS message IDs
     */
 
     /*
@@ -538,6 +630,12 @@ CFE_Status_t DS_TableVerifyFilter(const void *TableData)
         else if (DS_TableVerifyFilterEntry(&FilterTable->Packet[i], (uint8)i, CountBad) == true)
         {
             CountGood++;
+
+            /*
+            ** Saturate rather than wrap when summing wildcard sizes...
+            */
+            WildcardCount = DS_TableWildcardCount(FilterTable->Packet[i].MessageMask);
+            WildcardMids  = (WildcardCount > (0xFFFFFFFF - WildcardMids)) ? 0xFFFFFFFF : WildcardMids + WildcardCount;
         }
         else
         {
@@ -546,6 +644,14 @@ CFE_Status_t DS_TableVerifyFilter(const void *TableData)
         }
     }
 
+    if (WildcardMids > DS_WILDCARD_MIDS)
+    {
+        CFE_EVS_SendEvent(DS_FLT_TBL_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Filter table verify err: wildcard entries cover %lu MIDs, max = %d",
+                          (unsigned long)WildcardMids, (int)DS_WILDCARD_MIDS);
+        Result = DS_TABLE_VERIFY_ERR;
+    }
+
     /*
     ** Note that totals include each table entry plus the descriptor
     */
@@ -566,8 +672,9 @@ bool DS_TableVerifyFilterEntry(DS_PacketEntry_t *PacketEntry, int32 TableIndex,
 {
     const char *      CommonErrorText = "Filter table verify err:";
     DS_FilterParms_t *FilterParms;
-    bool              Result = true;
-    int32             i      = 0;
+    uint16            FileMode = DS_FILE_MODE_LINEAR;
+    bool              Result   = true;
+    int32             i        = 0;
 
     /*
     ** Each packet filter table entry has multiple filters per packet
@@ -575,13 +682,20 @@ bool DS_TableVerifyFilterEntry(DS_PacketEntry_t *PacketEntry, int32 TableIndex,
     ** Perform the following validation (per filter):
     **
     **   FileTableIndex = must be less than DS_DEST_FILE_CNT
-    **   FilterType = must be DS_BY_COUNT or DS_BY_TIME
+    **   FilterType = must be DS_BY_COUNT, DS_BY_TIME, DS_BY_CHANGE or DS_BY_WINDOW
     **
     **   Algorithm_N = cannot exceed Algorithm_X, zero means filter ALL
     **   Algorithm_X = unlimited
     **   Algorithm_O = must be less than Algorithm_X
     **
+    **   Priority = must be DS_PRIORITY_HIGH or DS_PRIORITY_LOW
+    **
+    **   MaxStoreLength = zero, or from telemetry header size to DS_TRUNCATE_MAX_LENGTH
+    **                    (zero only for ring destinations unless DS_TRUNCATE_PATCH_LENGTH)
+    **
     **   Note: unused filters (all zero's) are valid
+    **
+    ** The payload predicate is checked once all filters are valid
     */
     for (i = 0; (i < DS_FILTERS_PER_PACKET) && (Result == true); i++)
     {
@@ -592,6 +706,13 @@ bool DS_TableVerifyFilterEntry(DS_PacketEntry_t *PacketEntry, int32 TableIndex,
             /*
             ** If any filter field is non-zero then all filter fields must be valid
             */
+            FileMode = DS_FILE_MODE_LINEAR;
+
+            if ((DS_AppData.DestFileTblPtr != NULL) && (FilterParms->FileTableIndex < DS_DEST_FILE_CNT))
+            {
+                FileMode = DS_AppData.DestFileTblPtr->File[FilterParms->FileTableIndex].FileMode;
+            }
+
             if (DS_TableVerifyFileIndex((uint32)FilterParms->FileTableIndex) == false)
             {
                 if (ErrorCount == 0)
@@ -603,7 +724,7 @@ bool DS_TableVerifyFilterEntry(DS_PacketEntry_t *PacketEntry, int32 TableIndex,
                 }
                 Result = false;
             }
-            else if (DS_TableVerifyType((uint16)FilterParms->FilterType) == false)
+            else if (DS_TableVerifyFilterType((uint16)FilterParms->FilterType) == false)
             {
                 if (ErrorCount == 0)
                 {
@@ -627,7 +748,41 @@ bool DS_TableVerifyFilterEntry(DS_PacketEntry_t *PacketEntry, int32 TableIndex,
                 }
                 Result = false;
             }
+            else if (DS_TableVerifyPriority(FilterParms->Priority) == false)
+            {
+                if (ErrorCount == 0)
+                {
+                    CFE_EVS_SendEvent(DS_FLT_TBL_ERR_EID, CFE_EVS_EventType_ERROR,
+                                      "%s MID = 0x%08lX, index = %d, filter = %d, priority = %d", CommonErrorText,
+                                      (unsigned long)CFE_SB_MsgIdToValue(PacketEntry->MessageID), (int)TableIndex,
+                                      (int)i, FilterParms->Priority);
+                }
+                Result = false;
+            }
+            else if (DS_TableVerifyStoreLength(FilterParms->MaxStoreLength, FileMode) == false)
+            {
+                if (ErrorCount == 0)
+                {
+                    CFE_EVS_SendEvent(DS_FLT_TBL_ERR_EID, CFE_EVS_EventType_ERROR,
+                                      "%s MID = 0x%08lX, index = %d, filter = %d, store length = %d", CommonErrorText,
+                                      (unsigned long)CFE_SB_MsgIdToValue(PacketEntry->MessageID), (int)TableIndex,
+                                      (int)i, FilterParms->MaxStoreLength);
+                }
+                Result = false;
+            }
+        }
+    }
+
+    if ((Result == true) && (DS_TableVerifyPredicate(PacketEntry) == false))
+    {
+        if (ErrorCount == 0)
+        {
+            CFE_EVS_SendEvent(DS_FLT_TBL_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "%s MID = 0x%08lX, index = %d, predicate logic = %d", CommonErrorText,
+                              (unsigned long)CFE_SB_MsgIdToValue(PacketEntry->MessageID), (int)TableIndex,
+                              PacketEntry->PredicateLogic);
         }
+        Result = false;
     }
 
     return Result;
@@ -727,6 +882,286 @@ bool DS_TableVerifyType(uint16 TimeVsCount)
     return Result;
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify filter type                                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_TableVerifyFilterType(uint16 FilterType)
+{
+    bool Result = true;
+
+    if ((DS_TableVerifyType(FilterType) == false) && (FilterType != DS_BY_CHANGE) && (FilterType != DS_BY_WINDOW))
+    {
+        Result = false;
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify filter priority                                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_TableVerifyPriority(uint16 Priority)
+{
+    bool Result = true;
+
+    if ((Priority != DS_PRIORITY_HIGH) && (Priority != DS_PRIORITY_LOW))
+    {
+        Result = false;
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify max store length                                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_TableVerifyStoreLength(uint16 MaxStoreLength, uint16 FileMode)
+{
+    bool Result = true;
+
+    /*
+    ** Truncated packets always keep the whole telemetry header...
+    */
+    if ((MaxStoreLength != 0) &&
+        ((MaxStoreLength < sizeof(CFE_MSG_TelemetryHeader_t)) || (MaxStoreLength > DS_TRUNCATE_MAX_LENGTH)))
+    {
+        Result = false;
+    }
+    else if ((MaxStoreLength != 0) && (FileMode == DS_FILE_MODE_RING) && (DS_TRUNCATE_PATCH_LENGTH == 0))
+    {
+        /*
+        ** Ring walk reads record lengths from packet headers, which
+        ** do not describe the truncated record prefix...
+        */
+        Result = false;
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify max store length of filters using a destination          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_TableVerifyDestStoreLength(uint16 FileTableIndex, uint16 FileMode)
+{
+    const DS_FilterParms_t *FilterParms;
+    bool                    Result = true;
+    int32                   i      = 0;
+    int32                   j      = 0;
+
+    /*
+    ** Filter table (if loaded) was verified against the previous destinations...
+    */
+    if (DS_AppData.FilterTblPtr != NULL)
+    {
+        for (i = 0; (i < DS_PACKETS_IN_FILTER_TABLE) && (Result == true); i++)
+        {
+            for (j = 0; (j < DS_FILTERS_PER_PACKET) && (Result == true); j++)
+            {
+                FilterParms = &DS_AppData.FilterTblPtr->Packet[i].Filter[j];
+
+                if (FilterParms->FileTableIndex == FileTableIndex)
+                {
+                    Result = DS_TableVerifyStoreLength(FilterParms->MaxStoreLength, FileMode);
+                }
+            }
+        }
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify payload predicate                                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_TableVerifyPredicate(const DS_PacketEntry_t *PacketEntry)
+{
+    const DS_PredicateTerm_t *Term;
+    bool                      Result = true;
+    int32                     i      = 0;
+
+    if ((PacketEntry->PredicateLogic != DS_PREDICATE_AND) && (PacketEntry->PredicateLogic != DS_PREDICATE_OR))
+    {
+        Result = false;
+    }
+
+    for (i = 0; (i < DS_PREDICATE_TERMS) && (Result == true); i++)
+    {
+        Term = &PacketEntry->Predicate[i];
+
+        if (Term->Width == DS_UNUSED)
+        {
+            /*
+            ** Unused terms (all zero's) are valid
+            */
+            Result = DS_TableEntryUnused(Term, sizeof(DS_PredicateTerm_t));
+        }
+        else if ((Term->Width != 1) && (Term->Width != 2) && (Term->Width != 4))
+        {
+            Result = false;
+        }
+        else if ((Term->Operator < DS_PREDICATE_EQ) || (Term->Operator > DS_PREDICATE_GE))
+        {
+            Result = false;
+        }
+        else if (Term->Offset > (0xFFFF - Term->Width))
+        {
+            Result = false;
+        }
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify file mode                                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_TableVerifyMode(uint16 FileMode)
+{
+    bool Result = true;
+
+    if ((FileMode != DS_FILE_MODE_LINEAR) && (FileMode != DS_FILE_MODE_RING))
+    {
+        Result = false;
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify destination storage budget                               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_TableVerifyStorage(uint32 MaxStorageSize, uint32 MaxFileSize)
+{
+    bool Result = true;
+
+    if ((MaxStorageSize != 0) && (MaxStorageSize < MaxFileSize))
+    {
+        Result = false;
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify compression mode                                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_TableVerifyCompress(uint16 CompressMode, uint16 FileMode, uint16 IndexPackets, uint16 IndexSeconds)
+{
+    bool Result = true;
+
+    if ((CompressMode != DS_COMPRESS_NONE) && (CompressMode != DS_COMPRESS_LZ))
+    {
+        Result = false;
+    }
+    else if ((CompressMode == DS_COMPRESS_LZ) &&
+             ((FileMode != DS_FILE_MODE_LINEAR) || (IndexPackets != 0) || (IndexSeconds != 0)))
+    {
+        /*
+        ** Ring files overwrite in place and index offsets are physical...
+        */
+        Result = false;
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify file size limit mode                                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_TableVerifySizeLimit(uint16 SizeLimitMode)
+{
+    bool Result = true;
+
+    if ((SizeLimitMode != DS_SIZE_LIMIT_PHYSICAL) && (SizeLimitMode != DS_SIZE_LIMIT_LOGICAL))
+    {
+        Result = false;
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify file record mode                                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_TableVerifyRecord(uint16 RecordMode, uint16 KeyframeInterval, uint16 FileMode, uint16 IndexPackets,
+                          uint16 IndexSeconds)
+{
+    bool Result = true;
+
+    if ((RecordMode != DS_RECORD_FULL) && (RecordMode != DS_RECORD_DELTA))
+    {
+        Result = false;
+    }
+    else if ((RecordMode == DS_RECORD_DELTA) &&
+             ((KeyframeInterval == 0) || (FileMode != DS_FILE_MODE_LINEAR) || (IndexPackets != 0) ||
+              (IndexSeconds != 0)))
+    {
+        /*
+        ** Delta records can only be decoded from the start of the file,
+        ** which ring overwrites and index offsets would not respect
+        */
+        Result = false;
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify file subdirectory shard mode                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_TableVerifyShard(uint16 ShardMode, uint16 ShardFiles, uint16 FileNameType)
+{
+    bool Result = true;
+
+    if ((ShardMode != DS_SHARD_NONE) && (ShardMode != DS_SHARD_BY_TIME) && (ShardMode != DS_SHARD_BY_COUNT))
+    {
+        Result = false;
+    }
+    else if ((ShardMode == DS_SHARD_BY_COUNT) && ((ShardFiles == 0) || (FileNameType != DS_BY_COUNT)))
+    {
+        /*
+        ** Count shards are blocks of filename sequence counts
+        */
+        Result = false;
+    }
+
+    return Result;
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Verify file ena/dis state                                       */
@@ -821,10 +1256,25 @@ void DS_TableSubscribe(void)
         MessageID = FilterPackets[i].MessageID;
 
         /*
-        ** Already subscribe to DS command packets...
+        ** Already subscribe to DS command packets (wildcard entries are subscribed below)...
         */
         if (CFE_SB_IsValidMsgId(MessageID) && (CFE_SB_MsgIdToValue(MessageID) != DS_CMD_MID) &&
-            (CFE_SB_MsgIdToValue(MessageID) != DS_SEND_HK_MID))
+            (CFE_SB_MsgIdToValue(MessageID) != DS_SEND_HK_MID) &&
+            (CFE_SB_MsgIdToValue(MessageID) != DS_BACKLOG_PROBE_MID) && (FilterPackets[i].MessageMask == 0))
+        {
+            CFE_SB_SubscribeEx(MessageID, DS_AppData.CmdPipe, CFE_SB_DEFAULT_QOS, DS_PER_PACKET_PIPE_LIMIT);
+        }
+    }
+
+    /*
+    ** Check each message ID expanded from "new" wildcard entries...
+    */
+    for (i = 0; i < DS_AppData.WildcardCount; i++)
+    {
+        MessageID = DS_AppData.WildcardLinks[i].MessageID;
+
+        if ((CFE_SB_MsgIdToValue(MessageID) != DS_CMD_MID) && (CFE_SB_MsgIdToValue(MessageID) != DS_SEND_HK_MID) &&
+            (CFE_SB_MsgIdToValue(MessageID) != DS_BACKLOG_PROBE_MID))
         {
             CFE_SB_SubscribeEx(MessageID, DS_AppData.CmdPipe, CFE_SB_DEFAULT_QOS, DS_PER_PACKET_PIPE_LIMIT);
         }
@@ -853,10 +1303,25 @@ void DS_TableUnsubscribe(void)
         MessageID = FilterPackets[i].MessageID;
 
         /*
-        ** Do not un-subscribe to unused or DS command packets...
+        ** Do not un-subscribe to unused or DS command packets (wildcard entries are un-subscribed below)...
         */
         if (CFE_SB_IsValidMsgId(MessageID) && (CFE_SB_MsgIdToValue(MessageID) != DS_CMD_MID) &&
-            (CFE_SB_MsgIdToValue(MessageID) != DS_SEND_HK_MID))
+            (CFE_SB_MsgIdToValue(MessageID) != DS_SEND_HK_MID) &&
+            (CFE_SB_MsgIdToValue(MessageID) != DS_BACKLOG_PROBE_MID) && (FilterPackets[i].MessageMask == 0))
+        {
+            CFE_SB_Unsubscribe(MessageID, DS_AppData.CmdPipe);
+        }
+    }
+
+    /*
+    ** Check each message ID expanded from "old" wildcard entries...
+    */
+    for (i = 0; i < DS_AppData.WildcardCount; i++)
+    {
+        MessageID = DS_AppData.WildcardLinks[i].MessageID;
+
+        if ((CFE_SB_MsgIdToValue(MessageID) != DS_CMD_MID) && (CFE_SB_MsgIdToValue(MessageID) != DS_SEND_HK_MID) &&
+            (CFE_SB_MsgIdToValue(MessageID) != DS_BACKLOG_PROBE_MID))
         {
             CFE_SB_Unsubscribe(MessageID, DS_AppData.CmdPipe);
         }
@@ -1041,10 +1506,244 @@ void DS_TableCreateHash(void)
     */
     memset(DS_AppData.HashLinks, 0, sizeof(DS_AppData.HashLinks));
     memset(DS_AppData.HashTable, 0, sizeof(DS_AppData.HashTable));
+    memset(DS_AppData.WildcardLinks, 0, sizeof(DS_AppData.WildcardLinks));
+    memset(DS_AppData.WildcardTable, 0, sizeof(DS_AppData.WildcardTable));
+    DS_AppData.WildcardCount = 0;
+
+    /*
+    ** Change-only filters, time-window filters and rate limits start over with the new filter table entries...
+    */
+    memset(DS_AppData.FilterChange, 0, sizeof(DS_AppData.FilterChange));
+    memset(DS_AppData.FilterWindow, 0, sizeof(DS_AppData.FilterWindow));
+    memset(DS_AppData.FilterRate, 0, sizeof(DS_AppData.FilterRate));
+
+    for (FilterIndex = 0; FilterIndex < DS_PACKETS_IN_FILTER_TABLE; FilterIndex++)
+    {
+        /*
+        ** Wildcard entries are expanded below, once every exact entry is present...
+        */
+        if (DS_AppData.FilterTblPtr->Packet[FilterIndex].MessageMask == 0)
+        {
+            DS_TableAddMsgID(DS_AppData.FilterTblPtr->Packet[FilterIndex].MessageID, FilterIndex);
+        }
+
+        /*
+        ** Payload predicates are compiled once here rather than per packet...
+        */
+        DS_TableCompilePredicate(FilterIndex);
+    }
 
+    /*
+    ** Exact entries win over wildcard entries, earlier wildcard entries win over later ones...
+    */
     for (FilterIndex = 0; FilterIndex < DS_PACKETS_IN_FILTER_TABLE; FilterIndex++)
     {
-        DS_TableAddMsgID(DS_AppData.FilterTblPtr->Packet[FilterIndex].MessageID, FilterIndex);
+        if (DS_AppData.FilterTblPtr->Packet[FilterIndex].MessageMask != 0)
+        {
+            DS_TableAddWildcard(FilterIndex);
+        }
+    }
+
+    /*
+    ** Latest-value cache entries of Message IDs no longer in the table are freed...
+    */
+    DS_FileCacheRebuild();
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Count message IDs covered by wildcard entry                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 DS_TableWildcardCount(uint32 MessageMask)
+{
+    uint32 FreeBits = 0;
+    uint32 Count    = 0;
+
+    if (MessageMask != 0)
+    {
+        /*
+        ** Each message ID bit that may differ doubles the count...
+        */
+        FreeBits = ~MessageMask & DS_WILDCARD_MID_MASK;
+        Count    = 1;
+
+        while ((FreeBits != 0) && (Count != 0x80000000))
+        {
+            FreeBits &= FreeBits - 1;
+            Count <<= 1;
+        }
+
+        if (FreeBits != 0)
+        {
+            Count = 0xFFFFFFFF;
+        }
+    }
+
+    return Count;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Expand wildcard entry into wildcard hash table                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_TableAddWildcard(int32 FilterIndex)
+{
+    const DS_PacketEntry_t *PacketEntry = &DS_AppData.FilterTblPtr->Packet[FilterIndex];
+    CFE_SB_MsgId_t          MessageID;
+    DS_HashLink_t *         NewLink   = NULL;
+    DS_HashLink_t *         LinkList  = NULL;
+    uint32                  HashIndex = 0;
+    uint32                  FreeBits  = 0;
+    uint32                  BaseValue = 0;
+    uint32                  Subset    = 0;
+
+    if (CFE_SB_IsValidMsgId(PacketEntry->MessageID))
+    {
+        FreeBits  = ~PacketEntry->MessageMask & DS_WILDCARD_MID_MASK;
+        BaseValue = CFE_SB_MsgIdToValue(PacketEntry->MessageID) & ~FreeBits;
+
+        /*
+        ** Visit every combination of the free bits (starting and ending with none set)...
+        */
+        do
+        {
+            MessageID = CFE_SB_ValueToMsgId(BaseValue | Subset);
+
+            /*
+            ** Skip invalid message ID's and those already matched by another entry...
+            */
+            if (CFE_SB_IsValidMsgId(MessageID) && (DS_TableFindMsgID(MessageID) == DS_INDEX_NONE) &&
+                (DS_AppData.WildcardCount < DS_WILDCARD_MIDS))
+            {
+                NewLink = &DS_AppData.WildcardLinks[DS_AppData.WildcardCount];
+                DS_AppData.WildcardCount++;
+
+                NewLink->Index     = FilterIndex;
+                NewLink->MessageID = MessageID;
+
+                /* Add new link to the end of the wildcard linked list */
+                HashIndex = DS_TableHashFunction(MessageID);
+
+                if (DS_AppData.WildcardTable[HashIndex] == (DS_HashLink_t *)NULL)
+                {
+                    DS_AppData.WildcardTable[HashIndex] = NewLink;
+                }
+                else
+                {
+                    LinkList = DS_AppData.WildcardTable[HashIndex];
+
+                    while (LinkList->Next != (DS_HashLink_t *)NULL)
+                    {
+                        LinkList = LinkList->Next;
+                    }
+
+                    LinkList->Next = NewLink;
+                }
+            }
+
+            Subset = (Subset - FreeBits) & FreeBits;
+        } while (Subset != 0);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Compile payload predicate for filter table entry                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_TableCompilePredicate(int32 FilterIndex)
+{
+    const DS_PacketEntry_t *  PacketEntry = &DS_AppData.FilterTblPtr->Packet[FilterIndex];
+    const DS_PredicateTerm_t *Term;
+    DS_PacketPredicate_t *    Predicate = &DS_AppData.FilterPredicate[FilterIndex];
+    DS_PredicateCode_t *      Code;
+    int32                     i = 0;
+
+    memset(Predicate, 0, sizeof(DS_PacketPredicate_t));
+
+    Predicate->MatchAny = (PacketEntry->PredicateLogic == DS_PREDICATE_OR);
+
+    for (i = 0; i < DS_PREDICATE_TERMS; i++)
+    {
+        Term = &PacketEntry->Predicate[i];
+
+        /*
+        ** Skip unused terms so evaluation only visits used ones...
+        */
+        if (Term->Width == DS_UNUSED)
+        {
+            continue;
+        }
+
+        Code = &Predicate->Term[Predicate->TermCount];
+        Predicate->TermCount++;
+
+        Code->Offset = Term->Offset;
+        Code->End    = Term->Offset + Term->Width;
+        Code->Width  = Term->Width;
+        Code->Mask   = Term->Mask;
+
+        /*
+        ** Reduce each operator to a single range of masked field values...
+        */
+        switch (Term->Operator)
+        {
+            case DS_PREDICATE_EQ:
+                Code->Low = Term->Value;
+                break;
+
+            case DS_PREDICATE_NE:
+                Code->Low    = Term->Value;
+                Code->Invert = true;
+                break;
+
+            case DS_PREDICATE_LT:
+                if (Term->Value == 0)
+                {
+                    /* Never true -- outside of everything */
+                    Code->Span   = 0xFFFFFFFF;
+                    Code->Invert = true;
+                }
+                else
+                {
+                    Code->Span = Term->Value - 1;
+                }
+                break;
+
+            case DS_PREDICATE_LE:
+                Code->Span = Term->Value;
+                break;
+
+            case DS_PREDICATE_GT:
+                if (Term->Value == 0xFFFFFFFF)
+                {
+                    /* Never true -- outside of everything */
+                    Code->Span   = 0xFFFFFFFF;
+                    Code->Invert = true;
+                }
+                else
+                {
+                    Code->Low  = Term->Value + 1;
+                    Code->Span = 0xFFFFFFFF - Code->Low;
+                }
+                break;
+
+            case DS_PREDICATE_GE:
+                Code->Low  = Term->Value;
+                Code->Span = 0xFFFFFFFF - Term->Value;
+                break;
+
+            default:
+                /* Rejected by table validation -- never true */
+                Code->Span   = 0xFFFFFFFF;
+                Code->Invert = true;
+                break;
+        }
     }
 }
 
@@ -1106,6 +1805,8 @@ int32 DS_TableFindMsgID(CFE_SB_MsgId_t MessageID)
     int32             HashTableIndex   = 0;
     int32             FilterTableIndex = 0;
 
+    DS_DETAIL_PERF_ENTRY(DS_FIND_MSGID_PERF_ID);
+
     /* De-reference filter table packet array */
     FilterPackets = DS_AppData.FilterTblPtr->Packet;
 
@@ -1133,5 +1834,25 @@ int32 DS_TableFindMsgID(CFE_SB_MsgId_t MessageID)
         HashLink = HashLink->Next;
     }
 
+    /* Wildcard entries only match message ID's that no exact entry matches */
+    if (FilterTableIndex == DS_INDEX_NONE)
+    {
+        HashLink = DS_AppData.WildcardTable[HashTableIndex];
+
+        while (HashLink != (DS_HashLink_t *)NULL)
+        {
+            /* Wildcard links hold the expanded MessageID */
+            if (CFE_SB_MsgIdToValue(HashLink->MessageID) == CFE_SB_MsgIdToValue(MessageID))
+            {
+                FilterTableIndex = HashLink->Index;
+                break;
+            }
+
+            HashLink = HashLink->Next;
+        }
+    }
+
+    DS_DETAIL_PERF_EXIT(DS_FIND_MSGID_PERF_ID);
+
     return FilterTableIndex;
 }
@@ -298,9 +298,8 @@ bool DS_TableVerifyParms(uint16 Algorithm_N, uint16 Algorithm_X, uint16 Algorith
  *       Must be DS_BY_COUNT or DS_BY_TIME.
  *
  *  \par Called From:
- *       - Command handler (set filter type)
  *       - Command handler (set filename type)
- *       - Packet Filter Table entry validation function
+ *       - Packet filter type validation function
  *       - Destination File Table entry validation function
  *
  *  \par Assumptions, External Events, and Notes:
@@ -313,6 +312,257 @@ bool DS_TableVerifyParms(uint16 Algorithm_N, uint16 Algorithm_X, uint16 Algorith
  */
 bool DS_TableVerifyType(uint16 TimeVsCount);
 
+/**
+ *  \brief Verify packet filter type
+ *
+ *  \par Description
+ *       This function verifies that the indicated packet filter
+ *       table filter type is within bounds.
+ *       Must be DS_BY_COUNT, DS_BY_TIME, DS_BY_CHANGE or DS_BY_WINDOW.
+ *
+ *  \par Called From:
+ *       - Command handler (set filter type)
+ *       - Packet Filter Table entry validation function
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Filename types cannot be DS_BY_CHANGE or DS_BY_WINDOW.
+ *
+ *  \param[in] FilterType Filter Type value
+ *                        #DS_BY_COUNT, #DS_BY_TIME, #DS_BY_CHANGE or #DS_BY_WINDOW
+ *
+ *  \sa #DS_TableVerifyType, #DS_FilterParms_t
+ */
+bool DS_TableVerifyFilterType(uint16 FilterType);
+
+/**
+ *  \brief Verify filter priority
+ *
+ *  \par Description
+ *       This function verifies that the indicated packet filter
+ *       table filter priority is within bounds.
+ *       Must be DS_PRIORITY_HIGH or DS_PRIORITY_LOW.
+ *
+ *  \par Called From:
+ *       - Packet Filter Table entry validation function
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] Priority Filter Priority value
+ *                      #DS_PRIORITY_HIGH or #DS_PRIORITY_LOW
+ *
+ *  \sa #DS_FilterParms_t
+ */
+bool DS_TableVerifyPriority(uint16 Priority);
+
+/**
+ *  \brief Verify max store length
+ *
+ *  \par Description
+ *       This function verifies the packet filter table max store
+ *       length.  The value must be zero (store whole packets) or
+ *       from the telemetry header size up to #DS_TRUNCATE_MAX_LENGTH.
+ *
+ *  \par Called From:
+ *       - Packet Filter Table entry validation function
+ *       - Destination File Table entry validation function
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Unless #DS_TRUNCATE_PATCH_LENGTH is set, truncated records
+ *       have a prefix that the ring walk cannot parse, so ring
+ *       destinations only accept zero.
+ *
+ *  \param[in] MaxStoreLength Max packet bytes to store
+ *  \param[in] FileMode       Destination file mode
+ *
+ *  \sa #DS_FilterParms_t, #DS_FileTruncatePacket
+ */
+bool DS_TableVerifyStoreLength(uint16 MaxStoreLength, uint16 FileMode);
+
+/**
+ *  \brief Verify max store length of filters using a destination
+ *
+ *  \par Description
+ *       This function verifies the max store length of every filter
+ *       in the current packet filter table that stores packets in
+ *       the destination against the new destination file mode.
+ *
+ *  \par Called From:
+ *       - Destination File Table entry validation function
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Returns true when no packet filter table is loaded.
+ *
+ *  \param[in] FileTableIndex Destination file table index
+ *  \param[in] FileMode       New destination file mode
+ *
+ *  \sa #DS_TableVerifyStoreLength
+ */
+bool DS_TableVerifyDestStoreLength(uint16 FileTableIndex, uint16 FileMode);
+
+/**
+ *  \brief Verify payload predicate
+ *
+ *  \par Description
+ *       This function verifies the payload predicate of a packet
+ *       filter table entry.  The logic must be DS_PREDICATE_AND or
+ *       DS_PREDICATE_OR.  Each used term must have a width of 1, 2
+ *       or 4 bytes, a known operator, and a field that ends within
+ *       65535 bytes.  Unused terms must be all zero.
+ *
+ *  \par Called From:
+ *       - Packet Filter Table entry validation function
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] PacketEntry Pointer to packet filter table entry
+ *
+ *  \sa #DS_PredicateTerm_t, #DS_TableCompilePredicate
+ */
+bool DS_TableVerifyPredicate(const DS_PacketEntry_t *PacketEntry);
+
+/**
+ *  \brief Verify destination file mode
+ *
+ *  \par Description
+ *       This function verifies that the indicated destination file
+ *       table file mode is within bounds.
+ *       Must be DS_FILE_MODE_LINEAR or DS_FILE_MODE_RING.
+ *
+ *  \par Called From:
+ *       - Destination File Table entry validation function
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] FileMode File Mode value
+ *                      #DS_FILE_MODE_LINEAR or #DS_FILE_MODE_RING
+ *
+ *  \sa #DS_TableVerifyType, #DS_TableVerifySize, #DS_DestFileEntry_t
+ */
+bool DS_TableVerifyMode(uint16 FileMode);
+
+/**
+ *  \brief Verify destination storage budget
+ *
+ *  \par Description
+ *       This function verifies that the indicated destination file
+ *       table storage budget is either zero (no limit) or large
+ *       enough to hold at least one file of the max file size.
+ *
+ *  \par Called From:
+ *       - Destination File Table entry validation function
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] MaxStorageSize Max Storage Size value
+ *  \param[in] MaxFileSize    Max File Size value
+ *
+ *  \sa #DS_TableVerifySize, #DS_DestFileEntry_t
+ */
+bool DS_TableVerifyStorage(uint32 MaxStorageSize, uint32 MaxFileSize);
+
+/**
+ *  \brief Verify destination file compression mode
+ *
+ *  \par Description
+ *       This function verifies that the indicated destination file
+ *       table compression mode is within bounds.
+ *       Must be DS_COMPRESS_NONE or DS_COMPRESS_LZ, and LZ compression
+ *       is only allowed for linear files without a sidecar index.
+ *
+ *  \par Called From:
+ *       - Destination File Table entry validation function
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] CompressMode Compression Mode value
+ *                          #DS_COMPRESS_NONE or #DS_COMPRESS_LZ
+ *  \param[in] FileMode     File Mode value
+ *  \param[in] IndexPackets Index Packets value
+ *  \param[in] IndexSeconds Index Seconds value
+ *
+ *  \sa #DS_TableVerifyMode, #DS_DestFileEntry_t
+ */
+bool DS_TableVerifyCompress(uint16 CompressMode, uint16 FileMode, uint16 IndexPackets, uint16 IndexSeconds);
+
+/**
+ *  \brief Verify destination file size limit mode
+ *
+ *  \par Description
+ *       This function verifies that the indicated destination file
+ *       table size limit mode is within bounds.
+ *       Must be DS_SIZE_LIMIT_PHYSICAL or DS_SIZE_LIMIT_LOGICAL.
+ *
+ *  \par Called From:
+ *       - Destination File Table entry validation function
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] SizeLimitMode Size Limit Mode value
+ *                           #DS_SIZE_LIMIT_PHYSICAL or #DS_SIZE_LIMIT_LOGICAL
+ *
+ *  \sa #DS_TableVerifySize, #DS_DestFileEntry_t
+ */
+bool DS_TableVerifySizeLimit(uint16 SizeLimitMode);
+
+/**
+ *  \brief Verify destination file record mode
+ *
+ *  \par Description
+ *       This function verifies that the indicated destination file
+ *       table record mode is within bounds.
+ *       Must be DS_RECORD_FULL or DS_RECORD_DELTA, and delta records
+ *       are only allowed for linear files without a sidecar index and
+ *       with a non-zero keyframe interval.
+ *
+ *  \par Called From:
+ *       - Destination File Table entry validation function
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] RecordMode       Record Mode value
+ *                              #DS_RECORD_FULL or #DS_RECORD_DELTA
+ *  \param[in] KeyframeInterval Keyframe Interval value
+ *  \param[in] FileMode         File Mode value
+ *  \param[in] IndexPackets     Index Packets value
+ *  \param[in] IndexSeconds     Index Seconds value
+ *
+ *  \sa #DS_TableVerifyCompress, #DS_DestFileEntry_t
+ */
+bool DS_TableVerifyRecord(uint16 RecordMode, uint16 KeyframeInterval, uint16 FileMode, uint16 IndexPackets,
+                          uint16 IndexSeconds);
+
+/**
+ *  \brief Verify destination file subdirectory shard mode
+ *
+ *  \par Description
+ *       This function verifies that the indicated destination file
+ *       table shard mode is within bounds.
+ *       Must be DS_SHARD_NONE, DS_SHARD_BY_TIME or DS_SHARD_BY_COUNT,
+ *       and count shards are only allowed for count filenames with a
+ *       non-zero number of sequence counts per shard.
+ *
+ *  \par Called From:
+ *       - Destination File Table entry validation function
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       (none)
+ *
+ *  \param[in] ShardMode    Shard Mode value
+ *                          #DS_SHARD_NONE, #DS_SHARD_BY_TIME or #DS_SHARD_BY_COUNT
+ *  \param[in] ShardFiles   Shard Files value
+ *  \param[in] FileNameType Filename Type value
+ *
+ *  \sa #DS_TableVerifyType, #DS_DestFileEntry_t
+ */
+bool DS_TableVerifyShard(uint16 ShardMode, uint16 ShardFiles, uint16 FileNameType);
+
 /**
  *  \brief Verify application or destination file enable/disable state
  *
@@ -410,7 +660,8 @@ bool DS_TableVerifyCount(uint32 SequenceCount);
  *       - Packet Filter Table manage function
  *
  *  \par Assumptions, External Events, and Notes:
- *       Caller has determined that the new filter table exists.
+ *       Caller has determined that the new filter table exists and
+ *       has created its hash tables (wildcard entries are expanded).
  *
  *  \sa #DS_PacketEntry_t, #DS_FilterParms_t, #DS_TableUnsubscribe
  */
@@ -511,7 +762,8 @@ uint32 DS_TableHashFunction(CFE_SB_MsgId_t MessageID);
  *       function may translate multiple message ID's into each
  *       hash table index. Each hash table entry is a linked list
  *       containing a link for each message ID that translates to
- *       the same hash table index.
+ *       the same hash table index.  Wildcard entries are then
+ *       expanded into a second hash table of the same form.
  *
  *  \par Called From:
  *       - Filter table manage updates function (after table load)
@@ -523,6 +775,74 @@ uint32 DS_TableHashFunction(CFE_SB_MsgId_t MessageID);
  */
 void DS_TableCreateHash(void);
 
+/**
+ *  \brief Count message ID's covered by wildcard entry
+ *
+ *  \par Description
+ *       This function returns the number of message ID's that a
+ *       packet filter table entry with the given message mask
+ *       covers, which doubles for each bit of #DS_WILDCARD_MID_MASK
+ *       not set in the message mask.
+ *
+ *  \par Called From:
+ *       - Packet Filter Table validation function
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Counts too large to represent return 0xFFFFFFFF.
+ *
+ *  \param[in] MessageMask Message ID bits that must match
+ *
+ *  \return Number of message ID's (0 = exact entry)
+ *
+ *  \sa #DS_TableAddWildcard
+ */
+uint32 DS_TableWildcardCount(uint32 MessageMask);
+
+/**
+ *  \brief Add wildcard entry to wildcard hash table
+ *
+ *  \par Description
+ *       This function expands a wildcard packet filter table entry
+ *       into a wildcard hash table link for each message ID whose
+ *       masked value matches the masked entry message ID.  Message
+ *       ID's already matched by an exact entry or an earlier
+ *       wildcard entry are skipped.
+ *
+ *  \par Called From:
+ *       - Creation of Hash Table (after exact entries are added)
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Expansion stops when all #DS_WILDCARD_MIDS links are used,
+ *       which table validation prevents.
+ *
+ *  \param[in] FilterIndex Filter table index of wildcard entry
+ *
+ *  \sa #DS_TableWildcardCount, #DS_TableFindMsgID
+ */
+void DS_TableAddWildcard(int32 FilterIndex);
+
+/**
+ *  \brief Compile payload predicate
+ *
+ *  \par Description
+ *       This function compiles the payload predicate of a packet
+ *       filter table entry into the compact form evaluated for each
+ *       packet.  Unused terms are dropped and every comparison
+ *       operator is reduced to a masked range test.
+ *
+ *  \par Called From:
+ *       - Creation of Hash Table (after table load)
+ *       - Command to add a MID
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The packet filter table must be loaded and the entry validated.
+ *
+ *  \param[in] FilterIndex Filter table index of entry to compile
+ *
+ *  \sa #DS_PacketPredicate_t, #DS_IsPacketMatched
+ */
+void DS_TableCompilePredicate(int32 FilterIndex);
+
 /**
  *  \brief Adds a message ID to the hash table
  *
@@ -550,7 +870,8 @@ int32 DS_TableAddMsgID(CFE_SB_MsgId_t MessageID, int32 FilterIndex);
  *
  *  \par Description
  *       This function searches for a packet filter table entry that
- *       matches the input argument message ID.
+ *       matches the input argument message ID.  Exact entries are
+ *       searched first, then the expanded wildcard entries.
  *
  *  \par Called From:
  *       - Data storage packet processor
@@ -203,4 +203,310 @@
 #error DS_PER_PACKET_PIPE_LIMIT cannot be greater than DS_APP_PIPE_DEPTH!
 #endif
 
+#ifndef DS_RING_BUFFER_SIZE
+#error DS_RING_BUFFER_SIZE must be defined!
+#elif ((DS_RING_BUFFER_SIZE % 4) != 0)
+#error DS_RING_BUFFER_SIZE must be a multiple of 4!
+#elif (DS_RING_BUFFER_SIZE < 64)
+#error DS_RING_BUFFER_SIZE cannot be less than 64!
+#elif (DS_RING_BUFFER_SIZE > 65536)
+#error DS_RING_BUFFER_SIZE cannot be greater than 65536!
+#endif
+
+#ifndef DS_RING_WALK_RECORDS
+#error DS_RING_WALK_RECORDS must be defined!
+#elif (DS_RING_WALK_RECORDS < 1)
+#error DS_RING_WALK_RECORDS cannot be less than 1!
+#elif (DS_RING_WALK_RECORDS > 65535)
+#error DS_RING_WALK_RECORDS cannot be greater than 65535!
+#endif
+
+#ifndef DS_STORAGE_BUDGET
+#error DS_STORAGE_BUDGET must be defined!
+#endif
+
+#ifndef DS_CLOSED_FILE_HISTORY
+#error DS_CLOSED_FILE_HISTORY must be defined!
+#elif (DS_CLOSED_FILE_HISTORY < 1)
+#error DS_CLOSED_FILE_HISTORY cannot be less than 1!
+#endif
+
+#ifndef DS_INDEX_FILE_EXTENSION
+#error DS_INDEX_FILE_EXTENSION must be defined!
+#endif
+
+#ifndef DS_INDEX_BUFFER_RECORDS
+#error DS_INDEX_BUFFER_RECORDS must be defined!
+#elif (DS_INDEX_BUFFER_RECORDS < 1)
+#error DS_INDEX_BUFFER_RECORDS cannot be less than 1!
+#endif
+
+#ifndef DS_FILE_TRAILER_ENTRIES
+#error DS_FILE_TRAILER_ENTRIES must be defined!
+#elif (DS_FILE_TRAILER_ENTRIES < 1)
+#error DS_FILE_TRAILER_ENTRIES cannot be less than 1!
+#endif
+
+#ifndef DS_PREDICATE_TERMS
+#error DS_PREDICATE_TERMS must be defined!
+#elif (DS_PREDICATE_TERMS < 1)
+#error DS_PREDICATE_TERMS cannot be less than 1!
+#elif (DS_PREDICATE_TERMS > 255)
+#error DS_PREDICATE_TERMS cannot be greater than 255!
+#endif
+
+#ifndef DS_EXTRACT_MID_CNT
+#error DS_EXTRACT_MID_CNT must be defined!
+#elif (DS_EXTRACT_MID_CNT < 1)
+#error DS_EXTRACT_MID_CNT cannot be less than 1!
+#endif
+
+#ifndef DS_STATS_HISTOGRAM_BINS
+#error DS_STATS_HISTOGRAM_BINS must be defined!
+#elif (DS_STATS_HISTOGRAM_BINS < 2)
+#error DS_STATS_HISTOGRAM_BINS cannot be less than 2!
+#elif (DS_STATS_HISTOGRAM_BINS > 32)
+#error DS_STATS_HISTOGRAM_BINS cannot be greater than 32!
+#endif
+
+#ifndef DS_EXTRACT_TASK_NAME
+#error DS_EXTRACT_TASK_NAME must be defined!
+#endif
+
+#ifndef DS_EXTRACT_TASK_STACK_SIZE
+#error DS_EXTRACT_TASK_STACK_SIZE must be defined!
+#elif (DS_EXTRACT_TASK_STACK_SIZE < 1)
+#error DS_EXTRACT_TASK_STACK_SIZE cannot be less than 1!
+#endif
+
+#ifndef DS_EXTRACT_TASK_PRIORITY
+#error DS_EXTRACT_TASK_PRIORITY must be defined!
+#elif (DS_EXTRACT_TASK_PRIORITY < 1)
+#error DS_EXTRACT_TASK_PRIORITY cannot be less than 1!
+#elif (DS_EXTRACT_TASK_PRIORITY > 255)
+#error DS_EXTRACT_TASK_PRIORITY cannot be greater than 255!
+#endif
+
+#ifndef DS_EXTRACT_BUFFER_SIZE
+#error DS_EXTRACT_BUFFER_SIZE must be defined!
+#elif ((DS_EXTRACT_BUFFER_SIZE % 4) != 0)
+#error DS_EXTRACT_BUFFER_SIZE must be a multiple of 4!
+#elif (DS_EXTRACT_BUFFER_SIZE < 1024)
+#error DS_EXTRACT_BUFFER_SIZE cannot be less than 1024!
+#endif
+
+#ifndef DS_REPLAY_TASK_NAME
+#error DS_REPLAY_TASK_NAME must be defined!
+#endif
+
+#ifndef DS_REPLAY_TASK_STACK_SIZE
+#error DS_REPLAY_TASK_STACK_SIZE must be defined!
+#elif (DS_REPLAY_TASK_STACK_SIZE < 1)
+#error DS_REPLAY_TASK_STACK_SIZE cannot be less than 1!
+#endif
+
+#ifndef DS_REPLAY_TASK_PRIORITY
+#error DS_REPLAY_TASK_PRIORITY must be defined!
+#elif (DS_REPLAY_TASK_PRIORITY < 1)
+#error DS_REPLAY_TASK_PRIORITY cannot be less than 1!
+#elif (DS_REPLAY_TASK_PRIORITY > 255)
+#error DS_REPLAY_TASK_PRIORITY cannot be greater than 255!
+#endif
+
+#ifndef DS_REPLAY_BUFFER_SIZE
+#error DS_REPLAY_BUFFER_SIZE must be defined!
+#elif ((DS_REPLAY_BUFFER_SIZE % 4) != 0)
+#error DS_REPLAY_BUFFER_SIZE must be a multiple of 4!
+#elif (DS_REPLAY_BUFFER_SIZE < 1024)
+#error DS_REPLAY_BUFFER_SIZE cannot be less than 1024!
+#endif
+
+#ifndef DS_REPLAY_MAX_RATE
+#error DS_REPLAY_MAX_RATE must be defined!
+#elif (DS_REPLAY_MAX_RATE < 1)
+#error DS_REPLAY_MAX_RATE cannot be less than 1!
+#elif (DS_REPLAY_MAX_RATE > 65535)
+#error DS_REPLAY_MAX_RATE cannot be greater than 65535!
+#endif
+
+#ifndef DS_REPLAY_MAX_DELAY
+#error DS_REPLAY_MAX_DELAY must be defined!
+#elif (DS_REPLAY_MAX_DELAY < 1)
+#error DS_REPLAY_MAX_DELAY cannot be less than 1!
+#endif
+
+#ifndef DS_REPLAY_BURST_LIMIT
+#error DS_REPLAY_BURST_LIMIT must be defined!
+#elif (DS_REPLAY_BURST_LIMIT < 1)
+#error DS_REPLAY_BURST_LIMIT cannot be less than 1!
+#endif
+
+#ifndef DS_REPLAY_POLL_DELAY
+#error DS_REPLAY_POLL_DELAY must be defined!
+#elif (DS_REPLAY_POLL_DELAY < 1)
+#error DS_REPLAY_POLL_DELAY cannot be less than 1!
+#endif
+
+#ifndef DS_ECHO_DEPTH
+#error DS_ECHO_DEPTH must be defined!
+#elif (DS_ECHO_DEPTH < 1)
+#error DS_ECHO_DEPTH cannot be less than 1!
+#elif (DS_ECHO_DEPTH > 1024)
+#error DS_ECHO_DEPTH cannot be greater than 1024!
+#endif
+
+#ifndef DS_ECHO_TIMEOUT
+#error DS_ECHO_TIMEOUT must be defined!
+#elif (DS_ECHO_TIMEOUT < 1)
+#error DS_ECHO_TIMEOUT cannot be less than 1!
+#elif (DS_ECHO_TIMEOUT > 3600)
+#error DS_ECHO_TIMEOUT cannot be greater than 3600!
+#endif
+
+#ifndef DS_COMPRESS_BLOCK_SIZE
+#error DS_COMPRESS_BLOCK_SIZE must be defined!
+#elif ((DS_COMPRESS_BLOCK_SIZE % 4) != 0)
+#error DS_COMPRESS_BLOCK_SIZE must be a multiple of 4!
+#elif (DS_COMPRESS_BLOCK_SIZE < 256)
+#error DS_COMPRESS_BLOCK_SIZE cannot be less than 256!
+#elif (DS_COMPRESS_BLOCK_SIZE > 65532)
+#error DS_COMPRESS_BLOCK_SIZE cannot be greater than 65532!
+#endif
+
+#ifndef DS_COMPRESS_HASH_BITS
+#error DS_COMPRESS_HASH_BITS must be defined!
+#elif (DS_COMPRESS_HASH_BITS < 8)
+#error DS_COMPRESS_HASH_BITS cannot be less than 8!
+#elif (DS_COMPRESS_HASH_BITS > 16)
+#error DS_COMPRESS_HASH_BITS cannot be greater than 16!
+#endif
+
+#ifndef DS_RECORD_REFERENCES
+#error DS_RECORD_REFERENCES must be defined!
+#elif (DS_RECORD_REFERENCES < 1)
+#error DS_RECORD_REFERENCES cannot be less than 1!
+#elif (DS_RECORD_REFERENCES > 255)
+#error DS_RECORD_REFERENCES cannot be greater than 255!
+#endif
+
+#ifndef DS_RECORD_BUFFER_SIZE
+#error DS_RECORD_BUFFER_SIZE must be defined!
+#elif ((DS_RECORD_BUFFER_SIZE % 4) != 0)
+#error DS_RECORD_BUFFER_SIZE must be a multiple of 4!
+#elif (DS_RECORD_BUFFER_SIZE < 64)
+#error DS_RECORD_BUFFER_SIZE cannot be less than 64!
+#endif
+
+#ifndef DS_DECIMATION_LEVELS
+#error DS_DECIMATION_LEVELS must be defined!
+#elif (DS_DECIMATION_LEVELS < 0)
+#error DS_DECIMATION_LEVELS cannot be less than 0!
+#elif (DS_DECIMATION_LEVELS > 8)
+#error DS_DECIMATION_LEVELS cannot be greater than 8!
+#endif
+
+#ifndef DS_DECIMATION_THRESHOLD
+#error DS_DECIMATION_THRESHOLD must be defined!
+#elif (DS_DECIMATION_THRESHOLD < 1)
+#error DS_DECIMATION_THRESHOLD cannot be less than 1!
+#elif (DS_DECIMATION_THRESHOLD > 100)
+#error DS_DECIMATION_THRESHOLD cannot be greater than 100!
+#endif
+
+#ifndef DS_WILDCARD_MIDS
+#error DS_WILDCARD_MIDS must be defined!
+#elif (DS_WILDCARD_MIDS < 1)
+#error DS_WILDCARD_MIDS cannot be less than 1!
+#elif (DS_WILDCARD_MIDS > 65535)
+#error DS_WILDCARD_MIDS cannot be greater than 65535!
+#endif
+
+#ifndef DS_WILDCARD_MID_MASK
+#error DS_WILDCARD_MID_MASK must be defined!
+#elif (DS_WILDCARD_MID_MASK == 0)
+#error DS_WILDCARD_MID_MASK cannot be zero!
+#endif
+
+#ifndef DS_TRUNCATE_MAX_LENGTH
+#error DS_TRUNCATE_MAX_LENGTH must be defined!
+#elif ((DS_TRUNCATE_MAX_LENGTH % 4) != 0)
+#error DS_TRUNCATE_MAX_LENGTH must be a multiple of 4!
+#elif (DS_TRUNCATE_MAX_LENGTH < 64)
+#error DS_TRUNCATE_MAX_LENGTH cannot be less than 64!
+#elif (DS_TRUNCATE_MAX_LENGTH > 65532)
+#error DS_TRUNCATE_MAX_LENGTH cannot be greater than 65532!
+#endif
+
+#ifndef DS_TRUNCATE_PATCH_LENGTH
+#error DS_TRUNCATE_PATCH_LENGTH must be defined!
+#elif ((DS_TRUNCATE_PATCH_LENGTH != 0) && (DS_TRUNCATE_PATCH_LENGTH != 1))
+#error DS_TRUNCATE_PATCH_LENGTH must be 0 or 1!
+#endif
+
+#ifndef DS_DEST_STATS_HK_CYCLES
+#error DS_DEST_STATS_HK_CYCLES must be defined!
+#elif ((DS_DEST_STATS_HK_CYCLES < 0) || (DS_DEST_STATS_HK_CYCLES > 65535))
+#error DS_DEST_STATS_HK_CYCLES must be between 0 and 65535!
+#endif
+
+#ifndef DS_DETAIL_PERF_LOG
+#error DS_DETAIL_PERF_LOG must be defined!
+#elif ((DS_DETAIL_PERF_LOG != 0) && (DS_DETAIL_PERF_LOG != 1))
+#error DS_DETAIL_PERF_LOG must be 0 or 1!
+#endif
+
+#ifndef DS_STATS_TIMING
+#error DS_STATS_TIMING must be defined!
+#elif ((DS_STATS_TIMING != 0) && (DS_STATS_TIMING != 1))
+#error DS_STATS_TIMING must be 0 or 1!
+#endif
+
+#ifndef DS_RECORDER_CNT
+#error DS_RECORDER_CNT must be defined!
+#elif (DS_RECORDER_CNT < 1)
+#error DS_RECORDER_CNT cannot be less than 1!
+#elif (DS_RECORDER_CNT > DS_DEST_FILE_CNT)
+#error DS_RECORDER_CNT cannot be greater than DS_DEST_FILE_CNT!
+#endif
+
+#ifndef DS_RECORDER_BUFFER_SIZE
+#error DS_RECORDER_BUFFER_SIZE must be defined!
+#elif ((DS_RECORDER_BUFFER_SIZE % 4) != 0)
+#error DS_RECORDER_BUFFER_SIZE must be a multiple of 4!
+#elif (DS_RECORDER_BUFFER_SIZE < 1024)
+#error DS_RECORDER_BUFFER_SIZE cannot be less than 1024!
+#elif (DS_RECORDER_BUFFER_SIZE > 16777216)
+#error DS_RECORDER_BUFFER_SIZE cannot be greater than 16777216!
+#endif
+
+#ifndef DS_RECORDER_DRAIN_PACKETS
+#error DS_RECORDER_DRAIN_PACKETS must be defined!
+#elif (DS_RECORDER_DRAIN_PACKETS < 1)
+#error DS_RECORDER_DRAIN_PACKETS cannot be less than 1!
+#elif (DS_RECORDER_DRAIN_PACKETS > 65535)
+#error DS_RECORDER_DRAIN_PACKETS cannot be greater than 65535!
+#endif
+
+#ifndef DS_CACHE_ENTRIES
+#error DS_CACHE_ENTRIES must be defined!
+#elif (DS_CACHE_ENTRIES < 0)
+#error DS_CACHE_ENTRIES cannot be less than 0!
+#elif (DS_CACHE_ENTRIES > 65535)
+#error DS_CACHE_ENTRIES cannot be greater than 65535!
+#endif
+
+#ifndef DS_CACHE_ENTRY_SIZE
+#error DS_CACHE_ENTRY_SIZE must be defined!
+#elif ((DS_CACHE_ENTRY_SIZE % 4) != 0)
+#error DS_CACHE_ENTRY_SIZE must be a multiple of 4!
+#elif (DS_CACHE_ENTRY_SIZE < 64)
+#error DS_CACHE_ENTRY_SIZE cannot be less than 64!
+#elif (DS_CACHE_ENTRY_SIZE > 65536)
+#error DS_CACHE_ENTRY_SIZE cannot be greater than 65536!
+#endif
+
+#ifndef DS_MANIFEST_FILE_NAME
+#error DS_MANIFEST_FILE_NAME must be defined!
+#endif
+
 #endif
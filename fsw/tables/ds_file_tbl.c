@@ -83,6 +83,20 @@ DS_DestFileTable_t DS_DestFileTable = {
             /* .MaxFileSize   = */ (1024 * 32), /* 32 K-bytes */
             /* .MaxFileAge    = */ (60 * 45),   /* 45 minutes */
             /* .SequenceCount = */ 1000,
+            /* .FileMode      = */ DS_FILE_MODE_LINEAR,
+            /* .StoragePriority = */ 0,
+            /* .MaxStorageSize  = */ 0,
+            /* .IndexPackets  = */ 0,
+            /* .IndexSeconds  = */ 0,
+            /* .TrailerState  = */ DS_DISABLED,
+            /* .CompressMode  = */ DS_COMPRESS_NONE,
+            /* .SizeLimitMode = */ DS_SIZE_LIMIT_PHYSICAL,
+            /* .RecordMode    = */ DS_RECORD_FULL,
+            /* .KeyframeInterval = */ 0,
+            /* .RatePackets   = */ 0,
+            /* .RateBytes     = */ 0,
+            /* .ShardMode     = */ DS_SHARD_NONE,
+            /* .ShardFiles    = */ 0,
         },
         /* File Index 01 -- application housekeeping packets */
         {
@@ -96,6 +110,20 @@ DS_DestFileTable_t DS_DestFileTable = {
             /* .MaxFileSize   = */ (1024 * 1024 * 2), /* 2 M-bytes */
             /* .MaxFileAge    = */ (60 * 60 * 2),     /* 2 hours */
             /* .SequenceCount = */ DS_UNUSED,
+            /* .FileMode      = */ DS_FILE_MODE_LINEAR,
+            /* .StoragePriority = */ 0,
+            /* .MaxStorageSize  = */ 0,
+            /* .IndexPackets  = */ 0,
+            /* .IndexSeconds  = */ 0,
+            /* .TrailerState  = */ DS_DISABLED,
+            /* .CompressMode  = */ DS_COMPRESS_NONE,
+            /* .SizeLimitMode = */ DS_SIZE_LIMIT_PHYSICAL,
+            /* .RecordMode    = */ DS_RECORD_FULL,
+            /* .KeyframeInterval = */ 0,
+            /* .RatePackets   = */ 0,
+            /* .RateBytes     = */ 0,
+            /* .ShardMode     = */ DS_SHARD_NONE,
+            /* .ShardFiles    = */ 0,
         },
         /* File Index 02 -- application telemetry packets */
         {
@@ -109,6 +137,20 @@ DS_DestFileTable_t DS_DestFileTable = {
             /* .MaxFileSize   = */ (1024 * 1024 * 1024 * 1), /* 1 G-byte */
             /* .MaxFileAge    = */ (60 * 60 * 2),            /* 2 hours */
             /* .SequenceCount = */ 2000,
+            /* .FileMode      = */ DS_FILE_MODE_LINEAR,
+            /* .StoragePriority = */ 0,
+            /* .MaxStorageSize  = */ 0,
+            /* .IndexPackets  = */ 0,
+            /* .IndexSeconds  = */ 0,
+            /* .TrailerState  = */ DS_DISABLED,
+            /* .CompressMode  = */ DS_COMPRESS_NONE,
+            /* .SizeLimitMode = */ DS_SIZE_LIMIT_PHYSICAL,
+            /* .RecordMode    = */ DS_RECORD_FULL,
+            /* .KeyframeInterval = */ 0,
+            /* .RatePackets   = */ 0,
+            /* .RateBytes     = */ 0,
+            /* .ShardMode     = */ DS_SHARD_NONE,
+            /* .ShardFiles    = */ 0,
         },
         /* File Index 03 -- hardware telemetry packets */
         {
@@ -122,6 +164,20 @@ DS_DestFileTable_t DS_DestFileTable = {
             /* .MaxFileSize   = */ (1024 * 1024 * 2), /* 2 M-bytes */
             /* .MaxFileAge    = */ (60 * 60 * 2),     /* 2 hours */
             /* .SequenceCount = */ 3000,
+            /* .FileMode      = */ DS_FILE_MODE_LINEAR,
+            /* .StoragePriority = */ 0,
+            /* .MaxStorageSize  = */ 0,
+            /* .IndexPackets  = */ 0,
+            /* .IndexSeconds  = */ 0,
+            /* .TrailerState  = */ DS_DISABLED,
+            /* .CompressMode  = */ DS_COMPRESS_NONE,
+            /* .SizeLimitMode = */ DS_SIZE_LIMIT_PHYSICAL,
+            /* .RecordMode    = */ DS_RECORD_FULL,
+            /* .KeyframeInterval = */ 0,
+            /* .RatePackets   = */ 0,
+            /* .RateBytes     = */ 0,
+            /* .ShardMode     = */ DS_SHARD_NONE,
+            /* .ShardFiles    = */ 0,
         },
         /* File Index 04 -- cFE housekeeping packets */
         {
@@ -135,6 +191,20 @@ DS_DestFileTable_t DS_DestFileTable = {
             /* .MaxFileSize   = */ (1024 * 1024 * 2), /* 2 M-bytes */
             /* .MaxFileAge    = */ (60 * 60 * 2),     /* 2 hours */
             /* .SequenceCount = */ 4000,
+            /* .FileMode      = */ DS_FILE_MODE_LINEAR,
+            /* .StoragePriority = */ 0,
+            /* .MaxStorageSize  = */ 0,
+            /* .IndexPackets  = */ 0,
+            /* .IndexSeconds  = */ 0,
+            /* .TrailerState  = */ DS_DISABLED,
+            /* .CompressMode  = */ DS_COMPRESS_NONE,
+            /* .SizeLimitMode = */ DS_SIZE_LIMIT_PHYSICAL,
+            /* .RecordMode    = */ DS_RECORD_FULL,
+            /* .KeyframeInterval = */ 0,
+            /* .RatePackets   = */ 0,
+            /* .RateBytes     = */ 0,
+            /* .ShardMode     = */ DS_SHARD_NONE,
+            /* .ShardFiles    = */ 0,
         },
         /* File Index 05 -- cFE telemetry packets */
         {
@@ -148,6 +218,20 @@ DS_DestFileTable_t DS_DestFileTable = {
             /* .MaxFileSize   = */ (1024 * 1024 * 2), /* 2 M-bytes */
             /* .MaxFileAge    = */ (60 * 60 * 2),     /* 2 hours */
             /* .SequenceCount = */ 5000,
+            /* .FileMode      = */ DS_FILE_MODE_LINEAR,
+            /* .StoragePriority = */ 0,
+            /* .MaxStorageSize  = */ 0,
+            /* .IndexPackets  = */ 0,
+            /* .IndexSeconds  = */ 0,
+            /* .TrailerState  = */ DS_DISABLED,
+            /* .CompressMode  = */ DS_COMPRESS_NONE,
+            /* .SizeLimitMode = */ DS_SIZE_LIMIT_PHYSICAL,
+            /* .RecordMode    = */ DS_RECORD_FULL,
+            /* .KeyframeInterval = */ 0,
+            /* .RatePackets   = */ 0,
+            /* .RateBytes     = */ 0,
+            /* .ShardMode     = */ DS_SHARD_NONE,
+            /* .ShardFiles    = */ 0,
         },
         /* File Index 06 */
         {
@@ -161,6 +245,20 @@ DS_DestFileTable_t DS_DestFileTable = {
             /* .MaxFileSize   = */ DS_UNUSED,
             /* .MaxFileAge    = */ DS_UNUSED,
             /* .SequenceCount = */ DS_UNUSED,
+            /* .FileMode      = */ DS_UNUSED,
+            /* .StoragePriority = */ DS_UNUSED,
+            /* .MaxStorageSize  = */ DS_UNUSED,
+            /* .IndexPackets  = */ DS_UNUSED,
+            /* .IndexSeconds  = */ DS_UNUSED,
+            /* .TrailerState  = */ DS_UNUSED,
+            /* .CompressMode  = */ DS_UNUSED,
+            /* .SizeLimitMode = */ DS_UNUSED,
+            /* .RecordMode    = */ DS_UNUSED,
+            /* .KeyframeInterval = */ DS_UNUSED,
+            /* .RatePackets   = */ DS_UNUSED,
+            /* .RateBytes     = */ DS_UNUSED,
+            /* .ShardMode     = */ DS_UNUSED,
+            /* .ShardFiles    = */ DS_UNUSED,
         },
         /* File Index 07 */
         {
@@ -174,6 +272,20 @@ DS_DestFileTable_t DS_DestFileTable = {
             /* .MaxFileSize   = */ DS_UNUSED,
             /* .MaxFileAge    = */ DS_UNUSED,
             /* .SequenceCount = */ DS_UNUSED,
+            /* .FileMode      = */ DS_UNUSED,
+            /* .StoragePriority = */ DS_UNUSED,
+            /* .MaxStorageSize  = */ DS_UNUSED,
+            /* .IndexPackets  = */ DS_UNUSED,
+            /* .IndexSeconds  = */ DS_UNUSED,
+            /* .TrailerState  = */ DS_UNUSED,
+            /* .CompressMode  = */ DS_UNUSED,
+            /* .SizeLimitMode = */ DS_UNUSED,
+            /* .RecordMode    = */ DS_UNUSED,
+            /* .KeyframeInterval = */ DS_UNUSED,
+            /* .RatePackets   = */ DS_UNUSED,
+            /* .RateBytes     = */ DS_UNUSED,
+            /* .ShardMode     = */ DS_UNUSED,
+            /* .ShardFiles    = */ DS_UNUSED,
         },
         /* File Index 08 */
         {
@@ -187,6 +299,20 @@ DS_DestFileTable_t DS_DestFileTable = {
             /* .MaxFileSize   = */ DS_UNUSED,
             /* .MaxFileAge    = */ DS_UNUSED,
             /* .SequenceCount = */ DS_UNUSED,
+            /* .FileMode      = */ DS_UNUSED,
+            /* .StoragePriority = */ DS_UNUSED,
+            /* .MaxStorageSize  = */ DS_UNUSED,
+            /* .IndexPackets  = */ DS_UNUSED,
+            /* .IndexSeconds  = */ DS_UNUSED,
+            /* .TrailerState  = */ DS_UNUSED,
+            /* .CompressMode  = */ DS_UNUSED,
+            /* .SizeLimitMode = */ DS_UNUSED,
+            /* .RecordMode    = */ DS_UNUSED,
+            /* .KeyframeInterval = */ DS_UNUSED,
+            /* .RatePackets   = */ DS_UNUSED,
+            /* .RateBytes     = */ DS_UNUSED,
+            /* .ShardMode     = */ DS_UNUSED,
+            /* .ShardFiles    = */ DS_UNUSED,
         },
         /* File Index 09 */
         {
@@ -200,6 +326,20 @@ DS_DestFileTable_t DS_DestFileTable = {
             /* .MaxFileSize   = */ DS_UNUSED,
             /* .MaxFileAge    = */ DS_UNUSED,
             /* .SequenceCount = */ DS_UNUSED,
+            /* .FileMode      = */ DS_UNUSED,
+            /* .StoragePriority = */ DS_UNUSED,
+            /* .MaxStorageSize  = */ DS_UNUSED,
+            /* .IndexPackets  = */ DS_UNUSED,
+            /* .IndexSeconds  = */ DS_UNUSED,
+            /* .TrailerState  = */ DS_UNUSED,
+            /* .CompressMode  = */ DS_UNUSED,
+            /* .SizeLimitMode = */ DS_UNUSED,
+            /* .RecordMode    = */ DS_UNUSED,
+            /* .KeyframeInterval = */ DS_UNUSED,
+            /* .RatePackets   = */ DS_UNUSED,
+            /* .RateBytes     = */ DS_UNUSED,
+            /* .ShardMode     = */ DS_UNUSED,
+            /* .ShardFiles    = */ DS_UNUSED,
         },
         /* File Index 10 */
         {
@@ -213,6 +353,20 @@ DS_DestFileTable_t DS_DestFileTable = {
             /* .MaxFileSize   = */ DS_UNUSED,
             /* .MaxFileAge    = */ DS_UNUSED,
             /* .SequenceCount = */ DS_UNUSED,
+            /* .FileMode      = */ DS_UNUSED,
+            /* .StoragePriority = */ DS_UNUSED,
+            /* .MaxStorageSize  = */ DS_UNUSED,
+            /* .IndexPackets  = */ DS_UNUSED,
+            /* .IndexSeconds  = */ DS_UNUSED,
+            /* .TrailerState  = */ DS_UNUSED,
+            /* .CompressMode  = */ DS_UNUSED,
+            /* .SizeLimitMode = */ DS_UNUSED,
+            /* .RecordMode    = */ DS_UNUSED,
+            /* .KeyframeInterval = */ DS_UNUSED,
+            /* .RatePackets   = */ DS_UNUSED,
+            /* .RateBytes     = */ DS_UNUSED,
+            /* .ShardMode     = */ DS_UNUSED,
+            /* .ShardFiles    = */ DS_UNUSED,
         },
         /* File Index 11 */
         {
@@ -226,6 +380,20 @@ DS_DestFileTable_t DS_DestFileTable = {
             /* .MaxFileSize   = */ DS_UNUSED,
             /* .MaxFileAge    = */ DS_UNUSED,
             /* .SequenceCount = */ DS_UNUSED,
+            /* .FileMode      = */ DS_UNUSED,
+            /* .StoragePriority = */ DS_UNUSED,
+            /* .MaxStorageSize  = */ DS_UNUSED,
+            /* .IndexPackets  = */ DS_UNUSED,
+            /* .IndexSeconds  = */ DS_UNUSED,
+            /* .TrailerState  = */ DS_UNUSED,
+            /* .CompressMode  = */ DS_UNUSED,
+            /* .SizeLimitMode = */ DS_UNUSED,
+            /* .RecordMode    = */ DS_UNUSED,
+            /* .KeyframeInterval = */ DS_UNUSED,
+            /* .RatePackets   = */ DS_UNUSED,
+            /* .RateBytes     = */ DS_UNUSED,
+            /* .ShardMode     = */ DS_UNUSED,
+            /* .ShardFiles    = */ DS_UNUSED,
         },
         /* File Index 12 */
         {
@@ -239,6 +407,20 @@ DS_DestFileTable_t DS_DestFileTable = {
             /* .MaxFileSize   = */ DS_UNUSED,
             /* .MaxFileAge    = */ DS_UNUSED,
             /* .SequenceCount = */ DS_UNUSED,
+            /* .FileMode      = */ DS_UNUSED,
+            /* .StoragePriority = */ DS_UNUSED,
+            /* .MaxStorageSize  = */ DS_UNUSED,
+            /* .IndexPackets  = */ DS_UNUSED,
+            /* .IndexSeconds  = */ DS_UNUSED,
+            /* .TrailerState  = */ DS_UNUSED,
+            /* .CompressMode  = */ DS_UNUSED,
+            /* .SizeLimitMode = */ DS_UNUSED,
+            /* .RecordMode    = */ DS_UNUSED,
+            /* .KeyframeInterval = */ DS_UNUSED,
+            /* .RatePackets   = */ DS_UNUSED,
+            /* .RateBytes     = */ DS_UNUSED,
+            /* .ShardMode     = */ DS_UNUSED,
+            /* .ShardFiles    = */ DS_UNUSED,
         },
         /* File Index 13 */
         {
@@ -252,6 +434,20 @@ DS_DestFileTable_t DS_DestFileTable = {
             /* .MaxFileSize   = */ DS_UNUSED,
             /* .MaxFileAge    = */ DS_UNUSED,
             /* .SequenceCount = */ DS_UNUSED,
+            /* .FileMode      = */ DS_UNUSED,
+            /* .StoragePriority = */ DS_UNUSED,
+            /* .MaxStorageSize  = */ DS_UNUSED,
+            /* .IndexPackets  = */ DS_UNUSED,
+            /* .IndexSeconds  = */ DS_UNUSED,
+            /* .TrailerState  = */ DS_UNUSED,
+            /* .CompressMode  = */ DS_UNUSED,
+            /* .SizeLimitMode = */ DS_UNUSED,
+            /* .RecordMode    = */ DS_UNUSED,
+            /* .KeyframeInterval = */ DS_UNUSED,
+            /* .RatePackets   = */ DS_UNUSED,
+            /* .RateBytes     = */ DS_UNUSED,
+            /* .ShardMode     = */ DS_UNUSED,
+            /* .ShardFiles    = */ DS_UNUSED,
         },
         /* File Index 14 */
         {
@@ -265,6 +461,20 @@ DS_DestFileTable_t DS_DestFileTable = {
             /* .MaxFileSize   = */ DS_UNUSED,
             /* .MaxFileAge    = */ DS_UNUSED,
             /* .SequenceCount = */ DS_UNUSED,
+            /* .FileMode      = */ DS_UNUSED,
+            /* .StoragePriority = */ DS_UNUSED,
+            /* .MaxStorageSize  = */ DS_UNUSED,
+            /* .IndexPackets  = */ DS_UNUSED,
+            /* .IndexSeconds  = */ DS_UNUSED,
+            /* .TrailerState  = */ DS_UNUSED,
+            /* .CompressMode  = */ DS_UNUSED,
+            /* .SizeLimitMode = */ DS_UNUSED,
+            /* .RecordMode    = */ DS_UNUSED,
+            /* .KeyframeInterval = */ DS_UNUSED,
+            /* .RatePackets   = */ DS_UNUSED,
+            /* .RateBytes     = */ DS_UNUSED,
+            /* .ShardMode     = */ DS_UNUSED,
+            /* .ShardFiles    = */ DS_UNUSED,
         },
         /* File Index 15 */
         {
@@ -278,6 +488,20 @@ DS_DestFileTable_t DS_DestFileTable = {
             /* .MaxFileSize   = */ DS_UNUSED,
             /* .MaxFileAge    = */ DS_UNUSED,
             /* .SequenceCount = */ DS_UNUSED,
+            /* .FileMode      = */ DS_UNUSED,
+            /* .StoragePriority = */ DS_UNUSED,
+            /* .MaxStorageSize  = */ DS_UNUSED,
+            /* .IndexPackets  = */ DS_UNUSED,
+            /* .IndexSeconds  = */ DS_UNUSED,
+            /* .TrailerState  = */ DS_UNUSED,
+            /* .CompressMode  = */ DS_UNUSED,
+            /* .SizeLimitMode = */ DS_UNUSED,
+            /* .RecordMode    = */ DS_UNUSED,
+            /* .KeyframeInterval = */ DS_UNUSED,
+            /* .RatePackets   = */ DS_UNUSED,
+            /* .RateBytes     = */ DS_UNUSED,
+            /* .ShardMode     = */ DS_UNUSED,
+            /* .ShardFiles    = */ DS_UNUSED,
         },
     }};
 
@@ -0,0 +1,47 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  The DS Load Generator (DS_LG) event id header file
+ */
+#ifndef DS_LG_EVENTIDS_H
+#define DS_LG_EVENTIDS_H
+
+/**
+ * \defgroup cfsdslgevents DS Load Generator Event IDs
+ * \{
+ */
+
+#define DS_LG_INIT_INF_EID       1  /**< \brief Application initialized (INFORMATION) */
+#define DS_LG_INIT_ERR_EID       2  /**< \brief cFE initialization error (ERROR) */
+#define DS_LG_EXIT_ERR_EID       3  /**< \brief Application terminating (CRITICAL) */
+#define DS_LG_MID_ERR_EID        4  /**< \brief Unexpected message ID (ERROR) */
+#define DS_LG_CC_ERR_EID         5  /**< \brief Invalid command code (ERROR) */
+#define DS_LG_LEN_ERR_EID        6  /**< \brief Invalid command length (ERROR) */
+#define DS_LG_NOOP_INF_EID       7  /**< \brief No-op command (INFORMATION) */
+#define DS_LG_RESET_INF_EID      8  /**< \brief Reset counters command (DEBUG) */
+#define DS_LG_SET_STREAM_EID     9  /**< \brief Set stream profile command (INFORMATION) */
+#define DS_LG_SET_STREAM_ERR_EID 10 /**< \brief Invalid stream profile (ERROR) */
+#define DS_LG_START_INF_EID      11 /**< \brief Start command (INFORMATION) */
+#define DS_LG_STOP_INF_EID       12 /**< \brief Stop command (INFORMATION) */
+#define DS_LG_INDEX_ERR_EID      13 /**< \brief Invalid stream index (ERROR) */
+
+/**\}*/
+
+#endif
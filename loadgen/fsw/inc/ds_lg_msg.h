@@ -0,0 +1,243 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   The DS Load Generator (DS_LG) command and telemetry messages
+ *
+ * @note
+ *   DS_LG is a test companion for the Data Storage application.  It
+ *   publishes synthetic packets on the Software Bus so that DS throughput
+ *   and drop behavior can be characterized on a host cFS build.  The
+ *   defaults below may be overridden by defining them before this header
+ *   is included.
+ */
+#ifndef DS_LG_MSG_H
+#define DS_LG_MSG_H
+
+#include "cfe.h"
+#include "cfe_core_api_base_msgids.h"
+#include "cfe_msg_hdr.h"
+
+/**
+ * \defgroup cfsdslgcfg DS Load Generator Configuration
+ * \{
+ */
+
+#ifndef DS_LG_CMD_TOPICID
+#define DS_LG_CMD_TOPICID 0xC4 /**< \brief Command topic ID */
+#endif
+
+#ifndef DS_LG_SEND_HK_TOPICID
+#define DS_LG_SEND_HK_TOPICID 0xC5 /**< \brief Housekeeping request topic ID */
+#endif
+
+#ifndef DS_LG_HK_TLM_TOPICID
+#define DS_LG_HK_TLM_TOPICID 0xC6 /**< \brief Housekeeping telemetry topic ID */
+#endif
+
+#define DS_LG_CMD_MID     CFE_PLATFORM_CMD_TOPICID_TO_MIDV(DS_LG_CMD_TOPICID)     /**< \brief Command MID */
+#define DS_LG_SEND_HK_MID CFE_PLATFORM_CMD_TOPICID_TO_MIDV(DS_LG_SEND_HK_TOPICID) /**< \brief HK request MID */
+#define DS_LG_HK_TLM_MID  CFE_PLATFORM_TLM_TOPICID_TO_MIDV(DS_LG_HK_TLM_TOPICID)  /**< \brief HK telemetry MID */
+
+/**
+ *  \brief Number of generated packet streams
+ */
+#ifndef DS_LG_MAX_STREAMS
+#define DS_LG_MAX_STREAMS 8
+#endif
+
+/**
+ *  \brief Largest generated packet rate (packets per second per stream)
+ */
+#ifndef DS_LG_MAX_PACKET_RATE
+#define DS_LG_MAX_PACKET_RATE 100000
+#endif
+
+/**
+ *  \brief Largest generated packet size (bytes, including the header)
+ */
+#ifndef DS_LG_MAX_PACKET_SIZE
+#define DS_LG_MAX_PACKET_SIZE CFE_MISSION_SB_MAX_SB_MSG_SIZE
+#endif
+
+/**\}*/
+
+/**
+ * \defgroup cfsdslgcmdcodes DS Load Generator Command Codes
+ * \{
+ */
+
+#define DS_LG_NOOP_CC           0 /**< \brief No-operation, reports the stream count */
+#define DS_LG_RESET_COUNTERS_CC 1 /**< \brief Reset command and stream counters */
+#define DS_LG_SET_STREAM_CC     2 /**< \brief Set the profile of a stopped stream */
+#define DS_LG_START_CC          3 /**< \brief Start one stream (or all configured streams) */
+#define DS_LG_STOP_CC           4 /**< \brief Stop one stream (or all streams) */
+
+/**\}*/
+
+#define DS_LG_ALL_STREAMS 0xFFFF /**< \brief Stream index selecting every stream */
+
+#define DS_LG_STREAM_STOPPED 0 /**< \brief Stream is not generating packets */
+#define DS_LG_STREAM_RUNNING 1 /**< \brief Stream is generating packets */
+
+/**
+ * \defgroup cfsdslgseq DS Load Generator Sequence Count Patterns
+ * \{
+ */
+
+#define DS_LG_SEQ_CONTINUOUS 0 /**< \brief Sequence count increments by one per packet */
+#define DS_LG_SEQ_GAP        1 /**< \brief One count is skipped after every SeqParam packets */
+#define DS_LG_SEQ_REPEAT     2 /**< \brief Each count is sent SeqParam times */
+
+/**\}*/
+
+/**
+ * \defgroup cfsdslgpayloads DS Load Generator Message Payloads
+ * \{
+ */
+
+/**
+ *  \brief Generated packet stream profile
+ *
+ *  A stream with a non-zero BurstOffMsec alternates between BurstOnMsec
+ *  of packets at PacketRate and BurstOffMsec of silence.
+ */
+typedef struct
+{
+    CFE_SB_MsgId_t MessageID;    /**< \brief Message ID of generated packets */
+    uint16         PacketSize;   /**< \brief Packet size in bytes, including the telemetry header */
+    uint16         SeqPattern;   /**< \brief Sequence count pattern, see #DS_LG_SEQ_CONTINUOUS */
+    uint16         SeqParam;     /**< \brief Packets between skipped counts, or copies of each count */
+    uint16         Spare;        /**< \brief Structure padding */
+    uint32         PacketRate;   /**< \brief Packets per second while the burst is on */
+    uint32         BurstOnMsec;  /**< \brief Length of each burst in milliseconds */
+    uint32         BurstOffMsec; /**< \brief Silence between bursts in milliseconds (0 = no bursts) */
+} DS_LG_StreamProfile_t;
+
+/**
+ *  \brief Set stream profile command payload
+ */
+typedef struct
+{
+    uint16                StreamIndex; /**< \brief Stream to configure */
+    uint16                Spare;       /**< \brief Structure padding */
+    DS_LG_StreamProfile_t Profile;     /**< \brief New stream profile */
+} DS_LG_SetStream_Payload_t;
+
+/**
+ *  \brief Start/stop stream command payload
+ */
+typedef struct
+{
+    uint16 StreamIndex; /**< \brief Stream to start or stop, or #DS_LG_ALL_STREAMS */
+    uint16 Spare;       /**< \brief Structure padding */
+} DS_LG_StreamIndex_Payload_t;
+
+/**
+ *  \brief Generated stream status
+ */
+typedef struct
+{
+    uint16 State;       /**< \brief #DS_LG_STREAM_STOPPED or #DS_LG_STREAM_RUNNING */
+    uint16 Spare;       /**< \brief Structure padding */
+    uint32 PacketCount; /**< \brief Count of packets sent */
+    uint32 ErrorCount;  /**< \brief Count of buffer allocation and transmit errors */
+    uint32 CapCount;    /**< \brief Count of cycles limited to the per-cycle packet maximum */
+    uint64 ByteCount;   /**< \brief Count of bytes sent */
+} DS_LG_StreamStatus_t;
+
+/**
+ *  \brief Housekeeping telemetry payload
+ */
+typedef struct
+{
+    uint8                CmdAcceptedCounter;        /**< \brief Count of valid commands received */
+    uint8                CmdRejectedCounter;        /**< \brief Count of invalid commands received */
+    uint16               Spare;                     /**< \brief Structure padding */
+    uint32               PacketCount;               /**< \brief Count of packets sent by all streams */
+    uint64               ByteCount;                 /**< \brief Count of bytes sent by all streams */
+    DS_LG_StreamStatus_t Stream[DS_LG_MAX_STREAMS]; /**< \brief Status of each stream */
+} DS_LG_HkTlm_Payload_t;
+
+/**
+ *  \brief Leading payload of every generated packet
+ *
+ *  The rest of the packet is filled with the low byte of PacketNumber.
+ */
+typedef struct
+{
+    uint16 StreamIndex;  /**< \brief Stream that generated the packet */
+    uint16 Spare;        /**< \brief Structure padding */
+    uint32 PacketNumber; /**< \brief Packets sent by the stream before this one */
+} DS_LG_PacketData_t;
+
+/**\}*/
+
+/**
+ * \defgroup cfsdslgstructs DS Load Generator Message Structures
+ * \{
+ */
+
+/**
+ *  \brief Command with no payload (HK request, no-op and reset)
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief cFE Software Bus command message header */
+} DS_LG_NoArgsCmd_t;
+
+/**
+ *  \brief Set stream profile command
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t   CommandHeader; /**< \brief cFE Software Bus command message header */
+    DS_LG_SetStream_Payload_t Payload;
+} DS_LG_SetStreamCmd_t;
+
+/**
+ *  \brief Start/stop stream command
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t     CommandHeader; /**< \brief cFE Software Bus command message header */
+    DS_LG_StreamIndex_Payload_t Payload;
+} DS_LG_StreamIndexCmd_t;
+
+/**
+ *  \brief Housekeeping telemetry packet
+ */
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t TelemetryHeader; /**< \brief cFE Software Bus telemetry message header */
+    DS_LG_HkTlm_Payload_t     Payload;
+} DS_LG_HkPacket_t;
+
+/**
+ *  \brief Generated packet header
+ */
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t TelemetryHeader; /**< \brief cFE Software Bus telemetry message header */
+    DS_LG_PacketData_t        Data;
+} DS_LG_Packet_t;
+
+/**\}*/
+
+#endif
@@ -0,0 +1,610 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  The DS Load Generator (DS_LG) application
+ *
+ *  Publishes synthetic telemetry packets on the Software Bus at a
+ *  commanded rate, size, sequence count pattern and burst profile.  The
+ *  packet and byte totals in housekeeping can be compared with the DS
+ *  packet counters to find where packets were dropped.
+ */
+
+#include "cfe.h"
+
+#include "ds_lg_msg.h"
+#include "ds_lg_eventids.h"
+#include "ds_lg_app.h"
+
+#include <string.h>
+
+/** \brief DS_LG global data */
+DS_LG_AppData_t DS_LG_AppData;
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Application entry point and main process loop                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_LG_AppMain(void)
+{
+    CFE_SB_Buffer_t *BufPtr = NULL;
+    int32            Result;
+    uint32           RunStatus = CFE_ES_RunStatus_APP_RUN;
+
+    Result = DS_LG_AppInitialize();
+
+    if (Result != CFE_SUCCESS)
+    {
+        RunStatus = CFE_ES_RunStatus_APP_ERROR;
+    }
+
+    while (CFE_ES_RunLoop(&RunStatus))
+    {
+        /*
+        ** Wait at most one generator cycle for a command...
+        */
+        Result = CFE_SB_ReceiveBuffer(&BufPtr, DS_LG_AppData.CmdPipe, DS_LG_TICK_MSEC);
+
+        if (Result == CFE_SUCCESS)
+        {
+            DS_LG_AppPipe(BufPtr);
+        }
+        else if (Result != CFE_SB_TIME_OUT)
+        {
+            RunStatus = CFE_ES_RunStatus_APP_ERROR;
+            break;
+        }
+
+        /*
+        ** Commands do not delay the packets that are due...
+        */
+        DS_LG_AppGenerate();
+        Result = CFE_SUCCESS;
+    }
+
+    if (Result != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(DS_LG_EXIT_ERR_EID, CFE_EVS_EventType_CRITICAL, "Application terminating, err = 0x%08X",
+                          (unsigned int)Result);
+
+        CFE_ES_WriteToSysLog("DS_LG application terminating, err = 0x%08X\n", (unsigned int)Result);
+    }
+
+    CFE_ES_ExitApp(RunStatus);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Application initialization                                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+CFE_Status_t DS_LG_AppInitialize(void)
+{
+    CFE_Status_t Result;
+
+    memset(&DS_LG_AppData, 0, sizeof(DS_LG_AppData));
+
+    Result = CFE_EVS_Register(NULL, 0, 0);
+
+    if (Result != CFE_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("DS_LG App: Error registering for Event Services, RC = 0x%08X\n", (unsigned int)Result);
+    }
+    else
+    {
+        Result = CFE_SB_CreatePipe(&DS_LG_AppData.CmdPipe, DS_LG_APP_PIPE_DEPTH, DS_LG_APP_PIPE_NAME);
+        if (Result != CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(DS_LG_INIT_ERR_EID, CFE_EVS_EventType_ERROR, "Unable to create input pipe, err = 0x%08X",
+                              (unsigned int)Result);
+        }
+    }
+
+    if (Result == CFE_SUCCESS)
+    {
+        Result = CFE_SB_Subscribe(CFE_SB_ValueToMsgId(DS_LG_SEND_HK_MID), DS_LG_AppData.CmdPipe);
+
+        if (Result != CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(DS_LG_INIT_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Unable to subscribe to HK request, err = 0x%08X", (unsigned int)Result);
+        }
+    }
+
+    if (Result == CFE_SUCCESS)
+    {
+        Result = CFE_SB_Subscribe(CFE_SB_ValueToMsgId(DS_LG_CMD_MID), DS_LG_AppData.CmdPipe);
+
+        if (Result != CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(DS_LG_INIT_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Unable to subscribe to DS_LG commands, err = 0x%08X", (unsigned int)Result);
+        }
+    }
+
+    if (Result == CFE_SUCCESS)
+    {
+        CFE_MSG_Init(CFE_MSG_PTR(DS_LG_AppData.HkPacket.TelemetryHeader), CFE_SB_ValueToMsgId(DS_LG_HK_TLM_MID),
+                     sizeof(DS_LG_AppData.HkPacket));
+
+        DS_LG_AppData.LastTick = CFE_TIME_GetMET();
+
+        CFE_EVS_SendEvent(DS_LG_INIT_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "Load generator initialized, %d streams, all stopped", DS_LG_MAX_STREAMS);
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify command packet length                                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static bool DS_LG_VerifyLength(const CFE_SB_Buffer_t *BufPtr, size_t ExpectedLength, const char *CommandName)
+{
+    size_t ActualLength = 0;
+
+    CFE_MSG_GetSize(&BufPtr->Msg, &ActualLength);
+
+    if (ExpectedLength != ActualLength)
+    {
+        DS_LG_AppData.CmdRejectedCounter++;
+
+        CFE_EVS_SendEvent(DS_LG_LEN_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Invalid %s command length: expected = %lu, actual = %lu", CommandName,
+                          (unsigned long)ExpectedLength, (unsigned long)ActualLength);
+    }
+
+    return (ExpectedLength == ActualLength);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify a stream index (optionally allowing all streams)         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static bool DS_LG_VerifyIndex(uint16 StreamIndex, bool AllowAll, const char *CommandName)
+{
+    bool Result = (StreamIndex < DS_LG_MAX_STREAMS) || (AllowAll && (StreamIndex == DS_LG_ALL_STREAMS));
+
+    if (!Result)
+    {
+        DS_LG_AppData.CmdRejectedCounter++;
+
+        CFE_EVS_SendEvent(DS_LG_INDEX_ERR_EID, CFE_EVS_EventType_ERROR, "Invalid %s command arg: stream index = %d",
+                          CommandName, (int)StreamIndex);
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify a stream profile                                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static const char *DS_LG_VerifyProfile(const DS_LG_StreamProfile_t *Profile)
+{
+    const char *Reason = NULL;
+
+    if (!CFE_SB_IsValidMsgId(Profile->MessageID))
+    {
+        Reason = "message ID";
+    }
+    else if ((Profile->PacketSize < sizeof(DS_LG_Packet_t)) || (Profile->PacketSize > DS_LG_MAX_PACKET_SIZE))
+    {
+        Reason = "packet size";
+    }
+    else if ((Profile->PacketRate == 0) || (Profile->PacketRate > DS_LG_MAX_PACKET_RATE))
+    {
+        Reason = "packet rate";
+    }
+    else if ((Profile->SeqPattern > DS_LG_SEQ_REPEAT) ||
+             ((Profile->SeqPattern != DS_LG_SEQ_CONTINUOUS) && (Profile->SeqParam == 0)))
+    {
+        Reason = "sequence pattern";
+    }
+    else if ((Profile->BurstOffMsec != 0) && (Profile->BurstOnMsec == 0))
+    {
+        Reason = "burst profile";
+    }
+
+    return Reason;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Set one stream running or stopped                               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static void DS_LG_SetState(DS_LG_Stream_t *Stream, uint16 State)
+{
+    Stream->Status.State = State;
+    Stream->Credit       = 0;
+    Stream->BurstMsec    = 0;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Housekeeping request                                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static void DS_LG_SendHk(void)
+{
+    DS_LG_HkTlm_Payload_t *Payload = &DS_LG_AppData.HkPacket.Payload;
+    uint16                 i;
+
+    Payload->CmdAcceptedCounter = DS_LG_AppData.CmdAcceptedCounter;
+    Payload->CmdRejectedCounter = DS_LG_AppData.CmdRejectedCounter;
+    Payload->PacketCount        = 0;
+    Payload->ByteCount          = 0;
+
+    for (i = 0; i < DS_LG_MAX_STREAMS; i++)
+    {
+        Payload->Stream[i] = DS_LG_AppData.Stream[i].Status;
+        Payload->PacketCount += DS_LG_AppData.Stream[i].Status.PacketCount;
+        Payload->ByteCount += DS_LG_AppData.Stream[i].Status.ByteCount;
+    }
+
+    CFE_SB_TimeStampMsg(CFE_MSG_PTR(DS_LG_AppData.HkPacket.TelemetryHeader));
+    CFE_SB_TransmitMsg(CFE_MSG_PTR(DS_LG_AppData.HkPacket.TelemetryHeader), true);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Application commands                                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static void DS_LG_NoopCmd(void)
+{
+    DS_LG_AppData.CmdAcceptedCounter++;
+
+    CFE_EVS_SendEvent(DS_LG_NOOP_INF_EID, CFE_EVS_EventType_INFORMATION, "NOOP command, %d streams",
+                      DS_LG_MAX_STREAMS);
+}
+
+static void DS_LG_ResetCmd(void)
+{
+    uint16 i;
+
+    DS_LG_AppData.CmdAcceptedCounter = 0;
+    DS_LG_AppData.CmdRejectedCounter = 0;
+
+    for (i = 0; i < DS_LG_MAX_STREAMS; i++)
+    {
+        DS_LG_AppData.Stream[i].Status.PacketCount = 0;
+        DS_LG_AppData.Stream[i].Status.ErrorCount  = 0;
+        DS_LG_AppData.Stream[i].Status.CapCount    = 0;
+        DS_LG_AppData.Stream[i].Status.ByteCount   = 0;
+    }
+
+    CFE_EVS_SendEvent(DS_LG_RESET_INF_EID, CFE_EVS_EventType_DEBUG, "Reset counters command");
+}
+
+static void DS_LG_SetStreamCmd(const DS_LG_SetStreamCmd_t *CmdPtr)
+{
+    const DS_LG_SetStream_Payload_t *CmdArgs = &CmdPtr->Payload;
+    DS_LG_Stream_t                  *Stream;
+    const char                      *Reason;
+
+    if (!DS_LG_VerifyIndex(CmdArgs->StreamIndex, false, "SET STREAM"))
+    {
+        return;
+    }
+
+    Stream = &DS_LG_AppData.Stream[CmdArgs->StreamIndex];
+    Reason = DS_LG_VerifyProfile(&CmdArgs->Profile);
+
+    if ((Reason == NULL) && (Stream->Status.State != DS_LG_STREAM_STOPPED))
+    {
+        Reason = "stream state";
+    }
+
+    if (Reason != NULL)
+    {
+        DS_LG_AppData.CmdRejectedCounter++;
+
+        CFE_EVS_SendEvent(DS_LG_SET_STREAM_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Invalid SET STREAM command arg: stream = %d, %s", (int)CmdArgs->StreamIndex, Reason);
+        return;
+    }
+
+    Stream->Profile = CmdArgs->Profile;
+
+    DS_LG_AppData.CmdAcceptedCounter++;
+
+    CFE_EVS_SendEvent(DS_LG_SET_STREAM_EID, CFE_EVS_EventType_INFORMATION,
+                      "SET STREAM command: stream = %d, MID = 0x%08lX, size = %d, rate = %lu, burst = %lu/%lu ms",
+                      (int)CmdArgs->StreamIndex, (unsigned long)CFE_SB_MsgIdToValue(Stream->Profile.MessageID),
+                      (int)Stream->Profile.PacketSize, (unsigned long)Stream->Profile.PacketRate,
+                      (unsigned long)Stream->Profile.BurstOnMsec, (unsigned long)Stream->Profile.BurstOffMsec);
+}
+
+static void DS_LG_StartStopCmd(const DS_LG_StreamIndexCmd_t *CmdPtr, uint16 State)
+{
+    const char *CommandName = (State == DS_LG_STREAM_RUNNING) ? "START" : "STOP";
+    uint16      StreamIndex = CmdPtr->Payload.StreamIndex;
+    uint16      Count       = 0;
+    uint16      i;
+
+    if (!DS_LG_VerifyIndex(StreamIndex, true, CommandName))
+    {
+        return;
+    }
+
+    for (i = 0; i < DS_LG_MAX_STREAMS; i++)
+    {
+        if ((StreamIndex != DS_LG_ALL_STREAMS) && (StreamIndex != i))
+        {
+            continue;
+        }
+
+        /*
+        ** Only streams with a profile can be started...
+        */
+        if ((State == DS_LG_STREAM_RUNNING) && (DS_LG_AppData.Stream[i].Profile.PacketRate == 0))
+        {
+            continue;
+        }
+
+        DS_LG_SetState(&DS_LG_AppData.Stream[i], State);
+        Count++;
+    }
+
+    if ((Count == 0) && (State == DS_LG_STREAM_RUNNING))
+    {
+        DS_LG_AppData.CmdRejectedCounter++;
+
+        CFE_EVS_SendEvent(DS_LG_SET_STREAM_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Invalid START command: stream index = %d has no profile", (int)StreamIndex);
+        return;
+    }
+
+    DS_LG_AppData.CmdAcceptedCounter++;
+
+    CFE_EVS_SendEvent((State == DS_LG_STREAM_RUNNING) ? DS_LG_START_INF_EID : DS_LG_STOP_INF_EID,
+                      CFE_EVS_EventType_INFORMATION, "%s command: stream index = %d, streams = %d", CommandName,
+                      (int)StreamIndex, (int)Count);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Software Bus message dispatcher                                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_LG_AppPipe(const CFE_SB_Buffer_t *BufPtr)
+{
+    CFE_SB_MsgId_t    MessageID   = CFE_SB_INVALID_MSG_ID;
+    CFE_MSG_FcnCode_t CommandCode = 0;
+
+    CFE_MSG_GetMsgId(&BufPtr->Msg, &MessageID);
+
+    if (CFE_SB_MsgId_Equal(MessageID, CFE_SB_ValueToMsgId(DS_LG_SEND_HK_MID)))
+    {
+        if (DS_LG_VerifyLength(BufPtr, sizeof(DS_LG_NoArgsCmd_t), "HK REQUEST"))
+        {
+            DS_LG_SendHk();
+        }
+    }
+    else if (CFE_SB_MsgId_Equal(MessageID, CFE_SB_ValueToMsgId(DS_LG_CMD_MID)))
+    {
+        CFE_MSG_GetFcnCode(&BufPtr->Msg, &CommandCode);
+
+        switch (CommandCode)
+        {
+            case DS_LG_NOOP_CC:
+                if (DS_LG_VerifyLength(BufPtr, sizeof(DS_LG_NoArgsCmd_t), "NOOP"))
+                {
+                    DS_LG_NoopCmd();
+                }
+                break;
+
+            case DS_LG_RESET_COUNTERS_CC:
+                if (DS_LG_VerifyLength(BufPtr, sizeof(DS_LG_NoArgsCmd_t), "RESET"))
+                {
+                    DS_LG_ResetCmd();
+                }
+                break;
+
+            case DS_LG_SET_STREAM_CC:
+                if (DS_LG_VerifyLength(BufPtr, sizeof(DS_LG_SetStreamCmd_t), "SET STREAM"))
+                {
+                    DS_LG_SetStreamCmd((const DS_LG_SetStreamCmd_t *)BufPtr);
+                }
+                break;
+
+            case DS_LG_START_CC:
+                if (DS_LG_VerifyLength(BufPtr, sizeof(DS_LG_StreamIndexCmd_t), "START"))
+                {
+                    DS_LG_StartStopCmd((const DS_LG_StreamIndexCmd_t *)BufPtr, DS_LG_STREAM_RUNNING);
+                }
+                break;
+
+            case DS_LG_STOP_CC:
+                if (DS_LG_VerifyLength(BufPtr, sizeof(DS_LG_StreamIndexCmd_t), "STOP"))
+                {
+                    DS_LG_StartStopCmd((const DS_LG_StreamIndexCmd_t *)BufPtr, DS_LG_STREAM_STOPPED);
+                }
+                break;
+
+            default:
+                DS_LG_AppData.CmdRejectedCounter++;
+
+                CFE_EVS_SendEvent(DS_LG_CC_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "Invalid command code: MID = 0x%08lX, CC = %d",
+                                  (unsigned long)CFE_SB_MsgIdToValue(MessageID), (int)CommandCode);
+                break;
+        }
+    }
+    else
+    {
+        CFE_EVS_SendEvent(DS_LG_MID_ERR_EID, CFE_EVS_EventType_ERROR, "Invalid message ID: MID = 0x%08lX",
+                          (unsigned long)CFE_SB_MsgIdToValue(MessageID));
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Send the packets that came due since the previous cycle         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_LG_AppGenerate(void)
+{
+    CFE_TIME_SysTime_t Now = CFE_TIME_GetMET();
+    CFE_TIME_SysTime_t Delta;
+    DS_LG_Stream_t    *Stream;
+    uint32             ElapsedMsec;
+    uint32             Period;
+    uint32             Packets;
+    uint16             i;
+
+    Delta                  = CFE_TIME_Subtract(Now, DS_LG_AppData.LastTick);
+    DS_LG_AppData.LastTick = Now;
+
+    if (Delta.Seconds >= (DS_LG_MAX_TICK_MSEC / 1000))
+    {
+        ElapsedMsec = DS_LG_MAX_TICK_MSEC;
+    }
+    else
+    {
+        ElapsedMsec = (Delta.Seconds * 1000) + (CFE_TIME_Sub2MicroSecs(Delta.Subseconds) / 1000);
+    }
+
+    for (i = 0; i < DS_LG_MAX_STREAMS; i++)
+    {
+        Stream = &DS_LG_AppData.Stream[i];
+
+        if (Stream->Status.State != DS_LG_STREAM_RUNNING)
+        {
+            continue;
+        }
+
+        /*
+        ** Packets only come due during the "on" part of a burst period...
+        */
+        if (Stream->Profile.BurstOffMsec != 0)
+        {
+            Period            = Stream->Profile.BurstOnMsec + Stream->Profile.BurstOffMsec;
+            Stream->BurstMsec = (Stream->BurstMsec + ElapsedMsec) % Period;
+
+            if (Stream->BurstMsec >= Stream->Profile.BurstOnMsec)
+            {
+                Stream->Credit = 0;
+                continue;
+            }
+        }
+
+        Stream->Credit += Stream->Profile.PacketRate * ElapsedMsec;
+        Packets = Stream->Credit / 1000;
+        Stream->Credit -= Packets * 1000;
+
+        if (Packets > DS_LG_MAX_PACKETS_PER_TICK)
+        {
+            Packets = DS_LG_MAX_PACKETS_PER_TICK;
+            Stream->Status.CapCount++;
+        }
+
+        while (Packets-- > 0)
+        {
+            DS_LG_AppSendPacket(i);
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Send one packet for a stream                                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_LG_AppSendPacket(uint16 StreamIndex)
+{
+    DS_LG_Stream_t  *Stream = &DS_LG_AppData.Stream[StreamIndex];
+    CFE_SB_Buffer_t *BufPtr;
+    DS_LG_Packet_t  *PktPtr;
+    uint32           Number = Stream->Status.PacketCount + Stream->Status.ErrorCount;
+    uint32           SeqCount;
+    CFE_Status_t     Result;
+
+    BufPtr = CFE_SB_AllocateMessageBuffer(Stream->Profile.PacketSize);
+
+    if (BufPtr == NULL)
+    {
+        Stream->Status.ErrorCount++;
+        return;
+    }
+
+    /*
+    ** Derive the sequence count from the packet number so that the
+    ** pattern is reproducible from the counters alone...
+    */
+    if (Stream->Profile.SeqPattern == DS_LG_SEQ_GAP)
+    {
+        SeqCount = Number + (Number / Stream->Profile.SeqParam);
+    }
+    else if (Stream->Profile.SeqPattern == DS_LG_SEQ_REPEAT)
+    {
+        SeqCount = Number / Stream->Profile.SeqParam;
+    }
+    else
+    {
+        SeqCount = Number;
+    }
+
+    CFE_MSG_Init(&BufPtr->Msg, Stream->Profile.MessageID, Stream->Profile.PacketSize);
+    CFE_MSG_SetSequenceCount(&BufPtr->Msg, (CFE_MSG_SequenceCount_t)(SeqCount & 0x3FFF));
+
+    PktPtr                    = (DS_LG_Packet_t *)BufPtr;
+    PktPtr->Data.StreamIndex  = StreamIndex;
+    PktPtr->Data.Spare        = 0;
+    PktPtr->Data.PacketNumber = Number;
+
+    memset((uint8 *)BufPtr + sizeof(DS_LG_Packet_t), (int)(Number & 0xFF),
+           Stream->Profile.PacketSize - sizeof(DS_LG_Packet_t));
+
+    CFE_SB_TimeStampMsg(&BufPtr->Msg);
+
+    /*
+    ** Sequence counts are set here, do not let SB overwrite them...
+    */
+    Result = CFE_SB_TransmitBuffer(BufPtr, false);
+
+    if (Result != CFE_SUCCESS)
+    {
+        CFE_SB_ReleaseMessageBuffer(BufPtr);
+        Stream->Status.ErrorCount++;
+    }
+    else
+    {
+        Stream->Status.PacketCount++;
+        Stream->Status.ByteCount += Stream->Profile.PacketSize;
+    }
+}
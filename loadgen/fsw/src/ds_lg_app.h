@@ -0,0 +1,124 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  The DS Load Generator (DS_LG) application header file
+ */
+#ifndef DS_LG_APP_H
+#define DS_LG_APP_H
+
+#include "cfe.h"
+
+#include "ds_lg_msg.h"
+
+/**
+ * \brief Command pipe depth
+ */
+#define DS_LG_APP_PIPE_DEPTH 16
+
+/**
+ * \brief Command pipe name
+ */
+#define DS_LG_APP_PIPE_NAME "DS_LG_CMD_PIPE"
+
+/**
+ * \brief Generator cycle period in milliseconds
+ *
+ * The application waits at most this long for a command before sending
+ * the packets that came due since the previous cycle.
+ */
+#define DS_LG_TICK_MSEC 10
+
+/**
+ * \brief Largest elapsed time credited to a single cycle in milliseconds
+ *
+ * Limits the catch-up burst after the application has been starved of CPU.
+ */
+#define DS_LG_MAX_TICK_MSEC 1000
+
+/**
+ * \brief Largest number of packets a stream sends in one cycle
+ *
+ * Packets that come due beyond this limit are dropped (and counted in the
+ * stream CapCount) rather than carried into the next cycle.
+ */
+#define DS_LG_MAX_PACKETS_PER_TICK 1000
+
+/**
+ *  \brief Generated stream runtime data
+ */
+typedef struct
+{
+    DS_LG_StreamProfile_t Profile;   /**< \brief Current stream profile */
+    DS_LG_StreamStatus_t  Status;    /**< \brief Stream counters reported in housekeeping */
+    uint32                Credit;    /**< \brief Packets due, scaled by 1000 (packet milliseconds per second) */
+    uint32                BurstMsec; /**< \brief Position within the current burst period */
+} DS_LG_Stream_t;
+
+/**
+ *  \brief Application global data structure
+ */
+typedef struct
+{
+    CFE_SB_PipeId_t    CmdPipe;  /**< \brief Command pipe ID */
+    CFE_TIME_SysTime_t LastTick; /**< \brief Time of the previous generator cycle */
+
+    uint8 CmdAcceptedCounter; /**< \brief Count of valid commands received */
+    uint8 CmdRejectedCounter; /**< \brief Count of invalid commands received */
+
+    DS_LG_Stream_t   Stream[DS_LG_MAX_STREAMS]; /**< \brief Generated streams */
+    DS_LG_HkPacket_t HkPacket;                  /**< \brief Housekeeping telemetry packet */
+} DS_LG_AppData_t;
+
+/** \brief DS_LG global data */
+extern DS_LG_AppData_t DS_LG_AppData;
+
+/**
+ *  \brief Application entry point and main process loop
+ */
+void DS_LG_AppMain(void);
+
+/**
+ *  \brief Application initialization
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+CFE_Status_t DS_LG_AppInitialize(void);
+
+/**
+ *  \brief Software Bus message dispatcher
+ *
+ *  \param[in] BufPtr Software Bus message pointer
+ */
+void DS_LG_AppPipe(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ *  \brief Send the packets that came due since the previous cycle
+ */
+void DS_LG_AppGenerate(void);
+
+/**
+ *  \brief Send one packet for a stream
+ *
+ *  \param[in] StreamIndex Stream to send a packet for
+ */
+void DS_LG_AppSendPacket(uint16 StreamIndex);
+
+#endif
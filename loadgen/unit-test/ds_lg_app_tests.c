@@ -0,0 +1,974 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   This file contains unit test cases for the functions contained in the file ds_lg_app.c
+ */
+
+/*
+ * Includes
+ */
+
+#include "ds_lg_app.h"
+#include "ds_lg_msg.h"
+#include "ds_lg_eventids.h"
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+#include <string.h>
+
+#define UT_DS_LG_TEST_ADD(test) UtTest_Add(test, DS_LG_Test_Setup, DS_LG_Test_TearDown, #test)
+
+/* Unit test MID for generated packets */
+#define DS_LG_UT_MID_1 CFE_SB_ValueToMsgId(1)
+
+/* Payload bytes added after the packet data in generated test packets */
+#define DS_LG_UT_FILL_SIZE 16
+
+#define UT_MAX_SENDEVENT_DEPTH 4
+
+typedef struct
+{
+    uint16 EventID;
+    uint16 EventType;
+} UT_DS_LG_SendEvent_context_t;
+
+/* Command buffer typedef for any handler */
+typedef union
+{
+    CFE_SB_Buffer_t        Buf;
+    DS_LG_NoArgsCmd_t      NoArgsCmd;
+    DS_LG_SetStreamCmd_t   SetStreamCmd;
+    DS_LG_StreamIndexCmd_t StreamIndexCmd;
+} UT_DS_LG_CmdBuf_t;
+
+/* Generated packet buffer */
+typedef struct
+{
+    DS_LG_Packet_t Packet;
+    uint8          Fill[DS_LG_UT_FILL_SIZE];
+} UT_DS_LG_PacketBuf_t;
+
+UT_DS_LG_SendEvent_context_t context_CFE_EVS_SendEvent[UT_MAX_SENDEVENT_DEPTH];
+UT_DS_LG_CmdBuf_t            UT_CmdBuf;
+CFE_MSG_SequenceCount_t      UT_DS_LG_SetSeqCnt;
+
+/*
+ * Function Definitions
+ */
+
+void UT_Handler_CFE_EVS_SendEvent(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context, va_list va)
+{
+    uint16 CallCount;
+    uint16 idx;
+
+    CallCount = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    if (CallCount > UT_MAX_SENDEVENT_DEPTH)
+    {
+        UtAssert_Failed("CFE_EVS_SendEvent UT depth %u exceeded: %u, increase UT_MAX_SENDEVENT_DEPTH",
+                        UT_MAX_SENDEVENT_DEPTH, CallCount);
+    }
+    else
+    {
+        idx                                      = CallCount - 1;
+        context_CFE_EVS_SendEvent[idx].EventID   = UT_Hook_GetArgValueByName(Context, "EventID", uint16);
+        context_CFE_EVS_SendEvent[idx].EventType = UT_Hook_GetArgValueByName(Context, "EventType", uint16);
+    }
+}
+
+void UT_CFE_TIME_Subtract_CustomHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CFE_TIME_SysTime_t Delta = *((const CFE_TIME_SysTime_t *)UserObj);
+
+    UT_Stub_SetReturnValue(FuncKey, Delta);
+}
+
+void UT_CFE_MSG_SetSequenceCount_CustomHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    UT_DS_LG_SetSeqCnt = UT_Hook_GetArgValueByName(Context, "SeqCnt", CFE_MSG_SequenceCount_t);
+}
+
+void DS_LG_Test_Setup(void)
+{
+    /* initialize test environment to default state for every test */
+    UT_ResetState(0);
+
+    memset(&DS_LG_AppData, 0, sizeof(DS_LG_AppData));
+    memset(context_CFE_EVS_SendEvent, 0, sizeof(context_CFE_EVS_SendEvent));
+    memset(&UT_CmdBuf, 0, sizeof(UT_CmdBuf));
+    UT_DS_LG_SetSeqCnt = 0;
+
+    /* Register custom handlers */
+    UT_SetVaHandlerFunction(UT_KEY(CFE_EVS_SendEvent), UT_Handler_CFE_EVS_SendEvent, NULL);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_IsValidMsgId), true);
+}
+
+void DS_LG_Test_TearDown(void)
+{
+    /* cleanup test environment */
+}
+
+/* Set up the message ID, command code and length of the next command */
+void UT_DS_LG_SetupCmd(CFE_SB_MsgId_t MsgId, CFE_MSG_FcnCode_t FcnCode, size_t Size)
+{
+    static CFE_SB_MsgId_t    ForcedMsgId;
+    static CFE_MSG_FcnCode_t ForcedFcnCode;
+    static size_t            ForcedSize;
+
+    ForcedMsgId   = MsgId;
+    ForcedFcnCode = FcnCode;
+    ForcedSize    = Size;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &ForcedMsgId, sizeof(ForcedMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &ForcedFcnCode, sizeof(ForcedFcnCode), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ForcedSize, sizeof(ForcedSize), false);
+}
+
+/* Fill in a profile that passes verification */
+void UT_DS_LG_SetupProfile(DS_LG_StreamProfile_t *Profile, uint32 PacketRate)
+{
+    memset(Profile, 0, sizeof(*Profile));
+
+    Profile->MessageID  = DS_LG_UT_MID_1;
+    Profile->PacketSize = sizeof(UT_DS_LG_PacketBuf_t);
+    Profile->SeqPattern = DS_LG_SEQ_CONTINUOUS;
+    Profile->PacketRate = PacketRate;
+}
+
+/* Set up the elapsed time seen by the next generator cycle */
+void UT_DS_LG_SetupElapsed(CFE_TIME_SysTime_t *Delta, uint32 Seconds, uint32 MicroSecs)
+{
+    Delta->Seconds    = Seconds;
+    Delta->Subseconds = 0;
+
+    UT_SetHandlerFunction(UT_KEY(CFE_TIME_Subtract), UT_CFE_TIME_Subtract_CustomHandler, Delta);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TIME_Sub2MicroSecs), MicroSecs);
+}
+
+void DS_LG_AppMain_Test_Nominal(void)
+{
+    /* Set to exit loop after first run */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_RunLoop), true);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_RunLoop), 2, false);
+
+    UT_DS_LG_SetupCmd(CFE_SB_ValueToMsgId(DS_LG_CMD_MID), DS_LG_NOOP_CC, sizeof(DS_LG_NoArgsCmd_t));
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_LG_AppMain());
+
+    /* Verify results - init and NOOP events, then one generator cycle */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_LG_INIT_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, DS_LG_NOOP_INF_EID);
+    UtAssert_STUB_COUNT(CFE_TIME_Subtract, 1);
+    UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 0);
+    UtAssert_STUB_COUNT(CFE_ES_ExitApp, 1);
+}
+
+void DS_LG_AppMain_Test_Timeout(void)
+{
+    /* Set to exit loop after first run */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_RunLoop), true);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_RunLoop), 2, false);
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_ReceiveBuffer), CFE_SB_TIME_OUT);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_LG_AppMain());
+
+    /* Verify results - no command, packets still generated */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_STUB_COUNT(CFE_MSG_GetMsgId, 0);
+    UtAssert_STUB_COUNT(CFE_TIME_Subtract, 1);
+    UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 0);
+}
+
+void DS_LG_AppMain_Test_SBError(void)
+{
+    /* Set to exit loop after first run */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_RunLoop), true);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_RunLoop), 2, false);
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_ReceiveBuffer), CFE_SB_PIPE_RD_ERR);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_LG_AppMain());
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, DS_LG_EXIT_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_CRITICAL);
+    UtAssert_STUB_COUNT(CFE_TIME_Subtract, 0);
+    UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 1);
+    UtAssert_STUB_COUNT(CFE_ES_ExitApp, 1);
+}
+
+void DS_LG_AppMain_Test_AppInitializeError(void)
+{
+    /* Set to exit loop after first run */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_RunLoop), 2, false);
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_EVS_Register), 1, -1);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_LG_AppMain());
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_LG_EXIT_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 2);
+    UtAssert_STUB_COUNT(CFE_ES_ExitApp, 1);
+}
+
+void DS_LG_AppInitialize_Test_Nominal(void)
+{
+    memset(&DS_LG_AppData, 1, sizeof(DS_LG_AppData));
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_LG_AppInitialize(), CFE_SUCCESS);
+
+    /* Verify results - every stream starts stopped with no profile */
+    UtAssert_UINT32_EQ(DS_LG_AppData.CmdAcceptedCounter, 0);
+    UtAssert_UINT32_EQ(DS_LG_AppData.Stream[0].Status.State, DS_LG_STREAM_STOPPED);
+    UtAssert_UINT32_EQ(DS_LG_AppData.Stream[DS_LG_MAX_STREAMS - 1].Profile.PacketRate, 0);
+    UtAssert_STUB_COUNT(CFE_SB_Subscribe, 2);
+    UtAssert_STUB_COUNT(CFE_MSG_Init, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_LG_INIT_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+}
+
+void DS_LG_AppInitialize_Test_EVSRegisterError(void)
+{
+    UT_SetDeferredRetcode(UT_KEY(CFE_EVS_Register), 1, -1);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_LG_AppInitialize(), -1);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 1);
+    UtAssert_STUB_COUNT(CFE_SB_CreatePipe, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_LG_AppInitialize_Test_SBCreatePipeError(void)
+{
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_CreatePipe), 1, -1);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_LG_AppInitialize(), -1);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_SB_Subscribe, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_LG_INIT_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_LG_AppInitialize_Test_SBSubscribeHKError(void)
+{
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_Subscribe), 1, -1);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_LG_AppInitialize(), -1);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_SB_Subscribe, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_LG_INIT_ERR_EID);
+}
+
+void DS_LG_AppInitialize_Test_SBSubscribeCmdError(void)
+{
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_Subscribe), 2, -1);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_LG_AppInitialize(), -1);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_SB_Subscribe, 2);
+    UtAssert_STUB_COUNT(CFE_MSG_Init, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_LG_INIT_ERR_EID);
+}
+
+void DS_LG_AppPipe_Test_SendHk(void)
+{
+    DS_LG_AppData.CmdAcceptedCounter                            = 3;
+    DS_LG_AppData.CmdRejectedCounter                            = 1;
+    DS_LG_AppData.Stream[0].Status.PacketCount                  = 10;
+    DS_LG_AppData.Stream[0].Status.ByteCount                    = 1000;
+    DS_LG_AppData.Stream[0].Status.State                        = DS_LG_STREAM_RUNNING;
+    DS_LG_AppData.Stream[1].Status.PacketCount                  = 5;
+    DS_LG_AppData.Stream[1].Status.ByteCount                    = 200;
+    DS_LG_AppData.Stream[DS_LG_MAX_STREAMS - 1].Status.CapCount = 2;
+
+    UT_DS_LG_SetupCmd(CFE_SB_ValueToMsgId(DS_LG_SEND_HK_MID), 0, sizeof(DS_LG_NoArgsCmd_t));
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_LG_AppPipe(&UT_CmdBuf.Buf));
+
+    /* Verify results - totals are summed over every stream */
+    UtAssert_UINT32_EQ(DS_LG_AppData.HkPacket.Payload.CmdAcceptedCounter, 3);
+    UtAssert_UINT32_EQ(DS_LG_AppData.HkPacket.Payload.CmdRejectedCounter, 1);
+    UtAssert_UINT32_EQ(DS_LG_AppData.HkPacket.Payload.PacketCount, 15);
+    UtAssert_UINT32_EQ(DS_LG_AppData.HkPacket.Payload.ByteCount, 1200);
+    UtAssert_UINT32_EQ(DS_LG_AppData.HkPacket.Payload.Stream[0].State, DS_LG_STREAM_RUNNING);
+    UtAssert_UINT32_EQ(DS_LG_AppData.HkPacket.Payload.Stream[DS_LG_MAX_STREAMS - 1].CapCount, 2);
+    UtAssert_STUB_COUNT(CFE_SB_TimeStampMsg, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_LG_AppPipe_Test_SendHkLengthError(void)
+{
+    UT_DS_LG_SetupCmd(CFE_SB_ValueToMsgId(DS_LG_SEND_HK_MID), 0, sizeof(DS_LG_NoArgsCmd_t) + 1);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_LG_AppPipe(&UT_CmdBuf.Buf));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_LG_AppData.CmdRejectedCounter, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_LG_LEN_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_LG_AppPipe_Test_Noop(void)
+{
+    UT_DS_LG_SetupCmd(CFE_SB_ValueToMsgId(DS_LG_CMD_MID), DS_LG_NOOP_CC, sizeof(DS_LG_NoArgsCmd_t));
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_LG_AppPipe(&UT_CmdBuf.Buf));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_LG_AppData.CmdAcceptedCounter, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_LG_NOOP_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+}
+
+void DS_LG_AppPipe_Test_NoopLengthError(void)
+{
+    UT_DS_LG_SetupCmd(CFE_SB_ValueToMsgId(DS_LG_CMD_MID), DS_LG_NOOP_CC, 0);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_LG_AppPipe(&UT_CmdBuf.Buf));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_LG_AppData.CmdAcceptedCounter, 0);
+    UtAssert_UINT32_EQ(DS_LG_AppData.CmdRejectedCounter, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_LG_LEN_ERR_EID);
+}
+
+void DS_LG_AppPipe_Test_Reset(void)
+{
+    DS_LG_AppData.CmdAcceptedCounter                            = 3;
+    DS_LG_AppData.CmdRejectedCounter                            = 1;
+    DS_LG_AppData.Stream[0].Status.State                        = DS_LG_STREAM_RUNNING;
+    DS_LG_AppData.Stream[0].Status.PacketCount                  = 10;
+    DS_LG_AppData.Stream[0].Status.ErrorCount                   = 2;
+    DS_LG_AppData.Stream[0].Status.ByteCount                    = 1000;
+    DS_LG_AppData.Stream[DS_LG_MAX_STREAMS - 1].Status.CapCount = 4;
+
+    UT_DS_LG_SetupCmd(CFE_SB_ValueToMsgId(DS_LG_CMD_MID), DS_LG_RESET_COUNTERS_CC, sizeof(DS_LG_NoArgsCmd_t));
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_LG_AppPipe(&UT_CmdBuf.Buf));
+
+    /* Verify results - counters cleared, stream left running */
+    UtAssert_UINT32_EQ(DS_LG_AppData.CmdAcceptedCounter, 0);
+    UtAssert_UINT32_EQ(DS_LG_AppData.CmdRejectedCounter, 0);
+    UtAssert_UINT32_EQ(DS_LG_AppData.Stream[0].Status.PacketCount, 0);
+    UtAssert_UINT32_EQ(DS_LG_AppData.Stream[0].Status.ErrorCount, 0);
+    UtAssert_UINT32_EQ(DS_LG_AppData.Stream[0].Status.ByteCount, 0);
+    UtAssert_UINT32_EQ(DS_LG_AppData.Stream[DS_LG_MAX_STREAMS - 1].Status.CapCount, 0);
+    UtAssert_UINT32_EQ(DS_LG_AppData.Stream[0].Status.State, DS_LG_STREAM_RUNNING);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_LG_RESET_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+}
+
+void DS_LG_AppPipe_Test_SetStream(void)
+{
+    UT_CmdBuf.SetStreamCmd.Payload.StreamIndex = DS_LG_MAX_STREAMS - 1;
+    UT_DS_LG_SetupProfile(&UT_CmdBuf.SetStreamCmd.Payload.Profile, 100);
+    UT_CmdBuf.SetStreamCmd.Payload.Profile.SeqPattern   = DS_LG_SEQ_GAP;
+    UT_CmdBuf.SetStreamCmd.Payload.Profile.SeqParam     = 10;
+    UT_CmdBuf.SetStreamCmd.Payload.Profile.BurstOnMsec  = 100;
+    UT_CmdBuf.SetStreamCmd.Payload.Profile.BurstOffMsec = 900;
+
+    UT_DS_LG_SetupCmd(CFE_SB_ValueToMsgId(DS_LG_CMD_MID), DS_LG_SET_STREAM_CC, sizeof(DS_LG_SetStreamCmd_t));
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_LG_AppPipe(&UT_CmdBuf.Buf));
+
+    /* Verify results */
+    UtAssert_MemCmp(&DS_LG_AppData.Stream[DS_LG_MAX_STREAMS - 1].Profile, &UT_CmdBuf.SetStreamCmd.Payload.Profile,
+                    sizeof(DS_LG_StreamProfile_t), "Profile");
+    UtAssert_UINT32_EQ(DS_LG_AppData.Stream[DS_LG_MAX_STREAMS - 1].Status.State, DS_LG_STREAM_STOPPED);
+    UtAssert_UINT32_EQ(DS_LG_AppData.CmdAcceptedCounter, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_LG_SET_STREAM_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+}
+
+void DS_LG_AppPipe_Test_SetStreamLengthError(void)
+{
+    UT_DS_LG_SetupCmd(CFE_SB_ValueToMsgId(DS_LG_CMD_MID), DS_LG_SET_STREAM_CC, sizeof(DS_LG_StreamIndexCmd_t));
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_LG_AppPipe(&UT_CmdBuf.Buf));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_LG_AppData.CmdRejectedCounter, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_LG_LEN_ERR_EID);
+}
+
+void DS_LG_AppPipe_Test_SetStreamIndexError(void)
+{
+    UT_CmdBuf.SetStreamCmd.Payload.StreamIndex = DS_LG_ALL_STREAMS;
+    UT_DS_LG_SetupProfile(&UT_CmdBuf.SetStreamCmd.Payload.Profile, 100);
+
+    UT_DS_LG_SetupCmd(CFE_SB_ValueToMsgId(DS_LG_CMD_MID), DS_LG_SET_STREAM_CC, sizeof(DS_LG_SetStreamCmd_t));
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_LG_AppPipe(&UT_CmdBuf.Buf));
+
+    /* Verify results - a profile applies to one stream only */
+    UtAssert_UINT32_EQ(DS_LG_AppData.CmdRejectedCounter, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_LG_INDEX_ERR_EID);
+}
+
+
+/* Send a SET STREAM command for stream 0 that fails profile verification */
+void UT_DS_LG_SetStreamProfileError(const DS_LG_StreamProfile_t *Profile)
+{
+    UT_CmdBuf.SetStreamCmd.Payload.StreamIndex = 0;
+    UT_CmdBuf.SetStreamCmd.Payload.Profile     = *Profile;
+
+    UT_DS_LG_SetupCmd(CFE_SB_ValueToMsgId(DS_LG_CMD_MID), DS_LG_SET_STREAM_CC, sizeof(DS_LG_SetStreamCmd_t));
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_LG_AppPipe(&UT_CmdBuf.Buf));
+
+    /* Verify results - the stream profile is unchanged */
+    UtAssert_UINT32_EQ(DS_LG_AppData.Stream[0].Profile.PacketRate, 0);
+    UtAssert_UINT32_EQ(DS_LG_AppData.CmdAcceptedCounter, 0);
+    UtAssert_UINT32_EQ(DS_LG_AppData.CmdRejectedCounter, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_LG_SET_STREAM_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_LG_AppPipe_Test_SetStreamMidError(void)
+{
+    DS_LG_StreamProfile_t Profile;
+
+    UT_DS_LG_SetupProfile(&Profile, 100);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_IsValidMsgId), false);
+
+    UT_DS_LG_SetStreamProfileError(&Profile);
+}
+
+void DS_LG_AppPipe_Test_SetStreamSizeError(void)
+{
+    DS_LG_StreamProfile_t Profile;
+
+    UT_DS_LG_SetupProfile(&Profile, 100);
+    Profile.PacketSize = sizeof(DS_LG_Packet_t) - 1;
+
+    UT_DS_LG_SetStreamProfileError(&Profile);
+}
+
+void DS_LG_AppPipe_Test_SetStreamRateError(void)
+{
+    DS_LG_StreamProfile_t Profile;
+
+    UT_DS_LG_SetupProfile(&Profile, DS_LG_MAX_PACKET_RATE + 1);
+
+    UT_DS_LG_SetStreamProfileError(&Profile);
+}
+
+void DS_LG_AppPipe_Test_SetStreamSeqError(void)
+{
+    DS_LG_StreamProfile_t Profile;
+
+    /* Gap and repeat patterns need a non-zero parameter */
+    UT_DS_LG_SetupProfile(&Profile, 100);
+    Profile.SeqPattern = DS_LG_SEQ_REPEAT;
+
+    UT_DS_LG_SetStreamProfileError(&Profile);
+}
+
+void DS_LG_AppPipe_Test_SetStreamBurstError(void)
+{
+    DS_LG_StreamProfile_t Profile;
+
+    UT_DS_LG_SetupProfile(&Profile, 100);
+    Profile.BurstOffMsec = 100;
+
+    UT_DS_LG_SetStreamProfileError(&Profile);
+}
+
+void DS_LG_AppPipe_Test_SetStreamRunning(void)
+{
+    DS_LG_StreamProfile_t Profile;
+
+    DS_LG_AppData.Stream[0].Status.State = DS_LG_STREAM_RUNNING;
+
+    /* A running stream must be stopped before its profile changes */
+    UT_DS_LG_SetupProfile(&Profile, 100);
+
+    UT_DS_LG_SetStreamProfileError(&Profile);
+}
+
+void DS_LG_AppPipe_Test_Start(void)
+{
+    UT_DS_LG_SetupProfile(&DS_LG_AppData.Stream[1].Profile, 100);
+    DS_LG_AppData.Stream[1].Credit    = 500;
+    DS_LG_AppData.Stream[1].BurstMsec = 20;
+
+    UT_CmdBuf.StreamIndexCmd.Payload.StreamIndex = 1;
+
+    UT_DS_LG_SetupCmd(CFE_SB_ValueToMsgId(DS_LG_CMD_MID), DS_LG_START_CC, sizeof(DS_LG_StreamIndexCmd_t));
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_LG_AppPipe(&UT_CmdBuf.Buf));
+
+    /* Verify results - the stream starts from a fresh schedule */
+    UtAssert_UINT32_EQ(DS_LG_AppData.Stream[1].Status.State, DS_LG_STREAM_RUNNING);
+    UtAssert_UINT32_EQ(DS_LG_AppData.Stream[1].Credit, 0);
+    UtAssert_UINT32_EQ(DS_LG_AppData.Stream[1].BurstMsec, 0);
+    UtAssert_UINT32_EQ(DS_LG_AppData.CmdAcceptedCounter, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_LG_START_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+}
+
+void DS_LG_AppPipe_Test_StartAll(void)
+{
+    UT_DS_LG_SetupProfile(&DS_LG_AppData.Stream[0].Profile, 100);
+    UT_DS_LG_SetupProfile(&DS_LG_AppData.Stream[DS_LG_MAX_STREAMS - 1].Profile, 100);
+
+    UT_CmdBuf.StreamIndexCmd.Payload.StreamIndex = DS_LG_ALL_STREAMS;
+
+    UT_DS_LG_SetupCmd(CFE_SB_ValueToMsgId(DS_LG_CMD_MID), DS_LG_START_CC, sizeof(DS_LG_StreamIndexCmd_t));
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_LG_AppPipe(&UT_CmdBuf.Buf));
+
+    /* Verify results - only the streams with a profile are started */
+    UtAssert_UINT32_EQ(DS_LG_AppData.Stream[0].Status.State, DS_LG_STREAM_RUNNING);
+    UtAssert_UINT32_EQ(DS_LG_AppData.Stream[1].Status.State, DS_LG_STREAM_STOPPED);
+    UtAssert_UINT32_EQ(DS_LG_AppData.Stream[DS_LG_MAX_STREAMS - 1].Status.State, DS_LG_STREAM_RUNNING);
+    UtAssert_UINT32_EQ(DS_LG_AppData.CmdAcceptedCounter, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_LG_START_INF_EID);
+}
+
+void DS_LG_AppPipe_Test_StartNoProfile(void)
+{
+    UT_CmdBuf.StreamIndexCmd.Payload.StreamIndex = DS_LG_ALL_STREAMS;
+
+    UT_DS_LG_SetupCmd(CFE_SB_ValueToMsgId(DS_LG_CMD_MID), DS_LG_START_CC, sizeof(DS_LG_StreamIndexCmd_t));
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_LG_AppPipe(&UT_CmdBuf.Buf));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_LG_AppData.Stream[0].Status.State, DS_LG_STREAM_STOPPED);
+    UtAssert_UINT32_EQ(DS_LG_AppData.CmdAcceptedCounter, 0);
+    UtAssert_UINT32_EQ(DS_LG_AppData.CmdRejectedCounter, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_LG_SET_STREAM_ERR_EID);
+}
+
+void DS_LG_AppPipe_Test_StartIndexError(void)
+{
+    UT_CmdBuf.StreamIndexCmd.Payload.StreamIndex = DS_LG_MAX_STREAMS;
+
+    UT_DS_LG_SetupCmd(CFE_SB_ValueToMsgId(DS_LG_CMD_MID), DS_LG_START_CC, sizeof(DS_LG_StreamIndexCmd_t));
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_LG_AppPipe(&UT_CmdBuf.Buf));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_LG_AppData.CmdRejectedCounter, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_LG_INDEX_ERR_EID);
+}
+
+void DS_LG_AppPipe_Test_StartLengthError(void)
+{
+    UT_DS_LG_SetupCmd(CFE_SB_ValueToMsgId(DS_LG_CMD_MID), DS_LG_START_CC, sizeof(DS_LG_NoArgsCmd_t));
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_LG_AppPipe(&UT_CmdBuf.Buf));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_LG_AppData.CmdRejectedCounter, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_LG_LEN_ERR_EID);
+}
+
+void DS_LG_AppPipe_Test_StopAll(void)
+{
+    DS_LG_AppData.Stream[0].Status.State = DS_LG_STREAM_RUNNING;
+    DS_LG_AppData.Stream[0].Credit       = 500;
+
+    UT_CmdBuf.StreamIndexCmd.Payload.StreamIndex = DS_LG_ALL_STREAMS;
+
+    UT_DS_LG_SetupCmd(CFE_SB_ValueToMsgId(DS_LG_CMD_MID), DS_LG_STOP_CC, sizeof(DS_LG_StreamIndexCmd_t));
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_LG_AppPipe(&UT_CmdBuf.Buf));
+
+    /* Verify results - stopping streams without a profile is not an error */
+    UtAssert_UINT32_EQ(DS_LG_AppData.Stream[0].Status.State, DS_LG_STREAM_STOPPED);
+    UtAssert_UINT32_EQ(DS_LG_AppData.Stream[0].Credit, 0);
+    UtAssert_UINT32_EQ(DS_LG_AppData.CmdAcceptedCounter, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_LG_STOP_INF_EID);
+}
+
+void DS_LG_AppPipe_Test_StopIndexError(void)
+{
+    UT_CmdBuf.StreamIndexCmd.Payload.StreamIndex = DS_LG_MAX_STREAMS;
+
+    UT_DS_LG_SetupCmd(CFE_SB_ValueToMsgId(DS_LG_CMD_MID), DS_LG_STOP_CC, sizeof(DS_LG_StreamIndexCmd_t));
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_LG_AppPipe(&UT_CmdBuf.Buf));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_LG_AppData.CmdRejectedCounter, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_LG_INDEX_ERR_EID);
+}
+
+void DS_LG_AppPipe_Test_InvalidCommandCode(void)
+{
+    UT_DS_LG_SetupCmd(CFE_SB_ValueToMsgId(DS_LG_CMD_MID), 99, sizeof(DS_LG_NoArgsCmd_t));
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_LG_AppPipe(&UT_CmdBuf.Buf));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_LG_AppData.CmdRejectedCounter, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_LG_CC_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_LG_AppPipe_Test_InvalidMessageID(void)
+{
+    UT_DS_LG_SetupCmd(CFE_SB_INVALID_MSG_ID, 0, sizeof(DS_LG_NoArgsCmd_t));
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_LG_AppPipe(&UT_CmdBuf.Buf));
+
+    /* Verify results - not a command, so no counter changes */
+    UtAssert_UINT32_EQ(DS_LG_AppData.CmdRejectedCounter, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_LG_MID_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_LG_AppGenerate_Test_Rate(void)
+{
+    CFE_TIME_SysTime_t Delta;
+
+    UT_DS_LG_SetupProfile(&DS_LG_AppData.Stream[0].Profile, 100);
+    DS_LG_AppData.Stream[0].Status.State = DS_LG_STREAM_RUNNING;
+
+    /* 15 ms at 100 packets per second is 1.5 packets */
+    UT_DS_LG_SetupElapsed(&Delta, 0, 15000);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_LG_AppGenerate());
+
+    /* Verify results - the fraction is carried into the next cycle */
+    UtAssert_STUB_COUNT(CFE_SB_AllocateMessageBuffer, 1);
+    UtAssert_UINT32_EQ(DS_LG_AppData.Stream[0].Credit, 500);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_LG_AppGenerate());
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_SB_AllocateMessageBuffer, 3);
+    UtAssert_UINT32_EQ(DS_LG_AppData.Stream[0].Credit, 0);
+    UtAssert_UINT32_EQ(DS_LG_AppData.Stream[0].Status.CapCount, 0);
+}
+
+void DS_LG_AppGenerate_Test_Stopped(void)
+{
+    CFE_TIME_SysTime_t Delta;
+
+    UT_DS_LG_SetupProfile(&DS_LG_AppData.Stream[0].Profile, 100);
+
+    UT_DS_LG_SetupElapsed(&Delta, 0, 100000);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_LG_AppGenerate());
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_SB_AllocateMessageBuffer, 0);
+    UtAssert_UINT32_EQ(DS_LG_AppData.Stream[0].Credit, 0);
+}
+
+void DS_LG_AppGenerate_Test_Burst(void)
+{
+    CFE_TIME_SysTime_t Delta;
+
+    UT_DS_LG_SetupProfile(&DS_LG_AppData.Stream[0].Profile, 100);
+    DS_LG_AppData.Stream[0].Profile.BurstOnMsec  = 20;
+    DS_LG_AppData.Stream[0].Profile.BurstOffMsec = 30;
+    DS_LG_AppData.Stream[0].Status.State         = DS_LG_STREAM_RUNNING;
+
+    UT_DS_LG_SetupElapsed(&Delta, 0, 15000);
+
+    /* Execute the function being tested - 15 ms into the burst */
+    UtAssert_VOIDCALL(DS_LG_AppGenerate());
+
+    UtAssert_STUB_COUNT(CFE_SB_AllocateMessageBuffer, 1);
+    UtAssert_UINT32_EQ(DS_LG_AppData.Stream[0].BurstMsec, 15);
+    UtAssert_UINT32_EQ(DS_LG_AppData.Stream[0].Credit, 500);
+
+    /* Execute the function being tested - 30 ms, silent part of the period */
+    UtAssert_VOIDCALL(DS_LG_AppGenerate());
+
+    UtAssert_STUB_COUNT(CFE_SB_AllocateMessageBuffer, 1);
+    UtAssert_UINT32_EQ(DS_LG_AppData.Stream[0].BurstMsec, 30);
+    UtAssert_UINT32_EQ(DS_LG_AppData.Stream[0].Credit, 0);
+
+    /* Execute the function being tested - 45 ms, still silent */
+    UtAssert_VOIDCALL(DS_LG_AppGenerate());
+
+    UtAssert_STUB_COUNT(CFE_SB_AllocateMessageBuffer, 1);
+    UtAssert_UINT32_EQ(DS_LG_AppData.Stream[0].BurstMsec, 45);
+
+    /* Execute the function being tested - 10 ms into the next burst */
+    UtAssert_VOIDCALL(DS_LG_AppGenerate());
+
+    /* Verify results - the silence earned no credit */
+    UtAssert_STUB_COUNT(CFE_SB_AllocateMessageBuffer, 2);
+    UtAssert_UINT32_EQ(DS_LG_AppData.Stream[0].BurstMsec, 10);
+    UtAssert_UINT32_EQ(DS_LG_AppData.Stream[0].Credit, 500);
+}
+
+void DS_LG_AppGenerate_Test_MaxTick(void)
+{
+    CFE_TIME_SysTime_t Delta;
+
+    UT_DS_LG_SetupProfile(&DS_LG_AppData.Stream[0].Profile, 10);
+    DS_LG_AppData.Stream[0].Status.State = DS_LG_STREAM_RUNNING;
+
+    /* A five second stall is credited as one cycle of the maximum length */
+    UT_DS_LG_SetupElapsed(&Delta, 5, 0);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_LG_AppGenerate());
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_TIME_Sub2MicroSecs, 0);
+    UtAssert_STUB_COUNT(CFE_SB_AllocateMessageBuffer, (10 * DS_LG_MAX_TICK_MSEC) / 1000);
+    UtAssert_UINT32_EQ(DS_LG_AppData.Stream[0].Status.CapCount, 0);
+}
+
+void DS_LG_AppGenerate_Test_Cap(void)
+{
+    CFE_TIME_SysTime_t Delta;
+
+    UT_DS_LG_SetupProfile(&DS_LG_AppData.Stream[0].Profile, DS_LG_MAX_PACKET_RATE);
+    DS_LG_AppData.Stream[0].Status.State = DS_LG_STREAM_RUNNING;
+
+    UT_DS_LG_SetupElapsed(&Delta, 1, 0);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_LG_AppGenerate());
+
+    /* Verify results - packets beyond the cap are dropped, not carried over */
+    UtAssert_STUB_COUNT(CFE_SB_AllocateMessageBuffer, DS_LG_MAX_PACKETS_PER_TICK);
+    UtAssert_UINT32_EQ(DS_LG_AppData.Stream[0].Status.CapCount, 1);
+    UtAssert_UINT32_EQ(DS_LG_AppData.Stream[0].Credit, 0);
+}
+
+void DS_LG_AppSendPacket_Test_Nominal(void)
+{
+    UT_DS_LG_PacketBuf_t  PktBuf;
+    UT_DS_LG_PacketBuf_t *PktBufPtr = &PktBuf;
+    uint8                 Fill[DS_LG_UT_FILL_SIZE];
+
+    memset(&PktBuf, 0, sizeof(PktBuf));
+    memset(Fill, 5, sizeof(Fill));
+    UT_SetDataBuffer(UT_KEY(CFE_SB_AllocateMessageBuffer), &PktBufPtr, sizeof(PktBufPtr), true);
+    UT_SetHandlerFunction(UT_KEY(CFE_MSG_SetSequenceCount), UT_CFE_MSG_SetSequenceCount_CustomHandler, NULL);
+
+    UT_DS_LG_SetupProfile(&DS_LG_AppData.Stream[2].Profile, 100);
+    DS_LG_AppData.Stream[2].Status.PacketCount = 3;
+    DS_LG_AppData.Stream[2].Status.ErrorCount  = 2;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_LG_AppSendPacket(2));
+
+    /* Verify results - the packet number counts every attempt */
+    UtAssert_UINT32_EQ(PktBuf.Packet.Data.StreamIndex, 2);
+    UtAssert_UINT32_EQ(PktBuf.Packet.Data.PacketNumber, 5);
+    UtAssert_MemCmp(PktBuf.Fill, Fill, sizeof(Fill), "Fill");
+    UtAssert_UINT32_EQ(UT_DS_LG_SetSeqCnt, 5);
+    UtAssert_STUB_COUNT(CFE_MSG_Init, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 1);
+    UtAssert_STUB_COUNT(CFE_SB_ReleaseMessageBuffer, 0);
+    UtAssert_UINT32_EQ(DS_LG_AppData.Stream[2].Status.PacketCount, 4);
+    UtAssert_UINT32_EQ(DS_LG_AppData.Stream[2].Status.ErrorCount, 2);
+    UtAssert_UINT32_EQ(DS_LG_AppData.Stream[2].Status.ByteCount, sizeof(UT_DS_LG_PacketBuf_t));
+}
+
+void DS_LG_AppSendPacket_Test_SeqGap(void)
+{
+    UT_DS_LG_PacketBuf_t  PktBuf;
+    UT_DS_LG_PacketBuf_t *PktBufPtr = &PktBuf;
+
+    UT_SetDataBuffer(UT_KEY(CFE_SB_AllocateMessageBuffer), &PktBufPtr, sizeof(PktBufPtr), true);
+    UT_SetHandlerFunction(UT_KEY(CFE_MSG_SetSequenceCount), UT_CFE_MSG_SetSequenceCount_CustomHandler, NULL);
+
+    UT_DS_LG_SetupProfile(&DS_LG_AppData.Stream[0].Profile, 100);
+    DS_LG_AppData.Stream[0].Profile.SeqPattern = DS_LG_SEQ_GAP;
+    DS_LG_AppData.Stream[0].Profile.SeqParam   = 4;
+    DS_LG_AppData.Stream[0].Status.PacketCount = 9;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_LG_AppSendPacket(0));
+
+    /* Verify results - two counts skipped after packets 3 and 7 */
+    UtAssert_UINT32_EQ(UT_DS_LG_SetSeqCnt, 11);
+}
+
+void DS_LG_AppSendPacket_Test_SeqRepeat(void)
+{
+    UT_DS_LG_PacketBuf_t  PktBuf;
+    UT_DS_LG_PacketBuf_t *PktBufPtr = &PktBuf;
+
+    UT_SetDataBuffer(UT_KEY(CFE_SB_AllocateMessageBuffer), &PktBufPtr, sizeof(PktBufPtr), true);
+    UT_SetHandlerFunction(UT_KEY(CFE_MSG_SetSequenceCount), UT_CFE_MSG_SetSequenceCount_CustomHandler, NULL);
+
+    UT_DS_LG_SetupProfile(&DS_LG_AppData.Stream[0].Profile, 100);
+    DS_LG_AppData.Stream[0].Profile.SeqPattern = DS_LG_SEQ_REPEAT;
+    DS_LG_AppData.Stream[0].Profile.SeqParam   = 3;
+    DS_LG_AppData.Stream[0].Status.PacketCount = 7;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_LG_AppSendPacket(0));
+
+    /* Verify results - each count is sent three times */
+    UtAssert_UINT32_EQ(UT_DS_LG_SetSeqCnt, 2);
+}
+
+void DS_LG_AppSendPacket_Test_NoBuf(void)
+{
+    UT_DS_LG_SetupProfile(&DS_LG_AppData.Stream[0].Profile, 100);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_LG_AppSendPacket(0));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_MSG_Init, 0);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 0);
+    UtAssert_UINT32_EQ(DS_LG_AppData.Stream[0].Status.PacketCount, 0);
+    UtAssert_UINT32_EQ(DS_LG_AppData.Stream[0].Status.ErrorCount, 1);
+}
+
+void DS_LG_AppSendPacket_Test_TransmitError(void)
+{
+    UT_DS_LG_PacketBuf_t  PktBuf;
+    UT_DS_LG_PacketBuf_t *PktBufPtr = &PktBuf;
+
+    UT_SetDataBuffer(UT_KEY(CFE_SB_AllocateMessageBuffer), &PktBufPtr, sizeof(PktBufPtr), true);
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_TransmitBuffer), 1, -1);
+
+    UT_DS_LG_SetupProfile(&DS_LG_AppData.Stream[0].Profile, 100);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_LG_AppSendPacket(0));
+
+    /* Verify results - the buffer is given back */
+    UtAssert_STUB_COUNT(CFE_SB_ReleaseMessageBuffer, 1);
+    UtAssert_UINT32_EQ(DS_LG_AppData.Stream[0].Status.PacketCount, 0);
+    UtAssert_UINT32_EQ(DS_LG_AppData.Stream[0].Status.ErrorCount, 1);
+    UtAssert_UINT32_EQ(DS_LG_AppData.Stream[0].Status.ByteCount, 0);
+}
+
+void UtTest_Setup(void)
+{
+    UT_DS_LG_TEST_ADD(DS_LG_AppMain_Test_Nominal);
+    UT_DS_LG_TEST_ADD(DS_LG_AppMain_Test_Timeout);
+    UT_DS_LG_TEST_ADD(DS_LG_AppMain_Test_SBError);
+    UT_DS_LG_TEST_ADD(DS_LG_AppMain_Test_AppInitializeError);
+
+    UT_DS_LG_TEST_ADD(DS_LG_AppInitialize_Test_Nominal);
+    UT_DS_LG_TEST_ADD(DS_LG_AppInitialize_Test_EVSRegisterError);
+    UT_DS_LG_TEST_ADD(DS_LG_AppInitialize_Test_SBCreatePipeError);
+    UT_DS_LG_TEST_ADD(DS_LG_AppInitialize_Test_SBSubscribeHKError);
+    UT_DS_LG_TEST_ADD(DS_LG_AppInitialize_Test_SBSubscribeCmdError);
+
+    UT_DS_LG_TEST_ADD(DS_LG_AppPipe_Test_SendHk);
+    UT_DS_LG_TEST_ADD(DS_LG_AppPipe_Test_SendHkLengthError);
+    UT_DS_LG_TEST_ADD(DS_LG_AppPipe_Test_Noop);
+    UT_DS_LG_TEST_ADD(DS_LG_AppPipe_Test_NoopLengthError);
+    UT_DS_LG_TEST_ADD(DS_LG_AppPipe_Test_Reset);
+    UT_DS_LG_TEST_ADD(DS_LG_AppPipe_Test_SetStream);
+    UT_DS_LG_TEST_ADD(DS_LG_AppPipe_Test_SetStreamLengthError);
+    UT_DS_LG_TEST_ADD(DS_LG_AppPipe_Test_SetStreamIndexError);
+    UT_DS_LG_TEST_ADD(DS_LG_AppPipe_Test_SetStreamMidError);
+    UT_DS_LG_TEST_ADD(DS_LG_AppPipe_Test_SetStreamSizeError);
+    UT_DS_LG_TEST_ADD(DS_LG_AppPipe_Test_SetStreamRateError);
+    UT_DS_LG_TEST_ADD(DS_LG_AppPipe_Test_SetStreamSeqError);
+    UT_DS_LG_TEST_ADD(DS_LG_AppPipe_Test_SetStreamBurstError);
+    UT_DS_LG_TEST_ADD(DS_LG_AppPipe_Test_SetStreamRunning);
+    UT_DS_LG_TEST_ADD(DS_LG_AppPipe_Test_Start);
+    UT_DS_LG_TEST_ADD(DS_LG_AppPipe_Test_StartAll);
+    UT_DS_LG_TEST_ADD(DS_LG_AppPipe_Test_StartNoProfile);
+    UT_DS_LG_TEST_ADD(DS_LG_AppPipe_Test_StartIndexError);
+    UT_DS_LG_TEST_ADD(DS_LG_AppPipe_Test_StartLengthError);
+    UT_DS_LG_TEST_ADD(DS_LG_AppPipe_Test_StopAll);
+    UT_DS_LG_TEST_ADD(DS_LG_AppPipe_Test_StopIndexError);
+    UT_DS_LG_TEST_ADD(DS_LG_AppPipe_Test_InvalidCommandCode);
+    UT_DS_LG_TEST_ADD(DS_LG_AppPipe_Test_InvalidMessageID);
+
+    UT_DS_LG_TEST_ADD(DS_LG_AppGenerate_Test_Rate);
+    UT_DS_LG_TEST_ADD(DS_LG_AppGenerate_Test_Stopped);
+    UT_DS_LG_TEST_ADD(DS_LG_AppGenerate_Test_Burst);
+    UT_DS_LG_TEST_ADD(DS_LG_AppGenerate_Test_MaxTick);
+    UT_DS_LG_TEST_ADD(DS_LG_AppGenerate_Test_Cap);
+
+    UT_DS_LG_TEST_ADD(DS_LG_AppSendPacket_Test_Nominal);
+    UT_DS_LG_TEST_ADD(DS_LG_AppSendPacket_Test_SeqGap);
+    UT_DS_LG_TEST_ADD(DS_LG_AppSendPacket_Test_SeqRepeat);
+    UT_DS_LG_TEST_ADD(DS_LG_AppSendPacket_Test_NoBuf);
+    UT_DS_LG_TEST_ADD(DS_LG_AppSendPacket_Test_TransmitError);
+}
@@ -34,6 +34,7 @@
 #include "ds_version.h"
 #include "ds_test_utils.h"
 #include "ds_cmds.h"
+#include "ds_dispatch.h"
 #include "ds_file.h"
 
 /* UT includes */
@@ -140,6 +141,25 @@ void DS_AppMain_Test_SBTimeout(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
 }
 
+void DS_AppMain_Test_PipeEmpty(void)
+{
+    /* Set to exit loop after first run */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_RunLoop), true);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_RunLoop), 2, false);
+
+    /* Poll finds the pipe empty, then the blocking receive succeeds */
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 1, CFE_SB_NO_MESSAGE);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_AppMain());
+
+    /* Verify results -- the message received after waiting counts toward the next backlog probe */
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, 2);
+    UtAssert_UINT32_EQ(DS_AppData.BacklogProbeCount, 1);
+    UtAssert_STUB_COUNT(DS_AppPipe, 1);
+    UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 0);
+}
+
 void DS_AppInitialize_Test_Nominal(void)
 {
     memset(&DS_AppData, 1, sizeof(DS_AppData));
@@ -246,6 +266,28 @@ void DS_AppInitialize_Test_SBSubscribeDSError(void)
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 }
 
+void DS_AppInitialize_Test_SBSubscribeProbeError(void)
+{
+    /* Set to generate error message DS_INIT_ERR_EID for backlog probes */
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_Subscribe), 3, -1);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_AppInitialize(), -1);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.AppEnableState, DS_DEF_ENABLE_STATE);
+
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(DS_AppData.FileStatus[0].FileHandle));
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(DS_AppData.FileStatus[DS_DEST_FILE_CNT / 2].FileHandle));
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(DS_AppData.FileStatus[DS_DEST_FILE_CNT - 1].FileHandle));
+
+    /* Note: not verifying that the rest of DS_AppData is set to 0, because some elements of DS_AppData
+     * are modified by subfunctions, which we're not testing here */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_INIT_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
 void DS_AppStorePacket_Test_Nominal(void)
 {
     CFE_SB_MsgId_t    MessageID      = DS_UT_MID_1;
@@ -270,6 +312,43 @@ void DS_AppStorePacket_Test_Nominal(void)
     UtAssert_STUB_COUNT(DS_FileStorePacket, 1);
 }
 
+void DS_AppStorePacket_Test_ReplayEcho(void)
+{
+    CFE_SB_MsgId_t MessageID = DS_UT_MID_1;
+
+    DS_AppData.AppEnableState = DS_ENABLED;
+
+    /* Packet was sent by the replay task */
+    UT_SetDefaultReturnValue(UT_KEY(DS_IsPacketEcho), true);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_AppStorePacket(MessageID, &UT_CmdBuf.Buf));
+
+    /* Verify results - replayed packet is not stored */
+    UtAssert_UINT32_EQ(DS_AppData.IgnoredPktCounter, 1);
+    UtAssert_STUB_COUNT(DS_FileStorePacket, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_AppStorePacket_Test_CacheEcho(void)
+{
+    CFE_SB_MsgId_t MessageID = DS_UT_MID_1;
+
+    DS_AppData.AppEnableState = DS_ENABLED;
+
+    /* Packet was sent from the latest-value cache (second echo table checked) */
+    UT_SetDeferredRetcode(UT_KEY(DS_IsPacketEcho), 2, true);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_AppStorePacket(MessageID, &UT_CmdBuf.Buf));
+
+    /* Verify results - cached packet is not stored again */
+    UtAssert_UINT32_EQ(DS_AppData.IgnoredPktCounter, 1);
+    UtAssert_STUB_COUNT(DS_IsPacketEcho, 2);
+    UtAssert_STUB_COUNT(DS_FileStorePacket, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
 void DS_AppStorePacket_Test_DSDisabled(void)
 {
     CFE_SB_MsgId_t    MessageID      = DS_UT_MID_1;
@@ -338,21 +417,282 @@ void DS_AppStorePacket_Test_DestFileTableNotLoaded(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
+/* Smallest pipe backlog that enters a decimation level */
+uint32 UT_DS_DecimationThreshold(uint8 Level)
+{
+    uint32 Percent = (DS_DECIMATION_THRESHOLD * DS_DECIMATION_LEVELS) + ((100 - DS_DECIMATION_THRESHOLD) * (Level - 1));
+
+    return ((DS_APP_PIPE_DEPTH * Percent) + (100 * DS_DECIMATION_LEVELS) - 1) / (100 * DS_DECIMATION_LEVELS);
+}
+
+void DS_AppDecimationLevel_Test_Nominal(void)
+{
+    uint32 Threshold = UT_DS_DecimationThreshold(1);
+
+    /* Execute the function being tested and verify results */
+    UtAssert_UINT32_EQ(DS_AppDecimationLevel(0), 0);
+    UtAssert_UINT32_EQ(DS_AppDecimationLevel(Threshold - 1), 0);
+    UtAssert_UINT32_EQ(DS_AppDecimationLevel(Threshold), 1);
+    UtAssert_UINT32_EQ(DS_AppDecimationLevel(UT_DS_DecimationThreshold(2) - 1), 1);
+    UtAssert_UINT32_EQ(DS_AppDecimationLevel(UT_DS_DecimationThreshold(2)), 2);
+    UtAssert_UINT32_EQ(DS_AppDecimationLevel(UT_DS_DecimationThreshold(DS_DECIMATION_LEVELS)), DS_DECIMATION_LEVELS);
+
+    /* A full pipe is always the highest level */
+    UtAssert_UINT32_EQ(DS_AppDecimationLevel(DS_APP_PIPE_DEPTH), DS_DECIMATION_LEVELS);
+}
+
+void DS_AppProbeBacklog_Test_Counted(void)
+{
+    DS_AppData.BacklogProbePending = false;
+    DS_AppData.BacklogProbeCount   = 0;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_AppProbeBacklog());
+
+    /* Verify results -- too few messages to fill the pipe to the first threshold */
+    UtAssert_UINT32_EQ(DS_AppData.BacklogProbeCount, 1);
+    UtAssert_BOOL_FALSE(DS_AppData.BacklogProbePending);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+}
+
+void DS_AppProbeBacklog_Test_Sent(void)
+{
+    DS_AppData.BacklogProbePending = false;
+    DS_AppData.BacklogProbeCount   = UT_DS_DecimationThreshold(1) - 1;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_AppProbeBacklog());
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_MSG_Init, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_BOOL_TRUE(DS_AppData.BacklogProbePending);
+    UtAssert_UINT32_EQ(DS_AppData.BacklogProbeCount, 0);
+}
+
+void DS_AppProbeBacklog_Test_SendError(void)
+{
+    DS_AppData.BacklogProbePending = false;
+    DS_AppData.BacklogProbeCount   = UT_DS_DecimationThreshold(1) - 1;
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_TransmitMsg), 1, -1);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_AppProbeBacklog());
+
+    /* Verify results -- no probe to wait for, next one after another threshold of messages */
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_BOOL_FALSE(DS_AppData.BacklogProbePending);
+    UtAssert_UINT32_EQ(DS_AppData.BacklogProbeCount, 0);
+}
+
+void DS_AppProbeBacklog_Test_Pending(void)
+{
+    DS_AppData.BacklogProbePending = true;
+    DS_AppData.BacklogProbeCount   = DS_APP_PIPE_DEPTH - 1;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_AppProbeBacklog());
+
+    /* Verify results -- the probe may still be last in a full pipe */
+    UtAssert_UINT32_EQ(DS_AppData.BacklogProbeCount, DS_APP_PIPE_DEPTH);
+    UtAssert_BOOL_TRUE(DS_AppData.BacklogProbePending);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_AppProbeBacklog_Test_Dropped(void)
+{
+    DS_AppData.BacklogProbePending = true;
+    DS_AppData.BacklogProbeCount   = DS_APP_PIPE_DEPTH;
+    DS_AppData.BacklogPeak         = 0;
+    DS_AppData.DecimationLevel     = 0;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_AppProbeBacklog());
+
+    /* Verify results -- a dropped probe means the pipe was full */
+    UtAssert_BOOL_FALSE(DS_AppData.BacklogProbePending);
+    UtAssert_UINT32_EQ(DS_AppData.BacklogProbeCount, 0);
+    UtAssert_UINT32_EQ(DS_AppData.BacklogPeak, DS_APP_PIPE_DEPTH);
+    UtAssert_UINT32_EQ(DS_AppData.DecimationLevel, DS_DECIMATION_LEVELS);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_DECIMATION_RAISED_EID);
+}
+
+void DS_AppRaiseDecimation_Test_Nominal(void)
+{
+    DS_AppData.BacklogPeak = 3;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_AppRaiseDecimation(1));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.BacklogPeak, 3);
+    UtAssert_UINT32_EQ(DS_AppData.DecimationLevel, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_AppRaiseDecimation_Test_Raised(void)
+{
+    uint32 Threshold = UT_DS_DecimationThreshold(1);
+
+    DS_AppData.BacklogPeak = 0;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_AppRaiseDecimation(Threshold));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.BacklogPeak, Threshold);
+    UtAssert_UINT32_EQ(DS_AppData.DecimationLevel, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_DECIMATION_RAISED_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+
+    /* Level only moves on a transition */
+    UtAssert_VOIDCALL(DS_AppRaiseDecimation(Threshold));
+    UtAssert_UINT32_EQ(DS_AppData.DecimationLevel, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void DS_AppLowerDecimation_Test_Lowered(void)
+{
+    DS_AppData.DecimationLevel = 2;
+    DS_AppData.BacklogPeak     = 1;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_AppLowerDecimation());
+
+    /* Verify results -- one step per call */
+    UtAssert_UINT32_EQ(DS_AppData.DecimationLevel, 1);
+    UtAssert_UINT32_EQ(DS_AppData.BacklogPeak, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_DECIMATION_LOWERED_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+
+    UtAssert_VOIDCALL(DS_AppLowerDecimation());
+    UtAssert_UINT32_EQ(DS_AppData.DecimationLevel, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+
+    /* Nominal level is not lowered further */
+    UtAssert_VOIDCALL(DS_AppLowerDecimation());
+    UtAssert_UINT32_EQ(DS_AppData.DecimationLevel, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+}
+
+void DS_AppLowerDecimation_Test_StillBusy(void)
+{
+    DS_AppData.DecimationLevel = 1;
+    DS_AppData.BacklogPeak     = UT_DS_DecimationThreshold(1);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_AppLowerDecimation());
+
+    /* Verify results -- level held, next cycle starts with no backlog measured */
+    UtAssert_UINT32_EQ(DS_AppData.DecimationLevel, 1);
+    UtAssert_UINT32_EQ(DS_AppData.BacklogPeak, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_AppStatsTime_Test_Nominal(void)
+{
+    CFE_TIME_SysTime_t Met = {2, 0x80000000};
+
+    UT_SetDataBuffer(UT_KEY(CFE_TIME_GetMET), &Met, sizeof(Met), false);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TIME_Sub2MicroSecs), 500000);
+
+    /* Execute the function being tested */
+    UtAssert_True(DS_AppStatsTime() == 2500000, "DS_AppStatsTime() == 2.5 seconds");
+
+    /* Verify results - monotonic MET, not the (settable) local time */
+    UtAssert_STUB_COUNT(OS_GetLocalTime, 0);
+}
+
+void DS_AppStatsRecord_Test_Nominal(void)
+{
+    DS_StageStats_t Stats;
+    uint32          Bin = (DS_STATS_HISTOGRAM_BINS > 10) ? 10 : (DS_STATS_HISTOGRAM_BINS - 1);
+
+    memset(&Stats, 0, sizeof(Stats));
+
+    /* Execute the function being tested -- under one microsecond and just under one millisecond */
+    UtAssert_UINT32_EQ(DS_AppStatsRecord(&Stats, 0), 0);
+    UtAssert_UINT32_EQ(DS_AppStatsRecord(&Stats, 999), 999);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(Stats.Count, 2);
+    UtAssert_UINT32_EQ(Stats.MaxTime, 999);
+    UtAssert_UINT32_EQ(Stats.TotalTime, 999);
+    UtAssert_UINT32_EQ(Stats.Histogram[0], 1);
+    UtAssert_UINT32_EQ(Stats.Histogram[Bin], 1);
+}
+
+void DS_AppStatsRecord_Test_Capped(void)
+{
+    DS_StageStats_t Stats;
+
+    memset(&Stats, 0, sizeof(Stats));
+
+    /* Execute the function being tested -- more than an hour */
+    UtAssert_UINT32_EQ(DS_AppStatsRecord(&Stats, (int64)4000 * 1000000), 3600000000U);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(Stats.Count, 1);
+    UtAssert_UINT32_EQ(Stats.MaxTime, 3600000000U);
+    UtAssert_UINT32_EQ(Stats.Histogram[DS_STATS_HISTOGRAM_BINS - 1], 1);
+}
+
+void DS_AppStatsRecord_Test_Negative(void)
+{
+    DS_StageStats_t Stats;
+
+    memset(&Stats, 0, sizeof(Stats));
+
+    /* Execute the function being tested -- MET was set backwards */
+    UtAssert_UINT32_EQ(DS_AppStatsRecord(&Stats, -1000), 0);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(Stats.Count, 1);
+    UtAssert_ZERO(Stats.MaxTime);
+    UtAssert_ZERO(Stats.TotalTime);
+    UtAssert_UINT32_EQ(Stats.Histogram[0], 1);
+}
+
 void UtTest_Setup(void)
 {
     UT_DS_TEST_ADD(DS_AppMain_Test_Nominal);
     UT_DS_TEST_ADD(DS_AppMain_Test_AppInitializeError);
     UT_DS_TEST_ADD(DS_AppMain_Test_SBError);
     UT_DS_TEST_ADD(DS_AppMain_Test_SBTimeout);
+    UT_DS_TEST_ADD(DS_AppMain_Test_PipeEmpty);
 
     UT_DS_TEST_ADD(DS_AppInitialize_Test_Nominal);
     UT_DS_TEST_ADD(DS_AppInitialize_Test_EVSRegisterError);
     UT_DS_TEST_ADD(DS_AppInitialize_Test_SBCreatePipeError);
     UT_DS_TEST_ADD(DS_AppInitialize_Test_SBSubscribeHKError);
     UT_DS_TEST_ADD(DS_AppInitialize_Test_SBSubscribeDSError);
+    UT_DS_TEST_ADD(DS_AppInitialize_Test_SBSubscribeProbeError);
 
     UT_DS_TEST_ADD(DS_AppStorePacket_Test_Nominal);
+    UT_DS_TEST_ADD(DS_AppStorePacket_Test_ReplayEcho);
+    UT_DS_TEST_ADD(DS_AppStorePacket_Test_CacheEcho);
     UT_DS_TEST_ADD(DS_AppStorePacket_Test_DSDisabled);
     UT_DS_TEST_ADD(DS_AppStorePacket_Test_FilterTableNotLoaded);
     UT_DS_TEST_ADD(DS_AppStorePacket_Test_DestFileTableNotLoaded);
+
+    UT_DS_TEST_ADD(DS_AppDecimationLevel_Test_Nominal);
+    UT_DS_TEST_ADD(DS_AppProbeBacklog_Test_Counted);
+    UT_DS_TEST_ADD(DS_AppProbeBacklog_Test_Sent);
+    UT_DS_TEST_ADD(DS_AppProbeBacklog_Test_SendError);
+    UT_DS_TEST_ADD(DS_AppProbeBacklog_Test_Pending);
+    UT_DS_TEST_ADD(DS_AppProbeBacklog_Test_Dropped);
+    UT_DS_TEST_ADD(DS_AppRaiseDecimation_Test_Nominal);
+    UT_DS_TEST_ADD(DS_AppRaiseDecimation_Test_Raised);
+    UT_DS_TEST_ADD(DS_AppLowerDecimation_Test_Lowered);
+    UT_DS_TEST_ADD(DS_AppLowerDecimation_Test_StillBusy);
+
+    UT_DS_TEST_ADD(DS_AppStatsTime_Test_Nominal);
+    UT_DS_TEST_ADD(DS_AppStatsRecord_Test_Nominal);
+    UT_DS_TEST_ADD(DS_AppStatsRecord_Test_Capped);
+    UT_DS_TEST_ADD(DS_AppStatsRecord_Test_Negative);
 }
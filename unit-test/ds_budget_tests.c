@@ -0,0 +1,322 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   This file contains system call budget test cases for the DS storage path
+ *
+ * @note
+ *   These tests link the real dispatch, app, command, file and table
+ *   functions together and drive packet sequences through DS_AppPipe.
+ *   Only the OSAL and cFE calls are stubbed, so the stub counters show
+ *   how many API calls each stored packet, file rollover and housekeeping
+ *   cycle costs.  The budgets are upper bounds - a change that adds a
+ *   call to one of these paths must raise its budget here on purpose.
+ */
+
+/*
+ * Includes
+ */
+
+#include "ds_app.h"
+#include "ds_dispatch.h"
+#include "ds_msg.h"
+#include "ds_msgdefs.h"
+#include "ds_msgids.h"
+#include "ds_table.h"
+#include "ds_test_utils.h"
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+/* Number of events in each budget test sequence */
+#define UT_DS_BUDGET_EVENTS 100
+
+/* Packet size used for stored packets */
+#define UT_DS_BUDGET_PKT_SIZE 64
+
+/* Performance log markers are only counted when detailed performance logging is enabled */
+#define UT_DS_BUDGET_PERF(Markers) ((DS_DETAIL_PERF_LOG == 1) ? (Markers) : 0)
+
+/* MET reads and the statistics packet are only counted when storage path timing is enabled */
+#define UT_DS_BUDGET_STATS(Calls) ((DS_STATS_TIMING == 1) ? (Calls) : 0)
+
+/* Packet size reads for the latest-value cache copy are only counted when the cache is enabled */
+#define UT_DS_BUDGET_CACHE(Calls) ((DS_CACHE_ENTRIES != 0) ? (Calls) : 0)
+
+/* Upper bound on calls to one OSAL or cFE function over a packet sequence */
+typedef struct
+{
+    UT_EntryKey_t FuncKey;  /* Stub counter for the function */
+    const char *  FuncName; /* Function name for reporting */
+    uint32        PerEvent; /* Calls allowed per stored packet, rollover or HK cycle */
+    uint32        Start;    /* Stub count when the sequence started */
+} UT_DS_Budget_t;
+
+#define UT_DS_BUDGET(Func, PerEvent) {UT_KEY(Func), #Func, PerEvent, 0}
+
+/* Message returned by the CFE_MSG stubs for the next call to DS_AppPipe */
+CFE_SB_MsgId_t UT_DS_BudgetMsgId;
+CFE_MSG_Size_t UT_DS_BudgetMsgSize;
+
+/*
+ * Helper Functions
+ */
+
+void UT_DS_Budget_GetMsgIdHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CFE_SB_MsgId_t *MsgId = UT_Hook_GetArgValueByName(Context, "MsgId", CFE_SB_MsgId_t *);
+
+    *MsgId = UT_DS_BudgetMsgId;
+}
+
+void UT_DS_Budget_GetSizeHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CFE_MSG_Size_t *Size = UT_Hook_GetArgValueByName(Context, "Size", CFE_MSG_Size_t *);
+
+    *Size = UT_DS_BudgetMsgSize;
+}
+
+void UT_DS_BudgetSetup(uint32 MaxFileSize, uint32 MaxFileAge)
+{
+    DS_DestFileEntry_t *DestFile    = &DS_AppData.DestFileTblPtr->File[0];
+    DS_PacketEntry_t *  PacketEntry = &DS_AppData.FilterTblPtr->Packet[0];
+
+    /* One linear destination file named by count */
+    strncpy(DestFile->Pathname, "path", sizeof(DestFile->Pathname));
+    strncpy(DestFile->Basename, "base", sizeof(DestFile->Basename));
+    strncpy(DestFile->Extension, "ext", sizeof(DestFile->Extension));
+
+    DestFile->FileNameType = DS_BY_COUNT;
+    DestFile->EnableState  = DS_ENABLED;
+    DestFile->FileMode     = DS_FILE_MODE_LINEAR;
+    DestFile->MaxFileSize  = MaxFileSize;
+    DestFile->MaxFileAge   = MaxFileAge;
+
+    DS_AppData.FileStatus[0].FileState = DS_ENABLED;
+
+    /* One message ID, every packet passed to the destination */
+    PacketEntry->MessageID                = DS_UT_MID_1;
+    PacketEntry->Filter[0].FileTableIndex = 0;
+    PacketEntry->Filter[0].FilterType     = DS_BY_COUNT;
+    PacketEntry->Filter[0].Algorithm_N    = 1;
+    PacketEntry->Filter[0].Algorithm_X    = 1;
+    PacketEntry->Filter[0].Algorithm_O    = 0;
+
+    DS_TableCreateHash();
+
+    DS_AppData.AppEnableState = DS_ENABLED;
+
+    /* Replay echo table is shared with the replay task */
+    DS_AppData.ReplayEcho.MutexId = DS_UT_OBJID_1;
+
+    UT_SetHandlerFunction(UT_KEY(CFE_MSG_GetMsgId), UT_DS_Budget_GetMsgIdHandler, NULL);
+    UT_SetHandlerFunction(UT_KEY(CFE_MSG_GetSize), UT_DS_Budget_GetSizeHandler, NULL);
+}
+
+void UT_DS_BudgetStorePacket(void)
+{
+    UT_DS_BudgetMsgId   = DS_UT_MID_1;
+    UT_DS_BudgetMsgSize = UT_DS_BUDGET_PKT_SIZE;
+
+    DS_AppPipe(&UT_CmdBuf.Buf);
+}
+
+void UT_DS_BudgetSendHk(void)
+{
+    UT_DS_BudgetMsgId   = CFE_SB_ValueToMsgId(DS_SEND_HK_MID);
+    UT_DS_BudgetMsgSize = sizeof(DS_SendHkCmd_t);
+
+    DS_AppPipe(&UT_CmdBuf.Buf);
+}
+
+void UT_DS_BudgetStart(UT_DS_Budget_t *Budget, uint32 Count)
+{
+    uint32 i;
+
+    for (i = 0; i < Count; i++)
+    {
+        Budget[i].Start = UT_GetStubCount(Budget[i].FuncKey);
+    }
+}
+
+void UT_DS_BudgetCheck(const UT_DS_Budget_t *Budget, uint32 Count, uint32 Events, const char *EventName)
+{
+    uint32 Used;
+    uint32 i;
+
+    for (i = 0; i < Count; i++)
+    {
+        Used = UT_GetStubCount(Budget[i].FuncKey) - Budget[i].Start;
+
+        UtAssert_True(Used <= (Budget[i].PerEvent * Events), "%s: %lu calls for %lu %s (budget %lu per %s)",
+                      Budget[i].FuncName, (unsigned long)Used, (unsigned long)Events, EventName,
+                      (unsigned long)Budget[i].PerEvent, EventName);
+    }
+}
+
+/*
+ * Function Definitions
+ */
+
+void DS_Budget_Test_StorePacket(void)
+{
+    UT_DS_Budget_t Budget[] = {
+        UT_DS_BUDGET(OS_write, 1),
+        UT_DS_BUDGET(OS_lseek, 0),
+        UT_DS_BUDGET(OS_read, 0),
+        UT_DS_BUDGET(OS_OpenCreate, 0),
+        UT_DS_BUDGET(OS_close, 0),
+        UT_DS_BUDGET(OS_mv, 0),
+        UT_DS_BUDGET(CFE_MSG_GetMsgId, 1),
+        UT_DS_BUDGET(CFE_MSG_GetSize, 1 + UT_DS_BUDGET_CACHE(1)), /* Destination write and cache copy */
+        UT_DS_BUDGET(CFE_MSG_GetSequenceCount, 1),
+        UT_DS_BUDGET(CFE_MSG_GetMsgTime, 0),
+        UT_DS_BUDGET(CFE_TIME_GetTime, 0),
+        UT_DS_BUDGET(CFE_TIME_GetMET, UT_DS_BUDGET_STATS(4)),
+        UT_DS_BUDGET(OS_MutSemTake, 1),
+        UT_DS_BUDGET(CFE_SB_TransmitMsg, 0),
+        UT_DS_BUDGET(CFE_SB_TransmitBuffer, 0),
+        UT_DS_BUDGET(CFE_EVS_SendEvent, 0),
+        UT_DS_BUDGET(CFE_ES_PerfLogAdd, UT_DS_BUDGET_PERF(6)),
+    };
+    uint32 Count = sizeof(Budget) / sizeof(Budget[0]);
+    uint32 i;
+
+    UT_DS_BudgetSetup(0xFFFFFFFF, 0xFFFFFFFF);
+
+    /* The first packet creates the destination file */
+    UT_DS_BudgetStorePacket();
+
+    UT_DS_BudgetStart(Budget, Count);
+
+    /* Execute the function being tested */
+    for (i = 0; i < UT_DS_BUDGET_EVENTS; i++)
+    {
+        UT_DS_BudgetStorePacket();
+    }
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.PassedPktCounter, UT_DS_BUDGET_EVENTS + 1);
+    UtAssert_UINT32_EQ(DS_AppData.DestStats[0].PacketCount, UT_DS_BUDGET_EVENTS + 1);
+    UtAssert_ZERO(DS_AppData.DestStats[0].RolloverCount);
+
+    UT_DS_BudgetCheck(Budget, Count, UT_DS_BUDGET_EVENTS, "packet");
+}
+
+void DS_Budget_Test_Rollover(void)
+{
+    /* Each rollover also stores the packet that caused it */
+    UT_DS_Budget_t Budget[] = {
+        UT_DS_BUDGET(OS_write, 3),
+        UT_DS_BUDGET(OS_lseek, 1),
+        UT_DS_BUDGET(OS_read, 0),
+        UT_DS_BUDGET(OS_OpenCreate, 1),
+        UT_DS_BUDGET(OS_close, 1),
+        UT_DS_BUDGET(OS_mv, 0),
+        UT_DS_BUDGET(CFE_FS_WriteHeader, 1),
+        UT_DS_BUDGET(CFE_MSG_GetMsgId, 1),
+        UT_DS_BUDGET(CFE_MSG_GetSize, 1 + UT_DS_BUDGET_CACHE(1)), /* Destination write and cache copy */
+        UT_DS_BUDGET(CFE_MSG_GetSequenceCount, 1),
+        UT_DS_BUDGET(CFE_MSG_Init, 1),
+        UT_DS_BUDGET(CFE_TIME_GetTime, 1),
+        UT_DS_BUDGET(CFE_TIME_GetMET, UT_DS_BUDGET_STATS(8)),
+        UT_DS_BUDGET(OS_MutSemTake, 1),
+        UT_DS_BUDGET(CFE_SB_AllocateMessageBuffer, 1),
+        UT_DS_BUDGET(CFE_SB_TransmitMsg, 0),
+        UT_DS_BUDGET(CFE_SB_TransmitBuffer, 1),
+        UT_DS_BUDGET(CFE_ES_CopyToCDS, 1),
+        UT_DS_BUDGET(CFE_EVS_SendEvent, 0),
+        UT_DS_BUDGET(CFE_ES_PerfLogAdd, UT_DS_BUDGET_PERF(10)),
+    };
+    uint32 Count = sizeof(Budget) / sizeof(Budget[0]);
+    uint32 i;
+
+    /* Every packet after the first exceeds the size limit */
+    UT_DS_BudgetSetup(1, 0xFFFFFFFF);
+
+    /* The first packet creates the destination file */
+    UT_DS_BudgetStorePacket();
+
+    UT_DS_BudgetStart(Budget, Count);
+
+    /* Execute the function being tested */
+    for (i = 0; i < UT_DS_BUDGET_EVENTS; i++)
+    {
+        UT_DS_BudgetStorePacket();
+    }
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.PassedPktCounter, UT_DS_BUDGET_EVENTS + 1);
+    UtAssert_UINT32_EQ(DS_AppData.DestStats[0].RolloverCount, UT_DS_BUDGET_EVENTS);
+
+    UT_DS_BudgetCheck(Budget, Count, UT_DS_BUDGET_EVENTS, "rollover");
+}
+
+void DS_Budget_Test_SendHk(void)
+{
+    UT_DS_Budget_t Budget[] = {
+        UT_DS_BUDGET(OS_write, 0),
+        UT_DS_BUDGET(OS_lseek, 0),
+        UT_DS_BUDGET(OS_read, 0),
+        UT_DS_BUDGET(OS_OpenCreate, 0),
+        UT_DS_BUDGET(OS_close, 0),
+        UT_DS_BUDGET(CFE_MSG_GetMsgId, 1),
+        UT_DS_BUDGET(CFE_MSG_GetSize, 1),
+        UT_DS_BUDGET(CFE_MSG_Init, 2 + UT_DS_BUDGET_STATS(1)),
+        UT_DS_BUDGET(CFE_SB_TimeStampMsg, 1 + UT_DS_BUDGET_STATS(1)),
+        UT_DS_BUDGET(CFE_SB_TransmitMsg, 1 + UT_DS_BUDGET_STATS(1)),
+        UT_DS_BUDGET(CFE_SB_AllocateMessageBuffer, 1),
+        UT_DS_BUDGET(CFE_SB_TransmitBuffer, 1),
+        UT_DS_BUDGET(CFE_TBL_GetStatus, 2),
+        UT_DS_BUDGET(CFE_TBL_GetInfo, 1),
+        UT_DS_BUDGET(CFE_TBL_GetAddress, 0),
+        UT_DS_BUDGET(CFE_EVS_SendEvent, 0),
+        UT_DS_BUDGET(CFE_ES_PerfLogAdd, UT_DS_BUDGET_PERF(2)),
+    };
+    uint32 Count = sizeof(Budget) / sizeof(Budget[0]);
+    uint32 i;
+
+    UT_DS_BudgetSetup(0xFFFFFFFF, 0xFFFFFFFF);
+
+    /* Housekeeping also ages the open destination file */
+    UT_DS_BudgetStorePacket();
+
+    UT_DS_BudgetStart(Budget, Count);
+
+    /* Execute the function being tested */
+    for (i = 0; i < UT_DS_BUDGET_EVENTS; i++)
+    {
+        UT_DS_BudgetSendHk();
+    }
+
+    /* Verify results */
+    UtAssert_ZERO(DS_AppData.CmdRejectedCounter);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[0].FileAge, UT_DS_BUDGET_EVENTS * DS_SECS_PER_HK_CYCLE);
+
+    UT_DS_BudgetCheck(Budget, Count, UT_DS_BUDGET_EVENTS, "HK cycle");
+}
+
+void UtTest_Setup(void)
+{
+    UT_DS_TEST_ADD(DS_Budget_Test_StorePacket);
+    UT_DS_TEST_ADD(DS_Budget_Test_Rollover);
+    UT_DS_TEST_ADD(DS_Budget_Test_SendHk);
+}
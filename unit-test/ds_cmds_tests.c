@@ -49,6 +49,20 @@
 #define CMD_STRUCT_DATA_IS_32_ALIGNED(x) ((sizeof(x) - sizeof(CFE_MSG_CommandHeader_t)) % 4) == 0
 #define TLM_STRUCT_DATA_IS_32_ALIGNED(x) ((sizeof(x) - sizeof(CFE_MSG_TelemetryHeader_t)) % 4) == 0
 
+void UT_DS_FileCacheFind_CustomHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    const DS_CacheEntry_t *Entry = UserObj;
+
+    UT_Stub_SetReturnValue(FuncKey, Entry);
+}
+
+void UT_DS_AppRaiseDecimation_CustomHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    uint32 *Backlog = UserObj;
+
+    *Backlog = UT_Hook_GetArgValueByName(Context, "Backlog", uint32);
+}
+
 /*
  * Function Definitions
  */
@@ -71,6 +85,11 @@ void DS_NoopCmd_Test_Nominal(void)
 
 void DS_ResetCountersCmd_Test_Nominal(void)
 {
+    DS_AppData.Stats.Write.Count                                  = 1;
+    DS_AppData.Stats.Close.Histogram[DS_STATS_HISTOGRAM_BINS - 1] = 1;
+    DS_AppData.DestStats[DS_DEST_FILE_CNT - 1].PacketCount        = 1;
+    DS_AppData.CacheOverflowCounter                               = 1;
+
     /* Execute the function being tested */
     UtAssert_VOIDCALL(DS_ResetCountersCmd(&UT_CmdBuf.ResetCountersCmd));
 
@@ -81,14 +100,24 @@ void DS_ResetCountersCmd_Test_Nominal(void)
     UtAssert_ZERO(DS_AppData.IgnoredPktCounter);
     UtAssert_ZERO(DS_AppData.FilteredPktCounter);
     UtAssert_ZERO(DS_AppData.PassedPktCounter);
+    UtAssert_ZERO(DS_AppData.RateDropPktCounter);
     UtAssert_ZERO(DS_AppData.FileWriteCounter);
     UtAssert_ZERO(DS_AppData.FileWriteErrCounter);
     UtAssert_ZERO(DS_AppData.FileUpdateCounter);
     UtAssert_ZERO(DS_AppData.FileUpdateErrCounter);
+    UtAssert_ZERO(DS_AppData.EvictedFileCounter);
+    UtAssert_ZERO(DS_AppData.ExtractErrCounter);
+    UtAssert_ZERO(DS_AppData.ReplayErrCounter);
+    UtAssert_ZERO(DS_AppData.CompressRawBytes);
+    UtAssert_ZERO(DS_AppData.CompressFileBytes);
     UtAssert_ZERO(DS_AppData.DestTblLoadCounter);
     UtAssert_ZERO(DS_AppData.DestTblErrCounter);
     UtAssert_ZERO(DS_AppData.FilterTblLoadCounter);
     UtAssert_ZERO(DS_AppData.FilterTblErrCounter);
+    UtAssert_ZERO(DS_AppData.Stats.Write.Count);
+    UtAssert_ZERO(DS_AppData.Stats.Close.Histogram[DS_STATS_HISTOGRAM_BINS - 1]);
+    UtAssert_ZERO(DS_AppData.DestStats[DS_DEST_FILE_CNT - 1].PacketCount);
+    UtAssert_ZERO(DS_AppData.CacheOverflowCounter);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_RESET_INF_EID);
@@ -150,6 +179,8 @@ void DS_SetFilterFileCmd_Test_Nominal(void)
 
     DS_AppData.FilterTblPtr->Packet->MessageID = DS_UT_MID_1;
     DS_AppData.FilterTblPtr->Packet[forced_FilterTableIndex].Filter[CmdPayload->FilterParmsIndex].FileTableIndex = 0;
+    DS_AppData.FilterChange[forced_FilterTableIndex][CmdPayload->FilterParmsIndex].Stored                        = true;
+    DS_AppData.FilterWindow[forced_FilterTableIndex][CmdPayload->FilterParmsIndex].Stored                        = true;
 
     UT_SetDefaultReturnValue(UT_KEY(DS_TableVerifyFileIndex), true);
     UT_SetDefaultReturnValue(UT_KEY(DS_TableFindMsgID), forced_FilterTableIndex);
@@ -165,6 +196,8 @@ void DS_SetFilterFileCmd_Test_Nominal(void)
             CmdPayload->FileTableIndex,
         "DS_AppData.FilterTblPtr->Packet[forced_FilterTableIndex].Filter[CmdPayload->"
         "FilterParmsIndex].FileTableIndex == CmdPayload->FileTableIndex");
+    UtAssert_BOOL_FALSE(DS_AppData.FilterChange[forced_FilterTableIndex][CmdPayload->FilterParmsIndex].Stored);
+    UtAssert_BOOL_FALSE(DS_AppData.FilterWindow[forced_FilterTableIndex][CmdPayload->FilterParmsIndex].Stored);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FILE_CMD_EID);
@@ -285,8 +318,10 @@ void DS_SetFilterTypeCmd_Test_Nominal(void)
     CmdPayload->FilterType       = 1;
 
     DS_AppData.FilterTblPtr->Packet->MessageID = DS_UT_MID_1;
+    DS_AppData.FilterChange[0][2].Stored       = true;
+    DS_AppData.FilterWindow[0][2].Stored       = true;
 
-    UT_SetDefaultReturnValue(UT_KEY(DS_TableVerifyType), true);
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableVerifyFilterType), true);
 
     /* Execute the function being tested */
     UtAssert_VOIDCALL(DS_SetFilterTypeCmd(&UT_CmdBuf.FilterTypeCmd));
@@ -295,6 +330,8 @@ void DS_SetFilterTypeCmd_Test_Nominal(void)
     UtAssert_UINT32_EQ(DS_AppData.CmdAcceptedCounter, 1);
 
     UtAssert_UINT32_EQ(DS_AppData.FilterTblPtr->Packet[0].Filter[CmdPayload->FilterParmsIndex].FilterType, 1);
+    UtAssert_BOOL_FALSE(DS_AppData.FilterChange[0][CmdPayload->FilterParmsIndex].Stored);
+    UtAssert_BOOL_FALSE(DS_AppData.FilterWindow[0][CmdPayload->FilterParmsIndex].Stored);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FTYPE_CMD_EID);
@@ -366,7 +403,7 @@ void DS_SetFilterTypeCmd_Test_FilterTableNotLoaded(void)
     CmdPayload->FilterParmsIndex = 1;
     CmdPayload->FilterType       = 1;
 
-    UT_SetDefaultReturnValue(UT_KEY(DS_TableVerifyType), true);
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableVerifyFilterType), true);
 
     /* Reset table pointer to NULL (set in test setup) */
     DS_AppData.FilterTblPtr = NULL;
@@ -390,7 +427,7 @@ void DS_SetFilterTypeCmd_Test_MessageIDNotInFilterTable(void)
     CmdPayload->FilterParmsIndex = 1;
     CmdPayload->FilterType       = 1;
 
-    UT_SetDefaultReturnValue(UT_KEY(DS_TableVerifyType), true);
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableVerifyFilterType), true);
     UT_SetDefaultReturnValue(UT_KEY(DS_TableFindMsgID), DS_INDEX_NONE);
 
     /* Execute the function being tested */
@@ -414,6 +451,9 @@ void DS_SetFilterParmsCmd_Test_Nominal(void)
     CmdPayload->Algorithm_X      = 0;
     CmdPayload->Algorithm_O      = 0;
 
+    DS_AppData.FilterChange[0][2].Stored = true;
+    DS_AppData.FilterWindow[0][2].Stored = true;
+
     UT_SetDefaultReturnValue(UT_KEY(DS_TableVerifyParms), true);
 
     /* Execute the function being tested */
@@ -425,6 +465,8 @@ void DS_SetFilterParmsCmd_Test_Nominal(void)
     UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[0].Filter[CmdPayload->FilterParmsIndex].Algorithm_N);
     UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[0].Filter[CmdPayload->FilterParmsIndex].Algorithm_X);
     UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[0].Filter[CmdPayload->FilterParmsIndex].Algorithm_O);
+    UtAssert_BOOL_FALSE(DS_AppData.FilterChange[0][CmdPayload->FilterParmsIndex].Stored);
+    UtAssert_BOOL_FALSE(DS_AppData.FilterWindow[0][CmdPayload->FilterParmsIndex].Stored);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_PARMS_CMD_EID);
@@ -1378,352 +1420,1560 @@ void DS_GetFileInfoCmd_Test_DisabledClosed(void)
     /* Generates 1 event message we don't care about in this test */
 }
 
-void DS_AddMIDCmd_Test_Nominal(void)
+void DS_GetDestStatsCmd_Test_Nominal(void)
 {
-    int32 FilterTableIndex;
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_GetDestStatsCmd(&UT_CmdBuf.GetDestStatsCmd));
 
-    DS_AddRemoveMid_Payload_t *CmdPayload = &UT_CmdBuf.AddMidCmd.Payload;
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.CmdAcceptedCounter, 1);
+    UtAssert_STUB_COUNT(DS_FileTransmitDestStats, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_GET_DEST_STATS_CMD_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
 
     /* Verify command struct size minus header is at least explicitly padded to 32-bit boundaries */
-    UtAssert_True(CMD_STRUCT_DATA_IS_32_ALIGNED(DS_AddMidCmd_t), "DS_AddMidCmd_t is 32-bit aligned");
+    UtAssert_True(CMD_STRUCT_DATA_IS_32_ALIGNED(DS_GetDestStatsCmd_t), "DS_GetDestStatsCmd_t is 32-bit aligned");
+    UtAssert_True(TLM_STRUCT_DATA_IS_32_ALIGNED(DS_DestStatsPkt_t), "DS_DestStatsPkt_t is 32-bit aligned");
+}
 
-    CmdPayload->MessageID = DS_UT_MID_1;
+void DS_SetRecorderCmd_Test_Nominal(void)
+{
+    DS_SetRecorder_Payload_t *CmdPayload = &UT_CmdBuf.SetRecorderCmd.Payload;
 
-    DS_AppData.FilterTblPtr->Packet[0].MessageID = CFE_SB_INVALID_MSG_ID;
-    DS_AppData.FilterTblPtr->Packet[1].MessageID = DS_UT_MID_2;
+    CmdPayload->RecorderIndex      = 1;
+    CmdPayload->RecorderState      = DS_ENABLED;
+    CmdPayload->FileTableIndex     = 2;
+    CmdPayload->PostTriggerSeconds = 10;
+    CmdPayload->TriggerMsgID       = DS_UT_MID_1;
 
-    FilterTableIndex = 0;
+    DS_AppData.Recorder[1].Head = 100;
+    DS_AppData.Recorder[1].Tail = 40;
 
-    /* for nominal case, first call to DS_TableFindMsgID must return
-     * DS_INDEX_NONE and the second call must return something other than
-     * DS_INDEX_NONE */
-    UT_SetDeferredRetcode(UT_KEY(DS_TableFindMsgID), 1, DS_INDEX_NONE);
-    UT_SetDeferredRetcode(UT_KEY(DS_TableFindMsgID), 1, 0);
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableVerifyState), true);
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableVerifyFileIndex), true);
 
     /* Execute the function being tested */
-    UtAssert_VOIDCALL(DS_AddMidCmd(&UT_CmdBuf.AddMidCmd));
+    UtAssert_INT32_EQ(DS_SetRecorderCmd(&UT_CmdBuf.SetRecorderCmd), CFE_SUCCESS);
 
     /* Verify results */
     UtAssert_UINT32_EQ(DS_AppData.CmdAcceptedCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.Recorder[1].State, DS_RECORDER_HOLDING);
+    UtAssert_UINT32_EQ(DS_AppData.Recorder[1].FileTableIndex, 2);
+    UtAssert_UINT32_EQ(DS_AppData.Recorder[1].PostSeconds, 10);
+    UtAssert_UINT32_EQ(DS_AppData.Recorder[1].Head, 0);
+    UtAssert_UINT32_EQ(DS_AppData.Recorder[1].Tail, 0);
+    UtAssert_UINT32_EQ(DS_AppData.DestRecorder[2], 2);
 
-    UtAssert_BOOL_TRUE(CFE_SB_MsgId_Equal(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].MessageID, DS_UT_MID_1));
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_SET_RECORDER_CMD_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
 
-    /* Check first elements */
-    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[0].FileTableIndex);
-    UtAssert_UINT8_EQ(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[0].FilterType, DS_BY_COUNT);
-    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[0].Algorithm_N);
-    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[0].Algorithm_X);
-    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[0].Algorithm_O);
+    /* Verify command struct size minus header is at least explicitly padded to 32-bit boundaries */
+    UtAssert_True(CMD_STRUCT_DATA_IS_32_ALIGNED(DS_SetRecorderCmd_t), "DS_SetRecorderCmd_t is 32-bit aligned");
+}
 
-    /* Check middle elements */
-    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[DS_FILTERS_PER_PACKET / 2].FileTableIndex);
-    UtAssert_UINT8_EQ(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[DS_FILTERS_PER_PACKET / 2].FilterType,
-                      DS_BY_COUNT);
-    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[DS_FILTERS_PER_PACKET / 2].Algorithm_N);
-    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[DS_FILTERS_PER_PACKET / 2].Algorithm_X);
-    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[DS_FILTERS_PER_PACKET / 2].Algorithm_O);
+void DS_SetRecorderCmd_Test_MoveDest(void)
+{
+    DS_SetRecorder_Payload_t *CmdPayload = &UT_CmdBuf.SetRecorderCmd.Payload;
 
-    /* Check last elements */
-    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[DS_FILTERS_PER_PACKET - 1].FileTableIndex);
-    UtAssert_UINT8_EQ(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[DS_FILTERS_PER_PACKET - 1].FilterType,
-                      DS_BY_COUNT);
-    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[DS_FILTERS_PER_PACKET - 1].Algorithm_N);
-    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[DS_FILTERS_PER_PACKET - 1].Algorithm_X);
-    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[DS_FILTERS_PER_PACKET - 1].Algorithm_O);
+    CmdPayload->RecorderIndex  = 0;
+    CmdPayload->RecorderState  = DS_ENABLED;
+    CmdPayload->FileTableIndex = 3;
+
+    DS_AppData.Recorder[0].State          = DS_RECORDER_HOLDING;
+    DS_AppData.Recorder[0].FileTableIndex = 1;
+    DS_AppData.DestRecorder[1]            = 1;
+
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableVerifyState), true);
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableVerifyFileIndex), true);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_SetRecorderCmd(&UT_CmdBuf.SetRecorderCmd), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.CmdAcceptedCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.DestRecorder[1], 0);
+    UtAssert_UINT32_EQ(DS_AppData.DestRecorder[3], 1);
+    UtAssert_UINT32_EQ(DS_AppData.Recorder[0].FileTableIndex, 3);
+}
+
+void DS_SetRecorderCmd_Test_Disable(void)
+{
+    DS_SetRecorder_Payload_t *CmdPayload = &UT_CmdBuf.SetRecorderCmd.Payload;
+
+    CmdPayload->RecorderIndex = 0;
+    CmdPayload->RecorderState = DS_DISABLED;
+
+    DS_AppData.Recorder[0].State          = DS_RECORDER_DUMPING;
+    DS_AppData.Recorder[0].FileTableIndex = 1;
+    DS_AppData.DestRecorder[1]            = 1;
+
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableVerifyState), true);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_SetRecorderCmd(&UT_CmdBuf.SetRecorderCmd), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.CmdAcceptedCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.Recorder[0].State, DS_RECORDER_OFF);
+    UtAssert_UINT32_EQ(DS_AppData.DestRecorder[1], 0);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_ADD_MID_CMD_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_SET_RECORDER_CMD_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
 }
 
-void DS_AddMIDCmd_Test_InvalidMessageID(void)
+void DS_SetRecorderCmd_Test_InvalidRecorderIndex(void)
 {
-    DS_AddRemoveMid_Payload_t *CmdPayload = &UT_CmdBuf.AddMidCmd.Payload;
+    DS_SetRecorder_Payload_t *CmdPayload = &UT_CmdBuf.SetRecorderCmd.Payload;
 
-    CmdPayload->MessageID = CFE_SB_INVALID_MSG_ID;
+    CmdPayload->RecorderIndex = DS_RECORDER_CNT;
 
     /* Execute the function being tested */
-    UtAssert_VOIDCALL(DS_AddMidCmd(&UT_CmdBuf.AddMidCmd));
+    UtAssert_INT32_EQ(DS_SetRecorderCmd(&UT_CmdBuf.SetRecorderCmd), CFE_SUCCESS);
 
     /* Verify results */
     UtAssert_UINT32_EQ(DS_AppData.CmdRejectedCounter, 1);
+    UtAssert_STUB_COUNT(DS_TableVerifyState, 0);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_ADD_MID_CMD_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_SET_RECORDER_CMD_ERR_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 }
 
-void DS_AddMIDCmd_Test_FilterTableNotLoaded(void)
+void DS_SetRecorderCmd_Test_InvalidRecorderState(void)
 {
-    DS_AddRemoveMid_Payload_t *CmdPayload = &UT_CmdBuf.AddMidCmd.Payload;
+    DS_SetRecorder_Payload_t *CmdPayload = &UT_CmdBuf.SetRecorderCmd.Payload;
 
-    CmdPayload->MessageID = DS_UT_MID_1;
+    CmdPayload->RecorderIndex = 0;
+    CmdPayload->RecorderState = 99;
 
-    /* Reset table pointer to NULL (set in test setup) */
-    DS_AppData.FilterTblPtr = NULL;
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableVerifyState), false);
 
     /* Execute the function being tested */
-    UtAssert_VOIDCALL(DS_AddMidCmd(&UT_CmdBuf.AddMidCmd));
+    UtAssert_INT32_EQ(DS_SetRecorderCmd(&UT_CmdBuf.SetRecorderCmd), CFE_SUCCESS);
 
     /* Verify results */
     UtAssert_UINT32_EQ(DS_AppData.CmdRejectedCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.Recorder[0].State, DS_RECORDER_OFF);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_ADD_MID_CMD_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_SET_RECORDER_CMD_ERR_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 }
 
-void DS_AddMIDCmd_Test_MIDAlreadyInFilterTable(void)
+void DS_SetRecorderCmd_Test_InvalidFileTableIndex(void)
 {
-    DS_AddRemoveMid_Payload_t *CmdPayload = &UT_CmdBuf.AddMidCmd.Payload;
+    DS_SetRecorder_Payload_t *CmdPayload = &UT_CmdBuf.SetRecorderCmd.Payload;
 
-    CmdPayload->MessageID                      = DS_UT_MID_1;
-    DS_AppData.FilterTblPtr->Packet->MessageID = DS_UT_MID_1;
+    CmdPayload->RecorderIndex  = 0;
+    CmdPayload->RecorderState  = DS_ENABLED;
+    CmdPayload->FileTableIndex = DS_DEST_FILE_CNT;
 
-    UT_SetDeferredRetcode(UT_KEY(DS_TableFindMsgID), 1, 1);
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableVerifyState), true);
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableVerifyFileIndex), false);
 
     /* Execute the function being tested */
-    UtAssert_VOIDCALL(DS_AddMidCmd(&UT_CmdBuf.AddMidCmd));
+    UtAssert_INT32_EQ(DS_SetRecorderCmd(&UT_CmdBuf.SetRecorderCmd), CFE_SUCCESS);
 
     /* Verify results */
     UtAssert_UINT32_EQ(DS_AppData.CmdRejectedCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.Recorder[0].State, DS_RECORDER_OFF);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_ADD_MID_CMD_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_SET_RECORDER_CMD_ERR_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 }
 
-void DS_AddMIDCmd_Test_FilterTableFull(void)
+void DS_SetRecorderCmd_Test_DestHeld(void)
 {
-    DS_AddRemoveMid_Payload_t *CmdPayload = &UT_CmdBuf.AddMidCmd.Payload;
+    DS_SetRecorder_Payload_t *CmdPayload = &UT_CmdBuf.SetRecorderCmd.Payload;
 
-    CmdPayload->MessageID = DS_UT_MID_1;
+    CmdPayload->RecorderIndex  = 0;
+    CmdPayload->RecorderState  = DS_ENABLED;
+    CmdPayload->FileTableIndex = 1;
 
-    /* both calls to DS_TableFindMsgID must return DS_INDEX_NONE */
-    UT_SetDefaultReturnValue(UT_KEY(DS_TableFindMsgID), DS_INDEX_NONE);
+    DS_AppData.DestRecorder[1] = 2;
+
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableVerifyState), true);
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableVerifyFileIndex), true);
 
     /* Execute the function being tested */
-    UtAssert_VOIDCALL(DS_AddMidCmd(&UT_CmdBuf.AddMidCmd));
+    UtAssert_INT32_EQ(DS_SetRecorderCmd(&UT_CmdBuf.SetRecorderCmd), CFE_SUCCESS);
 
     /* Verify results */
     UtAssert_UINT32_EQ(DS_AppData.CmdRejectedCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.DestRecorder[1], 2);
+    UtAssert_UINT32_EQ(DS_AppData.Recorder[0].State, DS_RECORDER_OFF);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_ADD_MID_CMD_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_SET_RECORDER_CMD_ERR_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 }
 
-void DS_RemoveMIDCmd_Test_Nominal(void)
+void DS_SetRecorderCmd_Test_Dumping(void)
 {
-    CFE_SB_MsgId_t             MessageID        = DS_UT_MID_1;
-    int32                      FilterTableIndex = 0;
-    int32                      HashTableIndex   = 1;
-    DS_AddRemoveMid_Payload_t *CmdPayload       = &UT_CmdBuf.RemoveMidCmd.Payload;
+    DS_SetRecorder_Payload_t *CmdPayload = &UT_CmdBuf.SetRecorderCmd.Payload;
 
-    /* Verify command struct size minus header is at least explicitly padded to 32-bit boundaries */
-    UtAssert_True(CMD_STRUCT_DATA_IS_32_ALIGNED(DS_RemoveMidCmd_t), "DS_RemoveMidCmd_t is 32-bit aligned");
+    CmdPayload->RecorderIndex  = 0;
+    CmdPayload->RecorderState  = DS_ENABLED;
+    CmdPayload->FileTableIndex = 1;
 
-    CmdPayload->MessageID                                       = MessageID;
-    DS_AppData.FilterTblPtr->Packet[FilterTableIndex].MessageID = MessageID;
+    DS_AppData.Recorder[0].State          = DS_RECORDER_DUMPING;
+    DS_AppData.Recorder[0].FileTableIndex = 1;
+    DS_AppData.DestRecorder[1]            = 1;
 
-    UT_SetDeferredRetcode(UT_KEY(DS_TableFindMsgID), 1, FilterTableIndex);
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableVerifyState), true);
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableVerifyFileIndex), true);
 
     /* Execute the function being tested */
-    UtAssert_VOIDCALL(DS_RemoveMidCmd(&UT_CmdBuf.RemoveMidCmd));
+    UtAssert_INT32_EQ(DS_SetRecorderCmd(&UT_CmdBuf.SetRecorderCmd), CFE_SUCCESS);
 
     /* Verify results */
-    UtAssert_INT32_EQ(CFE_SB_MsgIdToValue(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].MessageID),
-                      CFE_SB_MsgIdToValue(CFE_SB_INVALID_MSG_ID));
-    UtAssert_INT32_EQ(CFE_SB_MsgIdToValue(DS_AppData.HashLinks[HashTableIndex].MessageID),
-                      CFE_SB_MsgIdToValue(CFE_SB_INVALID_MSG_ID));
-
-    /* Check first elements */
-    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[0].FileTableIndex);
-    UtAssert_UINT8_EQ(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[0].FilterType, DS_BY_COUNT);
-    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[0].Algorithm_N);
-    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[0].Algorithm_X);
-    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[0].Algorithm_O);
-
-    /* Check middle elements */
-    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[DS_FILTERS_PER_PACKET / 2].FileTableIndex);
-    UtAssert_UINT8_EQ(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[DS_FILTERS_PER_PACKET / 2].FilterType,
-                      DS_BY_COUNT);
-    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[DS_FILTERS_PER_PACKET / 2].Algorithm_N);
-    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[DS_FILTERS_PER_PACKET / 2].Algorithm_X);
-    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[DS_FILTERS_PER_PACKET / 2].Algorithm_O);
-
-    /* Check last elements */
-    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[DS_FILTERS_PER_PACKET - 1].FileTableIndex);
-    UtAssert_UINT8_EQ(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[DS_FILTERS_PER_PACKET - 1].FilterType,
-                      DS_BY_COUNT);
-    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[DS_FILTERS_PER_PACKET - 1].Algorithm_N);
-    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[DS_FILTERS_PER_PACKET - 1].Algorithm_X);
-    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[DS_FILTERS_PER_PACKET - 1].Algorithm_O);
+    UtAssert_UINT32_EQ(DS_AppData.CmdRejectedCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.Recorder[0].State, DS_RECORDER_DUMPING);
 
-    UtAssert_STUB_COUNT(CFE_SB_IsValidMsgId, 1);
-    UtAssert_STUB_COUNT(DS_TableHashFunction, 1);
-    UtAssert_STUB_COUNT(DS_TableCreateHash, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_REMOVE_MID_CMD_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_SET_RECORDER_CMD_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 }
 
-void DS_RemoveMIDCmd_Test_InvalidMessageID(void)
+void DS_TriggerRecorderCmd_Test_Nominal(void)
 {
-    DS_AddRemoveMid_Payload_t *CmdPayload = &UT_CmdBuf.RemoveMidCmd.Payload;
+    DS_TriggerRecorder_Payload_t *CmdPayload = &UT_CmdBuf.TriggerRecorderCmd.Payload;
 
-    CmdPayload->MessageID = CFE_SB_INVALID_MSG_ID;
+    CmdPayload->RecorderIndex = 1;
+
+    DS_AppData.Recorder[1].State = DS_RECORDER_HOLDING;
 
     /* Execute the function being tested */
-    UtAssert_VOIDCALL(DS_RemoveMidCmd(&UT_CmdBuf.RemoveMidCmd));
+    UtAssert_INT32_EQ(DS_TriggerRecorderCmd(&UT_CmdBuf.TriggerRecorderCmd), CFE_SUCCESS);
 
     /* Verify results */
-    UtAssert_UINT32_EQ(DS_AppData.CmdRejectedCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.CmdAcceptedCounter, 1);
+    UtAssert_STUB_COUNT(DS_FileRecorderTrigger, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_REMOVE_MID_CMD_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    /* Verify command struct size minus header is at least explicitly padded to 32-bit boundaries */
+    UtAssert_True(CMD_STRUCT_DATA_IS_32_ALIGNED(DS_TriggerRecorderCmd_t), "DS_TriggerRecorderCmd_t is 32-bit aligned");
 }
 
-void DS_RemoveMIDCmd_Test_FilterTableNotLoaded(void)
+void DS_TriggerRecorderCmd_Test_InvalidRecorderIndex(void)
 {
-    DS_AddRemoveMid_Payload_t *CmdPayload = &UT_CmdBuf.RemoveMidCmd.Payload;
+    DS_TriggerRecorder_Payload_t *CmdPayload = &UT_CmdBuf.TriggerRecorderCmd.Payload;
 
-    CmdPayload->MessageID = DS_UT_MID_1;
-
-    /* Reset table pointer to NULL (set in test setup) */
-    DS_AppData.FilterTblPtr = NULL;
+    CmdPayload->RecorderIndex = DS_RECORDER_CNT;
 
     /* Execute the function being tested */
-    UtAssert_VOIDCALL(DS_RemoveMidCmd(&UT_CmdBuf.RemoveMidCmd));
+    UtAssert_INT32_EQ(DS_TriggerRecorderCmd(&UT_CmdBuf.TriggerRecorderCmd), CFE_SUCCESS);
 
     /* Verify results */
     UtAssert_UINT32_EQ(DS_AppData.CmdRejectedCounter, 1);
+    UtAssert_STUB_COUNT(DS_FileRecorderTrigger, 0);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_REMOVE_MID_CMD_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_TRIGGER_RECORDER_CMD_ERR_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 }
 
-void DS_RemoveMIDCmd_Test_MessageIDNotAdded(void)
+void DS_TriggerRecorderCmd_Test_NotHolding(void)
 {
-    DS_AddRemoveMid_Payload_t *CmdPayload = &UT_CmdBuf.RemoveMidCmd.Payload;
+    DS_TriggerRecorder_Payload_t *CmdPayload = &UT_CmdBuf.TriggerRecorderCmd.Payload;
 
-    UT_SetDefaultReturnValue(UT_KEY(DS_TableFindMsgID), DS_INDEX_NONE);
+    CmdPayload->RecorderIndex = 0;
 
-    CmdPayload->MessageID = DS_UT_MID_1;
+    DS_AppData.Recorder[0].State = DS_RECORDER_DUMPING;
 
     /* Execute the function being tested */
-    UtAssert_VOIDCALL(DS_RemoveMidCmd(&UT_CmdBuf.RemoveMidCmd));
+    UtAssert_INT32_EQ(DS_TriggerRecorderCmd(&UT_CmdBuf.TriggerRecorderCmd), CFE_SUCCESS);
 
     /* Verify results */
     UtAssert_UINT32_EQ(DS_AppData.CmdRejectedCounter, 1);
+    UtAssert_STUB_COUNT(DS_FileRecorderTrigger, 0);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_REMOVE_MID_CMD_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_TRIGGER_RECORDER_CMD_ERR_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 }
 
-void DS_AppSendHkCmd_Test(void)
+void DS_SendCacheCmd_Test_Nominal(void)
 {
-    uint32 i;
+    DS_SendCache_Payload_t *CmdPayload = &UT_CmdBuf.SendCacheCmd.Payload;
 
-    /* Most values in the HK packet can't be checked because they're stored in a local variable. */
+    CmdPayload->MessageID = DS_UT_MID_1;
 
-    for (i = 0; i < DS_DEST_FILE_CNT; i++)
-    {
-        DS_AppData.FileStatus[i].FileGrowth = 99;
-    }
+    DS_AppData.Cache[0].MessageID    = DS_UT_MID_1;
+    DS_AppData.Cache[0].PacketLength = 32;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_IsValidMsgId), true);
+    UT_SetHandlerFunction(UT_KEY(DS_FileCacheFind), UT_DS_FileCacheFind_CustomHandler, &DS_AppData.Cache[0]);
 
     /* Execute the function being tested */
-    UtAssert_VOIDCALL(DS_SendHkCmd(&UT_CmdBuf.SendHkCmd));
+    UtAssert_INT32_EQ(DS_SendCacheCmd(&UT_CmdBuf.SendCacheCmd), CFE_SUCCESS);
 
-    /* Verify results */
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[0].FileRate, 99 / DS_SECS_PER_HK_CYCLE);
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[0].FileGrowth, 0);
+    /* Verify results -- the command is rejected when the cache is disabled */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
 
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[DS_DEST_FILE_CNT / 2].FileRate, 99 / DS_SECS_PER_HK_CYCLE);
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[DS_DEST_FILE_CNT / 2].FileGrowth, 0);
+    if (DS_CACHE_ENTRIES == 0)
+    {
+        UtAssert_UINT32_EQ(DS_AppData.CmdRejectedCounter, 1);
+        UtAssert_STUB_COUNT(DS_FileCacheFind, 0);
+        UtAssert_STUB_COUNT(DS_FileEchoRecord, 0);
+        UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
 
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[DS_DEST_FILE_CNT - 1].FileRate, 99 / DS_SECS_PER_HK_CYCLE);
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[DS_DEST_FILE_CNT - 1].FileGrowth, 0);
+        UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_SEND_CACHE_CMD_ERR_EID);
+        UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    }
+    else
+    {
+        UtAssert_UINT32_EQ(DS_AppData.CmdAcceptedCounter, 1);
+        UtAssert_STUB_COUNT(DS_FileEchoRecord, 1);
+        UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
 
-    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+        UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_SEND_CACHE_CMD_EID);
+        UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+    }
 
     /* Verify command struct size minus header is at least explicitly padded to 32-bit boundaries */
-    UtAssert_BOOL_TRUE(TLM_STRUCT_DATA_IS_32_ALIGNED(DS_HkPacket_t));
-
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_True(CMD_STRUCT_DATA_IS_32_ALIGNED(DS_SendCacheCmd_t), "DS_SendCacheCmd_t is 32-bit aligned");
 }
 
-void DS_AppSendHkCmd_Test_SnprintfFail(void)
+void DS_SendCacheCmd_Test_InvalidMID(void)
 {
-    uint32 i;
-
-    /* Most values in the HK packet can't be checked because they're stored in a local variable. */
+    DS_SendCache_Payload_t *CmdPayload = &UT_CmdBuf.SendCacheCmd.Payload;
 
-    for (i = 0; i < DS_DEST_FILE_CNT; i++)
-    {
-        DS_AppData.FileStatus[i].FileGrowth = 99;
-    }
+    CmdPayload->MessageID = CFE_SB_INVALID_MSG_ID;
 
-    UT_SetDeferredRetcode(UT_KEY(stub_snprintf), 1, -1);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_IsValidMsgId), false);
 
     /* Execute the function being tested */
-    UtAssert_VOIDCALL(DS_SendHkCmd(&UT_CmdBuf.SendHkCmd));
+    UtAssert_INT32_EQ(DS_SendCacheCmd(&UT_CmdBuf.SendCacheCmd), CFE_SUCCESS);
 
     /* Verify results */
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[0].FileRate, 99 / DS_SECS_PER_HK_CYCLE);
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[0].FileGrowth, 0);
+    UtAssert_UINT32_EQ(DS_AppData.CmdRejectedCounter, 1);
+    UtAssert_STUB_COUNT(DS_FileCacheFind, 0);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
 
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[DS_DEST_FILE_CNT / 2].FileRate, 99 / DS_SECS_PER_HK_CYCLE);
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[DS_DEST_FILE_CNT / 2].FileGrowth, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_SEND_CACHE_CMD_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
 
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[DS_DEST_FILE_CNT - 1].FileRate, 99 / DS_SECS_PER_HK_CYCLE);
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[DS_DEST_FILE_CNT - 1].FileGrowth, 0);
+void DS_SendCacheCmd_Test_NotCached(void)
+{
+    DS_SendCache_Payload_t *CmdPayload = &UT_CmdBuf.SendCacheCmd.Payload;
 
-    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    CmdPayload->MessageID = DS_UT_MID_1;
 
-    /* Verify command struct size minus header is at least explicitly padded to 32-bit boundaries */
-    UtAssert_BOOL_TRUE(TLM_STRUCT_DATA_IS_32_ALIGNED(DS_HkPacket_t));
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_IsValidMsgId), true);
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_APPHK_FILTER_TBL_PRINT_ERR_EID);
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_SendCacheCmd(&UT_CmdBuf.SendCacheCmd), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.CmdRejectedCounter, 1);
+    UtAssert_STUB_COUNT(DS_FileCacheFind, (DS_CACHE_ENTRIES == 0) ? 0 : 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_SEND_CACHE_CMD_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 }
 
-void DS_AppSendHkCmd_Test_TblFail(void)
+void DS_WriteCacheCmd_Test_Nominal(void)
 {
-    uint32 i;
+    DS_WriteCache_Payload_t *CmdPayload = &UT_CmdBuf.WriteCacheCmd.Payload;
 
-    /* Most values in the HK packet can't be checked because they're stored in a local variable. */
+    strncpy(CmdPayload->Filename, "cache", sizeof(CmdPayload->Filename) - 1);
 
-    for (i = 0; i < DS_DEST_FILE_CNT; i++)
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_WriteCacheCmd(&UT_CmdBuf.WriteCacheCmd), CFE_SUCCESS);
+
+    /* Verify results -- the command is rejected when the cache is disabled */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+
+    if (DS_CACHE_ENTRIES == 0)
     {
-        DS_AppData.FileStatus[i].FileGrowth = 99;
+        UtAssert_UINT32_EQ(DS_AppData.CmdRejectedCounter, 1);
+        UtAssert_STUB_COUNT(DS_FileCacheWrite, 0);
+
+        UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_WRITE_CACHE_CMD_ERR_EID);
+        UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
     }
+    else
+    {
+        UtAssert_UINT32_EQ(DS_AppData.CmdAcceptedCounter, 1);
+        UtAssert_STUB_COUNT(DS_FileCacheWrite, 1);
 
-    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetInfo), -1);
+        UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_WRITE_CACHE_CMD_EID);
+        UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    }
+
+    /* Verify command struct size minus header is at least explicitly padded to 32-bit boundaries */
+    UtAssert_True(CMD_STRUCT_DATA_IS_32_ALIGNED(DS_WriteCacheCmd_t), "DS_WriteCacheCmd_t is 32-bit aligned");
+}
+
+void DS_WriteCacheCmd_Test_EmptyName(void)
+{
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_WriteCacheCmd(&UT_CmdBuf.WriteCacheCmd), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.CmdRejectedCounter, 1);
+    UtAssert_STUB_COUNT(DS_FileCacheWrite, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_WRITE_CACHE_CMD_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_WriteCacheCmd_Test_WriteError(void)
+{
+    DS_WriteCache_Payload_t *CmdPayload = &UT_CmdBuf.WriteCacheCmd.Payload;
+
+    strncpy(CmdPayload->Filename, "cache", sizeof(CmdPayload->Filename) - 1);
+
+    UT_SetDefaultReturnValue(UT_KEY(DS_FileCacheWrite), OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_WriteCacheCmd(&UT_CmdBuf.WriteCacheCmd), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.CmdRejectedCounter, 1);
+    UtAssert_STUB_COUNT(DS_FileCacheWrite, (DS_CACHE_ENTRIES == 0) ? 0 : 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_WRITE_CACHE_CMD_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_GetManifestCmd_Test_Nominal(void)
+{
+    DS_GetManifest_Payload_t *CmdPayload = &UT_CmdBuf.GetManifestCmd.Payload;
+
+    CmdPayload->FileTableIndex = 1;
+
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableVerifyFileIndex), true);
+    UT_SetDefaultReturnValue(UT_KEY(DS_FileManifestName), true);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_GetManifestCmd(&UT_CmdBuf.GetManifestCmd), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.CmdAcceptedCounter, 1);
+    UtAssert_STUB_COUNT(DS_FileTransmitManifest, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_GET_MANIFEST_CMD_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+
+    /* Verify command struct size minus header is at least explicitly padded to 32-bit boundaries */
+    UtAssert_True(CMD_STRUCT_DATA_IS_32_ALIGNED(DS_GetManifestCmd_t), "DS_GetManifestCmd_t is 32-bit aligned");
+}
+
+void DS_GetManifestCmd_Test_InvalidIndex(void)
+{
+    DS_GetManifest_Payload_t *CmdPayload = &UT_CmdBuf.GetManifestCmd.Payload;
+
+    CmdPayload->FileTableIndex = 99;
+
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableVerifyFileIndex), false);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_GetManifestCmd(&UT_CmdBuf.GetManifestCmd), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.CmdRejectedCounter, 1);
+    UtAssert_STUB_COUNT(DS_FileTransmitManifest, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_GET_MANIFEST_CMD_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_GetManifestCmd_Test_FileTableNotLoaded(void)
+{
+    DS_GetManifest_Payload_t *CmdPayload = &UT_CmdBuf.GetManifestCmd.Payload;
+
+    CmdPayload->FileTableIndex = 1;
+
+    DS_AppData.DestFileTblPtr = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableVerifyFileIndex), true);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_GetManifestCmd(&UT_CmdBuf.GetManifestCmd), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.CmdRejectedCounter, 1);
+    UtAssert_STUB_COUNT(DS_FileManifestName, 0);
+    UtAssert_STUB_COUNT(DS_FileTransmitManifest, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_GET_MANIFEST_CMD_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_GetManifestCmd_Test_NoManifest(void)
+{
+    DS_GetManifest_Payload_t *CmdPayload = &UT_CmdBuf.GetManifestCmd.Payload;
+
+    CmdPayload->FileTableIndex = 1;
+
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableVerifyFileIndex), true);
+    UT_SetDefaultReturnValue(UT_KEY(DS_FileManifestName), false);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_GetManifestCmd(&UT_CmdBuf.GetManifestCmd), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.CmdRejectedCounter, 1);
+    UtAssert_STUB_COUNT(DS_FileManifestName, 1);
+    UtAssert_STUB_COUNT(DS_FileTransmitManifest, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_GET_MANIFEST_CMD_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_AddMIDCmd_Test_Nominal(void)
+{
+    int32 FilterTableIndex;
+
+    DS_AddRemoveMid_Payload_t *CmdPayload = &UT_CmdBuf.AddMidCmd.Payload;
+
+    /* Verify command struct size minus header is at least explicitly padded to 32-bit boundaries */
+    UtAssert_True(CMD_STRUCT_DATA_IS_32_ALIGNED(DS_AddMidCmd_t), "DS_AddMidCmd_t is 32-bit aligned");
+
+    CmdPayload->MessageID = DS_UT_MID_1;
+
+    DS_AppData.FilterTblPtr->Packet[0].MessageID   = CFE_SB_INVALID_MSG_ID;
+    DS_AppData.FilterTblPtr->Packet[0].RatePackets = 5;
+    DS_AppData.FilterTblPtr->Packet[0].MessageMask = 0xFF00;
+    DS_AppData.FilterTblPtr->Packet[1].MessageID   = DS_UT_MID_2;
+    DS_AppData.FilterRate[0].PacketTokens          = 1;
+
+    DS_AppData.FilterTblPtr->Packet[0].Filter[0].Priority       = DS_PRIORITY_LOW;
+    DS_AppData.FilterTblPtr->Packet[0].Filter[0].MaxStoreLength = 100;
+    DS_AppData.FilterTblPtr->Packet[0].PredicateLogic           = DS_PREDICATE_OR;
+    DS_AppData.FilterTblPtr->Packet[0].Predicate[0].Width       = 4;
+
+    FilterTableIndex = 0;
+
+    /* for nominal case, first call to DS_TableFindMsgID must return
+     * DS_INDEX_NONE and the second call must return something other than
+     * DS_INDEX_NONE */
+    UT_SetDeferredRetcode(UT_KEY(DS_TableFindMsgID), 1, DS_INDEX_NONE);
+    UT_SetDeferredRetcode(UT_KEY(DS_TableFindMsgID), 1, 0);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_AddMidCmd(&UT_CmdBuf.AddMidCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.CmdAcceptedCounter, 1);
+
+    UtAssert_BOOL_TRUE(CFE_SB_MsgId_Equal(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].MessageID, DS_UT_MID_1));
+    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].RatePackets);
+    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].MessageMask);
+    UtAssert_ZERO(DS_AppData.FilterRate[FilterTableIndex].PacketTokens);
+    UtAssert_UINT32_EQ(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].PredicateLogic, DS_PREDICATE_AND);
+    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Predicate[0].Width);
+    UtAssert_STUB_COUNT(DS_TableCompilePredicate, 1);
+
+    /* Check first elements */
+    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[0].FileTableIndex);
+    UtAssert_UINT8_EQ(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[0].FilterType, DS_BY_COUNT);
+    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[0].Algorithm_N);
+    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[0].Algorithm_X);
+    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[0].Algorithm_O);
+    UtAssert_UINT32_EQ(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[0].Priority, DS_PRIORITY_HIGH);
+    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[0].MaxStoreLength);
+
+    /* Check middle elements */
+    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[DS_FILTERS_PER_PACKET / 2].FileTableIndex);
+    UtAssert_UINT8_EQ(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[DS_FILTERS_PER_PACKET / 2].FilterType,
+                      DS_BY_COUNT);
+    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[DS_FILTERS_PER_PACKET / 2].Algorithm_N);
+    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[DS_FILTERS_PER_PACKET / 2].Algorithm_X);
+    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[DS_FILTERS_PER_PACKET / 2].Algorithm_O);
+
+    /* Check last elements */
+    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[DS_FILTERS_PER_PACKET - 1].FileTableIndex);
+    UtAssert_UINT8_EQ(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[DS_FILTERS_PER_PACKET - 1].FilterType,
+                      DS_BY_COUNT);
+    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[DS_FILTERS_PER_PACKET - 1].Algorithm_N);
+    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[DS_FILTERS_PER_PACKET - 1].Algorithm_X);
+    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[DS_FILTERS_PER_PACKET - 1].Algorithm_O);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_ADD_MID_CMD_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+}
+
+void DS_AddMIDCmd_Test_InvalidMessageID(void)
+{
+    DS_AddRemoveMid_Payload_t *CmdPayload = &UT_CmdBuf.AddMidCmd.Payload;
+
+    CmdPayload->MessageID = CFE_SB_INVALID_MSG_ID;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_AddMidCmd(&UT_CmdBuf.AddMidCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.CmdRejectedCounter, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_ADD_MID_CMD_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_AddMIDCmd_Test_FilterTableNotLoaded(void)
+{
+    DS_AddRemoveMid_Payload_t *CmdPayload = &UT_CmdBuf.AddMidCmd.Payload;
+
+    CmdPayload->MessageID = DS_UT_MID_1;
+
+    /* Reset table pointer to NULL (set in test setup) */
+    DS_AppData.FilterTblPtr = NULL;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_AddMidCmd(&UT_CmdBuf.AddMidCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.CmdRejectedCounter, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_ADD_MID_CMD_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_AddMIDCmd_Test_MIDAlreadyInFilterTable(void)
+{
+    DS_AddRemoveMid_Payload_t *CmdPayload = &UT_CmdBuf.AddMidCmd.Payload;
+
+    CmdPayload->MessageID                      = DS_UT_MID_1;
+    DS_AppData.FilterTblPtr->Packet->MessageID = DS_UT_MID_1;
+
+    UT_SetDeferredRetcode(UT_KEY(DS_TableFindMsgID), 1, 1);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_AddMidCmd(&UT_CmdBuf.AddMidCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.CmdRejectedCounter, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_ADD_MID_CMD_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_AddMIDCmd_Test_FilterTableFull(void)
+{
+    DS_AddRemoveMid_Payload_t *CmdPayload = &UT_CmdBuf.AddMidCmd.Payload;
+
+    CmdPayload->MessageID = DS_UT_MID_1;
+
+    /* both calls to DS_TableFindMsgID must return DS_INDEX_NONE */
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableFindMsgID), DS_INDEX_NONE);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_AddMidCmd(&UT_CmdBuf.AddMidCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.CmdRejectedCounter, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_ADD_MID_CMD_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_RemoveMIDCmd_Test_Nominal(void)
+{
+    CFE_SB_MsgId_t             MessageID        = DS_UT_MID_1;
+    int32                      FilterTableIndex = 0;
+    int32                      HashTableIndex   = 1;
+    DS_AddRemoveMid_Payload_t *CmdPayload       = &UT_CmdBuf.RemoveMidCmd.Payload;
+
+    /* Verify command struct size minus header is at least explicitly padded to 32-bit boundaries */
+    UtAssert_True(CMD_STRUCT_DATA_IS_32_ALIGNED(DS_RemoveMidCmd_t), "DS_RemoveMidCmd_t is 32-bit aligned");
+
+    CmdPayload->MessageID                                       = MessageID;
+    DS_AppData.FilterTblPtr->Packet[FilterTableIndex].MessageID = MessageID;
+
+    DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Predicate[0].Width = 4;
+
+    /* Message ID is no longer matched after the hash table is created again */
+    UT_SetDeferredRetcode(UT_KEY(DS_TableFindMsgID), 1, FilterTableIndex);
+    UT_SetDeferredRetcode(UT_KEY(DS_TableFindMsgID), 1, DS_INDEX_NONE);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_RemoveMidCmd(&UT_CmdBuf.RemoveMidCmd));
+
+    /* Verify results */
+    UtAssert_INT32_EQ(CFE_SB_MsgIdToValue(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].MessageID),
+                      CFE_SB_MsgIdToValue(CFE_SB_INVALID_MSG_ID));
+    UtAssert_INT32_EQ(CFE_SB_MsgIdToValue(DS_AppData.HashLinks[HashTableIndex].MessageID),
+                      CFE_SB_MsgIdToValue(CFE_SB_INVALID_MSG_ID));
+    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Predicate[0].Width);
+    UtAssert_STUB_COUNT(DS_TableCompilePredicate, 1);
+
+    /* Check first elements */
+    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[0].FileTableIndex);
+    UtAssert_UINT8_EQ(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[0].FilterType, DS_BY_COUNT);
+    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[0].Algorithm_N);
+    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[0].Algorithm_X);
+    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[0].Algorithm_O);
+
+    /* Check middle elements */
+    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[DS_FILTERS_PER_PACKET / 2].FileTableIndex);
+    UtAssert_UINT8_EQ(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[DS_FILTERS_PER_PACKET / 2].FilterType,
+                      DS_BY_COUNT);
+    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[DS_FILTERS_PER_PACKET / 2].Algorithm_N);
+    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[DS_FILTERS_PER_PACKET / 2].Algorithm_X);
+    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[DS_FILTERS_PER_PACKET / 2].Algorithm_O);
+
+    /* Check last elements */
+    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[DS_FILTERS_PER_PACKET - 1].FileTableIndex);
+    UtAssert_UINT8_EQ(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[DS_FILTERS_PER_PACKET - 1].FilterType,
+                      DS_BY_COUNT);
+    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[DS_FILTERS_PER_PACKET - 1].Algorithm_N);
+    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[DS_FILTERS_PER_PACKET - 1].Algorithm_X);
+    UtAssert_ZERO(DS_AppData.FilterTblPtr->Packet[FilterTableIndex].Filter[DS_FILTERS_PER_PACKET - 1].Algorithm_O);
+
+    UtAssert_STUB_COUNT(CFE_SB_IsValidMsgId, 1);
+    UtAssert_STUB_COUNT(DS_TableHashFunction, 1);
+    UtAssert_STUB_COUNT(DS_TableCreateHash, 1);
+    UtAssert_STUB_COUNT(CFE_SB_Unsubscribe, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_REMOVE_MID_CMD_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+}
+
+void DS_RemoveMIDCmd_Test_WildcardCovered(void)
+{
+    DS_AddRemoveMid_Payload_t *CmdPayload = &UT_CmdBuf.RemoveMidCmd.Payload;
+
+    CmdPayload->MessageID                        = DS_UT_MID_1;
+    DS_AppData.FilterTblPtr->Packet[0].MessageID = DS_UT_MID_1;
+
+    /* Exact entry 0 is removed, wildcard entry 1 matches the message ID afterwards */
+    UT_SetDeferredRetcode(UT_KEY(DS_TableFindMsgID), 1, 0);
+    UT_SetDeferredRetcode(UT_KEY(DS_TableFindMsgID), 1, 1);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_RemoveMidCmd(&UT_CmdBuf.RemoveMidCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.CmdAcceptedCounter, 1);
+    UtAssert_STUB_COUNT(DS_TableCreateHash, 1);
+    UtAssert_STUB_COUNT(CFE_SB_Unsubscribe, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_REMOVE_MID_CMD_EID);
+}
+
+void DS_RemoveMIDCmd_Test_WildcardEntry(void)
+{
+    DS_AddRemoveMid_Payload_t *CmdPayload = &UT_CmdBuf.RemoveMidCmd.Payload;
+
+    CmdPayload->MessageID                          = DS_UT_MID_1;
+    DS_AppData.FilterTblPtr->Packet[0].MessageID   = DS_UT_MID_2;
+    DS_AppData.FilterTblPtr->Packet[0].MessageMask = 0xFF00;
+
+    UT_SetDeferredRetcode(UT_KEY(DS_TableFindMsgID), 1, 0);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_RemoveMidCmd(&UT_CmdBuf.RemoveMidCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.CmdRejectedCounter, 1);
+    UtAssert_BOOL_TRUE(CFE_SB_MsgId_Equal(DS_AppData.FilterTblPtr->Packet[0].MessageID, DS_UT_MID_2));
+    UtAssert_STUB_COUNT(DS_TableCreateHash, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_REMOVE_MID_CMD_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_RemoveMIDCmd_Test_InvalidMessageID(void)
+{
+    DS_AddRemoveMid_Payload_t *CmdPayload = &UT_CmdBuf.RemoveMidCmd.Payload;
+
+    CmdPayload->MessageID = CFE_SB_INVALID_MSG_ID;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_RemoveMidCmd(&UT_CmdBuf.RemoveMidCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.CmdRejectedCounter, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_REMOVE_MID_CMD_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_RemoveMIDCmd_Test_FilterTableNotLoaded(void)
+{
+    DS_AddRemoveMid_Payload_t *CmdPayload = &UT_CmdBuf.RemoveMidCmd.Payload;
+
+    CmdPayload->MessageID = DS_UT_MID_1;
+
+    /* Reset table pointer to NULL (set in test setup) */
+    DS_AppData.FilterTblPtr = NULL;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_RemoveMidCmd(&UT_CmdBuf.RemoveMidCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.CmdRejectedCounter, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_REMOVE_MID_CMD_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_RemoveMIDCmd_Test_MessageIDNotAdded(void)
+{
+    DS_AddRemoveMid_Payload_t *CmdPayload = &UT_CmdBuf.RemoveMidCmd.Payload;
+
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableFindMsgID), DS_INDEX_NONE);
+
+    CmdPayload->MessageID = DS_UT_MID_1;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_RemoveMidCmd(&UT_CmdBuf.RemoveMidCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.CmdRejectedCounter, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_REMOVE_MID_CMD_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_AppSendHkCmd_Test(void)
+{
+    uint32 i;
+
+    /* Most values in the HK packet can't be checked because they're stored in a local variable. */
+
+    for (i = 0; i < DS_DEST_FILE_CNT; i++)
+    {
+        DS_AppData.FileStatus[i].FileGrowth = 99;
+    }
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_SendHkCmd(&UT_CmdBuf.SendHkCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[0].FileRate, 99 / DS_SECS_PER_HK_CYCLE);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[0].FileGrowth, 0);
+
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[DS_DEST_FILE_CNT / 2].FileRate, 99 / DS_SECS_PER_HK_CYCLE);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[DS_DEST_FILE_CNT / 2].FileGrowth, 0);
+
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[DS_DEST_FILE_CNT - 1].FileRate, 99 / DS_SECS_PER_HK_CYCLE);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[DS_DEST_FILE_CNT - 1].FileGrowth, 0);
+
+    UtAssert_STUB_COUNT(DS_AppLowerDecimation, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, (DS_STATS_TIMING == 1) ? 2 : 1);
+    UtAssert_STUB_COUNT(DS_FileTransmitDestStats, (DS_DEST_STATS_HK_CYCLES == 1) ? 1 : 0);
+
+    /* Verify command struct size minus header is at least explicitly padded to 32-bit boundaries */
+    UtAssert_BOOL_TRUE(TLM_STRUCT_DATA_IS_32_ALIGNED(DS_HkPacket_t));
+    UtAssert_BOOL_TRUE(TLM_STRUCT_DATA_IS_32_ALIGNED(DS_StatsPacket_t));
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_AppSendHkCmd_Test_DestStats(void)
+{
+    uint32 i;
+
+    /* Execute the function being tested -- one full destination statistics period */
+    for (i = 0; (i < DS_DEST_STATS_HK_CYCLES) || (i == 0); i++)
+    {
+        UtAssert_VOIDCALL(DS_SendHkCmd(&UT_CmdBuf.SendHkCmd));
+    }
+
+    /* Verify results -- sent once per period unless periodic statistics are disabled */
+    UtAssert_STUB_COUNT(DS_FileTransmitDestStats, (DS_DEST_STATS_HK_CYCLES != 0) ? 1 : 0);
+    UtAssert_ZERO(DS_AppData.DestStatsHkCount);
+}
+
+void DS_AppSendHkCmd_Test_SnprintfFail(void)
+{
+    uint32 i;
+
+    /* Most values in the HK packet can't be checked because they're stored in a local variable. */
+
+    for (i = 0; i < DS_DEST_FILE_CNT; i++)
+    {
+        DS_AppData.FileStatus[i].FileGrowth = 99;
+    }
+
+    UT_SetDeferredRetcode(UT_KEY(stub_snprintf), 1, -1);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_SendHkCmd(&UT_CmdBuf.SendHkCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[0].FileRate, 99 / DS_SECS_PER_HK_CYCLE);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[0].FileGrowth, 0);
+
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[DS_DEST_FILE_CNT / 2].FileRate, 99 / DS_SECS_PER_HK_CYCLE);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[DS_DEST_FILE_CNT / 2].FileGrowth, 0);
+
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[DS_DEST_FILE_CNT - 1].FileRate, 99 / DS_SECS_PER_HK_CYCLE);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[DS_DEST_FILE_CNT - 1].FileGrowth, 0);
+
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, (DS_STATS_TIMING == 1) ? 2 : 1);
+
+    /* Verify command struct size minus header is at least explicitly padded to 32-bit boundaries */
+    UtAssert_BOOL_TRUE(TLM_STRUCT_DATA_IS_32_ALIGNED(DS_HkPacket_t));
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_APPHK_FILTER_TBL_PRINT_ERR_EID);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void DS_AppSendHkCmd_Test_TblFail(void)
+{
+    uint32 i;
+
+    /* Most values in the HK packet can't be checked because they're stored in a local variable. */
+
+    for (i = 0; i < DS_DEST_FILE_CNT; i++)
+    {
+        DS_AppData.FileStatus[i].FileGrowth = 99;
+    }
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetInfo), -1);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_SendHkCmd(&UT_CmdBuf.SendHkCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[0].FileRate, 99 / DS_SECS_PER_HK_CYCLE);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[0].FileGrowth, 0);
+
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[DS_DEST_FILE_CNT / 2].FileRate, 99 / DS_SECS_PER_HK_CYCLE);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[DS_DEST_FILE_CNT / 2].FileGrowth, 0);
+
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[DS_DEST_FILE_CNT - 1].FileRate, 99 / DS_SECS_PER_HK_CYCLE);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[DS_DEST_FILE_CNT - 1].FileGrowth, 0);
+
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, (DS_STATS_TIMING == 1) ? 2 : 1);
+
+    /* Verify command struct size minus header is at least explicitly padded to 32-bit boundaries */
+    UtAssert_BOOL_TRUE(TLM_STRUCT_DATA_IS_32_ALIGNED(DS_HkPacket_t));
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void DS_BacklogProbeCmd_Test_Nominal(void)
+{
+    uint32 Backlog = 0;
+
+    DS_AppData.BacklogProbePending = true;
+    DS_AppData.BacklogProbeCount   = 5;
+
+    UT_SetHandlerFunction(UT_KEY(DS_AppRaiseDecimation), UT_DS_AppRaiseDecimation_CustomHandler, &Backlog);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_BacklogProbeCmd(&UT_CmdBuf.BacklogProbeCmd), CFE_SUCCESS);
+
+    /* Verify results -- four messages were received ahead of the probe */
+    UtAssert_STUB_COUNT(DS_AppRaiseDecimation, 1);
+    UtAssert_UINT32_EQ(Backlog, 4);
+    UtAssert_BOOL_FALSE(DS_AppData.BacklogProbePending);
+    UtAssert_UINT32_EQ(DS_AppData.BacklogProbeCount, 0);
+}
+
+void DS_BacklogProbeCmd_Test_NotPending(void)
+{
+    DS_AppData.BacklogProbePending = false;
+    DS_AppData.BacklogProbeCount   = 5;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_BacklogProbeCmd(&UT_CmdBuf.BacklogProbeCmd), CFE_SUCCESS);
+
+    /* Verify results -- a probe DS did not send is ignored */
+    UtAssert_STUB_COUNT(DS_AppRaiseDecimation, 0);
+    UtAssert_UINT32_EQ(DS_AppData.BacklogProbeCount, 5);
+}
+
+void DS_ExtractFileCmd_Test_Nominal(void)
+{
+    DS_ExtractFile_Payload_t *CmdPayload = &UT_CmdBuf.ExtractFileCmd.Payload;
+
+    strncpy(CmdPayload->SourceName, "source", sizeof(CmdPayload->SourceName) - 1);
+    strncpy(CmdPayload->TargetName, "target", sizeof(CmdPayload->TargetName) - 1);
+    CmdPayload->StartSeconds = 100;
+    CmdPayload->StopSeconds  = 200;
+    CmdPayload->MessageID[0] = DS_UT_MID_1;
+
+    /* Set up the extraction semaphore */
+    OS_OpenCreate(&DS_AppData.ExtractSemaphore, NULL, 0, 0);
+    DS_AppData.ExtractPacketCount = 5;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_ExtractFileCmd(&UT_CmdBuf.ExtractFileCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.CmdAcceptedCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.ExtractState, DS_EXTRACT_ACTIVE);
+    UtAssert_ZERO(DS_AppData.ExtractPacketCount);
+    UtAssert_STRINGBUF_EQ(DS_AppData.ExtractRequest.SourceName, sizeof(DS_AppData.ExtractRequest.SourceName),
+                          "source", -1);
+    UtAssert_STRINGBUF_EQ(DS_AppData.ExtractRequest.TargetName, sizeof(DS_AppData.ExtractRequest.TargetName),
+                          "target", -1);
+    UtAssert_UINT32_EQ(DS_AppData.ExtractRequest.StartSeconds, 100);
+    UtAssert_UINT32_EQ(DS_AppData.ExtractRequest.StopSeconds, 200);
+    UtAssert_BOOL_TRUE(CFE_SB_MsgId_Equal(DS_AppData.ExtractRequest.MessageID[0], DS_UT_MID_1));
+    UtAssert_STUB_COUNT(OS_CountSemGive, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_EXTRACT_CMD_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+
+    /* Verify command struct size minus header is at least explicitly padded to 32-bit boundaries */
+    UtAssert_True(CMD_STRUCT_DATA_IS_32_ALIGNED(DS_ExtractFileCmd_t), "DS_ExtractFileCmd_t is 32-bit aligned");
+}
+
+void DS_ExtractFileCmd_Test_EmptyName(void)
+{
+    DS_ExtractFile_Payload_t *CmdPayload = &UT_CmdBuf.ExtractFileCmd.Payload;
+
+    strncpy(CmdPayload->SourceName, "source", sizeof(CmdPayload->SourceName) - 1);
+
+    OS_OpenCreate(&DS_AppData.ExtractSemaphore, NULL, 0, 0);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_ExtractFileCmd(&UT_CmdBuf.ExtractFileCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.CmdRejectedCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.ExtractState, DS_EXTRACT_IDLE);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_EXTRACT_CMD_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_ExtractFileCmd_Test_SameName(void)
+{
+    DS_ExtractFile_Payload_t *CmdPayload = &UT_CmdBuf.ExtractFileCmd.Payload;
+
+    strncpy(CmdPayload->SourceName, "source", sizeof(CmdPayload->SourceName) - 1);
+    strncpy(CmdPayload->TargetName, "source", sizeof(CmdPayload->TargetName) - 1);
+
+    OS_OpenCreate(&DS_AppData.ExtractSemaphore, NULL, 0, 0);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_ExtractFileCmd(&UT_CmdBuf.ExtractFileCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.CmdRejectedCounter, 1);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_EXTRACT_CMD_ERR_EID);
+}
+
+void DS_ExtractFileCmd_Test_InvalidTimeWindow(void)
+{
+    DS_ExtractFile_Payload_t *CmdPayload = &UT_CmdBuf.ExtractFileCmd.Payload;
+
+    strncpy(CmdPayload->SourceName, "source", sizeof(CmdPayload->SourceName) - 1);
+    strncpy(CmdPayload->TargetName, "target", sizeof(CmdPayload->TargetName) - 1);
+    CmdPayload->StartSeconds = 200;
+    CmdPayload->StopSeconds  = 100;
+
+    OS_OpenCreate(&DS_AppData.ExtractSemaphore, NULL, 0, 0);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_ExtractFileCmd(&UT_CmdBuf.ExtractFileCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.CmdRejectedCounter, 1);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_EXTRACT_CMD_ERR_EID);
+}
+
+void DS_ExtractFileCmd_Test_TaskNotRunning(void)
+{
+    DS_ExtractFile_Payload_t *CmdPayload = &UT_CmdBuf.ExtractFileCmd.Payload;
+
+    strncpy(CmdPayload->SourceName, "source", sizeof(CmdPayload->SourceName) - 1);
+    strncpy(CmdPayload->TargetName, "target", sizeof(CmdPayload->TargetName) - 1);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_ExtractFileCmd(&UT_CmdBuf.ExtractFileCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.CmdRejectedCounter, 1);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_EXTRACT_CMD_ERR_EID);
+}
+
+void DS_ExtractFileCmd_Test_Busy(void)
+{
+    DS_ExtractFile_Payload_t *CmdPayload = &UT_CmdBuf.ExtractFileCmd.Payload;
+
+    strncpy(CmdPayload->SourceName, "source", sizeof(CmdPayload->SourceName) - 1);
+    strncpy(CmdPayload->TargetName, "target", sizeof(CmdPayload->TargetName) - 1);
+
+    OS_OpenCreate(&DS_AppData.ExtractSemaphore, NULL, 0, 0);
+    DS_AppData.ExtractState       = DS_EXTRACT_ACTIVE;
+    DS_AppData.ExtractPacketCount = 5;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_ExtractFileCmd(&UT_CmdBuf.ExtractFileCmd));
+
+    /* Verify results - extraction in progress is undisturbed */
+    UtAssert_UINT32_EQ(DS_AppData.CmdRejectedCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.ExtractPacketCount, 5);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_EXTRACT_CMD_ERR_EID);
+}
+
+void DS_ReplayStartCmd_Test_Nominal(void)
+{
+    DS_ReplayStart_Payload_t *CmdPayload = &UT_CmdBuf.ReplayStartCmd.Payload;
+
+    strncpy(CmdPayload->Filename, "replay", sizeof(CmdPayload->Filename) - 1);
+    CmdPayload->RateMultiplier = 4;
+
+    /* Set up the replay semaphore */
+    OS_OpenCreate(&DS_AppData.ReplaySemaphore, NULL, 0, 0);
+    DS_AppData.ReplayPacketCount    = 5;
+    DS_AppData.ReplayStopPending    = true;
+    DS_AppData.ReplayPauseRequested = true;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_ReplayStartCmd(&UT_CmdBuf.ReplayStartCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.CmdAcceptedCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.ReplayState, DS_REPLAY_ACTIVE);
+    UtAssert_UINT32_EQ(DS_AppData.ReplayRate, 4);
+    UtAssert_ZERO(DS_AppData.ReplayPacketCount);
+    UtAssert_BOOL_FALSE(DS_AppData.ReplayStopPending);
+    UtAssert_BOOL_FALSE(DS_AppData.ReplayPauseRequested);
+    UtAssert_STRINGBUF_EQ(DS_AppData.ReplayFilename, sizeof(DS_AppData.ReplayFilename), "replay", -1);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_REPLAY_START_CMD_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+
+    /* Verify command struct size minus header is at least explicitly padded to 32-bit boundaries */
+    UtAssert_True(CMD_STRUCT_DATA_IS_32_ALIGNED(DS_ReplayStartCmd_t), "DS_ReplayStartCmd_t is 32-bit aligned");
+}
+
+void DS_ReplayStartCmd_Test_EmptyName(void)
+{
+    DS_ReplayStart_Payload_t *CmdPayload = &UT_CmdBuf.ReplayStartCmd.Payload;
+
+    CmdPayload->RateMultiplier = 1;
+
+    OS_OpenCreate(&DS_AppData.ReplaySemaphore, NULL, 0, 0);
 
     /* Execute the function being tested */
-    UtAssert_VOIDCALL(DS_SendHkCmd(&UT_CmdBuf.SendHkCmd));
+    UtAssert_VOIDCALL(DS_ReplayStartCmd(&UT_CmdBuf.ReplayStartCmd));
 
     /* Verify results */
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[0].FileRate, 99 / DS_SECS_PER_HK_CYCLE);
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[0].FileGrowth, 0);
+    UtAssert_UINT32_EQ(DS_AppData.CmdRejectedCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.ReplayState, DS_REPLAY_IDLE);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 0);
 
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[DS_DEST_FILE_CNT / 2].FileRate, 99 / DS_SECS_PER_HK_CYCLE);
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[DS_DEST_FILE_CNT / 2].FileGrowth, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_REPLAY_START_CMD_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
 
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[DS_DEST_FILE_CNT - 1].FileRate, 99 / DS_SECS_PER_HK_CYCLE);
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[DS_DEST_FILE_CNT - 1].FileGrowth, 0);
+void DS_ReplayStartCmd_Test_InvalidRate(void)
+{
+    DS_ReplayStart_Payload_t *CmdPayload = &UT_CmdBuf.ReplayStartCmd.Payload;
+
+    strncpy(CmdPayload->Filename, "replay", sizeof(CmdPayload->Filename) - 1);
+
+    OS_OpenCreate(&DS_AppData.ReplaySemaphore, NULL, 0, 0);
+
+    /* Execute the function being tested - zero rate */
+    CmdPayload->RateMultiplier = 0;
+    UtAssert_VOIDCALL(DS_ReplayStartCmd(&UT_CmdBuf.ReplayStartCmd));
+
+    /* Execute the function being tested - rate too large */
+    CmdPayload->RateMultiplier = DS_REPLAY_MAX_RATE + 1;
+    UtAssert_VOIDCALL(DS_ReplayStartCmd(&UT_CmdBuf.ReplayStartCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.CmdRejectedCounter, 2);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_REPLAY_START_CMD_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, DS_REPLAY_START_CMD_ERR_EID);
+}
+
+void DS_ReplayStartCmd_Test_TaskNotRunning(void)
+{
+    DS_ReplayStart_Payload_t *CmdPayload = &UT_CmdBuf.ReplayStartCmd.Payload;
+
+    strncpy(CmdPayload->Filename, "replay", sizeof(CmdPayload->Filename) - 1);
+    CmdPayload->RateMultiplier = 1;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_ReplayStartCmd(&UT_CmdBuf.ReplayStartCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.CmdRejectedCounter, 1);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_REPLAY_START_CMD_ERR_EID);
+}
+
+void DS_ReplayStartCmd_Test_Busy(void)
+{
+    DS_ReplayStart_Payload_t *CmdPayload = &UT_CmdBuf.ReplayStartCmd.Payload;
+
+    strncpy(CmdPayload->Filename, "replay", sizeof(CmdPayload->Filename) - 1);
+    CmdPayload->RateMultiplier = 1;
+
+    OS_OpenCreate(&DS_AppData.ReplaySemaphore, NULL, 0, 0);
+    DS_AppData.ReplayState       = DS_REPLAY_PAUSED;
+    DS_AppData.ReplayPacketCount = 5;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_ReplayStartCmd(&UT_CmdBuf.ReplayStartCmd));
+
+    /* Verify results - replay in progress is undisturbed */
+    UtAssert_UINT32_EQ(DS_AppData.CmdRejectedCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.ReplayState, DS_REPLAY_PAUSED);
+    UtAssert_UINT32_EQ(DS_AppData.ReplayPacketCount, 5);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_REPLAY_START_CMD_ERR_EID);
+}
+
+void DS_ReplayStopCmd_Test_Nominal(void)
+{
+    DS_AppData.ReplayState = DS_REPLAY_PAUSED;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_ReplayStopCmd(&UT_CmdBuf.ReplayStopCmd));
+
+    /* Verify results - child task returns to idle once stopped */
+    UtAssert_UINT32_EQ(DS_AppData.CmdAcceptedCounter, 1);
+    UtAssert_BOOL_TRUE(DS_AppData.ReplayStopPending);
+    UtAssert_UINT32_EQ(DS_AppData.ReplayState, DS_REPLAY_PAUSED);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_REPLAY_CTRL_CMD_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+
+    /* Verify command struct size minus header is at least explicitly padded to 32-bit boundaries */
+    UtAssert_True(CMD_STRUCT_DATA_IS_32_ALIGNED(DS_ReplayStopCmd_t), "DS_ReplayStopCmd_t is 32-bit aligned");
+}
+
+void DS_ReplayStopCmd_Test_Idle(void)
+{
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_ReplayStopCmd(&UT_CmdBuf.ReplayStopCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.CmdRejectedCounter, 1);
+    UtAssert_BOOL_FALSE(DS_AppData.ReplayStopPending);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_REPLAY_CTRL_CMD_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_ReplayPauseCmd_Test_Nominal(void)
+{
+    DS_AppData.ReplayState = DS_REPLAY_ACTIVE;
 
-    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_ReplayPauseCmd(&UT_CmdBuf.ReplayPauseCmd));
+
+    /* Verify results - state is left to the child task */
+    UtAssert_UINT32_EQ(DS_AppData.CmdAcceptedCounter, 1);
+    UtAssert_BOOL_TRUE(DS_AppData.ReplayPauseRequested);
+    UtAssert_UINT32_EQ(DS_AppData.ReplayState, DS_REPLAY_ACTIVE);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_REPLAY_CTRL_CMD_EID);
 
     /* Verify command struct size minus header is at least explicitly padded to 32-bit boundaries */
-    UtAssert_BOOL_TRUE(TLM_STRUCT_DATA_IS_32_ALIGNED(DS_HkPacket_t));
+    UtAssert_True(CMD_STRUCT_DATA_IS_32_ALIGNED(DS_ReplayPauseCmd_t), "DS_ReplayPauseCmd_t is 32-bit aligned");
+}
+
+void DS_ReplayPauseCmd_Test_NotActive(void)
+{
+    DS_AppData.ReplayState          = DS_REPLAY_PAUSED;
+    DS_AppData.ReplayPauseRequested = true;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_ReplayPauseCmd(&UT_CmdBuf.ReplayPauseCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.CmdRejectedCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.ReplayState, DS_REPLAY_PAUSED);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_REPLAY_CTRL_CMD_ERR_EID);
+}
+
+void DS_ReplayResumeCmd_Test_Nominal(void)
+{
+    DS_AppData.ReplayState          = DS_REPLAY_PAUSED;
+    DS_AppData.ReplayPauseRequested = true;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_ReplayResumeCmd(&UT_CmdBuf.ReplayResumeCmd));
+
+    /* Verify results - state is left to the child task */
+    UtAssert_UINT32_EQ(DS_AppData.CmdAcceptedCounter, 1);
+    UtAssert_BOOL_FALSE(DS_AppData.ReplayPauseRequested);
+    UtAssert_UINT32_EQ(DS_AppData.ReplayState, DS_REPLAY_PAUSED);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_REPLAY_CTRL_CMD_EID);
+
+    /* Verify command struct size minus header is at least explicitly padded to 32-bit boundaries */
+    UtAssert_True(CMD_STRUCT_DATA_IS_32_ALIGNED(DS_ReplayResumeCmd_t), "DS_ReplayResumeCmd_t is 32-bit aligned");
+}
+
+void DS_ReplayResumeCmd_Test_NotPaused(void)
+{
+    DS_AppData.ReplayState = DS_REPLAY_ACTIVE;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_ReplayResumeCmd(&UT_CmdBuf.ReplayResumeCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.CmdRejectedCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.ReplayState, DS_REPLAY_ACTIVE);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_REPLAY_CTRL_CMD_ERR_EID);
+}
+
+void DS_ReplayResumeCmd_Test_Idle(void)
+{
+    /* Pause request left over from a replay that already ended */
+    DS_AppData.ReplayState          = DS_REPLAY_IDLE;
+    DS_AppData.ReplayPauseRequested = true;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_ReplayResumeCmd(&UT_CmdBuf.ReplayResumeCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.CmdRejectedCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.ReplayState, DS_REPLAY_IDLE);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_REPLAY_CTRL_CMD_ERR_EID);
+}
+
+void DS_ReplaySeekCmd_Test_Nominal(void)
+{
+    UT_CmdBuf.ReplaySeekCmd.Payload.Seconds = 1000;
+
+    DS_AppData.ReplayState = DS_REPLAY_ACTIVE;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_ReplaySeekCmd(&UT_CmdBuf.ReplaySeekCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.CmdAcceptedCounter, 1);
+    UtAssert_BOOL_TRUE(DS_AppData.ReplaySeekPending);
+    UtAssert_UINT32_EQ(DS_AppData.ReplaySeekSeconds, 1000);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_REPLAY_SEEK_CMD_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+
+    /* Verify command struct size minus header is at least explicitly padded to 32-bit boundaries */
+    UtAssert_True(CMD_STRUCT_DATA_IS_32_ALIGNED(DS_ReplaySeekCmd_t), "DS_ReplaySeekCmd_t is 32-bit aligned");
+}
+
+void DS_ReplaySeekCmd_Test_Idle(void)
+{
+    UT_CmdBuf.ReplaySeekCmd.Payload.Seconds = 1000;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_ReplaySeekCmd(&UT_CmdBuf.ReplaySeekCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.CmdRejectedCounter, 1);
+    UtAssert_BOOL_FALSE(DS_AppData.ReplaySeekPending);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_REPLAY_SEEK_CMD_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_SetFilterRateCmd_Test_Nominal(void)
+{
+    DS_FilterRate_Payload_t *CmdPayload = &UT_CmdBuf.FilterRateCmd.Payload;
+
+    CmdPayload->MessageID   = DS_UT_MID_1;
+    CmdPayload->RatePackets = 10;
+    CmdPayload->RateBytes   = 4096;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_SetFilterRateCmd(&UT_CmdBuf.FilterRateCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.CmdAcceptedCounter, 1);
+
+    UtAssert_UINT32_EQ(DS_AppData.FilterTblPtr->Packet[0].RatePackets, 10);
+    UtAssert_UINT32_EQ(DS_AppData.FilterTblPtr->Packet[0].RateBytes, 4096);
+    UtAssert_STUB_COUNT(CFE_TBL_Modified, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FILTER_RATE_CMD_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+
+    /* Verify command struct size minus header is at least explicitly padded to 32-bit boundaries */
+    UtAssert_True(CMD_STRUCT_DATA_IS_32_ALIGNED(DS_SetFilterRateCmd_t), "DS_SetFilterRateCmd_t is 32-bit aligned");
+}
+
+void DS_SetFilterRateCmd_Test_InvalidMessageID(void)
+{
+    DS_FilterRate_Payload_t *CmdPayload = &UT_CmdBuf.FilterRateCmd.Payload;
+
+    CmdPayload->MessageID = CFE_SB_INVALID_MSG_ID;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_SetFilterRateCmd(&UT_CmdBuf.FilterRateCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.CmdRejectedCounter, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FILTER_RATE_CMD_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_SetFilterRateCmd_Test_FilterTableNotLoaded(void)
+{
+    DS_FilterRate_Payload_t *CmdPayload = &UT_CmdBuf.FilterRateCmd.Payload;
+
+    CmdPayload->MessageID = DS_UT_MID_1;
+
+    /* Reset table pointer to NULL (set in test setup) */
+    DS_AppData.FilterTblPtr = NULL;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_SetFilterRateCmd(&UT_CmdBuf.FilterRateCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.CmdRejectedCounter, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FILTER_RATE_CMD_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_SetFilterRateCmd_Test_MessageIDNotInFilterTable(void)
+{
+    DS_FilterRate_Payload_t *CmdPayload = &UT_CmdBuf.FilterRateCmd.Payload;
+
+    CmdPayload->MessageID = DS_UT_MID_2;
+
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableFindMsgID), DS_INDEX_NONE);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_SetFilterRateCmd(&UT_CmdBuf.FilterRateCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.CmdRejectedCounter, 1);
+    UtAssert_STUB_COUNT(CFE_TBL_Modified, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FILTER_RATE_CMD_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_SetDestRateCmd_Test_Nominal(void)
+{
+    DS_DestRate_Payload_t *CmdPayload = &UT_CmdBuf.DestRateCmd.Payload;
+
+    CmdPayload->FileTableIndex = 1;
+    CmdPayload->RatePackets    = 100;
+    CmdPayload->RateBytes      = 65536;
+
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableVerifyFileIndex), true);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_SetDestRateCmd(&UT_CmdBuf.DestRateCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.CmdAcceptedCounter, 1);
+
+    UtAssert_UINT32_EQ(DS_AppData.DestFileTblPtr->File[CmdPayload->FileTableIndex].RatePackets, 100);
+    UtAssert_UINT32_EQ(DS_AppData.DestFileTblPtr->File[CmdPayload->FileTableIndex].RateBytes, 65536);
+    UtAssert_STUB_COUNT(CFE_TBL_Modified, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_DEST_RATE_CMD_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+
+    /* Verify command struct size minus header is at least explicitly padded to 32-bit boundaries */
+    UtAssert_True(CMD_STRUCT_DATA_IS_32_ALIGNED(DS_SetDestRateCmd_t), "DS_SetDestRateCmd_t is 32-bit aligned");
+}
+
+void DS_SetDestRateCmd_Test_InvalidFileTableIndex(void)
+{
+    DS_DestRate_Payload_t *CmdPayload = &UT_CmdBuf.DestRateCmd.Payload;
+
+    CmdPayload->FileTableIndex = 99;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_SetDestRateCmd(&UT_CmdBuf.DestRateCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.CmdRejectedCounter, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_DEST_RATE_CMD_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_SetDestRateCmd_Test_FileTableNotLoaded(void)
+{
+    DS_DestRate_Payload_t *CmdPayload = &UT_CmdBuf.DestRateCmd.Payload;
+
+    CmdPayload->FileTableIndex = 1;
+
+    DS_AppData.DestFileTblPtr = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableVerifyFileIndex), true);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_SetDestRateCmd(&UT_CmdBuf.DestRateCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.CmdRejectedCounter, 1);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_DEST_RATE_CMD_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 }
 
 void UtTest_Setup(void)
@@ -1843,6 +3093,39 @@ void UtTest_Setup(void)
                "DS_GetFileInfoCmd_Test_EnabledOpen");
     UtTest_Add(DS_GetFileInfoCmd_Test_DisabledClosed, DS_Test_Setup, DS_Test_TearDown,
                "DS_GetFileInfoCmd_Test_DisabledClosed");
+    UtTest_Add(DS_GetDestStatsCmd_Test_Nominal, DS_Test_Setup, DS_Test_TearDown, "DS_GetDestStatsCmd_Test_Nominal");
+
+    UtTest_Add(DS_SetRecorderCmd_Test_Nominal, DS_Test_Setup, DS_Test_TearDown, "DS_SetRecorderCmd_Test_Nominal");
+    UtTest_Add(DS_SetRecorderCmd_Test_MoveDest, DS_Test_Setup, DS_Test_TearDown, "DS_SetRecorderCmd_Test_MoveDest");
+    UtTest_Add(DS_SetRecorderCmd_Test_Disable, DS_Test_Setup, DS_Test_TearDown, "DS_SetRecorderCmd_Test_Disable");
+    UtTest_Add(DS_SetRecorderCmd_Test_InvalidRecorderIndex, DS_Test_Setup, DS_Test_TearDown,
+               "DS_SetRecorderCmd_Test_InvalidRecorderIndex");
+    UtTest_Add(DS_SetRecorderCmd_Test_InvalidRecorderState, DS_Test_Setup, DS_Test_TearDown,
+               "DS_SetRecorderCmd_Test_InvalidRecorderState");
+    UtTest_Add(DS_SetRecorderCmd_Test_InvalidFileTableIndex, DS_Test_Setup, DS_Test_TearDown,
+               "DS_SetRecorderCmd_Test_InvalidFileTableIndex");
+    UtTest_Add(DS_SetRecorderCmd_Test_DestHeld, DS_Test_Setup, DS_Test_TearDown, "DS_SetRecorderCmd_Test_DestHeld");
+    UtTest_Add(DS_SetRecorderCmd_Test_Dumping, DS_Test_Setup, DS_Test_TearDown, "DS_SetRecorderCmd_Test_Dumping");
+    UtTest_Add(DS_TriggerRecorderCmd_Test_Nominal, DS_Test_Setup, DS_Test_TearDown,
+               "DS_TriggerRecorderCmd_Test_Nominal");
+    UtTest_Add(DS_TriggerRecorderCmd_Test_InvalidRecorderIndex, DS_Test_Setup, DS_Test_TearDown,
+               "DS_TriggerRecorderCmd_Test_InvalidRecorderIndex");
+    UtTest_Add(DS_TriggerRecorderCmd_Test_NotHolding, DS_Test_Setup, DS_Test_TearDown,
+               "DS_TriggerRecorderCmd_Test_NotHolding");
+    UtTest_Add(DS_SendCacheCmd_Test_Nominal, DS_Test_Setup, DS_Test_TearDown, "DS_SendCacheCmd_Test_Nominal");
+    UtTest_Add(DS_SendCacheCmd_Test_InvalidMID, DS_Test_Setup, DS_Test_TearDown, "DS_SendCacheCmd_Test_InvalidMID");
+    UtTest_Add(DS_SendCacheCmd_Test_NotCached, DS_Test_Setup, DS_Test_TearDown, "DS_SendCacheCmd_Test_NotCached");
+    UtTest_Add(DS_WriteCacheCmd_Test_Nominal, DS_Test_Setup, DS_Test_TearDown, "DS_WriteCacheCmd_Test_Nominal");
+    UtTest_Add(DS_WriteCacheCmd_Test_EmptyName, DS_Test_Setup, DS_Test_TearDown, "DS_WriteCacheCmd_Test_EmptyName");
+    UtTest_Add(DS_WriteCacheCmd_Test_WriteError, DS_Test_Setup, DS_Test_TearDown,
+               "DS_WriteCacheCmd_Test_WriteError");
+    UtTest_Add(DS_GetManifestCmd_Test_Nominal, DS_Test_Setup, DS_Test_TearDown, "DS_GetManifestCmd_Test_Nominal");
+    UtTest_Add(DS_GetManifestCmd_Test_InvalidIndex, DS_Test_Setup, DS_Test_TearDown,
+               "DS_GetManifestCmd_Test_InvalidIndex");
+    UtTest_Add(DS_GetManifestCmd_Test_FileTableNotLoaded, DS_Test_Setup, DS_Test_TearDown,
+               "DS_GetManifestCmd_Test_FileTableNotLoaded");
+    UtTest_Add(DS_GetManifestCmd_Test_NoManifest, DS_Test_Setup, DS_Test_TearDown,
+               "DS_GetManifestCmd_Test_NoManifest");
 
     UtTest_Add(DS_AddMIDCmd_Test_Nominal, DS_Test_Setup, DS_Test_TearDown, "DS_AddMIDCmd_Test_Nominal");
     UtTest_Add(DS_AddMIDCmd_Test_InvalidMessageID, DS_Test_Setup, DS_Test_TearDown,
@@ -1860,8 +3143,53 @@ void UtTest_Setup(void)
                "DS_RemoveMIDCmd_Test_FilterTableNotLoaded");
     UtTest_Add(DS_RemoveMIDCmd_Test_MessageIDNotAdded, DS_Test_Setup, DS_Test_TearDown,
                "DS_RemoveMIDCmd_Test_MessageIDNotAdded");
+    UtTest_Add(DS_RemoveMIDCmd_Test_WildcardCovered, DS_Test_Setup, DS_Test_TearDown,
+               "DS_RemoveMIDCmd_Test_WildcardCovered");
+    UtTest_Add(DS_RemoveMIDCmd_Test_WildcardEntry, DS_Test_Setup, DS_Test_TearDown,
+               "DS_RemoveMIDCmd_Test_WildcardEntry");
 
     UtTest_Add(DS_AppSendHkCmd_Test, DS_Test_Setup, DS_Test_TearDown, "DS_AppSendHkCmd_Test");
+    UtTest_Add(DS_AppSendHkCmd_Test_DestStats, DS_Test_Setup, DS_Test_TearDown, "DS_AppSendHkCmd_Test_DestStats");
     UtTest_Add(DS_AppSendHkCmd_Test_SnprintfFail, DS_Test_Setup, DS_Test_TearDown, "DS_AppSendHkCmd_Test_SnprintfFail");
     UtTest_Add(DS_AppSendHkCmd_Test_TblFail, DS_Test_Setup, DS_Test_TearDown, "DS_AppSendHkCmd_Test_TblFail");
+    UtTest_Add(DS_BacklogProbeCmd_Test_Nominal, DS_Test_Setup, DS_Test_TearDown, "DS_BacklogProbeCmd_Test_Nominal");
+    UtTest_Add(DS_BacklogProbeCmd_Test_NotPending, DS_Test_Setup, DS_Test_TearDown,
+               "DS_BacklogProbeCmd_Test_NotPending");
+
+    UtTest_Add(DS_ExtractFileCmd_Test_Nominal, DS_Test_Setup, DS_Test_TearDown, "DS_ExtractFileCmd_Test_Nominal");
+    UtTest_Add(DS_ExtractFileCmd_Test_EmptyName, DS_Test_Setup, DS_Test_TearDown, "DS_ExtractFileCmd_Test_EmptyName");
+    UtTest_Add(DS_ExtractFileCmd_Test_SameName, DS_Test_Setup, DS_Test_TearDown, "DS_ExtractFileCmd_Test_SameName");
+    UtTest_Add(DS_ExtractFileCmd_Test_InvalidTimeWindow, DS_Test_Setup, DS_Test_TearDown,
+               "DS_ExtractFileCmd_Test_InvalidTimeWindow");
+    UtTest_Add(DS_ExtractFileCmd_Test_TaskNotRunning, DS_Test_Setup, DS_Test_TearDown,
+               "DS_ExtractFileCmd_Test_TaskNotRunning");
+    UtTest_Add(DS_ExtractFileCmd_Test_Busy, DS_Test_Setup, DS_Test_TearDown, "DS_ExtractFileCmd_Test_Busy");
+    UtTest_Add(DS_ReplayStartCmd_Test_Nominal, DS_Test_Setup, DS_Test_TearDown, "DS_ReplayStartCmd_Test_Nominal");
+    UtTest_Add(DS_ReplayStartCmd_Test_EmptyName, DS_Test_Setup, DS_Test_TearDown, "DS_ReplayStartCmd_Test_EmptyName");
+    UtTest_Add(DS_ReplayStartCmd_Test_InvalidRate, DS_Test_Setup, DS_Test_TearDown,
+               "DS_ReplayStartCmd_Test_InvalidRate");
+    UtTest_Add(DS_ReplayStartCmd_Test_TaskNotRunning, DS_Test_Setup, DS_Test_TearDown,
+               "DS_ReplayStartCmd_Test_TaskNotRunning");
+    UtTest_Add(DS_ReplayStartCmd_Test_Busy, DS_Test_Setup, DS_Test_TearDown, "DS_ReplayStartCmd_Test_Busy");
+    UtTest_Add(DS_ReplayStopCmd_Test_Nominal, DS_Test_Setup, DS_Test_TearDown, "DS_ReplayStopCmd_Test_Nominal");
+    UtTest_Add(DS_ReplayStopCmd_Test_Idle, DS_Test_Setup, DS_Test_TearDown, "DS_ReplayStopCmd_Test_Idle");
+    UtTest_Add(DS_ReplayPauseCmd_Test_Nominal, DS_Test_Setup, DS_Test_TearDown, "DS_ReplayPauseCmd_Test_Nominal");
+    UtTest_Add(DS_ReplayPauseCmd_Test_NotActive, DS_Test_Setup, DS_Test_TearDown, "DS_ReplayPauseCmd_Test_NotActive");
+    UtTest_Add(DS_ReplayResumeCmd_Test_Nominal, DS_Test_Setup, DS_Test_TearDown, "DS_ReplayResumeCmd_Test_Nominal");
+    UtTest_Add(DS_ReplayResumeCmd_Test_NotPaused, DS_Test_Setup, DS_Test_TearDown, "DS_ReplayResumeCmd_Test_NotPaused");
+    UtTest_Add(DS_ReplayResumeCmd_Test_Idle, DS_Test_Setup, DS_Test_TearDown, "DS_ReplayResumeCmd_Test_Idle");
+    UtTest_Add(DS_ReplaySeekCmd_Test_Nominal, DS_Test_Setup, DS_Test_TearDown, "DS_ReplaySeekCmd_Test_Nominal");
+    UtTest_Add(DS_ReplaySeekCmd_Test_Idle, DS_Test_Setup, DS_Test_TearDown, "DS_ReplaySeekCmd_Test_Idle");
+    UtTest_Add(DS_SetFilterRateCmd_Test_Nominal, DS_Test_Setup, DS_Test_TearDown, "DS_SetFilterRateCmd_Test_Nominal");
+    UtTest_Add(DS_SetFilterRateCmd_Test_InvalidMessageID, DS_Test_Setup, DS_Test_TearDown,
+               "DS_SetFilterRateCmd_Test_InvalidMessageID");
+    UtTest_Add(DS_SetFilterRateCmd_Test_FilterTableNotLoaded, DS_Test_Setup, DS_Test_TearDown,
+               "DS_SetFilterRateCmd_Test_FilterTableNotLoaded");
+    UtTest_Add(DS_SetFilterRateCmd_Test_MessageIDNotInFilterTable, DS_Test_Setup, DS_Test_TearDown,
+               "DS_SetFilterRateCmd_Test_MessageIDNotInFilterTable");
+    UtTest_Add(DS_SetDestRateCmd_Test_Nominal, DS_Test_Setup, DS_Test_TearDown, "DS_SetDestRateCmd_Test_Nominal");
+    UtTest_Add(DS_SetDestRateCmd_Test_InvalidFileTableIndex, DS_Test_Setup, DS_Test_TearDown,
+               "DS_SetDestRateCmd_Test_InvalidFileTableIndex");
+    UtTest_Add(DS_SetDestRateCmd_Test_FileTableNotLoaded, DS_Test_Setup, DS_Test_TearDown,
+               "DS_SetDestRateCmd_Test_FileTableNotLoaded");
 }
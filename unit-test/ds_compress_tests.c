@@ -0,0 +1,250 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+/**
+ * @file
+ *   This file contains unit test cases for the functions contained in the file ds_compress.c
+ */
+
+/*
+ * Includes
+ */
+
+#include "ds_app.h"
+#include "ds_appdefs.h"
+#include "ds_compress.h"
+#include "ds_test_utils.h"
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+uint8 UT_DS_RawData[DS_COMPRESS_BLOCK_SIZE];
+uint8 UT_DS_CompressedData[DS_COMPRESS_BLOCK_SIZE];
+uint8 UT_DS_DecompressedData[DS_COMPRESS_BLOCK_SIZE];
+
+void UT_DS_FillRandom(uint8 *Data, uint32 Size)
+{
+    uint32 Seed = 12345;
+    uint32 i;
+
+    for (i = 0; i < Size; i++)
+    {
+        Seed    = (Seed * 1103515245) + 12345;
+        Data[i] = (uint8)(Seed >> 16);
+    }
+}
+
+void UT_DS_FillPackets(uint8 *Data, uint32 Size)
+{
+    uint32 i;
+
+    /* 32 byte "packets" with a counter and a slowly changing value */
+    for (i = 0; i < Size; i++)
+    {
+        Data[i] = (uint8)(((i % 32) == 2) ? (i / 32) : ((i % 32) < 16) ? (i % 32) : (i / 256));
+    }
+}
+
+void DS_CompressBlock_Test_Nominal(void)
+{
+    uint32 CompressedSize;
+
+    UT_DS_FillPackets(UT_DS_RawData, sizeof(UT_DS_RawData));
+
+    /* Execute the function being tested */
+    CompressedSize = DS_CompressBlock(UT_DS_RawData, sizeof(UT_DS_RawData), UT_DS_CompressedData,
+                                      sizeof(UT_DS_RawData) - 1);
+
+    /* Verify results */
+    UtAssert_NONZERO(CompressedSize);
+    UtAssert_True(CompressedSize < (sizeof(UT_DS_RawData) / 2), "CompressedSize (%u) is less than half",
+                  (unsigned int)CompressedSize);
+
+    UtAssert_UINT32_EQ(DS_DecompressBlock(UT_DS_CompressedData, CompressedSize, UT_DS_DecompressedData,
+                                          sizeof(UT_DS_DecompressedData)),
+                       sizeof(UT_DS_RawData));
+    UtAssert_ZERO(memcmp(UT_DS_DecompressedData, UT_DS_RawData, sizeof(UT_DS_RawData)));
+}
+
+void DS_CompressBlock_Test_LongLengths(void)
+{
+    uint32 CompressedSize;
+
+    /* Literal run longer than 270 bytes followed by a match longer than 270 bytes */
+    UT_DS_FillRandom(UT_DS_RawData, 300);
+    memset(&UT_DS_RawData[300], 0, 700);
+
+    /* Execute the function being tested */
+    CompressedSize = DS_CompressBlock(UT_DS_RawData, 1000, UT_DS_CompressedData, 999);
+
+    /* Verify results */
+    UtAssert_NONZERO(CompressedSize);
+    UtAssert_UINT32_EQ(DS_DecompressBlock(UT_DS_CompressedData, CompressedSize, UT_DS_DecompressedData,
+                                          sizeof(UT_DS_DecompressedData)),
+                       1000);
+    UtAssert_ZERO(memcmp(UT_DS_DecompressedData, UT_DS_RawData, 1000));
+}
+
+void DS_CompressBlock_Test_Incompressible(void)
+{
+    UT_DS_FillRandom(UT_DS_RawData, sizeof(UT_DS_RawData));
+
+    /* Execute the function being tested */
+    UtAssert_ZERO(
+        DS_CompressBlock(UT_DS_RawData, sizeof(UT_DS_RawData), UT_DS_CompressedData, sizeof(UT_DS_RawData) - 1));
+}
+
+void DS_CompressBlock_Test_Small(void)
+{
+    memcpy(UT_DS_RawData, "abcdabcd", 8);
+
+    /* Execute the function being tested - too short to search for matches */
+    UtAssert_UINT32_EQ(DS_CompressBlock(UT_DS_RawData, 8, UT_DS_CompressedData, sizeof(UT_DS_CompressedData)), 9);
+
+    /* Verify results */
+    UtAssert_UINT8_EQ(UT_DS_CompressedData[0], 0x80);
+    UtAssert_ZERO(memcmp(&UT_DS_CompressedData[1], "abcdabcd", 8));
+}
+
+void DS_CompressSequence_Test_Full(void)
+{
+    uint32 DstPos = 4;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_CompressSequence(UT_DS_CompressedData, 8, &DstPos, UT_DS_RawData, 2, 1, 4));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DstPos, 4);
+}
+
+void DS_CompressLength_Test_Nominal(void)
+{
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(DS_CompressLength(UT_DS_CompressedData, 1, 300), 3);
+
+    /* Verify results */
+    UtAssert_UINT8_EQ(UT_DS_CompressedData[1], 255);
+    UtAssert_UINT8_EQ(UT_DS_CompressedData[2], 45);
+}
+
+void DS_DecompressBlock_Test_Nominal(void)
+{
+    /* "abcd", match offset 4 length 8, then last literals "efghi" */
+    const uint8 Compressed[] = {0x44, 'a', 'b', 'c', 'd', 4, 0, 0x50, 'e', 'f', 'g', 'h', 'i'};
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(
+        DS_DecompressBlock(Compressed, sizeof(Compressed), UT_DS_DecompressedData, sizeof(UT_DS_DecompressedData)),
+        17);
+
+    /* Verify results */
+    UtAssert_ZERO(memcmp(UT_DS_DecompressedData, "abcdabcdabcdefghi", 17));
+}
+
+void DS_DecompressBlock_Test_Empty(void)
+{
+    /* Execute the function being tested */
+    UtAssert_ZERO(DS_DecompressBlock(UT_DS_CompressedData, 0, UT_DS_DecompressedData, sizeof(UT_DS_DecompressedData)));
+}
+
+void DS_DecompressBlock_Test_TruncatedLiterals(void)
+{
+    const uint8 Compressed[] = {0x50, 'a', 'b', 'c', 'd'};
+
+    /* Execute the function being tested */
+    UtAssert_ZERO(
+        DS_DecompressBlock(Compressed, sizeof(Compressed), UT_DS_DecompressedData, sizeof(UT_DS_DecompressedData)));
+}
+
+void DS_DecompressBlock_Test_TruncatedOffset(void)
+{
+    const uint8 Compressed[] = {0x44, 'a', 'b', 'c', 'd', 4};
+
+    /* Execute the function being tested */
+    UtAssert_ZERO(
+        DS_DecompressBlock(Compressed, sizeof(Compressed), UT_DS_DecompressedData, sizeof(UT_DS_DecompressedData)));
+}
+
+void DS_DecompressBlock_Test_InvalidOffset(void)
+{
+    const uint8 ZeroOffset[] = {0x44, 'a', 'b', 'c', 'd', 0, 0, 0x00};
+    const uint8 LongOffset[] = {0x44, 'a', 'b', 'c', 'd', 5, 0, 0x00};
+
+    /* Execute the function being tested */
+    UtAssert_ZERO(
+        DS_DecompressBlock(ZeroOffset, sizeof(ZeroOffset), UT_DS_DecompressedData, sizeof(UT_DS_DecompressedData)));
+    UtAssert_ZERO(
+        DS_DecompressBlock(LongOffset, sizeof(LongOffset), UT_DS_DecompressedData, sizeof(UT_DS_DecompressedData)));
+}
+
+void DS_DecompressBlock_Test_DstTooSmall(void)
+{
+    const uint8 Literals[] = {0x50, 'a', 'b', 'c', 'd', 'e'};
+    const uint8 Match[]    = {0x44, 'a', 'b', 'c', 'd', 4, 0, 0x00};
+
+    /* Execute the function being tested */
+    UtAssert_ZERO(DS_DecompressBlock(Literals, sizeof(Literals), UT_DS_DecompressedData, 4));
+    UtAssert_ZERO(DS_DecompressBlock(Match, sizeof(Match), UT_DS_DecompressedData, 8));
+}
+
+void DS_DecompressLength_Test_Nominal(void)
+{
+    const uint8 Compressed[] = {255, 45};
+    uint32      SrcPos       = 0;
+    uint32      Length       = DS_COMPRESS_TOKEN_MAX;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_DecompressLength(Compressed, sizeof(Compressed), &SrcPos, &Length));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(SrcPos, 2);
+    UtAssert_UINT32_EQ(Length, 315);
+}
+
+void DS_DecompressLength_Test_Truncated(void)
+{
+    const uint8 Compressed[] = {255};
+    uint32      SrcPos       = 0;
+    uint32      Length       = DS_COMPRESS_TOKEN_MAX;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_DecompressLength(Compressed, sizeof(Compressed), &SrcPos, &Length));
+}
+
+void UtTest_Setup(void)
+{
+    UT_DS_TEST_ADD(DS_CompressBlock_Test_Nominal);
+    UT_DS_TEST_ADD(DS_CompressBlock_Test_LongLengths);
+    UT_DS_TEST_ADD(DS_CompressBlock_Test_Incompressible);
+    UT_DS_TEST_ADD(DS_CompressBlock_Test_Small);
+
+    UT_DS_TEST_ADD(DS_CompressSequence_Test_Full);
+
+    UT_DS_TEST_ADD(DS_CompressLength_Test_Nominal);
+
+    UT_DS_TEST_ADD(DS_DecompressBlock_Test_Nominal);
+    UT_DS_TEST_ADD(DS_DecompressBlock_Test_Empty);
+    UT_DS_TEST_ADD(DS_DecompressBlock_Test_TruncatedLiterals);
+    UT_DS_TEST_ADD(DS_DecompressBlock_Test_TruncatedOffset);
+    UT_DS_TEST_ADD(DS_DecompressBlock_Test_InvalidOffset);
+    UT_DS_TEST_ADD(DS_DecompressBlock_Test_DstTooSmall);
+
+    UT_DS_TEST_ADD(DS_DecompressLength_Test_Nominal);
+    UT_DS_TEST_ADD(DS_DecompressLength_Test_Truncated);
+}
@@ -141,6 +141,33 @@ void DS_AppPipe_Test_HKInvalidRequest(void)
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 }
 
+void DS_AppPipe_Test_BacklogProbe(void)
+{
+    DS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(DS_BACKLOG_PROBE_MID), 0, sizeof(DS_BacklogProbeCmd_t));
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_AppPipe(&UT_CmdBuf.Buf));
+
+    /* Verify results -- probes are never stored */
+    UtAssert_STUB_COUNT(DS_BacklogProbeCmd, 1);
+    UtAssert_STUB_COUNT(DS_AppStorePacket, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_AppPipe_Test_BacklogProbeInvalidLength(void)
+{
+    DS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(DS_BACKLOG_PROBE_MID), 0, 1);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_AppPipe(&UT_CmdBuf.Buf));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(DS_BacklogProbeCmd, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_HKREQ_LEN_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
 void DS_AppPipe_Test_UnknownMID(void)
 {
     DS_Dispatch_Test_SetupMsg(DS_UT_MID_1, 0, 1);
@@ -535,6 +562,286 @@ void DS_AppProcessCmd_Test_CloseAll(void)
     UtAssert_STUB_COUNT(DS_CloseAllCmd, 1);
 }
 
+void DS_AppProcessCmd_Test_ExtractFile(void)
+{
+    DS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(DS_CMD_MID), DS_EXTRACT_FILE_CC, sizeof(DS_ExtractFileCmd_t));
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_AppProcessCmd(&UT_CmdBuf.Buf));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(DS_ExtractFileCmd, 1);
+
+    /* Now with an invalid size */
+    DS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(DS_CMD_MID), DS_EXTRACT_FILE_CC, 1);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_AppProcessCmd(&UT_CmdBuf.Buf));
+
+    /* Should NOT have invoked the handler this time */
+    UtAssert_STUB_COUNT(DS_ExtractFileCmd, 1);
+}
+
+void DS_AppProcessCmd_Test_ReplayStart(void)
+{
+    DS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(DS_CMD_MID), DS_REPLAY_START_CC, sizeof(DS_ReplayStartCmd_t));
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_AppProcessCmd(&UT_CmdBuf.Buf));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(DS_ReplayStartCmd, 1);
+
+    /* Now with an invalid size */
+    DS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(DS_CMD_MID), DS_REPLAY_START_CC, 1);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_AppProcessCmd(&UT_CmdBuf.Buf));
+
+    /* Should NOT have invoked the handler this time */
+    UtAssert_STUB_COUNT(DS_ReplayStartCmd, 1);
+}
+
+void DS_AppProcessCmd_Test_ReplayStop(void)
+{
+    DS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(DS_CMD_MID), DS_REPLAY_STOP_CC, sizeof(DS_ReplayStopCmd_t));
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_AppProcessCmd(&UT_CmdBuf.Buf));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(DS_ReplayStopCmd, 1);
+
+    /* Now with an invalid size */
+    DS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(DS_CMD_MID), DS_REPLAY_STOP_CC, 1);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_AppProcessCmd(&UT_CmdBuf.Buf));
+
+    /* Should NOT have invoked the handler this time */
+    UtAssert_STUB_COUNT(DS_ReplayStopCmd, 1);
+}
+
+void DS_AppProcessCmd_Test_ReplayPause(void)
+{
+    DS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(DS_CMD_MID), DS_REPLAY_PAUSE_CC, sizeof(DS_ReplayPauseCmd_t));
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_AppProcessCmd(&UT_CmdBuf.Buf));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(DS_ReplayPauseCmd, 1);
+
+    /* Now with an invalid size */
+    DS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(DS_CMD_MID), DS_REPLAY_PAUSE_CC, 1);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_AppProcessCmd(&UT_CmdBuf.Buf));
+
+    /* Should NOT have invoked the handler this time */
+    UtAssert_STUB_COUNT(DS_ReplayPauseCmd, 1);
+}
+
+void DS_AppProcessCmd_Test_ReplayResume(void)
+{
+    DS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(DS_CMD_MID), DS_REPLAY_RESUME_CC, sizeof(DS_ReplayResumeCmd_t));
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_AppProcessCmd(&UT_CmdBuf.Buf));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(DS_ReplayResumeCmd, 1);
+
+    /* Now with an invalid size */
+    DS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(DS_CMD_MID), DS_REPLAY_RESUME_CC, 1);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_AppProcessCmd(&UT_CmdBuf.Buf));
+
+    /* Should NOT have invoked the handler this time */
+    UtAssert_STUB_COUNT(DS_ReplayResumeCmd, 1);
+}
+
+void DS_AppProcessCmd_Test_ReplaySeek(void)
+{
+    DS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(DS_CMD_MID), DS_REPLAY_SEEK_CC, sizeof(DS_ReplaySeekCmd_t));
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_AppProcessCmd(&UT_CmdBuf.Buf));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(DS_ReplaySeekCmd, 1);
+
+    /* Now with an invalid size */
+    DS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(DS_CMD_MID), DS_REPLAY_SEEK_CC, 1);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_AppProcessCmd(&UT_CmdBuf.Buf));
+
+    /* Should NOT have invoked the handler this time */
+    UtAssert_STUB_COUNT(DS_ReplaySeekCmd, 1);
+}
+
+void DS_AppProcessCmd_Test_SetFilterRate(void)
+{
+    DS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(DS_CMD_MID), DS_SET_FILTER_RATE_CC, sizeof(DS_SetFilterRateCmd_t));
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_AppProcessCmd(&UT_CmdBuf.Buf));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(DS_SetFilterRateCmd, 1);
+
+    /* Now with an invalid size */
+    DS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(DS_CMD_MID), DS_SET_FILTER_RATE_CC, 1);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_AppProcessCmd(&UT_CmdBuf.Buf));
+
+    /* Should NOT have invoked the handler this time */
+    UtAssert_STUB_COUNT(DS_SetFilterRateCmd, 1);
+}
+
+void DS_AppProcessCmd_Test_SetDestRate(void)
+{
+    DS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(DS_CMD_MID), DS_SET_DEST_RATE_CC, sizeof(DS_SetDestRateCmd_t));
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_AppProcessCmd(&UT_CmdBuf.Buf));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(DS_SetDestRateCmd, 1);
+
+    /* Now with an invalid size */
+    DS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(DS_CMD_MID), DS_SET_DEST_RATE_CC, 1);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_AppProcessCmd(&UT_CmdBuf.Buf));
+
+    /* Should NOT have invoked the handler this time */
+    UtAssert_STUB_COUNT(DS_SetDestRateCmd, 1);
+}
+
+void DS_AppProcessCmd_Test_GetDestStats(void)
+{
+    DS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(DS_CMD_MID), DS_GET_DEST_STATS_CC, sizeof(DS_GetDestStatsCmd_t));
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_AppProcessCmd(&UT_CmdBuf.Buf));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(DS_GetDestStatsCmd, 1);
+
+    /* Now with an invalid size */
+    DS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(DS_CMD_MID), DS_GET_DEST_STATS_CC, 1);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_AppProcessCmd(&UT_CmdBuf.Buf));
+
+    /* Should NOT have invoked the handler this time */
+    UtAssert_STUB_COUNT(DS_GetDestStatsCmd, 1);
+}
+
+void DS_AppProcessCmd_Test_SetRecorder(void)
+{
+    DS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(DS_CMD_MID), DS_SET_RECORDER_CC, sizeof(DS_SetRecorderCmd_t));
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_AppProcessCmd(&UT_CmdBuf.Buf));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(DS_SetRecorderCmd, 1);
+
+    /* Now with an invalid size */
+    DS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(DS_CMD_MID), DS_SET_RECORDER_CC, 1);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_AppProcessCmd(&UT_CmdBuf.Buf));
+
+    /* Should NOT have invoked the handler this time */
+    UtAssert_STUB_COUNT(DS_SetRecorderCmd, 1);
+}
+
+void DS_AppProcessCmd_Test_TriggerRecorder(void)
+{
+    DS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(DS_CMD_MID), DS_TRIGGER_RECORDER_CC, sizeof(DS_TriggerRecorderCmd_t));
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_AppProcessCmd(&UT_CmdBuf.Buf));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(DS_TriggerRecorderCmd, 1);
+
+    /* Now with an invalid size */
+    DS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(DS_CMD_MID), DS_TRIGGER_RECORDER_CC, 1);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_AppProcessCmd(&UT_CmdBuf.Buf));
+
+    /* Should NOT have invoked the handler this time */
+    UtAssert_STUB_COUNT(DS_TriggerRecorderCmd, 1);
+}
+
+void DS_AppProcessCmd_Test_SendCache(void)
+{
+    DS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(DS_CMD_MID), DS_SEND_CACHE_CC, sizeof(DS_SendCacheCmd_t));
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_AppProcessCmd(&UT_CmdBuf.Buf));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(DS_SendCacheCmd, 1);
+
+    /* Now with an invalid size */
+    DS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(DS_CMD_MID), DS_SEND_CACHE_CC, 1);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_AppProcessCmd(&UT_CmdBuf.Buf));
+
+    /* Should NOT have invoked the handler this time */
+    UtAssert_STUB_COUNT(DS_SendCacheCmd, 1);
+}
+
+void DS_AppProcessCmd_Test_WriteCache(void)
+{
+    DS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(DS_CMD_MID), DS_WRITE_CACHE_CC, sizeof(DS_WriteCacheCmd_t));
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_AppProcessCmd(&UT_CmdBuf.Buf));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(DS_WriteCacheCmd, 1);
+
+    /* Now with an invalid size */
+    DS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(DS_CMD_MID), DS_WRITE_CACHE_CC, 1);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_AppProcessCmd(&UT_CmdBuf.Buf));
+
+    /* Should NOT have invoked the handler this time */
+    UtAssert_STUB_COUNT(DS_WriteCacheCmd, 1);
+}
+
+void DS_AppProcessCmd_Test_GetManifest(void)
+{
+    DS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(DS_CMD_MID), DS_GET_MANIFEST_CC, sizeof(DS_GetManifestCmd_t));
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_AppProcessCmd(&UT_CmdBuf.Buf));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(DS_GetManifestCmd, 1);
+
+    /* Now with an invalid size */
+    DS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(DS_CMD_MID), DS_GET_MANIFEST_CC, 1);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_AppProcessCmd(&UT_CmdBuf.Buf));
+
+    /* Should NOT have invoked the handler this time */
+    UtAssert_STUB_COUNT(DS_GetManifestCmd, 1);
+}
+
 void DS_AppProcessCmd_Test_InvalidCommandCode(void)
 {
     DS_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(DS_CMD_MID), 99, sizeof(DS_CloseAllCmd_t));
@@ -555,6 +862,8 @@ void UtTest_Setup(void)
     UT_DS_TEST_ADD(DS_AppPipe_Test_HKStore);
     UT_DS_TEST_ADD(DS_AppPipe_Test_HKNoStore);
     UT_DS_TEST_ADD(DS_AppPipe_Test_HKInvalidRequest);
+    UT_DS_TEST_ADD(DS_AppPipe_Test_BacklogProbe);
+    UT_DS_TEST_ADD(DS_AppPipe_Test_BacklogProbeInvalidLength);
     UT_DS_TEST_ADD(DS_AppPipe_Test_UnknownMID);
 
     UT_DS_TEST_ADD(DS_AppProcessCmd_Test_Noop);
@@ -576,5 +885,19 @@ void UtTest_Setup(void)
     UT_DS_TEST_ADD(DS_AppProcessCmd_Test_AddMID);
     UT_DS_TEST_ADD(DS_AppProcessCmd_Test_RemoveMID);
     UT_DS_TEST_ADD(DS_AppProcessCmd_Test_CloseAll);
+    UT_DS_TEST_ADD(DS_AppProcessCmd_Test_ExtractFile);
+    UT_DS_TEST_ADD(DS_AppProcessCmd_Test_ReplayStart);
+    UT_DS_TEST_ADD(DS_AppProcessCmd_Test_ReplayStop);
+    UT_DS_TEST_ADD(DS_AppProcessCmd_Test_ReplayPause);
+    UT_DS_TEST_ADD(DS_AppProcessCmd_Test_ReplayResume);
+    UT_DS_TEST_ADD(DS_AppProcessCmd_Test_ReplaySeek);
+    UT_DS_TEST_ADD(DS_AppProcessCmd_Test_SetFilterRate);
+    UT_DS_TEST_ADD(DS_AppProcessCmd_Test_SetDestRate);
+    UT_DS_TEST_ADD(DS_AppProcessCmd_Test_GetDestStats);
+    UT_DS_TEST_ADD(DS_AppProcessCmd_Test_SetRecorder);
+    UT_DS_TEST_ADD(DS_AppProcessCmd_Test_TriggerRecorder);
+    UT_DS_TEST_ADD(DS_AppProcessCmd_Test_SendCache);
+    UT_DS_TEST_ADD(DS_AppProcessCmd_Test_WriteCache);
+    UT_DS_TEST_ADD(DS_AppProcessCmd_Test_GetManifest);
     UT_DS_TEST_ADD(DS_AppProcessCmd_Test_InvalidCommandCode);
 }
@@ -0,0 +1,893 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   This file contains unit test cases for the functions contained in the file ds_extract.c
+ */
+
+/*
+ * Includes
+ */
+
+#include "ds_app.h"
+#include "ds_appdefs.h"
+#include "ds_extract.h"
+#include "ds_file.h"
+#include "ds_msg.h"
+#include "ds_msgdefs.h"
+#include "ds_eventids.h"
+#include "ds_test_utils.h"
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+void UT_DS_SetExtractRequest(uint32 StartSeconds, uint32 StopSeconds)
+{
+    strncpy(DS_AppData.ExtractRequest.SourceName, "source", sizeof(DS_AppData.ExtractRequest.SourceName) - 1);
+    strncpy(DS_AppData.ExtractRequest.TargetName, "target", sizeof(DS_AppData.ExtractRequest.TargetName) - 1);
+
+    DS_AppData.ExtractRequest.StartSeconds = StartSeconds;
+    DS_AppData.ExtractRequest.StopSeconds  = StopSeconds;
+}
+
+void DS_ExtractInit_Test_Nominal(void)
+{
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_ExtractInit(), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.ExtractState, DS_EXTRACT_IDLE);
+    UtAssert_STUB_COUNT(OS_CountSemCreate, 1);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_ExtractInit_Test_SemCreateError(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(OS_CountSemCreate), OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_ExtractInit(), OS_ERROR);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_INIT_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_ExtractInit_Test_ChildTaskError(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CreateChildTask), CFE_ES_ERR_CHILD_TASK_CREATE);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_ExtractInit(), CFE_ES_ERR_CHILD_TASK_CREATE);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_INIT_ERR_EID);
+}
+
+void DS_ExtractTask_Test_Nominal(void)
+{
+    /* Set up the semaphore - second take fails and ends the task */
+    OS_OpenCreate(&DS_AppData.ExtractSemaphore, NULL, 0, 0);
+    DS_AppData.ExtractState = DS_EXTRACT_ACTIVE;
+
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemTake), 2, OS_ERROR);
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_ExtractTask());
+
+    /* Verify results - one (failed) extraction then task exit */
+    UtAssert_UINT32_EQ(DS_AppData.ExtractState, DS_EXTRACT_IDLE);
+    UtAssert_UINT32_EQ(DS_AppData.ExtractErrCounter, 1);
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(DS_AppData.ExtractSemaphore));
+    UtAssert_STUB_COUNT(OS_CountSemTake, 2);
+    UtAssert_STUB_COUNT(CFE_ES_PerfLogAdd, 2);
+    UtAssert_STUB_COUNT(CFE_ES_ExitChildTask, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_EXTRACT_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, DS_EXTRACT_ERR_EID);
+}
+
+void DS_ExtractFile_Test_Nominal(void)
+{
+    uint32 HeaderSize = 0;
+
+    if (DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE)
+    {
+        HeaderSize = sizeof(CFE_FS_Header_t) + sizeof(DS_FileHeader_t);
+    }
+
+    UT_DS_SetExtractRequest(0, 100);
+
+    /* Source file holds only the headers, no index file */
+    UT_SetDeferredRetcode(UT_KEY(OS_OpenCreate), 3, OS_ERROR);
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), HeaderSize);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_ExtractFile());
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.ExtractErrCounter, 0);
+    UtAssert_UINT32_EQ(DS_AppData.ExtractPacketCount, 0);
+    UtAssert_STUB_COUNT(OS_close, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_EXTRACT_DONE_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+}
+
+void DS_ExtractFile_Test_SourceOpenError(void)
+{
+    UT_DS_SetExtractRequest(0, 100);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_ExtractFile());
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.ExtractErrCounter, 1);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(OS_close, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_EXTRACT_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_ExtractFile_Test_TargetOpenError(void)
+{
+    UT_DS_SetExtractRequest(0, 100);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_OpenCreate), 2, OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_ExtractFile());
+
+    /* Verify results - source file is closed */
+    UtAssert_UINT32_EQ(DS_AppData.ExtractErrCounter, 1);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(OS_read, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_EXTRACT_ERR_EID);
+}
+
+void DS_ExtractFile_Test_SizeError(void)
+{
+    UT_DS_SetExtractRequest(0, 100);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_lseek), OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_ExtractFile());
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.ExtractErrCounter, 1);
+    UtAssert_STUB_COUNT(OS_write, 0);
+    UtAssert_STUB_COUNT(OS_close, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_EXTRACT_ERR_EID);
+}
+
+void DS_ExtractFile_Test_FormatError(void)
+{
+    struct
+    {
+        DS_FileTrailerFooter_t Footer;
+        uint32                 FirstWord;
+    } ReadData;
+    uint32 HeaderSize = 0;
+
+    if (DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE)
+    {
+        HeaderSize = sizeof(CFE_FS_Header_t) + sizeof(DS_FileHeader_t);
+    }
+
+    memset(&ReadData, 0, sizeof(ReadData));
+    ReadData.FirstWord = DS_FILE_BLOCK_MAGIC;
+
+    UT_DS_SetExtractRequest(0, 100);
+
+    /* File size, then footer seek (default), then seek to the first packet */
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, HeaderSize + 100);
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 2, HeaderSize);
+    UT_SetDataBuffer(UT_KEY(OS_read), &ReadData, sizeof(ReadData), false);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_ExtractFile());
+
+    /* Verify results - compressed file is rejected before anything is written */
+    UtAssert_UINT32_EQ(DS_AppData.ExtractErrCounter, 1);
+    UtAssert_STUB_COUNT(OS_read, 2);
+    UtAssert_STUB_COUNT(OS_write, 0);
+    UtAssert_STUB_COUNT(OS_close, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_EXTRACT_ERR_EID);
+}
+
+void DS_ExtractFile_Test_CopyHeaderError(void)
+{
+    UT_DS_SetExtractRequest(0, 100);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_OpenCreate), 3, OS_ERROR);
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_ExtractFile());
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.ExtractErrCounter, 1);
+    UtAssert_STUB_COUNT(OS_write, 0);
+    UtAssert_STUB_COUNT(OS_close, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_EXTRACT_ERR_EID);
+}
+
+void DS_ExtractFile_Test_ScanError(void)
+{
+    UT_DS_SetExtractRequest(0, 100);
+
+    /* Scan seek to start of packet data (after header copy) fails */
+    UT_SetDeferredRetcode(UT_KEY(OS_OpenCreate), 3, OS_ERROR);
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), sizeof(CFE_FS_Header_t) + sizeof(DS_FileHeader_t));
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 3, OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_ExtractFile());
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.ExtractErrCounter, 1);
+    UtAssert_STUB_COUNT(OS_close, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_EXTRACT_ERR_EID);
+}
+
+void DS_ExtractCheckFormat_Test_Nominal(void)
+{
+    osal_id_t SourceHandle = OS_OBJECT_ID_UNDEFINED;
+    uint32    FirstWord    = 0x12345678;
+
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, 100);
+    UT_SetDataBuffer(UT_KEY(OS_read), &FirstWord, sizeof(FirstWord), false);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_ExtractCheckFormat(SourceHandle, 100, 1000), OS_SUCCESS);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_read, 1);
+}
+
+void DS_ExtractCheckFormat_Test_Compressed(void)
+{
+    osal_id_t SourceHandle = OS_OBJECT_ID_UNDEFINED;
+    uint32    FirstWord    = DS_FILE_BLOCK_MAGIC;
+
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, 100);
+    UT_SetDataBuffer(UT_KEY(OS_read), &FirstWord, sizeof(FirstWord), false);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_ExtractCheckFormat(SourceHandle, 100, 1000), OS_ERR_NOT_IMPLEMENTED);
+}
+
+void DS_ExtractCheckFormat_Test_Ring(void)
+{
+    osal_id_t SourceHandle = OS_OBJECT_ID_UNDEFINED;
+    uint32    FirstWord    = 100 + sizeof(DS_FileRingHeader_t);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, 100);
+    UT_SetDataBuffer(UT_KEY(OS_read), &FirstWord, sizeof(FirstWord), false);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_ExtractCheckFormat(SourceHandle, 100, 1000), OS_ERR_NOT_IMPLEMENTED);
+}
+
+void DS_ExtractCheckFormat_Test_NoData(void)
+{
+    osal_id_t SourceHandle = OS_OBJECT_ID_UNDEFINED;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_ExtractCheckFormat(SourceHandle, 100, 102), OS_SUCCESS);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_lseek, 0);
+    UtAssert_STUB_COUNT(OS_read, 0);
+}
+
+void DS_ExtractCheckFormat_Test_SeekError(void)
+{
+    osal_id_t SourceHandle = OS_OBJECT_ID_UNDEFINED;
+
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, 50);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_ExtractCheckFormat(SourceHandle, 100, 1000), OS_ERR_INVALID_SIZE);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_read, 0);
+}
+
+void DS_ExtractCheckFormat_Test_ReadError(void)
+{
+    osal_id_t SourceHandle = OS_OBJECT_ID_UNDEFINED;
+
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, 100);
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_ExtractCheckFormat(SourceHandle, 100, 1000), OS_ERROR);
+}
+
+void DS_ExtractDataRange_Test_NoTrailer(void)
+{
+    osal_id_t              SourceHandle = OS_OBJECT_ID_UNDEFINED;
+    DS_FileTrailerFooter_t Footer;
+    uint32                 FileSize = 0;
+    uint32                 DataEnd  = 0;
+
+    memset(&Footer, 0, sizeof(Footer));
+
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, 1000);
+    UT_SetDataBuffer(UT_KEY(OS_read), &Footer, sizeof(Footer), false);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_ExtractDataRange(SourceHandle, 100, &FileSize, &DataEnd), OS_SUCCESS);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(FileSize, 1000);
+    UtAssert_UINT32_EQ(DataEnd, 1000);
+    UtAssert_STUB_COUNT(OS_read, 1);
+}
+
+void DS_ExtractDataRange_Test_Trailer(void)
+{
+    osal_id_t              SourceHandle = OS_OBJECT_ID_UNDEFINED;
+    DS_FileTrailerFooter_t Footer;
+    uint32                 FileSize = 0;
+    uint32                 DataEnd  = 0;
+
+    memset(&Footer, 0, sizeof(Footer));
+    Footer.Magic       = DS_FILE_TRAILER_MAGIC;
+    Footer.TrailerSize = 200;
+
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, 1000);
+    UT_SetDataBuffer(UT_KEY(OS_read), &Footer, sizeof(Footer), false);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_ExtractDataRange(SourceHandle, 100, &FileSize, &DataEnd), OS_SUCCESS);
+
+    /* Verify results - trailer is excluded from packet data */
+    UtAssert_UINT32_EQ(FileSize, 1000);
+    UtAssert_UINT32_EQ(DataEnd, 800);
+}
+
+void DS_ExtractDataRange_Test_BadTrailerSize(void)
+{
+    osal_id_t              SourceHandle = OS_OBJECT_ID_UNDEFINED;
+    DS_FileTrailerFooter_t Footer;
+    uint32                 FileSize = 0;
+    uint32                 DataEnd  = 0;
+
+    memset(&Footer, 0, sizeof(Footer));
+    Footer.Magic       = DS_FILE_TRAILER_MAGIC;
+    Footer.TrailerSize = 950;
+
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, 1000);
+    UT_SetDataBuffer(UT_KEY(OS_read), &Footer, sizeof(Footer), false);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_ExtractDataRange(SourceHandle, 100, &FileSize, &DataEnd), OS_SUCCESS);
+
+    /* Verify results - trailer larger than packet data is not trusted */
+    UtAssert_UINT32_EQ(DataEnd, 1000);
+}
+
+void DS_ExtractDataRange_Test_ShortFile(void)
+{
+    osal_id_t SourceHandle = OS_OBJECT_ID_UNDEFINED;
+    uint32    FileSize     = 0;
+    uint32    DataEnd      = 0;
+
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, 10);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_ExtractDataRange(SourceHandle, 100, &FileSize, &DataEnd), OS_SUCCESS);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DataEnd, 10);
+    UtAssert_STUB_COUNT(OS_lseek, 1);
+    UtAssert_STUB_COUNT(OS_read, 0);
+}
+
+void DS_ExtractDataRange_Test_SeekError(void)
+{
+    osal_id_t SourceHandle = OS_OBJECT_ID_UNDEFINED;
+    uint32    FileSize     = 0;
+    uint32    DataEnd      = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_lseek), OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_ExtractDataRange(SourceHandle, 100, &FileSize, &DataEnd), OS_ERROR);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_read, 0);
+}
+
+void DS_ExtractDataRange_Test_ReadError(void)
+{
+    osal_id_t SourceHandle = OS_OBJECT_ID_UNDEFINED;
+    uint32    FileSize     = 0;
+    uint32    DataEnd      = 0;
+
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, 1000);
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 0);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_ExtractDataRange(SourceHandle, 100, &FileSize, &DataEnd), OS_ERR_INVALID_SIZE);
+}
+
+void DS_ExtractIndexRange_Test_Nominal(void)
+{
+    uint32 DataStart = 100;
+    uint32 DataEnd   = 1000;
+    struct
+    {
+        DS_FileIndexHeader_t Header;
+        DS_FileIndexRecord_t Record[4];
+    } IndexFile;
+
+    memset(&IndexFile, 0, sizeof(IndexFile));
+    IndexFile.Header.RecordCount   = 4;
+    IndexFile.Header.DataFileSize  = 1000;
+    IndexFile.Record[0].FileOffset = 100;
+    IndexFile.Record[0].Seconds    = 10;
+    IndexFile.Record[1].FileOffset = 300;
+    IndexFile.Record[1].Seconds    = 20;
+    IndexFile.Record[2].FileOffset = 500;
+    IndexFile.Record[2].Seconds    = 30;
+    IndexFile.Record[3].FileOffset = 700;
+    IndexFile.Record[3].Seconds    = 40;
+
+    UT_SetDataBuffer(UT_KEY(OS_read), &IndexFile, sizeof(IndexFile), false);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_ExtractIndexRange("source", 25, 30, 1000, &DataStart, &DataEnd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DataStart, 300);
+    UtAssert_UINT32_EQ(DataEnd, 700);
+    UtAssert_STUB_COUNT(OS_read, 2);
+    UtAssert_STUB_COUNT(OS_close, 1);
+}
+
+void DS_ExtractIndexRange_Test_NotFinalized(void)
+{
+    uint32               DataStart = 100;
+    uint32               DataEnd   = 1000;
+    DS_FileIndexHeader_t Header;
+
+    memset(&Header, 0, sizeof(Header));
+    Header.RecordCount = 4;
+
+    UT_SetDataBuffer(UT_KEY(OS_read), &Header, sizeof(Header), false);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_ExtractIndexRange("source", 25, 30, 1000, &DataStart, &DataEnd));
+
+    /* Verify results - range unchanged */
+    UtAssert_UINT32_EQ(DataStart, 100);
+    UtAssert_UINT32_EQ(DataEnd, 1000);
+    UtAssert_STUB_COUNT(OS_read, 1);
+    UtAssert_STUB_COUNT(OS_close, 1);
+}
+
+void DS_ExtractIndexRange_Test_BadRecord(void)
+{
+    uint32 DataStart = 100;
+    uint32 DataEnd   = 1000;
+    struct
+    {
+        DS_FileIndexHeader_t Header;
+        DS_FileIndexRecord_t Record[2];
+    } IndexFile;
+
+    memset(&IndexFile, 0, sizeof(IndexFile));
+    IndexFile.Header.RecordCount   = 2;
+    IndexFile.Header.DataFileSize  = 1000;
+    IndexFile.Record[0].FileOffset = 300;
+    IndexFile.Record[0].Seconds    = 10;
+    IndexFile.Record[1].FileOffset = 2000;
+    IndexFile.Record[1].Seconds    = 20;
+
+    UT_SetDataBuffer(UT_KEY(OS_read), &IndexFile, sizeof(IndexFile), false);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_ExtractIndexRange("source", 25, 30, 1000, &DataStart, &DataEnd));
+
+    /* Verify results - index is ignored */
+    UtAssert_UINT32_EQ(DataStart, 100);
+    UtAssert_UINT32_EQ(DataEnd, 1000);
+}
+
+void DS_ExtractIndexRange_Test_NoIndex(void)
+{
+    uint32 DataStart = 100;
+    uint32 DataEnd   = 1000;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_ExtractIndexRange("source", 25, 30, 1000, &DataStart, &DataEnd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DataStart, 100);
+    UtAssert_UINT32_EQ(DataEnd, 1000);
+    UtAssert_STUB_COUNT(OS_read, 0);
+    UtAssert_STUB_COUNT(OS_close, 0);
+}
+
+void DS_ExtractIndexRange_Test_NameTooLong(void)
+{
+    uint32 DataStart = 100;
+    uint32 DataEnd   = 1000;
+    char   SourceName[DS_TOTAL_FNAME_BUFSIZE];
+
+    memset(SourceName, 'a', sizeof(SourceName) - 1);
+    SourceName[sizeof(SourceName) - 1] = '\0';
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_ExtractIndexRange(SourceName, 25, 30, 1000, &DataStart, &DataEnd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DataStart, 100);
+    UtAssert_UINT32_EQ(DataEnd, 1000);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+}
+
+void DS_ExtractCopyHeader_Test_Nominal(void)
+{
+    osal_id_t SourceHandle = OS_OBJECT_ID_UNDEFINED;
+    osal_id_t TargetHandle = OS_OBJECT_ID_UNDEFINED;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 100);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_ExtractCopyHeader(SourceHandle, TargetHandle, 100), OS_SUCCESS);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_lseek, 1);
+    UtAssert_STUB_COUNT(OS_read, 1);
+    UtAssert_STUB_COUNT(OS_write, 1);
+}
+
+void DS_ExtractCopyHeader_Test_NoHeader(void)
+{
+    osal_id_t SourceHandle = OS_OBJECT_ID_UNDEFINED;
+    osal_id_t TargetHandle = OS_OBJECT_ID_UNDEFINED;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_ExtractCopyHeader(SourceHandle, TargetHandle, 0), OS_SUCCESS);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_read, 0);
+    UtAssert_STUB_COUNT(OS_write, 0);
+}
+
+void DS_ExtractCopyHeader_Test_ShortRead(void)
+{
+    osal_id_t SourceHandle = OS_OBJECT_ID_UNDEFINED;
+    osal_id_t TargetHandle = OS_OBJECT_ID_UNDEFINED;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 50);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_ExtractCopyHeader(SourceHandle, TargetHandle, 100), OS_ERR_INVALID_SIZE);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_write, 0);
+}
+
+void DS_ExtractCopyHeader_Test_WriteError(void)
+{
+    osal_id_t SourceHandle = OS_OBJECT_ID_UNDEFINED;
+    osal_id_t TargetHandle = OS_OBJECT_ID_UNDEFINED;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 100);
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_ExtractCopyHeader(SourceHandle, TargetHandle, 100), OS_ERROR);
+}
+
+void DS_ExtractScan_Test_Nominal(void)
+{
+    osal_id_t          SourceHandle  = OS_OBJECT_ID_UNDEFINED;
+    osal_id_t          TargetHandle  = OS_OBJECT_ID_UNDEFINED;
+    CFE_MSG_Size_t     PacketSize[2] = {16, 16};
+    CFE_TIME_SysTime_t PacketTime[2] = {{50, 0}, {150, 0}};
+
+    UT_DS_SetExtractRequest(0, 100);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 32);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), PacketSize, sizeof(PacketSize), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgTime), PacketTime, sizeof(PacketTime), false);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_IsValidMsgId), false);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_ExtractScan(SourceHandle, TargetHandle, 0, 32), OS_SUCCESS);
+
+    /* Verify results - second packet is after the time window */
+    UtAssert_UINT32_EQ(DS_AppData.ExtractBytesScanned, 32);
+    UtAssert_UINT32_EQ(DS_AppData.ExtractPacketCount, 1);
+    UtAssert_STUB_COUNT(OS_read, 1);
+    UtAssert_STUB_COUNT(OS_write, 1);
+}
+
+void DS_ExtractScan_Test_PacketSpansBuffer(void)
+{
+    osal_id_t      SourceHandle  = OS_OBJECT_ID_UNDEFINED;
+    osal_id_t      TargetHandle  = OS_OBJECT_ID_UNDEFINED;
+    CFE_MSG_Size_t PacketSize[3] = {DS_EXTRACT_BUFFER_SIZE - 8, 16, 16};
+
+    UT_DS_SetExtractRequest(0, 100);
+
+    /* Second packet starts 8 bytes before the end of the first buffer */
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, DS_EXTRACT_BUFFER_SIZE);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 8);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), PacketSize, sizeof(PacketSize), false);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_IsValidMsgId), false);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_ExtractScan(SourceHandle, TargetHandle, 0, DS_EXTRACT_BUFFER_SIZE + 8), OS_SUCCESS);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.ExtractBytesScanned, DS_EXTRACT_BUFFER_SIZE + 8);
+    UtAssert_UINT32_EQ(DS_AppData.ExtractPacketCount, 2);
+    UtAssert_STUB_COUNT(OS_read, 2);
+    UtAssert_STUB_COUNT(OS_write, 2);
+}
+
+void DS_ExtractScan_Test_InvalidPacketSize(void)
+{
+    osal_id_t      SourceHandle = OS_OBJECT_ID_UNDEFINED;
+    osal_id_t      TargetHandle = OS_OBJECT_ID_UNDEFINED;
+    CFE_MSG_Size_t PacketSize   = 0;
+
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 32);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &PacketSize, sizeof(PacketSize), false);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_ExtractScan(SourceHandle, TargetHandle, 0, 32), OS_ERR_INVALID_SIZE);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.ExtractBytesScanned, 0);
+    UtAssert_STUB_COUNT(OS_write, 0);
+}
+
+void DS_ExtractScan_Test_TaggedRecord(void)
+{
+    osal_id_t SourceHandle = OS_OBJECT_ID_UNDEFINED;
+    osal_id_t TargetHandle = OS_OBJECT_ID_UNDEFINED;
+    uint8     Record[32];
+
+    /* Delta and truncated records have the tag bit set in their first byte */
+    memset(Record, 0, sizeof(Record));
+    Record[0] = DS_FILE_RECORD_TAG_BIT;
+
+    UT_SetDataBuffer(UT_KEY(OS_read), Record, sizeof(Record), false);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_ExtractScan(SourceHandle, TargetHandle, 0, 32), OS_ERR_NOT_IMPLEMENTED);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.ExtractPacketCount, 0);
+    UtAssert_STUB_COUNT(OS_write, 0);
+}
+
+void DS_ExtractScan_Test_TruncatedPacket(void)
+{
+    osal_id_t      SourceHandle  = OS_OBJECT_ID_UNDEFINED;
+    osal_id_t      TargetHandle  = OS_OBJECT_ID_UNDEFINED;
+    CFE_MSG_Size_t PacketSize[2] = {48, 48};
+
+    /* Packet is longer than the data that remains */
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 32);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), PacketSize, sizeof(PacketSize), false);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_ExtractScan(SourceHandle, TargetHandle, 0, 32), OS_ERR_INVALID_SIZE);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_read, 1);
+    UtAssert_STUB_COUNT(OS_write, 0);
+}
+
+void DS_ExtractScan_Test_SeekError(void)
+{
+    osal_id_t SourceHandle = OS_OBJECT_ID_UNDEFINED;
+    osal_id_t TargetHandle = OS_OBJECT_ID_UNDEFINED;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_lseek), OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_ExtractScan(SourceHandle, TargetHandle, 0, 32), OS_ERROR);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_read, 0);
+}
+
+void DS_ExtractScan_Test_ReadError(void)
+{
+    osal_id_t SourceHandle = OS_OBJECT_ID_UNDEFINED;
+    osal_id_t TargetHandle = OS_OBJECT_ID_UNDEFINED;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_ExtractScan(SourceHandle, TargetHandle, 0, 32), OS_ERROR);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_MSG_GetSize, 0);
+}
+
+void DS_ExtractScan_Test_WriteError(void)
+{
+    osal_id_t      SourceHandle = OS_OBJECT_ID_UNDEFINED;
+    osal_id_t      TargetHandle = OS_OBJECT_ID_UNDEFINED;
+    CFE_MSG_Size_t PacketSize   = 16;
+
+    UT_DS_SetExtractRequest(0, 100);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 32);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &PacketSize, sizeof(PacketSize), false);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_IsValidMsgId), false);
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_ExtractScan(SourceHandle, TargetHandle, 0, 32), OS_ERROR);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.ExtractPacketCount, 0);
+    UtAssert_STUB_COUNT(OS_write, 1);
+}
+
+void DS_ExtractPacketMatch_Test_AnyMid(void)
+{
+    CFE_TIME_SysTime_t PacketTime = {50, 0};
+
+    UT_DS_SetExtractRequest(0, 100);
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_IsValidMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgTime), &PacketTime, sizeof(PacketTime), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_ExtractPacketMatch(&UT_CmdBuf.Buf.Msg));
+}
+
+void DS_ExtractPacketMatch_Test_MidMatch(void)
+{
+    CFE_SB_MsgId_t     MessageID  = CFE_SB_ValueToMsgId(0x0801);
+    CFE_TIME_SysTime_t PacketTime = {50, 0};
+
+    UT_DS_SetExtractRequest(0, 100);
+    DS_AppData.ExtractRequest.MessageID[0] = CFE_SB_ValueToMsgId(0x0800);
+    DS_AppData.ExtractRequest.MessageID[1] = CFE_SB_ValueToMsgId(0x0801);
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_IsValidMsgId), true);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MessageID, sizeof(MessageID), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgTime), &PacketTime, sizeof(PacketTime), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_ExtractPacketMatch(&UT_CmdBuf.Buf.Msg));
+}
+
+void DS_ExtractPacketMatch_Test_MidNoMatch(void)
+{
+    CFE_SB_MsgId_t MessageID = CFE_SB_ValueToMsgId(0x0802);
+
+    UT_DS_SetExtractRequest(0, 100);
+    DS_AppData.ExtractRequest.MessageID[0] = CFE_SB_ValueToMsgId(0x0800);
+    DS_AppData.ExtractRequest.MessageID[1] = CFE_SB_ValueToMsgId(0x0801);
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_IsValidMsgId), true);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MessageID, sizeof(MessageID), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_ExtractPacketMatch(&UT_CmdBuf.Buf.Msg));
+
+    /* Verify results - time is not checked */
+    UtAssert_STUB_COUNT(CFE_MSG_GetMsgTime, 0);
+}
+
+void DS_ExtractPacketMatch_Test_BeforeWindow(void)
+{
+    CFE_TIME_SysTime_t PacketTime = {5, 0};
+
+    UT_DS_SetExtractRequest(10, 100);
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_IsValidMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgTime), &PacketTime, sizeof(PacketTime), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_ExtractPacketMatch(&UT_CmdBuf.Buf.Msg));
+}
+
+void UtTest_Setup(void)
+{
+    UT_DS_TEST_ADD(DS_ExtractInit_Test_Nominal);
+    UT_DS_TEST_ADD(DS_ExtractInit_Test_SemCreateError);
+    UT_DS_TEST_ADD(DS_ExtractInit_Test_ChildTaskError);
+
+    UT_DS_TEST_ADD(DS_ExtractTask_Test_Nominal);
+
+    UT_DS_TEST_ADD(DS_ExtractFile_Test_Nominal);
+    UT_DS_TEST_ADD(DS_ExtractFile_Test_SourceOpenError);
+    UT_DS_TEST_ADD(DS_ExtractFile_Test_TargetOpenError);
+    UT_DS_TEST_ADD(DS_ExtractFile_Test_SizeError);
+    UT_DS_TEST_ADD(DS_ExtractFile_Test_FormatError);
+
+    if (DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE)
+    {
+        UT_DS_TEST_ADD(DS_ExtractFile_Test_CopyHeaderError);
+        UT_DS_TEST_ADD(DS_ExtractFile_Test_ScanError);
+    }
+
+    UT_DS_TEST_ADD(DS_ExtractCheckFormat_Test_Nominal);
+    UT_DS_TEST_ADD(DS_ExtractCheckFormat_Test_Compressed);
+    UT_DS_TEST_ADD(DS_ExtractCheckFormat_Test_Ring);
+    UT_DS_TEST_ADD(DS_ExtractCheckFormat_Test_NoData);
+    UT_DS_TEST_ADD(DS_ExtractCheckFormat_Test_SeekError);
+    UT_DS_TEST_ADD(DS_ExtractCheckFormat_Test_ReadError);
+
+    UT_DS_TEST_ADD(DS_ExtractDataRange_Test_NoTrailer);
+    UT_DS_TEST_ADD(DS_ExtractDataRange_Test_Trailer);
+    UT_DS_TEST_ADD(DS_ExtractDataRange_Test_BadTrailerSize);
+    UT_DS_TEST_ADD(DS_ExtractDataRange_Test_ShortFile);
+    UT_DS_TEST_ADD(DS_ExtractDataRange_Test_SeekError);
+    UT_DS_TEST_ADD(DS_ExtractDataRange_Test_ReadError);
+
+    UT_DS_TEST_ADD(DS_ExtractIndexRange_Test_Nominal);
+    UT_DS_TEST_ADD(DS_ExtractIndexRange_Test_NotFinalized);
+    UT_DS_TEST_ADD(DS_ExtractIndexRange_Test_BadRecord);
+    UT_DS_TEST_ADD(DS_ExtractIndexRange_Test_NoIndex);
+    UT_DS_TEST_ADD(DS_ExtractIndexRange_Test_NameTooLong);
+
+    UT_DS_TEST_ADD(DS_ExtractCopyHeader_Test_Nominal);
+    UT_DS_TEST_ADD(DS_ExtractCopyHeader_Test_NoHeader);
+    UT_DS_TEST_ADD(DS_ExtractCopyHeader_Test_ShortRead);
+    UT_DS_TEST_ADD(DS_ExtractCopyHeader_Test_WriteError);
+
+    UT_DS_TEST_ADD(DS_ExtractScan_Test_Nominal);
+    UT_DS_TEST_ADD(DS_ExtractScan_Test_PacketSpansBuffer);
+    UT_DS_TEST_ADD(DS_ExtractScan_Test_InvalidPacketSize);
+    UT_DS_TEST_ADD(DS_ExtractScan_Test_TaggedRecord);
+    UT_DS_TEST_ADD(DS_ExtractScan_Test_TruncatedPacket);
+    UT_DS_TEST_ADD(DS_ExtractScan_Test_SeekError);
+    UT_DS_TEST_ADD(DS_ExtractScan_Test_ReadError);
+    UT_DS_TEST_ADD(DS_ExtractScan_Test_WriteError);
+
+    UT_DS_TEST_ADD(DS_ExtractPacketMatch_Test_AnyMid);
+    UT_DS_TEST_ADD(DS_ExtractPacketMatch_Test_MidMatch);
+    UT_DS_TEST_ADD(DS_ExtractPacketMatch_Test_MidNoMatch);
+    UT_DS_TEST_ADD(DS_ExtractPacketMatch_Test_BeforeWindow);
+}
@@ -28,6 +28,7 @@
 #include "ds_app.h"
 #include "ds_appdefs.h"
 #include "ds_file.h"
+#include "ds_compress.h"
 #include "ds_msg.h"
 #include "ds_msgdefs.h"
 #include "ds_msgids.h"
@@ -51,6 +52,28 @@ void UT_CFE_TIME_Print_CustomHandler(void *UserObj, UT_EntryKey_t FuncKey, const
     snprintf(PrintBuffer, CFE_TIME_PRINTED_STRING_SIZE, "1980-001-00:00.00.00000");
 }
 
+CFE_MSG_SequenceCount_t UT_DS_SetSeqCnt;
+CFE_TIME_SysTime_t      UT_DS_SetTime;
+
+void UT_CFE_MSG_SetSequenceCount_CustomHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    UT_DS_SetSeqCnt = UT_Hook_GetArgValueByName(Context, "SeqCnt", CFE_MSG_SequenceCount_t);
+}
+
+void UT_CFE_MSG_SetMsgTime_CustomHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    UT_DS_SetTime = UT_Hook_GetArgValueByName(Context, "NewTime", CFE_TIME_SysTime_t);
+}
+
+size_t UT_DS_MsgSize;
+
+void UT_CFE_MSG_GetSize_CustomHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CFE_MSG_Size_t *Size = UT_Hook_GetArgValueByName(Context, "Size", CFE_MSG_Size_t *);
+
+    *Size = UT_DS_MsgSize;
+}
+
 /*
  * Helper Functions
  */
@@ -62,6 +85,40 @@ void UT_DS_SetDestFileEntry(DS_DestFileEntry_t *DestFileEntryPtr)
     strncpy(DestFileEntryPtr->Extension, "ext", sizeof(DestFileEntryPtr->Extension));
 }
 
+/* Telemetry packet with a short payload for delta record tests */
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t Header;
+    uint8                     Payload[8];
+} UT_DS_TlmPacket_t;
+
+void UT_DS_SetTlmPacket(UT_DS_TlmPacket_t *Packet, DS_FileRecordRef_t *RecordRef)
+{
+    uint8 *        PacketBytes  = (uint8 *)Packet;
+    CFE_MSG_Type_t MessageType  = CFE_MSG_Type_Tlm;
+    bool           HasSecondary = true;
+    uint32         i;
+
+    memset(Packet, 0, sizeof(*Packet));
+    PacketBytes[0] = 0x08;
+    PacketBytes[1] = 0x10;
+    for (i = 0; i < sizeof(Packet->Payload); i++)
+    {
+        Packet->Payload[i] = (uint8)(i + 1);
+    }
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &MessageType, sizeof(MessageType), true);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetHasSecondaryHeader), &HasSecondary, sizeof(HasSecondary), true);
+
+    /* Remember the same header for the stream */
+    if (RecordRef != NULL)
+    {
+        RecordRef->StreamId   = 0x0810;
+        RecordRef->PacketSize = sizeof(*Packet);
+        memcpy(&RecordRef->Header, Packet, sizeof(RecordRef->Header));
+    }
+}
+
 /*
  * Function Definitions
  */
@@ -94,12 +151,19 @@ void DS_FileStorePacket_Test_Nominal(void)
     DS_AppData.FileStatus[0].FileState                          = DS_ENABLED;
     DS_AppData.FileStatus[0].FileHandle                         = DS_UT_OBJID_1;
     DS_AppData.FileStatus[0].FileSize                           = 0;
+    DS_AppData.ReceiveTime                                      = 1;
+
+    UT_SetDefaultReturnValue(UT_KEY(DS_AppStatsRecord), 7);
 
     /* Execute the function being tested */
     UtAssert_VOIDCALL(DS_FileStorePacket(MessageID, &UT_CmdBuf.Buf));
 
-    /* Verify results */
+    /* Verify results -- receive, write and filter stages timed (if enabled) */
     UtAssert_UINT32_EQ(DS_AppData.PassedPktCounter, 1);
+    UtAssert_STUB_COUNT(DS_AppStatsTime, (DS_STATS_TIMING == 1) ? 3 : 0);
+    UtAssert_STUB_COUNT(DS_AppStatsRecord, (DS_STATS_TIMING == 1) ? 3 : 0);
+    UtAssert_INT32_EQ(DS_AppData.ReceiveTime, (DS_STATS_TIMING == 1) ? 0 : 1);
+    UtAssert_UINT32_EQ(DS_AppData.DestStats[0].MaxWriteTime, (DS_STATS_TIMING == 1) ? 7 : 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
@@ -164,6 +228,184 @@ void DS_FileStorePacket_Test_PassedFilterFalse(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
+void DS_FileStorePacket_Test_ChangeFilter(void)
+{
+    CFE_SB_MsgId_t          MessageID = DS_UT_MID_1;
+    DS_HashLink_t           HashLink;
+    size_t                  forced_Size     = sizeof(DS_NoopCmd_t);
+    CFE_SB_MsgId_t          forced_MsgID    = CFE_SB_ValueToMsgId(DS_CMD_MID);
+    CFE_MSG_FcnCode_t       forced_CmdCode  = DS_NOOP_CC;
+    CFE_MSG_SequenceCount_t forced_SeqCount = 0;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &forced_MsgID, sizeof(forced_MsgID), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &forced_CmdCode, sizeof(forced_CmdCode), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSequenceCount), &forced_SeqCount, sizeof(forced_SeqCount), false);
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableFindMsgID), 0);
+
+    DS_AppData.DestFileTblPtr->File[0].MaxFileSize = forced_Size * 2;
+
+    DS_AppData.HashTable[187]                                   = &HashLink;
+    HashLink.Index                                              = 0;
+    DS_AppData.FilterTblPtr->Packet[0].MessageID                = DS_UT_MID_1;
+    DS_AppData.FilterTblPtr->Packet[0].Filter[0].Algorithm_N    = 1;
+    DS_AppData.FilterTblPtr->Packet[0].Filter[0].Algorithm_X    = 10;
+    DS_AppData.FilterTblPtr->Packet[0].Filter[0].Algorithm_O    = 0;
+    DS_AppData.FilterTblPtr->Packet[0].Filter[0].FilterType     = DS_BY_CHANGE;
+    DS_AppData.FilterTblPtr->Packet[0].Filter[0].FileTableIndex = 0;
+    DS_AppData.FileStatus[0].FileState                          = DS_ENABLED;
+    DS_AppData.FileStatus[0].FileHandle                         = DS_UT_OBJID_1;
+    DS_AppData.FileStatus[0].FileSize                           = 0;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileStorePacket(MessageID, &UT_CmdBuf.Buf));
+
+    /* Verify results - the first packet is always stored */
+    UtAssert_UINT32_EQ(DS_AppData.PassedPktCounter, 1);
+    UtAssert_BOOL_TRUE(DS_AppData.FilterChange[0][0].Stored);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileStorePacket_Test_WindowFilter(void)
+{
+    CFE_SB_MsgId_t     MessageID  = DS_UT_MID_1;
+    CFE_TIME_SysTime_t PacketTime = {100, 0};
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgTime), &PacketTime, sizeof(PacketTime), false);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TIME_Sub2MicroSecs), 100000);
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableFindMsgID), 0);
+
+    DS_AppData.FilterTblPtr->Packet[0].MessageID             = DS_UT_MID_1;
+    DS_AppData.FilterTblPtr->Packet[0].Filter[0].Algorithm_N = 1;
+    DS_AppData.FilterTblPtr->Packet[0].Filter[0].Algorithm_X = 250;
+    DS_AppData.FilterTblPtr->Packet[0].Filter[0].Algorithm_O = 3;
+    DS_AppData.FilterTblPtr->Packet[0].Filter[0].FilterType  = DS_BY_WINDOW;
+    DS_AppData.FileStatus[0].FileState                       = DS_ENABLED;
+    DS_AppData.FilterWindow[0][0].Stored                     = true;
+    DS_AppData.FilterWindow[0][0].LastStored                 = 100000000;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileStorePacket(MessageID, &UT_CmdBuf.Buf));
+
+    /* Verify results - 100 ms after the last stored packet is inside the 250 ms window */
+    UtAssert_UINT32_EQ(DS_AppData.FilteredPktCounter, 1);
+    UtAssert_ZERO(DS_AppData.PassedPktCounter);
+    UtAssert_STUB_COUNT(CFE_MSG_GetSequenceCount, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileStorePacket_Test_PredicateMismatch(void)
+{
+    CFE_SB_MsgId_t MessageID   = DS_UT_MID_1;
+    size_t         forced_Size = 4;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableFindMsgID), 0);
+
+    DS_AppData.FilterTblPtr->Packet[0].MessageID             = DS_UT_MID_1;
+    DS_AppData.FilterTblPtr->Packet[0].Filter[0].Algorithm_N = 1;
+    DS_AppData.FilterTblPtr->Packet[0].Filter[0].Algorithm_X = 1;
+    DS_AppData.FilterTblPtr->Packet[0].Filter[0].FilterType  = DS_BY_COUNT;
+    DS_AppData.FileStatus[0].FileState                       = DS_ENABLED;
+    DS_AppData.FilterPredicate[0].TermCount                  = 1;
+    DS_AppData.FilterPredicate[0].Term[0].Offset             = 4;
+    DS_AppData.FilterPredicate[0].Term[0].End                = 5;
+    DS_AppData.FilterPredicate[0].Term[0].Width              = 1;
+    DS_AppData.FilterPredicate[0].Term[0].Mask               = 0xFF;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileStorePacket(MessageID, &UT_CmdBuf.Buf));
+
+    /* Verify results - short packet does not match, filters are not applied */
+    UtAssert_UINT32_EQ(DS_AppData.FilteredPktCounter, 1);
+    UtAssert_ZERO(DS_AppData.PassedPktCounter);
+    UtAssert_STUB_COUNT(CFE_MSG_GetSequenceCount, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileStorePacket_Test_Decimated(void)
+{
+    CFE_SB_MsgId_t          MessageID       = DS_UT_MID_1;
+    CFE_MSG_SequenceCount_t forced_SeqCount = 2;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSequenceCount), &forced_SeqCount, sizeof(forced_SeqCount), false);
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableFindMsgID), 0);
+
+    DS_AppData.FilterTblPtr->Packet[0].MessageID             = DS_UT_MID_1;
+    DS_AppData.FilterTblPtr->Packet[0].Filter[0].Algorithm_N = 1;
+    DS_AppData.FilterTblPtr->Packet[0].Filter[0].Algorithm_X = 2;
+    DS_AppData.FilterTblPtr->Packet[0].Filter[0].Algorithm_O = 0;
+    DS_AppData.FilterTblPtr->Packet[0].Filter[0].FilterType  = DS_BY_COUNT;
+    DS_AppData.FilterTblPtr->Packet[0].Filter[0].Priority    = DS_PRIORITY_LOW;
+    DS_AppData.FileStatus[0].FileState                       = DS_ENABLED;
+    DS_AppData.DecimationLevel                               = 1;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileStorePacket(MessageID, &UT_CmdBuf.Buf));
+
+    /* Verify results - sequence 2 passes 1 of 2, but not 1 of 4 */
+    UtAssert_UINT32_EQ(DS_AppData.FilteredPktCounter, 1);
+    UtAssert_ZERO(DS_AppData.PassedPktCounter);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileStorePacket_Test_MessageRateLimit(void)
+{
+    CFE_SB_MsgId_t     MessageID   = DS_UT_MID_1;
+    CFE_TIME_SysTime_t CurrentTime = {10, 0};
+
+    UT_SetDataBuffer(UT_KEY(CFE_TIME_GetTime), &CurrentTime, sizeof(CurrentTime), false);
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableFindMsgID), 0);
+
+    DS_AppData.FilterTblPtr->Packet[0].MessageID             = DS_UT_MID_1;
+    DS_AppData.FilterTblPtr->Packet[0].RatePackets           = 1;
+    DS_AppData.FilterTblPtr->Packet[0].Filter[0].Algorithm_N = 1;
+    DS_AppData.FilterTblPtr->Packet[0].Filter[0].Algorithm_X = 1;
+    DS_AppData.FilterTblPtr->Packet[0].Filter[0].FilterType  = DS_BY_COUNT;
+    DS_AppData.FileStatus[0].FileState                       = DS_ENABLED;
+    DS_AppData.FilterRate[0].LastTicks                       = 10 * DS_RATE_TICKS_PER_SEC;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileStorePacket(MessageID, &UT_CmdBuf.Buf));
+
+    /* Verify results - dropped before the filters are applied */
+    UtAssert_UINT32_EQ(DS_AppData.RateDropPktCounter, 1);
+    UtAssert_ZERO(DS_AppData.FilteredPktCounter);
+    UtAssert_ZERO(DS_AppData.PassedPktCounter);
+    UtAssert_STUB_COUNT(CFE_MSG_GetSequenceCount, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileStorePacket_Test_DestRateLimit(void)
+{
+    CFE_SB_MsgId_t          MessageID       = DS_UT_MID_1;
+    CFE_TIME_SysTime_t      CurrentTime     = {10, 0};
+    CFE_MSG_SequenceCount_t forced_SeqCount = 0;
+
+    UT_SetDataBuffer(UT_KEY(CFE_TIME_GetTime), &CurrentTime, sizeof(CurrentTime), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSequenceCount), &forced_SeqCount, sizeof(forced_SeqCount), false);
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableFindMsgID), 0);
+
+    DS_AppData.FilterTblPtr->Packet[0].MessageID                = DS_UT_MID_1;
+    DS_AppData.FilterTblPtr->Packet[0].Filter[0].Algorithm_N    = 1;
+    DS_AppData.FilterTblPtr->Packet[0].Filter[0].Algorithm_X    = 1;
+    DS_AppData.FilterTblPtr->Packet[0].Filter[0].FilterType     = DS_BY_COUNT;
+    DS_AppData.FilterTblPtr->Packet[0].Filter[0].FileTableIndex = 0;
+    DS_AppData.DestFileTblPtr->File[0].RatePackets              = 1;
+    DS_AppData.FileStatus[0].FileState                          = DS_ENABLED;
+    DS_AppData.DestRate[0].LastTicks                            = 10 * DS_RATE_TICKS_PER_SEC;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileStorePacket(MessageID, &UT_CmdBuf.Buf));
+
+    /* Verify results - passed the filter but not written */
+    UtAssert_UINT32_EQ(DS_AppData.RateDropPktCounter, 1);
+    UtAssert_ZERO(DS_AppData.FilteredPktCounter);
+    UtAssert_ZERO(DS_AppData.PassedPktCounter);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
 void DS_FileStorePacket_Test_DisabledDest(void)
 {
     CFE_SB_MsgId_t    MessageID = DS_UT_MID_1;
@@ -244,7 +486,7 @@ void DS_FileSetupWrite_Test_Nominal(void)
     DS_AppData.FileStatus[FileIndex].FileSize              = 3;
 
     /* Execute the function being tested */
-    UtAssert_VOIDCALL(DS_FileSetupWrite(FileIndex, &UT_CmdBuf.Buf));
+    UtAssert_VOIDCALL(DS_FileSetupWrite(FileIndex, &UT_CmdBuf.Buf, 0));
 
     /* Verify results */
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
@@ -271,7 +513,7 @@ void DS_FileSetupWrite_Test_FileHandleClosed(void)
     /* Fail creating the destination file so the file handle remains closed*/
     UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_ERROR);
 
-    UtAssert_VOIDCALL(DS_FileSetupWrite(FileIndex, &UT_CmdBuf.Buf));
+    UtAssert_VOIDCALL(DS_FileSetupWrite(FileIndex, &UT_CmdBuf.Buf, 0));
 
     /* Verify results */
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1); /* Don't care about subroutine event */
@@ -300,12 +542,168 @@ void DS_FileSetupWrite_Test_MaxFileSizeExceeded(void)
             sizeof(DS_AppData.DestFileTblPtr->File[FileIndex].Movename));
 
     /* Execute the function being tested */
-    UtAssert_VOIDCALL(DS_FileSetupWrite(FileIndex, &UT_CmdBuf.Buf));
+    UtAssert_VOIDCALL(DS_FileSetupWrite(FileIndex, &UT_CmdBuf.Buf, 0));
 
     /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.DestStats[FileIndex].RolloverCount, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileSetupWrite_Test_RingMode(void)
+{
+    int32  FileIndex   = 0;
+    size_t forced_Size = sizeof(DS_NoopCmd_t);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].MaxFileSize = 2 + forced_Size;
+    DS_AppData.FileStatus[FileIndex].FileMode              = DS_FILE_MODE_RING;
+    DS_AppData.FileStatus[FileIndex].RingDataStart         = 2;
+    DS_AppData.FileStatus[FileIndex].RingTail              = 2;
+    DS_AppData.FileStatus[FileIndex].FileSize              = 4;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileSetupWrite(FileIndex, &UT_CmdBuf.Buf, 0));
+
+    /* Verify results - ring file wrapped rather than closed */
+    UtAssert_BOOL_TRUE(OS_ObjectIdDefined(DS_AppData.FileStatus[FileIndex].FileHandle));
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].RingWrapCount, 1);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, 2 + forced_Size);
+    UtAssert_STUB_COUNT(OS_close, 0);
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileSetupWrite_Test_RingTooLarge(void)
+{
+    int32  FileIndex   = 0;
+    size_t forced_Size = sizeof(DS_NoopCmd_t);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    /* Set to fail the condition "if (DataLength > (DestFile->MaxFileSize - FileStatus->RingDataStart))" */
+    DS_AppData.DestFileTblPtr->File[FileIndex].MaxFileSize = 2 + forced_Size - 1;
+    DS_AppData.FileStatus[FileIndex].FileMode              = DS_FILE_MODE_RING;
+    DS_AppData.FileStatus[FileIndex].RingDataStart         = 2;
+    DS_AppData.FileStatus[FileIndex].RingTail              = 2;
+    DS_AppData.FileStatus[FileIndex].FileSize              = 2;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileSetupWrite(FileIndex, &UT_CmdBuf.Buf, 0));
+
+    /* Verify results - packet dropped and the ring left as it was */
+    UtAssert_BOOL_TRUE(OS_ObjectIdDefined(DS_AppData.FileStatus[FileIndex].FileHandle));
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, 2);
+    UtAssert_UINT32_EQ(DS_AppData.DestStats[FileIndex].ErrorCount, 1);
+    UtAssert_STUB_COUNT(OS_write, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileSetupWrite_Test_CompressedLimit(void)
+{
+    int32  FileIndex   = 0;
+    size_t forced_Size = sizeof(DS_NoopCmd_t);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].MaxFileSize   = 1000;
+    DS_AppData.DestFileTblPtr->File[FileIndex].SizeLimitMode = DS_SIZE_LIMIT_LOGICAL;
+    DS_AppData.FileStatus[FileIndex].CompressMode            = DS_COMPRESS_LZ;
+    DS_AppData.FileStatus[FileIndex].FileSize                = 100;
+    DS_AppData.FileStatus[FileIndex].LogicalSize             = 900;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileSetupWrite(FileIndex, &UT_CmdBuf.Buf, 0));
+
+    /* Verify results - packet buffered, file left open */
+    UtAssert_BOOL_TRUE(OS_ObjectIdDefined(DS_AppData.FileStatus[FileIndex].FileHandle));
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].LogicalSize, 900 + forced_Size);
+    UtAssert_UINT32_EQ(DS_AppData.CompressStatus[FileIndex].BlockCount, forced_Size);
+    UtAssert_STUB_COUNT(OS_close, 0);
+    UtAssert_STUB_COUNT(OS_write, 0);
+}
+
+void DS_FileSetupWrite_Test_Truncated(void)
+{
+    int32  FileIndex   = 0;
+    uint32 Packet[64];
+    size_t forced_Size = sizeof(Packet);
+
+    memset(Packet, 0x5A, sizeof(Packet));
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].MaxFileSize = 1000;
+    DS_AppData.FileStatus[FileIndex].FileSize              = 100;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileSetupWrite(FileIndex, (CFE_SB_Buffer_t *)Packet, 64));
+
+    /* Verify results - only the record prefix and first 64 bytes are written */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, 100 + DS_FILE_RECORD_TRUNC_SIZE + 64);
+    UtAssert_UINT32_EQ(((uint8 *)DS_AppData.TruncateBuffer)[0], DS_FILE_RECORD_TRUNC_TAG);
+    UtAssert_STUB_COUNT(OS_write, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
+void DS_FileSetupWrite_Test_NotTruncated(void)
+{
+    int32  FileIndex   = 0;
+    uint32 Packet[16];
+    size_t forced_Size = sizeof(Packet);
+
+    memset(Packet, 0, sizeof(Packet));
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].MaxFileSize = 1000;
+    DS_AppData.FileStatus[FileIndex].FileSize              = 100;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileSetupWrite(FileIndex, (CFE_SB_Buffer_t *)Packet, sizeof(Packet)));
+
+    /* Verify results - packets no longer than the store length are written whole */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, 100 + sizeof(Packet));
+    UtAssert_ZERO(((uint8 *)DS_AppData.TruncateBuffer)[0]);
+    UtAssert_STUB_COUNT(OS_write, 1);
+}
+
+void DS_FileTruncatePacket_Test_Nominal(void)
+{
+    uint8  Packet[300];
+    uint8 *Record = (uint8 *)DS_AppData.TruncateBuffer;
+
+    memset(Packet, 0x33, sizeof(Packet));
+    Packet[0]  = 0x08;
+    Packet[4]  = 0x01;
+    Packet[5]  = 0x25;
+    Packet[99] = 0x44;
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(DS_FileTruncatePacket((CFE_MSG_Message_t *)Packet, 260), DS_FILE_RECORD_TRUNC_SIZE + 260);
+
+    /* Verify results - prefix gives the stored length, header is intact */
+    UtAssert_UINT32_EQ(Record[0], DS_FILE_RECORD_TRUNC_TAG);
+    UtAssert_ZERO(Record[1]);
+    UtAssert_UINT32_EQ(Record[2], 0x01);
+    UtAssert_UINT32_EQ(Record[3], 0x04);
+    UtAssert_MemCmp(&Record[DS_FILE_RECORD_TRUNC_SIZE], Packet, 260, "Stored packet bytes");
+    UtAssert_STUB_COUNT(CFE_MSG_SetSize, 0);
+}
+
 void DS_FileWriteData_Test_Nominal(void)
 {
     int32             FileIndex      = 0;
@@ -324,10 +722,65 @@ void DS_FileWriteData_Test_Nominal(void)
     UtAssert_UINT32_EQ(DS_AppData.FileWriteCounter, 1);
     UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, sizeof(UT_CmdBuf.Buf));
     UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileGrowth, sizeof(UT_CmdBuf.Buf));
+    UtAssert_UINT32_EQ(DS_AppData.DestStats[FileIndex].PacketCount, 1);
+    UtAssert_UINT32_EQ(DS_AppData.DestStats[FileIndex].ByteCount, sizeof(UT_CmdBuf.Buf));
+    UtAssert_UINT32_EQ(DS_AppData.DestStats[FileIndex].WriteCalls, 1);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
+void DS_FileWriteData_Test_Index(void)
+{
+    int32 FileIndex = 0;
+
+    /* Set up the index handle */
+    OS_OpenCreate(&DS_AppData.IndexStatus[FileIndex].IndexHandle, NULL, 0, 0);
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].IndexPackets = 10;
+    DS_AppData.FileStatus[FileIndex].FileSize               = 100;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileWriteData(FileIndex, &UT_CmdBuf.Buf, sizeof(UT_CmdBuf.Buf)));
+
+    /* Verify results - first packet is always indexed at its start offset */
+    UtAssert_UINT32_EQ(DS_AppData.IndexStatus[FileIndex].RecordCount, 1);
+    UtAssert_UINT32_EQ(DS_AppData.IndexStatus[FileIndex].BufferCount, 1);
+    UtAssert_UINT32_EQ(DS_AppData.IndexStatus[FileIndex].Buffer[0].FileOffset, 100);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, 100 + sizeof(UT_CmdBuf.Buf));
+    UtAssert_STUB_COUNT(OS_write, 1);
+}
+
+void DS_FileWriteData_Test_Trailer(void)
+{
+    int32 FileIndex = 0;
+
+    DS_AppData.TrailerStatus[FileIndex].Active = true;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileWriteData(FileIndex, &UT_CmdBuf.Buf, sizeof(UT_CmdBuf.Buf)));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.TrailerStatus[FileIndex].EntryCount, 1);
+    UtAssert_UINT32_EQ(DS_AppData.TrailerStatus[FileIndex].Entry[0].PacketCount, 1);
+    UtAssert_UINT32_EQ(DS_AppData.TrailerStatus[FileIndex].Entry[0].ByteCount, sizeof(UT_CmdBuf.Buf));
+}
+
+void DS_FileWriteData_Test_PayloadCrc(void)
+{
+    int32 FileIndex = 0;
+
+    DS_AppData.FileStatus[FileIndex].PayloadCrcActive = true;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CalculateCRC), 0x1234);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileWriteData(FileIndex, &UT_CmdBuf.Buf, sizeof(UT_CmdBuf.Buf)));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_ES_CalculateCRC, 1);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].PayloadCrc, 0x1234);
+}
+
 void DS_FileWriteData_Test_Error(void)
 {
     int32  FileIndex  = 0;
@@ -360,20 +813,342 @@ void DS_FileWriteData_Test_Error(void)
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_WRITE_FILE_ERR_EID);
 }
 
-void DS_FileWriteHeader_Test_PlatformConfigCFE_Nominal(void)
+void DS_FileWriteData_Test_Compressed(void)
 {
     int32 FileIndex = 0;
 
-    DS_AppData.DestFileTblPtr->File[FileIndex].FileNameType = 1;
+    DS_AppData.FileStatus[FileIndex].CompressMode = DS_COMPRESS_LZ;
+    DS_AppData.FileStatus[FileIndex].FileSize     = 100;
+    DS_AppData.FileStatus[FileIndex].LogicalSize  = 100;
 
     /* Execute the function being tested */
-    UtAssert_VOIDCALL(DS_FileWriteHeader(FileIndex));
+    UtAssert_VOIDCALL(DS_FileWriteData(FileIndex, &UT_CmdBuf.Buf, sizeof(UT_CmdBuf.Buf)));
 
-    /* Verify results */
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    /* Verify results - packet buffered, file size changes when the block is written */
+    UtAssert_UINT32_EQ(DS_AppData.FileWriteCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, 100);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].LogicalSize, 100 + sizeof(UT_CmdBuf.Buf));
+    UtAssert_UINT32_EQ(DS_AppData.CompressStatus[FileIndex].BlockCount, sizeof(UT_CmdBuf.Buf));
+    UtAssert_STUB_COUNT(OS_write, 0);
+}
 
-    UtAssert_UINT32_EQ(DS_AppData.FileWriteCounter, 2);
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, sizeof(CFE_FS_Header_t) + sizeof(DS_FileHeader_t));
+void DS_FileWriteData_Test_CompressedError(void)
+{
+    int32 FileIndex = 0;
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    DS_AppData.FileStatus[FileIndex].CompressMode   = DS_COMPRESS_LZ;
+    DS_AppData.CompressStatus[FileIndex].BlockCount = DS_COMPRESS_BLOCK_SIZE - 1;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), -1);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileWriteData(FileIndex, &UT_CmdBuf.Buf, sizeof(UT_CmdBuf.Buf)));
+
+    /* Verify results - destination disabled, buffered data not written again at close */
+    UtAssert_UINT32_EQ(DS_AppData.FileWriteErrCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileState, DS_DISABLED);
+    UtAssert_UINT32_EQ(DS_AppData.CompressStatus[FileIndex].BlockCount, 0);
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_WRITE_FILE_ERR_EID);
+}
+
+void DS_FileWriteData_Test_Delta(void)
+{
+    int32                   FileIndex = 0;
+    UT_DS_TlmPacket_t       Packet;
+    CFE_MSG_SequenceCount_t SeqCount[3] = {2, 1, 1};
+    CFE_TIME_SysTime_t      MsgTime[3]  = {{11, 0}, {10, 0}, {10, 0}};
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].KeyframeInterval = 10;
+    DS_AppData.FileStatus[FileIndex].RecordMode                 = DS_RECORD_DELTA;
+    DS_AppData.FileStatus[FileIndex].FileSize                   = 100;
+
+    UT_DS_SetTlmPacket(&Packet, &DS_AppData.RecordStatus[FileIndex].Ref[0]);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSequenceCount), SeqCount, sizeof(SeqCount), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgTime), MsgTime, sizeof(MsgTime), false);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileWriteData(FileIndex, &Packet, sizeof(Packet)));
+
+    /* Verify results - the record replaces the header */
+    UtAssert_UINT32_EQ(DS_AppData.FileWriteCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize,
+                       100 + DS_FILE_RECORD_DELTA_SIZE + sizeof(Packet.Payload));
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileWriteData_Test_DeltaFull(void)
+{
+    int32             FileIndex = 0;
+    UT_DS_TlmPacket_t Packet;
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].KeyframeInterval = 10;
+    DS_AppData.FileStatus[FileIndex].RecordMode                 = DS_RECORD_DELTA;
+    DS_AppData.FileStatus[FileIndex].FileSize                   = 100;
+
+    UT_DS_SetTlmPacket(&Packet, NULL);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileWriteData(FileIndex, &Packet, sizeof(Packet)));
+
+    /* Verify results - first packet of the stream is written in full */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, 100 + sizeof(Packet));
+    UtAssert_UINT32_EQ(DS_AppData.RecordStatus[FileIndex].Ref[0].PacketSize, sizeof(Packet));
+    UtAssert_STUB_COUNT(OS_write, 1);
+}
+
+void DS_FileWriteData_Test_TruncatedRecord(void)
+{
+    int32  FileIndex = 0;
+    uint32 Record[8];
+
+    memset(Record, 0, sizeof(Record));
+    ((uint8 *)Record)[0] = DS_FILE_RECORD_TRUNC_TAG;
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].KeyframeInterval = 10;
+    DS_AppData.FileStatus[FileIndex].RecordMode                 = DS_RECORD_DELTA;
+    DS_AppData.FileStatus[FileIndex].FileSize                   = 100;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileWriteData(FileIndex, Record, sizeof(Record)));
+
+    /* Verify results - truncated records are written as they are */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, 100 + sizeof(Record));
+    UtAssert_STUB_COUNT(CFE_MSG_GetType, 0);
+    UtAssert_STUB_COUNT(OS_write, 1);
+}
+
+void DS_FileRingPrepare_Test_NoWrap(void)
+{
+    int32 FileIndex = 0;
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].MaxFileSize = 200;
+    DS_AppData.FileStatus[FileIndex].RingDataStart         = 100;
+    DS_AppData.FileStatus[FileIndex].RingTail              = 100;
+    DS_AppData.FileStatus[FileIndex].FileSize              = 150;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_FileRingPrepare(FileIndex, 20));
+
+    /* Verify results - packet fits so no file positioning is needed */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, 150);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].RingWrapCount, 0);
+    UtAssert_STUB_COUNT(OS_lseek, 0);
+    UtAssert_STUB_COUNT(OS_read, 0);
+}
+
+void DS_FileRingPrepare_Test_Wrap(void)
+{
+    int32  FileIndex   = 0;
+    size_t forced_Size = 30;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), sizeof(CFE_MSG_Message_t));
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].MaxFileSize = 200;
+    DS_AppData.FileStatus[FileIndex].RingDataStart         = 100;
+    DS_AppData.FileStatus[FileIndex].RingTail              = 100;
+    DS_AppData.FileStatus[FileIndex].FileSize              = 190;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_FileRingPrepare(FileIndex, 20));
+
+    /* Verify results - head wrapped and tail moved past the overwritten packet */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, 100);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].RingWrapCount, 1);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].RingWrapOffset, 190);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].RingTail, 130);
+    UtAssert_STUB_COUNT(OS_read, 1);
+    UtAssert_STUB_COUNT(OS_lseek, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileRingPrepare_Test_OlderDataOverwritten(void)
+{
+    int32  FileIndex   = 0;
+    size_t forced_Size = 30;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), sizeof(CFE_MSG_Message_t));
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].MaxFileSize = 200;
+    DS_AppData.FileStatus[FileIndex].RingDataStart         = 100;
+    DS_AppData.FileStatus[FileIndex].RingTail              = 180;
+    DS_AppData.FileStatus[FileIndex].RingWrapOffset        = 190;
+    DS_AppData.FileStatus[FileIndex].RingWrapCount         = 1;
+    DS_AppData.FileStatus[FileIndex].FileSize              = 170;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_FileRingPrepare(FileIndex, 20));
+
+    /* Verify results - nothing older than the current lap remains */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, 170);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].RingWrapOffset, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].RingTail, 100);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileRingPrepare_Test_BadRecord(void)
+{
+    int32 FileIndex = 0;
+
+    /* Set to fail reading the record header at the tail */
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), -1);
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].MaxFileSize = 200;
+    DS_AppData.FileStatus[FileIndex].RingDataStart         = 100;
+    DS_AppData.FileStatus[FileIndex].RingTail              = 100;
+    DS_AppData.FileStatus[FileIndex].FileSize              = 190;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_FileRingPrepare(FileIndex, 20));
+
+    /* Verify results - unreadable older data is treated as overwritten */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].RingWrapOffset, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].RingTail, 100);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileRingPrepare_Test_WalkAhead(void)
+{
+    int32  FileIndex = 0;
+    size_t Sizes[]   = {30, 30, 30};
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), Sizes, sizeof(Sizes), false);
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 90);
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].MaxFileSize = 200;
+    DS_AppData.FileStatus[FileIndex].RingDataStart         = 100;
+    DS_AppData.FileStatus[FileIndex].RingTail              = 100;
+    DS_AppData.FileStatus[FileIndex].RingWrapOffset        = 190;
+    DS_AppData.FileStatus[FileIndex].RingWrapCount         = 1;
+    DS_AppData.FileStatus[FileIndex].FileSize              = 100;
+
+    /* Execute the function being tested - twice, as if a packet was written in between */
+    UtAssert_BOOL_TRUE(DS_FileRingPrepare(FileIndex, 20));
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].RingTail, 130);
+
+    DS_AppData.FileStatus[FileIndex].FileSize = 120;
+    UtAssert_BOOL_TRUE(DS_FileRingPrepare(FileIndex, 20));
+
+    /* Verify results - one read found all three boundaries */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].RingTail, 160);
+    UtAssert_UINT32_EQ(DS_AppData.RingWalk[FileIndex].Count, 3);
+    UtAssert_UINT32_EQ(DS_AppData.RingWalk[FileIndex].Next, 2);
+    UtAssert_STUB_COUNT(OS_read, 1);
+    UtAssert_STUB_COUNT(OS_lseek, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileRingPrepare_Test_TooLarge(void)
+{
+    int32 FileIndex = 0;
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].MaxFileSize = 200;
+    DS_AppData.FileStatus[FileIndex].RingDataStart         = 100;
+    DS_AppData.FileStatus[FileIndex].RingTail              = 100;
+    DS_AppData.FileStatus[FileIndex].FileSize              = 100;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_FileRingPrepare(FileIndex, 101));
+
+    /* Verify results - the packet can never fit, nothing is moved */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, 100);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].RingWrapCount, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileWriteErrCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.DestStats[FileIndex].ErrorCount, 1);
+    UtAssert_STUB_COUNT(OS_lseek, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileRingWalk_Test_Nominal(void)
+{
+    int32  FileIndex = 0;
+    size_t Sizes[]   = {30, 30, 30};
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), Sizes, sizeof(Sizes), false);
+
+    /* Third header starts at 60 and is not complete in the 64 bytes read */
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 64);
+
+    DS_AppData.FileStatus[FileIndex].RingTail       = 100;
+    DS_AppData.FileStatus[FileIndex].RingWrapOffset = 1000;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileRingWalk(FileIndex));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.RingWalk[FileIndex].Count, 2);
+    UtAssert_UINT32_EQ(DS_AppData.RingWalk[FileIndex].Next, 0);
+    UtAssert_UINT32_EQ(DS_AppData.RingWalk[FileIndex].Bound[0], 130);
+    UtAssert_UINT32_EQ(DS_AppData.RingWalk[FileIndex].Bound[1], 160);
+    UtAssert_STUB_COUNT(OS_read, 1);
+}
+
+void DS_FileRingWalk_Test_BadRecord(void)
+{
+    int32  FileIndex = 0;
+    size_t Sizes[]   = {30, 0};
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), Sizes, sizeof(Sizes), false);
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 90);
+
+    DS_AppData.FileStatus[FileIndex].RingTail       = 100;
+    DS_AppData.FileStatus[FileIndex].RingWrapOffset = 1000;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileRingWalk(FileIndex));
+
+    /* Verify results - walk stops at the last good boundary */
+    UtAssert_UINT32_EQ(DS_AppData.RingWalk[FileIndex].Count, 1);
+    UtAssert_UINT32_EQ(DS_AppData.RingWalk[FileIndex].Bound[0], 130);
+}
+
+void DS_FileRingPrepare_Test_SeekError(void)
+{
+    int32 FileIndex = 0;
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    /* Set to fail every seek */
+    UT_SetDefaultReturnValue(UT_KEY(OS_lseek), -1);
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].MaxFileSize = 200;
+    DS_AppData.FileStatus[FileIndex].FileState             = DS_ENABLED;
+    DS_AppData.FileStatus[FileIndex].RingDataStart         = 100;
+    DS_AppData.FileStatus[FileIndex].RingTail              = 100;
+    DS_AppData.FileStatus[FileIndex].FileSize              = 190;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_FileRingPrepare(FileIndex, 20));
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(DS_AppData.FileStatus[FileIndex].FileHandle));
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileState, DS_DISABLED);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_WRITE_FILE_ERR_EID);
+}
+
+void DS_FileWriteHeader_Test_PlatformConfigCFE_Nominal(void)
+{
+    int32 FileIndex = 0;
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].FileNameType = 1;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileWriteHeader(FileIndex));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+    UtAssert_UINT32_EQ(DS_AppData.FileWriteCounter, 2);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, sizeof(CFE_FS_Header_t) + sizeof(DS_FileHeader_t));
     UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileGrowth, sizeof(CFE_FS_Header_t) + sizeof(DS_FileHeader_t));
 }
 
@@ -438,6 +1213,7 @@ void DS_FileWriteError_Test(void)
 
     /* Verify results */
     UtAssert_UINT32_EQ(DS_AppData.FileWriteErrCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.DestStats[FileIndex].ErrorCount, 1);
     UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileState, DS_DISABLED);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
@@ -541,16 +1317,21 @@ void DS_FileCreateDest_Test_Error(void)
     DS_AppData.FileStatus[FileIndex].FileHandle = DS_UT_OBJID_1;
     DS_AppData.FileStatus[FileIndex].FileCount  = DS_MAX_SEQUENCE_COUNT + 1;
 
+    strncpy(DS_AppData.ShardStatus[FileIndex].CreatedDir, "path/0000",
+            sizeof(DS_AppData.ShardStatus[FileIndex].CreatedDir));
+
     /* Set to generate error message DS_CREATE_FILE_ERR_EID */
     UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), -1);
 
     /* Execute the function being tested */
     UtAssert_VOIDCALL(DS_FileCreateDest(FileIndex));
 
-    /* Verify results */
+    /* Verify results - the shard directory is created again for the next file */
     UtAssert_UINT32_EQ(DS_AppData.FileWriteErrCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.DestStats[FileIndex].ErrorCount, 1);
     UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileName[0], 0);
     UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileState, DS_DISABLED);
+    UtAssert_UINT32_EQ(DS_AppData.ShardStatus[FileIndex].CreatedDir[0], 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_CREATE_FILE_ERR_EID);
@@ -586,155 +1367,357 @@ void DS_FileCreateDest_Test_ClosedFileHandle(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
 }
 
-void DS_FileCreateName_Test_Nominal(void)
+void DS_FileRingInit_Test_Nominal(void)
 {
     int32 FileIndex = 0;
-    char  StrFormat[OS_MAX_PATH_LEN];
-    char  StrCompare[OS_MAX_PATH_LEN];
-
-    snprintf(StrFormat, sizeof(StrFormat), "path/base%%0%uu.ext", DS_SEQUENCE_DIGITS);
-    snprintf(StrCompare, sizeof(StrCompare), StrFormat, 1);
-
-    DS_AppData.DestFileTblPtr->File[FileIndex].FileNameType = DS_BY_COUNT;
-    UT_DS_SetDestFileEntry(&DS_AppData.DestFileTblPtr->File[FileIndex]);
 
-    DS_AppData.FileStatus[FileIndex].FileCount = 1;
+    DS_AppData.DestFileTblPtr->File[FileIndex].MaxFileSize = 1000;
+    DS_AppData.FileStatus[FileIndex].FileSize              = 50;
 
     /* Execute the function being tested */
-    UtAssert_VOIDCALL(DS_FileCreateName(FileIndex));
+    UtAssert_VOIDCALL(DS_FileRingInit(FileIndex));
 
     /* Verify results */
-    UtAssert_STRINGBUF_EQ(DS_AppData.FileStatus[FileIndex].FileName, sizeof(DS_AppData.FileStatus[FileIndex].FileName),
-                          StrCompare, sizeof(StrCompare));
-
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].RingDataStart, 50 + sizeof(DS_FileRingHeader_t));
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].RingTail, 50 + sizeof(DS_FileRingHeader_t));
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, 50 + sizeof(DS_FileRingHeader_t));
+    UtAssert_UINT32_EQ(DS_AppData.FileWriteCounter, 1);
+    UtAssert_STUB_COUNT(OS_write, 2);
+    UtAssert_STUB_COUNT(OS_lseek, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void DS_FileCreateName_Test_NominalWithSeparator(void)
+void DS_FileRingInit_Test_Fill(void)
 {
     int32 FileIndex = 0;
-    char  StrFormat[OS_MAX_PATH_LEN];
-    char  StrCompare[OS_MAX_PATH_LEN];
-
-    snprintf(StrFormat, sizeof(StrFormat), "path/base%%0%uu.ext", DS_SEQUENCE_DIGITS);
-    snprintf(StrCompare, sizeof(StrCompare), StrFormat, 1);
-
-    DS_AppData.DestFileTblPtr->File[FileIndex].FileNameType = DS_BY_COUNT;
-    UT_DS_SetDestFileEntry(&DS_AppData.DestFileTblPtr->File[FileIndex]);
-    strncpy(DS_AppData.DestFileTblPtr->File[FileIndex].Pathname, "path/",
-            sizeof(DS_AppData.DestFileTblPtr->File[FileIndex].Pathname));
 
-    DS_AppData.FileStatus[FileIndex].FileCount = 1;
+    DS_AppData.DestFileTblPtr->File[FileIndex].MaxFileSize = 3 * DS_RING_BUFFER_SIZE;
+    DS_AppData.FileStatus[FileIndex].FileSize              = 50;
 
     /* Execute the function being tested */
-    UtAssert_VOIDCALL(DS_FileCreateName(FileIndex));
-
-    /* Verify results */
-    UtAssert_STRINGBUF_EQ(DS_AppData.FileStatus[FileIndex].FileName, sizeof(DS_AppData.FileStatus[FileIndex].FileName),
-                          StrCompare, sizeof(StrCompare));
+    UtAssert_VOIDCALL(DS_FileRingInit(FileIndex));
 
+    /* Verify results - ring header plus three fill writes (no sparse file) */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, 50 + sizeof(DS_FileRingHeader_t));
+    UtAssert_STUB_COUNT(OS_write, 4);
+    UtAssert_STUB_COUNT(OS_lseek, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void DS_FileCreateName_Test_NominalWithPeriod(void)
+void DS_FileRingInit_Test_WriteError(void)
 {
     int32 FileIndex = 0;
-    char  StrFormat[OS_MAX_PATH_LEN];
-    char  StrCompare[OS_MAX_PATH_LEN];
 
-    snprintf(StrFormat, sizeof(StrFormat), "path/base%%0%uu.ext", DS_SEQUENCE_DIGITS);
-    snprintf(StrCompare, sizeof(StrCompare), StrFormat, 1);
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
 
-    DS_AppData.DestFileTblPtr->File[FileIndex].FileNameType = DS_BY_COUNT;
-    UT_DS_SetDestFileEntry(&DS_AppData.DestFileTblPtr->File[FileIndex]);
-    strncpy(DS_AppData.DestFileTblPtr->File[FileIndex].Extension, ".ext",
-            sizeof(DS_AppData.DestFileTblPtr->File[FileIndex].Extension));
+    /* Set to fail the ring header write */
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), -1);
 
-    DS_AppData.FileStatus[FileIndex].FileCount = 1;
+    DS_AppData.DestFileTblPtr->File[FileIndex].MaxFileSize = 1000;
 
     /* Execute the function being tested */
-    UtAssert_VOIDCALL(DS_FileCreateName(FileIndex));
+    UtAssert_VOIDCALL(DS_FileRingInit(FileIndex));
 
     /* Verify results */
-    UtAssert_STRINGBUF_EQ(DS_AppData.FileStatus[FileIndex].FileName, sizeof(DS_AppData.FileStatus[FileIndex].FileName),
-                          StrCompare, sizeof(StrCompare));
-
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(DS_AppData.FileStatus[FileIndex].FileHandle));
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_WRITE_FILE_ERR_EID);
 }
 
-void DS_FileCreateName_Test_EmptyPath(void)
+void DS_FileRingInit_Test_PreallocateError(void)
 {
     int32 FileIndex = 0;
 
-    DS_AppData.DestFileTblPtr->File[FileIndex].FileNameType = DS_BY_COUNT;
-    UT_DS_SetDestFileEntry(&DS_AppData.DestFileTblPtr->File[FileIndex]);
-    DS_AppData.DestFileTblPtr->File[FileIndex].Pathname[0] = '\0';
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
 
-    DS_AppData.FileStatus[FileIndex].FileCount = 1;
+    /* Set to fail the first fill write */
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 2, -1);
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].MaxFileSize = 1000;
 
     /* Execute the function being tested */
-    UtAssert_VOIDCALL(DS_FileCreateName(FileIndex));
+    UtAssert_VOIDCALL(DS_FileRingInit(FileIndex));
 
     /* Verify results */
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileState, DS_DISABLED);
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(DS_AppData.FileStatus[FileIndex].FileHandle));
+    UtAssert_STUB_COUNT(OS_write, 2);
+    UtAssert_STUB_COUNT(OS_lseek, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FILE_CREATE_EMPTY_PATH_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_WRITE_FILE_ERR_EID);
 }
 
-void DS_FileCreateName_Test_Error(void)
+void DS_FileCreateDest_Test_RingMode(void)
 {
-    int32 FileIndex = 0;
-    int32 i;
+    uint32 FileIndex = 0;
 
-    DS_AppData.DestFileTblPtr->File[FileIndex].FileNameType = DS_BY_COUNT;
     UT_DS_SetDestFileEntry(&DS_AppData.DestFileTblPtr->File[FileIndex]);
 
-    for (i = 0; i < DS_TOTAL_FNAME_BUFSIZE - 2; i++)
-    {
-        DS_AppData.DestFileTblPtr->File[FileIndex].Basename[i] = 'a';
-    }
-
-    DS_AppData.DestFileTblPtr->File[FileIndex].Basename[DS_TOTAL_FNAME_BUFSIZE - 1] = '\0';
+    DS_AppData.DestFileTblPtr->File[FileIndex].FileNameType = DS_BY_COUNT;
+    DS_AppData.DestFileTblPtr->File[FileIndex].FileMode     = DS_FILE_MODE_RING;
+    DS_AppData.DestFileTblPtr->File[FileIndex].MaxFileSize  = 1000;
 
     /* Execute the function being tested */
-    UtAssert_VOIDCALL(DS_FileCreateName(FileIndex));
+    UtAssert_VOIDCALL(DS_FileCreateDest(FileIndex));
 
     /* Verify results */
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileState, DS_DISABLED);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FILE_NAME_ERR_EID);
+    UtAssert_BOOL_TRUE(OS_ObjectIdDefined(DS_AppData.FileStatus[FileIndex].FileHandle));
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileMode, DS_FILE_MODE_RING);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].RingDataStart, DS_AppData.FileStatus[FileIndex].FileSize);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void DS_FileCreateName_Test_PathBaseSeqTooLarge(void)
+void DS_FileCreateDest_Test_Index(void)
 {
-    int32 FileIndex   = 0;
-    int32 PathnameLen = (DS_TOTAL_FNAME_BUFSIZE - DS_SEQUENCE_DIGITS - 1) / 2;
-    int32 BasenameLen = DS_TOTAL_FNAME_BUFSIZE - DS_SEQUENCE_DIGITS - 1 - PathnameLen;
+    uint32 FileIndex = 0;
 
-    DS_AppData.DestFileTblPtr->File[FileIndex].FileNameType = DS_BY_COUNT;
-    DS_AppData.FileStatus[FileIndex].FileCount              = 1;
+    UT_DS_SetDestFileEntry(&DS_AppData.DestFileTblPtr->File[FileIndex]);
 
-    /* Set to fail the condition "if ((strlen(Workname) + strlen(Sequence)) < DS_TOTAL_FNAME_BUFSIZE)" */
-    memset(DS_AppData.DestFileTblPtr->File[FileIndex].Pathname, 'p', PathnameLen);
-    memset(DS_AppData.DestFileTblPtr->File[FileIndex].Basename, 'b', BasenameLen);
+    DS_AppData.DestFileTblPtr->File[FileIndex].FileNameType = DS_BY_COUNT;
+    DS_AppData.DestFileTblPtr->File[FileIndex].IndexPackets = 10;
 
     /* Execute the function being tested */
-    UtAssert_VOIDCALL(DS_FileCreateName(FileIndex));
+    UtAssert_VOIDCALL(DS_FileCreateDest(FileIndex));
 
     /* Verify results */
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FILE_NAME_ERR_EID);
+    UtAssert_BOOL_TRUE(OS_ObjectIdDefined(DS_AppData.FileStatus[FileIndex].FileHandle));
+    UtAssert_BOOL_TRUE(OS_ObjectIdDefined(DS_AppData.IndexStatus[FileIndex].IndexHandle));
+    UtAssert_NOT_NULL(strstr(DS_AppData.IndexStatus[FileIndex].FileName, DS_INDEX_FILE_EXTENSION));
+    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void DS_FileCreateName_Test_PathBaseSeqExtTooLarge(void)
+void DS_FileCreateDest_Test_Trailer(void)
 {
-    int32               FileIndex = 0;
+    uint32 FileIndex = 0;
+
+    UT_DS_SetDestFileEntry(&DS_AppData.DestFileTblPtr->File[FileIndex]);
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].FileNameType = DS_BY_COUNT;
+    DS_AppData.DestFileTblPtr->File[FileIndex].TrailerState = DS_ENABLED;
+
+    DS_AppData.TrailerStatus[FileIndex].EntryCount = 5;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileCreateDest(FileIndex));
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(DS_AppData.TrailerStatus[FileIndex].Active);
+    UtAssert_UINT32_EQ(DS_AppData.TrailerStatus[FileIndex].EntryCount, 0);
+}
+
+void DS_FileCreateDest_Test_IndexRingMode(void)
+{
+    uint32 FileIndex = 0;
+
+    UT_DS_SetDestFileEntry(&DS_AppData.DestFileTblPtr->File[FileIndex]);
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].FileNameType = DS_BY_COUNT;
+    DS_AppData.DestFileTblPtr->File[FileIndex].FileMode     = DS_FILE_MODE_RING;
+    DS_AppData.DestFileTblPtr->File[FileIndex].MaxFileSize  = 1000;
+    DS_AppData.DestFileTblPtr->File[FileIndex].IndexPackets = 10;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileCreateDest(FileIndex));
+
+    /* Verify results - ring files are not indexed */
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(DS_AppData.IndexStatus[FileIndex].IndexHandle));
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+}
+
+void DS_FileCreateDest_Test_Compressed(void)
+{
+    uint32 FileIndex = 0;
+
+    UT_DS_SetDestFileEntry(&DS_AppData.DestFileTblPtr->File[FileIndex]);
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].FileNameType = DS_BY_COUNT;
+    DS_AppData.DestFileTblPtr->File[FileIndex].CompressMode = DS_COMPRESS_LZ;
+
+    DS_AppData.CompressStatus[FileIndex].BlockCount = 5;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileCreateDest(FileIndex));
+
+    /* Verify results - headers are not compressed */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].CompressMode, DS_COMPRESS_LZ);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].LogicalSize, DS_AppData.FileStatus[FileIndex].FileSize);
+    UtAssert_UINT32_EQ(DS_AppData.CompressStatus[FileIndex].BlockCount, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileCreateDest_Test_Delta(void)
+{
+    uint32 FileIndex = 0;
+
+    UT_DS_SetDestFileEntry(&DS_AppData.DestFileTblPtr->File[FileIndex]);
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].FileNameType = DS_BY_COUNT;
+    DS_AppData.DestFileTblPtr->File[FileIndex].RecordMode   = DS_RECORD_DELTA;
+
+    DS_AppData.RecordStatus[FileIndex].Ref[0].PacketSize = 10;
+    DS_AppData.RecordStatus[FileIndex].NextRef           = 1;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileCreateDest(FileIndex));
+
+    /* Verify results - streams from the last file are forgotten */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].RecordMode, DS_RECORD_DELTA);
+    UtAssert_UINT32_EQ(DS_AppData.RecordStatus[FileIndex].Ref[0].PacketSize, 0);
+    UtAssert_UINT32_EQ(DS_AppData.RecordStatus[FileIndex].NextRef, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileCreateName_Test_Nominal(void)
+{
+    int32 FileIndex = 0;
+    char  StrFormat[OS_MAX_PATH_LEN];
+    char  StrCompare[OS_MAX_PATH_LEN];
+
+    snprintf(StrFormat, sizeof(StrFormat), "path/base%%0%uu.ext", DS_SEQUENCE_DIGITS);
+    snprintf(StrCompare, sizeof(StrCompare), StrFormat, 1);
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].FileNameType = DS_BY_COUNT;
+    UT_DS_SetDestFileEntry(&DS_AppData.DestFileTblPtr->File[FileIndex]);
+
+    DS_AppData.FileStatus[FileIndex].FileCount = 1;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileCreateName(FileIndex));
+
+    /* Verify results */
+    UtAssert_STRINGBUF_EQ(DS_AppData.FileStatus[FileIndex].FileName, sizeof(DS_AppData.FileStatus[FileIndex].FileName),
+                          StrCompare, sizeof(StrCompare));
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileCreateName_Test_NominalWithSeparator(void)
+{
+    int32 FileIndex = 0;
+    char  StrFormat[OS_MAX_PATH_LEN];
+    char  StrCompare[OS_MAX_PATH_LEN];
+
+    snprintf(StrFormat, sizeof(StrFormat), "path/base%%0%uu.ext", DS_SEQUENCE_DIGITS);
+    snprintf(StrCompare, sizeof(StrCompare), StrFormat, 1);
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].FileNameType = DS_BY_COUNT;
+    UT_DS_SetDestFileEntry(&DS_AppData.DestFileTblPtr->File[FileIndex]);
+    strncpy(DS_AppData.DestFileTblPtr->File[FileIndex].Pathname, "path/",
+            sizeof(DS_AppData.DestFileTblPtr->File[FileIndex].Pathname));
+
+    DS_AppData.FileStatus[FileIndex].FileCount = 1;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileCreateName(FileIndex));
+
+    /* Verify results */
+    UtAssert_STRINGBUF_EQ(DS_AppData.FileStatus[FileIndex].FileName, sizeof(DS_AppData.FileStatus[FileIndex].FileName),
+                          StrCompare, sizeof(StrCompare));
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileCreateName_Test_NominalWithPeriod(void)
+{
+    int32 FileIndex = 0;
+    char  StrFormat[OS_MAX_PATH_LEN];
+    char  StrCompare[OS_MAX_PATH_LEN];
+
+    snprintf(StrFormat, sizeof(StrFormat), "path/base%%0%uu.ext", DS_SEQUENCE_DIGITS);
+    snprintf(StrCompare, sizeof(StrCompare), StrFormat, 1);
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].FileNameType = DS_BY_COUNT;
+    UT_DS_SetDestFileEntry(&DS_AppData.DestFileTblPtr->File[FileIndex]);
+    strncpy(DS_AppData.DestFileTblPtr->File[FileIndex].Extension, ".ext",
+            sizeof(DS_AppData.DestFileTblPtr->File[FileIndex].Extension));
+
+    DS_AppData.FileStatus[FileIndex].FileCount = 1;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileCreateName(FileIndex));
+
+    /* Verify results */
+    UtAssert_STRINGBUF_EQ(DS_AppData.FileStatus[FileIndex].FileName, sizeof(DS_AppData.FileStatus[FileIndex].FileName),
+                          StrCompare, sizeof(StrCompare));
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileCreateName_Test_EmptyPath(void)
+{
+    int32 FileIndex = 0;
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].FileNameType = DS_BY_COUNT;
+    UT_DS_SetDestFileEntry(&DS_AppData.DestFileTblPtr->File[FileIndex]);
+    DS_AppData.DestFileTblPtr->File[FileIndex].Pathname[0] = '\0';
+
+    DS_AppData.FileStatus[FileIndex].FileCount = 1;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileCreateName(FileIndex));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileState, DS_DISABLED);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FILE_CREATE_EMPTY_PATH_ERR_EID);
+}
+
+void DS_FileCreateName_Test_Error(void)
+{
+    int32 FileIndex = 0;
+    int32 i;
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].FileNameType = DS_BY_COUNT;
+    UT_DS_SetDestFileEntry(&DS_AppData.DestFileTblPtr->File[FileIndex]);
+
+    for (i = 0; i < DS_TOTAL_FNAME_BUFSIZE - 2; i++)
+    {
+        DS_AppData.DestFileTblPtr->File[FileIndex].Basename[i] = 'a';
+    }
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].Basename[DS_TOTAL_FNAME_BUFSIZE - 1] = '\0';
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileCreateName(FileIndex));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileState, DS_DISABLED);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FILE_NAME_ERR_EID);
+}
+
+void DS_FileCreateName_Test_PathBaseSeqTooLarge(void)
+{
+    int32 FileIndex   = 0;
+    int32 PathnameLen = (DS_TOTAL_FNAME_BUFSIZE - DS_SEQUENCE_DIGITS - 1) / 2;
+    int32 BasenameLen = DS_TOTAL_FNAME_BUFSIZE - DS_SEQUENCE_DIGITS - 1 - PathnameLen;
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].FileNameType = DS_BY_COUNT;
+    DS_AppData.FileStatus[FileIndex].FileCount              = 1;
+
+    /* Set to fail the condition "if ((strlen(Workname) + strlen(Sequence)) < DS_TOTAL_FNAME_BUFSIZE)" */
+    memset(DS_AppData.DestFileTblPtr->File[FileIndex].Pathname, 'p', PathnameLen);
+    memset(DS_AppData.DestFileTblPtr->File[FileIndex].Basename, 'b', BasenameLen);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileCreateName(FileIndex));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FILE_NAME_ERR_EID);
+}
+
+void DS_FileCreateName_Test_PathBaseSeqExtTooLarge(void)
+{
+    int32               FileIndex = 0;
     DS_DestFileEntry_t *DestPtr;
 
-    DestPtr               = &DS_AppData.DestFileTblPtr->File[FileIndex];
+    DestPtr = &DS_AppData.DestFileTblPtr->File[FileIndex];
 
     memset(DestPtr, 0, sizeof (*DestPtr));
     DestPtr->FileNameType = DS_BY_COUNT;
@@ -781,6 +1764,85 @@ void DS_FileCreateName_Test_ExtensionZero(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
+void DS_FileCreateName_Test_Shard(void)
+{
+    int32 FileIndex = 0;
+    char  StrFormat[OS_MAX_PATH_LEN];
+    char  StrCompare[OS_MAX_PATH_LEN];
+
+    snprintf(StrFormat, sizeof(StrFormat), "path/%%0%uu/base%%0%uu.ext", DS_SEQUENCE_DIGITS, DS_SEQUENCE_DIGITS);
+    snprintf(StrCompare, sizeof(StrCompare), StrFormat, 1200, 1234);
+
+    UT_DS_SetDestFileEntry(&DS_AppData.DestFileTblPtr->File[FileIndex]);
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].FileNameType = DS_BY_COUNT;
+    DS_AppData.DestFileTblPtr->File[FileIndex].ShardMode    = DS_SHARD_BY_COUNT;
+    DS_AppData.DestFileTblPtr->File[FileIndex].ShardFiles   = 100;
+    DS_AppData.FileStatus[FileIndex].FileCount              = 1234;
+
+    /* Execute the function being tested - twice, the second file is in the same shard */
+    UtAssert_VOIDCALL(DS_FileCreateName(FileIndex));
+    UtAssert_VOIDCALL(DS_FileCreateName(FileIndex));
+
+    /* Verify results - the shard directory was created only once */
+    UtAssert_STRINGBUF_EQ(DS_AppData.FileStatus[FileIndex].FileName, sizeof(DS_AppData.FileStatus[FileIndex].FileName),
+                          StrCompare, sizeof(StrCompare));
+    UtAssert_STUB_COUNT(OS_mkdir, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileCreateName_Test_ShardByTime(void)
+{
+    int32              FileIndex = 0;
+    CFE_TIME_SysTime_t FakeTime;
+
+    memset(&FakeTime, 0, sizeof(FakeTime));
+
+    UT_SetDataBuffer(UT_KEY(CFE_TIME_GetTime), &FakeTime, sizeof(FakeTime), false);
+    UT_SetHandlerFunction(UT_KEY(CFE_TIME_Print), &UT_CFE_TIME_Print_CustomHandler, NULL);
+
+    UT_DS_SetDestFileEntry(&DS_AppData.DestFileTblPtr->File[FileIndex]);
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].FileNameType = DS_BY_TIME;
+    DS_AppData.DestFileTblPtr->File[FileIndex].ShardMode    = DS_SHARD_BY_TIME;
+    DS_AppData.DestFileTblPtr->File[FileIndex].Extension[0] = '\0';
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileCreateName(FileIndex));
+
+    /* Verify results - shard and filename come from one time read */
+    UtAssert_STRINGBUF_EQ(DS_AppData.FileStatus[FileIndex].FileName, sizeof(DS_AppData.FileStatus[FileIndex].FileName),
+                          "path/1980/001/00/base1980001000000", -1);
+    UtAssert_STUB_COUNT(CFE_TIME_GetTime, 1);
+    UtAssert_STUB_COUNT(OS_mkdir, 3);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileCreateName_Test_ShardError(void)
+{
+    int32 FileIndex = 0;
+
+    UT_DS_SetDestFileEntry(&DS_AppData.DestFileTblPtr->File[FileIndex]);
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].FileNameType = DS_BY_COUNT;
+    DS_AppData.DestFileTblPtr->File[FileIndex].ShardMode    = DS_SHARD_BY_COUNT;
+    DS_AppData.DestFileTblPtr->File[FileIndex].ShardFiles   = 100;
+    DS_AppData.FileStatus[FileIndex].FileCount              = 1234;
+    DS_AppData.FileStatus[FileIndex].FileState              = DS_ENABLED;
+
+    /* Set to fail the condition "if (ShardResult != OS_SUCCESS)" */
+    UT_SetDefaultReturnValue(UT_KEY(OS_mkdir), OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileCreateName(FileIndex));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileState, DS_DISABLED);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileName[0], '\0');
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_SHARD_DIR_ERR_EID);
+}
+
 void DS_FileCreateSequence_Test_ByCount(void)
 {
     const uint32 Count = 1;
@@ -848,7 +1910,170 @@ void DS_FileCreateSequence_Test_BadFilenameType(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void DS_FileUpdateHeader_Test_PlatformConfigCFE_Nominal(void)
+void DS_FileShardName_Test_ByTime(void)
+{
+    int32              FileIndex = 0;
+    CFE_TIME_SysTime_t FakeTime;
+    char               ShardName[DS_TOTAL_FNAME_BUFSIZE];
+
+    memset(&FakeTime, 0, sizeof(FakeTime));
+
+    UT_SetDataBuffer(UT_KEY(CFE_TIME_GetTime), &FakeTime, sizeof(FakeTime), false);
+    UT_SetHandlerFunction(UT_KEY(CFE_TIME_Print), &UT_CFE_TIME_Print_CustomHandler, NULL);
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].ShardMode = DS_SHARD_BY_TIME;
+
+    /* Execute the function being tested - filename is not named by time */
+    UtAssert_VOIDCALL(DS_FileShardName(FileIndex, NULL, ShardName));
+
+    /* Verify results */
+    UtAssert_STRINGBUF_EQ(ShardName, sizeof(ShardName), "1980/001/00", -1);
+    UtAssert_STUB_COUNT(CFE_TIME_GetTime, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileShardName_Test_ByFileTime(void)
+{
+    int32 FileIndex = 0;
+    char  ShardName[DS_TOTAL_FNAME_BUFSIZE];
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].ShardMode = DS_SHARD_BY_TIME;
+
+    /* Execute the function being tested - last second of an hour */
+    UtAssert_VOIDCALL(DS_FileShardName(FileIndex, "2024001235959", ShardName));
+
+    /* Verify results - same hour as the filename, time is not read again */
+    UtAssert_STRINGBUF_EQ(ShardName, sizeof(ShardName), "2024/001/23", -1);
+    UtAssert_STUB_COUNT(CFE_TIME_GetTime, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileShardName_Test_ByCount(void)
+{
+    int32 FileIndex = 0;
+    char  StrFormat[DS_TOTAL_FNAME_BUFSIZE];
+    char  StrCompare[DS_TOTAL_FNAME_BUFSIZE];
+    char  ShardName[DS_TOTAL_FNAME_BUFSIZE];
+
+    snprintf(StrFormat, sizeof(StrFormat), "%%0%uu", DS_SEQUENCE_DIGITS);
+    snprintf(StrCompare, sizeof(StrCompare), StrFormat, 1200);
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].ShardMode  = DS_SHARD_BY_COUNT;
+    DS_AppData.DestFileTblPtr->File[FileIndex].ShardFiles = 100;
+    DS_AppData.FileStatus[FileIndex].FileCount            = 1234;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileShardName(FileIndex, NULL, ShardName));
+
+    /* Verify results - the shard is named after the first count in the block */
+    UtAssert_STRINGBUF_EQ(ShardName, sizeof(ShardName), StrCompare, sizeof(StrCompare));
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileShardName_Test_None(void)
+{
+    int32 FileIndex = 0;
+    char  ShardName[DS_TOTAL_FNAME_BUFSIZE];
+
+    memset(ShardName, 'x', sizeof(ShardName));
+
+    /* Set to fail the condition "(DestFile->ShardFiles != 0)" */
+    DS_AppData.DestFileTblPtr->File[FileIndex].ShardMode  = DS_SHARD_BY_COUNT;
+    DS_AppData.DestFileTblPtr->File[FileIndex].ShardFiles = 0;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileShardName(FileIndex, NULL, ShardName));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(ShardName[0], '\0');
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileShardCreate_Test_Nominal(void)
+{
+    char KnownDir[DS_TOTAL_FNAME_BUFSIZE] = "path/2023/365/23";
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FileShardCreate("path/2024/001/00", 4, KnownDir), OS_SUCCESS);
+
+    /* Verify results - one directory per level below the base */
+    UtAssert_STRINGBUF_EQ(KnownDir, sizeof(KnownDir), "path/2024/001/00", -1);
+    UtAssert_STUB_COUNT(OS_mkdir, 3);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileShardCreate_Test_Known(void)
+{
+    char KnownDir[DS_TOTAL_FNAME_BUFSIZE] = "path/2024/001/00";
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FileShardCreate("path/2024/001/00", 4, KnownDir), OS_SUCCESS);
+
+    /* Verify results - no file system access for a known shard */
+    UtAssert_STRINGBUF_EQ(KnownDir, sizeof(KnownDir), "path/2024/001/00", -1);
+    UtAssert_STUB_COUNT(OS_mkdir, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileShardCreate_Test_Error(void)
+{
+    char KnownDir[DS_TOTAL_FNAME_BUFSIZE] = "path/2023/365/23";
+
+    /* Set to generate error message DS_SHARD_DIR_ERR_EID */
+    UT_SetDeferredRetcode(UT_KEY(OS_mkdir), 2, OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FileShardCreate("path/2024/001/00", 4, KnownDir), OS_ERROR);
+
+    /* Verify results - creation stops at the failed level (not a directory) and is retried next time */
+    UtAssert_UINT32_EQ(KnownDir[0], '\0');
+    UtAssert_STUB_COUNT(OS_mkdir, 2);
+    UtAssert_STUB_COUNT(OS_stat, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_SHARD_DIR_ERR_EID);
+}
+
+void DS_FileShardCreate_Test_Exists(void)
+{
+    char       KnownDir[DS_TOTAL_FNAME_BUFSIZE] = "";
+    os_fstat_t FileStats;
+
+    memset(&FileStats, 0, sizeof(FileStats));
+    FileStats.FileModeBits = OS_FILESTAT_MODE_DIR;
+
+    /* OSAL backend reports an error for a level that already exists */
+    UT_SetDeferredRetcode(UT_KEY(OS_mkdir), 2, OS_ERROR);
+    UT_SetDataBuffer(UT_KEY(OS_stat), &FileStats, sizeof(FileStats), false);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FileShardCreate("path/2024/001/00", 4, KnownDir), OS_SUCCESS);
+
+    /* Verify results */
+    UtAssert_STRINGBUF_EQ(KnownDir, sizeof(KnownDir), "path/2024/001/00", -1);
+    UtAssert_STUB_COUNT(OS_mkdir, 3);
+    UtAssert_STUB_COUNT(OS_stat, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileShardCreate_Test_TooLong(void)
+{
+    char DirName[DS_TOTAL_FNAME_BUFSIZE + 1];
+    char KnownDir[DS_TOTAL_FNAME_BUFSIZE] = "";
+
+    memset(DirName, 'd', sizeof(DirName) - 1);
+    DirName[sizeof(DirName) - 1] = '\0';
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FileShardCreate(DirName, 4, KnownDir), OS_FS_ERR_PATH_TOO_LONG);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_mkdir, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_SHARD_DIR_ERR_EID);
+}
+
+void DS_FileUpdateHeader_Test_PlatformConfigCFE_Nominal(void)
 {
     int32 FileIndex = 0;
 
@@ -890,380 +2115,3474 @@ void DS_FileUpdateHeader_Test_PlatformConfigCFE_SeekError(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void DS_FileCloseDest_Test_PlatformConfigMoveFiles_Nominal(void)
+void DS_FileRingUpdateHeader_Test_Nominal(void)
 {
     int32 FileIndex = 0;
 
-    /* Set up the handle */
-    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+    DS_AppData.FileStatus[FileIndex].RingDataStart = 100;
+    DS_AppData.FileStatus[FileIndex].FileSize      = 150;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileRingUpdateHeader(FileIndex));
+
+    /* Verify results - header written and position restored to the head */
+    UtAssert_UINT32_EQ(DS_AppData.FileUpdateCounter, 1);
+    UtAssert_STUB_COUNT(OS_lseek, 2);
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileRingUpdateHeader_Test_SeekError(void)
+{
+    int32 FileIndex = 0;
+
+    /* Set to fail the seek to the ring header */
+    UT_SetDefaultReturnValue(UT_KEY(OS_lseek), -1);
+
+    DS_AppData.FileStatus[FileIndex].RingDataStart = 100;
+    DS_AppData.FileStatus[FileIndex].FileSize      = 150;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileRingUpdateHeader(FileIndex));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FileUpdateErrCounter, 1);
+    UtAssert_STUB_COUNT(OS_write, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileIndexCreate_Test_Name(void)
+{
+    int32 FileIndex = 0;
 
     strncpy(DS_AppData.FileStatus[FileIndex].FileName, "directory1/filename",
             sizeof(DS_AppData.FileStatus[FileIndex].FileName));
-    strncpy(DS_AppData.DestFileTblPtr->File[FileIndex].Movename, "directory2/movename/",
-            sizeof(DS_AppData.DestFileTblPtr->File[FileIndex].Movename));
-    DS_AppData.EnableMoveFiles = DS_ENABLED;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), sizeof(DS_FileIndexHeader_t));
 
     /* Execute the function being tested */
-    UtAssert_VOIDCALL(DS_FileCloseDest(FileIndex));
+    UtAssert_VOIDCALL(DS_FileIndexCreate(FileIndex));
 
     /* Verify results */
-    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(DS_AppData.FileStatus[FileIndex].FileHandle));
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileAge, 0);
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, 0);
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileName[0], 0);
+    UtAssert_STRINGBUF_EQ(DS_AppData.IndexStatus[FileIndex].FileName,
+                          sizeof(DS_AppData.IndexStatus[FileIndex].FileName),
+                          "directory1/filename" DS_INDEX_FILE_EXTENSION, -1);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void DS_FileCloseDest_Test_PlatformConfigMoveFiles_MoveError(void)
+void DS_FileIndexCreate_Test_NameTooLong(void)
 {
     int32 FileIndex = 0;
 
-    /* Set up the handle */
-    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+    memset(DS_AppData.FileStatus[FileIndex].FileName, 'a', sizeof(DS_AppData.FileStatus[FileIndex].FileName) - 1);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileIndexCreate(FileIndex));
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(DS_AppData.IndexStatus[FileIndex].IndexHandle));
+    UtAssert_UINT32_EQ(DS_AppData.IndexStatus[FileIndex].FileName[0], 0);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_INDEX_FILE_ERR_EID);
+}
+
+void DS_FileIndexCreate_Test_CreateError(void)
+{
+    int32 FileIndex = 0;
 
     strncpy(DS_AppData.FileStatus[FileIndex].FileName, "directory1/filename",
             sizeof(DS_AppData.FileStatus[FileIndex].FileName));
-    strncpy(DS_AppData.DestFileTblPtr->File[FileIndex].Movename, "directory2/movename/",
-            sizeof(DS_AppData.DestFileTblPtr->File[FileIndex].Movename));
-    DS_AppData.EnableMoveFiles = DS_ENABLED;
 
-    /* Set to generate error message DS_MOVE_FILE_ERR_EID */
-    UT_SetDefaultReturnValue(UT_KEY(OS_mv), -1);
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_ERROR);
 
     /* Execute the function being tested */
-    UtAssert_VOIDCALL(DS_FileCloseDest(FileIndex));
+    UtAssert_VOIDCALL(DS_FileIndexCreate(FileIndex));
 
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileAge, 0);
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, 0);
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileName[0], 0);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_MOVE_FILE_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    /* Verify results */
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(DS_AppData.IndexStatus[FileIndex].IndexHandle));
+    UtAssert_UINT32_EQ(DS_AppData.IndexStatus[FileIndex].FileName[0], 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_INDEX_FILE_ERR_EID);
 }
 
-void DS_FileCloseDest_Test_PlatformConfigMoveFiles_FilenameTooLarge(void)
+void DS_FileIndexCreate_Test_WriteError(void)
 {
-    int32      FileIndex = 0;
-    const char DirName[] = "directory1/";
+    int32 FileIndex = 0;
 
-    /* Set up the handle */
-    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+    strncpy(DS_AppData.FileStatus[FileIndex].FileName, "directory1/filename",
+            sizeof(DS_AppData.FileStatus[FileIndex].FileName));
 
-    size_t DirNameLen = sizeof(DirName);
-    strncpy(DS_AppData.FileStatus[FileIndex].FileName, DirName, DirNameLen);
-    memset(&DS_AppData.FileStatus[FileIndex].FileName[DirNameLen - 1], 'f', DS_TOTAL_FNAME_BUFSIZE - DirNameLen);
-    DS_AppData.FileStatus[FileIndex].FileName[DS_TOTAL_FNAME_BUFSIZE - 1] = '\0';
-    strncpy(DS_AppData.DestFileTblPtr->File[FileIndex].Movename, "directory2/movename/",
-            sizeof(DS_AppData.DestFileTblPtr->File[FileIndex].Movename));
-    DS_AppData.EnableMoveFiles = DS_ENABLED;
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), -1);
 
     /* Execute the function being tested */
-    UtAssert_VOIDCALL(DS_FileCloseDest(FileIndex));
+    UtAssert_VOIDCALL(DS_FileIndexCreate(FileIndex));
 
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileAge, 0);
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, 0);
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileName[0], 0);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_MOVE_FILE_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    /* Verify results */
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(DS_AppData.IndexStatus[FileIndex].IndexHandle));
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_INDEX_FILE_ERR_EID);
+}
+
+void DS_FileIndexPacket_Test_ByCount(void)
+{
+    int32 FileIndex = 0;
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].IndexPackets = 3;
+    DS_AppData.IndexStatus[FileIndex].RecordCount           = 1;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileIndexPacket(FileIndex, &UT_CmdBuf.Buf.Msg, 10));
+    UtAssert_VOIDCALL(DS_FileIndexPacket(FileIndex, &UT_CmdBuf.Buf.Msg, 20));
+    UtAssert_VOIDCALL(DS_FileIndexPacket(FileIndex, &UT_CmdBuf.Buf.Msg, 30));
+
+    /* Verify results - packet time is only read for the due record */
+    UtAssert_UINT32_EQ(DS_AppData.IndexStatus[FileIndex].RecordCount, 2);
+    UtAssert_UINT32_EQ(DS_AppData.IndexStatus[FileIndex].BufferCount, 1);
+    UtAssert_UINT32_EQ(DS_AppData.IndexStatus[FileIndex].Buffer[0].FileOffset, 30);
+    UtAssert_UINT32_EQ(DS_AppData.IndexStatus[FileIndex].PktCount, 0);
+    UtAssert_STUB_COUNT(CFE_MSG_GetMsgTime, 1);
+}
+
+void DS_FileIndexPacket_Test_ByTime(void)
+{
+    int32              FileIndex     = 0;
+    CFE_TIME_SysTime_t PacketTime[2] = {{105, 0}, {110, 0}};
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].IndexSeconds = 10;
+    DS_AppData.IndexStatus[FileIndex].RecordCount           = 1;
+    DS_AppData.IndexStatus[FileIndex].LastSeconds           = 100;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgTime), PacketTime, sizeof(PacketTime), false);
+
+    /* Execute the function being tested - not yet due */
+    UtAssert_VOIDCALL(DS_FileIndexPacket(FileIndex, &UT_CmdBuf.Buf.Msg, 10));
+    UtAssert_UINT32_EQ(DS_AppData.IndexStatus[FileIndex].RecordCount, 1);
+
+    /* Execute the function being tested - due */
+    UtAssert_VOIDCALL(DS_FileIndexPacket(FileIndex, &UT_CmdBuf.Buf.Msg, 20));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.IndexStatus[FileIndex].RecordCount, 2);
+    UtAssert_UINT32_EQ(DS_AppData.IndexStatus[FileIndex].Buffer[0].Seconds, 110);
+    UtAssert_UINT32_EQ(DS_AppData.IndexStatus[FileIndex].LastSeconds, 110);
+    UtAssert_STUB_COUNT(CFE_MSG_GetMsgTime, 2);
+}
+
+void DS_FileIndexPacket_Test_BufferFull(void)
+{
+    int32 FileIndex = 0;
+
+    /* Set up the index handle */
+    OS_OpenCreate(&DS_AppData.IndexStatus[FileIndex].IndexHandle, NULL, 0, 0);
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].IndexPackets = 1;
+    DS_AppData.IndexStatus[FileIndex].BufferCount           = DS_INDEX_BUFFER_RECORDS - 1;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileIndexPacket(FileIndex, &UT_CmdBuf.Buf.Msg, 10));
+
+    /* Verify results - buffered records written in one call */
+    UtAssert_UINT32_EQ(DS_AppData.IndexStatus[FileIndex].BufferCount, 0);
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileIndexFlush_Test_WriteError(void)
+{
+    int32 FileIndex = 0;
+
+    /* Set up the index handle */
+    OS_OpenCreate(&DS_AppData.IndexStatus[FileIndex].IndexHandle, NULL, 0, 0);
+
+    DS_AppData.IndexStatus[FileIndex].BufferCount = 2;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), -1);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileIndexFlush(FileIndex));
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(DS_AppData.IndexStatus[FileIndex].IndexHandle));
+    UtAssert_UINT32_EQ(DS_AppData.IndexStatus[FileIndex].BufferCount, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_INDEX_FILE_ERR_EID);
+}
+
+void DS_FileIndexClose_Test_Nominal(void)
+{
+    int32 FileIndex = 0;
+
+    /* Set up the index handle */
+    OS_OpenCreate(&DS_AppData.IndexStatus[FileIndex].IndexHandle, NULL, 0, 0);
+
+    DS_AppData.IndexStatus[FileIndex].BufferCount = 1;
+    DS_AppData.IndexStatus[FileIndex].RecordCount = 1;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileIndexClose(FileIndex));
+
+    /* Verify results - records flushed, header rewritten, file closed */
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(DS_AppData.IndexStatus[FileIndex].IndexHandle));
+    UtAssert_STUB_COUNT(OS_write, 2);
+    UtAssert_STUB_COUNT(OS_lseek, 1);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileIndexClose_Test_SeekError(void)
+{
+    int32 FileIndex = 0;
+
+    /* Set up the index handle */
+    OS_OpenCreate(&DS_AppData.IndexStatus[FileIndex].IndexHandle, NULL, 0, 0);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_lseek), -1);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileIndexClose(FileIndex));
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(DS_AppData.IndexStatus[FileIndex].IndexHandle));
+    UtAssert_STUB_COUNT(OS_write, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_INDEX_FILE_ERR_EID);
+}
+
+void DS_FileIndexClose_Test_NoIndex(void)
+{
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileIndexClose(0));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_write, 0);
+    UtAssert_STUB_COUNT(OS_close, 0);
+}
+
+void DS_FileIndexMove_Test_Nominal(void)
+{
+    int32 FileIndex = 0;
+
+    strncpy(DS_AppData.IndexStatus[FileIndex].FileName, "directory1/filename.idx",
+            sizeof(DS_AppData.IndexStatus[FileIndex].FileName));
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileIndexMove(FileIndex, "directory2/filename"));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_mv, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileIndexMove_Test_MoveError(void)
+{
+    int32 FileIndex = 0;
+
+    strncpy(DS_AppData.IndexStatus[FileIndex].FileName, "directory1/filename.idx",
+            sizeof(DS_AppData.IndexStatus[FileIndex].FileName));
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_mv), OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileIndexMove(FileIndex, "directory2/filename"));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_INDEX_FILE_ERR_EID);
+}
+
+void DS_FileIndexMove_Test_NameTooLong(void)
+{
+    int32 FileIndex = 0;
+    char  DataName[DS_TOTAL_FNAME_BUFSIZE];
+
+    strncpy(DS_AppData.IndexStatus[FileIndex].FileName, "directory1/filename.idx",
+            sizeof(DS_AppData.IndexStatus[FileIndex].FileName));
+
+    memset(DataName, 'a', sizeof(DataName) - 1);
+    DataName[sizeof(DataName) - 1] = '\0';
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileIndexMove(FileIndex, DataName));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_mv, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_INDEX_FILE_ERR_EID);
+}
+
+void DS_FileIndexMove_Test_NoIndex(void)
+{
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileIndexMove(0, "directory2/filename"));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_mv, 0);
+}
+
+void DS_FileTrailerPacket_Test_Nominal(void)
+{
+    int32                   FileIndex     = 0;
+    CFE_TIME_SysTime_t      PacketTime[3] = {{10, 0}, {11, 0}, {12, 5}};
+    CFE_MSG_SequenceCount_t SeqCount[3]   = {5, 6, 8};
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgTime), PacketTime, sizeof(PacketTime), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSequenceCount), SeqCount, sizeof(SeqCount), false);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_MSG_GetNextSequenceCount), 6);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileTrailerPacket(FileIndex, &UT_CmdBuf.Buf.Msg, 100));
+    UtAssert_VOIDCALL(DS_FileTrailerPacket(FileIndex, &UT_CmdBuf.Buf.Msg, 100));
+    UtAssert_VOIDCALL(DS_FileTrailerPacket(FileIndex, &UT_CmdBuf.Buf.Msg, 100));
+
+    /* Verify results - one sequence gap between 6 and 8 */
+    UtAssert_UINT32_EQ(DS_AppData.TrailerStatus[FileIndex].EntryCount, 1);
+    UtAssert_UINT32_EQ(DS_AppData.TrailerStatus[FileIndex].Entry[0].PacketCount, 3);
+    UtAssert_UINT32_EQ(DS_AppData.TrailerStatus[FileIndex].Entry[0].ByteCount, 300);
+    UtAssert_UINT32_EQ(DS_AppData.TrailerStatus[FileIndex].Entry[0].SeqGapCount, 1);
+    UtAssert_UINT32_EQ(DS_AppData.TrailerStatus[FileIndex].Entry[0].FirstSeconds, 10);
+    UtAssert_UINT32_EQ(DS_AppData.TrailerStatus[FileIndex].Entry[0].LastSeconds, 12);
+    UtAssert_UINT32_EQ(DS_AppData.TrailerStatus[FileIndex].Entry[0].LastSubseconds, 5);
+    UtAssert_STUB_COUNT(CFE_MSG_GetNextSequenceCount, 2);
+}
+
+void DS_FileTrailerPacket_Test_EntriesFull(void)
+{
+    int32  FileIndex = 0;
+    uint32 i;
+
+    for (i = 0; i < DS_FILE_TRAILER_ENTRIES; i++)
+    {
+        DS_AppData.TrailerStatus[FileIndex].Entry[i].MessageID = i + 1;
+    }
+    DS_AppData.TrailerStatus[FileIndex].EntryCount = DS_FILE_TRAILER_ENTRIES;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileTrailerPacket(FileIndex, &UT_CmdBuf.Buf.Msg, 100));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.TrailerStatus[FileIndex].EntryCount, DS_FILE_TRAILER_ENTRIES);
+    UtAssert_UINT32_EQ(DS_AppData.TrailerStatus[FileIndex].OtherPackets, 1);
+    UtAssert_UINT32_EQ(DS_AppData.TrailerStatus[FileIndex].OtherBytes, 100);
+    UtAssert_STUB_COUNT(CFE_MSG_GetMsgTime, 0);
+}
+
+void DS_FileTrailerWrite_Test_Nominal(void)
+{
+    int32 FileIndex = 0;
+
+    DS_AppData.FileStatus[FileIndex].FileSize      = 100;
+    DS_AppData.TrailerStatus[FileIndex].EntryCount = 2;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileTrailerWrite(FileIndex));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FileUpdateCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize,
+                       100 + (2 * sizeof(DS_FileTrailerEntry_t)) + sizeof(DS_FileTrailerFooter_t));
+    UtAssert_STUB_COUNT(OS_lseek, 1);
+    UtAssert_STUB_COUNT(OS_write, 2);
+}
+
+void DS_FileTrailerWrite_Test_NoEntries(void)
+{
+    int32 FileIndex = 0;
+
+    DS_AppData.FileStatus[FileIndex].FileSize = 100;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileTrailerWrite(FileIndex));
+
+    /* Verify results - footer only */
+    UtAssert_UINT32_EQ(DS_AppData.FileUpdateCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, 100 + sizeof(DS_FileTrailerFooter_t));
+    UtAssert_STUB_COUNT(OS_write, 1);
+}
+
+void DS_FileTrailerWrite_Test_Error(void)
+{
+    int32 FileIndex = 0;
+
+    DS_AppData.FileStatus[FileIndex].FileSize      = 100;
+    DS_AppData.TrailerStatus[FileIndex].EntryCount = 2;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), -1);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileTrailerWrite(FileIndex));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FileUpdateErrCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, 100);
+    UtAssert_STUB_COUNT(OS_write, 1);
+}
+
+void DS_FileCompressData_Test_Nominal(void)
+{
+    int32 FileIndex = 0;
+    uint8 Data[10]  = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+
+    DS_AppData.CompressStatus[FileIndex].BlockCount = 20;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FileCompressData(FileIndex, Data, sizeof(Data)), sizeof(Data));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.CompressStatus[FileIndex].BlockCount, 20 + sizeof(Data));
+    UtAssert_ZERO(memcmp(&((uint8 *)DS_AppData.CompressStatus[FileIndex].Block)[20], Data, sizeof(Data)));
+    UtAssert_STUB_COUNT(OS_write, 0);
+}
+
+void DS_FileCompressData_Test_NewBlock(void)
+{
+    int32 FileIndex = 0;
+    uint8 Data[10]  = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+
+    DS_AppData.CompressStatus[FileIndex].BlockCount = DS_COMPRESS_BLOCK_SIZE - 5;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FileCompressData(FileIndex, Data, sizeof(Data)), sizeof(Data));
+
+    /* Verify results - buffered block written, packet starts the next block */
+    UtAssert_UINT32_EQ(DS_AppData.CompressStatus[FileIndex].BlockCount, sizeof(Data));
+    UtAssert_ZERO(memcmp(DS_AppData.CompressStatus[FileIndex].Block, Data, sizeof(Data)));
+    UtAssert_STUB_COUNT(OS_write, 1);
+}
+
+void DS_FileCompressData_Test_LargePacket(void)
+{
+    int32 FileIndex = 0;
+    uint8 Data[(DS_COMPRESS_BLOCK_SIZE * 2) + 10];
+
+    memset(Data, 0x5A, sizeof(Data));
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FileCompressData(FileIndex, Data, sizeof(Data)), sizeof(Data));
+
+    /* Verify results - two full blocks written, remainder buffered */
+    UtAssert_UINT32_EQ(DS_AppData.CompressStatus[FileIndex].BlockCount, 10);
+    UtAssert_UINT32_EQ(DS_AppData.CompressRawBytes, DS_COMPRESS_BLOCK_SIZE * 2);
+    UtAssert_STUB_COUNT(OS_write, 2);
+}
+
+void DS_FileCompressData_Test_Error(void)
+{
+    int32 FileIndex = 0;
+    uint8 Data[10]  = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+
+    DS_AppData.CompressStatus[FileIndex].BlockCount = DS_COMPRESS_BLOCK_SIZE - 5;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FileCompressData(FileIndex, Data, sizeof(Data)), OS_ERROR);
+
+    /* Verify results - packet not buffered */
+    UtAssert_ZERO(DS_AppData.CompressStatus[FileIndex].BlockCount);
+    UtAssert_STUB_COUNT(OS_write, 1);
+}
+
+void DS_FileCompressFlush_Test_Compressed(void)
+{
+    int32                 FileIndex   = 0;
+    DS_FileBlockHeader_t *BlockHeader = (DS_FileBlockHeader_t *)DS_AppData.CompressBuffer;
+
+    DS_AppData.FileStatus[FileIndex].FileSize       = 100;
+    DS_AppData.CompressStatus[FileIndex].BlockCount = 1000;
+
+    UT_SetDefaultReturnValue(UT_KEY(DS_CompressBlock), 300);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CalculateCRC), 0x1234);
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), 300 + sizeof(DS_FileBlockHeader_t));
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FileCompressFlush(FileIndex), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(BlockHeader->Magic, DS_FILE_BLOCK_MAGIC);
+    UtAssert_UINT32_EQ(BlockHeader->RawSize, 1000);
+    UtAssert_UINT32_EQ(BlockHeader->StoredSize, 300);
+    UtAssert_UINT32_EQ(BlockHeader->Crc, 0x1234);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, 100 + 300 + sizeof(DS_FileBlockHeader_t));
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileGrowth, 300 + sizeof(DS_FileBlockHeader_t));
+    UtAssert_UINT32_EQ(DS_AppData.CompressRawBytes, 1000);
+    UtAssert_UINT32_EQ(DS_AppData.CompressFileBytes, 300 + sizeof(DS_FileBlockHeader_t));
+    UtAssert_UINT32_EQ(DS_AppData.DestStats[FileIndex].ByteCount, 300 + sizeof(DS_FileBlockHeader_t));
+    UtAssert_UINT32_EQ(DS_AppData.DestStats[FileIndex].WriteCalls, 1);
+    UtAssert_ZERO(DS_AppData.CompressStatus[FileIndex].BlockCount);
+    UtAssert_STUB_COUNT(OS_write, 1);
+}
+
+void DS_FileCompressFlush_Test_Stored(void)
+{
+    int32                 FileIndex   = 0;
+    DS_FileBlockHeader_t *BlockHeader = (DS_FileBlockHeader_t *)DS_AppData.CompressBuffer;
+
+    DS_AppData.CompressStatus[FileIndex].BlockCount = 10;
+    memset(DS_AppData.CompressStatus[FileIndex].Block, 0xA5, 10);
+
+    /* Execute the function being tested - compressor returns zero (does not fit) */
+    UtAssert_INT32_EQ(DS_FileCompressFlush(FileIndex), CFE_SUCCESS);
+
+    /* Verify results - block stored uncompressed */
+    UtAssert_UINT32_EQ(BlockHeader->RawSize, 10);
+    UtAssert_UINT32_EQ(BlockHeader->StoredSize, 10);
+    UtAssert_ZERO(memcmp(&BlockHeader[1], DS_AppData.CompressStatus[FileIndex].Block, 10));
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, 10 + sizeof(DS_FileBlockHeader_t));
+}
+
+void DS_FileCompressFlush_Test_PartialWrite(void)
+{
+    int32 FileIndex = 0;
+
+    DS_AppData.CompressStatus[FileIndex].BlockCount = 10;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), 5);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FileCompressFlush(FileIndex), OS_ERROR);
+
+    /* Verify results */
+    UtAssert_ZERO(DS_AppData.FileStatus[FileIndex].FileSize);
+    UtAssert_ZERO(DS_AppData.CompressFileBytes);
+    UtAssert_ZERO(DS_AppData.CompressStatus[FileIndex].BlockCount);
+}
+
+void DS_FileCompressClose_Test_Nominal(void)
+{
+    int32 FileIndex = 0;
+
+    DS_AppData.FileStatus[FileIndex].FileSize       = 100;
+    DS_AppData.CompressStatus[FileIndex].BlockCount = 10;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileCompressClose(FileIndex));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, 100 + 10 + sizeof(DS_FileBlockHeader_t));
+    UtAssert_ZERO(DS_AppData.CompressStatus[FileIndex].BlockCount);
+    UtAssert_STUB_COUNT(OS_lseek, 1);
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileCompressClose_Test_SeekError(void)
+{
+    int32 FileIndex = 0;
+
+    DS_AppData.FileStatus[FileIndex].FileSize       = 100;
+    DS_AppData.CompressStatus[FileIndex].BlockCount = 10;
+    DS_AppData.TrailerStatus[FileIndex].Active      = true;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_lseek), OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileCompressClose(FileIndex));
+
+    /* Verify results - error reported, trailer not written */
+    UtAssert_UINT32_EQ(DS_AppData.FileWriteErrCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, 100);
+    UtAssert_ZERO(DS_AppData.CompressStatus[FileIndex].BlockCount);
+    UtAssert_BOOL_FALSE(DS_AppData.TrailerStatus[FileIndex].Active);
+    UtAssert_STUB_COUNT(OS_write, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_WRITE_FILE_ERR_EID);
+}
+
+void DS_FileLimitSize_Test_Uncompressed(void)
+{
+    int32 FileIndex = 0;
+
+    DS_AppData.FileStatus[FileIndex].FileSize = 100;
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(DS_FileLimitSize(FileIndex, 10), 110);
+}
+
+void DS_FileLimitSize_Test_Logical(void)
+{
+    int32 FileIndex = 0;
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].SizeLimitMode = DS_SIZE_LIMIT_LOGICAL;
+    DS_AppData.FileStatus[FileIndex].CompressMode            = DS_COMPRESS_LZ;
+    DS_AppData.FileStatus[FileIndex].FileSize                = 100;
+    DS_AppData.FileStatus[FileIndex].LogicalSize             = 500;
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(DS_FileLimitSize(FileIndex, 10), 510);
+}
+
+void DS_FileLimitSize_Test_Physical(void)
+{
+    int32 FileIndex = 0;
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].SizeLimitMode = DS_SIZE_LIMIT_PHYSICAL;
+    DS_AppData.FileStatus[FileIndex].CompressMode            = DS_COMPRESS_LZ;
+    DS_AppData.FileStatus[FileIndex].FileSize                = 100;
+    DS_AppData.FileStatus[FileIndex].LogicalSize             = 500;
+
+    /* Execute the function being tested - empty block */
+    UtAssert_UINT32_EQ(DS_FileLimitSize(FileIndex, 10), 100 + 10 + sizeof(DS_FileBlockHeader_t));
+
+    /* Execute the function being tested - packet fits in buffered block */
+    DS_AppData.CompressStatus[FileIndex].BlockCount = 20;
+    UtAssert_UINT32_EQ(DS_FileLimitSize(FileIndex, 10), 100 + 20 + 10 + sizeof(DS_FileBlockHeader_t));
+
+    /* Execute the function being tested - packet starts a new block */
+    DS_AppData.CompressStatus[FileIndex].BlockCount = DS_COMPRESS_BLOCK_SIZE - 5;
+    UtAssert_UINT32_EQ(DS_FileLimitSize(FileIndex, 10),
+                       100 + DS_COMPRESS_BLOCK_SIZE + 5 + (2 * sizeof(DS_FileBlockHeader_t)));
+}
+
+void DS_FileLogicalSize_Test(void)
+{
+    DS_AppFileStatus_t FileStatus;
+
+    memset(&FileStatus, 0, sizeof(FileStatus));
+    FileStatus.FileSize    = 100;
+    FileStatus.LogicalSize = 500;
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(DS_FileLogicalSize(&FileStatus), 100);
+
+    FileStatus.CompressMode = DS_COMPRESS_LZ;
+    UtAssert_UINT32_EQ(DS_FileLogicalSize(&FileStatus), 500);
+}
+
+void DS_FileRecordEncode_Test_Delta(void)
+{
+    int32                   FileIndex    = 0;
+    uint32                  RecordLength = 0;
+    uint8 *                 Record       = (uint8 *)DS_AppData.RecordBuffer;
+    UT_DS_TlmPacket_t       Packet;
+    CFE_MSG_SequenceCount_t SeqCount[3] = {1, DS_FILE_RECORD_SEQ_MODULUS - 2, DS_FILE_RECORD_SEQ_MODULUS - 2};
+    CFE_TIME_SysTime_t      MsgTime[3]  = {{11, 0x80000000}, {10, 0}, {10, 0}};
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].KeyframeInterval = 10;
+
+    UT_DS_SetTlmPacket(&Packet, &DS_AppData.RecordStatus[FileIndex].Ref[0]);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSequenceCount), SeqCount, sizeof(SeqCount), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgTime), MsgTime, sizeof(MsgTime), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_FileRecordEncode(FileIndex, &Packet.Header.Msg, sizeof(Packet), &RecordLength));
+
+    /* Verify results - sequence count wraps, time is 1.5 seconds later */
+    UtAssert_UINT32_EQ(RecordLength, DS_FILE_RECORD_DELTA_SIZE + sizeof(Packet.Payload));
+    UtAssert_UINT32_EQ(Record[0], DS_FILE_RECORD_DELTA_TAG);
+    UtAssert_UINT32_EQ(Record[1], 0x08);
+    UtAssert_UINT32_EQ(Record[2], 0x10);
+    UtAssert_UINT32_EQ(Record[3], 3);
+    UtAssert_UINT32_EQ(Record[4], 0x01);
+    UtAssert_UINT32_EQ(Record[5], 0x80);
+    UtAssert_UINT32_EQ(Record[6], 0x00);
+    UtAssert_MemCmp(&Record[DS_FILE_RECORD_DELTA_SIZE], Packet.Payload, sizeof(Packet.Payload), "Payload");
+    UtAssert_UINT32_EQ(DS_AppData.RecordStatus[FileIndex].Ref[0].DeltaCount, 1);
+}
+
+void DS_FileRecordEncode_Test_Keyframe(void)
+{
+    int32                   FileIndex    = 0;
+    uint32                  RecordLength = 0;
+    UT_DS_TlmPacket_t       Packet;
+    CFE_MSG_SequenceCount_t SeqCount[3] = {2, 1, 1};
+    CFE_TIME_SysTime_t      MsgTime[3]  = {{11, 0}, {10, 0}, {10, 0}};
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].KeyframeInterval = 10;
+
+    UT_DS_SetTlmPacket(&Packet, &DS_AppData.RecordStatus[FileIndex].Ref[0]);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSequenceCount), SeqCount, sizeof(SeqCount), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgTime), MsgTime, sizeof(MsgTime), false);
+
+    DS_AppData.RecordStatus[FileIndex].Ref[0].DeltaCount = 9;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_FileRecordEncode(FileIndex, &Packet.Header.Msg, sizeof(Packet), &RecordLength));
+
+    /* Verify results - every tenth record is a full packet */
+    UtAssert_UINT32_EQ(RecordLength, 0);
+    UtAssert_UINT32_EQ(DS_AppData.RecordStatus[FileIndex].Ref[0].DeltaCount, 0);
+    UtAssert_UINT32_EQ(DS_AppData.RecordStatus[FileIndex].Ref[0].PacketSize, sizeof(Packet));
+}
+
+void DS_FileRecordEncode_Test_HeaderChanged(void)
+{
+    int32                   FileIndex    = 0;
+    uint32                  RecordLength = 0;
+    uint8 *                 PacketBytes;
+    UT_DS_TlmPacket_t       Packet;
+    CFE_MSG_SequenceCount_t SeqCount[3] = {2, 1, 1};
+    CFE_TIME_SysTime_t      MsgTime[3]  = {{11, 0}, {10, 0}, {10, 0}};
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].KeyframeInterval = 10;
+
+    UT_DS_SetTlmPacket(&Packet, &DS_AppData.RecordStatus[FileIndex].Ref[0]);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSequenceCount), SeqCount, sizeof(SeqCount), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgTime), MsgTime, sizeof(MsgTime), false);
+
+    PacketBytes                            = (uint8 *)&Packet;
+    PacketBytes[sizeof(Packet.Header) - 1] = 0xFF;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_FileRecordEncode(FileIndex, &Packet.Header.Msg, sizeof(Packet), &RecordLength));
+
+    /* Verify results - changed header is remembered for the next record */
+    UtAssert_UINT32_EQ(RecordLength, 0);
+    UtAssert_MemCmp(&DS_AppData.RecordStatus[FileIndex].Ref[0].Header, &Packet.Header, sizeof(Packet.Header),
+                    "Header");
+}
+
+void DS_FileRecordEncode_Test_SizeChanged(void)
+{
+    int32             FileIndex    = 0;
+    uint32            RecordLength = 0;
+    UT_DS_TlmPacket_t Packet;
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].KeyframeInterval = 10;
+
+    UT_DS_SetTlmPacket(&Packet, &DS_AppData.RecordStatus[FileIndex].Ref[0]);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_FileRecordEncode(FileIndex, &Packet.Header.Msg, sizeof(Packet) - 1, &RecordLength));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.RecordStatus[FileIndex].Ref[0].PacketSize, sizeof(Packet) - 1);
+    UtAssert_STUB_COUNT(CFE_MSG_GetMsgTime, 0);
+}
+
+void DS_FileRecordEncode_Test_TimeBackwards(void)
+{
+    int32                   FileIndex    = 0;
+    uint32                  RecordLength = 0;
+    UT_DS_TlmPacket_t       Packet;
+    CFE_MSG_SequenceCount_t SeqCount[2] = {2, 1};
+    CFE_TIME_SysTime_t      MsgTime[2]  = {{9, 0}, {10, 0}};
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].KeyframeInterval = 10;
+
+    UT_DS_SetTlmPacket(&Packet, &DS_AppData.RecordStatus[FileIndex].Ref[0]);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSequenceCount), SeqCount, sizeof(SeqCount), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgTime), MsgTime, sizeof(MsgTime), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_FileRecordEncode(FileIndex, &Packet.Header.Msg, sizeof(Packet), &RecordLength));
+
+    /* Verify results - header was not rebuilt */
+    UtAssert_STUB_COUNT(CFE_MSG_SetMsgTime, 0);
+}
+
+void DS_FileRecordEncode_Test_LargeSeqDelta(void)
+{
+    int32                   FileIndex    = 0;
+    uint32                  RecordLength = 0;
+    UT_DS_TlmPacket_t       Packet;
+    CFE_MSG_SequenceCount_t SeqCount[2] = {1 + DS_FILE_RECORD_MAX_SEQ_DELTA + 1, 1};
+    CFE_TIME_SysTime_t      MsgTime[2]  = {{11, 0}, {10, 0}};
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].KeyframeInterval = 10;
+
+    UT_DS_SetTlmPacket(&Packet, &DS_AppData.RecordStatus[FileIndex].Ref[0]);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSequenceCount), SeqCount, sizeof(SeqCount), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgTime), MsgTime, sizeof(MsgTime), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_FileRecordEncode(FileIndex, &Packet.Header.Msg, sizeof(Packet), &RecordLength));
+
+    /* Verify results - header was not rebuilt */
+    UtAssert_STUB_COUNT(CFE_MSG_SetMsgTime, 0);
+}
+
+void DS_FileRecordEncode_Test_LargeTimeDelta(void)
+{
+    int32                   FileIndex    = 0;
+    uint32                  RecordLength = 0;
+    UT_DS_TlmPacket_t       Packet;
+    CFE_MSG_SequenceCount_t SeqCount[2] = {2, 1};
+    CFE_TIME_SysTime_t      MsgTime[2]  = {{10 + 256, 0}, {10, 0}};
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].KeyframeInterval = 10;
+
+    UT_DS_SetTlmPacket(&Packet, &DS_AppData.RecordStatus[FileIndex].Ref[0]);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSequenceCount), SeqCount, sizeof(SeqCount), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgTime), MsgTime, sizeof(MsgTime), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_FileRecordEncode(FileIndex, &Packet.Header.Msg, sizeof(Packet), &RecordLength));
+
+    /* Verify results - header was not rebuilt */
+    UtAssert_STUB_COUNT(CFE_MSG_SetMsgTime, 0);
+}
+
+void DS_FileRecordEncode_Test_NotTelemetry(void)
+{
+    int32  FileIndex    = 0;
+    uint32 RecordLength = 0;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_FileRecordEncode(FileIndex, &UT_CmdBuf.Buf.Msg, sizeof(UT_CmdBuf), &RecordLength));
+
+    /* Verify results - commands are not remembered */
+    UtAssert_UINT32_EQ(DS_AppData.RecordStatus[FileIndex].NextRef, 0);
+    UtAssert_UINT32_EQ(DS_AppData.RecordStatus[FileIndex].Ref[0].PacketSize, 0);
+}
+
+void DS_FileRecordFind_Test_Nominal(void)
+{
+    int32 FileIndex = 0;
+
+    DS_AppData.RecordStatus[FileIndex].Ref[1].StreamId   = 0x0810;
+    DS_AppData.RecordStatus[FileIndex].Ref[1].PacketSize = 20;
+    DS_AppData.RecordStatus[FileIndex].Ref[1].DeltaCount = 3;
+
+    /* Execute the function being tested */
+    UtAssert_ADDRESS_EQ(DS_FileRecordFind(FileIndex, 0x0810), &DS_AppData.RecordStatus[FileIndex].Ref[1]);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.RecordStatus[FileIndex].Ref[1].DeltaCount, 3);
+    UtAssert_UINT32_EQ(DS_AppData.RecordStatus[FileIndex].NextRef, 0);
+}
+
+void DS_FileRecordFind_Test_Replace(void)
+{
+    int32               FileIndex = 0;
+    DS_FileRecordRef_t *RecordRef;
+    uint32              i;
+
+    for (i = 0; i < DS_RECORD_REFERENCES; i++)
+    {
+        DS_AppData.RecordStatus[FileIndex].Ref[i].StreamId   = 0x0800 + i;
+        DS_AppData.RecordStatus[FileIndex].Ref[i].PacketSize = 20;
+    }
+
+    DS_AppData.RecordStatus[FileIndex].NextRef = DS_RECORD_REFERENCES - 1;
+
+    /* Execute the function being tested */
+    RecordRef = DS_FileRecordFind(FileIndex, 0x0900);
+
+    /* Verify results - next packet of the stream is written in full */
+    UtAssert_ADDRESS_EQ(RecordRef, &DS_AppData.RecordStatus[FileIndex].Ref[DS_RECORD_REFERENCES - 1]);
+    UtAssert_UINT32_EQ(RecordRef->StreamId, 0x0900);
+    UtAssert_UINT32_EQ(RecordRef->PacketSize, 0);
+    UtAssert_UINT32_EQ(DS_AppData.RecordStatus[FileIndex].NextRef, 0);
+}
+
+void DS_FileRecordApply_Test(void)
+{
+    CFE_MSG_TelemetryHeader_t RefHeader;
+    CFE_MSG_TelemetryHeader_t Header;
+    CFE_MSG_SequenceCount_t   SeqCount = DS_FILE_RECORD_SEQ_MODULUS - 1;
+    CFE_TIME_SysTime_t        MsgTime  = {10, 0xFFFF0000};
+
+    memset(&RefHeader, 0xA5, sizeof(RefHeader));
+    memset(&Header, 0, sizeof(Header));
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSequenceCount), &SeqCount, sizeof(SeqCount), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgTime), &MsgTime, sizeof(MsgTime), false);
+    UT_SetHandlerFunction(UT_KEY(CFE_MSG_SetSequenceCount), &UT_CFE_MSG_SetSequenceCount_CustomHandler, NULL);
+    UT_SetHandlerFunction(UT_KEY(CFE_MSG_SetMsgTime), &UT_CFE_MSG_SetMsgTime_CustomHandler, NULL);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileRecordApply(&RefHeader, 2, 0x10001, &Header));
+
+    /* Verify results - sequence count wraps, subseconds carry into seconds */
+    UtAssert_MemCmp(&Header, &RefHeader, sizeof(Header), "Header");
+    UtAssert_UINT32_EQ(UT_DS_SetSeqCnt, 1);
+    UtAssert_UINT32_EQ(UT_DS_SetTime.Seconds, 12);
+    UtAssert_UINT32_EQ(UT_DS_SetTime.Subseconds, 0);
+}
+
+void DS_FileCloseDest_Test_PlatformConfigMoveFiles_Nominal(void)
+{
+    int32 FileIndex = 0;
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    strncpy(DS_AppData.FileStatus[FileIndex].FileName, "directory1/filename",
+            sizeof(DS_AppData.FileStatus[FileIndex].FileName));
+    strncpy(DS_AppData.DestFileTblPtr->File[FileIndex].Movename, "directory2/movename/",
+            sizeof(DS_AppData.DestFileTblPtr->File[FileIndex].Movename));
+    DS_AppData.EnableMoveFiles = DS_ENABLED;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileCloseDest(FileIndex));
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(DS_AppData.FileStatus[FileIndex].FileHandle));
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileAge, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileName[0], 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileCloseDest_Test_PlatformConfigMoveFiles_Index(void)
+{
+    int32 FileIndex = 0;
+
+    /* Set up the handles */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+    OS_OpenCreate(&DS_AppData.IndexStatus[FileIndex].IndexHandle, NULL, 0, 0);
+
+    strncpy(DS_AppData.FileStatus[FileIndex].FileName, "directory1/filename",
+            sizeof(DS_AppData.FileStatus[FileIndex].FileName));
+    strncpy(DS_AppData.IndexStatus[FileIndex].FileName, "directory1/filename.idx",
+            sizeof(DS_AppData.IndexStatus[FileIndex].FileName));
+    strncpy(DS_AppData.DestFileTblPtr->File[FileIndex].Movename, "directory2/movename/",
+            sizeof(DS_AppData.DestFileTblPtr->File[FileIndex].Movename));
+    DS_AppData.EnableMoveFiles = DS_ENABLED;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileCloseDest(FileIndex));
+
+    /* Verify results - index finalized and moved with the data file */
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(DS_AppData.IndexStatus[FileIndex].IndexHandle));
+    UtAssert_UINT32_EQ(DS_AppData.IndexStatus[FileIndex].FileName[0], 0);
+    UtAssert_STUB_COUNT(OS_close, 2);
+    UtAssert_STUB_COUNT(OS_mv, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileCloseDest_Test_PlatformConfigMoveFiles_Shard(void)
+{
+    int32 FileIndex = 0;
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    strncpy(DS_AppData.FileStatus[FileIndex].FileName, "directory1/2024/001/00/filename",
+            sizeof(DS_AppData.FileStatus[FileIndex].FileName));
+    strncpy(DS_AppData.ShardStatus[FileIndex].ShardName, "2024/001/00",
+            sizeof(DS_AppData.ShardStatus[FileIndex].ShardName));
+    strncpy(DS_AppData.DestFileTblPtr->File[FileIndex].Movename, "directory2/movename/",
+            sizeof(DS_AppData.DestFileTblPtr->File[FileIndex].Movename));
+    DS_AppData.EnableMoveFiles = DS_ENABLED;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileCloseDest(FileIndex));
+
+    /* Verify results - the file moves into the same shard below Movename */
+    UtAssert_STRINGBUF_EQ(DS_AppData.ShardStatus[FileIndex].MovedDir,
+                          sizeof(DS_AppData.ShardStatus[FileIndex].MovedDir), "directory2/movename/2024/001/00", -1);
+    UtAssert_STUB_COUNT(OS_mkdir, 3);
+    UtAssert_STUB_COUNT(OS_mv, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileCloseDest_Test_PlatformConfigMoveFiles_ShardError(void)
+{
+    int32 FileIndex = 0;
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    strncpy(DS_AppData.FileStatus[FileIndex].FileName, "directory1/2024/001/00/filename",
+            sizeof(DS_AppData.FileStatus[FileIndex].FileName));
+    strncpy(DS_AppData.ShardStatus[FileIndex].ShardName, "2024/001/00",
+            sizeof(DS_AppData.ShardStatus[FileIndex].ShardName));
+    strncpy(DS_AppData.DestFileTblPtr->File[FileIndex].Movename, "directory2/movename/",
+            sizeof(DS_AppData.DestFileTblPtr->File[FileIndex].Movename));
+    DS_AppData.EnableMoveFiles = DS_ENABLED;
+
+    /* Set to fail the shard directory creation */
+    UT_SetDefaultReturnValue(UT_KEY(OS_mkdir), OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileCloseDest(FileIndex));
+
+    /* Verify results - the file is left where it was written */
+    UtAssert_STUB_COUNT(OS_mv, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_SHARD_DIR_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, DS_MOVE_FILE_ERR_EID);
+}
+
+void DS_FileCloseDest_Test_PlatformConfigMoveFiles_MoveError(void)
+{
+    int32 FileIndex = 0;
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    strncpy(DS_AppData.FileStatus[FileIndex].FileName, "directory1/filename",
+            sizeof(DS_AppData.FileStatus[FileIndex].FileName));
+    strncpy(DS_AppData.DestFileTblPtr->File[FileIndex].Movename, "directory2/movename/",
+            sizeof(DS_AppData.DestFileTblPtr->File[FileIndex].Movename));
+    strncpy(DS_AppData.ShardStatus[FileIndex].MovedDir, "directory2/movename/0000",
+            sizeof(DS_AppData.ShardStatus[FileIndex].MovedDir));
+    DS_AppData.EnableMoveFiles = DS_ENABLED;
+
+    /* Set to generate error message DS_MOVE_FILE_ERR_EID */
+    UT_SetDefaultReturnValue(UT_KEY(OS_mv), -1);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileCloseDest(FileIndex));
+
+    /* Verify results - the shard directory is created again for the next file */
+    UtAssert_UINT32_EQ(DS_AppData.ShardStatus[FileIndex].MovedDir[0], 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileAge, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileName[0], 0);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_MOVE_FILE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void DS_FileCloseDest_Test_PlatformConfigMoveFiles_FilenameTooLarge(void)
+{
+    int32      FileIndex = 0;
+    const char DirName[] = "directory1/";
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    size_t DirNameLen = sizeof(DirName);
+    strncpy(DS_AppData.FileStatus[FileIndex].FileName, DirName, DirNameLen);
+    memset(&DS_AppData.FileStatus[FileIndex].FileName[DirNameLen - 1], 'f', DS_TOTAL_FNAME_BUFSIZE - DirNameLen);
+    DS_AppData.FileStatus[FileIndex].FileName[DS_TOTAL_FNAME_BUFSIZE - 1] = '\0';
+    strncpy(DS_AppData.DestFileTblPtr->File[FileIndex].Movename, "directory2/movename/",
+            sizeof(DS_AppData.DestFileTblPtr->File[FileIndex].Movename));
+    DS_AppData.EnableMoveFiles = DS_ENABLED;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileCloseDest(FileIndex));
+
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileAge, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileName[0], 0);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_MOVE_FILE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void DS_FileCloseDest_Test_PlatformConfigMoveFiles_FilenameNull(void)
+{
+    int32 FileIndex = 0;
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    strncpy(DS_AppData.DestFileTblPtr->File[FileIndex].Movename, "directory2/movename",
+            sizeof(DS_AppData.DestFileTblPtr->File[FileIndex].Movename));
+    DS_AppData.EnableMoveFiles = DS_ENABLED;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileCloseDest(FileIndex));
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(DS_AppData.FileStatus[FileIndex].FileHandle));
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileAge, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileName[0], 0);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_MOVE_FILE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void DS_FileCloseDest_Test_PlatformConfigMoveFiles_MovenameNull(void)
+{
+    int32 FileIndex = 0;
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    strncpy(DS_AppData.DestFileTblPtr->File[FileIndex].Movename, "",
+            sizeof(DS_AppData.DestFileTblPtr->File[FileIndex].Movename));
+    DS_AppData.EnableMoveFiles = DS_ENABLED;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileCloseDest(FileIndex));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_SB_MessageStringGet, 0);
+}
+
+void DS_FileCloseDest_Test_PlatformConfigMoveFiles_DisableMoveFiles(void)
+{
+    int32 FileIndex = 0;
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+    DS_AppData.EnableMoveFiles = DS_DISABLED;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileCloseDest(FileIndex));
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(DS_AppData.FileStatus[FileIndex].FileHandle));
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileAge, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileName[0], 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileCloseDest_Test_RememberClosedFile(void)
+{
+    int32 FileIndex = 0;
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    strncpy(DS_AppData.FileStatus[FileIndex].FileName, "directory1/filename",
+            sizeof(DS_AppData.FileStatus[FileIndex].FileName));
+    DS_AppData.FileStatus[FileIndex].FileSize = 100;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileCloseDest(FileIndex));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.ClosedFiles[FileIndex].Count, 1);
+    UtAssert_UINT32_EQ(DS_AppData.ClosedFiles[FileIndex].TotalSize, 100);
+    UtAssert_UINT32_EQ(DS_AppData.ClosedFileBytes, 100);
+    UtAssert_STRINGBUF_EQ(DS_AppData.ClosedFiles[FileIndex].File[0].FileName,
+                          sizeof(DS_AppData.ClosedFiles[FileIndex].File[0].FileName), "directory1/filename",
+                          sizeof("directory1/filename"));
+}
+
+void DS_FileCloseDest_Test_MoveErrorNotRemembered(void)
+{
+    int32      FileIndex = 0;
+    const char DirName[] = "directory1/";
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    /* Filename too long to move, so the reported name becomes the move directory */
+    memcpy(DS_AppData.FileStatus[FileIndex].FileName, DirName, sizeof(DirName));
+    memset(&DS_AppData.FileStatus[FileIndex].FileName[sizeof(DirName) - 1], 'f',
+           DS_TOTAL_FNAME_BUFSIZE - sizeof(DirName));
+    DS_AppData.FileStatus[FileIndex].FileName[DS_TOTAL_FNAME_BUFSIZE - 1] = '\0';
+    DS_AppData.FileStatus[FileIndex].FileSize                            = 100;
+    strncpy(DS_AppData.DestFileTblPtr->File[FileIndex].Movename, "directory2/movename/",
+            sizeof(DS_AppData.DestFileTblPtr->File[FileIndex].Movename));
+    DS_AppData.EnableMoveFiles = DS_ENABLED;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileCloseDest(FileIndex));
+
+    /* Verify results - the directory must never be evicted */
+    UtAssert_UINT32_EQ(DS_AppData.ClosedFiles[FileIndex].Count, 0);
+    UtAssert_UINT32_EQ(DS_AppData.ClosedFileBytes, 0);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_MOVE_FILE_ERR_EID);
+}
+
+void DS_FileCloseDest_Test_Trailer(void)
+{
+    int32 FileIndex = 0;
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    DS_AppData.FileStatus[FileIndex].FileSize  = 100;
+    DS_AppData.TrailerStatus[FileIndex].Active = true;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileCloseDest(FileIndex));
+
+    /* Verify results - trailer bytes are part of the closed file */
+    UtAssert_BOOL_FALSE(DS_AppData.TrailerStatus[FileIndex].Active);
+    UtAssert_UINT32_EQ(DS_AppData.ClosedFiles[FileIndex].TotalSize, 100 + sizeof(DS_FileTrailerFooter_t));
+    UtAssert_STUB_COUNT(OS_write, 1);
+}
+
+void DS_FileCloseDest_Test_Compressed(void)
+{
+    int32 FileIndex = 0;
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    DS_AppData.FileStatus[FileIndex].CompressMode   = DS_COMPRESS_LZ;
+    DS_AppData.FileStatus[FileIndex].FileSize       = 100;
+    DS_AppData.FileStatus[FileIndex].LogicalSize    = 200;
+    DS_AppData.CompressStatus[FileIndex].BlockCount = 10;
+    DS_AppData.TrailerStatus[FileIndex].Active      = true;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileCloseDest(FileIndex));
+
+    /* Verify results - last block written before the trailer */
+    UtAssert_ZERO(DS_AppData.CompressStatus[FileIndex].BlockCount);
+    UtAssert_ZERO(DS_AppData.FileStatus[FileIndex].LogicalSize);
+    UtAssert_UINT32_EQ(DS_AppData.ClosedFiles[FileIndex].TotalSize,
+                       100 + 10 + sizeof(DS_FileBlockHeader_t) + sizeof(DS_FileTrailerFooter_t));
+    UtAssert_STUB_COUNT(OS_lseek, 2);
+    UtAssert_STUB_COUNT(OS_write, 2);
+}
+
+void DS_FileStorageRemember_Test_Ring(void)
+{
+    int32 FileIndex = 0;
+
+    DS_AppData.FileStatus[FileIndex].FileMode              = DS_FILE_MODE_RING;
+    DS_AppData.FileStatus[FileIndex].FileSize              = 10;
+    DS_AppData.DestFileTblPtr->File[FileIndex].MaxFileSize = 2048;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileStorageRemember(FileIndex));
+
+    /* Verify results - ring files are counted at preallocated size */
+    UtAssert_UINT32_EQ(DS_AppData.ClosedFiles[FileIndex].Count, 1);
+    UtAssert_UINT32_EQ(DS_AppData.ClosedFiles[FileIndex].File[0].FileSize, 2048);
+    UtAssert_UINT32_EQ(DS_AppData.ClosedFileBytes, 2048);
+}
+
+void DS_FileStorageRemember_Test_Manifest(void)
+{
+    int32 FileIndex = 0;
+    char  Expected[DS_TOTAL_FNAME_BUFSIZE];
+
+    strncpy(DS_AppData.DestFileTblPtr->File[FileIndex].Movename, "directory2/movename/",
+            sizeof(DS_AppData.DestFileTblPtr->File[FileIndex].Movename));
+    DS_AppData.EnableMoveFiles                      = DS_ENABLED;
+    DS_AppData.FileStatus[FileIndex].ManifestListed = true;
+
+    snprintf(Expected, sizeof(Expected), "directory2/movename/%s", DS_MANIFEST_FILE_NAME);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileStorageRemember(FileIndex));
+
+    /* Verify results -- manifest remembered for the eviction record (none when manifests are disabled) */
+    if (DS_MANIFEST_FILE_NAME[0] == '\0')
+    {
+        UtAssert_ZERO(DS_AppData.ClosedFiles[FileIndex].File[0].ManifestName[0]);
+    }
+    else
+    {
+        UtAssert_STRINGBUF_EQ(DS_AppData.ClosedFiles[FileIndex].File[0].ManifestName,
+                              sizeof(DS_AppData.ClosedFiles[FileIndex].File[0].ManifestName), Expected,
+                              sizeof(Expected));
+    }
+}
+
+void DS_FileStorageRemember_Test_Index(void)
+{
+    int32 FileIndex = 0;
+
+    strncpy(DS_AppData.IndexStatus[FileIndex].FileName, "directory1/filename.idx",
+            sizeof(DS_AppData.IndexStatus[FileIndex].FileName));
+    DS_AppData.IndexStatus[FileIndex].RecordCount = 3;
+    DS_AppData.FileStatus[FileIndex].FileSize     = 100;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileStorageRemember(FileIndex));
+
+    /* Verify results - sidecar index is counted with the data file */
+    UtAssert_UINT32_EQ(DS_AppData.ClosedFiles[FileIndex].File[0].IndexSize,
+                       sizeof(DS_FileIndexHeader_t) + 3 * sizeof(DS_FileIndexRecord_t));
+    UtAssert_UINT32_EQ(DS_AppData.ClosedFiles[FileIndex].TotalSize,
+                       100 + sizeof(DS_FileIndexHeader_t) + 3 * sizeof(DS_FileIndexRecord_t));
+    UtAssert_UINT32_EQ(DS_AppData.ClosedFileBytes, DS_AppData.ClosedFiles[FileIndex].TotalSize);
+}
+
+void DS_FileStorageRemember_Test_HistoryFull(void)
+{
+    int32 FileIndex = 0;
+    int32 i;
+
+    for (i = 0; i < DS_CLOSED_FILE_HISTORY; i++)
+    {
+        DS_AppData.ClosedFiles[FileIndex].File[i].FileSize = 1;
+    }
+
+    DS_AppData.ClosedFiles[FileIndex].Count     = DS_CLOSED_FILE_HISTORY;
+    DS_AppData.ClosedFiles[FileIndex].TotalSize = DS_CLOSED_FILE_HISTORY;
+    DS_AppData.ClosedFileBytes                  = DS_CLOSED_FILE_HISTORY;
+    DS_AppData.FileStatus[FileIndex].FileSize   = 5;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileStorageRemember(FileIndex));
+
+    /* Verify results - oldest is forgotten but not deleted */
+    UtAssert_UINT32_EQ(DS_AppData.ClosedFiles[FileIndex].Count, DS_CLOSED_FILE_HISTORY);
+    UtAssert_UINT32_EQ(DS_AppData.ClosedFiles[FileIndex].Oldest, 1 % DS_CLOSED_FILE_HISTORY);
+    UtAssert_UINT32_EQ(DS_AppData.ClosedFiles[FileIndex].TotalSize, DS_CLOSED_FILE_HISTORY + 4);
+    UtAssert_UINT32_EQ(DS_AppData.ClosedFileBytes, DS_CLOSED_FILE_HISTORY + 4);
+    UtAssert_STUB_COUNT(OS_remove, 0);
+}
+
+void DS_FileStorageEvict_Test_Nominal(void)
+{
+    int32 FileIndex = 1;
+
+    strncpy(DS_AppData.ClosedFiles[FileIndex].File[0].FileName, "directory1/filename",
+            sizeof(DS_AppData.ClosedFiles[FileIndex].File[0].FileName));
+    DS_AppData.ClosedFiles[FileIndex].File[0].FileSize = 100;
+    DS_AppData.ClosedFiles[FileIndex].Count            = 1;
+    DS_AppData.ClosedFiles[FileIndex].TotalSize        = 100;
+    DS_AppData.ClosedFileBytes                         = 100;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileStorageEvict(FileIndex));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_UINT32_EQ(DS_AppData.EvictedFileCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.ClosedFiles[FileIndex].Count, 0);
+    UtAssert_UINT32_EQ(DS_AppData.ClosedFiles[FileIndex].TotalSize, 0);
+    UtAssert_UINT32_EQ(DS_AppData.ClosedFileBytes, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_EVICT_FILE_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+}
+
+void DS_FileStorageEvict_Test_Manifest(void)
+{
+    int32 FileIndex = 1;
+
+    strncpy(DS_AppData.ClosedFiles[FileIndex].File[0].FileName, "directory2/movename/filename",
+            sizeof(DS_AppData.ClosedFiles[FileIndex].File[0].FileName));
+    strncpy(DS_AppData.ClosedFiles[FileIndex].File[0].ManifestName, "directory2/movename/manifest",
+            sizeof(DS_AppData.ClosedFiles[FileIndex].File[0].ManifestName));
+    DS_AppData.ClosedFiles[FileIndex].File[0].FileSize = 100;
+    DS_AppData.ClosedFiles[FileIndex].Count            = 1;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileStorageEvict(FileIndex));
+
+    /* Verify results -- eviction record appended to the manifest */
+    UtAssert_UINT32_EQ(DS_AppData.EvictedFileCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.ManifestCounter, 1);
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_UINT32_EQ(DS_AppData.ClosedFiles[FileIndex].Count, 0);
+}
+
+void DS_FileStorageEvict_Test_RemoveError(void)
+{
+    int32 FileIndex = 1;
+
+    DS_AppData.ClosedFiles[FileIndex].File[0].FileSize = 100;
+    DS_AppData.ClosedFiles[FileIndex].Count            = 1;
+    DS_AppData.ClosedFiles[FileIndex].TotalSize        = 100;
+    DS_AppData.ClosedFileBytes                         = 100;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_remove), OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileStorageEvict(FileIndex));
+
+    /* Verify results - file is forgotten regardless */
+    UtAssert_UINT32_EQ(DS_AppData.EvictedFileCounter, 0);
+    UtAssert_UINT32_EQ(DS_AppData.ClosedFiles[FileIndex].Count, 0);
+    UtAssert_UINT32_EQ(DS_AppData.ClosedFileBytes, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_EVICT_FILE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_FileStorageEvict_Test_Index(void)
+{
+    int32 FileIndex = 1;
+
+    strncpy(DS_AppData.ClosedFiles[FileIndex].File[0].FileName, "directory1/filename",
+            sizeof(DS_AppData.ClosedFiles[FileIndex].File[0].FileName));
+    DS_AppData.ClosedFiles[FileIndex].File[0].FileSize  = 100;
+    DS_AppData.ClosedFiles[FileIndex].File[0].IndexSize = 20;
+    DS_AppData.ClosedFiles[FileIndex].Count             = 1;
+    DS_AppData.ClosedFiles[FileIndex].TotalSize         = 120;
+    DS_AppData.ClosedFileBytes                          = 120;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileStorageEvict(FileIndex));
+
+    /* Verify results - data file and sidecar index are both removed */
+    UtAssert_STUB_COUNT(OS_remove, 2);
+    UtAssert_UINT32_EQ(DS_AppData.EvictedFileCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.ClosedFiles[FileIndex].TotalSize, 0);
+    UtAssert_UINT32_EQ(DS_AppData.ClosedFileBytes, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_EVICT_FILE_INF_EID);
+}
+
+void DS_FileStorageEvict_Test_IndexRemoveError(void)
+{
+    int32 FileIndex = 1;
+
+    DS_AppData.ClosedFiles[FileIndex].File[0].FileSize  = 100;
+    DS_AppData.ClosedFiles[FileIndex].File[0].IndexSize = 20;
+    DS_AppData.ClosedFiles[FileIndex].Count             = 1;
+    DS_AppData.ClosedFiles[FileIndex].TotalSize         = 120;
+    DS_AppData.ClosedFileBytes                          = 120;
+
+    UT_SetDeferredRetcode(UT_KEY(OS_remove), 2, OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileStorageEvict(FileIndex));
+
+    /* Verify results - index is forgotten with its data file */
+    UtAssert_STUB_COUNT(OS_remove, 2);
+    UtAssert_UINT32_EQ(DS_AppData.ClosedFileBytes, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_EVICT_FILE_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, DS_EVICT_FILE_ERR_EID);
+}
+
+void DS_FileStorageEvict_Test_Empty(void)
+{
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileStorageEvict(0));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_remove, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileStorageVictim_Test_LowestPriority(void)
+{
+    DS_AppData.DestFileTblPtr->File[0].StoragePriority = 5;
+    DS_AppData.DestFileTblPtr->File[1].StoragePriority = 2;
+    DS_AppData.ClosedFiles[0].Count                    = 1;
+    DS_AppData.ClosedFiles[0].File[0].CloseSequence    = 0;
+    DS_AppData.ClosedFiles[1].Count                    = 1;
+    DS_AppData.ClosedFiles[1].File[0].CloseSequence    = 3;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FileStorageVictim(5), 1);
+}
+
+void DS_FileStorageVictim_Test_OldestOnTie(void)
+{
+    DS_AppData.DestFileTblPtr->File[0].StoragePriority = 1;
+    DS_AppData.DestFileTblPtr->File[1].StoragePriority = 1;
+    DS_AppData.ClosedFiles[0].Count                    = 1;
+    DS_AppData.ClosedFiles[0].File[0].CloseSequence    = 7;
+    DS_AppData.ClosedFiles[1].Count                    = 1;
+    DS_AppData.ClosedFiles[1].File[0].CloseSequence    = 4;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FileStorageVictim(1), 1);
+}
+
+void DS_FileStorageVictim_Test_HigherPriorityKept(void)
+{
+    DS_AppData.DestFileTblPtr->File[1].StoragePriority = 9;
+    DS_AppData.ClosedFiles[1].Count                    = 1;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_FileStorageVictim(3), DS_INDEX_NONE);
+}
+
+void DS_FileStorageCheck_Test_NoBudget(void)
+{
+    int32 FileIndex = 0;
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].MaxFileSize = 1024;
+    DS_AppData.ClosedFiles[FileIndex].Count                = 1;
+    DS_AppData.ClosedFiles[FileIndex].TotalSize            = 1024 * 1024;
+    DS_AppData.ClosedFileBytes                             = 1024 * 1024;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileStorageCheck(FileIndex));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_remove, 0);
+    UtAssert_UINT32_EQ(DS_AppData.ClosedFiles[FileIndex].Count, 1);
+}
+
+void DS_FileStorageCheck_Test_DestBudget(void)
+{
+    int32 FileIndex = 0;
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].MaxFileSize    = 1024;
+    DS_AppData.DestFileTblPtr->File[FileIndex].MaxStorageSize = 2048;
+    DS_AppData.ClosedFiles[FileIndex].File[0].FileSize        = 1024;
+    DS_AppData.ClosedFiles[FileIndex].File[1].FileSize        = 1024;
+    DS_AppData.ClosedFiles[FileIndex].Count                   = 2;
+    DS_AppData.ClosedFiles[FileIndex].TotalSize               = 2048;
+    DS_AppData.ClosedFileBytes                                = 2048;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileStorageCheck(FileIndex));
+
+    /* Verify results - one file evicted to make room for the new one */
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_UINT32_EQ(DS_AppData.ClosedFiles[FileIndex].Count, 1);
+    UtAssert_UINT32_EQ(DS_AppData.ClosedFiles[FileIndex].Oldest, 1);
+    UtAssert_UINT32_EQ(DS_AppData.ClosedFiles[FileIndex].TotalSize, 1024);
+}
+
+void DS_FileStorageCheck_Test_GlobalBudget(void)
+{
+    int32 FileIndex = 0;
+
+    DS_AppData.StorageBudget = 3072;
+
+    /* Open file on another destination reserves its max size */
+    OS_OpenCreate(&DS_AppData.FileStatus[2].FileHandle, NULL, 0, 0);
+    DS_AppData.DestFileTblPtr->File[2].MaxFileSize = 1024;
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].MaxFileSize     = 1024;
+    DS_AppData.DestFileTblPtr->File[FileIndex].StoragePriority = 3;
+    DS_AppData.DestFileTblPtr->File[1].StoragePriority         = 1;
+    DS_AppData.ClosedFiles[1].File[0].FileSize                 = 1024;
+    DS_AppData.ClosedFiles[1].File[1].FileSize                 = 1024;
+    DS_AppData.ClosedFiles[1].Count                            = 2;
+    DS_AppData.ClosedFiles[1].TotalSize                        = 2048;
+    DS_AppData.ClosedFileBytes                                 = 2048;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileStorageCheck(FileIndex));
+
+    /* Verify results - lower priority destination gives up one file */
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_UINT32_EQ(DS_AppData.ClosedFiles[1].Count, 1);
+    UtAssert_UINT32_EQ(DS_AppData.ClosedFileBytes, 1024);
+    UtAssert_UINT32_EQ(DS_AppData.EvictedFileCounter, 1);
+}
+
+void DS_FileStorageCheck_Test_GlobalBudgetFull(void)
+{
+    int32 FileIndex = 0;
+
+    DS_AppData.StorageBudget = 1024;
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].MaxFileSize = 2048;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileStorageCheck(FileIndex));
+
+    /* Verify results - nothing to evict */
+    UtAssert_STUB_COUNT(OS_remove, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_STORAGE_FULL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_FileTestAge_Test_Nominal(void)
+{
+    int32  FileIndex      = 0;
+    uint32 ElapsedSeconds = 2;
+    uint32 i;
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    for (i = 0; i < DS_DEST_FILE_CNT; i++)
+    {
+        strncpy(DS_AppData.FileStatus[i].FileName, "directory1/filename", sizeof(DS_AppData.FileStatus[i].FileName));
+    }
+
+    DS_AppData.FileStatus[FileIndex].FileAge              = 0;
+    DS_AppData.DestFileTblPtr->File[FileIndex].MaxFileAge = 3;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileTestAge(ElapsedSeconds));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileAge, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileTestAge_Test_NullTable(void)
+{
+    uint32 ElapsedSeconds     = 2;
+    DS_AppData.DestFileTblPtr = NULL;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileTestAge(ElapsedSeconds));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_close, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileTestAge_Test_ExceedMaxAge(void)
+{
+    int32  FileIndex      = 0;
+    uint32 ElapsedSeconds = 2;
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].MaxFileAge = 1;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileTestAge(ElapsedSeconds));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileAge, 0);
+    UtAssert_UINT32_EQ(DS_AppData.DestStats[FileIndex].RolloverCount, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileTestAge_Test_RingCheckpoint(void)
+{
+    int32  FileIndex      = 0;
+    uint32 ElapsedSeconds = 2;
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].MaxFileAge = 1;
+    DS_AppData.FileStatus[FileIndex].FileMode             = DS_FILE_MODE_RING;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileTestAge(ElapsedSeconds));
+
+    /* Verify results - ring file stays open */
+    UtAssert_BOOL_TRUE(OS_ObjectIdDefined(DS_AppData.FileStatus[FileIndex].FileHandle));
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileAge, 0);
+    UtAssert_STUB_COUNT(OS_close, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_IsPacketFiltered_Test_AlgX0(void)
+{
+    CFE_MSG_Message_t Message;
+    uint16            FilterType = 2;
+    uint16            Alg_N      = 0;
+    uint16            Alg_X      = 0;
+    uint16            Alg_O      = 0;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_IsPacketFiltered(&Message, FilterType, Alg_N, Alg_X, Alg_O));
+}
+
+void DS_IsPacketFiltered_Test_AlgN0(void)
+{
+    CFE_MSG_Message_t Message;
+    uint16            FilterType = 2;
+    uint16            Alg_N      = 0;
+    uint16            Alg_X      = 1;
+    uint16            Alg_O      = 0;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_IsPacketFiltered(&Message, FilterType, Alg_N, Alg_X, Alg_O));
+}
+
+void DS_IsPacketFiltered_Test_AlgNGreaterX(void)
+{
+    CFE_MSG_Message_t Message;
+    uint16            FilterType = 2;
+    uint16            Alg_N      = 2;
+    uint16            Alg_X      = 1;
+    uint16            Alg_O      = 0;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_IsPacketFiltered(&Message, FilterType, Alg_N, Alg_X, Alg_O));
+}
+
+void DS_IsPacketFiltered_Test_Alg0GreaterX(void)
+{
+    CFE_MSG_Message_t Message;
+    uint16            FilterType = 2;
+    uint16            Alg_N      = 1;
+    uint16            Alg_X      = 1;
+    uint16            Alg_O      = 2;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_IsPacketFiltered(&Message, FilterType, Alg_N, Alg_X, Alg_O));
+}
+
+void DS_IsPacketFiltered_Test_Alg0EqualX(void)
+{
+    CFE_MSG_Message_t Message;
+    uint16            FilterType = 2;
+    uint16            Alg_N      = 1;
+    uint16            Alg_X      = 1;
+    uint16            Alg_O      = 1;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_IsPacketFiltered(&Message, FilterType, Alg_N, Alg_X, Alg_O));
+}
+
+void DS_IsPacketFiltered_Test_InvalidFilterType(void)
+{
+    CFE_MSG_Message_t Message;
+    uint16            FilterType = 0xff;
+    uint16            Alg_N      = 1;
+    uint16            Alg_X      = 1;
+    uint16            Alg_O      = 0;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_IsPacketFiltered(&Message, FilterType, Alg_N, Alg_X, Alg_O));
+}
+
+void DS_IsPacketFiltered_Test_SeqFilter(void)
+{
+    CFE_MSG_Message_t       Message;
+    CFE_MSG_SequenceCount_t SeqCnt     = 0;
+    uint16                  FilterType = 1;
+    uint16                  Alg_N      = 1;
+    uint16                  Alg_X      = 1;
+    uint16                  Alg_O      = 0;
+
+    memset(&Message, 0, sizeof(Message));
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSequenceCount), &SeqCnt, sizeof(SeqCnt), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_IsPacketFiltered(&Message, FilterType, Alg_N, Alg_X, Alg_O));
+}
+
+void DS_IsPacketFiltered_Test_TimeFilter1(void)
+{
+    CFE_MSG_Message_t  Message;
+    CFE_TIME_SysTime_t PacketTime;
+    uint16             FilterType = 2;
+    uint16             Alg_N      = 1;
+    uint16             Alg_X      = 1;
+    uint16             Alg_O      = 0;
+
+    memset(&Message, 0, sizeof(Message));
+
+    PacketTime.Seconds    = 1;
+    PacketTime.Subseconds = 1;
+
+    /* This packet will be passed by the filter algorithm */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgTime), &PacketTime, sizeof(PacketTime), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_IsPacketFiltered(&Message, FilterType, Alg_N, Alg_X, Alg_O));
+}
+
+void DS_IsPacketFiltered_Test_TimeFilter2(void)
+{
+    CFE_MSG_Message_t  Message;
+    CFE_TIME_SysTime_t PacketTime;
+    uint16             FilterType = 2;
+    uint16             Alg_N      = 2;
+    uint16             Alg_X      = 2;
+    uint16             Alg_O      = 1;
+
+    memset(&Message, 0, sizeof(Message));
+
+    /* Value is less than offset of passed range, this packet will be filtered */
+    PacketTime.Seconds    = 0;
+    PacketTime.Subseconds = 0;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgTime), &PacketTime, sizeof(PacketTime), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_IsPacketFiltered(&Message, FilterType, Alg_N, Alg_X, Alg_O));
+}
+
+void DS_IsPacketFiltered_Test_TimeFilter3(void)
+{
+    CFE_MSG_Message_t  Message;
+    CFE_TIME_SysTime_t PacketTime;
+    uint16             FilterType = 2;
+    uint16             Alg_N      = 3;
+    uint16             Alg_X      = 4;
+    uint16             Alg_O      = 1;
+
+    memset(&Message, 0, sizeof(Message));
+
+    /* This packet will be filtered by the filter algorithm */
+    PacketTime.Seconds    = 3;
+    PacketTime.Subseconds = 0;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgTime), &PacketTime, sizeof(PacketTime), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_IsPacketFiltered(&Message, FilterType, Alg_N, Alg_X, Alg_O));
+}
+
+void DS_DecimateAlgorithmX_Test_Nominal(void)
+{
+    /* Execute the function being tested and verify results */
+    UtAssert_UINT32_EQ(DS_DecimateAlgorithmX(3, DS_PRIORITY_LOW, 0), 3);
+    UtAssert_UINT32_EQ(DS_DecimateAlgorithmX(3, DS_PRIORITY_LOW, 1), 6);
+    UtAssert_UINT32_EQ(DS_DecimateAlgorithmX(3, DS_PRIORITY_LOW, 3), 24);
+    UtAssert_UINT32_EQ(DS_DecimateAlgorithmX(3, DS_PRIORITY_HIGH, 3), 3);
+}
+
+void DS_DecimateAlgorithmX_Test_Zero(void)
+{
+    /* Execute the function being tested and verify results - X = 0 filters all packets at any level */
+    UtAssert_UINT32_EQ(DS_DecimateAlgorithmX(0, DS_PRIORITY_LOW, 3), 0);
+}
+
+void DS_DecimateAlgorithmX_Test_Limit(void)
+{
+    /* Execute the function being tested and verify results */
+    UtAssert_UINT32_EQ(DS_DecimateAlgorithmX(0x9000, DS_PRIORITY_LOW, 1), 0xFFFF);
+}
+
+void DS_IsPacketUnchanged_Test_First(void)
+{
+    UT_DS_TlmPacket_t       Packet;
+    DS_FilterChangeStatus_t ChangeStatus;
+    CFE_MSG_Size_t          forced_Size = sizeof(Packet);
+
+    memset(&ChangeStatus, 0, sizeof(ChangeStatus));
+    UT_DS_SetTlmPacket(&Packet, NULL);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_IsPacketUnchanged((CFE_MSG_Message_t *)&Packet, &ChangeStatus, 10));
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(ChangeStatus.Stored);
+    UtAssert_UINT32_EQ(ChangeStatus.Unchanged, 0);
+    UtAssert_UINT32_EQ(ChangeStatus.Hash, DS_PacketHash(Packet.Payload, sizeof(Packet.Payload),
+                                                        DS_PACKET_HASH_SEED ^ (uint32)sizeof(Packet)));
+}
+
+void DS_IsPacketUnchanged_Test_Unchanged(void)
+{
+    UT_DS_TlmPacket_t       Packet;
+    DS_FilterChangeStatus_t ChangeStatus;
+    CFE_MSG_Size_t          forced_Size = sizeof(Packet);
+
+    UT_DS_SetTlmPacket(&Packet, NULL);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
+
+    ChangeStatus.Stored    = true;
+    ChangeStatus.Unchanged = 3;
+    ChangeStatus.Hash =
+        DS_PacketHash(Packet.Payload, sizeof(Packet.Payload), DS_PACKET_HASH_SEED ^ (uint32)sizeof(Packet));
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_IsPacketUnchanged((CFE_MSG_Message_t *)&Packet, &ChangeStatus, 10));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(ChangeStatus.Unchanged, 4);
+}
+
+void DS_IsPacketUnchanged_Test_Changed(void)
+{
+    UT_DS_TlmPacket_t       Packet;
+    DS_FilterChangeStatus_t ChangeStatus;
+    CFE_MSG_Size_t          forced_Size = sizeof(Packet);
+    uint32                  StoredHash  = 0;
+
+    UT_DS_SetTlmPacket(&Packet, NULL);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
+
+    StoredHash =
+        DS_PacketHash(Packet.Payload, sizeof(Packet.Payload), DS_PACKET_HASH_SEED ^ (uint32)sizeof(Packet));
+    ChangeStatus.Stored    = true;
+    ChangeStatus.Unchanged = 3;
+    ChangeStatus.Hash      = StoredHash;
+
+    /* Only the last payload byte differs */
+    Packet.Payload[sizeof(Packet.Payload) - 1]++;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_IsPacketUnchanged((CFE_MSG_Message_t *)&Packet, &ChangeStatus, 10));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(ChangeStatus.Unchanged, 0);
+    UtAssert_BOOL_TRUE(ChangeStatus.Hash != StoredHash);
+}
+
+void DS_IsPacketUnchanged_Test_Heartbeat(void)
+{
+    UT_DS_TlmPacket_t       Packet;
+    DS_FilterChangeStatus_t ChangeStatus;
+    CFE_MSG_Size_t          forced_Size = sizeof(Packet);
+
+    UT_DS_SetTlmPacket(&Packet, NULL);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
+
+    /* Nine unchanged packets already filtered - the tenth is stored */
+    ChangeStatus.Stored    = true;
+    ChangeStatus.Unchanged = 9;
+    ChangeStatus.Hash =
+        DS_PacketHash(Packet.Payload, sizeof(Packet.Payload), DS_PACKET_HASH_SEED ^ (uint32)sizeof(Packet));
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_IsPacketUnchanged((CFE_MSG_Message_t *)&Packet, &ChangeStatus, 10));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(ChangeStatus.Unchanged, 0);
+}
+
+void DS_IsPacketUnchanged_Test_Command(void)
+{
+    uint8                   Packet[sizeof(CFE_MSG_CommandHeader_t) + 4];
+    DS_FilterChangeStatus_t ChangeStatus;
+    CFE_MSG_Size_t          forced_Size = sizeof(Packet);
+    CFE_MSG_Type_t          forced_Type = CFE_MSG_Type_Cmd;
+
+    memset(Packet, 0xA5, sizeof(Packet));
+    memset(&ChangeStatus, 0, sizeof(ChangeStatus));
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &forced_Type, sizeof(forced_Type), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_IsPacketUnchanged((CFE_MSG_Message_t *)Packet, &ChangeStatus, 10));
+
+    /* Verify results - only the command parameters are hashed */
+    UtAssert_UINT32_EQ(ChangeStatus.Hash, DS_PacketHash(&Packet[sizeof(CFE_MSG_CommandHeader_t)], 4,
+                                                        DS_PACKET_HASH_SEED ^ (uint32)sizeof(Packet)));
+}
+
+void DS_IsPacketUnchanged_Test_HeaderOnly(void)
+{
+    CFE_MSG_TelemetryHeader_t Packet;
+    DS_FilterChangeStatus_t   ChangeStatus;
+    CFE_MSG_Size_t            forced_Size = sizeof(Packet);
+
+    memset(&Packet, 0, sizeof(Packet));
+    memset(&ChangeStatus, 0, sizeof(ChangeStatus));
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_IsPacketUnchanged((CFE_MSG_Message_t *)&Packet, &ChangeStatus, 10));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(ChangeStatus.Hash, DS_PACKET_HASH_SEED ^ (uint32)sizeof(Packet));
+}
+
+void DS_IsPacketInWindow_Test_First(void)
+{
+    CFE_MSG_Message_t       Message;
+    DS_FilterWindowStatus_t WindowStatus;
+    CFE_TIME_SysTime_t      PacketTime = {5, 0};
+
+    memset(&Message, 0, sizeof(Message));
+    memset(&WindowStatus, 0, sizeof(WindowStatus));
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgTime), &PacketTime, sizeof(PacketTime), false);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TIME_Sub2MicroSecs), 250);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_IsPacketInWindow(&Message, &WindowStatus, 250, 3));
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(WindowStatus.Stored);
+    UtAssert_UINT32_EQ(WindowStatus.LastStored, 5000250);
+}
+
+void DS_IsPacketInWindow_Test_Within(void)
+{
+    CFE_MSG_Message_t       Message;
+    DS_FilterWindowStatus_t WindowStatus;
+    CFE_TIME_SysTime_t      PacketTime = {5, 0};
+
+    memset(&Message, 0, sizeof(Message));
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgTime), &PacketTime, sizeof(PacketTime), false);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TIME_Sub2MicroSecs), 249999);
+
+    WindowStatus.Stored     = true;
+    WindowStatus.LastStored = 5000000;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_IsPacketInWindow(&Message, &WindowStatus, 250, 3));
+
+    /* Verify results - window is not restarted by filtered packets */
+    UtAssert_UINT32_EQ(WindowStatus.LastStored, 5000000);
+}
+
+void DS_IsPacketInWindow_Test_Elapsed(void)
+{
+    CFE_MSG_Message_t       Message;
+    DS_FilterWindowStatus_t WindowStatus;
+    CFE_TIME_SysTime_t      PacketTime = {5, 0};
+
+    memset(&Message, 0, sizeof(Message));
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgTime), &PacketTime, sizeof(PacketTime), false);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TIME_Sub2MicroSecs), 250000);
+
+    WindowStatus.Stored     = true;
+    WindowStatus.LastStored = 5000000;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_IsPacketInWindow(&Message, &WindowStatus, 250, 3));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(WindowStatus.LastStored, 5250000);
+}
+
+void DS_IsPacketInWindow_Test_TimeBackwards(void)
+{
+    CFE_MSG_Message_t       Message;
+    DS_FilterWindowStatus_t WindowStatus;
+    CFE_TIME_SysTime_t      PacketTime = {4, 0};
+
+    memset(&Message, 0, sizeof(Message));
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgTime), &PacketTime, sizeof(PacketTime), false);
+
+    WindowStatus.Stored     = true;
+    WindowStatus.LastStored = 5000000;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_IsPacketInWindow(&Message, &WindowStatus, 250, 3));
+
+    /* Verify results - window restarts from the earlier packet */
+    UtAssert_UINT32_EQ(WindowStatus.LastStored, 4000000);
+}
+
+void DS_IsPacketInWindow_Test_LongWindow(void)
+{
+    CFE_MSG_Message_t       Message;
+    DS_FilterWindowStatus_t WindowStatus;
+    CFE_TIME_SysTime_t      PacketTime = {4000, 0};
+
+    memset(&Message, 0, sizeof(Message));
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgTime), &PacketTime, sizeof(PacketTime), false);
+
+    WindowStatus.Stored     = true;
+    WindowStatus.LastStored = 0;
+
+    /* Execute the function being tested - windows longer than the old 34 minute wrap */
+    UtAssert_BOOL_TRUE(DS_IsPacketInWindow(&Message, &WindowStatus, 5, 99));
+
+    /* Verify results - exponent is limited to DS_WINDOW_MAX_EXPONENT */
+    UtAssert_UINT32_EQ(WindowStatus.LastStored, 0);
+}
+
+void DS_IsPacketMatched_Test_NoTerms(void)
+{
+    uint8                Packet[8];
+    DS_PacketPredicate_t Predicate;
+
+    memset(Packet, 0, sizeof(Packet));
+    memset(&Predicate, 0, sizeof(Predicate));
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_IsPacketMatched((CFE_MSG_Message_t *)Packet, &Predicate));
+
+    /* Verify results - packet size is not needed */
+    UtAssert_STUB_COUNT(CFE_MSG_GetSize, 0);
+}
+
+void DS_IsPacketMatched_Test_MatchAll(void)
+{
+    uint8                Packet[8]   = {0, 0, 0, 0, 0x12, 0x34, 0x56, 0x78};
+    size_t               forced_Size = sizeof(Packet);
+    DS_PacketPredicate_t Predicate;
+
+    memset(&Predicate, 0, sizeof(Predicate));
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
+
+    /* Bytes 4-5 masked with 0xFF00 equal 0x1200 */
+    Predicate.TermCount      = 2;
+    Predicate.Term[0].Offset = 4;
+    Predicate.Term[0].End    = 6;
+    Predicate.Term[0].Width  = 2;
+    Predicate.Term[0].Mask   = 0xFF00;
+    Predicate.Term[0].Low    = 0x1200;
+    Predicate.Term[0].Span   = 0;
+    Predicate.Term[1].Offset = 4;
+    Predicate.Term[1].End    = 8;
+    Predicate.Term[1].Width  = 4;
+    Predicate.Term[1].Mask   = 0xFFFFFFFF;
+    Predicate.Term[1].Low    = 0x12345678;
+    Predicate.Term[1].Span   = 0;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_IsPacketMatched((CFE_MSG_Message_t *)Packet, &Predicate));
+
+    /* Same terms with the second one inverted (not equal) */
+    Predicate.Term[1].Invert = true;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_IsPacketMatched((CFE_MSG_Message_t *)Packet, &Predicate));
+}
+
+void DS_IsPacketMatched_Test_MatchAny(void)
+{
+    uint8                Packet[8]   = {0, 0, 0, 0, 0, 0, 0, 0x05};
+    size_t               forced_Size = sizeof(Packet);
+    DS_PacketPredicate_t Predicate;
+
+    memset(&Predicate, 0, sizeof(Predicate));
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
+
+    /* Byte 7 greater than 10, or byte 7 between 4 and 6 */
+    Predicate.TermCount      = 2;
+    Predicate.MatchAny       = true;
+    Predicate.Term[0].Offset = 7;
+    Predicate.Term[0].End    = 8;
+    Predicate.Term[0].Width  = 1;
+    Predicate.Term[0].Mask   = 0xFF;
+    Predicate.Term[0].Low    = 11;
+    Predicate.Term[0].Span   = 0xFFFFFFFF - 11;
+    Predicate.Term[1].Offset = 7;
+    Predicate.Term[1].End    = 8;
+    Predicate.Term[1].Width  = 1;
+    Predicate.Term[1].Mask   = 0xFF;
+    Predicate.Term[1].Low    = 4;
+    Predicate.Term[1].Span   = 2;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_IsPacketMatched((CFE_MSG_Message_t *)Packet, &Predicate));
+
+    /* Neither term is true */
+    Packet[7] = 3;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_IsPacketMatched((CFE_MSG_Message_t *)Packet, &Predicate));
+}
+
+void DS_IsPacketMatched_Test_ShortPacket(void)
+{
+    uint8                Packet[8];
+    size_t               forced_Size = 6;
+    DS_PacketPredicate_t Predicate;
+
+    memset(Packet, 0, sizeof(Packet));
+    memset(&Predicate, 0, sizeof(Predicate));
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
+
+    /* Inverted term would be true for any field value in range */
+    Predicate.TermCount      = 1;
+    Predicate.Term[0].Offset = 4;
+    Predicate.Term[0].End    = 8;
+    Predicate.Term[0].Width  = 4;
+    Predicate.Term[0].Mask   = 0xFFFFFFFF;
+    Predicate.Term[0].Low    = 1;
+    Predicate.Term[0].Invert = true;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_IsPacketMatched((CFE_MSG_Message_t *)Packet, &Predicate));
+}
+
+void DS_PacketHash_Test_Nominal(void)
+{
+    uint8  Data[11];
+    uint32 Hash = 0;
+
+    memset(Data, 0, sizeof(Data));
+    Hash = DS_PacketHash(Data, sizeof(Data), DS_PACKET_HASH_SEED);
+
+    /* Word bytes and tail bytes both change the result */
+    Data[1] = 1;
+    UtAssert_BOOL_TRUE(DS_PacketHash(Data, sizeof(Data), DS_PACKET_HASH_SEED) != Hash);
+    Data[1]  = 0;
+    Data[10] = 1;
+    UtAssert_BOOL_TRUE(DS_PacketHash(Data, sizeof(Data), DS_PACKET_HASH_SEED) != Hash);
+    Data[10] = 0;
+    UtAssert_UINT32_EQ(DS_PacketHash(Data, sizeof(Data), DS_PACKET_HASH_SEED), Hash);
+}
+
+void DS_PacketHash_Test_Empty(void)
+{
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(DS_PacketHash(NULL, 0, DS_PACKET_HASH_SEED), DS_PACKET_HASH_SEED);
+}
+
+void DS_IsPacketOverRate_Test_NoLimit(void)
+{
+    CFE_MSG_Message_t    Message;
+    DS_RateLimitStatus_t RateStatus;
+
+    memset(&Message, 0, sizeof(Message));
+    memset(&RateStatus, 0, sizeof(RateStatus));
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_IsPacketOverRate(&Message, &RateStatus, 0, 0));
+
+    /* Verify results - the time is not read without a limit */
+    UtAssert_STUB_COUNT(CFE_TIME_GetTime, 0);
+    UtAssert_STUB_COUNT(CFE_MSG_GetSize, 0);
+}
+
+void DS_IsPacketOverRate_Test_First(void)
+{
+    CFE_MSG_Message_t    Message;
+    DS_RateLimitStatus_t RateStatus;
+    CFE_TIME_SysTime_t   CurrentTime = {10, 0};
+    CFE_MSG_Size_t       forced_Size = 100;
+
+    memset(&Message, 0, sizeof(Message));
+    memset(&RateStatus, 0, sizeof(RateStatus));
+    UT_SetDataBuffer(UT_KEY(CFE_TIME_GetTime), &CurrentTime, sizeof(CurrentTime), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_IsPacketOverRate(&Message, &RateStatus, 2, 1000));
+
+    /* Verify results - buckets start full, one packet is taken */
+    UtAssert_UINT32_EQ(RateStatus.LastTicks, 10 * DS_RATE_TICKS_PER_SEC);
+    UtAssert_UINT32_EQ(RateStatus.PacketTokens, DS_RATE_TICKS_PER_SEC);
+    UtAssert_UINT32_EQ(RateStatus.ByteTokens / DS_RATE_TICKS_PER_SEC, 900);
+}
+
+void DS_IsPacketOverRate_Test_PacketLimit(void)
+{
+    CFE_MSG_Message_t    Message;
+    DS_RateLimitStatus_t RateStatus;
+    CFE_TIME_SysTime_t   CurrentTime = {10, 0};
+
+    memset(&Message, 0, sizeof(Message));
+    memset(&RateStatus, 0, sizeof(RateStatus));
+    UT_SetDataBuffer(UT_KEY(CFE_TIME_GetTime), &CurrentTime, sizeof(CurrentTime), false);
+
+    /* Bucket is empty and no time has passed */
+    RateStatus.LastTicks    = 10 * DS_RATE_TICKS_PER_SEC;
+    RateStatus.PacketTokens = DS_RATE_TICKS_PER_SEC - 1;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_IsPacketOverRate(&Message, &RateStatus, 2, 0));
+
+    /* Verify results - dropped packets are not taken from the bucket */
+    UtAssert_UINT32_EQ(RateStatus.PacketTokens, DS_RATE_TICKS_PER_SEC - 1);
+    UtAssert_STUB_COUNT(CFE_MSG_GetSize, 0);
+}
+
+void DS_IsPacketOverRate_Test_Refill(void)
+{
+    CFE_MSG_Message_t    Message;
+    DS_RateLimitStatus_t RateStatus;
+    CFE_TIME_SysTime_t   CurrentTime = {10, 0x80000000};
+
+    memset(&Message, 0, sizeof(Message));
+    memset(&RateStatus, 0, sizeof(RateStatus));
+    UT_SetDataBuffer(UT_KEY(CFE_TIME_GetTime), &CurrentTime, sizeof(CurrentTime), false);
+
+    /* Half a second at two packets per second refills exactly one packet */
+    RateStatus.LastTicks    = 10 * DS_RATE_TICKS_PER_SEC;
+    RateStatus.PacketTokens = 0;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_IsPacketOverRate(&Message, &RateStatus, 2, 0));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(RateStatus.LastTicks, (10 * DS_RATE_TICKS_PER_SEC) + (DS_RATE_TICKS_PER_SEC / 2));
+    UtAssert_ZERO(RateStatus.PacketTokens);
+}
+
+void DS_IsPacketOverRate_Test_ByteLimit(void)
+{
+    CFE_MSG_Message_t    Message;
+    DS_RateLimitStatus_t RateStatus;
+    CFE_TIME_SysTime_t   CurrentTime = {10, 0};
+    CFE_MSG_Size_t       forced_Size = 150;
+
+    memset(&Message, 0, sizeof(Message));
+    memset(&RateStatus, 0, sizeof(RateStatus));
+    UT_SetDataBuffer(UT_KEY(CFE_TIME_GetTime), &CurrentTime, sizeof(CurrentTime), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
+
+    /* Full bucket is still smaller than the packet */
+    RateStatus.LastTicks  = 10 * DS_RATE_TICKS_PER_SEC;
+    RateStatus.ByteTokens = 100 * DS_RATE_TICKS_PER_SEC;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_IsPacketOverRate(&Message, &RateStatus, 0, 100));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(RateStatus.ByteTokens, 100 * DS_RATE_TICKS_PER_SEC);
+    UtAssert_ZERO(RateStatus.PacketTokens);
+}
+
+void DS_IsPacketOverRate_Test_LimitLowered(void)
+{
+    CFE_MSG_Message_t    Message;
+    DS_RateLimitStatus_t RateStatus;
+    CFE_TIME_SysTime_t   CurrentTime = {10, 0};
+
+    memset(&Message, 0, sizeof(Message));
+    memset(&RateStatus, 0, sizeof(RateStatus));
+    UT_SetDataBuffer(UT_KEY(CFE_TIME_GetTime), &CurrentTime, sizeof(CurrentTime), false);
+
+    /* Tokens left over from a higher limit are cut to one second of the new limit */
+    RateStatus.LastTicks    = 10 * DS_RATE_TICKS_PER_SEC;
+    RateStatus.PacketTokens = 50 * DS_RATE_TICKS_PER_SEC;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_IsPacketOverRate(&Message, &RateStatus, 1, 0));
+
+    /* Verify results */
+    UtAssert_ZERO(RateStatus.PacketTokens);
+}
+
+void DS_IsPacketOverRate_Test_TimeBackwards(void)
+{
+    CFE_MSG_Message_t    Message;
+    DS_RateLimitStatus_t RateStatus;
+    CFE_TIME_SysTime_t   CurrentTime = {5, 0};
+
+    memset(&Message, 0, sizeof(Message));
+    memset(&RateStatus, 0, sizeof(RateStatus));
+    UT_SetDataBuffer(UT_KEY(CFE_TIME_GetTime), &CurrentTime, sizeof(CurrentTime), false);
+
+    RateStatus.LastTicks = 10 * DS_RATE_TICKS_PER_SEC;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_IsPacketOverRate(&Message, &RateStatus, 1, 0));
+
+    /* Verify results - no refill, refills start again from the new time */
+    UtAssert_UINT32_EQ(RateStatus.LastTicks, 5 * DS_RATE_TICKS_PER_SEC);
+    UtAssert_ZERO(RateStatus.PacketTokens);
+}
+
+void DS_FileEchoRecord_Test_Nominal(void)
+{
+    DS_EchoTable_t          EchoTable;
+    CFE_MSG_Message_t       Message;
+    CFE_SB_MsgId_t          forced_MsgID         = DS_UT_MID_1;
+    CFE_MSG_SequenceCount_t forced_SequenceCount = 7;
+    CFE_TIME_SysTime_t      Met                  = {30, 0};
+
+    memset(&EchoTable, 0, sizeof(EchoTable));
+    memset(&Message, 0, sizeof(Message));
+    EchoTable.MutexId    = DS_UT_OBJID_1;
+    EchoTable.SentCount  = DS_ECHO_DEPTH + 1;
+    EchoTable.MatchCount = DS_ECHO_DEPTH + 1;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &forced_MsgID, sizeof(forced_MsgID), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSequenceCount), &forced_SequenceCount, sizeof(forced_SequenceCount), false);
+    UT_SetHandlerFunction(UT_KEY(CFE_MSG_GetSize), UT_CFE_MSG_GetSize_CustomHandler, NULL);
+    UT_DS_MsgSize = 64;
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CalculateCRC), 0x1234);
+    UT_SetDataBuffer(UT_KEY(CFE_TIME_GetMET), &Met, sizeof(Met), false);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileEchoRecord(&EchoTable, &Message));
+
+    /* Verify results - entries are reused round robin */
+    UtAssert_UINT32_EQ(EchoTable.SentCount, DS_ECHO_DEPTH + 2);
+    UtAssert_UINT32_EQ(EchoTable.MatchCount, DS_ECHO_DEPTH + 1);
+    UtAssert_BOOL_TRUE(EchoTable.Entry[1 % DS_ECHO_DEPTH].Pending);
+    UtAssert_BOOL_TRUE(CFE_SB_MsgId_Equal(EchoTable.Entry[1 % DS_ECHO_DEPTH].MessageID, DS_UT_MID_1));
+    UtAssert_UINT32_EQ(EchoTable.Entry[1 % DS_ECHO_DEPTH].SequenceCount, 7);
+    UtAssert_UINT32_EQ(EchoTable.Entry[1 % DS_ECHO_DEPTH].PacketLength, 64);
+    UtAssert_UINT32_EQ(EchoTable.Entry[1 % DS_ECHO_DEPTH].PacketCrc, 0x1234);
+    UtAssert_UINT32_EQ(EchoTable.Entry[1 % DS_ECHO_DEPTH].SentSeconds, 30);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 1);
+}
+
+void DS_FileEchoRecord_Test_Overwrite(void)
+{
+    DS_EchoTable_t    EchoTable;
+    CFE_MSG_Message_t Message;
+
+    memset(&EchoTable, 0, sizeof(EchoTable));
+    memset(&Message, 0, sizeof(Message));
+    EchoTable.SentCount        = DS_ECHO_DEPTH;
+    EchoTable.MatchCount       = DS_ECHO_DEPTH - 1;
+    EchoTable.Entry[0].Pending = true;
+
+    /* Execute the function being tested - oldest packet never came back */
+    UtAssert_VOIDCALL(DS_FileEchoRecord(&EchoTable, &Message));
+
+    /* Verify results - overwritten packet is forgotten, new packet is pending */
+    UtAssert_UINT32_EQ(EchoTable.SentCount, DS_ECHO_DEPTH + 1);
+    UtAssert_UINT32_EQ(EchoTable.MatchCount, DS_ECHO_DEPTH);
+    UtAssert_BOOL_TRUE(EchoTable.Entry[0].Pending);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 0);
+}
+
+void DS_IsPacketEcho_Test_Match(void)
+{
+    DS_EchoTable_t          EchoTable;
+    CFE_MSG_Message_t       Message;
+    CFE_SB_MsgId_t          forced_MsgID         = DS_UT_MID_1;
+    CFE_MSG_SequenceCount_t forced_SequenceCount = 7;
+
+    memset(&EchoTable, 0, sizeof(EchoTable));
+    memset(&Message, 0, sizeof(Message));
+    EchoTable.MutexId = DS_UT_OBJID_1;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &forced_MsgID, sizeof(forced_MsgID), false);
+    UT_SetHandlerFunction(UT_KEY(CFE_MSG_GetSize), UT_CFE_MSG_GetSize_CustomHandler, NULL);
+    UT_DS_MsgSize = 64;
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CalculateCRC), 0x1234);
+
+    /* A replayed packet is recorded before it is sent */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSequenceCount), &forced_SequenceCount, sizeof(forced_SequenceCount), false);
+    DS_FileEchoRecord(&EchoTable, &Message);
+
+    /* Execute the function being tested - packet comes back through the pipe */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSequenceCount), &forced_SequenceCount, sizeof(forced_SequenceCount), false);
+    UtAssert_BOOL_TRUE(DS_IsPacketEcho(&EchoTable, DS_UT_MID_1, &Message));
+
+    /* Verify results - each sent packet is matched once */
+    UtAssert_UINT32_EQ(EchoTable.MatchCount, 1);
+    UtAssert_BOOL_FALSE(EchoTable.Entry[0].Pending);
+    UtAssert_BOOL_FALSE(DS_IsPacketEcho(&EchoTable, DS_UT_MID_1, &Message));
+    UtAssert_STUB_COUNT(OS_MutSemTake, 3);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 3);
+}
+
+void DS_IsPacketEcho_Test_NoMatch(void)
+{
+    DS_EchoTable_t          EchoTable;
+    CFE_MSG_Message_t       Message;
+    CFE_MSG_SequenceCount_t forced_SequenceCount = 8;
+
+    memset(&EchoTable, 0, sizeof(EchoTable));
+    memset(&Message, 0, sizeof(Message));
+    EchoTable.SentCount              = 1;
+    EchoTable.Entry[0].MessageID     = DS_UT_MID_1;
+    EchoTable.Entry[0].SequenceCount = 7;
+    EchoTable.Entry[0].Pending       = true;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSequenceCount), &forced_SequenceCount, sizeof(forced_SequenceCount), false);
+
+    /* Execute the function being tested - live packet, same MID */
+    UtAssert_BOOL_FALSE(DS_IsPacketEcho(&EchoTable, DS_UT_MID_1, &Message));
+
+    /* Verify results */
+    UtAssert_ZERO(EchoTable.MatchCount);
+    UtAssert_BOOL_TRUE(EchoTable.Entry[0].Pending);
+    UtAssert_STUB_COUNT(CFE_ES_CalculateCRC, 0);
+}
+
+void DS_IsPacketEcho_Test_SequenceCollision(void)
+{
+    DS_EchoTable_t          EchoTable;
+    CFE_MSG_Message_t       Message;
+    CFE_MSG_SequenceCount_t forced_SequenceCount = 7;
+
+    memset(&EchoTable, 0, sizeof(EchoTable));
+    memset(&Message, 0, sizeof(Message));
+    EchoTable.SentCount              = 2;
+    EchoTable.Entry[0].MessageID     = DS_UT_MID_1;
+    EchoTable.Entry[0].SequenceCount = 7;
+    EchoTable.Entry[0].PacketLength  = 64;
+    EchoTable.Entry[0].PacketCrc     = 0x1234;
+    EchoTable.Entry[0].Pending       = true;
+    EchoTable.Entry[1]               = EchoTable.Entry[0];
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSequenceCount), &forced_SequenceCount, sizeof(forced_SequenceCount), false);
+    UT_SetHandlerFunction(UT_KEY(CFE_MSG_GetSize), UT_CFE_MSG_GetSize_CustomHandler, NULL);
+    UT_DS_MsgSize = 64;
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CalculateCRC), 0x5678);
+
+    /* Execute the function being tested - live packet, same MID and sequence count */
+    UtAssert_BOOL_FALSE(DS_IsPacketEcho(&EchoTable, DS_UT_MID_1, &Message));
+
+    /* Verify results - live packet is stored, CRC computed once for both entries */
+    UtAssert_ZERO(EchoTable.MatchCount);
+    UtAssert_BOOL_TRUE(EchoTable.Entry[0].Pending);
+    UtAssert_BOOL_TRUE(EchoTable.Entry[1].Pending);
+    UtAssert_STUB_COUNT(CFE_ES_CalculateCRC, 1);
+}
+
+void DS_IsPacketEcho_Test_Expired(void)
+{
+    DS_EchoTable_t     EchoTable;
+    CFE_MSG_Message_t  Message;
+    CFE_TIME_SysTime_t Met = {DS_ECHO_TIMEOUT + 10, 0};
+
+    memset(&EchoTable, 0, sizeof(EchoTable));
+    memset(&Message, 0, sizeof(Message));
+    EchoTable.SentCount            = 2;
+    EchoTable.Entry[0].SentSeconds = 10;
+    EchoTable.Entry[0].Pending     = true;
+    EchoTable.Entry[1].SentSeconds = 11;
+    EchoTable.Entry[1].Pending     = true;
+
+    UT_SetDataBuffer(UT_KEY(CFE_TIME_GetMET), &Met, sizeof(Met), false);
+
+    /* Execute the function being tested - first packet never came back */
+    UtAssert_BOOL_FALSE(DS_IsPacketEcho(&EchoTable, DS_UT_MID_2, &Message));
+
+    /* Verify results - only the expired entry is cleared */
+    UtAssert_UINT32_EQ(EchoTable.MatchCount, 1);
+    UtAssert_BOOL_FALSE(EchoTable.Entry[0].Pending);
+    UtAssert_BOOL_TRUE(EchoTable.Entry[1].Pending);
+}
+
+void DS_IsPacketEcho_Test_NonePending(void)
+{
+    DS_EchoTable_t    EchoTable;
+    CFE_MSG_Message_t Message;
+
+    memset(&EchoTable, 0, sizeof(EchoTable));
+    memset(&Message, 0, sizeof(Message));
+    EchoTable.SentCount  = 5;
+    EchoTable.MatchCount = 5;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_IsPacketEcho(&EchoTable, DS_UT_MID_1, &Message));
+
+    /* Verify results - table is not searched */
+    UtAssert_STUB_COUNT(CFE_MSG_GetSequenceCount, 0);
+    UtAssert_STUB_COUNT(CFE_TIME_GetMET, 0);
+}
+
+void DS_FileTransmit_Test_Nominal(void)
+{
+    DS_FileCompletePkt_t  PktBuf;
+    DS_FileCompletePkt_t *PktBufPtr = &PktBuf;
+
+    /* setup for a call to CFE_SB_AllocateMessageBuffer() */
+    memset(PktBufPtr, 0, sizeof(*PktBufPtr));
+    UT_SetDataBuffer(UT_KEY(CFE_SB_AllocateMessageBuffer), &PktBufPtr, sizeof(PktBufPtr), true);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileTransmit(&DS_AppData.FileStatus[0]));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_SB_AllocateMessageBuffer, 1);
+    UtAssert_STUB_COUNT(CFE_MSG_Init, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 1);
+}
+
+void DS_FileTransmit_Test_NoBuf(void)
+{
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileTransmit(&DS_AppData.FileStatus[0]));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_SB_AllocateMessageBuffer, 1);
+    UtAssert_STUB_COUNT(CFE_MSG_Init, 0);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 0);
+}
+
+void DS_FileTransmitDestStats_Test_Nominal(void)
+{
+    DS_DestStatsPkt_t  PktBuf;
+    DS_DestStatsPkt_t *PktBufPtr = &PktBuf;
+
+    DS_AppData.DestStats[DS_DEST_FILE_CNT - 1].PacketCount = 5;
+    DS_AppData.DestStats[DS_DEST_FILE_CNT - 1].ErrorCount  = 6;
+
+    /* setup for a call to CFE_SB_AllocateMessageBuffer() */
+    memset(PktBufPtr, 0, sizeof(*PktBufPtr));
+    UT_SetDataBuffer(UT_KEY(CFE_SB_AllocateMessageBuffer), &PktBufPtr, sizeof(PktBufPtr), true);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileTransmitDestStats());
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(PktBuf.Payload[DS_DEST_FILE_CNT - 1].PacketCount, 5);
+    UtAssert_UINT32_EQ(PktBuf.Payload[DS_DEST_FILE_CNT - 1].ErrorCount, 6);
+    UtAssert_STUB_COUNT(CFE_MSG_Init, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 1);
+}
+
+void DS_FileTransmitDestStats_Test_NoBuf(void)
+{
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileTransmitDestStats());
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_SB_AllocateMessageBuffer, 1);
+    UtAssert_STUB_COUNT(CFE_MSG_Init, 0);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 0);
+}
+
+void DS_FileManifestName_Test_Nominal(void)
+{
+    int32 FileIndex = 0;
+    char  ManifestName[DS_TOTAL_FNAME_BUFSIZE];
+    char  Expected[DS_TOTAL_FNAME_BUFSIZE];
+
+    strncpy(DS_AppData.DestFileTblPtr->File[FileIndex].Movename, "directory2/movename/",
+            sizeof(DS_AppData.DestFileTblPtr->File[FileIndex].Movename));
+    DS_AppData.EnableMoveFiles = DS_ENABLED;
+
+    snprintf(Expected, sizeof(Expected), "directory2/movename/%s", DS_MANIFEST_FILE_NAME);
+
+    /* Execute the function being tested -- an empty manifest name disables manifests */
+    if (DS_MANIFEST_FILE_NAME[0] == '\0')
+    {
+        UtAssert_BOOL_FALSE(DS_FileManifestName(FileIndex, ManifestName, sizeof(ManifestName)));
+    }
+    else
+    {
+        UtAssert_BOOL_TRUE(DS_FileManifestName(FileIndex, ManifestName, sizeof(ManifestName)));
+        UtAssert_STRINGBUF_EQ(ManifestName, sizeof(ManifestName), Expected, sizeof(Expected));
+    }
+}
+
+void DS_FileManifestName_Test_MoveDisabled(void)
+{
+    int32 FileIndex = 0;
+    char  ManifestName[DS_TOTAL_FNAME_BUFSIZE];
+
+    strncpy(DS_AppData.DestFileTblPtr->File[FileIndex].Movename, "directory2/movename/",
+            sizeof(DS_AppData.DestFileTblPtr->File[FileIndex].Movename));
+    DS_AppData.EnableMoveFiles = DS_DISABLED;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_FileManifestName(FileIndex, ManifestName, sizeof(ManifestName)));
+}
+
+void DS_FileManifestName_Test_NoMovename(void)
+{
+    int32 FileIndex = 0;
+    char  ManifestName[DS_TOTAL_FNAME_BUFSIZE];
+
+    DS_AppData.EnableMoveFiles = DS_ENABLED;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_FileManifestName(FileIndex, ManifestName, sizeof(ManifestName)));
+}
+
+void DS_FileManifestName_Test_TooLong(void)
+{
+    int32 FileIndex = 0;
+    char  ManifestName[8];
+
+    strncpy(DS_AppData.DestFileTblPtr->File[FileIndex].Movename, "directory2/movename/",
+            sizeof(DS_AppData.DestFileTblPtr->File[FileIndex].Movename));
+    DS_AppData.EnableMoveFiles = DS_ENABLED;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_FileManifestName(FileIndex, ManifestName, sizeof(ManifestName)));
+}
+
+void DS_FileManifestAppend_Test_Nominal(void)
+{
+    int32 FileIndex = 0;
+
+    strncpy(DS_AppData.DestFileTblPtr->File[FileIndex].Movename, "directory2/movename/",
+            sizeof(DS_AppData.DestFileTblPtr->File[FileIndex].Movename));
+    DS_AppData.EnableMoveFiles = DS_ENABLED;
+
+    if (DS_MANIFEST_FILE_NAME[0] == '\0')
+    {
+        UtAssert_MIR("DS_MANIFEST_FILE_NAME is empty, manifest append is disabled");
+        UtAssert_VOIDCALL(DS_FileManifestAppend(FileIndex, "directory2/movename/filename"));
+        UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+        return;
+    }
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileManifestAppend(FileIndex, "directory2/movename/filename"));
+
+    /* Verify results -- record appended at the end of the manifest, which stays open */
+    UtAssert_UINT32_EQ(DS_AppData.ManifestCounter, 1);
+    UtAssert_BOOL_TRUE(DS_AppData.FileStatus[FileIndex].ManifestListed);
+    UtAssert_BOOL_TRUE(OS_ObjectIdDefined(DS_AppData.Manifest[FileIndex].Handle));
+    UtAssert_STUB_COUNT(OS_lseek, 1);
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_STUB_COUNT(OS_close, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+    /* Execute the function being tested -- next append reuses the handle */
+    UtAssert_VOIDCALL(DS_FileManifestAppend(FileIndex, "directory2/movename/filename2"));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.ManifestCounter, 2);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(OS_lseek, 1);
+    UtAssert_STUB_COUNT(OS_write, 2);
+    UtAssert_STUB_COUNT(OS_close, 0);
+}
+
+void DS_FileManifestAppend_Test_PartialTail(void)
+{
+    int32 FileIndex = 0;
+
+    strncpy(DS_AppData.DestFileTblPtr->File[FileIndex].Movename, "directory2/movename/",
+            sizeof(DS_AppData.DestFileTblPtr->File[FileIndex].Movename));
+    DS_AppData.EnableMoveFiles = DS_ENABLED;
+
+    if (DS_MANIFEST_FILE_NAME[0] == '\0')
+    {
+        UtAssert_MIR("DS_MANIFEST_FILE_NAME is empty, manifest append is disabled");
+        return;
+    }
+
+    /* One complete record and part of another */
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, sizeof(DS_FileManifestRecord_t) + 4);
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, sizeof(DS_FileManifestRecord_t));
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileManifestAppend(FileIndex, "directory2/movename/filename"));
+
+    /* Verify results -- partial record overwritten */
+    UtAssert_UINT32_EQ(DS_AppData.ManifestCounter, 1);
+    UtAssert_STUB_COUNT(OS_lseek, 2);
+    UtAssert_STUB_COUNT(OS_write, 1);
+}
+
+void DS_FileManifestAppend_Test_WriteError(void)
+{
+    int32 FileIndex = 0;
+
+    strncpy(DS_AppData.DestFileTblPtr->File[FileIndex].Movename, "directory2/movename/",
+            sizeof(DS_AppData.DestFileTblPtr->File[FileIndex].Movename));
+    DS_AppData.EnableMoveFiles = DS_ENABLED;
+
+    if (DS_MANIFEST_FILE_NAME[0] == '\0')
+    {
+        UtAssert_MIR("DS_MANIFEST_FILE_NAME is empty, manifest append is disabled");
+        return;
+    }
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileManifestAppend(FileIndex, "directory2/movename/filename"));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.ManifestCounter, 0);
+    UtAssert_UINT32_EQ(DS_AppData.ManifestErrCounter, 1);
+    UtAssert_BOOL_FALSE(DS_AppData.FileStatus[FileIndex].ManifestListed);
+    UtAssert_STUB_COUNT(OS_close, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_MANIFEST_FILE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_FileManifestEvict_Test_Nominal(void)
+{
+    int32            FileIndex  = 1;
+    DS_ClosedFile_t *ClosedFile = &DS_AppData.ClosedFiles[FileIndex].File[0];
+
+    strncpy(ClosedFile->FileName, "directory2/movename/filename", sizeof(ClosedFile->FileName));
+    strncpy(ClosedFile->ManifestName, "directory2/movename/manifest", sizeof(ClosedFile->ManifestName));
+    ClosedFile->FileSize = 100;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileManifestEvict(FileIndex, ClosedFile));
+
+    /* Verify results -- record appended to the manifest that listed the file */
+    UtAssert_UINT32_EQ(DS_AppData.ManifestCounter, 1);
+    UtAssert_STRINGBUF_EQ(DS_AppData.Manifest[FileIndex].Name, sizeof(DS_AppData.Manifest[FileIndex].Name),
+                          ClosedFile->ManifestName, sizeof(ClosedFile->ManifestName));
+    UtAssert_STUB_COUNT(CFE_TIME_GetTime, 1);
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileManifestWrite_Test_Shared(void)
+{
+    DS_FileManifestRecord_t Record;
+
+    memset(&Record, 0, sizeof(Record));
+
+    /* Another destination already has the manifest open */
+    DS_AppData.Manifest[2].Handle = DS_UT_OBJID_1;
+    strncpy(DS_AppData.Manifest[2].Name, "directory2/movename/manifest", sizeof(DS_AppData.Manifest[2].Name));
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_FileManifestWrite(0, "directory2/movename/manifest", &Record));
+
+    /* Verify results -- written through the open handle */
+    UtAssert_UINT32_EQ(DS_AppData.ManifestCounter, 1);
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(DS_AppData.Manifest[0].Handle));
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+    UtAssert_STUB_COUNT(OS_lseek, 0);
+    UtAssert_STUB_COUNT(OS_write, 1);
+}
+
+void DS_FileManifestWrite_Test_Replace(void)
+{
+    DS_FileManifestRecord_t Record;
+
+    memset(&Record, 0, sizeof(Record));
+
+    /* Destination opened the manifest of its previous Movename */
+    DS_AppData.Manifest[0].Handle = DS_UT_OBJID_1;
+    strncpy(DS_AppData.Manifest[0].Name, "directory1/movename/manifest", sizeof(DS_AppData.Manifest[0].Name));
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_FileManifestWrite(0, "directory2/movename/manifest", &Record));
+
+    /* Verify results -- previous manifest closed, new one opened */
+    UtAssert_UINT32_EQ(DS_AppData.ManifestCounter, 1);
+    UtAssert_STRINGBUF_EQ(DS_AppData.Manifest[0].Name, sizeof(DS_AppData.Manifest[0].Name),
+                          "directory2/movename/manifest", sizeof("directory2/movename/manifest"));
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(OS_write, 1);
+}
+
+void DS_FileManifestWrite_Test_OpenError(void)
+{
+    DS_FileManifestRecord_t Record;
+
+    memset(&Record, 0, sizeof(Record));
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_FileManifestWrite(0, "directory2/movename/manifest", &Record));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.ManifestErrCounter, 1);
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(DS_AppData.Manifest[0].Handle));
+    UtAssert_STUB_COUNT(OS_write, 0);
+    UtAssert_STUB_COUNT(OS_close, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_MANIFEST_FILE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_FileManifestWrite_Test_WriteError(void)
+{
+    DS_FileManifestRecord_t Record;
+
+    memset(&Record, 0, sizeof(Record));
+
+    DS_AppData.Manifest[0].Handle = DS_UT_OBJID_1;
+    strncpy(DS_AppData.Manifest[0].Name, "directory2/movename/manifest", sizeof(DS_AppData.Manifest[0].Name));
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), 4);
+
+    /* Execute the function being tested -- short write */
+    UtAssert_BOOL_FALSE(DS_FileManifestWrite(0, "directory2/movename/manifest", &Record));
+
+    /* Verify results -- closed so the next append trims the partial record */
+    UtAssert_UINT32_EQ(DS_AppData.ManifestErrCounter, 1);
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(DS_AppData.Manifest[0].Handle));
+    UtAssert_STUB_COUNT(OS_close, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_MANIFEST_FILE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_FileTransmitManifest_Test_Nominal(void)
+{
+    DS_ManifestPkt_t  PktBuf;
+    DS_ManifestPkt_t *PktBufPtr = &PktBuf;
+    os_fstat_t        FileStats;
+
+    DS_AppData.ManifestCounter    = 3;
+    DS_AppData.ManifestErrCounter = 1;
+
+    /* Two complete records and part of another */
+    memset(&FileStats, 0, sizeof(FileStats));
+    FileStats.FileSize = (2 * sizeof(DS_FileManifestRecord_t)) + 4;
+    UT_SetDataBuffer(UT_KEY(OS_stat), &FileStats, sizeof(FileStats), false);
+
+    /* setup for a call to CFE_SB_AllocateMessageBuffer() */
+    memset(PktBufPtr, 0, sizeof(*PktBufPtr));
+    UT_SetDataBuffer(UT_KEY(CFE_SB_AllocateMessageBuffer), &PktBufPtr, sizeof(PktBufPtr), true);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileTransmitManifest(1, "directory2/manifest"));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(PktBuf.Payload.FileTableIndex, 1);
+    UtAssert_UINT32_EQ(PktBuf.Payload.RecordCount, 2);
+    UtAssert_UINT32_EQ(PktBuf.Payload.RecordSize, sizeof(DS_FileManifestRecord_t));
+    UtAssert_UINT32_EQ(PktBuf.Payload.AppendCount, 3);
+    UtAssert_UINT32_EQ(PktBuf.Payload.AppendErrCount, 1);
+    UtAssert_STRINGBUF_EQ(PktBuf.Payload.ManifestName, sizeof(PktBuf.Payload.ManifestName), "directory2/manifest",
+                          -1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 1);
+}
+
+void DS_FileTransmitManifest_Test_NoBuf(void)
+{
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileTransmitManifest(1, "directory2/manifest"));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_SB_AllocateMessageBuffer, 1);
+    UtAssert_STUB_COUNT(OS_stat, 0);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 0);
+}
+
+/* Packet buffer for flight recorder tests, larger than any command buffer */
+uint32 UT_DS_RecorderPacket[1024];
+
+void UT_DS_RecorderStore(uint16 RecorderIndex, uint32 PacketNumber, size_t PacketLength)
+{
+    UT_DS_RecorderPacket[0] = PacketNumber;
+    UT_DS_MsgSize           = PacketLength;
+
+    DS_FileRecorderStore(RecorderIndex, (const CFE_SB_Buffer_t *)UT_DS_RecorderPacket, 0);
+}
+
+void DS_FileStorePacket_Test_Recorder(void)
+{
+    CFE_SB_MsgId_t MessageID = DS_UT_MID_1;
+    DS_HashLink_t  HashLink;
+
+    UT_DS_MsgSize = sizeof(DS_NoopCmd_t);
+    UT_SetHandlerFunction(UT_KEY(CFE_MSG_GetSize), &UT_CFE_MSG_GetSize_CustomHandler, NULL);
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableFindMsgID), 0);
+
+    DS_AppData.DestFileTblPtr->File[0].MaxFileSize = sizeof(DS_NoopCmd_t) * 2;
+
+    DS_AppData.HashTable[187]                                   = &HashLink;
+    HashLink.Index                                              = 0;
+    DS_AppData.FilterTblPtr->Packet[0].MessageID                = DS_UT_MID_1;
+    DS_AppData.FilterTblPtr->Packet[0].Filter[0].Algorithm_N    = 1;
+    DS_AppData.FilterTblPtr->Packet[0].Filter[0].Algorithm_X    = 3;
+    DS_AppData.FilterTblPtr->Packet[0].Filter[0].Algorithm_O    = 0;
+    DS_AppData.FilterTblPtr->Packet[0].Filter[0].FilterType     = 1;
+    DS_AppData.FilterTblPtr->Packet[0].Filter[0].FileTableIndex = 0;
+    DS_AppData.FileStatus[0].FileState                          = DS_ENABLED;
+    DS_AppData.Recorder[0].State                                = DS_RECORDER_HOLDING;
+    DS_AppData.DestRecorder[0]                                  = 1;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileStorePacket(MessageID, &UT_CmdBuf.Buf));
+
+    /* Verify results -- held in memory, nothing written */
+    UtAssert_UINT32_EQ(DS_AppData.PassedPktCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.Recorder[0].Head, DS_RECORDER_RECORD_SIZE(sizeof(DS_NoopCmd_t)));
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+    UtAssert_STUB_COUNT(OS_write, 0);
+}
+
+void DS_FileStorePacket_Test_Cache(void)
+{
+    CFE_SB_MsgId_t MessageID = DS_UT_MID_1;
+
+    UT_DS_MsgSize = sizeof(DS_NoopCmd_t);
+    UT_SetHandlerFunction(UT_KEY(CFE_MSG_GetSize), &UT_CFE_MSG_GetSize_CustomHandler, NULL);
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableFindMsgID), 2);
+
+    /* Execute the function being tested -- no destination is enabled */
+    UtAssert_VOIDCALL(DS_FileStorePacket(MessageID, &UT_CmdBuf.Buf));
+
+    /* Verify results -- cached even though the packet is not stored (unless the cache is disabled) */
+    if (DS_CACHE_ENTRIES == 0)
+    {
+        UtAssert_ZERO(DS_AppData.CacheCount);
+        UtAssert_ZERO(DS_AppData.Cache[0].PacketLength);
+    }
+    else
+    {
+        UtAssert_UINT32_EQ(DS_AppData.CacheCount, 1);
+        UtAssert_UINT32_EQ(DS_AppData.Cache[0].PacketLength, sizeof(DS_NoopCmd_t));
+        UtAssert_BOOL_TRUE(CFE_SB_MsgId_Equal(DS_AppData.Cache[0].MessageID, DS_UT_MID_1));
+    }
+    UtAssert_STUB_COUNT(OS_write, 0);
+}
+
+void DS_FileRecorderRoom_Test_ExactFit(void)
+{
+    DS_RecorderStatus_t *Recorder = &DS_AppData.Recorder[0];
+    uint32               Offset   = 1;
+
+    /* Filling the buffer end with an empty buffer start would make the ring look empty */
+    Recorder->Head = DS_RECORDER_BUFFER_SIZE - 1004;
+    Recorder->Tail = 0;
+    UtAssert_BOOL_FALSE(DS_FileRecorderRoom(Recorder, 1004, &Offset));
+
+    Recorder->Tail = 4;
+    UtAssert_BOOL_TRUE(DS_FileRecorderRoom(Recorder, 1004, &Offset));
+    UtAssert_UINT32_EQ(Offset, DS_RECORDER_BUFFER_SIZE - 1004);
+
+    /* Head may not catch up with Tail */
+    Recorder->Head = 0;
+    Recorder->Tail = 1004;
+    UtAssert_BOOL_FALSE(DS_FileRecorderRoom(Recorder, 1004, &Offset));
+
+    Recorder->Tail = 1008;
+    UtAssert_BOOL_TRUE(DS_FileRecorderRoom(Recorder, 1004, &Offset));
+    UtAssert_ZERO(Offset);
+}
+
+void DS_FileRecorderStore_Test_Holding(void)
+{
+    DS_RecorderStatus_t *      Recorder = &DS_AppData.Recorder[0];
+    const DS_RecorderRecord_t *Record   = NULL;
+    uint32                     Oldest   = 0;
+    uint32                     Held     = 0;
+    uint32                     i;
+
+    UT_SetHandlerFunction(UT_KEY(CFE_MSG_GetSize), &UT_CFE_MSG_GetSize_CustomHandler, NULL);
+
+    Recorder->State = DS_RECORDER_HOLDING;
+
+    /* Execute the function being tested -- several times the buffer size */
+    for (i = 0; i < 200; i++)
+    {
+        UT_DS_RecorderStore(0, i, 1000);
+    }
+
+    /* Verify results -- the newest packets replaced the oldest, none lost */
+    UtAssert_ZERO(DS_AppData.RecorderDropCounter);
+
+    while (Recorder->Tail != Recorder->Head)
+    {
+        Record = (const DS_RecorderRecord_t *)&((uint8 *)Recorder->Buffer)[Recorder->Tail];
+
+        if (Record->PacketLength != 0)
+        {
+            if (Held == 0)
+            {
+                Oldest = *(const uint32 *)&Record[1];
+            }
+
+            UtAssert_UINT32_EQ(Record->PacketLength, 1000);
+            UtAssert_UINT32_EQ(*(const uint32 *)&Record[1], Oldest + Held);
+            Held++;
+        }
+
+        DS_FileRecorderDiscard(Recorder);
+    }
+
+    UtAssert_UINT32_EQ(Oldest + Held, 200);
+    UtAssert_True(Held >= ((DS_RECORDER_BUFFER_SIZE / 1004) - 1), "Held %u packets", (unsigned int)Held);
+}
+
+void DS_FileRecorderStore_Test_DumpingFull(void)
+{
+    DS_RecorderStatus_t *Recorder = &DS_AppData.Recorder[0];
+    uint32               Fit      = (DS_RECORDER_BUFFER_SIZE - 1) / 1004;
+    uint32               i;
+
+    UT_SetHandlerFunction(UT_KEY(CFE_MSG_GetSize), &UT_CFE_MSG_GetSize_CustomHandler, NULL);
+
+    Recorder->State = DS_RECORDER_DUMPING;
+
+    /* Execute the function being tested */
+    for (i = 0; i < (Fit + 10); i++)
+    {
+        UT_DS_RecorderStore(0, i, 1000);
+    }
+
+    /* Verify results -- the packets being dumped are not replaced */
+    UtAssert_UINT32_EQ(DS_AppData.RecorderDropCounter, 10);
+    UtAssert_ZERO(Recorder->Tail);
+    UtAssert_UINT32_EQ(Recorder->Head, Fit * 1004);
 }
 
-void DS_FileCloseDest_Test_PlatformConfigMoveFiles_FilenameNull(void)
+void DS_FileRecorderStore_Test_InvalidLength(void)
 {
-    int32 FileIndex = 0;
+    DS_RecorderStatus_t *Recorder = &DS_AppData.Recorder[0];
 
-    /* Set up the handle */
-    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+    UT_SetHandlerFunction(UT_KEY(CFE_MSG_GetSize), &UT_CFE_MSG_GetSize_CustomHandler, NULL);
 
-    strncpy(DS_AppData.DestFileTblPtr->File[FileIndex].Movename, "directory2/movename",
-            sizeof(DS_AppData.DestFileTblPtr->File[FileIndex].Movename));
-    DS_AppData.EnableMoveFiles = DS_ENABLED;
+    Recorder->State = DS_RECORDER_HOLDING;
 
     /* Execute the function being tested */
-    UtAssert_VOIDCALL(DS_FileCloseDest(FileIndex));
+    UT_DS_RecorderStore(0, 0, 0);
+    UT_DS_RecorderStore(0, 0, DS_RECORDER_BUFFER_SIZE / 2);
 
     /* Verify results */
-    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(DS_AppData.FileStatus[FileIndex].FileHandle));
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileAge, 0);
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, 0);
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileName[0], 0);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_MOVE_FILE_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_UINT32_EQ(DS_AppData.RecorderDropCounter, 2);
+    UtAssert_ZERO(Recorder->Head);
 }
 
-void DS_FileCloseDest_Test_PlatformConfigMoveFiles_MovenameNull(void)
+void DS_FileRecorderStore_Test_Wrap(void)
 {
-    int32 FileIndex = 0;
+    DS_RecorderStatus_t *      Recorder = &DS_AppData.Recorder[0];
+    const DS_RecorderRecord_t *Record   = (const DS_RecorderRecord_t *)Recorder->Buffer;
+    const DS_RecorderRecord_t *Marker   = NULL;
 
-    /* Set up the handle */
-    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+    UT_SetHandlerFunction(UT_KEY(CFE_MSG_GetSize), &UT_CFE_MSG_GetSize_CustomHandler, NULL);
 
-    strncpy(DS_AppData.DestFileTblPtr->File[FileIndex].Movename, "",
-            sizeof(DS_AppData.DestFileTblPtr->File[FileIndex].Movename));
-    DS_AppData.EnableMoveFiles = DS_ENABLED;
+    Recorder->State = DS_RECORDER_HOLDING;
+    Recorder->Head  = DS_RECORDER_BUFFER_SIZE - 500;
+    Recorder->Tail  = 2000;
+    Marker          = (const DS_RecorderRecord_t *)&((uint8 *)Recorder->Buffer)[Recorder->Head];
 
     /* Execute the function being tested */
-    UtAssert_VOIDCALL(DS_FileCloseDest(FileIndex));
-
-    /* Verify results */
-    UtAssert_STUB_COUNT(CFE_SB_MessageStringGet, 0);
+    UT_DS_RecorderStore(0, 7, 1000);
+
+    /* Verify results -- record at the buffer start, unused end marked */
+    UtAssert_ZERO(DS_AppData.RecorderDropCounter);
+    UtAssert_ZERO(Marker->PacketLength);
+    UtAssert_UINT32_EQ(Record->PacketLength, 1000);
+    UtAssert_UINT32_EQ(*(const uint32 *)&Record[1], 7);
+    UtAssert_UINT32_EQ(Recorder->Head, 1004);
+    UtAssert_UINT32_EQ(Recorder->Tail, 2000);
 }
 
-void DS_FileCloseDest_Test_PlatformConfigMoveFiles_DisableMoveFiles(void)
+void DS_FileRecorderCheck_Test_Trigger(void)
 {
-    int32 FileIndex = 0;
+    DS_AppData.Recorder[0].State        = DS_RECORDER_HOLDING;
+    DS_AppData.Recorder[0].TriggerMsgID = DS_UT_MID_2;
+    DS_AppData.Recorder[1].State        = DS_RECORDER_HOLDING;
+    DS_AppData.Recorder[1].TriggerMsgID = DS_UT_MID_1;
+    DS_AppData.Recorder[1].PostSeconds  = 5;
+    DS_AppData.Recorder[1].Head         = 2008;
 
-    /* Set up the handle */
-    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
-    DS_AppData.EnableMoveFiles = DS_DISABLED;
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_IsValidMsgId), true);
 
     /* Execute the function being tested */
-    UtAssert_VOIDCALL(DS_FileCloseDest(FileIndex));
+    UtAssert_VOIDCALL(DS_FileRecorderCheck(DS_UT_MID_1));
 
     /* Verify results */
-    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(DS_AppData.FileStatus[FileIndex].FileHandle));
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileAge, 0);
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, 0);
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileName[0], 0);
+    UtAssert_UINT32_EQ(DS_AppData.Recorder[0].State, DS_RECORDER_HOLDING);
+    UtAssert_UINT32_EQ(DS_AppData.Recorder[1].State, DS_RECORDER_DUMPING);
+    UtAssert_BOOL_FALSE(DS_AppData.Recorder[1].PostDone);
+    UtAssert_UINT32_EQ(DS_AppData.Recorder[1].DumpEnd, 2008);
+    UtAssert_UINT32_EQ(DS_AppData.RecorderTrigCounter, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_RECORDER_TRIGGER_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+}
+
+void DS_FileRecorderCheck_Test_NoTrigger(void)
+{
+    DS_AppData.Recorder[0].State        = DS_RECORDER_HOLDING;
+    DS_AppData.Recorder[0].TriggerMsgID = DS_UT_MID_1;
+
+    /* Execute the function being tested -- no valid trigger message ID */
+    UtAssert_VOIDCALL(DS_FileRecorderCheck(DS_UT_MID_1));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.Recorder[0].State, DS_RECORDER_HOLDING);
+    UtAssert_ZERO(DS_AppData.RecorderTrigCounter);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void DS_FileTestAge_Test_Nominal(void)
+void DS_FileRecorderDrain_Test_Complete(void)
 {
-    int32  FileIndex      = 0;
-    uint32 ElapsedSeconds = 2;
-    uint32 i;
+    DS_RecorderStatus_t *Recorder = &DS_AppData.Recorder[0];
+    uint32               i;
 
-    /* Set up the handle */
-    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+    UT_SetHandlerFunction(UT_KEY(CFE_MSG_GetSize), &UT_CFE_MSG_GetSize_CustomHandler, NULL);
 
-    for (i = 0; i < DS_DEST_FILE_CNT; i++)
+    Recorder->State                    = DS_RECORDER_HOLDING;
+    Recorder->FileTableIndex           = 0;
+    DS_AppData.FileStatus[0].FileState = DS_ENABLED;
+
+    DS_AppData.DestFileTblPtr->File[0].MaxFileSize = 100000;
+    OS_OpenCreate(&DS_AppData.FileStatus[0].FileHandle, NULL, 0, 0);
+
+    for (i = 0; i < 5; i++)
     {
-        strncpy(DS_AppData.FileStatus[i].FileName, "directory1/filename", sizeof(DS_AppData.FileStatus[i].FileName));
+        UT_DS_RecorderStore(0, i, 100);
     }
 
-    DS_AppData.FileStatus[FileIndex].FileAge              = 0;
-    DS_AppData.DestFileTblPtr->File[FileIndex].MaxFileAge = 3;
+    DS_FileRecorderTrigger(0, "command");
 
     /* Execute the function being tested */
-    UtAssert_VOIDCALL(DS_FileTestAge(ElapsedSeconds));
+    UtAssert_VOIDCALL(DS_FileRecorderDrain(DS_RECORDER_DRAIN_ALL));
 
-    /* Verify results */
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileAge, 2);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    /* Verify results -- dump written and closed, recorder holding again */
+    UtAssert_UINT32_EQ(Recorder->DumpCount, 5);
+    UtAssert_UINT32_EQ(Recorder->State, DS_RECORDER_HOLDING);
+    UtAssert_UINT32_EQ(Recorder->Tail, Recorder->Head);
+    UtAssert_ZERO(DS_AppData.RecorderDropCounter);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, DS_RECORDER_DUMP_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
 }
 
-void DS_FileTestAge_Test_NullTable(void)
+void DS_FileRecorderDrain_Test_Limit(void)
 {
-    uint32 ElapsedSeconds     = 2;
-    DS_AppData.DestFileTblPtr = NULL;
+    DS_RecorderStatus_t *Recorder = &DS_AppData.Recorder[0];
+    uint32               i;
+
+    UT_SetHandlerFunction(UT_KEY(CFE_MSG_GetSize), &UT_CFE_MSG_GetSize_CustomHandler, NULL);
+
+    Recorder->State                    = DS_RECORDER_HOLDING;
+    DS_AppData.FileStatus[0].FileState = DS_ENABLED;
+
+    DS_AppData.DestFileTblPtr->File[0].MaxFileSize = 100000;
+    OS_OpenCreate(&DS_AppData.FileStatus[0].FileHandle, NULL, 0, 0);
+
+    for (i = 0; i < 5; i++)
+    {
+        UT_DS_RecorderStore(0, i, 100);
+    }
+
+    DS_FileRecorderTrigger(0, "command");
 
     /* Execute the function being tested */
-    UtAssert_VOIDCALL(DS_FileTestAge(ElapsedSeconds));
+    UtAssert_VOIDCALL(DS_FileRecorderDrain(2));
 
-    /* Verify results */
-    UtAssert_STUB_COUNT(OS_close, 0);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    /* Verify results -- dump continues on the next call */
+    UtAssert_UINT32_EQ(Recorder->DumpCount, 2);
+    UtAssert_UINT32_EQ(Recorder->State, DS_RECORDER_DUMPING);
+
+    UtAssert_VOIDCALL(DS_FileRecorderDrain(DS_RECORDER_DRAIN_ALL));
+    UtAssert_UINT32_EQ(Recorder->DumpCount, 5);
+    UtAssert_UINT32_EQ(Recorder->State, DS_RECORDER_HOLDING);
 }
 
-void DS_FileTestAge_Test_ExceedMaxAge(void)
+void DS_FileRecorderDrain_Test_PostWindow(void)
 {
-    int32  FileIndex      = 0;
-    uint32 ElapsedSeconds = 2;
+    DS_RecorderStatus_t *Recorder = &DS_AppData.Recorder[0];
+    CFE_TIME_SysTime_t   Met      = {30, 0};
 
-    /* Set up the handle */
-    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+    UT_SetHandlerFunction(UT_KEY(CFE_MSG_GetSize), &UT_CFE_MSG_GetSize_CustomHandler, NULL);
 
-    DS_AppData.DestFileTblPtr->File[FileIndex].MaxFileAge = 1;
+    Recorder->State                    = DS_RECORDER_HOLDING;
+    Recorder->PostSeconds              = 30;
+    DS_AppData.FileStatus[0].FileState = DS_ENABLED;
 
-    /* Execute the function being tested */
-    UtAssert_VOIDCALL(DS_FileTestAge(ElapsedSeconds));
+    DS_AppData.DestFileTblPtr->File[0].MaxFileSize = 100000;
+    OS_OpenCreate(&DS_AppData.FileStatus[0].FileHandle, NULL, 0, 0);
 
-    /* Verify results */
-    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileAge, 0);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UT_DS_RecorderStore(0, 0, 100);
+    DS_FileRecorderTrigger(0, "command");
+    UT_DS_RecorderStore(0, 1, 100);
+
+    /* Execute the function being tested -- inside the post-trigger window */
+    UtAssert_VOIDCALL(DS_FileRecorderDrain(DS_RECORDER_DRAIN_ALL));
+
+    /* Verify results -- packets after the trigger are dumped too */
+    UtAssert_UINT32_EQ(Recorder->DumpCount, 2);
+    UtAssert_UINT32_EQ(Recorder->State, DS_RECORDER_DUMPING);
+
+    /* Execute the function being tested -- window over */
+    UT_DS_RecorderStore(0, 2, 100);
+    UT_SetDataBuffer(UT_KEY(CFE_TIME_GetMET), &Met, sizeof(Met), false);
+    UtAssert_VOIDCALL(DS_FileRecorderDrain(DS_RECORDER_DRAIN_ALL));
+
+    UtAssert_UINT32_EQ(Recorder->DumpCount, 3);
+    UtAssert_UINT32_EQ(Recorder->State, DS_RECORDER_HOLDING);
 }
 
-void DS_IsPacketFiltered_Test_AlgX0(void)
+void DS_FileRecorderDrain_Test_DestDisabled(void)
 {
-    CFE_MSG_Message_t Message;
-    uint16            FilterType = 2;
-    uint16            Alg_N      = 0;
-    uint16            Alg_X      = 0;
-    uint16            Alg_O      = 0;
+    DS_RecorderStatus_t *Recorder = &DS_AppData.Recorder[0];
+
+    UT_SetHandlerFunction(UT_KEY(CFE_MSG_GetSize), &UT_CFE_MSG_GetSize_CustomHandler, NULL);
+
+    Recorder->State                    = DS_RECORDER_HOLDING;
+    DS_AppData.FileStatus[0].FileState = DS_DISABLED;
+
+    UT_DS_RecorderStore(0, 0, 100);
+    UT_DS_RecorderStore(0, 1, 100);
+    DS_FileRecorderTrigger(0, "command");
 
     /* Execute the function being tested */
-    UtAssert_BOOL_TRUE(DS_IsPacketFiltered(&Message, FilterType, Alg_N, Alg_X, Alg_O));
+    UtAssert_VOIDCALL(DS_FileRecorderDrain(DS_RECORDER_DRAIN_ALL));
+
+    /* Verify results -- packets are discarded and counted */
+    UtAssert_ZERO(Recorder->DumpCount);
+    UtAssert_UINT32_EQ(DS_AppData.RecorderDropCounter, 2);
+    UtAssert_UINT32_EQ(Recorder->State, DS_RECORDER_HOLDING);
+    UtAssert_STUB_COUNT(OS_write, 0);
 }
 
-void DS_IsPacketFiltered_Test_AlgN0(void)
+void DS_FileCacheIndex_Test_Nominal(void)
 {
-    CFE_MSG_Message_t Message;
-    uint16            FilterType = 2;
-    uint16            Alg_N      = 0;
-    uint16            Alg_X      = 1;
-    uint16            Alg_O      = 0;
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableHashFunction), 5);
 
-    /* Execute the function being tested */
-    UtAssert_BOOL_TRUE(DS_IsPacketFiltered(&Message, FilterType, Alg_N, Alg_X, Alg_O));
+    /* Execute the function being tested -- nothing cached at this hash table index */
+    UtAssert_INT32_EQ(DS_FileCacheIndex(DS_UT_MID_1), DS_INDEX_NONE);
+
+    DS_AppData.CacheHash[5]       = 1;
+    DS_AppData.Cache[0].MessageID = DS_UT_MID_2;
+
+    /* Execute the function being tested -- end of the chain without a match */
+    UtAssert_INT32_EQ(DS_FileCacheIndex(DS_UT_MID_1), DS_INDEX_NONE);
+
+    /* Execute the function being tested -- match at the head of the chain */
+    UtAssert_INT32_EQ(DS_FileCacheIndex(DS_UT_MID_2), 0);
 }
 
-void DS_IsPacketFiltered_Test_AlgNGreaterX(void)
+void DS_FileCacheIndex_Test_Chain(void)
 {
-    CFE_MSG_Message_t Message;
-    uint16            FilterType = 2;
-    uint16            Alg_N      = 2;
-    uint16            Alg_X      = 1;
-    uint16            Alg_O      = 0;
+    int32 Last = DS_CACHE_RESERVED_ENTRIES - 1;
+
+    /* Two Message IDs with the same hash table index, the newest entry is linked first */
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableHashFunction), 5);
+
+    DS_AppData.CacheHash[5]          = Last + 1;
+    DS_AppData.Cache[Last].MessageID = DS_UT_MID_2;
+    DS_AppData.Cache[Last].Next      = 1;
+    DS_AppData.Cache[0].MessageID    = DS_UT_MID_1;
 
     /* Execute the function being tested */
-    UtAssert_BOOL_TRUE(DS_IsPacketFiltered(&Message, FilterType, Alg_N, Alg_X, Alg_O));
+    UtAssert_INT32_EQ(DS_FileCacheIndex(DS_UT_MID_1), 0);
+    UtAssert_INT32_EQ(DS_FileCacheIndex(DS_UT_MID_2), Last);
 }
 
-void DS_IsPacketFiltered_Test_Alg0GreaterX(void)
+void DS_FileCacheStore_Test_Nominal(void)
 {
-    CFE_MSG_Message_t Message;
-    uint16            FilterType = 2;
-    uint16            Alg_N      = 1;
-    uint16            Alg_X      = 1;
-    uint16            Alg_O      = 2;
+    UT_DS_RecorderPacket[0] = 0x12345678;
+    UT_DS_MsgSize           = 16;
+    UT_SetHandlerFunction(UT_KEY(CFE_MSG_GetSize), &UT_CFE_MSG_GetSize_CustomHandler, NULL);
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableHashFunction), 5);
 
-    /* Execute the function being tested */
-    UtAssert_BOOL_TRUE(DS_IsPacketFiltered(&Message, FilterType, Alg_N, Alg_X, Alg_O));
+    /* Execute the function being tested -- first packet of the Message ID */
+    UtAssert_VOIDCALL(DS_FileCacheStore(DS_UT_MID_1, (const CFE_SB_Buffer_t *)UT_DS_RecorderPacket));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.CacheCount, 1);
+    UtAssert_UINT32_EQ(DS_AppData.CacheHash[5], 1);
+    UtAssert_UINT32_EQ(DS_AppData.Cache[0].PacketLength, 16);
+    UtAssert_UINT32_EQ(DS_AppData.Cache[0].Packet[0], 0x12345678);
+    UtAssert_BOOL_TRUE(CFE_SB_MsgId_Equal(DS_AppData.Cache[0].MessageID, DS_UT_MID_1));
+    UtAssert_STUB_COUNT(CFE_MSG_SetSize, 0);
+
+    UT_DS_RecorderPacket[0] = 0x87654321;
+    UT_DS_MsgSize           = 20;
+
+    /* Execute the function being tested -- later packets replace the same entry */
+    UtAssert_VOIDCALL(DS_FileCacheStore(DS_UT_MID_1, (const CFE_SB_Buffer_t *)UT_DS_RecorderPacket));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.CacheCount, 1);
+    UtAssert_UINT32_EQ(DS_AppData.Cache[0].PacketLength, 20);
+    UtAssert_UINT32_EQ(DS_AppData.Cache[0].Packet[0], 0x87654321);
+    UtAssert_ZERO(DS_AppData.CacheOverflowCounter);
 }
 
-void DS_IsPacketFiltered_Test_Alg0EqualX(void)
+void DS_FileCacheStore_Test_Truncated(void)
 {
-    CFE_MSG_Message_t Message;
-    uint16            FilterType = 2;
-    uint16            Alg_N      = 1;
-    uint16            Alg_X      = 1;
-    uint16            Alg_O      = 1;
+    UT_DS_RecorderPacket[(DS_CACHE_ENTRY_SIZE / 4) - 1] = 0x11111111;
+    UT_DS_RecorderPacket[DS_CACHE_ENTRY_SIZE / 4]       = 0x22222222;
+    UT_DS_MsgSize                                       = DS_CACHE_ENTRY_SIZE + 4;
+    UT_SetHandlerFunction(UT_KEY(CFE_MSG_GetSize), &UT_CFE_MSG_GetSize_CustomHandler, NULL);
 
     /* Execute the function being tested */
-    UtAssert_BOOL_TRUE(DS_IsPacketFiltered(&Message, FilterType, Alg_N, Alg_X, Alg_O));
+    UtAssert_VOIDCALL(DS_FileCacheStore(DS_UT_MID_1, (const CFE_SB_Buffer_t *)UT_DS_RecorderPacket));
+
+    /* Verify results -- copy is shortened to a complete first segment */
+    UtAssert_UINT32_EQ(DS_AppData.Cache[0].PacketLength, DS_CACHE_ENTRY_SIZE);
+    UtAssert_UINT32_EQ(DS_AppData.Cache[0].Packet[(DS_CACHE_ENTRY_SIZE / 4) - 1], 0x11111111);
+    UtAssert_STUB_COUNT(CFE_MSG_SetSize, 1);
+    UtAssert_STUB_COUNT(CFE_MSG_SetSegmentationFlag, 1);
 }
 
-void DS_IsPacketFiltered_Test_InvalidFilterType(void)
+void DS_FileCacheStore_Test_Overflow(void)
 {
-    CFE_MSG_Message_t Message;
-    uint16            FilterType = 0xff;
-    uint16            Alg_N      = 1;
-    uint16            Alg_X      = 1;
-    uint16            Alg_O      = 0;
+    /* Every entry is used by other Message IDs */
+    DS_AppData.CacheCount = DS_CACHE_RESERVED_ENTRIES;
 
     /* Execute the function being tested */
-    UtAssert_BOOL_TRUE(DS_IsPacketFiltered(&Message, FilterType, Alg_N, Alg_X, Alg_O));
+    UtAssert_VOIDCALL(DS_FileCacheStore(DS_UT_MID_1, (const CFE_SB_Buffer_t *)UT_DS_RecorderPacket));
+
+    /* Verify results -- counted, nothing copied */
+    UtAssert_UINT32_EQ(DS_AppData.CacheOverflowCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.CacheCount, DS_CACHE_RESERVED_ENTRIES);
+    UtAssert_ZERO(DS_AppData.CacheHash[0]);
+    UtAssert_STUB_COUNT(CFE_MSG_GetSize, 0);
 }
 
-void DS_IsPacketFiltered_Test_SeqFilter(void)
+void DS_FileCacheRebuild_Test_Removed(void)
 {
-    CFE_MSG_Message_t       Message;
-    CFE_MSG_SequenceCount_t SeqCnt     = 0;
-    uint16                  FilterType = 1;
-    uint16                  Alg_N      = 1;
-    uint16                  Alg_X      = 1;
-    uint16                  Alg_O      = 0;
+    DS_AppData.CacheCount            = 1;
+    DS_AppData.CacheHash[5]          = 1;
+    DS_AppData.Cache[0].MessageID    = DS_UT_MID_1;
+    DS_AppData.Cache[0].PacketLength = 16;
 
-    memset(&Message, 0, sizeof(Message));
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableFindMsgID), DS_INDEX_NONE);
 
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSequenceCount), &SeqCnt, sizeof(SeqCnt), false);
+    /* Execute the function being tested -- Message ID removed from the packet filter table */
+    UtAssert_VOIDCALL(DS_FileCacheRebuild());
 
-    /* Execute the function being tested */
-    UtAssert_BOOL_FALSE(DS_IsPacketFiltered(&Message, FilterType, Alg_N, Alg_X, Alg_O));
+    /* Verify results -- entry is free for another Message ID */
+    UtAssert_ZERO(DS_AppData.CacheCount);
+    UtAssert_ZERO(DS_AppData.CacheHash[5]);
 }
 
-void DS_IsPacketFiltered_Test_TimeFilter1(void)
+void DS_FileCacheRebuild_Test_Kept(void)
 {
-    CFE_MSG_Message_t  Message;
-    CFE_TIME_SysTime_t PacketTime;
-    uint16             FilterType = 2;
-    uint16             Alg_N      = 1;
-    uint16             Alg_X      = 1;
-    uint16             Alg_O      = 0;
+    int32 Last = DS_CACHE_RESERVED_ENTRIES - 1;
 
-    memset(&Message, 0, sizeof(Message));
+    /* Only the last entry is still in the packet filter table */
+    DS_AppData.CacheCount               = DS_CACHE_RESERVED_ENTRIES;
+    DS_AppData.CacheHash[5]             = Last + 1;
+    DS_AppData.Cache[Last].MessageID    = DS_UT_MID_2;
+    DS_AppData.Cache[Last].PacketLength = 16;
+    DS_AppData.Cache[Last].Packet[0]    = 0x12345678;
+    DS_AppData.Cache[Last].Next         = 1;
 
-    PacketTime.Seconds    = 1;
-    PacketTime.Subseconds = 1;
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableFindMsgID), DS_INDEX_NONE);
+    UT_SetDeferredRetcode(UT_KEY(DS_TableFindMsgID), DS_CACHE_RESERVED_ENTRIES, 0);
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableHashFunction), 7);
 
-    /* This packet will be passed by the filter algorithm */
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgTime), &PacketTime, sizeof(PacketTime), false);
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileCacheRebuild());
+
+    /* Verify results -- entry moved to the start of the cache and relinked */
+    UtAssert_UINT32_EQ(DS_AppData.CacheCount, 1);
+    UtAssert_ZERO(DS_AppData.CacheHash[5]);
+    UtAssert_UINT32_EQ(DS_AppData.CacheHash[7], 1);
+    UtAssert_BOOL_TRUE(CFE_SB_MsgId_Equal(DS_AppData.Cache[0].MessageID, DS_UT_MID_2));
+    UtAssert_UINT32_EQ(DS_AppData.Cache[0].PacketLength, 16);
+    UtAssert_UINT32_EQ(DS_AppData.Cache[0].Packet[0], 0x12345678);
+    UtAssert_ZERO(DS_AppData.Cache[0].Next);
+    UtAssert_INT32_EQ(DS_FileCacheIndex(DS_UT_MID_2), 0);
+}
+
+void DS_FileCacheFind_Test_Found(void)
+{
+    DS_AppData.CacheHash[0]          = 1;
+    DS_AppData.Cache[0].MessageID    = DS_UT_MID_1;
+    DS_AppData.Cache[0].PacketLength = 16;
+
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableFindMsgID), 3);
 
     /* Execute the function being tested */
-    UtAssert_BOOL_FALSE(DS_IsPacketFiltered(&Message, FilterType, Alg_N, Alg_X, Alg_O));
+    UtAssert_ADDRESS_EQ(DS_FileCacheFind(DS_UT_MID_1), &DS_AppData.Cache[0]);
 }
 
-void DS_IsPacketFiltered_Test_TimeFilter2(void)
+void DS_FileCacheFind_Test_NotFound(void)
 {
-    CFE_MSG_Message_t  Message;
-    CFE_TIME_SysTime_t PacketTime;
-    uint16             FilterType = 2;
-    uint16             Alg_N      = 2;
-    uint16             Alg_X      = 2;
-    uint16             Alg_O      = 1;
+    /* Execute the function being tested -- no entry for the Message ID */
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableFindMsgID), 0);
+    UtAssert_NULL(DS_FileCacheFind(DS_UT_MID_1));
 
-    memset(&Message, 0, sizeof(Message));
+    /* Execute the function being tested -- entry holds a packet of another Message ID */
+    DS_AppData.CacheHash[0]          = 1;
+    DS_AppData.Cache[0].MessageID    = DS_UT_MID_2;
+    DS_AppData.Cache[0].PacketLength = 16;
+    UtAssert_NULL(DS_FileCacheFind(DS_UT_MID_1));
 
-    /* Value is less than offset of passed range, this packet will be filtered */
-    PacketTime.Seconds    = 0;
-    PacketTime.Subseconds = 0;
+    /* Execute the function being tested -- no packet copied yet */
+    DS_AppData.Cache[0].MessageID    = DS_UT_MID_1;
+    DS_AppData.Cache[0].PacketLength = 0;
+    UtAssert_NULL(DS_FileCacheFind(DS_UT_MID_1));
 
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgTime), &PacketTime, sizeof(PacketTime), false);
+    /* Execute the function being tested -- since removed from the packet filter table */
+    DS_AppData.Cache[0].PacketLength = 16;
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableFindMsgID), DS_INDEX_NONE);
+    UtAssert_NULL(DS_FileCacheFind(DS_UT_MID_1));
+}
+
+void DS_FileCacheWrite_Test_Nominal(void)
+{
+    uint32 PacketCount = 99;
+
+    DS_AppData.CacheCount            = 1;
+    DS_AppData.Cache[0].MessageID    = DS_UT_MID_1;
+    DS_AppData.Cache[0].PacketLength = 16;
+
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableFindMsgID), 0);
 
     /* Execute the function being tested */
-    UtAssert_BOOL_TRUE(DS_IsPacketFiltered(&Message, FilterType, Alg_N, Alg_X, Alg_O));
+    UtAssert_INT32_EQ(DS_FileCacheWrite("cache", &PacketCount), OS_SUCCESS);
+
+    /* Verify results -- DS file header and one packet */
+    UtAssert_UINT32_EQ(PacketCount, 1);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(CFE_FS_WriteHeader, 1);
+    UtAssert_STUB_COUNT(OS_write, 2);
+    UtAssert_STUB_COUNT(OS_close, 1);
 }
 
-void DS_IsPacketFiltered_Test_TimeFilter3(void)
+void DS_FileCacheWrite_Test_Skipped(void)
 {
-    CFE_MSG_Message_t  Message;
-    CFE_TIME_SysTime_t PacketTime;
-    uint16             FilterType = 2;
-    uint16             Alg_N      = 3;
-    uint16             Alg_X      = 4;
-    uint16             Alg_O      = 1;
-
-    memset(&Message, 0, sizeof(Message));
+    uint32 PacketCount = 99;
 
-    /* This packet will be filtered by the filter algorithm */
-    PacketTime.Seconds    = 3;
-    PacketTime.Subseconds = 0;
+    /* Message ID of the only entry has since been removed from the packet filter table */
+    DS_AppData.CacheCount            = 1;
+    DS_AppData.Cache[0].MessageID    = DS_UT_MID_1;
+    DS_AppData.Cache[0].PacketLength = 16;
 
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgTime), &PacketTime, sizeof(PacketTime), false);
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableFindMsgID), DS_INDEX_NONE);
 
     /* Execute the function being tested */
-    UtAssert_BOOL_TRUE(DS_IsPacketFiltered(&Message, FilterType, Alg_N, Alg_X, Alg_O));
+    UtAssert_INT32_EQ(DS_FileCacheWrite("cache", &PacketCount), OS_SUCCESS);
+
+    /* Verify results -- DS file header only */
+    UtAssert_ZERO(PacketCount);
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_STUB_COUNT(OS_close, 1);
 }
 
-void DS_FileTransmit_Test_Nominal(void)
+void DS_FileCacheWrite_Test_CreateError(void)
 {
-    DS_FileCompletePkt_t  PktBuf;
-    DS_FileCompletePkt_t *PktBufPtr = &PktBuf;
+    uint32 PacketCount = 99;
 
-    /* setup for a call to CFE_SB_AllocateMessageBuffer() */
-    memset(PktBufPtr, 0, sizeof(*PktBufPtr));
-    UT_SetDataBuffer(UT_KEY(CFE_SB_AllocateMessageBuffer), &PktBufPtr, sizeof(PktBufPtr), true);
+    DS_AppData.CacheCount            = 1;
+    DS_AppData.Cache[0].MessageID    = DS_UT_MID_1;
+    DS_AppData.Cache[0].PacketLength = 16;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_ERROR);
 
     /* Execute the function being tested */
-    UtAssert_VOIDCALL(DS_FileTransmit(&DS_AppData.FileStatus[0]));
+    UtAssert_INT32_EQ(DS_FileCacheWrite("cache", &PacketCount), OS_ERROR);
 
     /* Verify results */
-    UtAssert_STUB_COUNT(CFE_SB_AllocateMessageBuffer, 1);
-    UtAssert_STUB_COUNT(CFE_MSG_Init, 1);
-    UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 1);
+    UtAssert_ZERO(PacketCount);
+    UtAssert_STUB_COUNT(OS_write, 0);
+    UtAssert_STUB_COUNT(OS_close, 0);
 }
 
-void DS_FileTransmit_Test_NoBuf(void)
+void DS_FileCacheWrite_Test_WriteError(void)
 {
-    /* Execute the function being tested */
-    UtAssert_VOIDCALL(DS_FileTransmit(&DS_AppData.FileStatus[0]));
+    uint32 PacketCount = 99;
+
+    DS_AppData.CacheCount            = 1;
+    DS_AppData.Cache[0].MessageID    = DS_UT_MID_1;
+    DS_AppData.Cache[0].PacketLength = 16;
+
+    UT_SetDefaultReturnValue(UT_KEY(DS_TableFindMsgID), 0);
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 2, 4);
+
+    /* Execute the function being tested -- short packet write */
+    UtAssert_INT32_EQ(DS_FileCacheWrite("cache", &PacketCount), OS_ERROR);
 
     /* Verify results */
-    UtAssert_STUB_COUNT(CFE_SB_AllocateMessageBuffer, 1);
-    UtAssert_STUB_COUNT(CFE_MSG_Init, 0);
-    UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 0);
+    UtAssert_ZERO(PacketCount);
+    UtAssert_STUB_COUNT(OS_close, 1);
 }
 
 void UtTest_Setup(void)
@@ -1271,15 +5590,45 @@ void UtTest_Setup(void)
     UT_DS_TEST_ADD(DS_FileStorePacket_Test_Nominal);
     UT_DS_TEST_ADD(DS_FileStorePacket_Test_PacketNotInTable);
     UT_DS_TEST_ADD(DS_FileStorePacket_Test_PassedFilterFalse);
+    UT_DS_TEST_ADD(DS_FileStorePacket_Test_ChangeFilter);
+    UT_DS_TEST_ADD(DS_FileStorePacket_Test_WindowFilter);
+    UT_DS_TEST_ADD(DS_FileStorePacket_Test_PredicateMismatch);
+    UT_DS_TEST_ADD(DS_FileStorePacket_Test_Decimated);
+    UT_DS_TEST_ADD(DS_FileStorePacket_Test_MessageRateLimit);
+    UT_DS_TEST_ADD(DS_FileStorePacket_Test_DestRateLimit);
     UT_DS_TEST_ADD(DS_FileStorePacket_Test_DisabledDest);
     UT_DS_TEST_ADD(DS_FileStorePacket_Test_InvalidIndex);
 
     UT_DS_TEST_ADD(DS_FileSetupWrite_Test_Nominal);
     UT_DS_TEST_ADD(DS_FileSetupWrite_Test_FileHandleClosed);
     UT_DS_TEST_ADD(DS_FileSetupWrite_Test_MaxFileSizeExceeded);
+    UT_DS_TEST_ADD(DS_FileSetupWrite_Test_RingMode);
+    UT_DS_TEST_ADD(DS_FileSetupWrite_Test_RingTooLarge);
+    UT_DS_TEST_ADD(DS_FileSetupWrite_Test_CompressedLimit);
+    UT_DS_TEST_ADD(DS_FileSetupWrite_Test_Truncated);
+    UT_DS_TEST_ADD(DS_FileSetupWrite_Test_NotTruncated);
+    UT_DS_TEST_ADD(DS_FileTruncatePacket_Test_Nominal);
 
     UT_DS_TEST_ADD(DS_FileWriteData_Test_Nominal);
+    UT_DS_TEST_ADD(DS_FileWriteData_Test_Index);
+    UT_DS_TEST_ADD(DS_FileWriteData_Test_Trailer);
+    UT_DS_TEST_ADD(DS_FileWriteData_Test_PayloadCrc);
     UT_DS_TEST_ADD(DS_FileWriteData_Test_Error);
+    UT_DS_TEST_ADD(DS_FileWriteData_Test_Compressed);
+    UT_DS_TEST_ADD(DS_FileWriteData_Test_CompressedError);
+    UT_DS_TEST_ADD(DS_FileWriteData_Test_Delta);
+    UT_DS_TEST_ADD(DS_FileWriteData_Test_DeltaFull);
+    UT_DS_TEST_ADD(DS_FileWriteData_Test_TruncatedRecord);
+
+    UT_DS_TEST_ADD(DS_FileRingPrepare_Test_NoWrap);
+    UT_DS_TEST_ADD(DS_FileRingPrepare_Test_Wrap);
+    UT_DS_TEST_ADD(DS_FileRingPrepare_Test_OlderDataOverwritten);
+    UT_DS_TEST_ADD(DS_FileRingPrepare_Test_BadRecord);
+    UT_DS_TEST_ADD(DS_FileRingPrepare_Test_WalkAhead);
+    UT_DS_TEST_ADD(DS_FileRingPrepare_Test_TooLarge);
+    UT_DS_TEST_ADD(DS_FileRingWalk_Test_Nominal);
+    UT_DS_TEST_ADD(DS_FileRingWalk_Test_BadRecord);
+    UT_DS_TEST_ADD(DS_FileRingPrepare_Test_SeekError);
 
     if (DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE)
     {
@@ -1299,6 +5648,17 @@ void UtTest_Setup(void)
     UT_DS_TEST_ADD(DS_FileCreateDest_Test_Error);
 
     UT_DS_TEST_ADD(DS_FileCreateDest_Test_ClosedFileHandle);
+    UT_DS_TEST_ADD(DS_FileCreateDest_Test_RingMode);
+    UT_DS_TEST_ADD(DS_FileCreateDest_Test_Index);
+    UT_DS_TEST_ADD(DS_FileCreateDest_Test_IndexRingMode);
+    UT_DS_TEST_ADD(DS_FileCreateDest_Test_Compressed);
+    UT_DS_TEST_ADD(DS_FileCreateDest_Test_Delta);
+    UT_DS_TEST_ADD(DS_FileCreateDest_Test_Trailer);
+
+    UT_DS_TEST_ADD(DS_FileRingInit_Test_Nominal);
+    UT_DS_TEST_ADD(DS_FileRingInit_Test_Fill);
+    UT_DS_TEST_ADD(DS_FileRingInit_Test_WriteError);
+    UT_DS_TEST_ADD(DS_FileRingInit_Test_PreallocateError);
 
     UT_DS_TEST_ADD(DS_FileCreateName_Test_Nominal);
     UT_DS_TEST_ADD(DS_FileCreateName_Test_NominalWithSeparator);
@@ -1308,11 +5668,25 @@ void UtTest_Setup(void)
     UT_DS_TEST_ADD(DS_FileCreateName_Test_PathBaseSeqTooLarge);
     UT_DS_TEST_ADD(DS_FileCreateName_Test_PathBaseSeqExtTooLarge);
     UT_DS_TEST_ADD(DS_FileCreateName_Test_ExtensionZero);
+    UT_DS_TEST_ADD(DS_FileCreateName_Test_Shard);
+    UT_DS_TEST_ADD(DS_FileCreateName_Test_ShardByTime);
+    UT_DS_TEST_ADD(DS_FileCreateName_Test_ShardError);
 
     UT_DS_TEST_ADD(DS_FileCreateSequence_Test_ByCount);
     UT_DS_TEST_ADD(DS_FileCreateSequence_Test_ByTime);
     UT_DS_TEST_ADD(DS_FileCreateSequence_Test_BadFilenameType);
 
+    UT_DS_TEST_ADD(DS_FileShardName_Test_ByTime);
+    UT_DS_TEST_ADD(DS_FileShardName_Test_ByFileTime);
+    UT_DS_TEST_ADD(DS_FileShardName_Test_ByCount);
+    UT_DS_TEST_ADD(DS_FileShardName_Test_None);
+
+    UT_DS_TEST_ADD(DS_FileShardCreate_Test_Nominal);
+    UT_DS_TEST_ADD(DS_FileShardCreate_Test_Known);
+    UT_DS_TEST_ADD(DS_FileShardCreate_Test_Error);
+    UT_DS_TEST_ADD(DS_FileShardCreate_Test_Exists);
+    UT_DS_TEST_ADD(DS_FileShardCreate_Test_TooLong);
+
     if (DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE)
     {
         UT_DS_TEST_ADD(DS_FileUpdateHeader_Test_PlatformConfigCFE_Nominal);
@@ -1320,16 +5694,91 @@ void UtTest_Setup(void)
         UT_DS_TEST_ADD(DS_FileUpdateHeader_Test_PlatformConfigCFE_SeekError);
     }
 
+    UT_DS_TEST_ADD(DS_FileRingUpdateHeader_Test_Nominal);
+    UT_DS_TEST_ADD(DS_FileRingUpdateHeader_Test_SeekError);
+
+    UT_DS_TEST_ADD(DS_FileIndexCreate_Test_Name);
+    UT_DS_TEST_ADD(DS_FileIndexCreate_Test_NameTooLong);
+    UT_DS_TEST_ADD(DS_FileIndexCreate_Test_CreateError);
+    UT_DS_TEST_ADD(DS_FileIndexCreate_Test_WriteError);
+    UT_DS_TEST_ADD(DS_FileIndexPacket_Test_ByCount);
+    UT_DS_TEST_ADD(DS_FileIndexPacket_Test_ByTime);
+    UT_DS_TEST_ADD(DS_FileIndexPacket_Test_BufferFull);
+    UT_DS_TEST_ADD(DS_FileIndexFlush_Test_WriteError);
+    UT_DS_TEST_ADD(DS_FileIndexClose_Test_Nominal);
+    UT_DS_TEST_ADD(DS_FileIndexClose_Test_SeekError);
+    UT_DS_TEST_ADD(DS_FileIndexClose_Test_NoIndex);
+    UT_DS_TEST_ADD(DS_FileIndexMove_Test_Nominal);
+    UT_DS_TEST_ADD(DS_FileIndexMove_Test_MoveError);
+    UT_DS_TEST_ADD(DS_FileIndexMove_Test_NameTooLong);
+    UT_DS_TEST_ADD(DS_FileIndexMove_Test_NoIndex);
+    UT_DS_TEST_ADD(DS_FileTrailerPacket_Test_Nominal);
+    UT_DS_TEST_ADD(DS_FileTrailerPacket_Test_EntriesFull);
+    UT_DS_TEST_ADD(DS_FileTrailerWrite_Test_Nominal);
+    UT_DS_TEST_ADD(DS_FileTrailerWrite_Test_NoEntries);
+    UT_DS_TEST_ADD(DS_FileTrailerWrite_Test_Error);
+
+    UT_DS_TEST_ADD(DS_FileCompressData_Test_Nominal);
+    UT_DS_TEST_ADD(DS_FileCompressData_Test_NewBlock);
+    UT_DS_TEST_ADD(DS_FileCompressData_Test_LargePacket);
+    UT_DS_TEST_ADD(DS_FileCompressData_Test_Error);
+    UT_DS_TEST_ADD(DS_FileCompressFlush_Test_Compressed);
+    UT_DS_TEST_ADD(DS_FileCompressFlush_Test_Stored);
+    UT_DS_TEST_ADD(DS_FileCompressFlush_Test_PartialWrite);
+    UT_DS_TEST_ADD(DS_FileCompressClose_Test_Nominal);
+    UT_DS_TEST_ADD(DS_FileCompressClose_Test_SeekError);
+    UT_DS_TEST_ADD(DS_FileLimitSize_Test_Uncompressed);
+    UT_DS_TEST_ADD(DS_FileLimitSize_Test_Logical);
+    UT_DS_TEST_ADD(DS_FileLimitSize_Test_Physical);
+    UT_DS_TEST_ADD(DS_FileLogicalSize_Test);
+    UT_DS_TEST_ADD(DS_FileRecordEncode_Test_Delta);
+    UT_DS_TEST_ADD(DS_FileRecordEncode_Test_Keyframe);
+    UT_DS_TEST_ADD(DS_FileRecordEncode_Test_HeaderChanged);
+    UT_DS_TEST_ADD(DS_FileRecordEncode_Test_SizeChanged);
+    UT_DS_TEST_ADD(DS_FileRecordEncode_Test_TimeBackwards);
+    UT_DS_TEST_ADD(DS_FileRecordEncode_Test_LargeSeqDelta);
+    UT_DS_TEST_ADD(DS_FileRecordEncode_Test_LargeTimeDelta);
+    UT_DS_TEST_ADD(DS_FileRecordEncode_Test_NotTelemetry);
+    UT_DS_TEST_ADD(DS_FileRecordFind_Test_Nominal);
+    UT_DS_TEST_ADD(DS_FileRecordFind_Test_Replace);
+    UT_DS_TEST_ADD(DS_FileRecordApply_Test);
+
     UT_DS_TEST_ADD(DS_FileCloseDest_Test_PlatformConfigMoveFiles_Nominal);
+    UT_DS_TEST_ADD(DS_FileCloseDest_Test_PlatformConfigMoveFiles_Index);
+    UT_DS_TEST_ADD(DS_FileCloseDest_Test_PlatformConfigMoveFiles_Shard);
+    UT_DS_TEST_ADD(DS_FileCloseDest_Test_PlatformConfigMoveFiles_ShardError);
     UT_DS_TEST_ADD(DS_FileCloseDest_Test_PlatformConfigMoveFiles_MoveError);
     UT_DS_TEST_ADD(DS_FileCloseDest_Test_PlatformConfigMoveFiles_FilenameTooLarge);
     UT_DS_TEST_ADD(DS_FileCloseDest_Test_PlatformConfigMoveFiles_FilenameNull);
     UT_DS_TEST_ADD(DS_FileCloseDest_Test_PlatformConfigMoveFiles_MovenameNull);
     UT_DS_TEST_ADD(DS_FileCloseDest_Test_PlatformConfigMoveFiles_DisableMoveFiles);
+    UT_DS_TEST_ADD(DS_FileCloseDest_Test_RememberClosedFile);
+    UT_DS_TEST_ADD(DS_FileCloseDest_Test_MoveErrorNotRemembered);
+    UT_DS_TEST_ADD(DS_FileCloseDest_Test_Trailer);
+    UT_DS_TEST_ADD(DS_FileCloseDest_Test_Compressed);
+
+    UT_DS_TEST_ADD(DS_FileStorageRemember_Test_Ring);
+    UT_DS_TEST_ADD(DS_FileStorageRemember_Test_Manifest);
+    UT_DS_TEST_ADD(DS_FileStorageRemember_Test_Index);
+    UT_DS_TEST_ADD(DS_FileStorageRemember_Test_HistoryFull);
+    UT_DS_TEST_ADD(DS_FileStorageEvict_Test_Nominal);
+    UT_DS_TEST_ADD(DS_FileStorageEvict_Test_Manifest);
+    UT_DS_TEST_ADD(DS_FileStorageEvict_Test_RemoveError);
+    UT_DS_TEST_ADD(DS_FileStorageEvict_Test_Index);
+    UT_DS_TEST_ADD(DS_FileStorageEvict_Test_IndexRemoveError);
+    UT_DS_TEST_ADD(DS_FileStorageEvict_Test_Empty);
+    UT_DS_TEST_ADD(DS_FileStorageVictim_Test_LowestPriority);
+    UT_DS_TEST_ADD(DS_FileStorageVictim_Test_OldestOnTie);
+    UT_DS_TEST_ADD(DS_FileStorageVictim_Test_HigherPriorityKept);
+    UT_DS_TEST_ADD(DS_FileStorageCheck_Test_NoBudget);
+    UT_DS_TEST_ADD(DS_FileStorageCheck_Test_DestBudget);
+    UT_DS_TEST_ADD(DS_FileStorageCheck_Test_GlobalBudget);
+    UT_DS_TEST_ADD(DS_FileStorageCheck_Test_GlobalBudgetFull);
 
     UT_DS_TEST_ADD(DS_FileTestAge_Test_Nominal);
     UT_DS_TEST_ADD(DS_FileTestAge_Test_ExceedMaxAge);
     UT_DS_TEST_ADD(DS_FileTestAge_Test_NullTable);
+    UT_DS_TEST_ADD(DS_FileTestAge_Test_RingCheckpoint);
 
     UT_DS_TEST_ADD(DS_IsPacketFiltered_Test_AlgX0);
     UT_DS_TEST_ADD(DS_IsPacketFiltered_Test_AlgN0);
@@ -1341,7 +5790,86 @@ void UtTest_Setup(void)
     UT_DS_TEST_ADD(DS_IsPacketFiltered_Test_TimeFilter1);
     UT_DS_TEST_ADD(DS_IsPacketFiltered_Test_TimeFilter2);
     UT_DS_TEST_ADD(DS_IsPacketFiltered_Test_TimeFilter3);
+    UT_DS_TEST_ADD(DS_DecimateAlgorithmX_Test_Nominal);
+    UT_DS_TEST_ADD(DS_DecimateAlgorithmX_Test_Zero);
+    UT_DS_TEST_ADD(DS_DecimateAlgorithmX_Test_Limit);
+    UT_DS_TEST_ADD(DS_IsPacketUnchanged_Test_First);
+    UT_DS_TEST_ADD(DS_IsPacketUnchanged_Test_Unchanged);
+    UT_DS_TEST_ADD(DS_IsPacketUnchanged_Test_Changed);
+    UT_DS_TEST_ADD(DS_IsPacketUnchanged_Test_Heartbeat);
+    UT_DS_TEST_ADD(DS_IsPacketUnchanged_Test_Command);
+    UT_DS_TEST_ADD(DS_IsPacketUnchanged_Test_HeaderOnly);
+    UT_DS_TEST_ADD(DS_IsPacketInWindow_Test_First);
+    UT_DS_TEST_ADD(DS_IsPacketInWindow_Test_Within);
+    UT_DS_TEST_ADD(DS_IsPacketInWindow_Test_Elapsed);
+    UT_DS_TEST_ADD(DS_IsPacketInWindow_Test_TimeBackwards);
+    UT_DS_TEST_ADD(DS_IsPacketInWindow_Test_LongWindow);
+    UT_DS_TEST_ADD(DS_IsPacketMatched_Test_NoTerms);
+    UT_DS_TEST_ADD(DS_IsPacketMatched_Test_MatchAll);
+    UT_DS_TEST_ADD(DS_IsPacketMatched_Test_MatchAny);
+    UT_DS_TEST_ADD(DS_IsPacketMatched_Test_ShortPacket);
+    UT_DS_TEST_ADD(DS_PacketHash_Test_Empty);
+    UT_DS_TEST_ADD(DS_IsPacketOverRate_Test_NoLimit);
+    UT_DS_TEST_ADD(DS_IsPacketOverRate_Test_First);
+    UT_DS_TEST_ADD(DS_IsPacketOverRate_Test_PacketLimit);
+    UT_DS_TEST_ADD(DS_IsPacketOverRate_Test_Refill);
+    UT_DS_TEST_ADD(DS_IsPacketOverRate_Test_ByteLimit);
+    UT_DS_TEST_ADD(DS_IsPacketOverRate_Test_LimitLowered);
+    UT_DS_TEST_ADD(DS_IsPacketOverRate_Test_TimeBackwards);
+    UT_DS_TEST_ADD(DS_FileEchoRecord_Test_Nominal);
+    UT_DS_TEST_ADD(DS_FileEchoRecord_Test_Overwrite);
+    UT_DS_TEST_ADD(DS_IsPacketEcho_Test_Match);
+    UT_DS_TEST_ADD(DS_IsPacketEcho_Test_NoMatch);
+    UT_DS_TEST_ADD(DS_IsPacketEcho_Test_SequenceCollision);
+    UT_DS_TEST_ADD(DS_IsPacketEcho_Test_Expired);
+    UT_DS_TEST_ADD(DS_IsPacketEcho_Test_NonePending);
 
     UT_DS_TEST_ADD(DS_FileTransmit_Test_Nominal);
     UT_DS_TEST_ADD(DS_FileTransmit_Test_NoBuf);
+    UT_DS_TEST_ADD(DS_FileTransmitDestStats_Test_Nominal);
+    UT_DS_TEST_ADD(DS_FileTransmitDestStats_Test_NoBuf);
+    UT_DS_TEST_ADD(DS_FileManifestName_Test_Nominal);
+    UT_DS_TEST_ADD(DS_FileManifestName_Test_MoveDisabled);
+    UT_DS_TEST_ADD(DS_FileManifestName_Test_NoMovename);
+    UT_DS_TEST_ADD(DS_FileManifestName_Test_TooLong);
+    UT_DS_TEST_ADD(DS_FileManifestAppend_Test_Nominal);
+    UT_DS_TEST_ADD(DS_FileManifestAppend_Test_PartialTail);
+    UT_DS_TEST_ADD(DS_FileManifestAppend_Test_WriteError);
+    UT_DS_TEST_ADD(DS_FileManifestEvict_Test_Nominal);
+    UT_DS_TEST_ADD(DS_FileManifestWrite_Test_Shared);
+    UT_DS_TEST_ADD(DS_FileManifestWrite_Test_Replace);
+    UT_DS_TEST_ADD(DS_FileManifestWrite_Test_OpenError);
+    UT_DS_TEST_ADD(DS_FileManifestWrite_Test_WriteError);
+    UT_DS_TEST_ADD(DS_FileTransmitManifest_Test_Nominal);
+    UT_DS_TEST_ADD(DS_FileTransmitManifest_Test_NoBuf);
+
+    UT_DS_TEST_ADD(DS_FileStorePacket_Test_Recorder);
+    UT_DS_TEST_ADD(DS_FileStorePacket_Test_Cache);
+    UT_DS_TEST_ADD(DS_FileRecorderRoom_Test_ExactFit);
+    UT_DS_TEST_ADD(DS_FileRecorderStore_Test_Holding);
+    UT_DS_TEST_ADD(DS_FileRecorderStore_Test_DumpingFull);
+    UT_DS_TEST_ADD(DS_FileRecorderStore_Test_InvalidLength);
+    UT_DS_TEST_ADD(DS_FileRecorderStore_Test_Wrap);
+    UT_DS_TEST_ADD(DS_FileRecorderCheck_Test_Trigger);
+    UT_DS_TEST_ADD(DS_FileRecorderCheck_Test_NoTrigger);
+    UT_DS_TEST_ADD(DS_FileRecorderDrain_Test_Complete);
+    UT_DS_TEST_ADD(DS_FileRecorderDrain_Test_Limit);
+    UT_DS_TEST_ADD(DS_FileRecorderDrain_Test_PostWindow);
+    UT_DS_TEST_ADD(DS_FileRecorderDrain_Test_DestDisabled);
+    UT_DS_TEST_ADD(DS_FileCacheIndex_Test_Nominal);
+    if (DS_CACHE_RESERVED_ENTRIES > 1)
+    {
+        UT_DS_TEST_ADD(DS_FileCacheIndex_Test_Chain);
+    }
+    UT_DS_TEST_ADD(DS_FileCacheStore_Test_Nominal);
+    UT_DS_TEST_ADD(DS_FileCacheStore_Test_Truncated);
+    UT_DS_TEST_ADD(DS_FileCacheStore_Test_Overflow);
+    UT_DS_TEST_ADD(DS_FileCacheRebuild_Test_Removed);
+    UT_DS_TEST_ADD(DS_FileCacheRebuild_Test_Kept);
+    UT_DS_TEST_ADD(DS_FileCacheFind_Test_Found);
+    UT_DS_TEST_ADD(DS_FileCacheFind_Test_NotFound);
+    UT_DS_TEST_ADD(DS_FileCacheWrite_Test_Nominal);
+    UT_DS_TEST_ADD(DS_FileCacheWrite_Test_Skipped);
+    UT_DS_TEST_ADD(DS_FileCacheWrite_Test_CreateError);
+    UT_DS_TEST_ADD(DS_FileCacheWrite_Test_WriteError);
 }
@@ -0,0 +1,683 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+/**
+ * @file
+ *   This file contains unit test cases for the functions contained in the file ds_replay.c
+ */
+
+/*
+ * Includes
+ */
+
+#include "ds_app.h"
+#include "ds_appdefs.h"
+#include "ds_extract.h"
+#include "ds_file.h"
+#include "ds_replay.h"
+#include "ds_msg.h"
+#include "ds_msgdefs.h"
+#include "ds_eventids.h"
+#include "ds_test_utils.h"
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+void UT_DS_ExtractDataRange_CustomHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    uint32 *FileSize = UT_Hook_GetArgValueByName(Context, "FileSize", uint32 *);
+    uint32 *DataEnd  = UT_Hook_GetArgValueByName(Context, "DataEnd", uint32 *);
+    uint32  DataSize = *((uint32 *)UserObj);
+
+    *FileSize = UT_Hook_GetArgValueByName(Context, "DataStart", uint32) + DataSize;
+    *DataEnd  = *FileSize;
+}
+
+void UT_DS_OS_TaskDelay_ResumeHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    DS_AppData.ReplayPauseRequested = false;
+}
+
+void UT_DS_SetReplayRequest(uint32 *DataSize)
+{
+    strncpy(DS_AppData.ReplayFilename, "replay", sizeof(DS_AppData.ReplayFilename) - 1);
+
+    DS_AppData.ReplayRate  = 1;
+    DS_AppData.ReplayState = DS_REPLAY_ACTIVE;
+
+    if (DataSize != NULL)
+    {
+        UT_SetHandlerFunction(UT_KEY(DS_ExtractDataRange), UT_DS_ExtractDataRange_CustomHandler, DataSize);
+    }
+}
+
+void DS_ReplayInit_Test_Nominal(void)
+{
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_ReplayInit(), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.ReplayState, DS_REPLAY_IDLE);
+    UtAssert_STUB_COUNT(OS_MutSemCreate, 1);
+    UtAssert_STUB_COUNT(OS_CountSemCreate, 1);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_ReplayInit_Test_MutexCreateError(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(OS_MutSemCreate), OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_ReplayInit(), OS_ERROR);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_CountSemCreate, 0);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_INIT_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_ReplayInit_Test_SemCreateError(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(OS_CountSemCreate), OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_ReplayInit(), OS_ERROR);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_INIT_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_ReplayInit_Test_ChildTaskError(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CreateChildTask), CFE_ES_ERR_CHILD_TASK_CREATE);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_ReplayInit(), CFE_ES_ERR_CHILD_TASK_CREATE);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_INIT_ERR_EID);
+}
+
+void DS_ReplayTask_Test_Nominal(void)
+{
+    /* Set up the semaphore - second take fails and ends the task */
+    OS_OpenCreate(&DS_AppData.ReplaySemaphore, NULL, 0, 0);
+    DS_AppData.ReplayState       = DS_REPLAY_PAUSED;
+    DS_AppData.ReplayStopPending = true;
+
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemTake), 2, OS_ERROR);
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_ReplayTask());
+
+    /* Verify results - one (failed) replay then task exit */
+    UtAssert_UINT32_EQ(DS_AppData.ReplayState, DS_REPLAY_IDLE);
+    UtAssert_UINT32_EQ(DS_AppData.ReplayErrCounter, 1);
+    UtAssert_BOOL_FALSE(DS_AppData.ReplayStopPending);
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(DS_AppData.ReplaySemaphore));
+    UtAssert_STUB_COUNT(OS_CountSemTake, 2);
+    UtAssert_STUB_COUNT(CFE_ES_PerfLogAdd, 2);
+    UtAssert_STUB_COUNT(CFE_ES_ExitChildTask, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_REPLAY_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, DS_REPLAY_ERR_EID);
+}
+
+void DS_ReplayFile_Test_Nominal(void)
+{
+    uint32         DataSize      = 32;
+    CFE_MSG_Size_t PacketSize[2] = {16, 16};
+
+    UT_DS_SetReplayRequest(&DataSize);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 32);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), PacketSize, sizeof(PacketSize), false);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_ReplayFile());
+
+    /* Verify results - both packets sent from a single read */
+    UtAssert_UINT32_EQ(DS_AppData.ReplayErrCounter, 0);
+    UtAssert_UINT32_EQ(DS_AppData.ReplayPacketCount, 2);
+    UtAssert_UINT32_EQ(DS_AppData.ReplayStatus.Offset, DS_AppData.ReplayStatus.DataEnd);
+    UtAssert_STUB_COUNT(OS_read, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 2);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_REPLAY_DONE_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+}
+
+void DS_ReplayFile_Test_OpenError(void)
+{
+    uint32 DataSize = 32;
+
+    UT_DS_SetReplayRequest(&DataSize);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_ReplayFile());
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.ReplayErrCounter, 1);
+    UtAssert_STUB_COUNT(DS_ExtractDataRange, 0);
+    UtAssert_STUB_COUNT(OS_close, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_REPLAY_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_ReplayFile_Test_SizeError(void)
+{
+    UT_DS_SetReplayRequest(NULL);
+
+    UT_SetDefaultReturnValue(UT_KEY(DS_ExtractDataRange), OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_ReplayFile());
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.ReplayErrCounter, 1);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_REPLAY_ERR_EID);
+}
+
+void DS_ReplayFile_Test_FormatError(void)
+{
+    uint32 DataSize = 32;
+
+    UT_DS_SetReplayRequest(&DataSize);
+
+    UT_SetDefaultReturnValue(UT_KEY(DS_ExtractCheckFormat), OS_ERR_NOT_IMPLEMENTED);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_ReplayFile());
+
+    /* Verify results - compressed or ring files are not replayed */
+    UtAssert_UINT32_EQ(DS_AppData.ReplayErrCounter, 1);
+    UtAssert_STUB_COUNT(OS_read, 0);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_REPLAY_ERR_EID);
+}
+
+void DS_ReplayFile_Test_SeekError(void)
+{
+    uint32 DataSize = 32;
+
+    UT_DS_SetReplayRequest(&DataSize);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_lseek), OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_ReplayFile());
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.ReplayErrCounter, 1);
+    UtAssert_STUB_COUNT(OS_read, 0);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_REPLAY_ERR_EID);
+}
+
+void DS_ReplayFile_Test_Stopped(void)
+{
+    uint32 DataSize = 32;
+
+    UT_DS_SetReplayRequest(&DataSize);
+
+    DS_AppData.ReplayStopPending = true;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_ReplayFile());
+
+    /* Verify results - stop is not an error */
+    UtAssert_UINT32_EQ(DS_AppData.ReplayErrCounter, 0);
+    UtAssert_UINT32_EQ(DS_AppData.ReplayPacketCount, 0);
+    UtAssert_STUB_COUNT(OS_read, 0);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_REPLAY_DONE_EID);
+}
+
+void DS_ReplayFile_Test_Paused(void)
+{
+    uint32         DataSize   = 16;
+    CFE_MSG_Size_t PacketSize = 16;
+
+    UT_DS_SetReplayRequest(&DataSize);
+
+    DS_AppData.ReplayPauseRequested = true;
+
+    /* Resume after the first poll delay */
+    UT_SetHandlerFunction(UT_KEY(OS_TaskDelay), UT_DS_OS_TaskDelay_ResumeHandler, NULL);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 16);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &PacketSize, sizeof(PacketSize), false);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_ReplayFile());
+
+    /* Verify results - child task applies both state changes */
+    UtAssert_UINT32_EQ(DS_AppData.ReplayState, DS_REPLAY_ACTIVE);
+    UtAssert_UINT32_EQ(DS_AppData.ReplayPacketCount, 1);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_REPLAY_DONE_EID);
+}
+
+void DS_ReplayFile_Test_Seek(void)
+{
+    uint32         DataSize   = 16;
+    CFE_MSG_Size_t PacketSize = 16;
+
+    UT_DS_SetReplayRequest(&DataSize);
+
+    DS_AppData.ReplaySeekPending = true;
+
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 16);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &PacketSize, sizeof(PacketSize), false);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_ReplayFile());
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(DS_AppData.ReplaySeekPending);
+    UtAssert_UINT32_EQ(DS_AppData.ReplayPacketCount, 1);
+    UtAssert_STUB_COUNT(DS_ExtractIndexRange, 1);
+    UtAssert_STUB_COUNT(OS_lseek, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_REPLAY_DONE_EID);
+}
+
+void DS_ReplayFile_Test_SeekFileError(void)
+{
+    uint32 DataSize = 16;
+
+    UT_DS_SetReplayRequest(&DataSize);
+
+    DS_AppData.ReplaySeekPending = true;
+
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 2, OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_ReplayFile());
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.ReplayErrCounter, 1);
+    UtAssert_STUB_COUNT(OS_read, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_REPLAY_ERR_EID);
+}
+
+void DS_ReplayFile_Test_ReadError(void)
+{
+    uint32 DataSize = 32;
+
+    UT_DS_SetReplayRequest(&DataSize);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_ReplayFile());
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.ReplayErrCounter, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_REPLAY_ERR_EID);
+}
+
+void DS_ReplayFile_Test_SendError(void)
+{
+    uint32         DataSize   = 16;
+    CFE_MSG_Size_t PacketSize = 16;
+
+    UT_DS_SetReplayRequest(&DataSize);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 16);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &PacketSize, sizeof(PacketSize), false);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_TransmitMsg), CFE_SB_BAD_ARGUMENT);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_ReplayFile());
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.ReplayErrCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.ReplayPacketCount, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_REPLAY_ERR_EID);
+}
+
+void DS_ReplayNextPacket_Test_Nominal(void)
+{
+    CFE_MSG_Message_t *MsgPtr        = NULL;
+    CFE_MSG_Size_t     PacketSize[2] = {16, 16};
+
+    DS_AppData.ReplayStatus.DataEnd = 32;
+
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 32);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), PacketSize, sizeof(PacketSize), false);
+
+    /* Execute the function being tested - first packet needs a read */
+    UtAssert_INT32_EQ(DS_ReplayNextPacket(&MsgPtr), OS_SUCCESS);
+    UtAssert_ADDRESS_EQ(MsgPtr, DS_AppData.ReplayStatus.Buffer);
+
+    /* Execute the function being tested - second packet is already buffered */
+    UtAssert_INT32_EQ(DS_ReplayNextPacket(&MsgPtr), OS_SUCCESS);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.ReplayStatus.Offset, 32);
+    UtAssert_UINT32_EQ(DS_AppData.ReplayStatus.BufferPosition, 32);
+    UtAssert_STUB_COUNT(OS_read, 1);
+}
+
+void DS_ReplayNextPacket_Test_PacketSpansBuffer(void)
+{
+    CFE_MSG_Message_t *MsgPtr        = NULL;
+    CFE_MSG_Size_t     PacketSize[3] = {16, 16, 16};
+
+    /* Second packet starts 8 bytes before the end of the buffer */
+    DS_AppData.ReplayStatus.DataEnd        = DS_REPLAY_BUFFER_SIZE + 8;
+    DS_AppData.ReplayStatus.Offset         = DS_REPLAY_BUFFER_SIZE - 8;
+    DS_AppData.ReplayStatus.BufferCount    = DS_REPLAY_BUFFER_SIZE;
+    DS_AppData.ReplayStatus.BufferPosition = DS_REPLAY_BUFFER_SIZE - 8;
+
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 8);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), PacketSize, sizeof(PacketSize), false);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_ReplayNextPacket(&MsgPtr), OS_SUCCESS);
+
+    /* Verify results - partial packet moved to the front of the buffer */
+    UtAssert_ADDRESS_EQ(MsgPtr, DS_AppData.ReplayStatus.Buffer);
+    UtAssert_UINT32_EQ(DS_AppData.ReplayStatus.BufferCount, 16);
+    UtAssert_UINT32_EQ(DS_AppData.ReplayStatus.Offset, DS_REPLAY_BUFFER_SIZE + 8);
+    UtAssert_STUB_COUNT(OS_read, 1);
+}
+
+void DS_ReplayNextPacket_Test_InvalidPacketSize(void)
+{
+    CFE_MSG_Message_t *MsgPtr     = NULL;
+    CFE_MSG_Size_t     PacketSize = 0;
+
+    DS_AppData.ReplayStatus.DataEnd = 32;
+
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 32);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &PacketSize, sizeof(PacketSize), false);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_ReplayNextPacket(&MsgPtr), OS_ERR_INVALID_SIZE);
+
+    /* Verify results */
+    UtAssert_ADDRESS_EQ(MsgPtr, NULL);
+    UtAssert_ZERO(DS_AppData.ReplayStatus.Offset);
+}
+
+void DS_ReplayNextPacket_Test_TaggedRecord(void)
+{
+    CFE_MSG_Message_t *MsgPtr     = NULL;
+    CFE_MSG_Size_t     PacketSize = 16;
+
+    /* Delta and truncated records have the tag bit set in their first byte */
+    DS_AppData.ReplayStatus.DataEnd     = 32;
+    DS_AppData.ReplayStatus.BufferCount = 32;
+
+    *((uint8 *)DS_AppData.ReplayStatus.Buffer) = DS_FILE_RECORD_TAG_BIT;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &PacketSize, sizeof(PacketSize), false);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_ReplayNextPacket(&MsgPtr), OS_ERR_NOT_IMPLEMENTED);
+
+    /* Verify results */
+    UtAssert_ADDRESS_EQ(MsgPtr, NULL);
+    UtAssert_ZERO(DS_AppData.ReplayStatus.Offset);
+    UtAssert_STUB_COUNT(OS_read, 0);
+}
+
+void DS_ReplayNextPacket_Test_TruncatedPacket(void)
+{
+    CFE_MSG_Message_t *MsgPtr        = NULL;
+    CFE_MSG_Size_t     PacketSize[2] = {48, 48};
+
+    /* Data range ends in the middle of the packet */
+    DS_AppData.ReplayStatus.DataEnd = 32;
+
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 32);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), PacketSize, sizeof(PacketSize), false);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_ReplayNextPacket(&MsgPtr), OS_ERR_INVALID_SIZE);
+
+    /* Verify results */
+    UtAssert_ADDRESS_EQ(MsgPtr, NULL);
+    UtAssert_STUB_COUNT(OS_read, 1);
+}
+
+void DS_ReplayNextPacket_Test_ReadError(void)
+{
+    CFE_MSG_Message_t *MsgPtr = NULL;
+
+    DS_AppData.ReplayStatus.DataEnd = 32;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 8);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_ReplayNextPacket(&MsgPtr), OS_ERR_INVALID_SIZE);
+
+    /* Verify results */
+    UtAssert_ADDRESS_EQ(MsgPtr, NULL);
+    UtAssert_STUB_COUNT(CFE_MSG_GetSize, 0);
+}
+
+void DS_ReplayPacket_Test_Nominal(void)
+{
+    CFE_TIME_SysTime_t PacketTime = {50, 0};
+
+    DS_AppData.ReplayRate = 1;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgTime), &PacketTime, sizeof(PacketTime), false);
+
+    /* Execute the function being tested - first packet is not delayed */
+    UtAssert_INT32_EQ(DS_ReplayPacket(&UT_CmdBuf.Buf.Msg), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.ReplayPacketCount, 1);
+    UtAssert_BOOL_TRUE(DS_AppData.ReplayStatus.LastTimeValid);
+    UtAssert_UINT32_EQ(DS_AppData.ReplayStatus.LastTime.Seconds, 50);
+    UtAssert_STUB_COUNT(CFE_TIME_Compare, 0);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 0);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+
+    /* Packet is remembered so DS does not store it again */
+    UtAssert_STUB_COUNT(DS_FileEchoRecord, 1);
+}
+
+void DS_ReplayPacket_Test_Paced(void)
+{
+    DS_AppData.ReplayRate                 = 2;
+    DS_AppData.ReplayStatus.LastTimeValid = true;
+    DS_AppData.ReplayStatus.BurstCount    = 5;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TIME_Compare), CFE_TIME_A_GT_B);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TIME_Sub2MicroSecs), 500000);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_ReplayPacket(&UT_CmdBuf.Buf.Msg), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_ZERO(DS_AppData.ReplayStatus.BurstCount);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+}
+
+void DS_ReplayPacket_Test_TimeBackwards(void)
+{
+    DS_AppData.ReplayRate                 = 1;
+    DS_AppData.ReplayStatus.LastTimeValid = true;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TIME_Compare), CFE_TIME_A_LT_B);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_ReplayPacket(&UT_CmdBuf.Buf.Msg), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.ReplayStatus.BurstCount, 1);
+    UtAssert_STUB_COUNT(CFE_TIME_Subtract, 0);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 0);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+}
+
+void DS_ReplayPacket_Test_BurstLimit(void)
+{
+    DS_AppData.ReplayRate              = 1;
+    DS_AppData.ReplayStatus.BurstCount = DS_REPLAY_BURST_LIMIT - 1;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_ReplayPacket(&UT_CmdBuf.Buf.Msg), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_ZERO(DS_AppData.ReplayStatus.BurstCount);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+}
+
+void DS_ReplayPacket_Test_Skipped(void)
+{
+    CFE_TIME_SysTime_t PacketTime = {50, 0};
+
+    DS_AppData.ReplayRate               = 1;
+    DS_AppData.ReplayStatus.SkipSeconds = 100;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgTime), &PacketTime, sizeof(PacketTime), false);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_ReplayPacket(&UT_CmdBuf.Buf.Msg), CFE_SUCCESS);
+
+    /* Verify results - packet is before the seek time */
+    UtAssert_UINT32_EQ(DS_AppData.ReplayStatus.SkipSeconds, 100);
+    UtAssert_ZERO(DS_AppData.ReplayPacketCount);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    UtAssert_STUB_COUNT(DS_FileEchoRecord, 0);
+}
+
+void DS_ReplayPacket_Test_SendError(void)
+{
+    DS_AppData.ReplayRate = 1;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_TransmitMsg), CFE_SB_BAD_ARGUMENT);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_ReplayPacket(&UT_CmdBuf.Buf.Msg), CFE_SB_BAD_ARGUMENT);
+
+    /* Verify results */
+    UtAssert_ZERO(DS_AppData.ReplayPacketCount);
+}
+
+void DS_ReplaySeek_Test_Nominal(void)
+{
+    DS_AppData.ReplaySeekPending           = true;
+    DS_AppData.ReplaySeekSeconds           = 1000;
+    DS_AppData.ReplayStatus.DataStart      = 64;
+    DS_AppData.ReplayStatus.DataEnd        = 640;
+    DS_AppData.ReplayStatus.Offset         = 320;
+    DS_AppData.ReplayStatus.BufferCount    = 256;
+    DS_AppData.ReplayStatus.BufferPosition = 128;
+    DS_AppData.ReplayStatus.LastTimeValid  = true;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_ReplaySeek(), OS_SUCCESS);
+
+    /* Verify results - no index so replay restarts from the first packet */
+    UtAssert_BOOL_FALSE(DS_AppData.ReplaySeekPending);
+    UtAssert_UINT32_EQ(DS_AppData.ReplayStatus.Offset, 64);
+    UtAssert_ZERO(DS_AppData.ReplayStatus.BufferCount);
+    UtAssert_ZERO(DS_AppData.ReplayStatus.BufferPosition);
+    UtAssert_UINT32_EQ(DS_AppData.ReplayStatus.SkipSeconds, 1000);
+    UtAssert_BOOL_FALSE(DS_AppData.ReplayStatus.LastTimeValid);
+    UtAssert_STUB_COUNT(DS_ExtractIndexRange, 1);
+}
+
+void DS_ReplaySeek_Test_SeekError(void)
+{
+    DS_AppData.ReplaySeekPending      = true;
+    DS_AppData.ReplayStatus.DataStart = 64;
+    DS_AppData.ReplayStatus.Offset    = 320;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_lseek), OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_ReplaySeek(), OS_ERROR);
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(DS_AppData.ReplaySeekPending);
+    UtAssert_UINT32_EQ(DS_AppData.ReplayStatus.Offset, 320);
+}
+
+void UtTest_Setup(void)
+{
+    UT_DS_TEST_ADD(DS_ReplayInit_Test_Nominal);
+    UT_DS_TEST_ADD(DS_ReplayInit_Test_MutexCreateError);
+    UT_DS_TEST_ADD(DS_ReplayInit_Test_SemCreateError);
+    UT_DS_TEST_ADD(DS_ReplayInit_Test_ChildTaskError);
+
+    UT_DS_TEST_ADD(DS_ReplayTask_Test_Nominal);
+
+    UT_DS_TEST_ADD(DS_ReplayFile_Test_Nominal);
+    UT_DS_TEST_ADD(DS_ReplayFile_Test_OpenError);
+    UT_DS_TEST_ADD(DS_ReplayFile_Test_SizeError);
+    UT_DS_TEST_ADD(DS_ReplayFile_Test_FormatError);
+    UT_DS_TEST_ADD(DS_ReplayFile_Test_SeekError);
+    UT_DS_TEST_ADD(DS_ReplayFile_Test_Stopped);
+    UT_DS_TEST_ADD(DS_ReplayFile_Test_Paused);
+    UT_DS_TEST_ADD(DS_ReplayFile_Test_Seek);
+    UT_DS_TEST_ADD(DS_ReplayFile_Test_SeekFileError);
+    UT_DS_TEST_ADD(DS_ReplayFile_Test_ReadError);
+    UT_DS_TEST_ADD(DS_ReplayFile_Test_SendError);
+
+    UT_DS_TEST_ADD(DS_ReplayNextPacket_Test_Nominal);
+    UT_DS_TEST_ADD(DS_ReplayNextPacket_Test_PacketSpansBuffer);
+    UT_DS_TEST_ADD(DS_ReplayNextPacket_Test_InvalidPacketSize);
+    UT_DS_TEST_ADD(DS_ReplayNextPacket_Test_TaggedRecord);
+    UT_DS_TEST_ADD(DS_ReplayNextPacket_Test_TruncatedPacket);
+    UT_DS_TEST_ADD(DS_ReplayNextPacket_Test_ReadError);
+
+    UT_DS_TEST_ADD(DS_ReplayPacket_Test_Nominal);
+    UT_DS_TEST_ADD(DS_ReplayPacket_Test_Paced);
+    UT_DS_TEST_ADD(DS_ReplayPacket_Test_TimeBackwards);
+    UT_DS_TEST_ADD(DS_ReplayPacket_Test_BurstLimit);
+    UT_DS_TEST_ADD(DS_ReplayPacket_Test_Skipped);
+    UT_DS_TEST_ADD(DS_ReplayPacket_Test_SendError);
+
+    UT_DS_TEST_ADD(DS_ReplaySeek_Test_Nominal);
+    UT_DS_TEST_ADD(DS_ReplaySeek_Test_SeekError);
+}
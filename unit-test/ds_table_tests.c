@@ -28,6 +28,7 @@
 #include "ds_app.h"
 #include "ds_appdefs.h"
 #include "ds_table.h"
+#include "ds_file.h"
 #include "ds_msg.h"
 #include "ds_msgdefs.h"
 #include "ds_msgids.h"
@@ -459,6 +460,7 @@ void DS_TableVerifyDestFileEntry_Test_NominalErrZero(void)
     uint32             TableIndex = 0;
     uint32             ErrorCount = 0;
 
+    memset(&DestFileEntry, 0, sizeof(DestFileEntry));
     DestFileEntry.FileNameType  = DS_BY_TIME;
     DestFileEntry.EnableState   = DS_ENABLED;
     DestFileEntry.MaxFileSize   = 2048;
@@ -482,6 +484,7 @@ void DS_TableVerifyDestFileEntry_Test_InvalidPathnameErrZero(void)
     uint32             TableIndex = 0;
     uint32             ErrorCount = 0;
 
+    memset(&DestFileEntry, 0, sizeof(DestFileEntry));
     DestFileEntry.FileNameType  = DS_BY_TIME;
     DestFileEntry.EnableState   = DS_ENABLED;
     DestFileEntry.MaxFileSize   = 2048;
@@ -507,6 +510,7 @@ void DS_TableVerifyDestFileEntry_Test_InvalidBasenameErrZero(void)
     uint32             TableIndex = 0;
     uint32             ErrorCount = 0;
 
+    memset(&DestFileEntry, 0, sizeof(DestFileEntry));
     DestFileEntry.FileNameType  = DS_BY_TIME;
     DestFileEntry.EnableState   = DS_ENABLED;
     DestFileEntry.MaxFileSize   = 2048;
@@ -532,6 +536,7 @@ void DS_TableVerifyDestFileEntry_Test_InvalidFilenameTypeErrZero(void)
     uint32             TableIndex = 0;
     uint32             ErrorCount = 0;
 
+    memset(&DestFileEntry, 0, sizeof(DestFileEntry));
     DestFileEntry.FileNameType  = 99;
     DestFileEntry.EnableState   = DS_ENABLED;
     DestFileEntry.MaxFileSize   = 2048;
@@ -557,6 +562,7 @@ void DS_TableVerifyDestFileEntry_Test_InvalidFileEnableStateErrZero(void)
     uint32             TableIndex = 0;
     uint32             ErrorCount = 0;
 
+    memset(&DestFileEntry, 0, sizeof(DestFileEntry));
     DestFileEntry.FileNameType  = DS_BY_TIME;
     DestFileEntry.EnableState   = 99;
     DestFileEntry.MaxFileSize   = 2048;
@@ -582,6 +588,7 @@ void DS_TableVerifyDestFileEntry_Test_InvalidSizeErrZero(void)
     uint32             TableIndex = 0;
     uint32             ErrorCount = 0;
 
+    memset(&DestFileEntry, 0, sizeof(DestFileEntry));
     DestFileEntry.FileNameType  = DS_BY_TIME;
     DestFileEntry.EnableState   = DS_ENABLED;
     DestFileEntry.MaxFileSize   = DS_FILE_MIN_SIZE_LIMIT - 1;
@@ -607,6 +614,7 @@ void DS_TableVerifyDestFileEntry_Test_InvalidAgeErrZero(void)
     uint32             TableIndex = 0;
     uint32             ErrorCount = 0;
 
+    memset(&DestFileEntry, 0, sizeof(DestFileEntry));
     DestFileEntry.FileNameType  = DS_BY_TIME;
     DestFileEntry.EnableState   = DS_ENABLED;
     DestFileEntry.MaxFileSize   = 2048;
@@ -632,6 +640,7 @@ void DS_TableVerifyDestFileEntry_Test_InvalidSequenceCountErrZero(void)
     uint32             TableIndex = 0;
     uint32             ErrorCount = 0;
 
+    memset(&DestFileEntry, 0, sizeof(DestFileEntry));
     DestFileEntry.FileNameType  = DS_BY_TIME;
     DestFileEntry.EnableState   = DS_ENABLED;
     DestFileEntry.MaxFileSize   = 2048;
@@ -651,12 +660,247 @@ void DS_TableVerifyDestFileEntry_Test_InvalidSequenceCountErrZero(void)
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 }
 
+void DS_TableVerifyDestFileEntry_Test_InvalidFileModeErrZero(void)
+{
+    DS_DestFileEntry_t DestFileEntry;
+    uint32             TableIndex = 0;
+    uint32             ErrorCount = 0;
+
+    memset(&DestFileEntry, 0, sizeof(DestFileEntry));
+
+    DestFileEntry.FileNameType  = DS_BY_TIME;
+    DestFileEntry.EnableState   = DS_ENABLED;
+    DestFileEntry.MaxFileSize   = 2048;
+    DestFileEntry.MaxFileAge    = 100;
+    DestFileEntry.SequenceCount = 1;
+    DestFileEntry.FileMode      = 99;
+
+    strncpy(DestFileEntry.Pathname, "path", DS_PATHNAME_BUFSIZE);
+    strncpy(DestFileEntry.Basename, "pathname", DS_BASENAME_BUFSIZE);
+    strncpy(DestFileEntry.Extension, "ext", DS_EXTENSION_BUFSIZE);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_TableVerifyDestFileEntry(&DestFileEntry, TableIndex, ErrorCount));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FIL_TBL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_TableVerifyDestFileEntry_Test_InvalidStorageSizeErrZero(void)
+{
+    DS_DestFileEntry_t DestFileEntry;
+    uint32             TableIndex = 0;
+    uint32             ErrorCount = 0;
+
+    memset(&DestFileEntry, 0, sizeof(DestFileEntry));
+
+    DestFileEntry.FileNameType   = DS_BY_TIME;
+    DestFileEntry.EnableState    = DS_ENABLED;
+    DestFileEntry.MaxFileSize    = 2048;
+    DestFileEntry.MaxFileAge     = 100;
+    DestFileEntry.SequenceCount  = 1;
+    DestFileEntry.FileMode       = DS_FILE_MODE_LINEAR;
+    DestFileEntry.MaxStorageSize = 1024;
+
+    strncpy(DestFileEntry.Pathname, "path", DS_PATHNAME_BUFSIZE);
+    strncpy(DestFileEntry.Basename, "pathname", DS_BASENAME_BUFSIZE);
+    strncpy(DestFileEntry.Extension, "ext", DS_EXTENSION_BUFSIZE);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_TableVerifyDestFileEntry(&DestFileEntry, TableIndex, ErrorCount));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FIL_TBL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_TableVerifyDestFileEntry_Test_InvalidTrailerStateErrZero(void)
+{
+    DS_DestFileEntry_t DestFileEntry;
+    uint32             TableIndex = 0;
+    uint32             ErrorCount = 0;
+
+    memset(&DestFileEntry, 0, sizeof(DestFileEntry));
+
+    DestFileEntry.FileNameType  = DS_BY_TIME;
+    DestFileEntry.EnableState   = DS_ENABLED;
+    DestFileEntry.MaxFileSize   = 2048;
+    DestFileEntry.MaxFileAge    = 100;
+    DestFileEntry.SequenceCount = 1;
+    DestFileEntry.FileMode      = DS_FILE_MODE_LINEAR;
+    DestFileEntry.TrailerState  = 99;
+
+    strncpy(DestFileEntry.Pathname, "path", DS_PATHNAME_BUFSIZE);
+    strncpy(DestFileEntry.Basename, "pathname", DS_BASENAME_BUFSIZE);
+    strncpy(DestFileEntry.Extension, "ext", DS_EXTENSION_BUFSIZE);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_TableVerifyDestFileEntry(&DestFileEntry, TableIndex, ErrorCount));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FIL_TBL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_TableVerifyDestFileEntry_Test_InvalidCompressModeErrZero(void)
+{
+    DS_DestFileEntry_t DestFileEntry;
+    uint32             TableIndex = 0;
+    uint32             ErrorCount = 0;
+
+    memset(&DestFileEntry, 0, sizeof(DestFileEntry));
+
+    DestFileEntry.FileNameType  = DS_BY_TIME;
+    DestFileEntry.EnableState   = DS_ENABLED;
+    DestFileEntry.MaxFileSize   = 2048;
+    DestFileEntry.MaxFileAge    = 100;
+    DestFileEntry.SequenceCount = 1;
+    DestFileEntry.FileMode      = DS_FILE_MODE_LINEAR;
+    DestFileEntry.CompressMode  = 99;
+
+    strncpy(DestFileEntry.Pathname, "path", DS_PATHNAME_BUFSIZE);
+    strncpy(DestFileEntry.Basename, "pathname", DS_BASENAME_BUFSIZE);
+    strncpy(DestFileEntry.Extension, "ext", DS_EXTENSION_BUFSIZE);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_TableVerifyDestFileEntry(&DestFileEntry, TableIndex, ErrorCount));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FIL_TBL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_TableVerifyDestFileEntry_Test_InvalidSizeLimitModeErrZero(void)
+{
+    DS_DestFileEntry_t DestFileEntry;
+    uint32             TableIndex = 0;
+    uint32             ErrorCount = 0;
+
+    memset(&DestFileEntry, 0, sizeof(DestFileEntry));
+
+    DestFileEntry.FileNameType  = DS_BY_TIME;
+    DestFileEntry.EnableState   = DS_ENABLED;
+    DestFileEntry.MaxFileSize   = 2048;
+    DestFileEntry.MaxFileAge    = 100;
+    DestFileEntry.SequenceCount = 1;
+    DestFileEntry.FileMode      = DS_FILE_MODE_LINEAR;
+    DestFileEntry.SizeLimitMode = 99;
+
+    strncpy(DestFileEntry.Pathname, "path", DS_PATHNAME_BUFSIZE);
+    strncpy(DestFileEntry.Basename, "pathname", DS_BASENAME_BUFSIZE);
+    strncpy(DestFileEntry.Extension, "ext", DS_EXTENSION_BUFSIZE);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_TableVerifyDestFileEntry(&DestFileEntry, TableIndex, ErrorCount));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FIL_TBL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_TableVerifyDestFileEntry_Test_InvalidRecordModeErrZero(void)
+{
+    DS_DestFileEntry_t DestFileEntry;
+    uint32             TableIndex = 0;
+    uint32             ErrorCount = 0;
+
+    memset(&DestFileEntry, 0, sizeof(DestFileEntry));
+
+    DestFileEntry.FileNameType  = DS_BY_TIME;
+    DestFileEntry.EnableState   = DS_ENABLED;
+    DestFileEntry.MaxFileSize   = 2048;
+    DestFileEntry.MaxFileAge    = 100;
+    DestFileEntry.SequenceCount = 1;
+    DestFileEntry.FileMode      = DS_FILE_MODE_LINEAR;
+    DestFileEntry.RecordMode    = 99;
+
+    strncpy(DestFileEntry.Pathname, "path", DS_PATHNAME_BUFSIZE);
+    strncpy(DestFileEntry.Basename, "pathname", DS_BASENAME_BUFSIZE);
+    strncpy(DestFileEntry.Extension, "ext", DS_EXTENSION_BUFSIZE);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_TableVerifyDestFileEntry(&DestFileEntry, TableIndex, ErrorCount));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FIL_TBL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_TableVerifyDestFileEntry_Test_InvalidShardModeErrZero(void)
+{
+    DS_DestFileEntry_t DestFileEntry;
+    uint32             TableIndex = 0;
+    uint32             ErrorCount = 0;
+
+    memset(&DestFileEntry, 0, sizeof(DestFileEntry));
+
+    DestFileEntry.FileNameType  = DS_BY_TIME;
+    DestFileEntry.EnableState   = DS_ENABLED;
+    DestFileEntry.MaxFileSize   = 2048;
+    DestFileEntry.MaxFileAge    = 100;
+    DestFileEntry.SequenceCount = 1;
+    DestFileEntry.FileMode      = DS_FILE_MODE_LINEAR;
+    DestFileEntry.ShardMode     = DS_SHARD_BY_COUNT;
+    DestFileEntry.ShardFiles    = 100;
+
+    strncpy(DestFileEntry.Pathname, "path", DS_PATHNAME_BUFSIZE);
+    strncpy(DestFileEntry.Basename, "pathname", DS_BASENAME_BUFSIZE);
+    strncpy(DestFileEntry.Extension, "ext", DS_EXTENSION_BUFSIZE);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_TableVerifyDestFileEntry(&DestFileEntry, TableIndex, ErrorCount));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FIL_TBL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_TableVerifyDestFileEntry_Test_RingStoreLengthErrZero(void)
+{
+    DS_DestFileEntry_t DestFileEntry;
+    uint32             TableIndex = 0;
+    uint32             ErrorCount = 0;
+
+    memset(&DestFileEntry, 0, sizeof(DestFileEntry));
+
+    DestFileEntry.FileNameType  = DS_BY_TIME;
+    DestFileEntry.EnableState   = DS_ENABLED;
+    DestFileEntry.MaxFileSize   = 2048;
+    DestFileEntry.MaxFileAge    = 100;
+    DestFileEntry.SequenceCount = 1;
+    DestFileEntry.FileMode      = DS_FILE_MODE_RING;
+
+    strncpy(DestFileEntry.Pathname, "path", DS_PATHNAME_BUFSIZE);
+    strncpy(DestFileEntry.Basename, "pathname", DS_BASENAME_BUFSIZE);
+    strncpy(DestFileEntry.Extension, "ext", DS_EXTENSION_BUFSIZE);
+
+    /* Current filter table truncates packets stored in this destination */
+    DS_AppData.FilterTblPtr->Packet[0].Filter[0].MaxStoreLength = DS_TRUNCATE_MAX_LENGTH;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_TableVerifyDestFileEntry(&DestFileEntry, TableIndex, ErrorCount));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FIL_TBL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
 void DS_TableVerifyDestFileEntry_Test_InvalidFilenameTypeErrNonZero(void)
 {
     DS_DestFileEntry_t DestFileEntry;
     uint32             TableIndex = 0;
     uint32             ErrorCount = 1;
 
+    memset(&DestFileEntry, 0, sizeof(DestFileEntry));
     DestFileEntry.FileNameType  = 99;
     DestFileEntry.EnableState   = DS_ENABLED;
     DestFileEntry.MaxFileSize   = 2048;
@@ -680,6 +924,7 @@ void DS_TableVerifyDestFileEntry_Test_InvalidFileEnableStateErrNonZero(void)
     uint32             TableIndex = 0;
     uint32             ErrorCount = 1;
 
+    memset(&DestFileEntry, 0, sizeof(DestFileEntry));
     DestFileEntry.FileNameType  = DS_BY_TIME;
     DestFileEntry.EnableState   = 99;
     DestFileEntry.MaxFileSize   = 2048;
@@ -703,6 +948,7 @@ void DS_TableVerifyDestFileEntry_Test_InvalidSizeErrNonZero(void)
     uint32             TableIndex = 0;
     uint32             ErrorCount = 1;
 
+    memset(&DestFileEntry, 0, sizeof(DestFileEntry));
     DestFileEntry.FileNameType  = DS_BY_TIME;
     DestFileEntry.EnableState   = DS_ENABLED;
     DestFileEntry.MaxFileSize   = DS_FILE_MIN_SIZE_LIMIT - 1;
@@ -726,6 +972,7 @@ void DS_TableVerifyDestFileEntry_Test_InvalidAgeErrNonZero(void)
     uint32             TableIndex = 0;
     uint32             ErrorCount = 1;
 
+    memset(&DestFileEntry, 0, sizeof(DestFileEntry));
     DestFileEntry.FileNameType  = DS_BY_TIME;
     DestFileEntry.EnableState   = DS_ENABLED;
     DestFileEntry.MaxFileSize   = 2048;
@@ -749,6 +996,7 @@ void DS_TableVerifyDestFileEntry_Test_InvalidSequenceCountErrNonZero(void)
     uint32             TableIndex = 0;
     uint32             ErrorCount = 1;
 
+    memset(&DestFileEntry, 0, sizeof(DestFileEntry));
     DestFileEntry.FileNameType  = DS_BY_TIME;
     DestFileEntry.EnableState   = DS_ENABLED;
     DestFileEntry.MaxFileSize   = 2048;
@@ -866,6 +1114,36 @@ void DS_TableVerifyFilter_Test_CountBad(void)
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
 }
 
+void DS_TableVerifyFilter_Test_WildcardTooMany(void)
+{
+    DS_FilterTable_t FilterTable;
+
+    memset(&FilterTable, 0, sizeof(FilterTable));
+
+    /* Each wildcard entry covers half of the limit, the third goes over */
+    FilterTable.Packet[0].MessageID   = DS_UT_MID_1;
+    FilterTable.Packet[0].MessageMask = ~((uint32)DS_WILDCARD_MIDS / 2 - 1);
+    FilterTable.Packet[1].MessageID   = DS_UT_MID_1;
+    FilterTable.Packet[1].MessageMask = ~((uint32)DS_WILDCARD_MIDS / 2 - 1);
+    FilterTable.Packet[2].MessageID   = DS_UT_MID_1;
+    FilterTable.Packet[2].MessageMask = ~((uint32)DS_WILDCARD_MIDS / 2 - 1);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_TableVerifyFilter(&FilterTable), DS_TABLE_VERIFY_ERR);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FLT_TBL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, DS_FLT_TBL_EID);
+
+    /* Two of them fit */
+    FilterTable.Packet[2].MessageMask = 0;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_TableVerifyFilter(&FilterTable), CFE_SUCCESS);
+}
+
 void DS_TableVerifyFilterEntry_Test_Unused(void)
 {
     DS_PacketEntry_t PacketEntry;
@@ -954,225 +1232,780 @@ void DS_TableVerifyFilterEntry_Test_InvalidFilterTypeErrZero(void)
     DS_AppData.FileStatus[0].FileState   = DS_ENABLED;
 
     /* Execute the function being tested */
-    UtAssert_BOOL_FALSE(DS_TableVerifyFilterEntry(&PacketEntry, TableIndex, ErrorCount));
+    UtAssert_BOOL_FALSE(DS_TableVerifyFilterEntry(&PacketEntry, TableIndex, ErrorCount));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FLT_TBL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_TableVerifyFilterEntry_Test_InvalidFilterParmsErrZero(void)
+{
+    DS_PacketEntry_t PacketEntry;
+    uint32           TableIndex = 0;
+    uint32           ErrorCount = 0;
+
+    memset(&PacketEntry, 0, sizeof(PacketEntry));
+
+    PacketEntry.MessageID                = DS_UT_MID_1;
+    PacketEntry.Filter[0].FileTableIndex = 0;
+    PacketEntry.Filter[0].Algorithm_N    = 1;
+    PacketEntry.Filter[0].Algorithm_X    = 3;
+    PacketEntry.Filter[0].Algorithm_O    = 99;
+    PacketEntry.Filter[0].FilterType     = 1;
+    DS_AppData.FileStatus[0].FileState   = DS_ENABLED;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_TableVerifyFilterEntry(&PacketEntry, TableIndex, ErrorCount));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FLT_TBL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_TableVerifyFilterEntry_Test_InvalidPriorityErrZero(void)
+{
+    DS_PacketEntry_t PacketEntry;
+    uint32           TableIndex = 0;
+    uint32           ErrorCount = 0;
+
+    memset(&PacketEntry, 0, sizeof(PacketEntry));
+
+    PacketEntry.MessageID                = DS_UT_MID_1;
+    PacketEntry.Filter[0].FileTableIndex = 0;
+    PacketEntry.Filter[0].Algorithm_N    = 1;
+    PacketEntry.Filter[0].Algorithm_X    = 3;
+    PacketEntry.Filter[0].Algorithm_O    = 0;
+    PacketEntry.Filter[0].FilterType     = 1;
+    PacketEntry.Filter[0].Priority       = 99;
+    DS_AppData.FileStatus[0].FileState   = DS_ENABLED;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_TableVerifyFilterEntry(&PacketEntry, TableIndex, ErrorCount));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FLT_TBL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_TableVerifyFilterEntry_Test_InvalidFileTableIndexErrNonZero(void)
+{
+    DS_PacketEntry_t PacketEntry;
+    uint32           TableIndex = 0;
+    uint32           ErrorCount = 1;
+
+    memset(&PacketEntry, 0, sizeof(PacketEntry));
+
+    PacketEntry.MessageID                = DS_UT_MID_1;
+    PacketEntry.Filter[0].FileTableIndex = DS_DEST_FILE_CNT + 1;
+    PacketEntry.Filter[0].Algorithm_N    = 1;
+    PacketEntry.Filter[0].Algorithm_X    = 3;
+    PacketEntry.Filter[0].Algorithm_O    = 0;
+    PacketEntry.Filter[0].FilterType     = 1;
+    DS_AppData.FileStatus[0].FileState   = DS_ENABLED;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_TableVerifyFilterEntry(&PacketEntry, TableIndex, ErrorCount));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableVerifyFilterEntry_Test_InvalidFilterTypeErrNonZero(void)
+{
+    DS_PacketEntry_t PacketEntry;
+    uint32           TableIndex = 0;
+    uint32           ErrorCount = 1;
+
+    memset(&PacketEntry, 0, sizeof(PacketEntry));
+
+    PacketEntry.MessageID                = DS_UT_MID_1;
+    PacketEntry.Filter[0].FileTableIndex = 0;
+    PacketEntry.Filter[0].Algorithm_N    = 1;
+    PacketEntry.Filter[0].Algorithm_X    = 3;
+    PacketEntry.Filter[0].Algorithm_O    = 0;
+    PacketEntry.Filter[0].FilterType     = 99;
+    DS_AppData.FileStatus[0].FileState   = DS_ENABLED;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_TableVerifyFilterEntry(&PacketEntry, TableIndex, ErrorCount));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableVerifyFilterEntry_Test_InvalidFilterParmsErrNonZero(void)
+{
+    DS_PacketEntry_t PacketEntry;
+    uint32           TableIndex = 0;
+    uint32           ErrorCount = 1;
+
+    memset(&PacketEntry, 0, sizeof(PacketEntry));
+
+    PacketEntry.MessageID                = DS_UT_MID_1;
+    PacketEntry.Filter[0].FileTableIndex = 0;
+    PacketEntry.Filter[0].Algorithm_N    = 1;
+    PacketEntry.Filter[0].Algorithm_X    = 3;
+    PacketEntry.Filter[0].Algorithm_O    = 99;
+    PacketEntry.Filter[0].FilterType     = 1;
+    DS_AppData.FileStatus[0].FileState   = DS_ENABLED;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_TableVerifyFilterEntry(&PacketEntry, TableIndex, ErrorCount));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableVerifyFilterEntry_Test_InvalidPriorityErrNonZero(void)
+{
+    DS_PacketEntry_t PacketEntry;
+    uint32           TableIndex = 0;
+    uint32           ErrorCount = 1;
+
+    memset(&PacketEntry, 0, sizeof(PacketEntry));
+
+    PacketEntry.MessageID                = DS_UT_MID_1;
+    PacketEntry.Filter[0].FileTableIndex = 0;
+    PacketEntry.Filter[0].Algorithm_N    = 1;
+    PacketEntry.Filter[0].Algorithm_X    = 3;
+    PacketEntry.Filter[0].Algorithm_O    = 0;
+    PacketEntry.Filter[0].FilterType     = 1;
+    PacketEntry.Filter[0].Priority       = 99;
+    DS_AppData.FileStatus[0].FileState   = DS_ENABLED;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_TableVerifyFilterEntry(&PacketEntry, TableIndex, ErrorCount));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableVerifyFilterEntry_Test_InvalidStoreLengthErrZero(void)
+{
+    DS_PacketEntry_t PacketEntry;
+    uint32           TableIndex = 0;
+    uint32           ErrorCount = 0;
+
+    memset(&PacketEntry, 0, sizeof(PacketEntry));
+
+    PacketEntry.MessageID                = DS_UT_MID_1;
+    PacketEntry.Filter[0].FileTableIndex = 0;
+    PacketEntry.Filter[0].Algorithm_N    = 1;
+    PacketEntry.Filter[0].Algorithm_X    = 3;
+    PacketEntry.Filter[0].Algorithm_O    = 0;
+    PacketEntry.Filter[0].FilterType     = 1;
+    PacketEntry.Filter[0].MaxStoreLength = 1;
+    DS_AppData.FileStatus[0].FileState   = DS_ENABLED;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_TableVerifyFilterEntry(&PacketEntry, TableIndex, ErrorCount));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FLT_TBL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_TableVerifyFilterEntry_Test_InvalidStoreLengthErrNonZero(void)
+{
+    DS_PacketEntry_t PacketEntry;
+    uint32           TableIndex = 0;
+    uint32           ErrorCount = 1;
+
+    memset(&PacketEntry, 0, sizeof(PacketEntry));
+
+    PacketEntry.MessageID                = DS_UT_MID_1;
+    PacketEntry.Filter[0].FileTableIndex = 0;
+    PacketEntry.Filter[0].Algorithm_N    = 1;
+    PacketEntry.Filter[0].Algorithm_X    = 3;
+    PacketEntry.Filter[0].Algorithm_O    = 0;
+    PacketEntry.Filter[0].FilterType     = 1;
+    PacketEntry.Filter[0].MaxStoreLength = DS_TRUNCATE_MAX_LENGTH + 1;
+    DS_AppData.FileStatus[0].FileState   = DS_ENABLED;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_TableVerifyFilterEntry(&PacketEntry, TableIndex, ErrorCount));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableVerifyFilterEntry_Test_RingStoreLengthErrZero(void)
+{
+    DS_PacketEntry_t PacketEntry;
+    uint32           TableIndex = 0;
+    uint32           ErrorCount = 0;
+
+    memset(&PacketEntry, 0, sizeof(PacketEntry));
+
+    PacketEntry.MessageID                       = DS_UT_MID_1;
+    PacketEntry.Filter[0].FileTableIndex        = 0;
+    PacketEntry.Filter[0].Algorithm_N           = 1;
+    PacketEntry.Filter[0].Algorithm_X           = 3;
+    PacketEntry.Filter[0].Algorithm_O           = 0;
+    PacketEntry.Filter[0].FilterType            = 1;
+    PacketEntry.Filter[0].MaxStoreLength        = DS_TRUNCATE_MAX_LENGTH;
+    DS_AppData.FileStatus[0].FileState          = DS_ENABLED;
+    DS_AppData.DestFileTblPtr->File[0].FileMode = DS_FILE_MODE_RING;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_TableVerifyFilterEntry(&PacketEntry, TableIndex, ErrorCount));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FLT_TBL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_TableVerifyFilterEntry_Test_InvalidPredicateErrZero(void)
+{
+    DS_PacketEntry_t PacketEntry;
+    uint32           TableIndex = 0;
+    uint32           ErrorCount = 0;
+
+    memset(&PacketEntry, 0, sizeof(PacketEntry));
+
+    PacketEntry.MessageID                = DS_UT_MID_1;
+    PacketEntry.Filter[0].FileTableIndex = 0;
+    PacketEntry.Filter[0].Algorithm_N    = 1;
+    PacketEntry.Filter[0].Algorithm_X    = 3;
+    PacketEntry.Filter[0].Algorithm_O    = 0;
+    PacketEntry.Filter[0].FilterType     = 1;
+    PacketEntry.PredicateLogic           = 99;
+    DS_AppData.FileStatus[0].FileState   = DS_ENABLED;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_TableVerifyFilterEntry(&PacketEntry, TableIndex, ErrorCount));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FLT_TBL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void DS_TableVerifyFilterEntry_Test_InvalidPredicateErrNonZero(void)
+{
+    DS_PacketEntry_t PacketEntry;
+    uint32           TableIndex = 0;
+    uint32           ErrorCount = 1;
+
+    memset(&PacketEntry, 0, sizeof(PacketEntry));
+
+    PacketEntry.MessageID                = DS_UT_MID_1;
+    PacketEntry.Filter[0].FileTableIndex = 0;
+    PacketEntry.Filter[0].Algorithm_N    = 1;
+    PacketEntry.Filter[0].Algorithm_X    = 3;
+    PacketEntry.Filter[0].Algorithm_O    = 0;
+    PacketEntry.Filter[0].FilterType     = 1;
+    PacketEntry.PredicateLogic           = 99;
+    DS_AppData.FileStatus[0].FileState   = DS_ENABLED;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_TableVerifyFilterEntry(&PacketEntry, TableIndex, ErrorCount));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableEntryUnused_Test_Nominal(void)
+{
+    DS_DestFileEntry_t DestFileEntry;
+
+    memset(&DestFileEntry, DS_UNUSED, sizeof(DestFileEntry));
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_TableEntryUnused(&DestFileEntry, sizeof(DestFileEntry)));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableEntryUnused_Test_Fail(void)
+{
+    DS_DestFileEntry_t DestFileEntry;
+
+    memset(&DestFileEntry, 99, sizeof(DestFileEntry));
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_TableEntryUnused(&DestFileEntry, sizeof(DestFileEntry)));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableVerifyFileIndex_Test_Nominal(void)
+{
+    uint16 FileTableIndex = 0;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_TableVerifyFileIndex(FileTableIndex));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableVerifyFileIndex_Test_Fail(void)
+{
+    uint16 FileTableIndex = DS_DEST_FILE_CNT;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_TableVerifyFileIndex(FileTableIndex));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableVerifyParms_Test_NominalOnlyXNonZero(void)
+{
+    uint16 Algorithm_N = 0;
+    uint16 Algorithm_X = 1;
+    uint16 Algorithm_O = 0;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_TableVerifyParms(Algorithm_N, Algorithm_X, Algorithm_O));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableVerifyParms_Test_NGreaterThanXOnlyNNonZero(void)
+{
+    uint16 Algorithm_N = 1;
+    uint16 Algorithm_X = 0;
+    uint16 Algorithm_O = 0;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_TableVerifyParms(Algorithm_N, Algorithm_X, Algorithm_O));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableVerifyParms_Test_OGreaterThanXOnlyONonZero(void)
+{
+    uint16 Algorithm_N = 0;
+    uint16 Algorithm_X = 0;
+    uint16 Algorithm_O = 1;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_TableVerifyParms(Algorithm_N, Algorithm_X, Algorithm_O));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableVerifyParms_Test_AllZero(void)
+{
+    uint16 Algorithm_N = 0;
+    uint16 Algorithm_X = 0;
+    uint16 Algorithm_O = 0;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_TableVerifyParms(Algorithm_N, Algorithm_X, Algorithm_O));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableVerifyType_Test_Nominal(void)
+{
+    uint16 TimeVsCount = DS_BY_TIME;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_TableVerifyType(TimeVsCount));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableVerifyType_Test_Fail(void)
+{
+    uint16 TimeVsCount = 99;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_TableVerifyType(TimeVsCount));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableVerifyType_Test_FailChange(void)
+{
+    /* Execute the function being tested - filename type cannot be by change or by window */
+    UtAssert_BOOL_FALSE(DS_TableVerifyType(DS_BY_CHANGE));
+    UtAssert_BOOL_FALSE(DS_TableVerifyType(DS_BY_WINDOW));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableVerifyFilterType_Test_Nominal(void)
+{
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_TableVerifyFilterType(DS_BY_COUNT));
+    UtAssert_BOOL_TRUE(DS_TableVerifyFilterType(DS_BY_TIME));
+    UtAssert_BOOL_TRUE(DS_TableVerifyFilterType(DS_BY_CHANGE));
+    UtAssert_BOOL_TRUE(DS_TableVerifyFilterType(DS_BY_WINDOW));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableVerifyFilterType_Test_Fail(void)
+{
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_TableVerifyFilterType(0));
+    UtAssert_BOOL_FALSE(DS_TableVerifyFilterType(99));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableVerifyPriority_Test_Nominal(void)
+{
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_TableVerifyPriority(DS_PRIORITY_HIGH));
+    UtAssert_BOOL_TRUE(DS_TableVerifyPriority(DS_PRIORITY_LOW));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableVerifyPriority_Test_Fail(void)
+{
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_TableVerifyPriority(99));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableVerifyStoreLength_Test_Nominal(void)
+{
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_TableVerifyStoreLength(0, DS_FILE_MODE_LINEAR));
+    UtAssert_BOOL_TRUE(DS_TableVerifyStoreLength(0, DS_FILE_MODE_RING));
+    UtAssert_BOOL_TRUE(DS_TableVerifyStoreLength(sizeof(CFE_MSG_TelemetryHeader_t), DS_FILE_MODE_LINEAR));
+    UtAssert_BOOL_TRUE(DS_TableVerifyStoreLength(DS_TRUNCATE_MAX_LENGTH, DS_FILE_MODE_LINEAR));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableVerifyStoreLength_Test_Fail(void)
+{
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_TableVerifyStoreLength(sizeof(CFE_MSG_TelemetryHeader_t) - 1, DS_FILE_MODE_LINEAR));
+    UtAssert_BOOL_FALSE(DS_TableVerifyStoreLength(DS_TRUNCATE_MAX_LENGTH + 1, DS_FILE_MODE_LINEAR));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableVerifyStoreLength_Test_Ring(void)
+{
+    /* Execute the function being tested - truncated record prefix would break the ring walk */
+    if (DS_TRUNCATE_PATCH_LENGTH == 0)
+    {
+        UtAssert_BOOL_FALSE(DS_TableVerifyStoreLength(DS_TRUNCATE_MAX_LENGTH, DS_FILE_MODE_RING));
+    }
+    else
+    {
+        UtAssert_BOOL_TRUE(DS_TableVerifyStoreLength(DS_TRUNCATE_MAX_LENGTH, DS_FILE_MODE_RING));
+    }
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableVerifyDestStoreLength_Test_Nominal(void)
+{
+    DS_AppData.FilterTblPtr->Packet[1].Filter[1].FileTableIndex = 2;
+    DS_AppData.FilterTblPtr->Packet[1].Filter[1].MaxStoreLength = DS_TRUNCATE_MAX_LENGTH;
+
+    /* Execute the function being tested - other destinations are not affected */
+    UtAssert_BOOL_TRUE(DS_TableVerifyDestStoreLength(1, DS_FILE_MODE_RING));
+    UtAssert_BOOL_TRUE(DS_TableVerifyDestStoreLength(2, DS_FILE_MODE_LINEAR));
+}
+
+void DS_TableVerifyDestStoreLength_Test_NoFilterTable(void)
+{
+    DS_AppData.FilterTblPtr = NULL;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_TableVerifyDestStoreLength(2, DS_FILE_MODE_RING));
+}
+
+void DS_TableVerifyDestStoreLength_Test_Fail(void)
+{
+    DS_AppData.FilterTblPtr->Packet[1].Filter[1].FileTableIndex = 2;
+    DS_AppData.FilterTblPtr->Packet[1].Filter[1].MaxStoreLength = DS_TRUNCATE_MAX_LENGTH;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_TableVerifyDestStoreLength(2, DS_FILE_MODE_RING));
+}
+
+void DS_TableVerifyPredicate_Test_Nominal(void)
+{
+    DS_PacketEntry_t PacketEntry;
+
+    memset(&PacketEntry, 0, sizeof(PacketEntry));
+
+    /* Execute the function being tested - no terms */
+    UtAssert_BOOL_TRUE(DS_TableVerifyPredicate(&PacketEntry));
+
+    PacketEntry.PredicateLogic        = DS_PREDICATE_OR;
+    PacketEntry.Predicate[0].Offset   = 0xFFFF - 4;
+    PacketEntry.Predicate[0].Width    = 4;
+    PacketEntry.Predicate[0].Operator = DS_PREDICATE_GE;
+    PacketEntry.Predicate[0].Mask     = 0xFFFFFFFF;
+
+    /* Execute the function being tested - field ends at the largest offset */
+    UtAssert_BOOL_TRUE(DS_TableVerifyPredicate(&PacketEntry));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableVerifyPredicate_Test_Fail(void)
+{
+    DS_PacketEntry_t PacketEntry;
+
+    memset(&PacketEntry, 0, sizeof(PacketEntry));
+
+    /* Bad logic */
+    PacketEntry.PredicateLogic = 99;
+    UtAssert_BOOL_FALSE(DS_TableVerifyPredicate(&PacketEntry));
+    PacketEntry.PredicateLogic = DS_PREDICATE_AND;
+
+    /* Unused term that is not all zero */
+    PacketEntry.Predicate[0].Value = 1;
+    UtAssert_BOOL_FALSE(DS_TableVerifyPredicate(&PacketEntry));
+
+    /* Bad width */
+    PacketEntry.Predicate[0].Width    = 3;
+    PacketEntry.Predicate[0].Operator = DS_PREDICATE_EQ;
+    UtAssert_BOOL_FALSE(DS_TableVerifyPredicate(&PacketEntry));
+
+    /* Bad operator */
+    PacketEntry.Predicate[0].Width    = 2;
+    PacketEntry.Predicate[0].Operator = 0;
+    UtAssert_BOOL_FALSE(DS_TableVerifyPredicate(&PacketEntry));
+    PacketEntry.Predicate[0].Operator = DS_PREDICATE_GE + 1;
+    UtAssert_BOOL_FALSE(DS_TableVerifyPredicate(&PacketEntry));
+
+    /* Field ends beyond the largest offset */
+    PacketEntry.Predicate[0].Operator = DS_PREDICATE_EQ;
+    PacketEntry.Predicate[0].Offset   = 0xFFFF - 1;
+    UtAssert_BOOL_FALSE(DS_TableVerifyPredicate(&PacketEntry));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableVerifyMode_Test_NominalLinear(void)
+{
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_TableVerifyMode(DS_FILE_MODE_LINEAR));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableVerifyMode_Test_NominalRing(void)
+{
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_TableVerifyMode(DS_FILE_MODE_RING));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableVerifyMode_Test_Fail(void)
+{
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_TableVerifyMode(99));
 
     /* Verify results */
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FLT_TBL_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void DS_TableVerifyFilterEntry_Test_InvalidFilterParmsErrZero(void)
+void DS_TableVerifyStorage_Test_NominalNoLimit(void)
 {
-    DS_PacketEntry_t PacketEntry;
-    uint32           TableIndex = 0;
-    uint32           ErrorCount = 0;
-
-    memset(&PacketEntry, 0, sizeof(PacketEntry));
-
-    PacketEntry.MessageID                = DS_UT_MID_1;
-    PacketEntry.Filter[0].FileTableIndex = 0;
-    PacketEntry.Filter[0].Algorithm_N    = 1;
-    PacketEntry.Filter[0].Algorithm_X    = 3;
-    PacketEntry.Filter[0].Algorithm_O    = 99;
-    PacketEntry.Filter[0].FilterType     = 1;
-    DS_AppData.FileStatus[0].FileState   = DS_ENABLED;
-
     /* Execute the function being tested */
-    UtAssert_BOOL_FALSE(DS_TableVerifyFilterEntry(&PacketEntry, TableIndex, ErrorCount));
+    UtAssert_BOOL_TRUE(DS_TableVerifyStorage(0, 2048));
 
     /* Verify results */
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_FLT_TBL_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void DS_TableVerifyFilterEntry_Test_InvalidFileTableIndexErrNonZero(void)
+void DS_TableVerifyStorage_Test_Nominal(void)
 {
-    DS_PacketEntry_t PacketEntry;
-    uint32           TableIndex = 0;
-    uint32           ErrorCount = 1;
-
-    memset(&PacketEntry, 0, sizeof(PacketEntry));
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_TableVerifyStorage(2048, 2048));
 
-    PacketEntry.MessageID                = DS_UT_MID_1;
-    PacketEntry.Filter[0].FileTableIndex = DS_DEST_FILE_CNT + 1;
-    PacketEntry.Filter[0].Algorithm_N    = 1;
-    PacketEntry.Filter[0].Algorithm_X    = 3;
-    PacketEntry.Filter[0].Algorithm_O    = 0;
-    PacketEntry.Filter[0].FilterType     = 1;
-    DS_AppData.FileStatus[0].FileState   = DS_ENABLED;
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
 
+void DS_TableVerifyStorage_Test_Fail(void)
+{
     /* Execute the function being tested */
-    UtAssert_BOOL_FALSE(DS_TableVerifyFilterEntry(&PacketEntry, TableIndex, ErrorCount));
+    UtAssert_BOOL_FALSE(DS_TableVerifyStorage(1024, 2048));
 
     /* Verify results */
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void DS_TableVerifyFilterEntry_Test_InvalidFilterTypeErrNonZero(void)
+void DS_TableVerifyCompress_Test_NominalNone(void)
 {
-    DS_PacketEntry_t PacketEntry;
-    uint32           TableIndex = 0;
-    uint32           ErrorCount = 1;
-
-    memset(&PacketEntry, 0, sizeof(PacketEntry));
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(DS_TableVerifyCompress(DS_COMPRESS_NONE, DS_FILE_MODE_RING, 10, 10));
 
-    PacketEntry.MessageID                = DS_UT_MID_1;
-    PacketEntry.Filter[0].FileTableIndex = 0;
-    PacketEntry.Filter[0].Algorithm_N    = 1;
-    PacketEntry.Filter[0].Algorithm_X    = 3;
-    PacketEntry.Filter[0].Algorithm_O    = 0;
-    PacketEntry.Filter[0].FilterType     = 99;
-    DS_AppData.FileStatus[0].FileState   = DS_ENABLED;
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
 
+void DS_TableVerifyCompress_Test_NominalLZ(void)
+{
     /* Execute the function being tested */
-    UtAssert_BOOL_FALSE(DS_TableVerifyFilterEntry(&PacketEntry, TableIndex, ErrorCount));
+    UtAssert_BOOL_TRUE(DS_TableVerifyCompress(DS_COMPRESS_LZ, DS_FILE_MODE_LINEAR, 0, 0));
 
     /* Verify results */
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void DS_TableVerifyFilterEntry_Test_InvalidFilterParmsErrNonZero(void)
+void DS_TableVerifyCompress_Test_Fail(void)
 {
-    DS_PacketEntry_t PacketEntry;
-    uint32           TableIndex = 0;
-    uint32           ErrorCount = 1;
-
-    memset(&PacketEntry, 0, sizeof(PacketEntry));
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_TableVerifyCompress(99, DS_FILE_MODE_LINEAR, 0, 0));
 
-    PacketEntry.MessageID                = DS_UT_MID_1;
-    PacketEntry.Filter[0].FileTableIndex = 0;
-    PacketEntry.Filter[0].Algorithm_N    = 1;
-    PacketEntry.Filter[0].Algorithm_X    = 3;
-    PacketEntry.Filter[0].Algorithm_O    = 99;
-    PacketEntry.Filter[0].FilterType     = 1;
-    DS_AppData.FileStatus[0].FileState   = DS_ENABLED;
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
 
+void DS_TableVerifyCompress_Test_FailRing(void)
+{
     /* Execute the function being tested */
-    UtAssert_BOOL_FALSE(DS_TableVerifyFilterEntry(&PacketEntry, TableIndex, ErrorCount));
+    UtAssert_BOOL_FALSE(DS_TableVerifyCompress(DS_COMPRESS_LZ, DS_FILE_MODE_RING, 0, 0));
 
     /* Verify results */
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void DS_TableEntryUnused_Test_Nominal(void)
+void DS_TableVerifyCompress_Test_FailIndex(void)
 {
-    DS_DestFileEntry_t DestFileEntry;
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_TableVerifyCompress(DS_COMPRESS_LZ, DS_FILE_MODE_LINEAR, 10, 0));
+    UtAssert_BOOL_FALSE(DS_TableVerifyCompress(DS_COMPRESS_LZ, DS_FILE_MODE_LINEAR, 0, 10));
 
-    memset(&DestFileEntry, DS_UNUSED, sizeof(DestFileEntry));
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
 
+void DS_TableVerifySizeLimit_Test_Nominal(void)
+{
     /* Execute the function being tested */
-    UtAssert_BOOL_TRUE(DS_TableEntryUnused(&DestFileEntry, sizeof(DestFileEntry)));
+    UtAssert_BOOL_TRUE(DS_TableVerifySizeLimit(DS_SIZE_LIMIT_PHYSICAL));
+    UtAssert_BOOL_TRUE(DS_TableVerifySizeLimit(DS_SIZE_LIMIT_LOGICAL));
 
     /* Verify results */
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void DS_TableEntryUnused_Test_Fail(void)
+void DS_TableVerifySizeLimit_Test_Fail(void)
 {
-    DS_DestFileEntry_t DestFileEntry;
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(DS_TableVerifySizeLimit(99));
 
-    memset(&DestFileEntry, 99, sizeof(DestFileEntry));
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
 
+void DS_TableVerifyShard_Test_Nominal(void)
+{
     /* Execute the function being tested */
-    UtAssert_BOOL_FALSE(DS_TableEntryUnused(&DestFileEntry, sizeof(DestFileEntry)));
+    UtAssert_BOOL_TRUE(DS_TableVerifyShard(DS_SHARD_NONE, 0, DS_BY_TIME));
+    UtAssert_BOOL_TRUE(DS_TableVerifyShard(DS_SHARD_BY_TIME, 0, DS_BY_TIME));
+    UtAssert_BOOL_TRUE(DS_TableVerifyShard(DS_SHARD_BY_COUNT, 100, DS_BY_COUNT));
 
     /* Verify results */
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void DS_TableVerifyFileIndex_Test_Nominal(void)
+void DS_TableVerifyShard_Test_Fail(void)
 {
-    uint16 FileTableIndex = 0;
-
     /* Execute the function being tested */
-    UtAssert_BOOL_TRUE(DS_TableVerifyFileIndex(FileTableIndex));
+    UtAssert_BOOL_FALSE(DS_TableVerifyShard(99, 0, DS_BY_TIME));
 
     /* Verify results */
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void DS_TableVerifyFileIndex_Test_Fail(void)
+void DS_TableVerifyShard_Test_FailCount(void)
 {
-    uint16 FileTableIndex = DS_DEST_FILE_CNT;
-
     /* Execute the function being tested */
-    UtAssert_BOOL_FALSE(DS_TableVerifyFileIndex(FileTableIndex));
+    UtAssert_BOOL_FALSE(DS_TableVerifyShard(DS_SHARD_BY_COUNT, 0, DS_BY_COUNT));
+    UtAssert_BOOL_FALSE(DS_TableVerifyShard(DS_SHARD_BY_COUNT, 100, DS_BY_TIME));
 
     /* Verify results */
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void DS_TableVerifyParms_Test_NominalOnlyXNonZero(void)
+void DS_TableVerifyRecord_Test_NominalFull(void)
 {
-    uint16 Algorithm_N = 0;
-    uint16 Algorithm_X = 1;
-    uint16 Algorithm_O = 0;
-
     /* Execute the function being tested */
-    UtAssert_BOOL_TRUE(DS_TableVerifyParms(Algorithm_N, Algorithm_X, Algorithm_O));
+    UtAssert_BOOL_TRUE(DS_TableVerifyRecord(DS_RECORD_FULL, 0, DS_FILE_MODE_RING, 10, 10));
 
     /* Verify results */
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void DS_TableVerifyParms_Test_NGreaterThanXOnlyNNonZero(void)
+void DS_TableVerifyRecord_Test_NominalDelta(void)
 {
-    uint16 Algorithm_N = 1;
-    uint16 Algorithm_X = 0;
-    uint16 Algorithm_O = 0;
-
     /* Execute the function being tested */
-    UtAssert_BOOL_FALSE(DS_TableVerifyParms(Algorithm_N, Algorithm_X, Algorithm_O));
+    UtAssert_BOOL_TRUE(DS_TableVerifyRecord(DS_RECORD_DELTA, 100, DS_FILE_MODE_LINEAR, 0, 0));
 
     /* Verify results */
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void DS_TableVerifyParms_Test_OGreaterThanXOnlyONonZero(void)
+void DS_TableVerifyRecord_Test_Fail(void)
 {
-    uint16 Algorithm_N = 0;
-    uint16 Algorithm_X = 0;
-    uint16 Algorithm_O = 1;
-
     /* Execute the function being tested */
-    UtAssert_BOOL_FALSE(DS_TableVerifyParms(Algorithm_N, Algorithm_X, Algorithm_O));
+    UtAssert_BOOL_FALSE(DS_TableVerifyRecord(99, 100, DS_FILE_MODE_LINEAR, 0, 0));
 
     /* Verify results */
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void DS_TableVerifyParms_Test_AllZero(void)
+void DS_TableVerifyRecord_Test_FailKeyframe(void)
 {
-    uint16 Algorithm_N = 0;
-    uint16 Algorithm_X = 0;
-    uint16 Algorithm_O = 0;
-
     /* Execute the function being tested */
-    UtAssert_BOOL_TRUE(DS_TableVerifyParms(Algorithm_N, Algorithm_X, Algorithm_O));
+    UtAssert_BOOL_FALSE(DS_TableVerifyRecord(DS_RECORD_DELTA, 0, DS_FILE_MODE_LINEAR, 0, 0));
 
     /* Verify results */
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void DS_TableVerifyType_Test_Nominal(void)
+void DS_TableVerifyRecord_Test_FailRing(void)
 {
-    uint16 TimeVsCount = DS_BY_TIME;
-
     /* Execute the function being tested */
-    UtAssert_BOOL_TRUE(DS_TableVerifyType(TimeVsCount));
+    UtAssert_BOOL_FALSE(DS_TableVerifyRecord(DS_RECORD_DELTA, 100, DS_FILE_MODE_RING, 0, 0));
 
     /* Verify results */
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void DS_TableVerifyType_Test_Fail(void)
+void DS_TableVerifyRecord_Test_FailIndex(void)
 {
-    uint16 TimeVsCount = 99;
-
     /* Execute the function being tested */
-    UtAssert_BOOL_FALSE(DS_TableVerifyType(TimeVsCount));
+    UtAssert_BOOL_FALSE(DS_TableVerifyRecord(DS_RECORD_DELTA, 100, DS_FILE_MODE_LINEAR, 10, 0));
+    UtAssert_BOOL_FALSE(DS_TableVerifyRecord(DS_RECORD_DELTA, 100, DS_FILE_MODE_LINEAR, 0, 10));
 
     /* Verify results */
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
@@ -1311,6 +2144,18 @@ void DS_TableSubscribe_Test_SendHk(void)
     UtAssert_STUB_COUNT(CFE_SB_SubscribeEx, 0);
 }
 
+void DS_TableSubscribe_Test_BacklogProbe(void)
+{
+    DS_AppData.FilterTblPtr->Packet[0].MessageID = CFE_SB_ValueToMsgId(DS_BACKLOG_PROBE_MID);
+
+    /* Execute the function being tested */
+    DS_TableSubscribe();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(CFE_SB_SubscribeEx, 0);
+}
+
 void DS_TableSubscribe_Test_Data(void)
 {
     DS_AppData.FilterTblPtr->Packet[0].MessageID = DS_UT_MID_1; /* NOT the CMD or SEND_HK MIDs */
@@ -1323,6 +2168,22 @@ void DS_TableSubscribe_Test_Data(void)
     UtAssert_STUB_COUNT(CFE_SB_SubscribeEx, 1);
 }
 
+void DS_TableSubscribe_Test_Wildcard(void)
+{
+    DS_AppData.FilterTblPtr->Packet[0].MessageID   = DS_UT_MID_1;
+    DS_AppData.FilterTblPtr->Packet[0].MessageMask = 0xFFFFFFFE;
+    DS_AppData.WildcardLinks[0].MessageID          = CFE_SB_ValueToMsgId(DS_CMD_MID);
+    DS_AppData.WildcardLinks[1].MessageID          = DS_UT_MID_1;
+    DS_AppData.WildcardCount                       = 2;
+
+    /* Execute the function being tested */
+    DS_TableSubscribe();
+
+    /* Verify results - only the expanded data message ID */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(CFE_SB_SubscribeEx, 1);
+}
+
 void DS_TableUnsubscribe_Test_Unused(void)
 {
     /* Execute the function being tested */
@@ -1357,6 +2218,18 @@ void DS_TableUnsubscribe_Test_SendHk(void)
     UtAssert_STUB_COUNT(CFE_SB_Unsubscribe, 0);
 }
 
+void DS_TableUnsubscribe_Test_BacklogProbe(void)
+{
+    DS_AppData.FilterTblPtr->Packet[0].MessageID = CFE_SB_ValueToMsgId(DS_BACKLOG_PROBE_MID);
+
+    /* Execute the function being tested */
+    DS_TableUnsubscribe();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(CFE_SB_Unsubscribe, 0);
+}
+
 void DS_TableUnsubscribe_Test_Data(void)
 {
     DS_AppData.FilterTblPtr->Packet[0].MessageID = DS_UT_MID_1; /* NOT the CMD or SEND_HK MIDs */
@@ -1369,6 +2242,22 @@ void DS_TableUnsubscribe_Test_Data(void)
     UtAssert_STUB_COUNT(CFE_SB_Unsubscribe, 1);
 }
 
+void DS_TableUnsubscribe_Test_Wildcard(void)
+{
+    DS_AppData.FilterTblPtr->Packet[0].MessageID   = DS_UT_MID_1;
+    DS_AppData.FilterTblPtr->Packet[0].MessageMask = 0xFFFFFFFE;
+    DS_AppData.WildcardLinks[0].MessageID          = CFE_SB_ValueToMsgId(DS_SEND_HK_MID);
+    DS_AppData.WildcardLinks[1].MessageID          = DS_UT_MID_1;
+    DS_AppData.WildcardCount                       = 2;
+
+    /* Execute the function being tested */
+    DS_TableUnsubscribe();
+
+    /* Verify results - only the expanded data message ID */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(CFE_SB_Unsubscribe, 1);
+}
+
 void DS_TableCreateCDS_Test_NewCDSArea(void)
 {
     /* Execute the function being tested */
@@ -1479,6 +2368,8 @@ void DS_TableCreateHash_Test_Nominal(void)
 
     DS_AppData.FilterTblPtr->Packet[0].MessageID = DS_UT_MID_1;
     HashIndex                                    = DS_TableHashFunction(DS_AppData.FilterTblPtr->Packet[0].MessageID);
+    DS_AppData.FilterChange[0][1].Stored         = true;
+    DS_AppData.FilterWindow[0][1].Stored         = true;
 
     /* Execute the function being tested */
     DS_TableCreateHash();
@@ -1487,10 +2378,186 @@ void DS_TableCreateHash_Test_Nominal(void)
     UtAssert_UINT32_EQ(DS_AppData.HashLinks[0].Index, 0);
     UtAssert_BOOL_TRUE(CFE_SB_MsgId_Equal(DS_AppData.HashLinks[0].MessageID, DS_UT_MID_1));
     UtAssert_ADDRESS_EQ(DS_AppData.HashTable[HashIndex], &DS_AppData.HashLinks[0]);
+    UtAssert_BOOL_FALSE(DS_AppData.FilterChange[0][1].Stored);
+    UtAssert_BOOL_FALSE(DS_AppData.FilterWindow[0][1].Stored);
+    UtAssert_STUB_COUNT(DS_FileCacheRebuild, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_TableCreateHash_Test_Wildcard(void)
+{
+    DS_AppData.FilterTblPtr->Packet[0].MessageID   = CFE_SB_ValueToMsgId(0x0100);
+    DS_AppData.FilterTblPtr->Packet[0].MessageMask = 0xFFFFFFFC;
+    DS_AppData.FilterTblPtr->Packet[1].MessageID   = CFE_SB_ValueToMsgId(0x0102);
+    DS_AppData.WildcardCount                       = 5;
+
+    /* Execute the function being tested */
+    DS_TableCreateHash();
+
+    /* Verify results - exact entry wins although it comes after the wildcard entry */
+    UtAssert_UINT32_EQ(DS_AppData.WildcardCount, 3);
+    UtAssert_INT32_EQ(DS_TableFindMsgID(CFE_SB_ValueToMsgId(0x0100)), 0);
+    UtAssert_INT32_EQ(DS_TableFindMsgID(CFE_SB_ValueToMsgId(0x0101)), 0);
+    UtAssert_INT32_EQ(DS_TableFindMsgID(CFE_SB_ValueToMsgId(0x0102)), 1);
+    UtAssert_INT32_EQ(DS_TableFindMsgID(CFE_SB_ValueToMsgId(0x0103)), 0);
+    UtAssert_INT32_EQ(DS_TableFindMsgID(CFE_SB_ValueToMsgId(0x0104)), DS_INDEX_NONE);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
+void DS_TableWildcardCount_Test(void)
+{
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(DS_TableWildcardCount(0), 0);
+    UtAssert_UINT32_EQ(DS_TableWildcardCount(0xFFFFFFFF), 1);
+    UtAssert_UINT32_EQ(DS_TableWildcardCount(0xFFFFFFFC), 4);
+    UtAssert_UINT32_EQ(DS_TableWildcardCount(0xFFFFFF00), 256);
+
+    /* Message ID bits outside DS_WILDCARD_MID_MASK never differ */
+    UtAssert_UINT32_EQ(DS_TableWildcardCount(0xFFFFFFFF & DS_WILDCARD_MID_MASK), 1);
+}
+
+void DS_TableAddWildcard_Test_Overlap(void)
+{
+    DS_AppData.FilterTblPtr->Packet[0].MessageID   = CFE_SB_ValueToMsgId(0x0200);
+    DS_AppData.FilterTblPtr->Packet[0].MessageMask = 0xFFFFFFFE;
+    DS_AppData.FilterTblPtr->Packet[1].MessageID   = CFE_SB_ValueToMsgId(0x0201);
+    DS_AppData.FilterTblPtr->Packet[1].MessageMask = 0xFFFFFFFC;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_TableAddWildcard(0));
+    UtAssert_VOIDCALL(DS_TableAddWildcard(1));
+
+    /* Verify results - earlier wildcard entry wins, base MessageID bits come from the mask */
+    UtAssert_UINT32_EQ(DS_AppData.WildcardCount, 4);
+    UtAssert_INT32_EQ(DS_TableFindMsgID(CFE_SB_ValueToMsgId(0x0200)), 0);
+    UtAssert_INT32_EQ(DS_TableFindMsgID(CFE_SB_ValueToMsgId(0x0201)), 0);
+    UtAssert_INT32_EQ(DS_TableFindMsgID(CFE_SB_ValueToMsgId(0x0202)), 1);
+    UtAssert_INT32_EQ(DS_TableFindMsgID(CFE_SB_ValueToMsgId(0x0203)), 1);
+}
+
+void DS_TableAddWildcard_Test_Full(void)
+{
+    DS_AppData.FilterTblPtr->Packet[0].MessageID   = CFE_SB_ValueToMsgId(0x0200);
+    DS_AppData.FilterTblPtr->Packet[0].MessageMask = 0xFFFFFFFE;
+    DS_AppData.WildcardCount                       = DS_WILDCARD_MIDS;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_TableAddWildcard(0));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DS_AppData.WildcardCount, DS_WILDCARD_MIDS);
+    UtAssert_INT32_EQ(DS_TableFindMsgID(CFE_SB_ValueToMsgId(0x0200)), DS_INDEX_NONE);
+}
+
+void DS_TableAddWildcard_Test_Unused(void)
+{
+    DS_AppData.FilterTblPtr->Packet[0].MessageID   = CFE_SB_INVALID_MSG_ID;
+    DS_AppData.FilterTblPtr->Packet[0].MessageMask = 0xFFFFFFFE;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_TableAddWildcard(0));
+
+    /* Verify results */
+    UtAssert_ZERO(DS_AppData.WildcardCount);
+}
+
+void DS_TableCompilePredicate_Test_Nominal(void)
+{
+    DS_PacketEntry_t *    PacketEntry = &DS_AppData.FilterTblPtr->Packet[0];
+    DS_PacketPredicate_t *Predicate   = &DS_AppData.FilterPredicate[0];
+
+    PacketEntry->PredicateLogic        = DS_PREDICATE_OR;
+    PacketEntry->Predicate[1].Offset   = 12;
+    PacketEntry->Predicate[1].Width    = 2;
+    PacketEntry->Predicate[1].Operator = DS_PREDICATE_NE;
+    PacketEntry->Predicate[1].Mask     = 0x0FFF;
+    PacketEntry->Predicate[1].Value    = 7;
+    Predicate->Term[1].Span            = 99;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_TableCompilePredicate(0));
+
+    /* Verify results - unused first term is dropped and stale terms are cleared */
+    UtAssert_UINT32_EQ(Predicate->TermCount, 1);
+    UtAssert_BOOL_TRUE(Predicate->MatchAny);
+    UtAssert_UINT32_EQ(Predicate->Term[0].Offset, 12);
+    UtAssert_UINT32_EQ(Predicate->Term[0].End, 14);
+    UtAssert_UINT32_EQ(Predicate->Term[0].Width, 2);
+    UtAssert_UINT32_EQ(Predicate->Term[0].Mask, 0x0FFF);
+    UtAssert_UINT32_EQ(Predicate->Term[0].Low, 7);
+    UtAssert_UINT32_EQ(Predicate->Term[0].Span, 0);
+    UtAssert_BOOL_TRUE(Predicate->Term[0].Invert);
+    UtAssert_ZERO(Predicate->Term[1].Span);
+}
+
+void DS_TableCompilePredicate_Test_Operators(void)
+{
+    DS_PacketEntry_t *    PacketEntry = &DS_AppData.FilterTblPtr->Packet[0];
+    DS_PacketPredicate_t *Predicate   = &DS_AppData.FilterPredicate[0];
+
+    PacketEntry->Predicate[0].Width = 4;
+    PacketEntry->Predicate[0].Value = 10;
+
+    PacketEntry->Predicate[0].Operator = DS_PREDICATE_EQ;
+    UtAssert_VOIDCALL(DS_TableCompilePredicate(0));
+    UtAssert_BOOL_FALSE(Predicate->MatchAny);
+    UtAssert_UINT32_EQ(Predicate->Term[0].Low, 10);
+    UtAssert_UINT32_EQ(Predicate->Term[0].Span, 0);
+    UtAssert_BOOL_FALSE(Predicate->Term[0].Invert);
+
+    PacketEntry->Predicate[0].Operator = DS_PREDICATE_LT;
+    UtAssert_VOIDCALL(DS_TableCompilePredicate(0));
+    UtAssert_UINT32_EQ(Predicate->Term[0].Low, 0);
+    UtAssert_UINT32_EQ(Predicate->Term[0].Span, 9);
+    UtAssert_BOOL_FALSE(Predicate->Term[0].Invert);
+
+    PacketEntry->Predicate[0].Operator = DS_PREDICATE_LE;
+    UtAssert_VOIDCALL(DS_TableCompilePredicate(0));
+    UtAssert_UINT32_EQ(Predicate->Term[0].Low, 0);
+    UtAssert_UINT32_EQ(Predicate->Term[0].Span, 10);
+
+    PacketEntry->Predicate[0].Operator = DS_PREDICATE_GT;
+    UtAssert_VOIDCALL(DS_TableCompilePredicate(0));
+    UtAssert_UINT32_EQ(Predicate->Term[0].Low, 11);
+    UtAssert_UINT32_EQ(Predicate->Term[0].Span, 0xFFFFFFFF - 11);
+
+    PacketEntry->Predicate[0].Operator = DS_PREDICATE_GE;
+    UtAssert_VOIDCALL(DS_TableCompilePredicate(0));
+    UtAssert_UINT32_EQ(Predicate->Term[0].Low, 10);
+    UtAssert_UINT32_EQ(Predicate->Term[0].Span, 0xFFFFFFFF - 10);
+    UtAssert_BOOL_FALSE(Predicate->Term[0].Invert);
+}
+
+void DS_TableCompilePredicate_Test_Never(void)
+{
+    DS_PacketEntry_t *    PacketEntry = &DS_AppData.FilterTblPtr->Packet[0];
+    DS_PacketPredicate_t *Predicate   = &DS_AppData.FilterPredicate[0];
+
+    PacketEntry->Predicate[0].Width = 1;
+
+    /* Less than zero */
+    PacketEntry->Predicate[0].Operator = DS_PREDICATE_LT;
+    PacketEntry->Predicate[0].Value    = 0;
+    UtAssert_VOIDCALL(DS_TableCompilePredicate(0));
+    UtAssert_UINT32_EQ(Predicate->Term[0].Span, 0xFFFFFFFF);
+    UtAssert_BOOL_TRUE(Predicate->Term[0].Invert);
+
+    /* Greater than the largest value */
+    PacketEntry->Predicate[0].Operator = DS_PREDICATE_GT;
+    PacketEntry->Predicate[0].Value    = 0xFFFFFFFF;
+    UtAssert_VOIDCALL(DS_TableCompilePredicate(0));
+    UtAssert_UINT32_EQ(Predicate->Term[0].Span, 0xFFFFFFFF);
+    UtAssert_BOOL_TRUE(Predicate->Term[0].Invert);
+
+    /* Unknown operator */
+    PacketEntry->Predicate[0].Operator = 99;
+    UtAssert_VOIDCALL(DS_TableCompilePredicate(0));
+    UtAssert_UINT32_EQ(Predicate->Term[0].Span, 0xFFFFFFFF);
+    UtAssert_BOOL_TRUE(Predicate->Term[0].Invert);
+}
+
 void DS_TableFindMsgID_Test(void)
 {
     CFE_SB_MsgId_t MessageID = DS_UT_MID_1;
@@ -1505,7 +2572,8 @@ void DS_TableFindMsgID_Test(void)
     /* Execute the function being tested */
     UtAssert_INT32_EQ(DS_TableFindMsgID(MessageID), HashLink.Index);
 
-    /* Verify results */
+    /* Verify results -- entry and exit markers only when detailed perf logging is enabled */
+    UtAssert_STUB_COUNT(CFE_ES_PerfLogAdd, (DS_DETAIL_PERF_LOG == 1) ? 2 : 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
@@ -1546,6 +2614,27 @@ void DS_TableFindMsgID_Test_Mismatch(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
+void DS_TableFindMsgID_Test_Wildcard(void)
+{
+    CFE_SB_MsgId_t MessageID = DS_UT_MID_1;
+    DS_HashLink_t  HashLink;
+    uint32         HashIndex;
+
+    HashIndex                           = DS_TableHashFunction(MessageID);
+    DS_AppData.WildcardTable[HashIndex] = &HashLink;
+
+    HashLink.Index     = 3;
+    HashLink.MessageID = MessageID;
+    HashLink.Next      = NULL;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(DS_TableFindMsgID(MessageID), 3);
+    UtAssert_INT32_EQ(DS_TableFindMsgID(DS_UT_MID_2), DS_INDEX_NONE);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
 void UtTest_Setup(void)
 {
     UT_DS_TEST_ADD(DS_TableInit_Test_Nominal);
@@ -1578,6 +2667,18 @@ void UtTest_Setup(void)
     UT_DS_TEST_ADD(DS_TableVerifyDestFileEntry_Test_InvalidSizeErrZero);
     UT_DS_TEST_ADD(DS_TableVerifyDestFileEntry_Test_InvalidAgeErrZero);
     UT_DS_TEST_ADD(DS_TableVerifyDestFileEntry_Test_InvalidSequenceCountErrZero);
+    UT_DS_TEST_ADD(DS_TableVerifyDestFileEntry_Test_InvalidFileModeErrZero);
+    UT_DS_TEST_ADD(DS_TableVerifyDestFileEntry_Test_InvalidStorageSizeErrZero);
+    UT_DS_TEST_ADD(DS_TableVerifyDestFileEntry_Test_InvalidTrailerStateErrZero);
+    UT_DS_TEST_ADD(DS_TableVerifyDestFileEntry_Test_InvalidCompressModeErrZero);
+    UT_DS_TEST_ADD(DS_TableVerifyDestFileEntry_Test_InvalidSizeLimitModeErrZero);
+    UT_DS_TEST_ADD(DS_TableVerifyDestFileEntry_Test_InvalidRecordModeErrZero);
+    UT_DS_TEST_ADD(DS_TableVerifyDestFileEntry_Test_InvalidShardModeErrZero);
+
+    if (DS_TRUNCATE_PATCH_LENGTH == 0)
+    {
+        UT_DS_TEST_ADD(DS_TableVerifyDestFileEntry_Test_RingStoreLengthErrZero);
+    }
 
     UT_DS_TEST_ADD(DS_TableVerifyDestFileEntry_Test_InvalidFilenameTypeErrNonZero);
     UT_DS_TEST_ADD(DS_TableVerifyDestFileEntry_Test_InvalidFileEnableStateErrNonZero);
@@ -1588,15 +2689,27 @@ void UtTest_Setup(void)
     UT_DS_TEST_ADD(DS_TableVerifyFilter_Test_Nominal);
     UT_DS_TEST_ADD(DS_TableVerifyFilter_Test_FilterTableVerificationError);
     UT_DS_TEST_ADD(DS_TableVerifyFilter_Test_CountBad);
+    UT_DS_TEST_ADD(DS_TableVerifyFilter_Test_WildcardTooMany);
 
     UT_DS_TEST_ADD(DS_TableVerifyFilterEntry_Test_Nominal);
     UT_DS_TEST_ADD(DS_TableVerifyFilterEntry_Test_Unused);
     UT_DS_TEST_ADD(DS_TableVerifyFilterEntry_Test_InvalidFileTableIndexErrZero);
     UT_DS_TEST_ADD(DS_TableVerifyFilterEntry_Test_InvalidFilterTypeErrZero);
     UT_DS_TEST_ADD(DS_TableVerifyFilterEntry_Test_InvalidFilterParmsErrZero);
+    UT_DS_TEST_ADD(DS_TableVerifyFilterEntry_Test_InvalidPriorityErrZero);
     UT_DS_TEST_ADD(DS_TableVerifyFilterEntry_Test_InvalidFileTableIndexErrNonZero);
     UT_DS_TEST_ADD(DS_TableVerifyFilterEntry_Test_InvalidFilterTypeErrNonZero);
     UT_DS_TEST_ADD(DS_TableVerifyFilterEntry_Test_InvalidFilterParmsErrNonZero);
+    UT_DS_TEST_ADD(DS_TableVerifyFilterEntry_Test_InvalidPriorityErrNonZero);
+    UT_DS_TEST_ADD(DS_TableVerifyFilterEntry_Test_InvalidStoreLengthErrZero);
+    UT_DS_TEST_ADD(DS_TableVerifyFilterEntry_Test_InvalidStoreLengthErrNonZero);
+
+    if (DS_TRUNCATE_PATCH_LENGTH == 0)
+    {
+        UT_DS_TEST_ADD(DS_TableVerifyFilterEntry_Test_RingStoreLengthErrZero);
+    }
+    UT_DS_TEST_ADD(DS_TableVerifyFilterEntry_Test_InvalidPredicateErrZero);
+    UT_DS_TEST_ADD(DS_TableVerifyFilterEntry_Test_InvalidPredicateErrNonZero);
 
     UT_DS_TEST_ADD(DS_TableEntryUnused_Test_Nominal);
     UT_DS_TEST_ADD(DS_TableEntryUnused_Test_Fail);
@@ -1611,6 +2724,47 @@ void UtTest_Setup(void)
 
     UT_DS_TEST_ADD(DS_TableVerifyType_Test_Nominal);
     UT_DS_TEST_ADD(DS_TableVerifyType_Test_Fail);
+    UT_DS_TEST_ADD(DS_TableVerifyType_Test_FailChange);
+    UT_DS_TEST_ADD(DS_TableVerifyFilterType_Test_Nominal);
+    UT_DS_TEST_ADD(DS_TableVerifyFilterType_Test_Fail);
+    UT_DS_TEST_ADD(DS_TableVerifyPriority_Test_Nominal);
+    UT_DS_TEST_ADD(DS_TableVerifyPriority_Test_Fail);
+    UT_DS_TEST_ADD(DS_TableVerifyStoreLength_Test_Nominal);
+    UT_DS_TEST_ADD(DS_TableVerifyStoreLength_Test_Fail);
+    UT_DS_TEST_ADD(DS_TableVerifyStoreLength_Test_Ring);
+    UT_DS_TEST_ADD(DS_TableVerifyDestStoreLength_Test_Nominal);
+    UT_DS_TEST_ADD(DS_TableVerifyDestStoreLength_Test_NoFilterTable);
+
+    if (DS_TRUNCATE_PATCH_LENGTH == 0)
+    {
+        UT_DS_TEST_ADD(DS_TableVerifyDestStoreLength_Test_Fail);
+    }
+    UT_DS_TEST_ADD(DS_TableVerifyPredicate_Test_Nominal);
+    UT_DS_TEST_ADD(DS_TableVerifyPredicate_Test_Fail);
+
+    UT_DS_TEST_ADD(DS_TableVerifyMode_Test_NominalLinear);
+    UT_DS_TEST_ADD(DS_TableVerifyMode_Test_NominalRing);
+    UT_DS_TEST_ADD(DS_TableVerifyMode_Test_Fail);
+
+    UT_DS_TEST_ADD(DS_TableVerifyStorage_Test_NominalNoLimit);
+    UT_DS_TEST_ADD(DS_TableVerifyStorage_Test_Nominal);
+    UT_DS_TEST_ADD(DS_TableVerifyStorage_Test_Fail);
+    UT_DS_TEST_ADD(DS_TableVerifyCompress_Test_NominalNone);
+    UT_DS_TEST_ADD(DS_TableVerifyCompress_Test_NominalLZ);
+    UT_DS_TEST_ADD(DS_TableVerifyCompress_Test_Fail);
+    UT_DS_TEST_ADD(DS_TableVerifyCompress_Test_FailRing);
+    UT_DS_TEST_ADD(DS_TableVerifyCompress_Test_FailIndex);
+    UT_DS_TEST_ADD(DS_TableVerifySizeLimit_Test_Nominal);
+    UT_DS_TEST_ADD(DS_TableVerifySizeLimit_Test_Fail);
+    UT_DS_TEST_ADD(DS_TableVerifyRecord_Test_NominalFull);
+    UT_DS_TEST_ADD(DS_TableVerifyRecord_Test_NominalDelta);
+    UT_DS_TEST_ADD(DS_TableVerifyRecord_Test_Fail);
+    UT_DS_TEST_ADD(DS_TableVerifyRecord_Test_FailKeyframe);
+    UT_DS_TEST_ADD(DS_TableVerifyRecord_Test_FailRing);
+    UT_DS_TEST_ADD(DS_TableVerifyRecord_Test_FailIndex);
+    UT_DS_TEST_ADD(DS_TableVerifyShard_Test_Nominal);
+    UT_DS_TEST_ADD(DS_TableVerifyShard_Test_Fail);
+    UT_DS_TEST_ADD(DS_TableVerifyShard_Test_FailCount);
 
     UT_DS_TEST_ADD(DS_TableVerifyState_Test_NominalEnabled);
     UT_DS_TEST_ADD(DS_TableVerifyState_Test_NominalDisabled);
@@ -1628,12 +2782,16 @@ void UtTest_Setup(void)
     UT_DS_TEST_ADD(DS_TableSubscribe_Test_Unused);
     UT_DS_TEST_ADD(DS_TableSubscribe_Test_Cmd);
     UT_DS_TEST_ADD(DS_TableSubscribe_Test_SendHk);
+    UT_DS_TEST_ADD(DS_TableSubscribe_Test_BacklogProbe);
     UT_DS_TEST_ADD(DS_TableSubscribe_Test_Data);
+    UT_DS_TEST_ADD(DS_TableSubscribe_Test_Wildcard);
 
     UT_DS_TEST_ADD(DS_TableUnsubscribe_Test_Unused);
     UT_DS_TEST_ADD(DS_TableUnsubscribe_Test_Cmd);
     UT_DS_TEST_ADD(DS_TableUnsubscribe_Test_SendHk);
+    UT_DS_TEST_ADD(DS_TableUnsubscribe_Test_BacklogProbe);
     UT_DS_TEST_ADD(DS_TableUnsubscribe_Test_Data);
+    UT_DS_TEST_ADD(DS_TableUnsubscribe_Test_Wildcard);
 
     UT_DS_TEST_ADD(DS_TableCreateCDS_Test_NewCDSArea);
     UT_DS_TEST_ADD(DS_TableCreateCDS_Test_PreExistingCDSArea);
@@ -1646,9 +2804,18 @@ void UtTest_Setup(void)
     UT_DS_TEST_ADD(DS_TableHashFunction_Test);
 
     UT_DS_TEST_ADD(DS_TableCreateHash_Test_Nominal);
+    UT_DS_TEST_ADD(DS_TableCompilePredicate_Test_Nominal);
+    UT_DS_TEST_ADD(DS_TableCompilePredicate_Test_Operators);
+    UT_DS_TEST_ADD(DS_TableCompilePredicate_Test_Never);
+    UT_DS_TEST_ADD(DS_TableCreateHash_Test_Wildcard);
+    UT_DS_TEST_ADD(DS_TableWildcardCount_Test);
+    UT_DS_TEST_ADD(DS_TableAddWildcard_Test_Overlap);
+    UT_DS_TEST_ADD(DS_TableAddWildcard_Test_Full);
+    UT_DS_TEST_ADD(DS_TableAddWildcard_Test_Unused);
 
     UT_DS_TEST_ADD(DS_TableFindMsgID_Test);
     UT_DS_TEST_ADD(DS_TableFindMsgID_Test_NullTable);
 
     UT_DS_TEST_ADD(DS_TableFindMsgID_Test_Mismatch);
+    UT_DS_TEST_ADD(DS_TableFindMsgID_Test_Wildcard);
 }
@@ -25,6 +25,22 @@
 #include "ds_app.h"
 #include "utgenstub.h"
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_AppDecimationLevel()
+ * ----------------------------------------------------
+ */
+uint8 DS_AppDecimationLevel(uint32 Backlog)
+{
+    UT_GenStub_SetupReturnBuffer(DS_AppDecimationLevel, uint8);
+
+    UT_GenStub_AddParam(DS_AppDecimationLevel, uint32, Backlog);
+
+    UT_GenStub_Execute(DS_AppDecimationLevel, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_AppDecimationLevel, uint8);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for DS_AppInitialize()
@@ -39,6 +55,16 @@ CFE_Status_t DS_AppInitialize(void)
     return UT_GenStub_GetReturnValue(DS_AppInitialize, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_AppLowerDecimation()
+ * ----------------------------------------------------
+ */
+void DS_AppLowerDecimation(void)
+{
+    UT_GenStub_Execute(DS_AppLowerDecimation, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for DS_AppMain()
@@ -50,6 +76,59 @@ void DS_AppMain(void)
     UT_GenStub_Execute(DS_AppMain, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_AppProbeBacklog()
+ * ----------------------------------------------------
+ */
+void DS_AppProbeBacklog(void)
+{
+    UT_GenStub_Execute(DS_AppProbeBacklog, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_AppRaiseDecimation()
+ * ----------------------------------------------------
+ */
+void DS_AppRaiseDecimation(uint32 Backlog)
+{
+    UT_GenStub_AddParam(DS_AppRaiseDecimation, uint32, Backlog);
+
+    UT_GenStub_Execute(DS_AppRaiseDecimation, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_AppStatsRecord()
+ * ----------------------------------------------------
+ */
+uint32 DS_AppStatsRecord(DS_StageStats_t *StagePtr, int64 Elapsed)
+{
+    UT_GenStub_SetupReturnBuffer(DS_AppStatsRecord, uint32);
+
+    UT_GenStub_AddParam(DS_AppStatsRecord, DS_StageStats_t *, StagePtr);
+    UT_GenStub_AddParam(DS_AppStatsRecord, int64, Elapsed);
+
+    UT_GenStub_Execute(DS_AppStatsRecord, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_AppStatsRecord, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_AppStatsTime()
+ * ----------------------------------------------------
+ */
+int64 DS_AppStatsTime(void)
+{
+    UT_GenStub_SetupReturnBuffer(DS_AppStatsTime, int64);
+
+    UT_GenStub_Execute(DS_AppStatsTime, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_AppStatsTime, int64);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for DS_AppStorePacket()
@@ -41,6 +41,22 @@ CFE_Status_t DS_AddMidCmd(const DS_AddMidCmd_t *BufPtr)
     return UT_GenStub_GetReturnValue(DS_AddMidCmd, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_BacklogProbeCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t DS_BacklogProbeCmd(const DS_BacklogProbeCmd_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(DS_BacklogProbeCmd, CFE_Status_t);
+
+    UT_GenStub_AddParam(DS_BacklogProbeCmd, const DS_BacklogProbeCmd_t *, BufPtr);
+
+    UT_GenStub_Execute(DS_BacklogProbeCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_BacklogProbeCmd, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for DS_CloseAllCmd()
@@ -73,6 +89,38 @@ CFE_Status_t DS_CloseFileCmd(const DS_CloseFileCmd_t *BufPtr)
     return UT_GenStub_GetReturnValue(DS_CloseFileCmd, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_ExtractFileCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t DS_ExtractFileCmd(const DS_ExtractFileCmd_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(DS_ExtractFileCmd, CFE_Status_t);
+
+    UT_GenStub_AddParam(DS_ExtractFileCmd, const DS_ExtractFileCmd_t *, BufPtr);
+
+    UT_GenStub_Execute(DS_ExtractFileCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_ExtractFileCmd, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_GetDestStatsCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t DS_GetDestStatsCmd(const DS_GetDestStatsCmd_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(DS_GetDestStatsCmd, CFE_Status_t);
+
+    UT_GenStub_AddParam(DS_GetDestStatsCmd, const DS_GetDestStatsCmd_t *, BufPtr);
+
+    UT_GenStub_Execute(DS_GetDestStatsCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_GetDestStatsCmd, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for DS_GetFileInfoCmd()
@@ -89,6 +137,22 @@ CFE_Status_t DS_GetFileInfoCmd(const DS_GetFileInfoCmd_t *BufPtr)
     return UT_GenStub_GetReturnValue(DS_GetFileInfoCmd, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_GetManifestCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t DS_GetManifestCmd(const DS_GetManifestCmd_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(DS_GetManifestCmd, CFE_Status_t);
+
+    UT_GenStub_AddParam(DS_GetManifestCmd, const DS_GetManifestCmd_t *, BufPtr);
+
+    UT_GenStub_Execute(DS_GetManifestCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_GetManifestCmd, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for DS_NoopCmd()
@@ -121,6 +185,86 @@ CFE_Status_t DS_RemoveMidCmd(const DS_RemoveMidCmd_t *BufPtr)
     return UT_GenStub_GetReturnValue(DS_RemoveMidCmd, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_ReplayPauseCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t DS_ReplayPauseCmd(const DS_ReplayPauseCmd_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(DS_ReplayPauseCmd, CFE_Status_t);
+
+    UT_GenStub_AddParam(DS_ReplayPauseCmd, const DS_ReplayPauseCmd_t *, BufPtr);
+
+    UT_GenStub_Execute(DS_ReplayPauseCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_ReplayPauseCmd, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_ReplayResumeCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t DS_ReplayResumeCmd(const DS_ReplayResumeCmd_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(DS_ReplayResumeCmd, CFE_Status_t);
+
+    UT_GenStub_AddParam(DS_ReplayResumeCmd, const DS_ReplayResumeCmd_t *, BufPtr);
+
+    UT_GenStub_Execute(DS_ReplayResumeCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_ReplayResumeCmd, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_ReplaySeekCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t DS_ReplaySeekCmd(const DS_ReplaySeekCmd_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(DS_ReplaySeekCmd, CFE_Status_t);
+
+    UT_GenStub_AddParam(DS_ReplaySeekCmd, const DS_ReplaySeekCmd_t *, BufPtr);
+
+    UT_GenStub_Execute(DS_ReplaySeekCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_ReplaySeekCmd, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_ReplayStartCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t DS_ReplayStartCmd(const DS_ReplayStartCmd_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(DS_ReplayStartCmd, CFE_Status_t);
+
+    UT_GenStub_AddParam(DS_ReplayStartCmd, const DS_ReplayStartCmd_t *, BufPtr);
+
+    UT_GenStub_Execute(DS_ReplayStartCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_ReplayStartCmd, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_ReplayStopCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t DS_ReplayStopCmd(const DS_ReplayStopCmd_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(DS_ReplayStopCmd, CFE_Status_t);
+
+    UT_GenStub_AddParam(DS_ReplayStopCmd, const DS_ReplayStopCmd_t *, BufPtr);
+
+    UT_GenStub_Execute(DS_ReplayStopCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_ReplayStopCmd, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for DS_ResetCountersCmd()
@@ -137,6 +281,22 @@ CFE_Status_t DS_ResetCountersCmd(const DS_ResetCountersCmd_t *BufPtr)
     return UT_GenStub_GetReturnValue(DS_ResetCountersCmd, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_SendCacheCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t DS_SendCacheCmd(const DS_SendCacheCmd_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(DS_SendCacheCmd, CFE_Status_t);
+
+    UT_GenStub_AddParam(DS_SendCacheCmd, const DS_SendCacheCmd_t *, BufPtr);
+
+    UT_GenStub_Execute(DS_SendCacheCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_SendCacheCmd, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for DS_SendHkCmd()
@@ -249,6 +409,22 @@ CFE_Status_t DS_SetDestPathCmd(const DS_SetDestPathCmd_t *BufPtr)
     return UT_GenStub_GetReturnValue(DS_SetDestPathCmd, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_SetDestRateCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t DS_SetDestRateCmd(const DS_SetDestRateCmd_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(DS_SetDestRateCmd, CFE_Status_t);
+
+    UT_GenStub_AddParam(DS_SetDestRateCmd, const DS_SetDestRateCmd_t *, BufPtr);
+
+    UT_GenStub_Execute(DS_SetDestRateCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_SetDestRateCmd, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for DS_SetDestSizeCmd()
@@ -329,6 +505,22 @@ CFE_Status_t DS_SetFilterParmsCmd(const DS_SetFilterParmsCmd_t *BufPtr)
     return UT_GenStub_GetReturnValue(DS_SetFilterParmsCmd, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_SetFilterRateCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t DS_SetFilterRateCmd(const DS_SetFilterRateCmd_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(DS_SetFilterRateCmd, CFE_Status_t);
+
+    UT_GenStub_AddParam(DS_SetFilterRateCmd, const DS_SetFilterRateCmd_t *, BufPtr);
+
+    UT_GenStub_Execute(DS_SetFilterRateCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_SetFilterRateCmd, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for DS_SetFilterTypeCmd()
@@ -344,3 +536,51 @@ CFE_Status_t DS_SetFilterTypeCmd(const DS_SetFilterTypeCmd_t *BufPtr)
 
     return UT_GenStub_GetReturnValue(DS_SetFilterTypeCmd, CFE_Status_t);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_SetRecorderCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t DS_SetRecorderCmd(const DS_SetRecorderCmd_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(DS_SetRecorderCmd, CFE_Status_t);
+
+    UT_GenStub_AddParam(DS_SetRecorderCmd, const DS_SetRecorderCmd_t *, BufPtr);
+
+    UT_GenStub_Execute(DS_SetRecorderCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_SetRecorderCmd, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_TriggerRecorderCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t DS_TriggerRecorderCmd(const DS_TriggerRecorderCmd_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(DS_TriggerRecorderCmd, CFE_Status_t);
+
+    UT_GenStub_AddParam(DS_TriggerRecorderCmd, const DS_TriggerRecorderCmd_t *, BufPtr);
+
+    UT_GenStub_Execute(DS_TriggerRecorderCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_TriggerRecorderCmd, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_WriteCacheCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t DS_WriteCacheCmd(const DS_WriteCacheCmd_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(DS_WriteCacheCmd, CFE_Status_t);
+
+    UT_GenStub_AddParam(DS_WriteCacheCmd, const DS_WriteCacheCmd_t *, BufPtr);
+
+    UT_GenStub_Execute(DS_WriteCacheCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_WriteCacheCmd, CFE_Status_t);
+}
@@ -0,0 +1,124 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in ds_compress header
+ */
+
+#include "ds_compress.h"
+#include "utgenstub.h"
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_CompressBlock()
+ * ----------------------------------------------------
+ */
+uint32 DS_CompressBlock(const uint8 *Src, uint32 SrcSize, uint8 *Dst, uint32 DstSize)
+{
+    UT_GenStub_SetupReturnBuffer(DS_CompressBlock, uint32);
+
+    UT_GenStub_AddParam(DS_CompressBlock, const uint8 *, Src);
+    UT_GenStub_AddParam(DS_CompressBlock, uint32, SrcSize);
+    UT_GenStub_AddParam(DS_CompressBlock, uint8 *, Dst);
+    UT_GenStub_AddParam(DS_CompressBlock, uint32, DstSize);
+
+    UT_GenStub_Execute(DS_CompressBlock, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_CompressBlock, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_CompressLength()
+ * ----------------------------------------------------
+ */
+uint32 DS_CompressLength(uint8 *Dst, uint32 DstPos, uint32 Length)
+{
+    UT_GenStub_SetupReturnBuffer(DS_CompressLength, uint32);
+
+    UT_GenStub_AddParam(DS_CompressLength, uint8 *, Dst);
+    UT_GenStub_AddParam(DS_CompressLength, uint32, DstPos);
+    UT_GenStub_AddParam(DS_CompressLength, uint32, Length);
+
+    UT_GenStub_Execute(DS_CompressLength, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_CompressLength, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_CompressSequence()
+ * ----------------------------------------------------
+ */
+bool DS_CompressSequence(uint8 *Dst, uint32 DstSize, uint32 *DstPos, const uint8 *Literals, uint32 LiteralLength,
+                         uint32 Offset, uint32 MatchLength)
+{
+    UT_GenStub_SetupReturnBuffer(DS_CompressSequence, bool);
+
+    UT_GenStub_AddParam(DS_CompressSequence, uint8 *, Dst);
+    UT_GenStub_AddParam(DS_CompressSequence, uint32, DstSize);
+    UT_GenStub_AddParam(DS_CompressSequence, uint32 *, DstPos);
+    UT_GenStub_AddParam(DS_CompressSequence, const uint8 *, Literals);
+    UT_GenStub_AddParam(DS_CompressSequence, uint32, LiteralLength);
+    UT_GenStub_AddParam(DS_CompressSequence, uint32, Offset);
+    UT_GenStub_AddParam(DS_CompressSequence, uint32, MatchLength);
+
+    UT_GenStub_Execute(DS_CompressSequence, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_CompressSequence, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_DecompressBlock()
+ * ----------------------------------------------------
+ */
+uint32 DS_DecompressBlock(const uint8 *Src, uint32 SrcSize, uint8 *Dst, uint32 DstSize)
+{
+    UT_GenStub_SetupReturnBuffer(DS_DecompressBlock, uint32);
+
+    UT_GenStub_AddParam(DS_DecompressBlock, const uint8 *, Src);
+    UT_GenStub_AddParam(DS_DecompressBlock, uint32, SrcSize);
+    UT_GenStub_AddParam(DS_DecompressBlock, uint8 *, Dst);
+    UT_GenStub_AddParam(DS_DecompressBlock, uint32, DstSize);
+
+    UT_GenStub_Execute(DS_DecompressBlock, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_DecompressBlock, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_DecompressLength()
+ * ----------------------------------------------------
+ */
+bool DS_DecompressLength(const uint8 *Src, uint32 SrcSize, uint32 *SrcPos, uint32 *Length)
+{
+    UT_GenStub_SetupReturnBuffer(DS_DecompressLength, bool);
+
+    UT_GenStub_AddParam(DS_DecompressLength, const uint8 *, Src);
+    UT_GenStub_AddParam(DS_DecompressLength, uint32, SrcSize);
+    UT_GenStub_AddParam(DS_DecompressLength, uint32 *, SrcPos);
+    UT_GenStub_AddParam(DS_DecompressLength, uint32 *, Length);
+
+    UT_GenStub_Execute(DS_DecompressLength, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_DecompressLength, bool);
+}
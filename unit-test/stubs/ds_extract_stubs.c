@@ -0,0 +1,168 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in ds_extract header
+ */
+
+#include "ds_extract.h"
+#include "utgenstub.h"
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_ExtractCheckFormat()
+ * ----------------------------------------------------
+ */
+int32 DS_ExtractCheckFormat(osal_id_t SourceHandle, uint32 DataStart, uint32 DataEnd)
+{
+    UT_GenStub_SetupReturnBuffer(DS_ExtractCheckFormat, int32);
+
+    UT_GenStub_AddParam(DS_ExtractCheckFormat, osal_id_t, SourceHandle);
+    UT_GenStub_AddParam(DS_ExtractCheckFormat, uint32, DataStart);
+    UT_GenStub_AddParam(DS_ExtractCheckFormat, uint32, DataEnd);
+
+    UT_GenStub_Execute(DS_ExtractCheckFormat, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_ExtractCheckFormat, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_ExtractCopyHeader()
+ * ----------------------------------------------------
+ */
+int32 DS_ExtractCopyHeader(osal_id_t SourceHandle, osal_id_t TargetHandle, uint32 HeaderSize)
+{
+    UT_GenStub_SetupReturnBuffer(DS_ExtractCopyHeader, int32);
+
+    UT_GenStub_AddParam(DS_ExtractCopyHeader, osal_id_t, SourceHandle);
+    UT_GenStub_AddParam(DS_ExtractCopyHeader, osal_id_t, TargetHandle);
+    UT_GenStub_AddParam(DS_ExtractCopyHeader, uint32, HeaderSize);
+
+    UT_GenStub_Execute(DS_ExtractCopyHeader, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_ExtractCopyHeader, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_ExtractDataRange()
+ * ----------------------------------------------------
+ */
+int32 DS_ExtractDataRange(osal_id_t SourceHandle, uint32 DataStart, uint32 *FileSize, uint32 *DataEnd)
+{
+    UT_GenStub_SetupReturnBuffer(DS_ExtractDataRange, int32);
+
+    UT_GenStub_AddParam(DS_ExtractDataRange, osal_id_t, SourceHandle);
+    UT_GenStub_AddParam(DS_ExtractDataRange, uint32, DataStart);
+    UT_GenStub_AddParam(DS_ExtractDataRange, uint32 *, FileSize);
+    UT_GenStub_AddParam(DS_ExtractDataRange, uint32 *, DataEnd);
+
+    UT_GenStub_Execute(DS_ExtractDataRange, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_ExtractDataRange, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_ExtractFile()
+ * ----------------------------------------------------
+ */
+void DS_ExtractFile(void)
+{
+    UT_GenStub_Execute(DS_ExtractFile, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_ExtractIndexRange()
+ * ----------------------------------------------------
+ */
+void DS_ExtractIndexRange(const char *SourceName, uint32 StartSeconds, uint32 StopSeconds, uint32 FileSize,
+                          uint32 *DataStart, uint32 *DataEnd)
+{
+    UT_GenStub_AddParam(DS_ExtractIndexRange, const char *, SourceName);
+    UT_GenStub_AddParam(DS_ExtractIndexRange, uint32, StartSeconds);
+    UT_GenStub_AddParam(DS_ExtractIndexRange, uint32, StopSeconds);
+    UT_GenStub_AddParam(DS_ExtractIndexRange, uint32, FileSize);
+    UT_GenStub_AddParam(DS_ExtractIndexRange, uint32 *, DataStart);
+    UT_GenStub_AddParam(DS_ExtractIndexRange, uint32 *, DataEnd);
+
+    UT_GenStub_Execute(DS_ExtractIndexRange, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_ExtractInit()
+ * ----------------------------------------------------
+ */
+CFE_Status_t DS_ExtractInit(void)
+{
+    UT_GenStub_SetupReturnBuffer(DS_ExtractInit, CFE_Status_t);
+
+    UT_GenStub_Execute(DS_ExtractInit, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_ExtractInit, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_ExtractPacketMatch()
+ * ----------------------------------------------------
+ */
+bool DS_ExtractPacketMatch(const CFE_MSG_Message_t *MsgPtr)
+{
+    UT_GenStub_SetupReturnBuffer(DS_ExtractPacketMatch, bool);
+
+    UT_GenStub_AddParam(DS_ExtractPacketMatch, const CFE_MSG_Message_t *, MsgPtr);
+
+    UT_GenStub_Execute(DS_ExtractPacketMatch, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_ExtractPacketMatch, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_ExtractScan()
+ * ----------------------------------------------------
+ */
+int32 DS_ExtractScan(osal_id_t SourceHandle, osal_id_t TargetHandle, uint32 DataStart, uint32 DataEnd)
+{
+    UT_GenStub_SetupReturnBuffer(DS_ExtractScan, int32);
+
+    UT_GenStub_AddParam(DS_ExtractScan, osal_id_t, SourceHandle);
+    UT_GenStub_AddParam(DS_ExtractScan, osal_id_t, TargetHandle);
+    UT_GenStub_AddParam(DS_ExtractScan, uint32, DataStart);
+    UT_GenStub_AddParam(DS_ExtractScan, uint32, DataEnd);
+
+    UT_GenStub_Execute(DS_ExtractScan, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_ExtractScan, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_ExtractTask()
+ * ----------------------------------------------------
+ */
+void DS_ExtractTask(void)
+{
+    UT_GenStub_Execute(DS_ExtractTask, Basic, NULL);
+}
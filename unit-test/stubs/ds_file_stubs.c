@@ -25,6 +25,96 @@
 #include "ds_file.h"
 #include "utgenstub.h"
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_DecimateAlgorithmX()
+ * ----------------------------------------------------
+ */
+uint16 DS_DecimateAlgorithmX(uint16 Algorithm_X, uint16 Priority, uint8 DecimationLevel)
+{
+    UT_GenStub_SetupReturnBuffer(DS_DecimateAlgorithmX, uint16);
+
+    UT_GenStub_AddParam(DS_DecimateAlgorithmX, uint16, Algorithm_X);
+    UT_GenStub_AddParam(DS_DecimateAlgorithmX, uint16, Priority);
+    UT_GenStub_AddParam(DS_DecimateAlgorithmX, uint8, DecimationLevel);
+
+    UT_GenStub_Execute(DS_DecimateAlgorithmX, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_DecimateAlgorithmX, uint16);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_FileCacheFind()
+ * ----------------------------------------------------
+ */
+const DS_CacheEntry_t *DS_FileCacheFind(CFE_SB_MsgId_t MessageID)
+{
+    UT_GenStub_SetupReturnBuffer(DS_FileCacheFind, const DS_CacheEntry_t *);
+
+    UT_GenStub_AddParam(DS_FileCacheFind, CFE_SB_MsgId_t, MessageID);
+
+    UT_GenStub_Execute(DS_FileCacheFind, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_FileCacheFind, const DS_CacheEntry_t *);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_FileCacheIndex()
+ * ----------------------------------------------------
+ */
+int32 DS_FileCacheIndex(CFE_SB_MsgId_t MessageID)
+{
+    UT_GenStub_SetupReturnBuffer(DS_FileCacheIndex, int32);
+
+    UT_GenStub_AddParam(DS_FileCacheIndex, CFE_SB_MsgId_t, MessageID);
+
+    UT_GenStub_Execute(DS_FileCacheIndex, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_FileCacheIndex, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_FileCacheRebuild()
+ * ----------------------------------------------------
+ */
+void DS_FileCacheRebuild(void)
+{
+    UT_GenStub_Execute(DS_FileCacheRebuild, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_FileCacheStore()
+ * ----------------------------------------------------
+ */
+void DS_FileCacheStore(CFE_SB_MsgId_t MessageID, const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_GenStub_AddParam(DS_FileCacheStore, CFE_SB_MsgId_t, MessageID);
+    UT_GenStub_AddParam(DS_FileCacheStore, const CFE_SB_Buffer_t *, BufPtr);
+
+    UT_GenStub_Execute(DS_FileCacheStore, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_FileCacheWrite()
+ * ----------------------------------------------------
+ */
+int32 DS_FileCacheWrite(const char *FileName, uint32 *PacketCount)
+{
+    UT_GenStub_SetupReturnBuffer(DS_FileCacheWrite, int32);
+
+    UT_GenStub_AddParam(DS_FileCacheWrite, const char *, FileName);
+    UT_GenStub_AddParam(DS_FileCacheWrite, uint32 *, PacketCount);
+
+    UT_GenStub_Execute(DS_FileCacheWrite, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_FileCacheWrite, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for DS_FileCloseDest()
@@ -37,6 +127,52 @@ void DS_FileCloseDest(int32 FileIndex)
     UT_GenStub_Execute(DS_FileCloseDest, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_FileCompressClose()
+ * ----------------------------------------------------
+ */
+void DS_FileCompressClose(int32 FileIndex)
+{
+    UT_GenStub_AddParam(DS_FileCompressClose, int32, FileIndex);
+
+    UT_GenStub_Execute(DS_FileCompressClose, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_FileCompressData()
+ * ----------------------------------------------------
+ */
+int32 DS_FileCompressData(int32 FileIndex, const void *FileData, uint32 DataLength)
+{
+    UT_GenStub_SetupReturnBuffer(DS_FileCompressData, int32);
+
+    UT_GenStub_AddParam(DS_FileCompressData, int32, FileIndex);
+    UT_GenStub_AddParam(DS_FileCompressData, const void *, FileData);
+    UT_GenStub_AddParam(DS_FileCompressData, uint32, DataLength);
+
+    UT_GenStub_Execute(DS_FileCompressData, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_FileCompressData, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_FileCompressFlush()
+ * ----------------------------------------------------
+ */
+int32 DS_FileCompressFlush(int32 FileIndex)
+{
+    UT_GenStub_SetupReturnBuffer(DS_FileCompressFlush, int32);
+
+    UT_GenStub_AddParam(DS_FileCompressFlush, int32, FileIndex);
+
+    UT_GenStub_Execute(DS_FileCompressFlush, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_FileCompressFlush, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for DS_FileCreateDest()
@@ -75,19 +211,486 @@ void DS_FileCreateSequence(char *Buffer, uint32 Type, uint32 Count)
     UT_GenStub_Execute(DS_FileCreateSequence, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_FileEchoRecord()
+ * ----------------------------------------------------
+ */
+void DS_FileEchoRecord(DS_EchoTable_t *EchoTable, const CFE_MSG_Message_t *MessagePtr)
+{
+    UT_GenStub_AddParam(DS_FileEchoRecord, DS_EchoTable_t *, EchoTable);
+    UT_GenStub_AddParam(DS_FileEchoRecord, const CFE_MSG_Message_t *, MessagePtr);
+
+    UT_GenStub_Execute(DS_FileEchoRecord, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_FileIndexClose()
+ * ----------------------------------------------------
+ */
+void DS_FileIndexClose(int32 FileIndex)
+{
+    UT_GenStub_AddParam(DS_FileIndexClose, int32, FileIndex);
+
+    UT_GenStub_Execute(DS_FileIndexClose, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_FileIndexCreate()
+ * ----------------------------------------------------
+ */
+void DS_FileIndexCreate(int32 FileIndex)
+{
+    UT_GenStub_AddParam(DS_FileIndexCreate, int32, FileIndex);
+
+    UT_GenStub_Execute(DS_FileIndexCreate, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_FileIndexError()
+ * ----------------------------------------------------
+ */
+void DS_FileIndexError(int32 FileIndex, int32 Result)
+{
+    UT_GenStub_AddParam(DS_FileIndexError, int32, FileIndex);
+    UT_GenStub_AddParam(DS_FileIndexError, int32, Result);
+
+    UT_GenStub_Execute(DS_FileIndexError, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_FileIndexFlush()
+ * ----------------------------------------------------
+ */
+void DS_FileIndexFlush(int32 FileIndex)
+{
+    UT_GenStub_AddParam(DS_FileIndexFlush, int32, FileIndex);
+
+    UT_GenStub_Execute(DS_FileIndexFlush, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_FileIndexMove()
+ * ----------------------------------------------------
+ */
+void DS_FileIndexMove(int32 FileIndex, const char *DataName)
+{
+    UT_GenStub_AddParam(DS_FileIndexMove, int32, FileIndex);
+    UT_GenStub_AddParam(DS_FileIndexMove, const char *, DataName);
+
+    UT_GenStub_Execute(DS_FileIndexMove, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_FileIndexPacket()
+ * ----------------------------------------------------
+ */
+void DS_FileIndexPacket(int32 FileIndex, const CFE_MSG_Message_t *MsgPtr, uint32 FileOffset)
+{
+    UT_GenStub_AddParam(DS_FileIndexPacket, int32, FileIndex);
+    UT_GenStub_AddParam(DS_FileIndexPacket, const CFE_MSG_Message_t *, MsgPtr);
+    UT_GenStub_AddParam(DS_FileIndexPacket, uint32, FileOffset);
+
+    UT_GenStub_Execute(DS_FileIndexPacket, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_FileLimitSize()
+ * ----------------------------------------------------
+ */
+uint32 DS_FileLimitSize(int32 FileIndex, uint32 DataLength)
+{
+    UT_GenStub_SetupReturnBuffer(DS_FileLimitSize, uint32);
+
+    UT_GenStub_AddParam(DS_FileLimitSize, int32, FileIndex);
+    UT_GenStub_AddParam(DS_FileLimitSize, uint32, DataLength);
+
+    UT_GenStub_Execute(DS_FileLimitSize, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_FileLimitSize, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_FileLogicalSize()
+ * ----------------------------------------------------
+ */
+uint32 DS_FileLogicalSize(const DS_AppFileStatus_t *FileStatus)
+{
+    UT_GenStub_SetupReturnBuffer(DS_FileLogicalSize, uint32);
+
+    UT_GenStub_AddParam(DS_FileLogicalSize, const DS_AppFileStatus_t *, FileStatus);
+
+    UT_GenStub_Execute(DS_FileLogicalSize, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_FileLogicalSize, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_FileManifestAppend()
+ * ----------------------------------------------------
+ */
+void DS_FileManifestAppend(int32 FileIndex, const char *FileName)
+{
+    UT_GenStub_AddParam(DS_FileManifestAppend, int32, FileIndex);
+    UT_GenStub_AddParam(DS_FileManifestAppend, const char *, FileName);
+
+    UT_GenStub_Execute(DS_FileManifestAppend, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_FileManifestEvict()
+ * ----------------------------------------------------
+ */
+void DS_FileManifestEvict(int32 FileIndex, const DS_ClosedFile_t *ClosedFile)
+{
+    UT_GenStub_AddParam(DS_FileManifestEvict, int32, FileIndex);
+    UT_GenStub_AddParam(DS_FileManifestEvict, const DS_ClosedFile_t *, ClosedFile);
+
+    UT_GenStub_Execute(DS_FileManifestEvict, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_FileManifestName()
+ * ----------------------------------------------------
+ */
+bool DS_FileManifestName(int32 FileIndex, char *ManifestName, size_t BufSize)
+{
+    UT_GenStub_SetupReturnBuffer(DS_FileManifestName, bool);
+
+    UT_GenStub_AddParam(DS_FileManifestName, int32, FileIndex);
+    UT_GenStub_AddParam(DS_FileManifestName, char *, ManifestName);
+    UT_GenStub_AddParam(DS_FileManifestName, size_t, BufSize);
+
+    UT_GenStub_Execute(DS_FileManifestName, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_FileManifestName, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_FileManifestWrite()
+ * ----------------------------------------------------
+ */
+bool DS_FileManifestWrite(int32 FileIndex, const char *ManifestName, const DS_FileManifestRecord_t *Record)
+{
+    UT_GenStub_SetupReturnBuffer(DS_FileManifestWrite, bool);
+
+    UT_GenStub_AddParam(DS_FileManifestWrite, int32, FileIndex);
+    UT_GenStub_AddParam(DS_FileManifestWrite, const char *, ManifestName);
+    UT_GenStub_AddParam(DS_FileManifestWrite, const DS_FileManifestRecord_t *, Record);
+
+    UT_GenStub_Execute(DS_FileManifestWrite, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_FileManifestWrite, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_FileRecordApply()
+ * ----------------------------------------------------
+ */
+void DS_FileRecordApply(const CFE_MSG_TelemetryHeader_t *RefHeader, uint32 SeqDelta, uint32 TimeDelta,
+                        CFE_MSG_TelemetryHeader_t *Header)
+{
+    UT_GenStub_AddParam(DS_FileRecordApply, const CFE_MSG_TelemetryHeader_t *, RefHeader);
+    UT_GenStub_AddParam(DS_FileRecordApply, uint32, SeqDelta);
+    UT_GenStub_AddParam(DS_FileRecordApply, uint32, TimeDelta);
+    UT_GenStub_AddParam(DS_FileRecordApply, CFE_MSG_TelemetryHeader_t *, Header);
+
+    UT_GenStub_Execute(DS_FileRecordApply, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_FileRecordEncode()
+ * ----------------------------------------------------
+ */
+bool DS_FileRecordEncode(int32 FileIndex, const CFE_MSG_Message_t *MsgPtr, uint32 DataLength, uint32 *RecordLength)
+{
+    UT_GenStub_SetupReturnBuffer(DS_FileRecordEncode, bool);
+
+    UT_GenStub_AddParam(DS_FileRecordEncode, int32, FileIndex);
+    UT_GenStub_AddParam(DS_FileRecordEncode, const CFE_MSG_Message_t *, MsgPtr);
+    UT_GenStub_AddParam(DS_FileRecordEncode, uint32, DataLength);
+    UT_GenStub_AddParam(DS_FileRecordEncode, uint32 *, RecordLength);
+
+    UT_GenStub_Execute(DS_FileRecordEncode, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_FileRecordEncode, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_FileRecordFind()
+ * ----------------------------------------------------
+ */
+DS_FileRecordRef_t *DS_FileRecordFind(int32 FileIndex, uint16 StreamId)
+{
+    UT_GenStub_SetupReturnBuffer(DS_FileRecordFind, DS_FileRecordRef_t *);
+
+    UT_GenStub_AddParam(DS_FileRecordFind, int32, FileIndex);
+    UT_GenStub_AddParam(DS_FileRecordFind, uint16, StreamId);
+
+    UT_GenStub_Execute(DS_FileRecordFind, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_FileRecordFind, DS_FileRecordRef_t *);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_FileRecorderCheck()
+ * ----------------------------------------------------
+ */
+void DS_FileRecorderCheck(CFE_SB_MsgId_t MessageID)
+{
+    UT_GenStub_AddParam(DS_FileRecorderCheck, CFE_SB_MsgId_t, MessageID);
+
+    UT_GenStub_Execute(DS_FileRecorderCheck, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_FileRecorderDiscard()
+ * ----------------------------------------------------
+ */
+void DS_FileRecorderDiscard(DS_RecorderStatus_t *Recorder)
+{
+    UT_GenStub_AddParam(DS_FileRecorderDiscard, DS_RecorderStatus_t *, Recorder);
+
+    UT_GenStub_Execute(DS_FileRecorderDiscard, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_FileRecorderDrain()
+ * ----------------------------------------------------
+ */
+void DS_FileRecorderDrain(uint32 MaxPackets)
+{
+    UT_GenStub_AddParam(DS_FileRecorderDrain, uint32, MaxPackets);
+
+    UT_GenStub_Execute(DS_FileRecorderDrain, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_FileRecorderRoom()
+ * ----------------------------------------------------
+ */
+bool DS_FileRecorderRoom(const DS_RecorderStatus_t *Recorder, uint32 RecordSize, uint32 *Offset)
+{
+    UT_GenStub_SetupReturnBuffer(DS_FileRecorderRoom, bool);
+
+    UT_GenStub_AddParam(DS_FileRecorderRoom, const DS_RecorderStatus_t *, Recorder);
+    UT_GenStub_AddParam(DS_FileRecorderRoom, uint32, RecordSize);
+    UT_GenStub_AddParam(DS_FileRecorderRoom, uint32 *, Offset);
+
+    UT_GenStub_Execute(DS_FileRecorderRoom, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_FileRecorderRoom, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_FileRecorderStore()
+ * ----------------------------------------------------
+ */
+void DS_FileRecorderStore(uint16 RecorderIndex, const CFE_SB_Buffer_t *BufPtr, uint16 MaxStoreLength)
+{
+    UT_GenStub_AddParam(DS_FileRecorderStore, uint16, RecorderIndex);
+    UT_GenStub_AddParam(DS_FileRecorderStore, const CFE_SB_Buffer_t *, BufPtr);
+    UT_GenStub_AddParam(DS_FileRecorderStore, uint16, MaxStoreLength);
+
+    UT_GenStub_Execute(DS_FileRecorderStore, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_FileRecorderTrigger()
+ * ----------------------------------------------------
+ */
+void DS_FileRecorderTrigger(uint16 RecorderIndex, const char *Source)
+{
+    UT_GenStub_AddParam(DS_FileRecorderTrigger, uint16, RecorderIndex);
+    UT_GenStub_AddParam(DS_FileRecorderTrigger, const char *, Source);
+
+    UT_GenStub_Execute(DS_FileRecorderTrigger, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_FileRingInit()
+ * ----------------------------------------------------
+ */
+void DS_FileRingInit(int32 FileIndex)
+{
+    UT_GenStub_AddParam(DS_FileRingInit, int32, FileIndex);
+
+    UT_GenStub_Execute(DS_FileRingInit, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_FileRingPrepare()
+ * ----------------------------------------------------
+ */
+bool DS_FileRingPrepare(int32 FileIndex, uint32 DataLength)
+{
+    UT_GenStub_SetupReturnBuffer(DS_FileRingPrepare, bool);
+
+    UT_GenStub_AddParam(DS_FileRingPrepare, int32, FileIndex);
+    UT_GenStub_AddParam(DS_FileRingPrepare, uint32, DataLength);
+
+    UT_GenStub_Execute(DS_FileRingPrepare, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_FileRingPrepare, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_FileRingUpdateHeader()
+ * ----------------------------------------------------
+ */
+void DS_FileRingUpdateHeader(int32 FileIndex)
+{
+    UT_GenStub_AddParam(DS_FileRingUpdateHeader, int32, FileIndex);
+
+    UT_GenStub_Execute(DS_FileRingUpdateHeader, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_FileRingWalk()
+ * ----------------------------------------------------
+ */
+void DS_FileRingWalk(int32 FileIndex)
+{
+    UT_GenStub_AddParam(DS_FileRingWalk, int32, FileIndex);
+
+    UT_GenStub_Execute(DS_FileRingWalk, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for DS_FileSetupWrite()
  * ----------------------------------------------------
  */
-void DS_FileSetupWrite(int32 FileIndex, const CFE_SB_Buffer_t *BufPtr)
+void DS_FileSetupWrite(int32 FileIndex, const CFE_SB_Buffer_t *BufPtr, uint16 MaxStoreLength)
 {
     UT_GenStub_AddParam(DS_FileSetupWrite, int32, FileIndex);
     UT_GenStub_AddParam(DS_FileSetupWrite, const CFE_SB_Buffer_t *, BufPtr);
+    UT_GenStub_AddParam(DS_FileSetupWrite, uint16, MaxStoreLength);
 
     UT_GenStub_Execute(DS_FileSetupWrite, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_FileShardCreate()
+ * ----------------------------------------------------
+ */
+int32 DS_FileShardCreate(const char *DirName, size_t BaseLength, char *KnownDir)
+{
+    UT_GenStub_SetupReturnBuffer(DS_FileShardCreate, int32);
+
+    UT_GenStub_AddParam(DS_FileShardCreate, const char *, DirName);
+    UT_GenStub_AddParam(DS_FileShardCreate, size_t, BaseLength);
+    UT_GenStub_AddParam(DS_FileShardCreate, char *, KnownDir);
+
+    UT_GenStub_Execute(DS_FileShardCreate, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_FileShardCreate, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_FileShardName()
+ * ----------------------------------------------------
+ */
+void DS_FileShardName(uint32 FileIndex, const char *TimeSequence, char *Buffer)
+{
+    UT_GenStub_AddParam(DS_FileShardName, uint32, FileIndex);
+    UT_GenStub_AddParam(DS_FileShardName, const char *, TimeSequence);
+    UT_GenStub_AddParam(DS_FileShardName, char *, Buffer);
+
+    UT_GenStub_Execute(DS_FileShardName, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_FileStorageCheck()
+ * ----------------------------------------------------
+ */
+void DS_FileStorageCheck(int32 FileIndex)
+{
+    UT_GenStub_AddParam(DS_FileStorageCheck, int32, FileIndex);
+
+    UT_GenStub_Execute(DS_FileStorageCheck, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_FileStorageEvict()
+ * ----------------------------------------------------
+ */
+void DS_FileStorageEvict(int32 FileIndex)
+{
+    UT_GenStub_AddParam(DS_FileStorageEvict, int32, FileIndex);
+
+    UT_GenStub_Execute(DS_FileStorageEvict, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_FileStorageForget()
+ * ----------------------------------------------------
+ */
+void DS_FileStorageForget(int32 FileIndex)
+{
+    UT_GenStub_AddParam(DS_FileStorageForget, int32, FileIndex);
+
+    UT_GenStub_Execute(DS_FileStorageForget, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_FileStorageRemember()
+ * ----------------------------------------------------
+ */
+void DS_FileStorageRemember(int32 FileIndex)
+{
+    UT_GenStub_AddParam(DS_FileStorageRemember, int32, FileIndex);
+
+    UT_GenStub_Execute(DS_FileStorageRemember, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_FileStorageVictim()
+ * ----------------------------------------------------
+ */
+int32 DS_FileStorageVictim(uint16 StoragePriority)
+{
+    UT_GenStub_SetupReturnBuffer(DS_FileStorageVictim, int32);
+
+    UT_GenStub_AddParam(DS_FileStorageVictim, uint16, StoragePriority);
+
+    UT_GenStub_Execute(DS_FileStorageVictim, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_FileStorageVictim, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for DS_FileStorePacket()
@@ -113,6 +716,32 @@ void DS_FileTestAge(uint32 ElapsedSeconds)
     UT_GenStub_Execute(DS_FileTestAge, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_FileTrailerPacket()
+ * ----------------------------------------------------
+ */
+void DS_FileTrailerPacket(int32 FileIndex, const CFE_MSG_Message_t *MsgPtr, uint32 DataLength)
+{
+    UT_GenStub_AddParam(DS_FileTrailerPacket, int32, FileIndex);
+    UT_GenStub_AddParam(DS_FileTrailerPacket, const CFE_MSG_Message_t *, MsgPtr);
+    UT_GenStub_AddParam(DS_FileTrailerPacket, uint32, DataLength);
+
+    UT_GenStub_Execute(DS_FileTrailerPacket, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_FileTrailerWrite()
+ * ----------------------------------------------------
+ */
+void DS_FileTrailerWrite(int32 FileIndex)
+{
+    UT_GenStub_AddParam(DS_FileTrailerWrite, int32, FileIndex);
+
+    UT_GenStub_Execute(DS_FileTrailerWrite, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for DS_FileTransmit()
@@ -125,6 +754,46 @@ void DS_FileTransmit(DS_AppFileStatus_t *FileStatus)
     UT_GenStub_Execute(DS_FileTransmit, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_FileTransmitDestStats()
+ * ----------------------------------------------------
+ */
+void DS_FileTransmitDestStats(void)
+{
+    UT_GenStub_Execute(DS_FileTransmitDestStats, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_FileTransmitManifest()
+ * ----------------------------------------------------
+ */
+void DS_FileTransmitManifest(int32 FileIndex, const char *ManifestName)
+{
+    UT_GenStub_AddParam(DS_FileTransmitManifest, int32, FileIndex);
+    UT_GenStub_AddParam(DS_FileTransmitManifest, const char *, ManifestName);
+
+    UT_GenStub_Execute(DS_FileTransmitManifest, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_FileTruncatePacket()
+ * ----------------------------------------------------
+ */
+uint32 DS_FileTruncatePacket(const CFE_MSG_Message_t *MsgPtr, uint32 StoreLength)
+{
+    UT_GenStub_SetupReturnBuffer(DS_FileTruncatePacket, uint32);
+
+    UT_GenStub_AddParam(DS_FileTruncatePacket, const CFE_MSG_Message_t *, MsgPtr);
+    UT_GenStub_AddParam(DS_FileTruncatePacket, uint32, StoreLength);
+
+    UT_GenStub_Execute(DS_FileTruncatePacket, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_FileTruncatePacket, uint32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for DS_FileUpdateHeader()
@@ -177,6 +846,24 @@ void DS_FileWriteHeader(int32 FileIndex)
     UT_GenStub_Execute(DS_FileWriteHeader, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_IsPacketEcho()
+ * ----------------------------------------------------
+ */
+bool DS_IsPacketEcho(DS_EchoTable_t *EchoTable, CFE_SB_MsgId_t MessageID, const CFE_MSG_Message_t *MessagePtr)
+{
+    UT_GenStub_SetupReturnBuffer(DS_IsPacketEcho, bool);
+
+    UT_GenStub_AddParam(DS_IsPacketEcho, DS_EchoTable_t *, EchoTable);
+    UT_GenStub_AddParam(DS_IsPacketEcho, CFE_SB_MsgId_t, MessageID);
+    UT_GenStub_AddParam(DS_IsPacketEcho, const CFE_MSG_Message_t *, MessagePtr);
+
+    UT_GenStub_Execute(DS_IsPacketEcho, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_IsPacketEcho, bool);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for DS_IsPacketFiltered()
@@ -197,3 +884,97 @@ bool DS_IsPacketFiltered(CFE_MSG_Message_t *MessagePtr, uint16 FilterType, uint1
 
     return UT_GenStub_GetReturnValue(DS_IsPacketFiltered, bool);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_IsPacketInWindow()
+ * ----------------------------------------------------
+ */
+bool DS_IsPacketInWindow(const CFE_MSG_Message_t *MessagePtr, DS_FilterWindowStatus_t *WindowStatus,
+                         uint16 Algorithm_X, uint16 Algorithm_O)
+{
+    UT_GenStub_SetupReturnBuffer(DS_IsPacketInWindow, bool);
+
+    UT_GenStub_AddParam(DS_IsPacketInWindow, const CFE_MSG_Message_t *, MessagePtr);
+    UT_GenStub_AddParam(DS_IsPacketInWindow, DS_FilterWindowStatus_t *, WindowStatus);
+    UT_GenStub_AddParam(DS_IsPacketInWindow, uint16, Algorithm_X);
+    UT_GenStub_AddParam(DS_IsPacketInWindow, uint16, Algorithm_O);
+
+    UT_GenStub_Execute(DS_IsPacketInWindow, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_IsPacketInWindow, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_IsPacketMatched()
+ * ----------------------------------------------------
+ */
+bool DS_IsPacketMatched(const CFE_MSG_Message_t *MessagePtr, const DS_PacketPredicate_t *Predicate)
+{
+    UT_GenStub_SetupReturnBuffer(DS_IsPacketMatched, bool);
+
+    UT_GenStub_AddParam(DS_IsPacketMatched, const CFE_MSG_Message_t *, MessagePtr);
+    UT_GenStub_AddParam(DS_IsPacketMatched, const DS_PacketPredicate_t *, Predicate);
+
+    UT_GenStub_Execute(DS_IsPacketMatched, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_IsPacketMatched, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_IsPacketOverRate()
+ * ----------------------------------------------------
+ */
+bool DS_IsPacketOverRate(const CFE_MSG_Message_t *MessagePtr, DS_RateLimitStatus_t *RateStatus, uint16 RatePackets,
+                         uint32 RateBytes)
+{
+    UT_GenStub_SetupReturnBuffer(DS_IsPacketOverRate, bool);
+
+    UT_GenStub_AddParam(DS_IsPacketOverRate, const CFE_MSG_Message_t *, MessagePtr);
+    UT_GenStub_AddParam(DS_IsPacketOverRate, DS_RateLimitStatus_t *, RateStatus);
+    UT_GenStub_AddParam(DS_IsPacketOverRate, uint16, RatePackets);
+    UT_GenStub_AddParam(DS_IsPacketOverRate, uint32, RateBytes);
+
+    UT_GenStub_Execute(DS_IsPacketOverRate, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_IsPacketOverRate, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_IsPacketUnchanged()
+ * ----------------------------------------------------
+ */
+bool DS_IsPacketUnchanged(const CFE_MSG_Message_t *MessagePtr, DS_FilterChangeStatus_t *ChangeStatus,
+                          uint16 Algorithm_X)
+{
+    UT_GenStub_SetupReturnBuffer(DS_IsPacketUnchanged, bool);
+
+    UT_GenStub_AddParam(DS_IsPacketUnchanged, const CFE_MSG_Message_t *, MessagePtr);
+    UT_GenStub_AddParam(DS_IsPacketUnchanged, DS_FilterChangeStatus_t *, ChangeStatus);
+    UT_GenStub_AddParam(DS_IsPacketUnchanged, uint16, Algorithm_X);
+
+    UT_GenStub_Execute(DS_IsPacketUnchanged, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_IsPacketUnchanged, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_PacketHash()
+ * ----------------------------------------------------
+ */
+uint32 DS_PacketHash(const uint8 *Data, uint32 Length, uint32 Hash)
+{
+    UT_GenStub_SetupReturnBuffer(DS_PacketHash, uint32);
+
+    UT_GenStub_AddParam(DS_PacketHash, const uint8 *, Data);
+    UT_GenStub_AddParam(DS_PacketHash, uint32, Length);
+    UT_GenStub_AddParam(DS_PacketHash, uint32, Hash);
+
+    UT_GenStub_Execute(DS_PacketHash, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_PacketHash, uint32);
+}
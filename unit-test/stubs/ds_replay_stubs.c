@@ -0,0 +1,106 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in ds_replay header
+ */
+
+#include "ds_replay.h"
+#include "utgenstub.h"
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_ReplayFile()
+ * ----------------------------------------------------
+ */
+void DS_ReplayFile(void)
+{
+    UT_GenStub_Execute(DS_ReplayFile, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_ReplayInit()
+ * ----------------------------------------------------
+ */
+CFE_Status_t DS_ReplayInit(void)
+{
+    UT_GenStub_SetupReturnBuffer(DS_ReplayInit, CFE_Status_t);
+
+    UT_GenStub_Execute(DS_ReplayInit, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_ReplayInit, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_ReplayNextPacket()
+ * ----------------------------------------------------
+ */
+int32 DS_ReplayNextPacket(CFE_MSG_Message_t **MsgPtrPtr)
+{
+    UT_GenStub_SetupReturnBuffer(DS_ReplayNextPacket, int32);
+
+    UT_GenStub_AddParam(DS_ReplayNextPacket, CFE_MSG_Message_t * *, MsgPtrPtr);
+
+    UT_GenStub_Execute(DS_ReplayNextPacket, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_ReplayNextPacket, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_ReplayPacket()
+ * ----------------------------------------------------
+ */
+CFE_Status_t DS_ReplayPacket(CFE_MSG_Message_t *MsgPtr)
+{
+    UT_GenStub_SetupReturnBuffer(DS_ReplayPacket, CFE_Status_t);
+
+    UT_GenStub_AddParam(DS_ReplayPacket, CFE_MSG_Message_t *, MsgPtr);
+
+    UT_GenStub_Execute(DS_ReplayPacket, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_ReplayPacket, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_ReplaySeek()
+ * ----------------------------------------------------
+ */
+int32 DS_ReplaySeek(void)
+{
+    UT_GenStub_SetupReturnBuffer(DS_ReplaySeek, int32);
+
+    UT_GenStub_Execute(DS_ReplaySeek, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_ReplaySeek, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_ReplayTask()
+ * ----------------------------------------------------
+ */
+void DS_ReplayTask(void)
+{
+    UT_GenStub_Execute(DS_ReplayTask, Basic, NULL);
+}
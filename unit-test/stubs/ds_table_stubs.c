@@ -42,6 +42,30 @@ int32 DS_TableAddMsgID(CFE_SB_MsgId_t MessageID, int32 FilterIndex)
     return UT_GenStub_GetReturnValue(DS_TableAddMsgID, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_TableAddWildcard()
+ * ----------------------------------------------------
+ */
+void DS_TableAddWildcard(int32 FilterIndex)
+{
+    UT_GenStub_AddParam(DS_TableAddWildcard, int32, FilterIndex);
+
+    UT_GenStub_Execute(DS_TableAddWildcard, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_TableCompilePredicate()
+ * ----------------------------------------------------
+ */
+void DS_TableCompilePredicate(int32 FilterIndex)
+{
+    UT_GenStub_AddParam(DS_TableCompilePredicate, int32, FilterIndex);
+
+    UT_GenStub_Execute(DS_TableCompilePredicate, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for DS_TableCreateCDS()
@@ -201,6 +225,25 @@ bool DS_TableVerifyAge(uint32 MaxFileAge)
     return UT_GenStub_GetReturnValue(DS_TableVerifyAge, bool);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_TableVerifyCompress()
+ * ----------------------------------------------------
+ */
+bool DS_TableVerifyCompress(uint16 CompressMode, uint16 FileMode, uint16 IndexPackets, uint16 IndexSeconds)
+{
+    UT_GenStub_SetupReturnBuffer(DS_TableVerifyCompress, bool);
+
+    UT_GenStub_AddParam(DS_TableVerifyCompress, uint16, CompressMode);
+    UT_GenStub_AddParam(DS_TableVerifyCompress, uint16, FileMode);
+    UT_GenStub_AddParam(DS_TableVerifyCompress, uint16, IndexPackets);
+    UT_GenStub_AddParam(DS_TableVerifyCompress, uint16, IndexSeconds);
+
+    UT_GenStub_Execute(DS_TableVerifyCompress, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_TableVerifyCompress, bool);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for DS_TableVerifyCount()
@@ -251,6 +294,23 @@ bool DS_TableVerifyDestFileEntry(DS_DestFileEntry_t *DestFileEntry, uint8 TableI
     return UT_GenStub_GetReturnValue(DS_TableVerifyDestFileEntry, bool);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_TableVerifyDestStoreLength()
+ * ----------------------------------------------------
+ */
+bool DS_TableVerifyDestStoreLength(uint16 FileTableIndex, uint16 FileMode)
+{
+    UT_GenStub_SetupReturnBuffer(DS_TableVerifyDestStoreLength, bool);
+
+    UT_GenStub_AddParam(DS_TableVerifyDestStoreLength, uint16, FileTableIndex);
+    UT_GenStub_AddParam(DS_TableVerifyDestStoreLength, uint16, FileMode);
+
+    UT_GenStub_Execute(DS_TableVerifyDestStoreLength, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_TableVerifyDestStoreLength, bool);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for DS_TableVerifyFileIndex()
@@ -301,6 +361,38 @@ bool DS_TableVerifyFilterEntry(DS_PacketEntry_t *PacketEntry, int32 TableIndex,
     return UT_GenStub_GetReturnValue(DS_TableVerifyFilterEntry, bool);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_TableVerifyFilterType()
+ * ----------------------------------------------------
+ */
+bool DS_TableVerifyFilterType(uint16 FilterType)
+{
+    UT_GenStub_SetupReturnBuffer(DS_TableVerifyFilterType, bool);
+
+    UT_GenStub_AddParam(DS_TableVerifyFilterType, uint16, FilterType);
+
+    UT_GenStub_Execute(DS_TableVerifyFilterType, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_TableVerifyFilterType, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_TableVerifyMode()
+ * ----------------------------------------------------
+ */
+bool DS_TableVerifyMode(uint16 FileMode)
+{
+    UT_GenStub_SetupReturnBuffer(DS_TableVerifyMode, bool);
+
+    UT_GenStub_AddParam(DS_TableVerifyMode, uint16, FileMode);
+
+    UT_GenStub_Execute(DS_TableVerifyMode, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_TableVerifyMode, bool);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for DS_TableVerifyParms()
@@ -319,6 +411,77 @@ bool DS_TableVerifyParms(uint16 Algorithm_N, uint16 Algorithm_X, uint16 Algorith
     return UT_GenStub_GetReturnValue(DS_TableVerifyParms, bool);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_TableVerifyPredicate()
+ * ----------------------------------------------------
+ */
+bool DS_TableVerifyPredicate(const DS_PacketEntry_t *PacketEntry)
+{
+    UT_GenStub_SetupReturnBuffer(DS_TableVerifyPredicate, bool);
+
+    UT_GenStub_AddParam(DS_TableVerifyPredicate, const DS_PacketEntry_t *, PacketEntry);
+
+    UT_GenStub_Execute(DS_TableVerifyPredicate, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_TableVerifyPredicate, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_TableVerifyPriority()
+ * ----------------------------------------------------
+ */
+bool DS_TableVerifyPriority(uint16 Priority)
+{
+    UT_GenStub_SetupReturnBuffer(DS_TableVerifyPriority, bool);
+
+    UT_GenStub_AddParam(DS_TableVerifyPriority, uint16, Priority);
+
+    UT_GenStub_Execute(DS_TableVerifyPriority, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_TableVerifyPriority, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_TableVerifyRecord()
+ * ----------------------------------------------------
+ */
+bool DS_TableVerifyRecord(uint16 RecordMode, uint16 KeyframeInterval, uint16 FileMode, uint16 IndexPackets,
+                          uint16 IndexSeconds)
+{
+    UT_GenStub_SetupReturnBuffer(DS_TableVerifyRecord, bool);
+
+    UT_GenStub_AddParam(DS_TableVerifyRecord, uint16, RecordMode);
+    UT_GenStub_AddParam(DS_TableVerifyRecord, uint16, KeyframeInterval);
+    UT_GenStub_AddParam(DS_TableVerifyRecord, uint16, FileMode);
+    UT_GenStub_AddParam(DS_TableVerifyRecord, uint16, IndexPackets);
+    UT_GenStub_AddParam(DS_TableVerifyRecord, uint16, IndexSeconds);
+
+    UT_GenStub_Execute(DS_TableVerifyRecord, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_TableVerifyRecord, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_TableVerifyShard()
+ * ----------------------------------------------------
+ */
+bool DS_TableVerifyShard(uint16 ShardMode, uint16 ShardFiles, uint16 FileNameType)
+{
+    UT_GenStub_SetupReturnBuffer(DS_TableVerifyShard, bool);
+
+    UT_GenStub_AddParam(DS_TableVerifyShard, uint16, ShardMode);
+    UT_GenStub_AddParam(DS_TableVerifyShard, uint16, ShardFiles);
+    UT_GenStub_AddParam(DS_TableVerifyShard, uint16, FileNameType);
+
+    UT_GenStub_Execute(DS_TableVerifyShard, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_TableVerifyShard, bool);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for DS_TableVerifySize()
@@ -335,6 +498,22 @@ bool DS_TableVerifySize(uint32 MaxFileSize)
     return UT_GenStub_GetReturnValue(DS_TableVerifySize, bool);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_TableVerifySizeLimit()
+ * ----------------------------------------------------
+ */
+bool DS_TableVerifySizeLimit(uint16 SizeLimitMode)
+{
+    UT_GenStub_SetupReturnBuffer(DS_TableVerifySizeLimit, bool);
+
+    UT_GenStub_AddParam(DS_TableVerifySizeLimit, uint16, SizeLimitMode);
+
+    UT_GenStub_Execute(DS_TableVerifySizeLimit, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_TableVerifySizeLimit, bool);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for DS_TableVerifyState()
@@ -351,6 +530,40 @@ bool DS_TableVerifyState(uint16 EnableState)
     return UT_GenStub_GetReturnValue(DS_TableVerifyState, bool);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_TableVerifyStorage()
+ * ----------------------------------------------------
+ */
+bool DS_TableVerifyStorage(uint32 MaxStorageSize, uint32 MaxFileSize)
+{
+    UT_GenStub_SetupReturnBuffer(DS_TableVerifyStorage, bool);
+
+    UT_GenStub_AddParam(DS_TableVerifyStorage, uint32, MaxStorageSize);
+    UT_GenStub_AddParam(DS_TableVerifyStorage, uint32, MaxFileSize);
+
+    UT_GenStub_Execute(DS_TableVerifyStorage, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_TableVerifyStorage, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_TableVerifyStoreLength()
+ * ----------------------------------------------------
+ */
+bool DS_TableVerifyStoreLength(uint16 MaxStoreLength, uint16 FileMode)
+{
+    UT_GenStub_SetupReturnBuffer(DS_TableVerifyStoreLength, bool);
+
+    UT_GenStub_AddParam(DS_TableVerifyStoreLength, uint16, MaxStoreLength);
+    UT_GenStub_AddParam(DS_TableVerifyStoreLength, uint16, FileMode);
+
+    UT_GenStub_Execute(DS_TableVerifyStoreLength, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_TableVerifyStoreLength, bool);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for DS_TableVerifyType()
@@ -366,3 +579,19 @@ bool DS_TableVerifyType(uint16 TimeVsCount)
 
     return UT_GenStub_GetReturnValue(DS_TableVerifyType, bool);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_TableWildcardCount()
+ * ----------------------------------------------------
+ */
+uint32 DS_TableWildcardCount(uint32 MessageMask)
+{
+    UT_GenStub_SetupReturnBuffer(DS_TableWildcardCount, uint32);
+
+    UT_GenStub_AddParam(DS_TableWildcardCount, uint32, MessageMask);
+
+    UT_GenStub_Execute(DS_TableWildcardCount, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(DS_TableWildcardCount, uint32);
+}
@@ -50,27 +50,42 @@ extern CFE_ES_WriteToSysLog_context_t context_CFE_ES_WriteToSysLog;
 /* Command buffer typedef for any handler */
 typedef union
 {
-    CFE_SB_Buffer_t        Buf;
-    DS_NoopCmd_t           NoopCmd;
-    DS_ResetCountersCmd_t  ResetCountersCmd;
-    DS_SetAppStateCmd_t    AppStateCmd;
-    DS_SetFilterFileCmd_t  FilterFileCmd;
-    DS_SetFilterTypeCmd_t  FilterTypeCmd;
-    DS_SetFilterParmsCmd_t FilterParmsCmd;
-    DS_SetDestTypeCmd_t    DestTypeCmd;
-    DS_SetDestStateCmd_t   DestStateCmd;
-    DS_SetDestPathCmd_t    DestPathCmd;
-    DS_SetDestBaseCmd_t    DestBaseCmd;
-    DS_SetDestExtCmd_t     DestExtCmd;
-    DS_SetDestSizeCmd_t    DestSizeCmd;
-    DS_SetDestAgeCmd_t     DestAgeCmd;
-    DS_SetDestCountCmd_t   DestCountCmd;
-    DS_CloseFileCmd_t      CloseFileCmd;
-    DS_CloseAllCmd_t       CloseAllCmd;
-    DS_GetFileInfoCmd_t    GetFileInfoCmd;
-    DS_AddMidCmd_t         AddMidCmd;
-    DS_RemoveMidCmd_t      RemoveMidCmd;
-    DS_SendHkCmd_t         SendHkCmd;
+    CFE_SB_Buffer_t         Buf;
+    DS_NoopCmd_t            NoopCmd;
+    DS_ResetCountersCmd_t   ResetCountersCmd;
+    DS_SetAppStateCmd_t     AppStateCmd;
+    DS_SetFilterFileCmd_t   FilterFileCmd;
+    DS_SetFilterTypeCmd_t   FilterTypeCmd;
+    DS_SetFilterParmsCmd_t  FilterParmsCmd;
+    DS_SetDestTypeCmd_t     DestTypeCmd;
+    DS_SetDestStateCmd_t    DestStateCmd;
+    DS_SetDestPathCmd_t     DestPathCmd;
+    DS_SetDestBaseCmd_t     DestBaseCmd;
+    DS_SetDestExtCmd_t      DestExtCmd;
+    DS_SetDestSizeCmd_t     DestSizeCmd;
+    DS_SetDestAgeCmd_t      DestAgeCmd;
+    DS_SetDestCountCmd_t    DestCountCmd;
+    DS_CloseFileCmd_t       CloseFileCmd;
+    DS_CloseAllCmd_t        CloseAllCmd;
+    DS_GetFileInfoCmd_t     GetFileInfoCmd;
+    DS_AddMidCmd_t          AddMidCmd;
+    DS_RemoveMidCmd_t       RemoveMidCmd;
+    DS_ExtractFileCmd_t     ExtractFileCmd;
+    DS_ReplayStartCmd_t     ReplayStartCmd;
+    DS_ReplayStopCmd_t      ReplayStopCmd;
+    DS_ReplayPauseCmd_t     ReplayPauseCmd;
+    DS_ReplayResumeCmd_t    ReplayResumeCmd;
+    DS_ReplaySeekCmd_t      ReplaySeekCmd;
+    DS_SetFilterRateCmd_t   FilterRateCmd;
+    DS_SetDestRateCmd_t     DestRateCmd;
+    DS_GetDestStatsCmd_t    GetDestStatsCmd;
+    DS_SetRecorderCmd_t     SetRecorderCmd;
+    DS_TriggerRecorderCmd_t TriggerRecorderCmd;
+    DS_SendCacheCmd_t       SendCacheCmd;
+    DS_WriteCacheCmd_t      WriteCacheCmd;
+    DS_GetManifestCmd_t     GetManifestCmd;
+    DS_SendHkCmd_t          SendHkCmd;
+    DS_BacklogProbeCmd_t    BacklogProbeCmd;
 } UT_CmdBuf_t;
 
 extern UT_CmdBuf_t UT_CmdBuf;